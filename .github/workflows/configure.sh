@@ -55,6 +55,9 @@ elif [ "${maker}" = "cmake" ]; then
     if [[ $BLAS_LIBRARIES != "" ]]; then
         export cmake_blas_libraries="-DBLAS_LIBRARIES=$BLAS_LIBRARIES"
     fi
+    if [[ $trace != "" ]]; then
+        export cmake_trace="-Duse_trace=$trace"
+    fi
     if [[ $bla_vendor != "" ]]; then
         unset cmake_blas
         unset cmake_blas_int
@@ -78,7 +81,7 @@ elif [ "${maker}" = "cmake" ]; then
 
     cmake -Dcolor=no \
           -DCMAKE_INSTALL_PREFIX=${top}/install \
-          -Dgpu_backend=${gpu_backend} .. \
+          -Dgpu_backend=${gpu_backend} $cmake_trace .. \
           || exit 13
 fi
 
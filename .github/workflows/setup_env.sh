@@ -68,6 +68,7 @@ print "blas       = '${blas}'"
 print "blas_int   = '${blas_int}'"
 print "bla_vendor = '${bla_vendor}'"
 print "check      = '${check}'"
+print "trace      = '${trace}'"
 
 export CPATH LIBRARY_PATH LD_LIBRARY_PATH
 
@@ -118,6 +119,11 @@ export gpu_backend=none
 export color=no
 export CXXFLAGS="-Werror -Wno-unused-command-line-argument"
 
+# CMake uses the use_trace option (see configure.sh); make uses the define.
+if [[ $trace = "yes" ]] && [[ $maker = "make" ]]; then
+    export CXXFLAGS+=" -DLAPACK_TRACE"
+fi
+
 #----------------------------------------------------------------- Compiler
 if [[ $device = "gpu_intel" ]] \
     || [[ $bla_vendor = Intel* ]]; then
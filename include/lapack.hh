@@ -20,5 +20,15 @@ const char* lapackpp_id();
 }  // namespace lapack
 
 #include "lapack/wrappers.hh"
+#include "lapack/batch.hh"
+#include "lapack/workspace.hh"
+#include "lapack/fixed.hh"
+#include "lapack/views.hh"
+#include "lapack/gels_stream.hh"
+#include "lapack/factor.hh"
+#include "lapack/refine.hh"
+#include "lapack/threads.hh"
+#include "lapack/host_stream.hh"
+#include "lapack/trace.hh"
 
 #endif // LAPACK_HH
@@ -0,0 +1,807 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_BATCH_HH
+#define LAPACK_BATCH_HH
+
+#include "lapack/util.hh"
+
+namespace lapack {
+
+// Batched routines operate on many independent, same-sized matrices,
+// parallelized across matrices with OpenMP.
+// Each comes in two forms:
+//  - strided:       matrix i is at A + i*strideA;
+//  - pointer array: matrix i is at Aarray[ i ].
+// Some also have a variable-size form, *_vbatch, where matrix i is at
+// Aarray[ i ] with its own dimensions, e.g., m[ i ], n[ i ], lda[ i ].
+// Invalid arguments throw Error; per-matrix results, e.g., a zero pivot,
+// are returned in info[ i ] instead of throwing.
+//
+// This is in alphabetical order.
+
+// -----------------------------------------------------------------------------
+void gels_batch(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda, int64_t strideA,
+    float* B, int64_t ldb, int64_t strideB,
+    int64_t batch_count, int64_t* info );
+
+void gels_batch(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda, int64_t strideA,
+    double* B, int64_t ldb, int64_t strideB,
+    int64_t batch_count, int64_t* info );
+
+void gels_batch(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_count, int64_t* info );
+
+void gels_batch(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_count, int64_t* info );
+
+void gels_batch(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    float* const* Aarray, int64_t lda,
+    float* const* Barray, int64_t ldb,
+    int64_t batch_count, int64_t* info );
+
+void gels_batch(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    double* const* Aarray, int64_t lda,
+    double* const* Barray, int64_t ldb,
+    int64_t batch_count, int64_t* info );
+
+void gels_batch(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* const* Aarray, int64_t lda,
+    std::complex<float>* const* Barray, int64_t ldb,
+    int64_t batch_count, int64_t* info );
+
+void gels_batch(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* const* Aarray, int64_t lda,
+    std::complex<double>* const* Barray, int64_t ldb,
+    int64_t batch_count, int64_t* info );
+
+void gels_vbatch(
+    lapack::Op trans,
+    int64_t const* m, int64_t const* n, int64_t const* nrhs,
+    float* const* Aarray, int64_t const* lda,
+    float* const* Barray, int64_t const* ldb,
+    int64_t batch_count, int64_t* info );
+
+void gels_vbatch(
+    lapack::Op trans,
+    int64_t const* m, int64_t const* n, int64_t const* nrhs,
+    double* const* Aarray, int64_t const* lda,
+    double* const* Barray, int64_t const* ldb,
+    int64_t batch_count, int64_t* info );
+
+void gels_vbatch(
+    lapack::Op trans,
+    int64_t const* m, int64_t const* n, int64_t const* nrhs,
+    std::complex<float>* const* Aarray, int64_t const* lda,
+    std::complex<float>* const* Barray, int64_t const* ldb,
+    int64_t batch_count, int64_t* info );
+
+void gels_vbatch(
+    lapack::Op trans,
+    int64_t const* m, int64_t const* n, int64_t const* nrhs,
+    std::complex<double>* const* Aarray, int64_t const* lda,
+    std::complex<double>* const* Barray, int64_t const* ldb,
+    int64_t batch_count, int64_t* info );
+
+// -----------------------------------------------------------------------------
+void geqrf_batch(
+    int64_t m, int64_t n,
+    float* A, int64_t lda, int64_t strideA,
+    float* tau, int64_t stride_tau,
+    int64_t batch_count, int64_t* info );
+
+void geqrf_batch(
+    int64_t m, int64_t n,
+    double* A, int64_t lda, int64_t strideA,
+    double* tau, int64_t stride_tau,
+    int64_t batch_count, int64_t* info );
+
+void geqrf_batch(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    std::complex<float>* tau, int64_t stride_tau,
+    int64_t batch_count, int64_t* info );
+
+void geqrf_batch(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    std::complex<double>* tau, int64_t stride_tau,
+    int64_t batch_count, int64_t* info );
+
+void geqrf_batch(
+    int64_t m, int64_t n,
+    float* const* Aarray, int64_t lda,
+    float* const* tau_array,
+    int64_t batch_count, int64_t* info );
+
+void geqrf_batch(
+    int64_t m, int64_t n,
+    double* const* Aarray, int64_t lda,
+    double* const* tau_array,
+    int64_t batch_count, int64_t* info );
+
+void geqrf_batch(
+    int64_t m, int64_t n,
+    std::complex<float>* const* Aarray, int64_t lda,
+    std::complex<float>* const* tau_array,
+    int64_t batch_count, int64_t* info );
+
+void geqrf_batch(
+    int64_t m, int64_t n,
+    std::complex<double>* const* Aarray, int64_t lda,
+    std::complex<double>* const* tau_array,
+    int64_t batch_count, int64_t* info );
+
+void geqrf_vbatch(
+    int64_t const* m, int64_t const* n,
+    float* const* Aarray, int64_t const* lda,
+    float* const* tau_array,
+    int64_t batch_count, int64_t* info );
+
+void geqrf_vbatch(
+    int64_t const* m, int64_t const* n,
+    double* const* Aarray, int64_t const* lda,
+    double* const* tau_array,
+    int64_t batch_count, int64_t* info );
+
+void geqrf_vbatch(
+    int64_t const* m, int64_t const* n,
+    std::complex<float>* const* Aarray, int64_t const* lda,
+    std::complex<float>* const* tau_array,
+    int64_t batch_count, int64_t* info );
+
+void geqrf_vbatch(
+    int64_t const* m, int64_t const* n,
+    std::complex<double>* const* Aarray, int64_t const* lda,
+    std::complex<double>* const* tau_array,
+    int64_t batch_count, int64_t* info );
+
+// -----------------------------------------------------------------------------
+void gesdd_batch(
+    lapack::Job jobz, int64_t m, int64_t n,
+    float* A, int64_t lda, int64_t strideA,
+    float* S, int64_t strideS,
+    float* U, int64_t ldu, int64_t strideU,
+    float* VT, int64_t ldvt, int64_t strideVT,
+    int64_t batch_count, int64_t* info );
+
+void gesdd_batch(
+    lapack::Job jobz, int64_t m, int64_t n,
+    double* A, int64_t lda, int64_t strideA,
+    double* S, int64_t strideS,
+    double* U, int64_t ldu, int64_t strideU,
+    double* VT, int64_t ldvt, int64_t strideVT,
+    int64_t batch_count, int64_t* info );
+
+void gesdd_batch(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    float* S, int64_t strideS,
+    std::complex<float>* U, int64_t ldu, int64_t strideU,
+    std::complex<float>* VT, int64_t ldvt, int64_t strideVT,
+    int64_t batch_count, int64_t* info );
+
+void gesdd_batch(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    double* S, int64_t strideS,
+    std::complex<double>* U, int64_t ldu, int64_t strideU,
+    std::complex<double>* VT, int64_t ldvt, int64_t strideVT,
+    int64_t batch_count, int64_t* info );
+
+void gesdd_batch(
+    lapack::Job jobz, int64_t m, int64_t n,
+    float* const* Aarray, int64_t lda,
+    float* const* Sarray,
+    float* const* Uarray, int64_t ldu,
+    float* const* VTarray, int64_t ldvt,
+    int64_t batch_count, int64_t* info );
+
+void gesdd_batch(
+    lapack::Job jobz, int64_t m, int64_t n,
+    double* const* Aarray, int64_t lda,
+    double* const* Sarray,
+    double* const* Uarray, int64_t ldu,
+    double* const* VTarray, int64_t ldvt,
+    int64_t batch_count, int64_t* info );
+
+void gesdd_batch(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<float>* const* Aarray, int64_t lda,
+    float* const* Sarray,
+    std::complex<float>* const* Uarray, int64_t ldu,
+    std::complex<float>* const* VTarray, int64_t ldvt,
+    int64_t batch_count, int64_t* info );
+
+void gesdd_batch(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<double>* const* Aarray, int64_t lda,
+    double* const* Sarray,
+    std::complex<double>* const* Uarray, int64_t ldu,
+    std::complex<double>* const* VTarray, int64_t ldvt,
+    int64_t batch_count, int64_t* info );
+
+// -----------------------------------------------------------------------------
+void gesv_batch(
+    int64_t n, int64_t nrhs,
+    float* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    float* B, int64_t ldb, int64_t strideB,
+    int64_t batch_count, int64_t* info );
+
+void gesv_batch(
+    int64_t n, int64_t nrhs,
+    double* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    double* B, int64_t ldb, int64_t strideB,
+    int64_t batch_count, int64_t* info );
+
+void gesv_batch(
+    int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_count, int64_t* info );
+
+void gesv_batch(
+    int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_count, int64_t* info );
+
+void gesv_batch(
+    int64_t n, int64_t nrhs,
+    float* const* Aarray, int64_t lda,
+    int64_t* const* ipiv_array,
+    float* const* Barray, int64_t ldb,
+    int64_t batch_count, int64_t* info );
+
+void gesv_batch(
+    int64_t n, int64_t nrhs,
+    double* const* Aarray, int64_t lda,
+    int64_t* const* ipiv_array,
+    double* const* Barray, int64_t ldb,
+    int64_t batch_count, int64_t* info );
+
+void gesv_batch(
+    int64_t n, int64_t nrhs,
+    std::complex<float>* const* Aarray, int64_t lda,
+    int64_t* const* ipiv_array,
+    std::complex<float>* const* Barray, int64_t ldb,
+    int64_t batch_count, int64_t* info );
+
+void gesv_batch(
+    int64_t n, int64_t nrhs,
+    std::complex<double>* const* Aarray, int64_t lda,
+    int64_t* const* ipiv_array,
+    std::complex<double>* const* Barray, int64_t ldb,
+    int64_t batch_count, int64_t* info );
+
+// -----------------------------------------------------------------------------
+void gesvd_batch(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    float* A, int64_t lda, int64_t strideA,
+    float* S, int64_t strideS,
+    float* U, int64_t ldu, int64_t strideU,
+    float* VT, int64_t ldvt, int64_t strideVT,
+    int64_t batch_count, int64_t* info );
+
+void gesvd_batch(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    double* A, int64_t lda, int64_t strideA,
+    double* S, int64_t strideS,
+    double* U, int64_t ldu, int64_t strideU,
+    double* VT, int64_t ldvt, int64_t strideVT,
+    int64_t batch_count, int64_t* info );
+
+void gesvd_batch(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    float* S, int64_t strideS,
+    std::complex<float>* U, int64_t ldu, int64_t strideU,
+    std::complex<float>* VT, int64_t ldvt, int64_t strideVT,
+    int64_t batch_count, int64_t* info );
+
+void gesvd_batch(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    double* S, int64_t strideS,
+    std::complex<double>* U, int64_t ldu, int64_t strideU,
+    std::complex<double>* VT, int64_t ldvt, int64_t strideVT,
+    int64_t batch_count, int64_t* info );
+
+void gesvd_batch(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    float* const* Aarray, int64_t lda,
+    float* const* Sarray,
+    float* const* Uarray, int64_t ldu,
+    float* const* VTarray, int64_t ldvt,
+    int64_t batch_count, int64_t* info );
+
+void gesvd_batch(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    double* const* Aarray, int64_t lda,
+    double* const* Sarray,
+    double* const* Uarray, int64_t ldu,
+    double* const* VTarray, int64_t ldvt,
+    int64_t batch_count, int64_t* info );
+
+void gesvd_batch(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<float>* const* Aarray, int64_t lda,
+    float* const* Sarray,
+    std::complex<float>* const* Uarray, int64_t ldu,
+    std::complex<float>* const* VTarray, int64_t ldvt,
+    int64_t batch_count, int64_t* info );
+
+void gesvd_batch(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<double>* const* Aarray, int64_t lda,
+    double* const* Sarray,
+    std::complex<double>* const* Uarray, int64_t ldu,
+    std::complex<double>* const* VTarray, int64_t ldvt,
+    int64_t batch_count, int64_t* info );
+
+// -----------------------------------------------------------------------------
+void getrf_batch(
+    int64_t m, int64_t n,
+    float* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    int64_t batch_count, int64_t* info );
+
+void getrf_batch(
+    int64_t m, int64_t n,
+    double* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    int64_t batch_count, int64_t* info );
+
+void getrf_batch(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    int64_t batch_count, int64_t* info );
+
+void getrf_batch(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    int64_t batch_count, int64_t* info );
+
+void getrf_batch(
+    int64_t m, int64_t n,
+    float* const* Aarray, int64_t lda,
+    int64_t* const* ipiv_array,
+    int64_t batch_count, int64_t* info );
+
+void getrf_batch(
+    int64_t m, int64_t n,
+    double* const* Aarray, int64_t lda,
+    int64_t* const* ipiv_array,
+    int64_t batch_count, int64_t* info );
+
+void getrf_batch(
+    int64_t m, int64_t n,
+    std::complex<float>* const* Aarray, int64_t lda,
+    int64_t* const* ipiv_array,
+    int64_t batch_count, int64_t* info );
+
+void getrf_batch(
+    int64_t m, int64_t n,
+    std::complex<double>* const* Aarray, int64_t lda,
+    int64_t* const* ipiv_array,
+    int64_t batch_count, int64_t* info );
+
+// -----------------------------------------------------------------------------
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda, int64_t strideA,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    float* B, int64_t ldb, int64_t strideB,
+    int64_t batch_count, int64_t* info );
+
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda, int64_t strideA,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    double* B, int64_t ldb, int64_t strideB,
+    int64_t batch_count, int64_t* info );
+
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda, int64_t strideA,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_count, int64_t* info );
+
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda, int64_t strideA,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_count, int64_t* info );
+
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    float const* const* Aarray, int64_t lda,
+    int64_t const* const* ipiv_array,
+    float* const* Barray, int64_t ldb,
+    int64_t batch_count, int64_t* info );
+
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    double const* const* Aarray, int64_t lda,
+    int64_t const* const* ipiv_array,
+    double* const* Barray, int64_t ldb,
+    int64_t batch_count, int64_t* info );
+
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<float> const* const* Aarray, int64_t lda,
+    int64_t const* const* ipiv_array,
+    std::complex<float>* const* Barray, int64_t ldb,
+    int64_t batch_count, int64_t* info );
+
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<double> const* const* Aarray, int64_t lda,
+    int64_t const* const* ipiv_array,
+    std::complex<double>* const* Barray, int64_t ldb,
+    int64_t batch_count, int64_t* info );
+
+// -----------------------------------------------------------------------------
+void heevd_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, int64_t strideA,
+    float* W, int64_t strideW,
+    int64_t batch_count, int64_t* info );
+
+void heevd_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, int64_t strideA,
+    double* W, int64_t strideW,
+    int64_t batch_count, int64_t* info );
+
+void heevd_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    float* W, int64_t strideW,
+    int64_t batch_count, int64_t* info );
+
+void heevd_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    double* W, int64_t strideW,
+    int64_t batch_count, int64_t* info );
+
+void heevd_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* const* Aarray, int64_t lda,
+    float* const* Warray,
+    int64_t batch_count, int64_t* info );
+
+void heevd_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* const* Aarray, int64_t lda,
+    double* const* Warray,
+    int64_t batch_count, int64_t* info );
+
+void heevd_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* const* Aarray, int64_t lda,
+    float* const* Warray,
+    int64_t batch_count, int64_t* info );
+
+void heevd_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* const* Aarray, int64_t lda,
+    double* const* Warray,
+    int64_t batch_count, int64_t* info );
+
+// -----------------------------------------------------------------------------
+void posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda, int64_t strideA,
+    float* B, int64_t ldb, int64_t strideB,
+    int64_t batch_count, int64_t* info );
+
+void posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda, int64_t strideA,
+    double* B, int64_t ldb, int64_t strideB,
+    int64_t batch_count, int64_t* info );
+
+void posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_count, int64_t* info );
+
+void posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_count, int64_t* info );
+
+void posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* const* Aarray, int64_t lda,
+    float* const* Barray, int64_t ldb,
+    int64_t batch_count, int64_t* info );
+
+void posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* const* Aarray, int64_t lda,
+    double* const* Barray, int64_t ldb,
+    int64_t batch_count, int64_t* info );
+
+void posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* const* Aarray, int64_t lda,
+    std::complex<float>* const* Barray, int64_t ldb,
+    int64_t batch_count, int64_t* info );
+
+void posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* const* Aarray, int64_t lda,
+    std::complex<double>* const* Barray, int64_t ldb,
+    int64_t batch_count, int64_t* info );
+
+// -----------------------------------------------------------------------------
+void potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, int64_t strideA,
+    int64_t batch_count, int64_t* info );
+
+void potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, int64_t strideA,
+    int64_t batch_count, int64_t* info );
+
+void potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    int64_t batch_count, int64_t* info );
+
+void potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    int64_t batch_count, int64_t* info );
+
+void potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    float* const* Aarray, int64_t lda,
+    int64_t batch_count, int64_t* info );
+
+void potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    double* const* Aarray, int64_t lda,
+    int64_t batch_count, int64_t* info );
+
+void potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* const* Aarray, int64_t lda,
+    int64_t batch_count, int64_t* info );
+
+void potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* const* Aarray, int64_t lda,
+    int64_t batch_count, int64_t* info );
+
+// -----------------------------------------------------------------------------
+void potrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda, int64_t strideA,
+    float* B, int64_t ldb, int64_t strideB,
+    int64_t batch_count, int64_t* info );
+
+void potrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda, int64_t strideA,
+    double* B, int64_t ldb, int64_t strideB,
+    int64_t batch_count, int64_t* info );
+
+void potrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda, int64_t strideA,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_count, int64_t* info );
+
+void potrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda, int64_t strideA,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_count, int64_t* info );
+
+void potrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* const* Aarray, int64_t lda,
+    float* const* Barray, int64_t ldb,
+    int64_t batch_count, int64_t* info );
+
+void potrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* const* Aarray, int64_t lda,
+    double* const* Barray, int64_t ldb,
+    int64_t batch_count, int64_t* info );
+
+void potrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* const* Aarray, int64_t lda,
+    std::complex<float>* const* Barray, int64_t ldb,
+    int64_t batch_count, int64_t* info );
+
+void potrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* const* Aarray, int64_t lda,
+    std::complex<double>* const* Barray, int64_t ldb,
+    int64_t batch_count, int64_t* info );
+
+// -----------------------------------------------------------------------------
+// syevd_batch alias to heevd_batch
+inline void syevd_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, int64_t strideA,
+    float* W, int64_t strideW,
+    int64_t batch_count, int64_t* info )
+{
+    heevd_batch( jobz, uplo, n, A, lda, strideA, W, strideW,
+                 batch_count, info );
+}
+
+// syevd_batch alias to heevd_batch
+inline void syevd_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, int64_t strideA,
+    double* W, int64_t strideW,
+    int64_t batch_count, int64_t* info )
+{
+    heevd_batch( jobz, uplo, n, A, lda, strideA, W, strideW,
+                 batch_count, info );
+}
+
+// syevd_batch alias to heevd_batch
+inline void syevd_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* const* Aarray, int64_t lda,
+    float* const* Warray,
+    int64_t batch_count, int64_t* info )
+{
+    heevd_batch( jobz, uplo, n, Aarray, lda, Warray, batch_count, info );
+}
+
+// syevd_batch alias to heevd_batch
+inline void syevd_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* const* Aarray, int64_t lda,
+    double* const* Warray,
+    int64_t batch_count, int64_t* info )
+{
+    heevd_batch( jobz, uplo, n, Aarray, lda, Warray, batch_count, info );
+}
+
+// -----------------------------------------------------------------------------
+void unmqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda, int64_t strideA,
+    float const* tau, int64_t stride_tau,
+    float* C, int64_t ldc, int64_t strideC,
+    int64_t batch_count, int64_t* info );
+
+void unmqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda, int64_t strideA,
+    double const* tau, int64_t stride_tau,
+    double* C, int64_t ldc, int64_t strideC,
+    int64_t batch_count, int64_t* info );
+
+void unmqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda, int64_t strideA,
+    std::complex<float> const* tau, int64_t stride_tau,
+    std::complex<float>* C, int64_t ldc, int64_t strideC,
+    int64_t batch_count, int64_t* info );
+
+void unmqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda, int64_t strideA,
+    std::complex<double> const* tau, int64_t stride_tau,
+    std::complex<double>* C, int64_t ldc, int64_t strideC,
+    int64_t batch_count, int64_t* info );
+
+void unmqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* const* Aarray, int64_t lda,
+    float const* const* tau_array,
+    float* const* Carray, int64_t ldc,
+    int64_t batch_count, int64_t* info );
+
+void unmqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* const* Aarray, int64_t lda,
+    double const* const* tau_array,
+    double* const* Carray, int64_t ldc,
+    int64_t batch_count, int64_t* info );
+
+void unmqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* const* Aarray, int64_t lda,
+    std::complex<float> const* const* tau_array,
+    std::complex<float>* const* Carray, int64_t ldc,
+    int64_t batch_count, int64_t* info );
+
+void unmqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* const* Aarray, int64_t lda,
+    std::complex<double> const* const* tau_array,
+    std::complex<double>* const* Carray, int64_t ldc,
+    int64_t batch_count, int64_t* info );
+
+// -----------------------------------------------------------------------------
+// ormqr_batch alias to unmqr_batch
+inline void ormqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda, int64_t strideA,
+    float const* tau, int64_t stride_tau,
+    float* C, int64_t ldc, int64_t strideC,
+    int64_t batch_count, int64_t* info )
+{
+    unmqr_batch( side, trans, m, n, k, A, lda, strideA, tau, stride_tau,
+                 C, ldc, strideC, batch_count, info );
+}
+
+// ormqr_batch alias to unmqr_batch
+inline void ormqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda, int64_t strideA,
+    double const* tau, int64_t stride_tau,
+    double* C, int64_t ldc, int64_t strideC,
+    int64_t batch_count, int64_t* info )
+{
+    unmqr_batch( side, trans, m, n, k, A, lda, strideA, tau, stride_tau,
+                 C, ldc, strideC, batch_count, info );
+}
+
+// ormqr_batch alias to unmqr_batch
+inline void ormqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* const* Aarray, int64_t lda,
+    float const* const* tau_array,
+    float* const* Carray, int64_t ldc,
+    int64_t batch_count, int64_t* info )
+{
+    unmqr_batch( side, trans, m, n, k, Aarray, lda, tau_array,
+                 Carray, ldc, batch_count, info );
+}
+
+// ormqr_batch alias to unmqr_batch
+inline void ormqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* const* Aarray, int64_t lda,
+    double const* const* tau_array,
+    double* const* Carray, int64_t ldc,
+    int64_t batch_count, int64_t* info )
+{
+    unmqr_batch( side, trans, m, n, k, Aarray, lda, tau_array,
+                 Carray, ldc, batch_count, info );
+}
+
+}  // namespace lapack
+
+#endif // LAPACK_BATCH_HH
@@ -13,6 +13,24 @@
     #include <cusolverDn.h>
 #endif
 
+#include <functional>
+
+// Without a GPU backend, lapack::Queue runs the device routines on the host.
+#if ! defined(LAPACK_HAVE_CUBLAS) && ! defined(LAPACK_HAVE_ROCBLAS) \
+    && ! defined(LAPACK_HAVE_SYCL)
+    #define LAPACK_HAVE_HOST_QUEUE
+
+    #include <algorithm>
+    #include <condition_variable>
+    #include <cstdlib>
+    #include <cstring>
+    #include <deque>
+    #include <exception>
+    #include <mutex>
+    #include <new>
+    #include <thread>
+#endif
+
 namespace lapack {
 
 // Since we pass pointers to these integers, their types have to match
@@ -35,6 +53,61 @@ namespace lapack {
 #endif
 
 //------------------------------------------------------------------------------
+/// Growable workspace buffer, reused by successive calls. The buffer
+/// grows when a larger size is requested, and is freed only by trim()
+/// or the destructor; it never shrinks otherwise. Memory comes from
+/// alloc, and goes back through release, which must first wait for
+/// any work still using the buffer. lapack::Queue owns one pool for
+/// device workspace and one for host workspace.
+class WorkspacePool
+{
+public:
+    using alloc_func   = std::function< void* (size_t bytes) >;
+    using release_func = std::function< void (void* ptr) >;
+
+    WorkspacePool( alloc_func alloc, release_func release );
+    ~WorkspacePool();
+
+    // Disable copying; must construct anew.
+    WorkspacePool( WorkspacePool const& ) = delete;
+    WorkspacePool& operator=( WorkspacePool const& ) = delete;
+
+    void* get( size_t bytes );
+    void trim();
+
+    /// @return bytes currently allocated.
+    size_t size() const { return size_; }
+
+    /// @return largest size requested from get() since construction.
+    size_t high_water() const { return high_water_; }
+
+    /// @return number of allocations since construction.
+    int64_t num_allocs() const { return num_allocs_; }
+
+private:
+    alloc_func   alloc_;
+    release_func release_;
+    void*   ptr_        = nullptr;
+    size_t  size_       = 0;
+    size_t  high_water_ = 0;
+    int64_t num_allocs_ = 0;
+};
+
+//------------------------------------------------------------------------------
+/// Queue for the device routines potrf, getrf, geqrf, heevd, etc.
+///
+/// With the host backend (LAPACK_HAVE_HOST_QUEUE, when LAPACK++ has no
+/// GPU support), the queue owns a host thread that executes submitted
+/// tasks in order. The device routines check their arguments, then run
+/// host LAPACK asynchronously on that thread, so "device" memory is
+/// host memory, as allocated by lapack::device_malloc. Call sync() on
+/// the lapack::Queue, not on its blas::Queue base, to wait for them.
+///
+/// The queue keeps a workspace pool for the device routines' dev_work
+/// and host_work. Overloads without workspace arguments, such as
+/// getrf( m, n, dA, ldda, dev_ipiv, dev_info, queue ), query the size
+/// and take workspace from the pool, which grows as needed. Since
+/// routines on a queue execute in order, they all share one buffer.
 class Queue: public blas::Queue
 {
 public:
@@ -45,6 +118,7 @@ public:
             #if CUSOLVER_VERSION >= 11000
                 , solver_params_( nullptr )
             #endif
+            , syevj_params_( nullptr )
         #endif
     {}
 
@@ -55,11 +129,18 @@ public:
             #if CUSOLVER_VERSION >= 11000
                 , solver_params_( nullptr )
             #endif
+            , syevj_params_( nullptr )
         #endif
     {}
 
     ~Queue()
     {
+        #if defined(LAPACK_HAVE_HOST_QUEUE)
+            shutdown();
+            // Discard task errors, so freeing the pools can't throw.
+            error_ = nullptr;
+        #endif
+
         #if defined(LAPACK_HAVE_CUBLAS)
             blas::internal_set_device( device() );
             #if CUSOLVER_VERSION >= 11000
@@ -69,6 +150,11 @@ public:
                 }
             #endif
 
+            if (syevj_params_) {
+                cusolverDnDestroySyevjInfo( syevj_params_ );
+                syevj_params_ = nullptr;
+            }
+
             if (solver_) {
                 cusolverDnDestroy( solver_ );
                 solver_ = nullptr;
@@ -112,6 +198,67 @@ public:
                 return solver_params_;
             }
         #endif
+
+        /// @return cuSolver Jacobi params for heevj, allocating it on
+        /// first use, with default tolerance and max sweeps.
+        syevjInfo_t syevj_params()
+        {
+            if (syevj_params_ == nullptr) {
+                // todo: error handler
+                cusolverStatus_t status;
+                status = cusolverDnCreateSyevjInfo( &syevj_params_ );
+                assert( status == CUSOLVER_STATUS_SUCCESS );
+            }
+            return syevj_params_;
+        }
+    #endif
+
+    /// @return device workspace of at least bytes from this queue's
+    /// pool, growing the pool if needed. Growing waits for the queue
+    /// before freeing the old buffer, which invalidates pointers
+    /// previously returned. For bytes = 0, may return nullptr.
+    void* dev_workspace( size_t bytes )
+    {
+        return dev_pool_.get( bytes );
+    }
+
+    /// @return host workspace of at least bytes from this queue's pool;
+    /// see dev_workspace().
+    void* host_workspace( size_t bytes )
+    {
+        return host_pool_.get( bytes );
+    }
+
+    /// @return bytes of device workspace currently allocated.
+    size_t dev_workspace_size() const { return dev_pool_.size(); }
+
+    /// @return bytes of host workspace currently allocated.
+    size_t host_workspace_size() const { return host_pool_.size(); }
+
+    /// @return largest device workspace requested since construction,
+    /// which is unchanged by trim(). Useful to pre-size the pool by
+    /// calling dev_workspace( dev_workspace_high_water() ).
+    size_t dev_workspace_high_water() const { return dev_pool_.high_water(); }
+
+    /// @return largest host workspace requested since construction.
+    size_t host_workspace_high_water() const { return host_pool_.high_water(); }
+
+    /// Waits for the queue, then frees the device and host workspace
+    /// pools. They grow again on next use.
+    void trim()
+    {
+        dev_pool_.trim();
+        host_pool_.trim();
+    }
+
+    #if defined(LAPACK_HAVE_HOST_QUEUE)
+        /// Runs task on this queue's host thread, after all previously
+        /// submitted tasks. The thread is started on first use.
+        void submit( std::function< void () > task );
+
+        /// Waits until all submitted tasks are done. If any task threw an
+        /// exception, rethrows the first one, and discards the others.
+        void sync();
     #endif
 
 private:
@@ -120,9 +267,113 @@ private:
         #if CUSOLVER_VERSION >= 11000
             cusolverDnParams_t solver_params_;
         #endif
+        syevjInfo_t syevj_params_;
+    #endif
+
+    #if defined(LAPACK_HAVE_HOST_QUEUE)
+        void run();
+        void shutdown();
+
+        std::thread thread_;
+        std::mutex mutex_;
+        std::condition_variable ready_;     ///< signals tasks or stop
+        std::condition_variable idle_;      ///< signals pending_ == 0
+        std::deque< std::function< void () > > tasks_;
+        int64_t pending_ = 0;               ///< tasks queued or running
+        bool stop_ = false;
+        std::exception_ptr error_;
     #endif
+
+    void* workspace_alloc( size_t bytes, bool device );
+    void  workspace_release( void* ptr, bool device );
+
+    // Declared last, so they are destroyed before the members above.
+    WorkspacePool dev_pool_ {
+        [this]( size_t bytes ) { return workspace_alloc( bytes, true ); },
+        [this]( void* ptr ) { workspace_release( ptr, true ); } };
+    WorkspacePool host_pool_ {
+        [this]( size_t bytes ) { return workspace_alloc( bytes, false ); },
+        [this]( void* ptr ) { workspace_release( ptr, false ); } };
 };
 
+#if defined(LAPACK_HAVE_HOST_QUEUE)
+
+//------------------------------------------------------------------------------
+// Memory for the host backend. These mirror blas::device_malloc, etc.,
+// which require GPU support. Copies run in order on the queue's thread.
+
+/// @return host memory for nelements of type T; free with device_free.
+template <typename T>
+T* device_malloc( int64_t nelements, lapack::Queue& queue )
+{
+    lapack_error_if( nelements < 0 );
+    void* ptr = std::malloc( std::max( nelements, int64_t( 1 ) ) * sizeof( T ) );
+    if (ptr == nullptr)
+        throw std::bad_alloc();
+    return static_cast< T* >( ptr );
+}
+
+/// Waits for the queue, then frees memory from device_malloc.
+inline void device_free( void* ptr, lapack::Queue& queue )
+{
+    queue.sync();
+    std::free( ptr );
+}
+
+/// Asynchronously copies nelements from src to dst.
+template <typename T>
+void device_memcpy(
+    T* dst, T const* src, int64_t nelements, lapack::Queue& queue )
+{
+    lapack_error_if( nelements < 0 );
+    queue.submit( [=]() {
+        std::memcpy( dst, src, nelements * sizeof( T ) );
+    } );
+}
+
+/// Asynchronously copies the m-by-n matrix src to dst.
+template <typename T>
+void device_copy_matrix(
+    int64_t m, int64_t n,
+    T const* src, int64_t ld_src,
+    T* dst, int64_t ld_dst, lapack::Queue& queue )
+{
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( ld_src < m );
+    lapack_error_if( ld_dst < m );
+    queue.submit( [=]() {
+        for (int64_t j = 0; j < n; ++j)
+            std::memcpy( &dst[ j*ld_dst ], &src[ j*ld_src ], m * sizeof( T ) );
+    } );
+}
+
+/// Asynchronously copies the n-vector src to dst.
+template <typename T>
+void device_copy_vector(
+    int64_t n,
+    T const* src, int64_t inc_src,
+    T* dst, int64_t inc_dst, lapack::Queue& queue )
+{
+    lapack_error_if( n < 0 );
+    lapack_error_if( inc_src <= 0 );
+    lapack_error_if( inc_dst <= 0 );
+    queue.submit( [=]() {
+        for (int64_t i = 0; i < n; ++i)
+            dst[ i*inc_dst ] = src[ i*inc_src ];
+    } );
+}
+
+#else
+
+using blas::device_malloc;
+using blas::device_free;
+using blas::device_memcpy;
+using blas::device_copy_matrix;
+using blas::device_copy_vector;
+
+#endif  // LAPACK_HAVE_HOST_QUEUE
+
 //------------------------------------------------------------------------------
 template <typename scalar_t>
 void potrf(
@@ -178,6 +429,307 @@ void heevd(
     void* host_work, size_t host_work_size,
     device_info_int* dev_info, lapack::Queue& queue );
 
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void getrs_work_size_bytes(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    scalar_t const* dA, int64_t ldda,
+    scalar_t* dB, int64_t lddb,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template <typename scalar_t>
+void getrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    scalar_t const* dA, int64_t ldda, device_pivot_int const* dev_ipiv,
+    scalar_t* dB, int64_t lddb,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void potrs_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t const* dA, int64_t ldda,
+    scalar_t* dB, int64_t lddb,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template <typename scalar_t>
+void potrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t const* dA, int64_t ldda,
+    scalar_t* dB, int64_t lddb,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void potri_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* dA, int64_t ldda,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template <typename scalar_t>
+void potri(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* dA, int64_t ldda,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+//------------------------------------------------------------------------------
+// For real types, unmqr is ormqr, and trans = ConjTrans is taken as Trans.
+template <typename scalar_t>
+void unmqr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    scalar_t const* dA, int64_t ldda, scalar_t const* dtau,
+    scalar_t* dC, int64_t lddc,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template <typename scalar_t>
+void unmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    scalar_t const* dA, int64_t ldda, scalar_t const* dtau,
+    scalar_t* dC, int64_t lddc,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+//------------------------------------------------------------------------------
+// For real types, ungqr is orgqr.
+template <typename scalar_t>
+void ungqr_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    scalar_t* dA, int64_t ldda, scalar_t const* dtau,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template <typename scalar_t>
+void ungqr(
+    int64_t m, int64_t n, int64_t k,
+    scalar_t* dA, int64_t ldda, scalar_t const* dtau,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+//------------------------------------------------------------------------------
+// cuSolver requires m >= n.
+template <typename scalar_t>
+void gesvd_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    scalar_t* dA, int64_t ldda, blas::real_type<scalar_t>* dS,
+    scalar_t* dU, int64_t lddu,
+    scalar_t* dVT, int64_t lddvt,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template <typename scalar_t>
+void gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    scalar_t* dA, int64_t ldda, blas::real_type<scalar_t>* dS,
+    scalar_t* dU, int64_t lddu,
+    scalar_t* dVT, int64_t lddvt,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+//------------------------------------------------------------------------------
+// Hermitian (symmetric) eigenvalues by the cyclic Jacobi method,
+// with eigenvalues in ascending order, as for heevd. It iterates until
+// the off-diagonal part is below machine epsilon relative to || A ||_F,
+// for at most 100 sweeps; if it does not converge, dev_info > 0
+// (n + 1 with cuSolver and the host backend).
+// oneMKL has no Jacobi solver, so there heevj uses heevd.
+template <typename scalar_t>
+void heevj_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo,
+    int64_t n, scalar_t* dA, int64_t ldda, blas::real_type<scalar_t>* dW,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template <typename scalar_t>
+void heevj(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    scalar_t* dA, int64_t ldda, blas::real_type<scalar_t>* dW,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+//==============================================================================
+// Overloads that take workspace from the queue's pool, instead of the
+// caller querying *_work_size_bytes and allocating it.
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void getrf(
+    int64_t m, int64_t n,
+    scalar_t* dA, int64_t ldda, device_pivot_int* dev_ipiv,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    size_t dev_work_size, host_work_size;
+    getrf_work_size_bytes( m, n, dA, ldda,
+                           &dev_work_size, &host_work_size, queue );
+    getrf( m, n, dA, ldda, dev_ipiv,
+           queue.dev_workspace( dev_work_size ), dev_work_size,
+           queue.host_workspace( host_work_size ), host_work_size,
+           dev_info, queue );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void geqrf(
+    int64_t m, int64_t n,
+    scalar_t* dA, int64_t ldda, scalar_t* dtau,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    size_t dev_work_size, host_work_size;
+    geqrf_work_size_bytes( m, n, dA, ldda,
+                           &dev_work_size, &host_work_size, queue );
+    geqrf( m, n, dA, ldda, dtau,
+           queue.dev_workspace( dev_work_size ), dev_work_size,
+           queue.host_workspace( host_work_size ), host_work_size,
+           dev_info, queue );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    scalar_t* dA, int64_t ldda, blas::real_type<scalar_t>* dW,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    size_t dev_work_size, host_work_size;
+    heevd_work_size_bytes( jobz, uplo, n, dA, ldda, dW,
+                           &dev_work_size, &host_work_size, queue );
+    heevd( jobz, uplo, n, dA, ldda, dW,
+           queue.dev_workspace( dev_work_size ), dev_work_size,
+           queue.host_workspace( host_work_size ), host_work_size,
+           dev_info, queue );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void getrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    scalar_t const* dA, int64_t ldda, device_pivot_int const* dev_ipiv,
+    scalar_t* dB, int64_t lddb,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    size_t dev_work_size, host_work_size;
+    getrs_work_size_bytes( trans, n, nrhs, dA, ldda, dB, lddb,
+                           &dev_work_size, &host_work_size, queue );
+    getrs( trans, n, nrhs, dA, ldda, dev_ipiv, dB, lddb,
+           queue.dev_workspace( dev_work_size ), dev_work_size,
+           queue.host_workspace( host_work_size ), host_work_size,
+           dev_info, queue );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void potrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t const* dA, int64_t ldda,
+    scalar_t* dB, int64_t lddb,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    size_t dev_work_size, host_work_size;
+    potrs_work_size_bytes( uplo, n, nrhs, dA, ldda, dB, lddb,
+                           &dev_work_size, &host_work_size, queue );
+    potrs( uplo, n, nrhs, dA, ldda, dB, lddb,
+           queue.dev_workspace( dev_work_size ), dev_work_size,
+           queue.host_workspace( host_work_size ), host_work_size,
+           dev_info, queue );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void potri(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* dA, int64_t ldda,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    size_t dev_work_size, host_work_size;
+    potri_work_size_bytes( uplo, n, dA, ldda,
+                           &dev_work_size, &host_work_size, queue );
+    potri( uplo, n, dA, ldda,
+           queue.dev_workspace( dev_work_size ), dev_work_size,
+           queue.host_workspace( host_work_size ), host_work_size,
+           dev_info, queue );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void unmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    scalar_t const* dA, int64_t ldda, scalar_t const* dtau,
+    scalar_t* dC, int64_t lddc,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    size_t dev_work_size, host_work_size;
+    unmqr_work_size_bytes( side, trans, m, n, k, dA, ldda, dtau, dC, lddc,
+                           &dev_work_size, &host_work_size, queue );
+    unmqr( side, trans, m, n, k, dA, ldda, dtau, dC, lddc,
+           queue.dev_workspace( dev_work_size ), dev_work_size,
+           queue.host_workspace( host_work_size ), host_work_size,
+           dev_info, queue );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void ungqr(
+    int64_t m, int64_t n, int64_t k,
+    scalar_t* dA, int64_t ldda, scalar_t const* dtau,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    size_t dev_work_size, host_work_size;
+    ungqr_work_size_bytes( m, n, k, dA, ldda, dtau,
+                           &dev_work_size, &host_work_size, queue );
+    ungqr( m, n, k, dA, ldda, dtau,
+           queue.dev_workspace( dev_work_size ), dev_work_size,
+           queue.host_workspace( host_work_size ), host_work_size,
+           dev_info, queue );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    scalar_t* dA, int64_t ldda, blas::real_type<scalar_t>* dS,
+    scalar_t* dU, int64_t lddu,
+    scalar_t* dVT, int64_t lddvt,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    size_t dev_work_size, host_work_size;
+    gesvd_work_size_bytes( jobu, jobvt, m, n, dA, ldda, dS,
+                           dU, lddu, dVT, lddvt,
+                           &dev_work_size, &host_work_size, queue );
+    gesvd( jobu, jobvt, m, n, dA, ldda, dS, dU, lddu, dVT, lddvt,
+           queue.dev_workspace( dev_work_size ), dev_work_size,
+           queue.host_workspace( host_work_size ), host_work_size,
+           dev_info, queue );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void heevj(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    scalar_t* dA, int64_t ldda, blas::real_type<scalar_t>* dW,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    size_t dev_work_size, host_work_size;
+    heevj_work_size_bytes( jobz, uplo, n, dA, ldda, dW,
+                           &dev_work_size, &host_work_size, queue );
+    heevj( jobz, uplo, n, dA, ldda, dW,
+           queue.dev_workspace( dev_work_size ), dev_work_size,
+           queue.host_workspace( host_work_size ), host_work_size,
+           dev_info, queue );
+}
+
 }  // namespace lapack
 
 #endif // LAPACK_DEVICE_HH
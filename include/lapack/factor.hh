@@ -0,0 +1,376 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_FACTOR_HH
+#define LAPACK_FACTOR_HH
+
+#include "lapack/util.hh"
+
+#include <cstddef>
+#include <vector>
+
+namespace lapack {
+
+// -----------------------------------------------------------------------------
+// Factorization objects own a factorization together with everything
+// needed to reuse it: the factors, pivots, a copy of the original matrix
+// for iterative refinement, its norms, and workspace. The workspace is
+// lent to the LAPACK++ wrappers each method calls, and grown if a call
+// needs more, so after the first call of each kind with a given nrhs,
+// calls make no heap allocations.
+//
+// Objects are movable, not copyable. Methods other than accessors use
+// the object's workspace, so an object must not be used concurrently
+// from several threads.
+
+//------------------------------------------------------------------------------
+/// LU factorization with partial pivoting, $A = P L U$, of an n-by-n
+/// matrix, via lapack::getrf.
+///
+/// Example:
+///
+///     lapack::LU< double > lu( n, A, lda );
+///     if (lu.info() == 0) {
+///         double rcond = lu.rcond();
+///         for (auto& b : rhs)
+///             lu.solve( 1, b.data(), n );
+///     }
+///
+/// @ingroup gesv
+///
+template <typename scalar_t>
+class LU
+{
+public:
+    using real_t = blas::real_type< scalar_t >;
+
+    /// Empty factorization, n = 0.
+    LU();
+
+    /// Factors the n-by-n matrix A, stored in an lda-by-n array.
+    /// Check info() for singularity.
+    LU( int64_t n, scalar_t const* A, int64_t lda );
+
+    LU( LU&& ) = default;
+    LU& operator = ( LU&& ) = default;
+    LU( LU const& ) = delete;
+    LU& operator = ( LU const& ) = delete;
+
+    /// Factors a new n-by-n matrix A, reusing storage if n has not grown.
+    /// @return info from getrf: > 0 if U(i,i) is exactly zero.
+    int64_t factor( int64_t n, scalar_t const* A, int64_t lda );
+
+    /// Solves op(A) X = B; on exit, the n-by-nrhs B is overwritten by X.
+    /// @return info: > 0 if A is singular, in which case B is unchanged.
+    int64_t solve( int64_t nrhs, scalar_t* B, int64_t ldb,
+                   lapack::Op trans = lapack::Op::NoTrans );
+
+    /// @return estimate of the reciprocal condition number of A in the
+    /// one or infinity norm, via gecon; 0 if A is singular.
+    real_t rcond( lapack::Norm norm = lapack::Norm::One );
+
+    /// Improves the solution X of op(A) X = B by iterative refinement,
+    /// via gerfs, setting forward and backward error bounds ferr and berr,
+    /// each of length nrhs.
+    /// @return info: > 0 if A is singular, in which case X is unchanged.
+    int64_t refine( int64_t nrhs,
+                    scalar_t const* B, int64_t ldb,
+                    scalar_t* X, int64_t ldx,
+                    real_t* ferr, real_t* berr,
+                    lapack::Op trans = lapack::Op::NoTrans );
+
+    /// Computes the n-by-n inverse of A in Ainv, via getri.
+    /// @return info: > 0 if A is singular.
+    int64_t inverse( scalar_t* Ainv, int64_t ldainv );
+
+    /// @return info from getrf.
+    int64_t info() const { return info_; }
+
+    /// @return order of A.
+    int64_t n() const { return n_; }
+
+    /// @return norm of the original A; norm is One, Inf, Max, or Fro.
+    real_t anorm( lapack::Norm norm = lapack::Norm::One ) const;
+
+    /// @return L and U factors, with leading dimension ld().
+    scalar_t const* factors() const { return LU_.data(); }
+
+    /// @return leading dimension of factors(), max( 1, n ).
+    int64_t ld() const { return ld_; }
+
+    /// @return pivot indices, as from getrf.
+    int64_t const* ipiv() const { return ipiv_.data(); }
+
+    /// @return bytes of workspace lent to the wrappers. It grows to the
+    /// most any call has needed, so repeating a call with the same sizes
+    /// does not allocate.
+    std::size_t workspace_bytes() const { return work_.size(); }
+
+private:
+    int64_t n_, ld_, info_;
+    real_t anorm_one_, anorm_inf_, anorm_max_, anorm_fro_;
+    std::vector< scalar_t > A_;     // original A, ld-by-n
+    std::vector< scalar_t > LU_;    // factors, ld-by-n
+    std::vector< int64_t > ipiv_;
+    std::vector< char > work_;      // lent to wrappers
+};
+
+//------------------------------------------------------------------------------
+/// Cholesky factorization, $A = L L^H$ or $A = U^H U$, of an n-by-n
+/// Hermitian positive definite matrix, via lapack::potrf.
+/// Only the uplo triangle of A is referenced.
+/// @ingroup posv
+///
+template <typename scalar_t>
+class Cholesky
+{
+public:
+    using real_t = blas::real_type< scalar_t >;
+
+    /// Empty factorization, n = 0.
+    Cholesky();
+
+    /// Factors the n-by-n Hermitian matrix A, stored in an lda-by-n array.
+    /// Check info() for positive definiteness.
+    Cholesky( lapack::Uplo uplo, int64_t n, scalar_t const* A, int64_t lda );
+
+    Cholesky( Cholesky&& ) = default;
+    Cholesky& operator = ( Cholesky&& ) = default;
+    Cholesky( Cholesky const& ) = delete;
+    Cholesky& operator = ( Cholesky const& ) = delete;
+
+    /// Factors a new matrix A, reusing storage if n has not grown.
+    /// @return info from potrf: > 0 if A is not positive definite.
+    int64_t factor( lapack::Uplo uplo, int64_t n,
+                    scalar_t const* A, int64_t lda );
+
+    /// Solves A X = B; on exit, the n-by-nrhs B is overwritten by X.
+    /// @return info: > 0 if A is not positive definite, in which case
+    /// B is unchanged.
+    int64_t solve( int64_t nrhs, scalar_t* B, int64_t ldb );
+
+    /// @return estimate of the reciprocal condition number of A in the
+    /// one norm, via pocon; 0 if A is not positive definite.
+    real_t rcond();
+
+    /// Improves the solution X of A X = B by iterative refinement,
+    /// via porfs, setting forward and backward error bounds ferr and berr,
+    /// each of length nrhs.
+    /// @return info: > 0 if A is not positive definite.
+    int64_t refine( int64_t nrhs,
+                    scalar_t const* B, int64_t ldb,
+                    scalar_t* X, int64_t ldx,
+                    real_t* ferr, real_t* berr );
+
+    /// Computes the n-by-n Hermitian inverse of A in Ainv, via potri.
+    /// Both triangles of Ainv are set.
+    /// @return info: > 0 if A is not positive definite.
+    int64_t inverse( scalar_t* Ainv, int64_t ldainv );
+
+    /// @return info from potrf.
+    int64_t info() const { return info_; }
+
+    /// @return order of A.
+    int64_t n() const { return n_; }
+
+    /// @return triangle of A that is referenced and factored.
+    lapack::Uplo uplo() const { return uplo_; }
+
+    /// @return one norm of the original A.
+    real_t anorm() const { return anorm_; }
+
+    /// @return Cholesky factor in the uplo triangle, with leading
+    /// dimension ld().
+    scalar_t const* factors() const { return L_.data(); }
+
+    /// @return leading dimension of factors(), max( 1, n ).
+    int64_t ld() const { return ld_; }
+
+    /// @return bytes of workspace lent to the wrappers. It grows to the
+    /// most any call has needed, so repeating a call with the same sizes
+    /// does not allocate.
+    std::size_t workspace_bytes() const { return work_.size(); }
+
+private:
+    lapack::Uplo uplo_;
+    int64_t n_, ld_, info_;
+    real_t anorm_;
+    std::vector< scalar_t > A_;     // original A, ld-by-n
+    std::vector< scalar_t > L_;     // factor, ld-by-n
+    std::vector< char > work_;      // lent to wrappers
+};
+
+//------------------------------------------------------------------------------
+/// Symmetric indefinite factorization, $A = L D L^H$ or $A = U D U^H$,
+/// of an n-by-n Hermitian matrix, using Bunch-Kaufman diagonal pivoting,
+/// via lapack::hetrf. Only the uplo triangle of A is referenced.
+/// @ingroup hesv
+///
+template <typename scalar_t>
+class LDLT
+{
+public:
+    using real_t = blas::real_type< scalar_t >;
+
+    /// Empty factorization, n = 0.
+    LDLT();
+
+    /// Factors the n-by-n Hermitian matrix A, stored in an lda-by-n array.
+    /// Check info() for singularity.
+    LDLT( lapack::Uplo uplo, int64_t n, scalar_t const* A, int64_t lda );
+
+    LDLT( LDLT&& ) = default;
+    LDLT& operator = ( LDLT&& ) = default;
+    LDLT( LDLT const& ) = delete;
+    LDLT& operator = ( LDLT const& ) = delete;
+
+    /// Factors a new matrix A, reusing storage if n has not grown.
+    /// @return info from hetrf: > 0 if D(i,i) is exactly zero.
+    int64_t factor( lapack::Uplo uplo, int64_t n,
+                    scalar_t const* A, int64_t lda );
+
+    /// Solves A X = B; on exit, the n-by-nrhs B is overwritten by X.
+    /// @return info: > 0 if A is singular, in which case B is unchanged.
+    int64_t solve( int64_t nrhs, scalar_t* B, int64_t ldb );
+
+    /// @return estimate of the reciprocal condition number of A in the
+    /// one norm, via hecon; 0 if A is singular.
+    real_t rcond();
+
+    /// Improves the solution X of A X = B by iterative refinement,
+    /// via herfs, setting forward and backward error bounds ferr and berr,
+    /// each of length nrhs.
+    /// @return info: > 0 if A is singular.
+    int64_t refine( int64_t nrhs,
+                    scalar_t const* B, int64_t ldb,
+                    scalar_t* X, int64_t ldx,
+                    real_t* ferr, real_t* berr );
+
+    /// Computes the n-by-n Hermitian inverse of A in Ainv, via hetri.
+    /// Both triangles of Ainv are set.
+    /// @return info: > 0 if A is singular.
+    int64_t inverse( scalar_t* Ainv, int64_t ldainv );
+
+    /// @return info from hetrf.
+    int64_t info() const { return info_; }
+
+    /// @return order of A.
+    int64_t n() const { return n_; }
+
+    /// @return triangle of A that is referenced and factored.
+    lapack::Uplo uplo() const { return uplo_; }
+
+    /// @return one norm of the original A.
+    real_t anorm() const { return anorm_; }
+
+    /// @return block diagonal D and multipliers, as from hetrf,
+    /// with leading dimension ld().
+    scalar_t const* factors() const { return LD_.data(); }
+
+    /// @return leading dimension of factors(), max( 1, n ).
+    int64_t ld() const { return ld_; }
+
+    /// @return pivot indices, as from hetrf.
+    int64_t const* ipiv() const { return ipiv_.data(); }
+
+    /// @return bytes of workspace lent to the wrappers. It grows to the
+    /// most any call has needed, so repeating a call with the same sizes
+    /// does not allocate.
+    std::size_t workspace_bytes() const { return work_.size(); }
+
+private:
+    lapack::Uplo uplo_;
+    int64_t n_, ld_, info_;
+    real_t anorm_;
+    std::vector< scalar_t > A_;     // original A, ld-by-n
+    std::vector< scalar_t > LD_;    // factors, ld-by-n
+    std::vector< int64_t > ipiv_;
+    std::vector< char > work_;      // lent to wrappers
+};
+
+//------------------------------------------------------------------------------
+/// QR factorization, $A = Q R$, of an m-by-n matrix, m >= n,
+/// via lapack::geqrf. solve() gives the least squares solution of
+/// $A X \approx B$.
+/// @ingroup gels
+///
+template <typename scalar_t>
+class QR
+{
+public:
+    using real_t = blas::real_type< scalar_t >;
+
+    /// Empty factorization, m = n = 0.
+    QR();
+
+    /// Factors the m-by-n matrix A, m >= n, stored in an lda-by-n array.
+    QR( int64_t m, int64_t n, scalar_t const* A, int64_t lda );
+
+    QR( QR&& ) = default;
+    QR& operator = ( QR&& ) = default;
+    QR( QR const& ) = delete;
+    QR& operator = ( QR const& ) = delete;
+
+    /// Factors a new m-by-n matrix A, m >= n, reusing storage if m*n
+    /// has not grown.
+    void factor( int64_t m, int64_t n, scalar_t const* A, int64_t lda );
+
+    /// Solves the least squares problem min || A X - B ||_2.
+    /// On entry, B is m-by-nrhs; on exit, its first n rows are X.
+    /// @return info: > 0 if R(i,i) is exactly zero, so A does not have
+    /// full rank, in which case the first n rows of B hold Q^H B.
+    int64_t solve( int64_t nrhs, scalar_t* B, int64_t ldb );
+
+    /// @return estimate of the reciprocal condition number of R, which
+    /// has the same 2-norm condition number as A, in the one or infinity
+    /// norm, via trcon.
+    real_t rcond( lapack::Norm norm = lapack::Norm::One );
+
+    /// Improves the least squares solution X, n-by-nrhs, of A X ~ B,
+    /// with B m-by-nrhs, by one step of iterative refinement:
+    /// the residual R = B - A X is computed with the original A,
+    /// then X += argmin || A D - R ||_2.
+    /// @return info: > 0 if A does not have full rank.
+    int64_t refine( int64_t nrhs,
+                    scalar_t const* B, int64_t ldb,
+                    scalar_t* X, int64_t ldx );
+
+    /// Computes the n-by-n inverse of square A, m = n, in Ainv as
+    /// $R^{-1} Q^H$, via trtri and unmqr.
+    /// @return info: > 0 if A is singular.
+    int64_t inverse( scalar_t* Ainv, int64_t ldainv );
+
+    /// @return number of rows of A.
+    int64_t m() const { return m_; }
+
+    /// @return number of columns of A.
+    int64_t n() const { return n_; }
+
+    /// @return R in the upper triangle and Householder vectors below,
+    /// as from geqrf, with leading dimension ld().
+    scalar_t const* factors() const { return QR_.data(); }
+
+    /// @return leading dimension of factors(), max( 1, m ).
+    int64_t ld() const { return ld_; }
+
+    /// @return Householder scalars, as from geqrf.
+    scalar_t const* tau() const { return tau_.data(); }
+
+    /// @return bytes of workspace lent to the wrappers. It grows to the
+    /// most any call has needed, so repeating a call with the same sizes
+    /// does not allocate.
+    std::size_t workspace_bytes() const { return work_.size(); }
+
+private:
+    int64_t m_, n_, ld_;
+    std::vector< scalar_t > A_;     // original A, ld-by-n
+    std::vector< scalar_t > QR_;    // factors, ld-by-n
+    std::vector< scalar_t > tau_;
+    std::vector< char > work_;      // lent to wrappers
+};
+
+}  // namespace lapack
+
+#endif  // LAPACK_FACTOR_HH
@@ -0,0 +1,662 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_FIXED_HH
+#define LAPACK_FIXED_HH
+
+#include "lapack/util.hh"
+
+#include <array>
+#include <cmath>
+#include <limits>
+
+namespace lapack {
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// @return |real( x )| + |imag( x )|, the pivot measure of LAPACK i_amax.
+template <typename scalar_t>
+inline blas::real_type< scalar_t > abs1( scalar_t x )
+{
+    return std::abs( std::real( x ) ) + std::abs( std::imag( x ) );
+}
+
+//------------------------------------------------------------------------------
+/// @return ||x||_2 of a vector of length n, scaled to avoid overflow,
+/// as in LAPACK nrm2.
+template <typename scalar_t>
+inline blas::real_type< scalar_t > fixed_nrm2( int64_t n, scalar_t const* x )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    real_t scale = 0;
+    for (int64_t i = 0; i < n; ++i)
+        scale = blas::max( scale, abs1( x[ i ] ) );
+    if (scale == 0)
+        return 0;
+    real_t sum = 0;
+    for (int64_t i = 0; i < n; ++i) {
+        real_t re = std::real( x[ i ] ) / scale;
+        real_t im = std::imag( x[ i ] ) / scale;
+        sum += re*re + im*im;
+    }
+    return scale * std::sqrt( sum );
+}
+
+//------------------------------------------------------------------------------
+/// Generates an elementary reflector H = I - tau v v^H such that
+/// H^H [ alpha; x ] = [ beta; 0 ], with v = [ 1; x ] on exit,
+/// as in LAPACK larfg.
+template <typename scalar_t>
+inline void fixed_larfg( int64_t n, scalar_t* alpha, scalar_t* x, scalar_t* tau )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    real_t xnorm = fixed_nrm2( n - 1, x );
+    real_t alphr = std::real( *alpha );
+    real_t alphi = std::imag( *alpha );
+    if (xnorm == 0 && alphi == 0) {
+        *tau = 0;
+        return;
+    }
+
+    // beta = -sign( alphr ) * lapy3( alphr, alphi, xnorm )
+    auto lapy3 = []( real_t a, real_t b, real_t c ) {
+        real_t w = blas::max( std::abs( a ), std::abs( b ), std::abs( c ) );
+        if (w == 0)
+            return std::abs( a ) + std::abs( b ) + std::abs( c );
+        return w * std::sqrt( (a/w)*(a/w) + (b/w)*(b/w) + (c/w)*(c/w) );
+    };
+    real_t beta = -std::copysign( lapy3( alphr, alphi, xnorm ), alphr );
+
+    // If beta is subnormal, rescale x and alpha; at most 20 times.
+    const real_t safmin = std::numeric_limits< real_t >::min()
+                        / std::numeric_limits< real_t >::epsilon();
+    const real_t rsafmn = 1 / safmin;
+    int knt = 0;
+    if (std::abs( beta ) < safmin) {
+        do {
+            ++knt;
+            for (int64_t i = 0; i < n - 1; ++i)
+                x[ i ] *= rsafmn;
+            beta  *= rsafmn;
+            alphi *= rsafmn;
+            alphr *= rsafmn;
+        } while (std::abs( beta ) < safmin && knt < 20);
+        xnorm = fixed_nrm2( n - 1, x );
+        beta = -std::copysign( lapy3( alphr, alphi, xnorm ), alphr );
+    }
+
+    scalar_t alpha_scaled;
+    if constexpr (blas::is_complex_v< scalar_t >) {
+        *tau = scalar_t( (beta - alphr) / beta, -alphi / beta );
+        alpha_scaled = scalar_t( alphr, alphi );
+    }
+    else {
+        *tau = (beta - alphr) / beta;
+        alpha_scaled = alphr;
+    }
+    scalar_t r = scalar_t( 1 ) / (alpha_scaled - beta);
+    for (int64_t i = 0; i < n - 1; ++i)
+        x[ i ] *= r;
+
+    for (int j = 0; j < knt; ++j)
+        beta *= safmin;
+    *alpha = beta;
+}
+
+}  // namespace internal
+
+//==============================================================================
+/// Factorizations and solves for N-by-N matrices with N fixed at compile
+/// time, e.g., lapack::fixed< 4 >::getrf( A, ipiv ).
+///
+/// These are header-only templates, so calls can be inlined into hot
+/// loops, and with constant trip counts the compiler can unroll and
+/// vectorize the inner loops. They use the same algorithms, pivoting,
+/// and conventions as the unblocked LAPACK routines (getf2, potf2, trti2,
+/// geqr2), so results agree with lapack::getrf, etc., to rounding error.
+/// They are intended for small N, roughly 2 to 16; for larger N, the
+/// blocked LAPACK routines are faster.
+///
+/// Matrices are column-major. Each routine takes either a pointer and
+/// leading dimension, to work in place in a larger array, or the
+/// fixed< N >::matrix and fixed< N >::vector std::array types, with
+/// leading dimension N. Pivots are 1-based, as in lapack::getrf.
+///
+/// Example:
+///
+///     lapack::fixed< 4 >::matrix< double > A = { ... };
+///     lapack::fixed< 4 >::vector< double > b = { ... };
+///     lapack::fixed< 4 >::pivots ipiv;
+///     if (lapack::fixed< 4 >::getrf( A, ipiv ) == 0)
+///         lapack::fixed< 4 >::getrs( lapack::Op::NoTrans, A, ipiv, b );
+///
+/// @ingroup fixed
+///
+template <int64_t N>
+struct fixed
+{
+    static_assert( N >= 1, "lapack::fixed requires N >= 1" );
+
+    /// N-by-N column-major matrix.
+    template <typename scalar_t>
+    using matrix = std::array< scalar_t, size_t( N*N ) >;
+
+    /// Vector of length N, or one right-hand side.
+    template <typename scalar_t>
+    using vector = std::array< scalar_t, size_t( N ) >;
+
+    /// Pivot indices from getrf.
+    using pivots = std::array< int64_t, size_t( N ) >;
+
+    //--------------------------------------------------------------------------
+    /// LU factorization with partial pivoting, A = P L U, as in
+    /// lapack::getrf.
+    ///
+    /// @param[in,out] A
+    ///     The N-by-N matrix A, stored in an lda-by-N array.
+    ///     On exit, the factors L and U; the unit diagonal of L is not stored.
+    ///
+    /// @param[in] lda
+    ///     The leading dimension of A. lda >= N.
+    ///
+    /// @param[out] ipiv
+    ///     The pivot indices, 1-based; row i was interchanged with
+    ///     row ipiv(i).
+    ///
+    /// @return = 0: successful exit.
+    /// @return > 0: if return value = i, U(i,i) is exactly zero.
+    ///     The factorization has been completed, but U is singular.
+    ///
+    template <typename scalar_t>
+    static int64_t getrf( scalar_t* A, int64_t lda, int64_t* ipiv )
+    {
+        using real_t = blas::real_type< scalar_t >;
+        const real_t sfmin = std::numeric_limits< real_t >::min();
+
+        lapack_error_if( lda < N );
+
+        int64_t info = 0;
+        for (int64_t j = 0; j < N; ++j) {
+            scalar_t* Aj = &A[ j*lda ];
+
+            // Find pivot, the first element of max abs1.
+            int64_t p = j;
+            real_t amax = internal::abs1( Aj[ j ] );
+            for (int64_t i = j + 1; i < N; ++i) {
+                real_t a = internal::abs1( Aj[ i ] );
+                if (a > amax) {
+                    amax = a;
+                    p = i;
+                }
+            }
+            ipiv[ j ] = p + 1;
+
+            if (Aj[ p ] != scalar_t( 0 )) {
+                if (p != j) {
+                    for (int64_t k = 0; k < N; ++k)
+                        std::swap( A[ j + k*lda ], A[ p + k*lda ] );
+                }
+                // Scale by reciprocal unless it would overflow.
+                if (std::abs( Aj[ j ] ) >= sfmin) {
+                    scalar_t r = scalar_t( 1 ) / Aj[ j ];
+                    for (int64_t i = j + 1; i < N; ++i)
+                        Aj[ i ] *= r;
+                }
+                else {
+                    for (int64_t i = j + 1; i < N; ++i)
+                        Aj[ i ] /= Aj[ j ];
+                }
+            }
+            else if (info == 0) {
+                info = j + 1;
+            }
+
+            // Rank-1 update of the trailing matrix.
+            for (int64_t k = j + 1; k < N; ++k) {
+                scalar_t* Ak = &A[ k*lda ];
+                scalar_t ajk = Ak[ j ];
+                for (int64_t i = j + 1; i < N; ++i)
+                    Ak[ i ] -= Aj[ i ] * ajk;
+            }
+        }
+        return info;
+    }
+
+    /// @see getrf( A, lda, ipiv )
+    template <typename scalar_t>
+    static int64_t getrf( matrix< scalar_t >& A, pivots& ipiv )
+    {
+        return getrf( A.data(), N, ipiv.data() );
+    }
+
+    //--------------------------------------------------------------------------
+    /// Solves op(A) X = B using the LU factorization from getrf,
+    /// as in lapack::getrs.
+    ///
+    /// @param[in] trans
+    ///     - lapack::Op::NoTrans:   A X = B;
+    ///     - lapack::Op::Trans:     A^T X = B;
+    ///     - lapack::Op::ConjTrans: A^H X = B.
+    ///
+    /// @param[in] nrhs
+    ///     The number of right hand sides, i.e., columns of B. nrhs >= 0.
+    ///
+    /// @param[in] A
+    ///     The factors L and U from getrf, stored in an lda-by-N array.
+    ///
+    /// @param[in] lda
+    ///     The leading dimension of A. lda >= N.
+    ///
+    /// @param[in] ipiv
+    ///     The pivot indices from getrf.
+    ///
+    /// @param[in,out] B
+    ///     The N-by-nrhs matrix B, stored in an ldb-by-nrhs array.
+    ///     On exit, the solution X.
+    ///
+    /// @param[in] ldb
+    ///     The leading dimension of B. ldb >= N.
+    ///
+    template <typename scalar_t>
+    static void getrs(
+        lapack::Op trans, int64_t nrhs,
+        scalar_t const* A, int64_t lda,
+        int64_t const* ipiv,
+        scalar_t* B, int64_t ldb )
+    {
+        lapack_error_if( trans != Op::NoTrans && trans != Op::Trans
+                         && trans != Op::ConjTrans );
+        lapack_error_if( nrhs < 0 );
+        lapack_error_if( lda < N );
+        lapack_error_if( ldb < N );
+
+        const bool conj = (trans == Op::ConjTrans);
+        auto op = [conj]( scalar_t a ) {
+            return conj ? blas::conj( a ) : a;
+        };
+
+        for (int64_t r = 0; r < nrhs; ++r) {
+            scalar_t* b = &B[ r*ldb ];
+            if (trans == Op::NoTrans) {
+                // b = P^T b, then solve L y = b, U x = y.
+                for (int64_t i = 0; i < N; ++i) {
+                    if (ipiv[ i ] - 1 != i)
+                        std::swap( b[ i ], b[ ipiv[ i ] - 1 ] );
+                }
+                for (int64_t j = 0; j < N; ++j) {
+                    scalar_t const* Aj = &A[ j*lda ];
+                    scalar_t bj = b[ j ];
+                    for (int64_t i = j + 1; i < N; ++i)
+                        b[ i ] -= Aj[ i ] * bj;
+                }
+                for (int64_t j = N - 1; j >= 0; --j) {
+                    scalar_t const* Aj = &A[ j*lda ];
+                    b[ j ] /= Aj[ j ];
+                    scalar_t bj = b[ j ];
+                    for (int64_t i = 0; i < j; ++i)
+                        b[ i ] -= Aj[ i ] * bj;
+                }
+            }
+            else {
+                // Solve op(U) y = b, op(L) z = y, then x = P z.
+                for (int64_t j = 0; j < N; ++j) {
+                    scalar_t const* Aj = &A[ j*lda ];
+                    scalar_t sum = b[ j ];
+                    for (int64_t i = 0; i < j; ++i)
+                        sum -= op( Aj[ i ] ) * b[ i ];
+                    b[ j ] = sum / op( Aj[ j ] );
+                }
+                for (int64_t j = N - 1; j >= 0; --j) {
+                    scalar_t const* Aj = &A[ j*lda ];
+                    scalar_t sum = b[ j ];
+                    for (int64_t i = j + 1; i < N; ++i)
+                        sum -= op( Aj[ i ] ) * b[ i ];
+                    b[ j ] = sum;
+                }
+                for (int64_t i = N - 1; i >= 0; --i) {
+                    if (ipiv[ i ] - 1 != i)
+                        std::swap( b[ i ], b[ ipiv[ i ] - 1 ] );
+                }
+            }
+        }
+    }
+
+    /// @see getrs( trans, nrhs, A, lda, ipiv, B, ldb )
+    /// B is N-by-nrhs, where nrhs = M / N.
+    template <typename scalar_t, size_t M>
+    static void getrs(
+        lapack::Op trans,
+        matrix< scalar_t > const& A, pivots const& ipiv,
+        std::array< scalar_t, M >& B )
+    {
+        static_assert( M % N == 0, "B must be N-by-nrhs" );
+        getrs( trans, int64_t( M / N ), A.data(), N, ipiv.data(),
+               B.data(), N );
+    }
+
+    //--------------------------------------------------------------------------
+    /// Cholesky factorization of a Hermitian positive definite matrix,
+    /// A = U^H U or A = L L^H, as in lapack::potrf.
+    ///
+    /// @param[in] uplo
+    ///     - lapack::Uplo::Upper: Upper triangle of A is stored;
+    ///     - lapack::Uplo::Lower: Lower triangle of A is stored.
+    ///
+    /// @param[in,out] A
+    ///     The N-by-N matrix A, stored in an lda-by-N array.
+    ///     On exit, the factor U or L in the uplo triangle.
+    ///
+    /// @param[in] lda
+    ///     The leading dimension of A. lda >= N.
+    ///
+    /// @return = 0: successful exit.
+    /// @return > 0: if return value = i, the leading minor of order i
+    ///     is not positive definite, and the factorization could not be
+    ///     completed.
+    ///
+    template <typename scalar_t>
+    static int64_t potrf( lapack::Uplo uplo, scalar_t* A, int64_t lda )
+    {
+        using real_t = blas::real_type< scalar_t >;
+
+        lapack_error_if( uplo != Uplo::Upper && uplo != Uplo::Lower );
+        lapack_error_if( lda < N );
+
+        if (uplo == Uplo::Upper) {
+            // Column j of U: solve U(0:j,0:j)^H u = a(0:j,j), then the diagonal.
+            for (int64_t j = 0; j < N; ++j) {
+                scalar_t* Aj = &A[ j*lda ];
+                for (int64_t k = 0; k < j; ++k) {
+                    scalar_t const* Ak = &A[ k*lda ];
+                    scalar_t sum = Aj[ k ];
+                    for (int64_t l = 0; l < k; ++l)
+                        sum -= blas::conj( Ak[ l ] ) * Aj[ l ];
+                    Aj[ k ] = sum / std::real( Ak[ k ] );
+                }
+                real_t ajj = std::real( Aj[ j ] );
+                for (int64_t k = 0; k < j; ++k)
+                    ajj -= std::real( blas::conj( Aj[ k ] ) * Aj[ k ] );
+                if (! (ajj > 0)) {  // also catches NaN
+                    Aj[ j ] = ajj;
+                    return j + 1;
+                }
+                Aj[ j ] = std::sqrt( ajj );
+            }
+        }
+        else {
+            // Column j of L, updated by the previous columns.
+            for (int64_t j = 0; j < N; ++j) {
+                scalar_t* Aj = &A[ j*lda ];
+                real_t ajj = std::real( Aj[ j ] );
+                for (int64_t k = 0; k < j; ++k)
+                    ajj -= std::real( blas::conj( A[ j + k*lda ] ) * A[ j + k*lda ] );
+                if (! (ajj > 0)) {  // also catches NaN
+                    Aj[ j ] = ajj;
+                    return j + 1;
+                }
+                ajj = std::sqrt( ajj );
+                Aj[ j ] = ajj;
+                for (int64_t k = 0; k < j; ++k) {
+                    scalar_t const* Ak = &A[ k*lda ];
+                    scalar_t ajk = blas::conj( Ak[ j ] );
+                    for (int64_t i = j + 1; i < N; ++i)
+                        Aj[ i ] -= Ak[ i ] * ajk;
+                }
+                real_t r = 1 / ajj;
+                for (int64_t i = j + 1; i < N; ++i)
+                    Aj[ i ] *= r;
+            }
+        }
+        return 0;
+    }
+
+    /// @see potrf( uplo, A, lda )
+    template <typename scalar_t>
+    static int64_t potrf( lapack::Uplo uplo, matrix< scalar_t >& A )
+    {
+        return potrf( uplo, A.data(), N );
+    }
+
+    //--------------------------------------------------------------------------
+    /// Solves A X = B using the Cholesky factorization from potrf,
+    /// as in lapack::potrs.
+    ///
+    /// @param[in] uplo
+    ///     - lapack::Uplo::Upper: A = U^H U;
+    ///     - lapack::Uplo::Lower: A = L L^H.
+    ///
+    /// @param[in] nrhs
+    ///     The number of right hand sides, i.e., columns of B. nrhs >= 0.
+    ///
+    /// @param[in] A
+    ///     The factor U or L from potrf, stored in an lda-by-N array.
+    ///
+    /// @param[in] lda
+    ///     The leading dimension of A. lda >= N.
+    ///
+    /// @param[in,out] B
+    ///     The N-by-nrhs matrix B, stored in an ldb-by-nrhs array.
+    ///     On exit, the solution X.
+    ///
+    /// @param[in] ldb
+    ///     The leading dimension of B. ldb >= N.
+    ///
+    template <typename scalar_t>
+    static void potrs(
+        lapack::Uplo uplo, int64_t nrhs,
+        scalar_t const* A, int64_t lda,
+        scalar_t* B, int64_t ldb )
+    {
+        lapack_error_if( uplo != Uplo::Upper && uplo != Uplo::Lower );
+        lapack_error_if( nrhs < 0 );
+        lapack_error_if( lda < N );
+        lapack_error_if( ldb < N );
+
+        for (int64_t r = 0; r < nrhs; ++r) {
+            scalar_t* b = &B[ r*ldb ];
+            if (uplo == Uplo::Upper) {
+                // Solve U^H y = b, then U x = y.
+                for (int64_t j = 0; j < N; ++j) {
+                    scalar_t const* Aj = &A[ j*lda ];
+                    scalar_t sum = b[ j ];
+                    for (int64_t i = 0; i < j; ++i)
+                        sum -= blas::conj( Aj[ i ] ) * b[ i ];
+                    b[ j ] = sum / std::real( Aj[ j ] );
+                }
+                for (int64_t j = N - 1; j >= 0; --j) {
+                    scalar_t const* Aj = &A[ j*lda ];
+                    b[ j ] /= std::real( Aj[ j ] );
+                    scalar_t bj = b[ j ];
+                    for (int64_t i = 0; i < j; ++i)
+                        b[ i ] -= Aj[ i ] * bj;
+                }
+            }
+            else {
+                // Solve L y = b, then L^H x = y.
+                for (int64_t j = 0; j < N; ++j) {
+                    scalar_t const* Aj = &A[ j*lda ];
+                    b[ j ] /= std::real( Aj[ j ] );
+                    scalar_t bj = b[ j ];
+                    for (int64_t i = j + 1; i < N; ++i)
+                        b[ i ] -= Aj[ i ] * bj;
+                }
+                for (int64_t j = N - 1; j >= 0; --j) {
+                    scalar_t const* Aj = &A[ j*lda ];
+                    scalar_t sum = b[ j ];
+                    for (int64_t i = j + 1; i < N; ++i)
+                        sum -= blas::conj( Aj[ i ] ) * b[ i ];
+                    b[ j ] = sum / std::real( Aj[ j ] );
+                }
+            }
+        }
+    }
+
+    /// @see potrs( uplo, nrhs, A, lda, B, ldb )
+    /// B is N-by-nrhs, where nrhs = M / N.
+    template <typename scalar_t, size_t M>
+    static void potrs(
+        lapack::Uplo uplo,
+        matrix< scalar_t > const& A,
+        std::array< scalar_t, M >& B )
+    {
+        static_assert( M % N == 0, "B must be N-by-nrhs" );
+        potrs( uplo, int64_t( M / N ), A.data(), N, B.data(), N );
+    }
+
+    //--------------------------------------------------------------------------
+    /// Inverse of a triangular matrix, in place, as in lapack::trtri.
+    ///
+    /// @param[in] uplo
+    ///     - lapack::Uplo::Upper: A is upper triangular;
+    ///     - lapack::Uplo::Lower: A is lower triangular.
+    ///
+    /// @param[in] diag
+    ///     - lapack::Diag::NonUnit: A is non-unit triangular;
+    ///     - lapack::Diag::Unit:    A is unit triangular.
+    ///
+    /// @param[in,out] A
+    ///     The triangular matrix A, stored in an lda-by-N array.
+    ///     On exit, the uplo triangle holds the inverse of A.
+    ///
+    /// @param[in] lda
+    ///     The leading dimension of A. lda >= N.
+    ///
+    /// @return = 0: successful exit.
+    /// @return > 0: if return value = i, A(i,i) is exactly zero,
+    ///     so A is singular and its inverse cannot be computed.
+    ///
+    template <typename scalar_t>
+    static int64_t trtri(
+        lapack::Uplo uplo, lapack::Diag diag, scalar_t* A, int64_t lda )
+    {
+        lapack_error_if( uplo != Uplo::Upper && uplo != Uplo::Lower );
+        lapack_error_if( diag != Diag::NonUnit && diag != Diag::Unit );
+        lapack_error_if( lda < N );
+
+        const bool nonunit = (diag == Diag::NonUnit);
+        if (nonunit) {
+            for (int64_t j = 0; j < N; ++j) {
+                if (A[ j + j*lda ] == scalar_t( 0 ))
+                    return j + 1;
+            }
+        }
+
+        if (uplo == Uplo::Upper) {
+            // Column j of inv(A) = -inv(A(j,j)) * inv(A(0:j,0:j)) * A(0:j,j),
+            // using the previously inverted leading block.
+            for (int64_t j = 0; j < N; ++j) {
+                scalar_t* Aj = &A[ j*lda ];
+                scalar_t ajj;
+                if (nonunit) {
+                    Aj[ j ] = scalar_t( 1 ) / Aj[ j ];
+                    ajj = -Aj[ j ];
+                }
+                else {
+                    ajj = -1;
+                }
+                // x = T x, with T = A(0:j,0:j) upper triangular.
+                for (int64_t k = 0; k < j; ++k) {
+                    scalar_t const* Ak = &A[ k*lda ];
+                    scalar_t xk = Aj[ k ];
+                    for (int64_t i = 0; i < k; ++i)
+                        Aj[ i ] += xk * Ak[ i ];
+                    if (nonunit)
+                        Aj[ k ] *= Ak[ k ];
+                }
+                for (int64_t i = 0; i < j; ++i)
+                    Aj[ i ] *= ajj;
+            }
+        }
+        else {
+            for (int64_t j = N - 1; j >= 0; --j) {
+                scalar_t* Aj = &A[ j*lda ];
+                scalar_t ajj;
+                if (nonunit) {
+                    Aj[ j ] = scalar_t( 1 ) / Aj[ j ];
+                    ajj = -Aj[ j ];
+                }
+                else {
+                    ajj = -1;
+                }
+                // x = T x, with T = A(j+1:N,j+1:N) lower triangular.
+                for (int64_t k = N - 1; k > j; --k) {
+                    scalar_t const* Ak = &A[ k*lda ];
+                    scalar_t xk = Aj[ k ];
+                    for (int64_t i = N - 1; i > k; --i)
+                        Aj[ i ] += xk * Ak[ i ];
+                    if (nonunit)
+                        Aj[ k ] *= Ak[ k ];
+                }
+                for (int64_t i = j + 1; i < N; ++i)
+                    Aj[ i ] *= ajj;
+            }
+        }
+        return 0;
+    }
+
+    /// @see trtri( uplo, diag, A, lda )
+    template <typename scalar_t>
+    static int64_t trtri(
+        lapack::Uplo uplo, lapack::Diag diag, matrix< scalar_t >& A )
+    {
+        return trtri( uplo, diag, A.data(), N );
+    }
+
+    //--------------------------------------------------------------------------
+    /// QR factorization, A = Q R, as in lapack::geqrf.
+    /// Q is represented as a product of elementary reflectors
+    /// H(i) = I - tau(i) v_i v_i^H, with v_i(0:i) = [ 0, ..., 0, 1 ]
+    /// and v_i(i+1:N) stored in A(i+1:N,i), as in LAPACK.
+    ///
+    /// @param[in,out] A
+    ///     The N-by-N matrix A, stored in an lda-by-N array.
+    ///     On exit, R in the upper triangle and the reflectors below.
+    ///
+    /// @param[in] lda
+    ///     The leading dimension of A. lda >= N.
+    ///
+    /// @param[out] tau
+    ///     The vector tau of length N. The scalar factors of the reflectors.
+    ///
+    template <typename scalar_t>
+    static void geqrf( scalar_t* A, int64_t lda, scalar_t* tau )
+    {
+        lapack_error_if( lda < N );
+
+        for (int64_t j = 0; j < N; ++j) {
+            scalar_t* Aj = &A[ j*lda ];
+            internal::fixed_larfg( N - j, &Aj[ j ], &Aj[ j + 1 ], &tau[ j ] );
+            if (tau[ j ] == scalar_t( 0 ))
+                continue;
+
+            // Apply H(j)^H = I - conj( tau ) v v^H to A(j:N,j+1:N).
+            scalar_t ctau = blas::conj( tau[ j ] );
+            for (int64_t k = j + 1; k < N; ++k) {
+                scalar_t* Ak = &A[ k*lda ];
+                scalar_t sum = Ak[ j ];
+                for (int64_t i = j + 1; i < N; ++i)
+                    sum += blas::conj( Aj[ i ] ) * Ak[ i ];
+                sum *= ctau;
+                Ak[ j ] -= sum;
+                for (int64_t i = j + 1; i < N; ++i)
+                    Ak[ i ] -= Aj[ i ] * sum;
+            }
+        }
+    }
+
+    /// @see geqrf( A, lda, tau )
+    template <typename scalar_t>
+    static void geqrf( matrix< scalar_t >& A, vector< scalar_t >& tau )
+    {
+        geqrf( A.data(), N, tau.data() );
+    }
+};
+
+}  // namespace lapack
+
+#endif // LAPACK_FIXED_HH
@@ -0,0 +1,185 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_GELS_STREAM_HH
+#define LAPACK_GELS_STREAM_HH
+
+#include "lapack/util.hh"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+/// Streaming least squares solver for an m-by-n system A X = B, m >= n,
+/// that is pushed in blocks of rows, so A need never be held in memory.
+///
+/// Each block of rows [ A_i, B_i ] is folded into an n-by-n upper
+/// triangular R and n-by-nrhs D with tpqrt and tpmqrt:
+/// \[
+///     \begin{bmatrix} R   & D   \\ A_i & B_i \end{bmatrix}
+///     = Q_i \begin{bmatrix} R' & D' \\ 0 & E_i \end{bmatrix},
+/// \]
+/// so after all blocks, A = Q [ R; 0 ] and D = (Q^H B)( 0:n-1, : ).
+/// solve() then computes X = R^{-1} D. The rows E_i of Q^H B discarded
+/// along the way give the residual norm, || B - A X ||_2 = || E ||_2,
+/// without a second pass over A.
+///
+/// Memory is O( n^2 + mb (n + nrhs) ), independent of m. Blocks longer
+/// than mb rows are split; mb >= n makes good use of tpqrt.
+///
+/// Example:
+///
+///     lapack::GelsStream< double > ls( n, nrhs );
+///     while (read_rows( &m_i, A_i, B_i ))
+///         ls.push( m_i, A_i, m_i, B_i, m_i );
+///     int64_t info = ls.solve( X, n );
+///
+/// @ingroup gels
+///
+template <typename scalar_t>
+class GelsStream
+{
+public:
+    using real_t = blas::real_type< scalar_t >;
+
+    /// Default maximum number of rows folded per tpqrt call.
+    static constexpr int64_t default_mb = 256;
+
+    /// Starts an empty least squares problem with n unknowns
+    /// and nrhs right-hand sides, folding up to mb rows at a time.
+    GelsStream( int64_t n, int64_t nrhs, int64_t mb = default_mb );
+
+    /// Folds an m-by-n block of rows of A, stored in an lda-by-n array,
+    /// and the corresponding m-by-nrhs block of B, stored in an
+    /// ldb-by-nrhs array. A and B are not modified.
+    void push( int64_t m,
+               scalar_t const* A, int64_t lda,
+               scalar_t const* B, int64_t ldb );
+
+    /// Solves R X = D for the n-by-nrhs least squares solution X,
+    /// stored in an ldx-by-nrhs array, ldx >= max( 1, n ).
+    /// May be called at any time; the stream can continue afterwards.
+    /// @return = 0: successful exit;
+    ///         > 0: if return value = i, R(i,i) is exactly zero, so A
+    ///         does not have full rank, and X is not computed.
+    int64_t solve( scalar_t* X, int64_t ldx ) const;
+
+    /// Sets rnorm[ j ] = || B(:,j) - A X(:,j) ||_2 for the least squares
+    /// solution X, for j = 0, ..., nrhs-1.
+    void residual_norms( real_t* rnorm ) const;
+
+    /// Discards all rows pushed so far.
+    void reset();
+
+    /// @return number of unknowns, n.
+    int64_t n() const { return n_; }
+
+    /// @return number of right-hand sides, nrhs.
+    int64_t nrhs() const { return nrhs_; }
+
+    /// @return number of rows pushed so far, m.
+    int64_t rows() const { return rows_; }
+
+    /// @return the n-by-n upper triangular factor R, with leading dimension
+    /// ldR() = max( 1, n ); the strictly lower triangle is zero.
+    scalar_t const* R() const { return R_.data(); }
+
+    /// @return leading dimension of R.
+    int64_t ldR() const { return ldr_; }
+
+private:
+    int64_t n_, nrhs_, mb_, ib_, ldr_;
+    int64_t rows_;
+    std::vector< scalar_t > R_;     // ldr-by-n
+    std::vector< scalar_t > D_;     // ldr-by-nrhs
+    std::vector< scalar_t > Ablk_;  // mb-by-n
+    std::vector< scalar_t > Bblk_;  // mb-by-nrhs
+    std::vector< scalar_t > T_;     // ib-by-n
+    std::vector< real_t > scale_;   // residual || E(:,j) || = scale sqrt( sumsq )
+    std::vector< real_t > sumsq_;
+};
+
+//------------------------------------------------------------------------------
+/// Read-only, memory-mapped m-by-n column-major matrix in a binary file
+/// of m*n scalar_t elements, i.e., column j is bytes
+/// [ j*m*sizeof(scalar_t), (j+1)*m*sizeof(scalar_t) ).
+///
+/// Pages are read from the file on demand, so streaming row blocks
+/// through GelsStream never reads the whole file into memory.
+/// release_rows() tells the operating system that pages already
+/// consumed can be dropped.
+///
+/// Requires POSIX mmap; elsewhere the constructor throws lapack::Error.
+///
+/// @ingroup gels
+///
+template <typename scalar_t>
+class MappedMatrix
+{
+public:
+    /// Maps file at path holding an m-by-n column-major matrix.
+    /// Throws lapack::Error if the file cannot be opened or mapped, or
+    /// its size is not m*n*sizeof( scalar_t ) bytes.
+    MappedMatrix( std::string const& path, int64_t m, int64_t n );
+    ~MappedMatrix();
+
+    MappedMatrix( MappedMatrix const& ) = delete;
+    MappedMatrix& operator = ( MappedMatrix const& ) = delete;
+
+    /// @return pointer to element (0, 0).
+    scalar_t const* data() const { return data_; }
+
+    /// @return number of rows, m.
+    int64_t m() const { return m_; }
+
+    /// @return number of columns, n.
+    int64_t n() const { return n_; }
+
+    /// @return leading dimension, max( 1, m ).
+    int64_t ld() const { return blas::max( 1, m_ ); }
+
+    /// Advises that rows 0, ..., i-1 of every column are no longer
+    /// needed, so their pages can be dropped from memory.
+    void release_rows( int64_t i ) const;
+
+private:
+    scalar_t const* data_;
+    int64_t m_, n_;
+    std::size_t bytes_;
+    mutable std::vector< std::size_t > released_;  // per column, in bytes
+};
+
+//------------------------------------------------------------------------------
+// Solves least squares with memory-mapped A and B, streaming mb rows at a time.
+int64_t gels_stream(
+    MappedMatrix< float > const& A,
+    MappedMatrix< float > const& B,
+    float* X, int64_t ldx,
+    int64_t mb = 4096 );
+
+int64_t gels_stream(
+    MappedMatrix< double > const& A,
+    MappedMatrix< double > const& B,
+    double* X, int64_t ldx,
+    int64_t mb = 4096 );
+
+int64_t gels_stream(
+    MappedMatrix< std::complex<float> > const& A,
+    MappedMatrix< std::complex<float> > const& B,
+    std::complex<float>* X, int64_t ldx,
+    int64_t mb = 4096 );
+
+int64_t gels_stream(
+    MappedMatrix< std::complex<double> > const& A,
+    MappedMatrix< std::complex<double> > const& B,
+    std::complex<double>* X, int64_t ldx,
+    int64_t mb = 4096 );
+
+}  // namespace lapack
+
+#endif  // LAPACK_GELS_STREAM_HH
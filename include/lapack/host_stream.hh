@@ -0,0 +1,252 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_HOST_STREAM_HH
+#define LAPACK_HOST_STREAM_HH
+
+#include "lapack/wrappers.hh"
+
+#include <functional>
+#include <future>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace lapack {
+
+namespace internal {
+
+class HostEventState;
+class HostPoolState;
+class HostStreamState;
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+/// Bounded pool of worker threads shared by HostStream objects.
+/// Each task runs inside a ThreadScope( threads_per_worker ), so by
+/// default the BLAS and LAPACK library runs single threaded and
+/// num_workers calls proceed concurrently without oversubscription.
+/// With OpenBLAS and BLIS, whose setting is process-wide, the count
+/// also applies to other threads while a task runs, and is restored
+/// when no tasks are running.
+///
+/// The pool must outlive the streams that use it. Destroying the pool
+/// finishes queued work, then joins the workers.
+class HostPool
+{
+public:
+    /// @param[in] num_workers
+    ///     Number of worker threads. num_workers >= 1.
+    ///
+    /// @param[in] threads_per_worker
+    ///     Number of BLAS and LAPACK threads per worker.
+    ///     threads_per_worker >= 1.
+    explicit HostPool( int num_workers, int threads_per_worker = 1 );
+    ~HostPool();
+
+    HostPool( HostPool const& ) = delete;
+    HostPool& operator = ( HostPool const& ) = delete;
+
+    /// @return number of worker threads.
+    int num_workers() const;
+
+    /// @return pool shared by all streams created without one, with
+    /// std::thread::hardware_concurrency() workers, created on first use.
+    static HostPool& default_pool();
+
+private:
+    friend class HostStream;
+    std::shared_ptr< internal::HostPoolState > state_;
+};
+
+//------------------------------------------------------------------------------
+/// Marks a point in a HostStream. The event completes when all work
+/// enqueued on the stream before HostStream::record() has finished.
+/// A default-constructed event is already complete.
+class HostEvent
+{
+public:
+    HostEvent() = default;
+
+    /// @return true if the event has completed.
+    bool query() const;
+
+    /// Blocks the calling thread until the event has completed.
+    void wait() const;
+
+private:
+    friend class HostStream;
+    std::shared_ptr< internal::HostEventState > state_;
+};
+
+//------------------------------------------------------------------------------
+/// In-order stream of host LAPACK calls, analogous to lapack::Queue for
+/// the device routines. Calls on one stream execute one at a time, in
+/// the order enqueued; calls on different streams sharing a HostPool
+/// execute concurrently on its workers. Enqueueing never blocks.
+///
+/// enqueue() and the routines below return a std::future that holds the
+/// call's result, usually LAPACK's info, or the exception it threw,
+/// such as lapack::Error for invalid arguments. Arrays passed to the
+/// routines must remain valid until the call completes.
+///
+/// Example:
+///
+///     lapack::HostStream s1, s2;
+///     auto info1 = lapack::potrf( uplo, n, A1, lda, s1 );
+///     auto info2 = lapack::getrf( m, n, A2, lda, ipiv, s2 );
+///     read_next_matrices();  // overlaps with both factorizations
+///     if (info1.get() != 0 || info2.get() != 0) { ... }
+///
+class HostStream
+{
+public:
+    explicit HostStream( HostPool& pool = HostPool::default_pool() );
+
+    /// Waits for all enqueued work, then releases the stream.
+    ~HostStream();
+
+    HostStream( HostStream const& ) = delete;
+    HostStream& operator = ( HostStream const& ) = delete;
+
+    /// Enqueues func() after all work previously enqueued on this stream.
+    /// @return future for the value returned by func, or its exception.
+    template <typename Func>
+    std::future< std::invoke_result_t< Func > > enqueue( Func func )
+    {
+        using result_t = std::invoke_result_t< Func >;
+        // std::function must be copyable, so share the packaged_task.
+        auto task = std::make_shared< std::packaged_task< result_t () > >(
+            std::move( func ) );
+        std::future< result_t > future = task->get_future();
+        submit( [task]() { (*task)(); } );
+        return future;
+    }
+
+    /// @return event that completes when all work enqueued on this
+    /// stream so far has finished.
+    HostEvent record();
+
+    /// Makes work enqueued on this stream after this call wait until
+    /// event completes, for instance, an event recorded on another
+    /// stream. Does not block the calling thread or a worker.
+    void wait( HostEvent const& event );
+
+    /// Blocks the calling thread until all enqueued work has finished.
+    void sync();
+
+private:
+    void submit( std::function< void () > task );
+
+    std::shared_ptr< internal::HostStreamState > state_;
+    std::shared_ptr< internal::HostPoolState > pool_;
+};
+
+//------------------------------------------------------------------------------
+// Asynchronous LAPACK routines. Arguments are as for the synchronous
+// routine of the same name; they are checked when the call executes.
+
+/// Enqueues potrf on stream; see lapack::potrf.
+/// @return future for info.
+template <typename scalar_t>
+std::future< int64_t > potrf(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda,
+    HostStream& stream )
+{
+    return stream.enqueue( [=]() {
+        return lapack::potrf( uplo, n, A, lda );
+    } );
+}
+
+/// Enqueues getrf on stream; see lapack::getrf.
+/// @return future for info.
+template <typename scalar_t>
+std::future< int64_t > getrf(
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    int64_t* ipiv,
+    HostStream& stream )
+{
+    return stream.enqueue( [=]() {
+        return lapack::getrf( m, n, A, lda, ipiv );
+    } );
+}
+
+/// Enqueues geqrf on stream; see lapack::geqrf.
+/// @return future for info.
+template <typename scalar_t>
+std::future< int64_t > geqrf(
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    scalar_t* tau,
+    HostStream& stream )
+{
+    return stream.enqueue( [=]() {
+        return lapack::geqrf( m, n, A, lda, tau );
+    } );
+}
+
+/// Enqueues gesv on stream; see lapack::gesv.
+/// @return future for info.
+template <typename scalar_t>
+std::future< int64_t > gesv(
+    int64_t n, int64_t nrhs,
+    scalar_t* A, int64_t lda,
+    int64_t* ipiv,
+    scalar_t* B, int64_t ldb,
+    HostStream& stream )
+{
+    return stream.enqueue( [=]() {
+        return lapack::gesv( n, nrhs, A, lda, ipiv, B, ldb );
+    } );
+}
+
+/// Enqueues posv on stream; see lapack::posv.
+/// @return future for info.
+template <typename scalar_t>
+std::future< int64_t > posv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t* A, int64_t lda,
+    scalar_t* B, int64_t ldb,
+    HostStream& stream )
+{
+    return stream.enqueue( [=]() {
+        return lapack::posv( uplo, n, nrhs, A, lda, B, ldb );
+    } );
+}
+
+/// Enqueues gels on stream; see lapack::gels.
+/// @return future for info.
+template <typename scalar_t>
+std::future< int64_t > gels(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    scalar_t* A, int64_t lda,
+    scalar_t* B, int64_t ldb,
+    HostStream& stream )
+{
+    return stream.enqueue( [=]() {
+        return lapack::gels( trans, m, n, nrhs, A, lda, B, ldb );
+    } );
+}
+
+/// Enqueues heevd (syevd for real types) on stream; see lapack::heevd.
+/// @return future for info.
+template <typename scalar_t>
+std::future< int64_t > heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda,
+    blas::real_type< scalar_t >* W,
+    HostStream& stream )
+{
+    return stream.enqueue( [=]() {
+        return lapack::heevd( jobz, uplo, n, A, lda, W );
+    } );
+}
+
+}  // namespace lapack
+
+#endif  // LAPACK_HOST_STREAM_HH
@@ -0,0 +1,184 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_REFINE_HH
+#define LAPACK_REFINE_HH
+
+#include "lapack/util.hh"
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+/// Options for the mixed-precision solvers gesv_mixed, posv_mixed, and
+/// gels_mixed. The defaults follow LAPACK dsgesv: factor in single,
+/// stop when || r ||_inf <= sqrt(m) eps || A ||_inf || x ||_inf,
+/// for A with m rows, at most 30 refinement steps, else fall back to
+/// working precision.
+///
+struct RefineOptions
+{
+    /// Precision of the factorization. Bfloat16 and Half are emulated:
+    /// A and its factors are rounded to that format, with arithmetic
+    /// in single. For Half, A is first scaled by a power of 2 so its
+    /// largest entry is 4096, to avoid overflow.
+    InnerPrecision precision = InnerPrecision::Single;
+
+    /// Classical refinement solves for each correction with the
+    /// low-precision factors. GMRES refinement instead runs GMRES
+    /// preconditioned by those factors in working precision, which
+    /// converges for matrices about 1/u_inner times more ill-conditioned.
+    MethodRefine method = MethodRefine::GMRES;
+
+    /// Convergence tolerance on the normwise backward error;
+    /// if <= 0, sqrt(m) times working precision epsilon.
+    double tol = 0;
+
+    /// Maximum number of refinement steps.
+    int64_t max_iter = 30;
+
+    /// Maximum GMRES iterations per refinement step, which is also the
+    /// size of the Krylov basis.
+    int64_t gmres_max_iter = 50;
+
+    /// GMRES stops when the preconditioned residual is reduced by
+    /// this factor.
+    double gmres_tol = 1e-6;
+
+    /// If refinement does not converge in max_iter steps, refactor in
+    /// working precision. Falling back when the low-precision matrix
+    /// overflows or its factorization fails is always done.
+    bool fallback = true;
+};
+
+//------------------------------------------------------------------------------
+/// Result of the mixed-precision solvers.
+///
+struct RefineInfo
+{
+    /// If > 0, the number of refinement steps, max over right-hand sides.
+    /// If < 0, why refinement failed, as in LAPACK dsgesv:
+    ///     -2:  overflow converting A to the inner precision;
+    ///     -3:  the inner factorization failed;
+    ///     -31: not converged in max_iter steps.
+    /// Then X is from the working-precision fallback, or, if fallback
+    /// is disabled for -31, the last iterate.
+    int64_t iter = 0;
+
+    /// Total GMRES iterations, summed over steps and right-hand sides.
+    int64_t gmres_iter = 0;
+
+    /// Whether refinement converged for all right-hand sides.
+    bool converged = false;
+
+    /// Final normwise backward error, max over right-hand sides,
+    /// for the refined solution.
+    double berr = 0;
+};
+
+//------------------------------------------------------------------------------
+// Mixed-precision LU solve with iterative refinement.
+int64_t gesv_mixed(
+    int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    RefineOptions const& opts = RefineOptions(),
+    RefineInfo* rinfo = nullptr );
+
+int64_t gesv_mixed(
+    int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    RefineOptions const& opts = RefineOptions(),
+    RefineInfo* rinfo = nullptr );
+
+int64_t gesv_mixed(
+    int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    RefineOptions const& opts = RefineOptions(),
+    RefineInfo* rinfo = nullptr );
+
+int64_t gesv_mixed(
+    int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    RefineOptions const& opts = RefineOptions(),
+    RefineInfo* rinfo = nullptr );
+
+//------------------------------------------------------------------------------
+// Mixed-precision Cholesky solve with iterative refinement.
+int64_t posv_mixed(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    RefineOptions const& opts = RefineOptions(),
+    RefineInfo* rinfo = nullptr );
+
+int64_t posv_mixed(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    RefineOptions const& opts = RefineOptions(),
+    RefineInfo* rinfo = nullptr );
+
+int64_t posv_mixed(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    RefineOptions const& opts = RefineOptions(),
+    RefineInfo* rinfo = nullptr );
+
+int64_t posv_mixed(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    RefineOptions const& opts = RefineOptions(),
+    RefineInfo* rinfo = nullptr );
+
+//------------------------------------------------------------------------------
+// Mixed-precision QR least squares with iterative refinement.
+int64_t gels_mixed(
+    int64_t m, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    RefineOptions const& opts = RefineOptions(),
+    RefineInfo* rinfo = nullptr );
+
+int64_t gels_mixed(
+    int64_t m, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    RefineOptions const& opts = RefineOptions(),
+    RefineInfo* rinfo = nullptr );
+
+int64_t gels_mixed(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    RefineOptions const& opts = RefineOptions(),
+    RefineInfo* rinfo = nullptr );
+
+int64_t gels_mixed(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    RefineOptions const& opts = RefineOptions(),
+    RefineInfo* rinfo = nullptr );
+
+}  // namespace lapack
+
+#endif  // LAPACK_REFINE_HH
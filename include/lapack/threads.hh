@@ -0,0 +1,74 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_THREADS_HH
+#define LAPACK_THREADS_HH
+
+namespace lapack {
+
+// -----------------------------------------------------------------------------
+/// @return name of the library whose threads get_num_threads and
+/// set_num_threads control: "MKL", "OpenBLAS", or "BLIS" if LAPACK++
+/// was configured with one of those, else "OpenMP" if compiled with
+/// OpenMP, else "none".
+const char* thread_library();
+
+/// @return number of threads the BLAS and LAPACK library will use for
+/// the next call from this thread. With "OpenMP" this is
+/// omp_get_max_threads(); with "none", 1.
+int get_num_threads();
+
+/// Sets the number of threads the BLAS and LAPACK library uses.
+/// The setting persists until changed; for MKL, OpenBLAS, and BLIS it
+/// is global to the process. It also sets omp_get_max_threads() for
+/// the calling thread, which limits parallel regions in LAPACK++ itself,
+/// such as the batched routines and the tiled Cholesky.
+///
+/// @param[in] num_threads
+///     Number of threads. num_threads >= 1.
+void set_num_threads( int num_threads );
+
+// -----------------------------------------------------------------------------
+/// RAII guard that limits the number of BLAS and LAPACK threads while it
+/// is alive, restoring the previous count when destroyed. The default,
+/// 1 thread, lets LAPACK++ be called from tasks of an application's
+/// own thread pool or OpenMP parallel loop without oversubscription.
+///
+/// With MKL and OpenMP, the setting is local to the calling thread, so
+/// concurrent scopes on different threads are independent.
+/// OpenBLAS and BLIS have only a process-wide setting; there, the
+/// num_threads of the most recently created scope that is still alive
+/// applies, and the last scope to be destroyed restores the count from
+/// before the first.
+///
+/// Scopes may be nested; they must be destroyed on the thread that
+/// created them, in reverse order of creation.
+///
+/// Example:
+///
+///     #pragma omp parallel for
+///     for (int i = 0; i < count; ++i) {
+///         lapack::ThreadScope scope;  // 1 thread
+///         lapack::potrf( uplo, n, A[ i ], lda );
+///     }
+///
+class ThreadScope
+{
+public:
+    explicit ThreadScope( int num_threads = 1 );
+    ~ThreadScope();
+
+    ThreadScope( ThreadScope const& ) = delete;
+    ThreadScope& operator = ( ThreadScope const& ) = delete;
+
+private:
+    int num_threads_;
+    int saved_blas_;
+    int saved_omp_;
+};
+
+}  // namespace lapack
+
+#endif  // LAPACK_THREADS_HH
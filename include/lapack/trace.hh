@@ -0,0 +1,207 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_TRACE_HH
+#define LAPACK_TRACE_HH
+
+#include "lapack/config.h"
+
+#include <complex>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace lapack {
+
+//==============================================================================
+/// Tracing of LAPACK++ wrapper calls.
+///
+/// When LAPACK++ is compiled with LAPACK_TRACE defined (CMake option
+/// use_trace=yes), each wrapper call records an Event with the routine,
+/// precision, dimensions, wall time, flop estimate, and info. Events go
+/// to a ring buffer per thread, which the recording thread writes without
+/// locks; when full, the oldest events are overwritten. A callback can
+/// also be set to see each event as it finishes.
+///
+/// Without LAPACK_TRACE, the wrappers have no tracing code; the functions
+/// here still exist, but no events are recorded.
+///
+/// With the Makefile build, after configuring, add
+///
+///     #define LAPACK_TRACE
+///
+/// to include/lapack/defines.h, then rebuild with `make clean && make`.
+/// Re-running configure overwrites defines.h. Adding -DLAPACK_TRACE to
+/// CXXFLAGS in make.inc also works, but then applications must define it
+/// too, so that compiled() agrees with the library.
+///
+/// Workspace queries (foo_work_size) are not traced; a wrapper that
+/// queries and allocates its workspace records one event.
+///
+/// Example:
+///
+///     lapack::potrf( uplo, n, A, lda );
+///     lapack::potrs( uplo, n, nrhs, A, lda, B, ldb );
+///     lapack::trace::write_chrome_json( "trace.json" );
+///
+namespace trace {
+
+//------------------------------------------------------------------------------
+/// One wrapper call.
+struct Event {
+    char const* routine;    ///< routine name without precision, e.g., "getrf"
+    char precision;         ///< 's', 'd', 'c', or 'z'
+    int thread;             ///< index of the calling thread, in order of first event
+
+    /// Dimensions, or 0 if the routine has no such argument.
+    /// k is either k or kd (band routines).
+    int64_t m, n, k, nrhs;
+
+    int64_t info;           ///< returned info; < 0 for an illegal argument
+    double start;           ///< start time in seconds, since the library was loaded
+    double time;            ///< wall time in seconds
+    double gflop;           ///< flop estimate from lapack::Gflop, or 0 if unknown
+};
+
+/// Function called by the recording thread after each event.
+using Callback = std::function< void (Event const& event) >;
+
+//------------------------------------------------------------------------------
+/// @return true if LAPACK++ was compiled with LAPACK_TRACE.
+constexpr bool compiled()
+{
+    #if defined(LAPACK_TRACE)
+        return true;
+    #else
+        return false;
+    #endif
+}
+
+/// Enables or disables recording at runtime; it is enabled by default.
+/// Has no effect without LAPACK_TRACE.
+void set_enabled( bool enabled );
+
+/// @return true if recording is enabled; always false without LAPACK_TRACE.
+bool enabled();
+
+/// Sets a callback, called by each thread after it records an event;
+/// an empty callback removes it. Exceptions from the callback are ignored.
+void set_callback( Callback callback );
+
+/// Sets the number of events in each thread's ring buffer, default 4096.
+/// A thread whose buffer has a different size starts a new buffer at
+/// its next event; events in the old buffer are kept until clear().
+///
+/// @param[in] size
+///     Number of events. size >= 1.
+void set_buffer_size( int64_t size );
+
+/// @return number of events in each thread's ring buffer.
+int64_t buffer_size();
+
+/// @return events recorded since the last clear(), from all threads,
+/// sorted by start time. Events being overwritten by a thread while they
+/// are collected are skipped.
+std::vector< Event > events();
+
+/// Discards recorded events, and the buffers of threads that have exited.
+void clear();
+
+/// Writes events() in Chrome trace event format (JSON), which can be
+/// viewed in Perfetto (ui.perfetto.dev) or chrome://tracing. Each call
+/// is a complete event named with its precision, e.g., "dgetrf", with
+/// dimensions, info, gflop, and gflop/s as arguments.
+void write_chrome_json( std::ostream& os );
+
+/// Writes events() in Chrome trace event format to the file filename.
+/// Throws lapack::Error if the file cannot be written.
+void write_chrome_json( std::string const& filename );
+
+//------------------------------------------------------------------------------
+/// @return precision character for scalar_t: 's', 'd', 'c', or 'z'.
+template <typename scalar_t>
+constexpr char precision();
+
+template <> constexpr char precision< float  >() { return 's'; }
+template <> constexpr char precision< double >() { return 'd'; }
+template <> constexpr char precision< std::complex<float>  >() { return 'c'; }
+template <> constexpr char precision< std::complex<double> >() { return 'z'; }
+
+namespace internal {
+
+int flop_id( char const* routine );
+double now();
+void record( Event& event, int flop_id ) noexcept;
+
+} // namespace internal
+
+//------------------------------------------------------------------------------
+/// Records one event, from construction to destruction, with the value
+/// of info when destroyed. Used by LAPACK_TRACE_BLOCK in the wrappers.
+template <typename int_t>
+class Block
+{
+public:
+    Block( char const* routine, int flop_id, char precision,
+           int64_t m, int64_t n, int64_t k, int64_t nrhs,
+           int_t const* info )
+        : info_( info ),
+          flop_id_( flop_id ),
+          active_( enabled() )
+    {
+        if (active_) {
+            event_.routine   = routine;
+            event_.precision = precision;
+            event_.m    = m;
+            event_.n    = n;
+            event_.k    = k;
+            event_.nrhs = nrhs;
+            event_.start = internal::now();
+        }
+    }
+
+    ~Block()
+    {
+        if (active_) {
+            event_.time = internal::now() - event_.start;
+            event_.info = *info_;
+            internal::record( event_, flop_id_ );
+        }
+    }
+
+    // Disable copying.
+    Block( Block const& ) = delete;
+    Block& operator=( Block const& ) = delete;
+
+private:
+    Event event_;
+    int_t const* info_;
+    int flop_id_;
+    bool active_;
+};
+
+} // namespace trace
+} // namespace lapack
+
+//------------------------------------------------------------------------------
+/// Traces the enclosing wrapper call, for routine in precision scalar_t,
+/// recording info at the end of the scope. Without LAPACK_TRACE, it
+/// expands to nothing, so its arguments are not evaluated.
+#if defined(LAPACK_TRACE)
+    #define LAPACK_TRACE_BLOCK( routine, scalar_t, m, n, k, nrhs, info ) \
+        static const int lapack_trace_flop_id_ \
+            = lapack::trace::internal::flop_id( routine ); \
+        lapack::trace::Block< decltype( info ) > lapack_trace_block_( \
+            routine, lapack_trace_flop_id_, \
+            lapack::trace::precision< scalar_t >(), \
+            m, n, k, nrhs, &info )
+#else
+    #define LAPACK_TRACE_BLOCK( routine, scalar_t, m, n, k, nrhs, info ) \
+        ((void) 0)
+#endif
+
+#endif // LAPACK_TRACE_HH
@@ -1188,6 +1188,178 @@ inline void from_string( std::string const& str, Pivot* val )
         throw Error( "unknown Pivot: " + str );
 }
 
+// -----------------------------------------------------------------------------
+// getrf_set_method
+enum class MethodLU : char {
+    Lapack = 'L',
+    Native = 'N',
+};
+
+extern const char* MethodLU_help;
+
+//--------------------
+inline char to_char( MethodLU value )
+{
+    return char( value );
+}
+
+inline const char* to_c_string( MethodLU value )
+{
+    switch (value) {
+        case MethodLU::Lapack: return "lapack";
+        case MethodLU::Native: return "native";
+    }
+    return "?";
+}
+
+inline std::string to_string( MethodLU value )
+{
+    return to_c_string( value );
+}
+
+inline void from_string( std::string const& str, MethodLU* val )
+{
+    std::string str_ = str;
+    std::transform( str_.begin(), str_.end(), str_.begin(), ::tolower );
+
+    if (str_ == "l" || str_ == "lapack")
+        *val = MethodLU::Lapack;
+    else if (str_ == "n" || str_ == "native")
+        *val = MethodLU::Native;
+    else
+        throw Error( "unknown MethodLU: " + str );
+}
+
+// -----------------------------------------------------------------------------
+// potrf_set_method
+enum class MethodCholesky : char {
+    Lapack = 'L',
+    Tiled  = 'T',
+};
+
+extern const char* MethodCholesky_help;
+
+//--------------------
+inline char to_char( MethodCholesky value )
+{
+    return char( value );
+}
+
+inline const char* to_c_string( MethodCholesky value )
+{
+    switch (value) {
+        case MethodCholesky::Lapack: return "lapack";
+        case MethodCholesky::Tiled:  return "tiled";
+    }
+    return "?";
+}
+
+inline std::string to_string( MethodCholesky value )
+{
+    return to_c_string( value );
+}
+
+inline void from_string( std::string const& str, MethodCholesky* val )
+{
+    std::string str_ = str;
+    std::transform( str_.begin(), str_.end(), str_.begin(), ::tolower );
+
+    if (str_ == "l" || str_ == "lapack")
+        *val = MethodCholesky::Lapack;
+    else if (str_ == "t" || str_ == "tiled")
+        *val = MethodCholesky::Tiled;
+    else
+        throw Error( "unknown MethodCholesky: " + str );
+}
+
+// -----------------------------------------------------------------------------
+// gesv_mixed, posv_mixed, gels_mixed
+enum class InnerPrecision : char {
+    Single   = 'S',
+    Bfloat16 = 'B',
+    Half     = 'H',
+};
+
+extern const char* InnerPrecision_help;
+
+//--------------------
+inline char to_char( InnerPrecision value )
+{
+    return char( value );
+}
+
+inline const char* to_c_string( InnerPrecision value )
+{
+    switch (value) {
+        case InnerPrecision::Single:   return "single";
+        case InnerPrecision::Bfloat16: return "bfloat16";
+        case InnerPrecision::Half:     return "half";
+    }
+    return "?";
+}
+
+inline std::string to_string( InnerPrecision value )
+{
+    return to_c_string( value );
+}
+
+inline void from_string( std::string const& str, InnerPrecision* val )
+{
+    std::string str_ = str;
+    std::transform( str_.begin(), str_.end(), str_.begin(), ::tolower );
+
+    if (str_ == "s" || str_ == "single")
+        *val = InnerPrecision::Single;
+    else if (str_ == "b" || str_ == "bfloat16")
+        *val = InnerPrecision::Bfloat16;
+    else if (str_ == "h" || str_ == "half")
+        *val = InnerPrecision::Half;
+    else
+        throw Error( "unknown InnerPrecision: " + str );
+}
+
+// -----------------------------------------------------------------------------
+// gesv_mixed, posv_mixed, gels_mixed
+enum class MethodRefine : char {
+    Classical = 'C',
+    GMRES     = 'G',
+};
+
+extern const char* MethodRefine_help;
+
+//--------------------
+inline char to_char( MethodRefine value )
+{
+    return char( value );
+}
+
+inline const char* to_c_string( MethodRefine value )
+{
+    switch (value) {
+        case MethodRefine::Classical: return "classical";
+        case MethodRefine::GMRES:     return "gmres";
+    }
+    return "?";
+}
+
+inline std::string to_string( MethodRefine value )
+{
+    return to_c_string( value );
+}
+
+inline void from_string( std::string const& str, MethodRefine* val )
+{
+    std::string str_ = str;
+    std::transform( str_.begin(), str_.end(), str_.begin(), ::tolower );
+
+    if (str_ == "c" || str_ == "classical")
+        *val = MethodRefine::Classical;
+    else if (str_ == "g" || str_ == "gmres")
+        *val = MethodRefine::GMRES;
+    else
+        throw Error( "unknown MethodRefine: " + str );
+}
+
 //------------------------------------------------------------------------------
 // For %lld printf-style printing, cast to llong; guaranteed >= 64 bits.
 using llong = long long;
@@ -0,0 +1,438 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_VIEWS_HH
+#define LAPACK_VIEWS_HH
+
+#include "lapack/util.hh"
+
+#include <type_traits>
+#include <utility>
+
+#if __has_include( <version> )
+    #include <version>
+#endif
+
+#if defined( __cpp_lib_mdspan ) && __cpp_lib_mdspan >= 202207L
+    #include <array>
+    #include <mdspan>
+    #define LAPACK_HAVE_STD_MDSPAN
+#endif
+
+namespace lapack {
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// True if mdspan_t looks like a rank-2 mdspan of scalar_t:
+/// it has rank(), extent( r ), stride( r ), is_strided(), and a
+/// data_handle() convertible to scalar_t*. This matches std::mdspan,
+/// std::experimental::mdspan, and Kokkos::mdspan without including them.
+template <typename mdspan_t, typename scalar_t, typename = void>
+struct is_mdspan_of : std::false_type {};
+
+template <typename mdspan_t, typename scalar_t>
+struct is_mdspan_of<
+    mdspan_t, scalar_t,
+    std::void_t< decltype( mdspan_t::rank() ),
+                 decltype( std::declval< mdspan_t const& >().extent( 0 ) ),
+                 decltype( std::declval< mdspan_t const& >().stride( 0 ) ),
+                 decltype( std::declval< mdspan_t const& >().is_strided() ),
+                 decltype( std::declval< mdspan_t const& >().data_handle() ) > >
+    : std::bool_constant<
+        mdspan_t::rank() == 2
+        && std::is_convertible_v<
+            decltype( std::declval< mdspan_t const& >().data_handle() ),
+            scalar_t* > > {};
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+/// Non-owning view of an m-by-n matrix with arbitrary positive strides:
+/// element (i, j) is at data[ i*row_stride + j*col_stride ].
+/// Column-major storage with leading dimension ld has strides (1, ld);
+/// row-major storage has strides (ld, 1).
+///
+/// Drivers that take views, e.g., lapack::gesv( MatrixView, ... ),
+/// pass column-major or row-major views to LAPACK without copying.
+/// Only views with other strides, or mixed layouts that have no
+/// copy-free identity, are repacked through one workspace buffer.
+///
+/// A view can be constructed from any rank-2 strided mdspan, e.g.,
+/// std::mdspan with layout_left, layout_right, or layout_stride.
+///
+/// Example:
+///
+///     std::vector< double > a( n*n ), b( n*nrhs );
+///     auto A = lapack::MatrixView< double >::row_major( a.data(), n, n, n );
+///     auto B = lapack::MatrixView< double >::col_major( b.data(), n, nrhs, n );
+///     std::vector< int64_t > ipiv( n );
+///     lapack::gesv( A, ipiv.data(), B );
+///
+/// @ingroup views
+///
+template <typename scalar_t>
+class MatrixView
+{
+public:
+    using value_type = scalar_t;
+
+    /// View of m-by-n matrix with given strides, each >= 1.
+    MatrixView( scalar_t* data, int64_t m, int64_t n,
+                int64_t row_stride, int64_t col_stride )
+        : data_( data ),
+          m_( m ),
+          n_( n ),
+          row_stride_( row_stride ),
+          col_stride_( col_stride )
+    {
+        lapack_error_if( m < 0 );
+        lapack_error_if( n < 0 );
+        lapack_error_if( row_stride < 1 );
+        lapack_error_if( col_stride < 1 );
+    }
+
+    /// View of rank-2 strided mdspan A; A( i, j ) is element (i, j).
+    template <typename mdspan_t,
+              typename = std::enable_if_t<
+                  internal::is_mdspan_of< mdspan_t, scalar_t >::value > >
+    MatrixView( mdspan_t const& A )
+        : MatrixView( A.data_handle(), A.extent( 0 ), A.extent( 1 ),
+                      A.is_strided() ? A.stride( 0 ) : 0,
+                      A.is_strided() ? A.stride( 1 ) : 0 )
+    {}
+
+    /// @return view of column-major m-by-n matrix, ld >= max( 1, m ).
+    static MatrixView col_major( scalar_t* data, int64_t m, int64_t n,
+                                 int64_t ld )
+    {
+        lapack_error_if( ld < m );
+        return MatrixView( data, m, n, 1, ld );
+    }
+
+    /// @return view of row-major m-by-n matrix, ld >= max( 1, n ).
+    static MatrixView row_major( scalar_t* data, int64_t m, int64_t n,
+                                 int64_t ld )
+    {
+        lapack_error_if( ld < n );
+        return MatrixView( data, m, n, ld, 1 );
+    }
+
+    scalar_t* data() const { return data_; }
+    int64_t m() const { return m_; }
+    int64_t n() const { return n_; }
+    int64_t row_stride() const { return row_stride_; }
+    int64_t col_stride() const { return col_stride_; }
+
+    scalar_t& operator () ( int64_t i, int64_t j ) const
+    {
+        return data_[ i*row_stride_ + j*col_stride_ ];
+    }
+
+    /// @return view of the n-by-m transpose, sharing the same data.
+    MatrixView transpose() const
+    {
+        return MatrixView( data_, n_, m_, col_stride_, row_stride_ );
+    }
+
+    /// @return true if the view is column-major storage that LAPACK
+    /// can use directly, with leading dimension col_major_ld().
+    /// Strides of a dimension of size <= 1 don't matter.
+    bool is_col_major() const
+    {
+        return (row_stride_ == 1 || m_ <= 1)
+               && (col_stride_ >= m_ || n_ <= 1);
+    }
+
+    /// @return true if the view is row-major storage that LAPACK++
+    /// Layout overloads can use directly, with leading dimension
+    /// row_major_ld().
+    bool is_row_major() const
+    {
+        return (col_stride_ == 1 || n_ <= 1)
+               && (row_stride_ >= n_ || m_ <= 1);
+    }
+
+    /// @return leading dimension for column-major, valid if is_col_major().
+    int64_t col_major_ld() const
+    {
+        return n_ <= 1 ? blas::max( 1, m_ ) : blas::max( 1, col_stride_ );
+    }
+
+    /// @return leading dimension for row-major, valid if is_row_major().
+    int64_t row_major_ld() const
+    {
+        return m_ <= 1 ? blas::max( 1, n_ ) : blas::max( 1, row_stride_ );
+    }
+
+    #if defined( LAPACK_HAVE_STD_MDSPAN )
+        /// @return std::mdspan with layout_stride of the same elements.
+        std::mdspan< scalar_t, std::dextents< int64_t, 2 >, std::layout_stride >
+        to_mdspan() const
+        {
+            using extents_t = std::dextents< int64_t, 2 >;
+            using mdspan_t  = std::mdspan< scalar_t, extents_t,
+                                           std::layout_stride >;
+            std::array< int64_t, 2 > strides = { row_stride_, col_stride_ };
+            return mdspan_t( data_, std::layout_stride::mapping< extents_t >(
+                                        extents_t( m_, n_ ), strides ) );
+        }
+    #endif
+
+private:
+    scalar_t* data_;
+    int64_t m_, n_;
+    int64_t row_stride_, col_stride_;
+};
+
+//------------------------------------------------------------------------------
+/// Non-owning view of an m-by-n band matrix with kl sub-diagonals and
+/// ku super-diagonals, in LAPACK band storage: element (i, j), for
+/// max( 0, j - ku ) <= i <= min( m-1, j + kl ), is at
+/// data[ (ku + i - j) + j*ld ], with ld >= kl + ku + 1.
+///
+/// A Hermitian band matrix stores one triangle: kl = 0 for the upper
+/// triangle, or ku = 0 for the lower triangle, as in lapack::pbsv.
+///
+/// @ingroup views
+///
+template <typename scalar_t>
+class BandView
+{
+public:
+    using value_type = scalar_t;
+
+    BandView( scalar_t* data, int64_t m, int64_t n,
+              int64_t kl, int64_t ku, int64_t ld )
+        : data_( data ),
+          m_( m ),
+          n_( n ),
+          kl_( kl ),
+          ku_( ku ),
+          ld_( ld )
+    {
+        lapack_error_if( m < 0 );
+        lapack_error_if( n < 0 );
+        lapack_error_if( kl < 0 );
+        lapack_error_if( ku < 0 );
+        lapack_error_if( ld < kl + ku + 1 );
+    }
+
+    scalar_t* data() const { return data_; }
+    int64_t m() const { return m_; }
+    int64_t n() const { return n_; }
+    int64_t kl() const { return kl_; }
+    int64_t ku() const { return ku_; }
+    int64_t ld() const { return ld_; }
+
+    /// @return element (i, j), which must be inside the band.
+    scalar_t& operator () ( int64_t i, int64_t j ) const
+    {
+        return data_[ (ku_ + i - j) + j*ld_ ];
+    }
+
+private:
+    scalar_t* data_;
+    int64_t m_, n_;
+    int64_t kl_, ku_;
+    int64_t ld_;
+};
+
+//------------------------------------------------------------------------------
+/// Non-owning view of one triangle of an n-by-n Hermitian or triangular
+/// matrix in LAPACK packed storage: columns of the triangle are stored
+/// consecutively, as in lapack::ppsv.
+///
+/// @ingroup views
+///
+template <typename scalar_t>
+class PackedView
+{
+public:
+    using value_type = scalar_t;
+
+    PackedView( scalar_t* data, int64_t n, lapack::Uplo uplo )
+        : data_( data ),
+          n_( n ),
+          uplo_( uplo )
+    {
+        lapack_error_if( n < 0 );
+        lapack_error_if( uplo != Uplo::Upper && uplo != Uplo::Lower );
+    }
+
+    scalar_t* data() const { return data_; }
+    int64_t n() const { return n_; }
+    lapack::Uplo uplo() const { return uplo_; }
+
+    /// @return element (i, j), which must be in the stored triangle.
+    scalar_t& operator () ( int64_t i, int64_t j ) const
+    {
+        if (uplo_ == Uplo::Upper)
+            return data_[ i + j*(j + 1)/2 ];
+        else
+            return data_[ i + j*(2*n_ - j - 1)/2 ];
+    }
+
+private:
+    scalar_t* data_;
+    int64_t n_;
+    lapack::Uplo uplo_;
+};
+
+// -----------------------------------------------------------------------------
+// Drivers taking views. Dimensions come from the views; on exit, outputs
+// are in the caller's views whatever their strides.
+// This is in alphabetical order.
+
+// -----------------------------------------------------------------------------
+int64_t gels(
+    lapack::Op trans,
+    MatrixView< float > A,
+    MatrixView< float > B );
+
+int64_t gels(
+    lapack::Op trans,
+    MatrixView< double > A,
+    MatrixView< double > B );
+
+int64_t gels(
+    lapack::Op trans,
+    MatrixView< std::complex<float> > A,
+    MatrixView< std::complex<float> > B );
+
+int64_t gels(
+    lapack::Op trans,
+    MatrixView< std::complex<double> > A,
+    MatrixView< std::complex<double> > B );
+
+// -----------------------------------------------------------------------------
+int64_t gesv(
+    MatrixView< float > A,
+    int64_t* ipiv,
+    MatrixView< float > B );
+
+int64_t gesv(
+    MatrixView< double > A,
+    int64_t* ipiv,
+    MatrixView< double > B );
+
+int64_t gesv(
+    MatrixView< std::complex<float> > A,
+    int64_t* ipiv,
+    MatrixView< std::complex<float> > B );
+
+int64_t gesv(
+    MatrixView< std::complex<double> > A,
+    int64_t* ipiv,
+    MatrixView< std::complex<double> > B );
+
+// -----------------------------------------------------------------------------
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt,
+    MatrixView< float > A,
+    float* S,
+    MatrixView< float > U,
+    MatrixView< float > VT );
+
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt,
+    MatrixView< double > A,
+    double* S,
+    MatrixView< double > U,
+    MatrixView< double > VT );
+
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt,
+    MatrixView< std::complex<float> > A,
+    float* S,
+    MatrixView< std::complex<float> > U,
+    MatrixView< std::complex<float> > VT );
+
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt,
+    MatrixView< std::complex<double> > A,
+    double* S,
+    MatrixView< std::complex<double> > U,
+    MatrixView< std::complex<double> > VT );
+
+// -----------------------------------------------------------------------------
+int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo,
+    MatrixView< float > A,
+    float* W );
+
+int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo,
+    MatrixView< double > A,
+    double* W );
+
+int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo,
+    MatrixView< std::complex<float> > A,
+    float* W );
+
+int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo,
+    MatrixView< std::complex<double> > A,
+    double* W );
+
+// -----------------------------------------------------------------------------
+int64_t pbsv(
+    BandView< float > AB,
+    MatrixView< float > B );
+
+int64_t pbsv(
+    BandView< double > AB,
+    MatrixView< double > B );
+
+int64_t pbsv(
+    BandView< std::complex<float> > AB,
+    MatrixView< std::complex<float> > B );
+
+int64_t pbsv(
+    BandView< std::complex<double> > AB,
+    MatrixView< std::complex<double> > B );
+
+// -----------------------------------------------------------------------------
+int64_t posv(
+    lapack::Uplo uplo,
+    MatrixView< float > A,
+    MatrixView< float > B );
+
+int64_t posv(
+    lapack::Uplo uplo,
+    MatrixView< double > A,
+    MatrixView< double > B );
+
+int64_t posv(
+    lapack::Uplo uplo,
+    MatrixView< std::complex<float> > A,
+    MatrixView< std::complex<float> > B );
+
+int64_t posv(
+    lapack::Uplo uplo,
+    MatrixView< std::complex<double> > A,
+    MatrixView< std::complex<double> > B );
+
+// -----------------------------------------------------------------------------
+int64_t ppsv(
+    PackedView< float > AP,
+    MatrixView< float > B );
+
+int64_t ppsv(
+    PackedView< double > AP,
+    MatrixView< double > B );
+
+int64_t ppsv(
+    PackedView< std::complex<float> > AP,
+    MatrixView< std::complex<float> > B );
+
+int64_t ppsv(
+    PackedView< std::complex<double> > AP,
+    MatrixView< std::complex<double> > B );
+
+}  // namespace lapack
+
+#endif  // LAPACK_VIEWS_HH
@@ -0,0 +1,88 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_WORKSPACE_HH
+#define LAPACK_WORKSPACE_HH
+
+#include <cstddef>  // std::size_t
+#include <cstdint>  // int64_t
+
+namespace lapack {
+
+// -----------------------------------------------------------------------------
+/// RAII guard that enables a thread-local workspace arena.
+///
+/// While a WorkspaceScope is alive on a thread, the work, rwork, iwork,
+/// and 32-bit pivot arrays that LAPACK++ wrappers allocate internally
+/// are drawn from a bump-pointer arena owned by that thread, instead of
+/// the heap. Wrappers free their workspace in reverse order of
+/// allocation, so after the first call the arena is reused and repeated
+/// calls with the same sizes make no heap allocations.
+///
+/// The arena grows in chunks up to max_bytes; larger requests fall back
+/// to the heap. Scopes may be nested; inner scopes share the arena of
+/// the outermost scope, which releases the arena memory on destruction.
+///
+/// The arena is per thread. Scopes must be destroyed on the thread that
+/// created them, in reverse order of creation.
+///
+/// Example:
+///
+///     {
+///         lapack::WorkspaceScope scope;
+///         for (int i = 0; i < count; ++i) {
+///             lapack::geqrf( m, n, A[ i ], lda, tau[ i ] );
+///         }
+///     }
+///
+class WorkspaceScope
+{
+public:
+    /// Default maximum arena size, in bytes: 256 MiB.
+    static constexpr std::size_t default_max_bytes = std::size_t( 256 ) << 20;
+
+    WorkspaceScope( std::size_t max_bytes = default_max_bytes );
+    ~WorkspaceScope();
+
+    WorkspaceScope( WorkspaceScope const& ) = delete;
+    WorkspaceScope& operator = ( WorkspaceScope const& ) = delete;
+
+    /// @return bytes currently reserved by this thread's arena.
+    std::size_t capacity() const;
+
+    /// @return maximum bytes this thread's arena may reserve.
+    std::size_t max_bytes() const;
+};
+
+// -----------------------------------------------------------------------------
+/// Statistics of the workspace size cache.
+/// @see work_size_cache_set_capacity
+struct WorkSizeCacheStats
+{
+    int64_t hits;       ///< lookups found in the cache
+    int64_t misses;     ///< lookups that called the LAPACK workspace query
+    int64_t size;       ///< number of entries in the cache
+    int64_t capacity;   ///< maximum number of entries
+};
+
+/// Enables the workspace size cache with up to capacity entries,
+/// or disables and clears it if capacity is 0 (the default).
+///
+/// Wrappers that query LAPACK for the optimal workspace size, via
+/// foo_work_size, first look up the routine, precision, jobs, and
+/// dimensions in the cache, so the query call is skipped for repeated
+/// shapes. The cache is shared by all threads and evicts the least
+/// recently used entry when full.
+void work_size_cache_set_capacity( int64_t capacity );
+
+/// @return hit and miss counters and current size of the workspace size cache.
+WorkSizeCacheStats work_size_cache_stats();
+
+/// Removes all entries from the workspace size cache and resets counters.
+void work_size_cache_clear();
+
+}  // namespace lapack
+
+#endif  // LAPACK_WORKSPACE_HH
@@ -81,6 +81,150 @@ int64_t bbcsd(
     double* B22D,
     double* B22E );
 
+void bbcsd_work_size(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    float* theta,
+    float* phi,
+    float* U1, int64_t ldu1,
+    float* U2, int64_t ldu2,
+    float* V1T, int64_t ldv1t,
+    float* V2T, int64_t ldv2t,
+    float* B11D,
+    float* B11E,
+    float* B12D,
+    float* B12E,
+    float* B21D,
+    float* B21E,
+    float* B22D,
+    float* B22E,
+    int64_t* lwork );
+
+void bbcsd_work_size(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    double* theta,
+    double* phi,
+    double* U1, int64_t ldu1,
+    double* U2, int64_t ldu2,
+    double* V1T, int64_t ldv1t,
+    double* V2T, int64_t ldv2t,
+    double* B11D,
+    double* B11E,
+    double* B12D,
+    double* B12E,
+    double* B21D,
+    double* B21E,
+    double* B22D,
+    double* B22E,
+    int64_t* lwork );
+
+void bbcsd_work_size(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    float* theta,
+    float* phi,
+    std::complex<float>* U1, int64_t ldu1,
+    std::complex<float>* U2, int64_t ldu2,
+    std::complex<float>* V1T, int64_t ldv1t,
+    std::complex<float>* V2T, int64_t ldv2t,
+    float* B11D,
+    float* B11E,
+    float* B12D,
+    float* B12E,
+    float* B21D,
+    float* B21E,
+    float* B22D,
+    float* B22E,
+    int64_t* lrwork );
+
+void bbcsd_work_size(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    double* theta,
+    double* phi,
+    std::complex<double>* U1, int64_t ldu1,
+    std::complex<double>* U2, int64_t ldu2,
+    std::complex<double>* V1T, int64_t ldv1t,
+    std::complex<double>* V2T, int64_t ldv2t,
+    double* B11D,
+    double* B11E,
+    double* B12D,
+    double* B12E,
+    double* B21D,
+    double* B21E,
+    double* B22D,
+    double* B22E,
+    int64_t* lrwork );
+
+int64_t bbcsd(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    float* theta,
+    float* phi,
+    float* U1, int64_t ldu1,
+    float* U2, int64_t ldu2,
+    float* V1T, int64_t ldv1t,
+    float* V2T, int64_t ldv2t,
+    float* B11D,
+    float* B11E,
+    float* B12D,
+    float* B12E,
+    float* B21D,
+    float* B21E,
+    float* B22D,
+    float* B22E,
+    float* work, int64_t lwork );
+
+int64_t bbcsd(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    double* theta,
+    double* phi,
+    double* U1, int64_t ldu1,
+    double* U2, int64_t ldu2,
+    double* V1T, int64_t ldv1t,
+    double* V2T, int64_t ldv2t,
+    double* B11D,
+    double* B11E,
+    double* B12D,
+    double* B12E,
+    double* B21D,
+    double* B21E,
+    double* B22D,
+    double* B22E,
+    double* work, int64_t lwork );
+
+int64_t bbcsd(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    float* theta,
+    float* phi,
+    std::complex<float>* U1, int64_t ldu1,
+    std::complex<float>* U2, int64_t ldu2,
+    std::complex<float>* V1T, int64_t ldv1t,
+    std::complex<float>* V2T, int64_t ldv2t,
+    float* B11D,
+    float* B11E,
+    float* B12D,
+    float* B12E,
+    float* B21D,
+    float* B21E,
+    float* B22D,
+    float* B22E,
+    float* rwork, int64_t lrwork );
+
+int64_t bbcsd(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    double* theta,
+    double* phi,
+    std::complex<double>* U1, int64_t ldu1,
+    std::complex<double>* U2, int64_t ldu2,
+    std::complex<double>* V1T, int64_t ldv1t,
+    std::complex<double>* V2T, int64_t ldv2t,
+    double* B11D,
+    double* B11E,
+    double* B12D,
+    double* B12E,
+    double* B21D,
+    double* B21E,
+    double* B22D,
+    double* B22E,
+    double* rwork, int64_t lrwork );
+
 // -----------------------------------------------------------------------------
 int64_t bdsdc(
     lapack::Uplo uplo, lapack::Job compq, int64_t n,
@@ -602,6 +746,60 @@ int64_t gebrd(
     std::complex<float>* tauq,
     std::complex<float>* taup );
 
+void gebrd_work_size(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tauq,
+    float* taup,
+    int64_t* lwork );
+
+void gebrd_work_size(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tauq,
+    double* taup,
+    int64_t* lwork );
+
+void gebrd_work_size(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* D,
+    float* E,
+    std::complex<float>* tauq,
+    std::complex<float>* taup,
+    int64_t* lwork );
+
+int64_t gebrd(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tauq,
+    float* taup,
+    float* work, int64_t lwork );
+
+int64_t gebrd(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tauq,
+    double* taup,
+    double* work, int64_t lwork );
+
+int64_t gebrd(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* D,
+    float* E,
+    std::complex<float>* tauq,
+    std::complex<float>* taup,
+    std::complex<float>* work, int64_t lwork );
+
 int64_t gebrd(
     int64_t m, int64_t n,
     std::complex<double>* A, int64_t lda,
@@ -874,6 +1072,54 @@ int64_t gehrd(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* tau );
 
+void gehrd_work_size(
+    int64_t n, int64_t ilo, int64_t ihi,
+    float* A, int64_t lda,
+    float* tau,
+    int64_t* lwork );
+
+void gehrd_work_size(
+    int64_t n, int64_t ilo, int64_t ihi,
+    double* A, int64_t lda,
+    double* tau,
+    int64_t* lwork );
+
+void gehrd_work_size(
+    int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    int64_t* lwork );
+
+void gehrd_work_size(
+    int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    int64_t* lwork );
+
+int64_t gehrd(
+    int64_t n, int64_t ilo, int64_t ihi,
+    float* A, int64_t lda,
+    float* tau,
+    float* work, int64_t lwork );
+
+int64_t gehrd(
+    int64_t n, int64_t ilo, int64_t ihi,
+    double* A, int64_t lda,
+    double* tau,
+    double* work, int64_t lwork );
+
+int64_t gehrd(
+    int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t gehrd(
+    int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    std::complex<double>* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t gelq(
     int64_t m, int64_t n,
@@ -895,6 +1141,54 @@ int64_t gelq(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* T, int64_t tsize );
 
+void gelq_work_size(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* T, int64_t tsize,
+    int64_t* lwork );
+
+void gelq_work_size(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* T, int64_t tsize,
+    int64_t* lwork );
+
+void gelq_work_size(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* T, int64_t tsize,
+    int64_t* lwork );
+
+void gelq_work_size(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* T, int64_t tsize,
+    int64_t* lwork );
+
+int64_t gelq(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* T, int64_t tsize,
+    float* work, int64_t lwork );
+
+int64_t gelq(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* T, int64_t tsize,
+    double* work, int64_t lwork );
+
+int64_t gelq(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* T, int64_t tsize,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t gelq(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* T, int64_t tsize,
+    std::complex<double>* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t gelq2(
     int64_t m, int64_t n,
@@ -937,34 +1231,150 @@ int64_t gelqf(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* tau );
 
-// -----------------------------------------------------------------------------
-int64_t gels(
-    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+void gelqf_work_size(
+    int64_t m, int64_t n,
     float* A, int64_t lda,
-    float* B, int64_t ldb );
+    float* tau,
+    int64_t* lwork );
 
-int64_t gels(
-    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+void gelqf_work_size(
+    int64_t m, int64_t n,
     double* A, int64_t lda,
-    double* B, int64_t ldb );
+    double* tau,
+    int64_t* lwork );
 
-int64_t gels(
-    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+void gelqf_work_size(
+    int64_t m, int64_t n,
     std::complex<float>* A, int64_t lda,
-    std::complex<float>* B, int64_t ldb );
+    std::complex<float>* tau,
+    int64_t* lwork );
 
-int64_t gels(
-    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+void gelqf_work_size(
+    int64_t m, int64_t n,
     std::complex<double>* A, int64_t lda,
-    std::complex<double>* B, int64_t ldb );
+    std::complex<double>* tau,
+    int64_t* lwork );
 
-// -----------------------------------------------------------------------------
-int64_t gelsd(
-    int64_t m, int64_t n, int64_t nrhs,
+int64_t gelqf(
+    int64_t m, int64_t n,
     float* A, int64_t lda,
-    float* B, int64_t ldb,
-    float* S, float rcond,
-    int64_t* rank );
+    float* tau,
+    float* work, int64_t lwork );
+
+int64_t gelqf(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau,
+    double* work, int64_t lwork );
+
+int64_t gelqf(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t gelqf(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    std::complex<double>* work, int64_t lwork );
+
+int64_t gelqf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau );
+
+int64_t gelqf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau );
+
+int64_t gelqf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau );
+
+int64_t gelqf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau );
+
+// -----------------------------------------------------------------------------
+int64_t gels(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb );
+
+int64_t gels(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb );
+
+int64_t gels(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t gels(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb );
+
+void gels_work_size(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    int64_t* lwork );
+
+void gels_work_size(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    int64_t* lwork );
+
+void gels_work_size(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* lwork );
+
+void gels_work_size(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* lwork );
+
+int64_t gels(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* work, int64_t lwork );
+
+int64_t gels(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* work, int64_t lwork );
+
+int64_t gels(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t gels(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* work, int64_t lwork );
+
+// -----------------------------------------------------------------------------
+int64_t gelsd(
+    int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank );
 
 int64_t gelsd(
     int64_t m, int64_t n, int64_t nrhs,
@@ -987,6 +1397,76 @@ int64_t gelsd(
     double* S, double rcond,
     int64_t* rank );
 
+void gelsd_work_size(
+    int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank,
+    int64_t* lwork, int64_t* liwork );
+
+void gelsd_work_size(
+    int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    int64_t* lwork, int64_t* liwork );
+
+void gelsd_work_size(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork );
+
+void gelsd_work_size(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork );
+
+int64_t gelsd(
+    int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+int64_t gelsd(
+    int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+int64_t gelsd(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork );
+
+int64_t gelsd(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork );
+
 // -----------------------------------------------------------------------------
 int64_t gelss(
     int64_t m, int64_t n, int64_t nrhs,
@@ -1016,6 +1496,72 @@ int64_t gelss(
     double* S, double rcond,
     int64_t* rank );
 
+void gelss_work_size(
+    int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank,
+    int64_t* lwork );
+
+void gelss_work_size(
+    int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    int64_t* lwork );
+
+void gelss_work_size(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank,
+    int64_t* lwork, int64_t* lrwork );
+
+void gelss_work_size(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    int64_t* lwork, int64_t* lrwork );
+
+int64_t gelss(
+    int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank,
+    float* work, int64_t lwork );
+
+int64_t gelss(
+    int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    double* work, int64_t lwork );
+
+int64_t gelss(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork );
+
+int64_t gelss(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork );
+
 // -----------------------------------------------------------------------------
 int64_t gelsy(
     int64_t m, int64_t n, int64_t nrhs,
@@ -1045,6 +1591,72 @@ int64_t gelsy(
     int64_t* jpvt, double rcond,
     int64_t* rank );
 
+void gelsy_work_size(
+    int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    int64_t* jpvt, float rcond,
+    int64_t* rank,
+    int64_t* lwork );
+
+void gelsy_work_size(
+    int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    int64_t* jpvt, double rcond,
+    int64_t* rank,
+    int64_t* lwork );
+
+void gelsy_work_size(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* jpvt, float rcond,
+    int64_t* rank,
+    int64_t* lwork, int64_t* lrwork );
+
+void gelsy_work_size(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* jpvt, double rcond,
+    int64_t* rank,
+    int64_t* lwork, int64_t* lrwork );
+
+int64_t gelsy(
+    int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    int64_t* jpvt, float rcond,
+    int64_t* rank,
+    float* work, int64_t lwork );
+
+int64_t gelsy(
+    int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    int64_t* jpvt, double rcond,
+    int64_t* rank,
+    double* work, int64_t lwork );
+
+int64_t gelsy(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* jpvt, float rcond,
+    int64_t* rank,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork );
+
+int64_t gelsy(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* jpvt, double rcond,
+    int64_t* rank,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork );
+
 // -----------------------------------------------------------------------------
 int64_t gemlq(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
@@ -1162,43 +1774,149 @@ int64_t geqlf(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* tau );
 
-// -----------------------------------------------------------------------------
-int64_t geqp3(
+void geqlf_work_size(
     int64_t m, int64_t n,
     float* A, int64_t lda,
-    int64_t* jpvt,
-    float* tau );
+    float* tau,
+    int64_t* lwork );
 
-int64_t geqp3(
+void geqlf_work_size(
     int64_t m, int64_t n,
     double* A, int64_t lda,
-    int64_t* jpvt,
-    double* tau );
+    double* tau,
+    int64_t* lwork );
 
-int64_t geqp3(
+void geqlf_work_size(
     int64_t m, int64_t n,
     std::complex<float>* A, int64_t lda,
-    int64_t* jpvt,
-    std::complex<float>* tau );
+    std::complex<float>* tau,
+    int64_t* lwork );
 
-int64_t geqp3(
+void geqlf_work_size(
     int64_t m, int64_t n,
     std::complex<double>* A, int64_t lda,
-    int64_t* jpvt,
-    std::complex<double>* tau );
+    std::complex<double>* tau,
+    int64_t* lwork );
 
-// -----------------------------------------------------------------------------
-int64_t geqr(
+int64_t geqlf(
     int64_t m, int64_t n,
     float* A, int64_t lda,
-    float* T, int64_t tsize );
+    float* tau,
+    float* work, int64_t lwork );
 
-int64_t geqr(
+int64_t geqlf(
     int64_t m, int64_t n,
     double* A, int64_t lda,
-    double* T, int64_t tsize );
+    double* tau,
+    double* work, int64_t lwork );
 
-int64_t geqr(
+int64_t geqlf(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t geqlf(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    std::complex<double>* work, int64_t lwork );
+
+// -----------------------------------------------------------------------------
+int64_t geqp3(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    int64_t* jpvt,
+    float* tau );
+
+int64_t geqp3(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    int64_t* jpvt,
+    double* tau );
+
+int64_t geqp3(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* jpvt,
+    std::complex<float>* tau );
+
+int64_t geqp3(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* jpvt,
+    std::complex<double>* tau );
+
+void geqp3_work_size(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    int64_t* jpvt,
+    float* tau,
+    int64_t* lwork );
+
+void geqp3_work_size(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    int64_t* jpvt,
+    double* tau,
+    int64_t* lwork );
+
+void geqp3_work_size(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* jpvt,
+    std::complex<float>* tau,
+    int64_t* lwork, int64_t* lrwork );
+
+void geqp3_work_size(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* jpvt,
+    std::complex<double>* tau,
+    int64_t* lwork, int64_t* lrwork );
+
+int64_t geqp3(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    int64_t* jpvt,
+    float* tau,
+    float* work, int64_t lwork );
+
+int64_t geqp3(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    int64_t* jpvt,
+    double* tau,
+    double* work, int64_t lwork );
+
+int64_t geqp3(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* jpvt,
+    std::complex<float>* tau,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork );
+
+int64_t geqp3(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* jpvt,
+    std::complex<double>* tau,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork );
+
+// -----------------------------------------------------------------------------
+int64_t geqr(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* T, int64_t tsize );
+
+int64_t geqr(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* T, int64_t tsize );
+
+int64_t geqr(
     int64_t m, int64_t n,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* T, int64_t tsize );
@@ -1250,6 +1968,116 @@ int64_t geqrf(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* tau );
 
+void geqrf_work_size(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau,
+    int64_t* lwork );
+
+void geqrf_work_size(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau,
+    int64_t* lwork );
+
+void geqrf_work_size(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    int64_t* lwork );
+
+void geqrf_work_size(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    int64_t* lwork );
+
+int64_t geqrf(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau,
+    float* work, int64_t lwork );
+
+int64_t geqrf(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau,
+    double* work, int64_t lwork );
+
+int64_t geqrf(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t geqrf(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    std::complex<double>* work, int64_t lwork );
+
+int64_t geqrf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau );
+
+int64_t geqrf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau );
+
+int64_t geqrf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau );
+
+int64_t geqrf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau );
+
+// -----------------------------------------------------------------------------
+int64_t geqrf_delete_rows(
+    int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* W, int64_t ldw );
+
+int64_t geqrf_delete_rows(
+    int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* W, int64_t ldw );
+
+int64_t geqrf_delete_rows(
+    int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* W, int64_t ldw );
+
+int64_t geqrf_delete_rows(
+    int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* W, int64_t ldw );
+
+// -----------------------------------------------------------------------------
+int64_t geqrf_insert_rows(
+    int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* W, int64_t ldw );
+
+int64_t geqrf_insert_rows(
+    int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* W, int64_t ldw );
+
+int64_t geqrf_insert_rows(
+    int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* W, int64_t ldw );
+
+int64_t geqrf_insert_rows(
+    int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* W, int64_t ldw );
+
 // -----------------------------------------------------------------------------
 int64_t geqrfp(
     int64_t m, int64_t n,
@@ -1271,6 +2099,54 @@ int64_t geqrfp(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* tau );
 
+void geqrfp_work_size(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau,
+    int64_t* lwork );
+
+void geqrfp_work_size(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau,
+    int64_t* lwork );
+
+void geqrfp_work_size(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    int64_t* lwork );
+
+void geqrfp_work_size(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    int64_t* lwork );
+
+int64_t geqrfp(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau,
+    float* work, int64_t lwork );
+
+int64_t geqrfp(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau,
+    double* work, int64_t lwork );
+
+int64_t geqrfp(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t geqrfp(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    std::complex<double>* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t geqrt(
     int64_t m, int64_t n, int64_t nb,
@@ -1478,6 +2354,54 @@ int64_t gerqf(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* tau );
 
+void gerqf_work_size(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau,
+    int64_t* lwork );
+
+void gerqf_work_size(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau,
+    int64_t* lwork );
+
+void gerqf_work_size(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    int64_t* lwork );
+
+void gerqf_work_size(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    int64_t* lwork );
+
+int64_t gerqf(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau,
+    float* work, int64_t lwork );
+
+int64_t gerqf(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau,
+    double* work, int64_t lwork );
+
+int64_t gerqf(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t gerqf(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    std::complex<double>* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t gesdd(
     lapack::Job jobz, int64_t m, int64_t n,
@@ -1507,19 +2431,117 @@ int64_t gesdd(
     std::complex<double>* U, int64_t ldu,
     std::complex<double>* VT, int64_t ldvt );
 
-// -----------------------------------------------------------------------------
-int64_t gesv(
-    int64_t n, int64_t nrhs,
+void gesdd_work_size(
+    lapack::Job jobz, int64_t m, int64_t n,
     float* A, int64_t lda,
-    int64_t* ipiv,
-    float* B, int64_t ldb );
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt,
+    int64_t* lwork, int64_t* liwork );
 
-int64_t gesv(
-    int64_t n, int64_t nrhs,
+void gesdd_work_size(
+    lapack::Job jobz, int64_t m, int64_t n,
     double* A, int64_t lda,
-    int64_t* ipiv,
-    double* B, int64_t ldb );
-
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt,
+    int64_t* lwork, int64_t* liwork );
+
+void gesdd_work_size(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork );
+
+void gesdd_work_size(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork );
+
+int64_t gesdd(
+    lapack::Job jobz, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+int64_t gesdd(
+    lapack::Job jobz, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+int64_t gesdd(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork );
+
+int64_t gesdd(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork );
+
+int64_t gesdd(
+    lapack::Layout layout, lapack::Job jobz, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt );
+
+int64_t gesdd(
+    lapack::Layout layout, lapack::Job jobz, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt );
+
+int64_t gesdd(
+    lapack::Layout layout, lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt );
+
+int64_t gesdd(
+    lapack::Layout layout, lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt );
+
+// -----------------------------------------------------------------------------
+int64_t gesv(
+    int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    float* B, int64_t ldb );
+
+int64_t gesv(
+    int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double* B, int64_t ldb );
+
 int64_t gesv(
     int64_t n, int64_t nrhs,
     std::complex<float>* A, int64_t lda,
@@ -1548,6 +2570,30 @@ int64_t gesv(
     std::complex<double>* X, int64_t ldx,
     int64_t* iter );
 
+int64_t gesv(
+    lapack::Layout layout, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    float* B, int64_t ldb );
+
+int64_t gesv(
+    lapack::Layout layout, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double* B, int64_t ldb );
+
+int64_t gesv(
+    lapack::Layout layout, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t gesv(
+    lapack::Layout layout, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
 // -----------------------------------------------------------------------------
 int64_t gesvx(
     lapack::Factored fact, lapack::Op trans, int64_t n, int64_t nrhs,
@@ -1638,6 +2684,104 @@ int64_t gesvd(
     std::complex<double>* U, int64_t ldu,
     std::complex<double>* VT, int64_t ldvt );
 
+void gesvd_work_size(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt,
+    int64_t* lwork );
+
+void gesvd_work_size(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt,
+    int64_t* lwork );
+
+void gesvd_work_size(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt,
+    int64_t* lwork, int64_t* lrwork );
+
+void gesvd_work_size(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt,
+    int64_t* lwork, int64_t* lrwork );
+
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt,
+    float* work, int64_t lwork );
+
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt,
+    double* work, int64_t lwork );
+
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork );
+
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork );
+
+int64_t gesvd(
+    lapack::Layout layout, lapack::Job jobu, lapack::Job jobvt,
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt );
+
+int64_t gesvd(
+    lapack::Layout layout, lapack::Job jobu, lapack::Job jobvt,
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt );
+
+int64_t gesvd(
+    lapack::Layout layout, lapack::Job jobu, lapack::Job jobvt,
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt );
+
+int64_t gesvd(
+    lapack::Layout layout, lapack::Job jobu, lapack::Job jobvt,
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt );
+
 // -----------------------------------------------------------------------------
 int64_t gesvdx(
     lapack::Job jobu, lapack::Job jobvt, lapack::Range range, int64_t m, int64_t n,
@@ -1713,6 +2857,52 @@ int64_t getrf(
     std::complex<double>* A, int64_t lda,
     int64_t* ipiv );
 
+int64_t getrf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    int64_t* ipiv );
+
+int64_t getrf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    int64_t* ipiv );
+
+int64_t getrf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv );
+
+int64_t getrf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv );
+
+// -----------------------------------------------------------------------------
+int64_t getrf_native(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    int64_t* ipiv, int64_t nb=256, int64_t lookahead=1 );
+
+int64_t getrf_native(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    int64_t* ipiv, int64_t nb=256, int64_t lookahead=1 );
+
+int64_t getrf_native(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv, int64_t nb=256, int64_t lookahead=1 );
+
+int64_t getrf_native(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv, int64_t nb=256, int64_t lookahead=1 );
+
+void getrf_set_method(
+    lapack::MethodLU method, int64_t nb=256, int64_t lookahead=1 );
+
+lapack::MethodLU getrf_method();
+
 // -----------------------------------------------------------------------------
 int64_t getrf2(
     int64_t m, int64_t n,
@@ -1755,6 +2945,54 @@ int64_t getri(
     std::complex<double>* A, int64_t lda,
     int64_t const* ipiv );
 
+void getri_work_size(
+    int64_t n,
+    float* A, int64_t lda,
+    int64_t const* ipiv,
+    int64_t* lwork );
+
+void getri_work_size(
+    int64_t n,
+    double* A, int64_t lda,
+    int64_t const* ipiv,
+    int64_t* lwork );
+
+void getri_work_size(
+    int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t const* ipiv,
+    int64_t* lwork );
+
+void getri_work_size(
+    int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t const* ipiv,
+    int64_t* lwork );
+
+int64_t getri(
+    int64_t n,
+    float* A, int64_t lda,
+    int64_t const* ipiv,
+    float* work, int64_t lwork );
+
+int64_t getri(
+    int64_t n,
+    double* A, int64_t lda,
+    int64_t const* ipiv,
+    double* work, int64_t lwork );
+
+int64_t getri(
+    int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t const* ipiv,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t getri(
+    int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t const* ipiv,
+    std::complex<double>* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t getrs(
     lapack::Op trans, int64_t n, int64_t nrhs,
@@ -1780,13 +3018,37 @@ int64_t getrs(
     int64_t const* ipiv,
     std::complex<double>* B, int64_t ldb );
 
-// -----------------------------------------------------------------------------
-int64_t getsls(
-    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
-    float* A, int64_t lda,
+int64_t getrs(
+    lapack::Layout layout, lapack::Op trans, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    int64_t const* ipiv,
     float* B, int64_t ldb );
 
-int64_t getsls(
+int64_t getrs(
+    lapack::Layout layout, lapack::Op trans, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    int64_t const* ipiv,
+    double* B, int64_t ldb );
+
+int64_t getrs(
+    lapack::Layout layout, lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    int64_t const* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t getrs(
+    lapack::Layout layout, lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    int64_t const* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
+// -----------------------------------------------------------------------------
+int64_t getsls(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb );
+
+int64_t getsls(
     lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
     double* A, int64_t lda,
     double* B, int64_t ldb );
@@ -2101,6 +3363,78 @@ int64_t ggglm(
     std::complex<double>* X,
     std::complex<double>* Y );
 
+void ggglm_work_size(
+    int64_t n, int64_t m, int64_t p,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* D,
+    float* X,
+    float* Y,
+    int64_t* lwork );
+
+void ggglm_work_size(
+    int64_t n, int64_t m, int64_t p,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* D,
+    double* X,
+    double* Y,
+    int64_t* lwork );
+
+void ggglm_work_size(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* D,
+    std::complex<float>* X,
+    std::complex<float>* Y,
+    int64_t* lwork );
+
+void ggglm_work_size(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* D,
+    std::complex<double>* X,
+    std::complex<double>* Y,
+    int64_t* lwork );
+
+int64_t ggglm(
+    int64_t n, int64_t m, int64_t p,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* D,
+    float* X,
+    float* Y,
+    float* work, int64_t lwork );
+
+int64_t ggglm(
+    int64_t n, int64_t m, int64_t p,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* D,
+    double* X,
+    double* Y,
+    double* work, int64_t lwork );
+
+int64_t ggglm(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* D,
+    std::complex<float>* X,
+    std::complex<float>* Y,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t ggglm(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* D,
+    std::complex<double>* X,
+    std::complex<double>* Y,
+    std::complex<double>* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t gghrd(
     lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
@@ -2163,6 +3497,78 @@ int64_t gglse(
     std::complex<double>* D,
     std::complex<double>* X );
 
+void gglse_work_size(
+    int64_t m, int64_t n, int64_t p,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* C,
+    float* D,
+    float* X,
+    int64_t* lwork );
+
+void gglse_work_size(
+    int64_t m, int64_t n, int64_t p,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* C,
+    double* D,
+    double* X,
+    int64_t* lwork );
+
+void gglse_work_size(
+    int64_t m, int64_t n, int64_t p,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* C,
+    std::complex<float>* D,
+    std::complex<float>* X,
+    int64_t* lwork );
+
+void gglse_work_size(
+    int64_t m, int64_t n, int64_t p,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* C,
+    std::complex<double>* D,
+    std::complex<double>* X,
+    int64_t* lwork );
+
+int64_t gglse(
+    int64_t m, int64_t n, int64_t p,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* C,
+    float* D,
+    float* X,
+    float* work, int64_t lwork );
+
+int64_t gglse(
+    int64_t m, int64_t n, int64_t p,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* C,
+    double* D,
+    double* X,
+    double* work, int64_t lwork );
+
+int64_t gglse(
+    int64_t m, int64_t n, int64_t p,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* C,
+    std::complex<float>* D,
+    std::complex<float>* X,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t gglse(
+    int64_t m, int64_t n, int64_t p,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* C,
+    std::complex<double>* D,
+    std::complex<double>* X,
+    std::complex<double>* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t ggqrf(
     int64_t n, int64_t m, int64_t p,
@@ -2192,6 +3598,70 @@ int64_t ggqrf(
     std::complex<double>* B, int64_t ldb,
     std::complex<double>* taub );
 
+void ggqrf_work_size(
+    int64_t n, int64_t m, int64_t p,
+    float* A, int64_t lda,
+    float* taua,
+    float* B, int64_t ldb,
+    float* taub,
+    int64_t* lwork );
+
+void ggqrf_work_size(
+    int64_t n, int64_t m, int64_t p,
+    double* A, int64_t lda,
+    double* taua,
+    double* B, int64_t ldb,
+    double* taub,
+    int64_t* lwork );
+
+void ggqrf_work_size(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* taua,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* taub,
+    int64_t* lwork );
+
+void ggqrf_work_size(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* taua,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* taub,
+    int64_t* lwork );
+
+int64_t ggqrf(
+    int64_t n, int64_t m, int64_t p,
+    float* A, int64_t lda,
+    float* taua,
+    float* B, int64_t ldb,
+    float* taub,
+    float* work, int64_t lwork );
+
+int64_t ggqrf(
+    int64_t n, int64_t m, int64_t p,
+    double* A, int64_t lda,
+    double* taua,
+    double* B, int64_t ldb,
+    double* taub,
+    double* work, int64_t lwork );
+
+int64_t ggqrf(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* taua,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* taub,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t ggqrf(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* taua,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* taub,
+    std::complex<double>* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t ggrqf(
     int64_t m, int64_t p, int64_t n,
@@ -2221,6 +3691,70 @@ int64_t ggrqf(
     std::complex<double>* B, int64_t ldb,
     std::complex<double>* taub );
 
+void ggrqf_work_size(
+    int64_t m, int64_t p, int64_t n,
+    float* A, int64_t lda,
+    float* taua,
+    float* B, int64_t ldb,
+    float* taub,
+    int64_t* lwork );
+
+void ggrqf_work_size(
+    int64_t m, int64_t p, int64_t n,
+    double* A, int64_t lda,
+    double* taua,
+    double* B, int64_t ldb,
+    double* taub,
+    int64_t* lwork );
+
+void ggrqf_work_size(
+    int64_t m, int64_t p, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* taua,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* taub,
+    int64_t* lwork );
+
+void ggrqf_work_size(
+    int64_t m, int64_t p, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* taua,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* taub,
+    int64_t* lwork );
+
+int64_t ggrqf(
+    int64_t m, int64_t p, int64_t n,
+    float* A, int64_t lda,
+    float* taua,
+    float* B, int64_t ldb,
+    float* taub,
+    float* work, int64_t lwork );
+
+int64_t ggrqf(
+    int64_t m, int64_t p, int64_t n,
+    double* A, int64_t lda,
+    double* taua,
+    double* B, int64_t ldb,
+    double* taub,
+    double* work, int64_t lwork );
+
+int64_t ggrqf(
+    int64_t m, int64_t p, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* taua,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* taub,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t ggrqf(
+    int64_t m, int64_t p, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* taua,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* taub,
+    std::complex<double>* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t ggsvd3(
     lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
@@ -2270,43 +3804,153 @@ int64_t ggsvd3(
     std::complex<double>* V, int64_t ldv,
     std::complex<double>* Q, int64_t ldq );
 
-// -----------------------------------------------------------------------------
-int64_t ggsvp3(
-    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
-    float* A, int64_t lda,
-    float* B, int64_t ldb, float tola, float tolb,
+void ggsvd3_work_size(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
     int64_t* k,
     int64_t* l,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* alpha,
+    float* beta,
     float* U, int64_t ldu,
     float* V, int64_t ldv,
     float* Q, int64_t ldq,
-    float* tau );
+    int64_t* lwork, int64_t* liwork );
 
-int64_t ggsvp3(
-    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
-    double* A, int64_t lda,
-    double* B, int64_t ldb, double tola, double tolb,
+void ggsvd3_work_size(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
     int64_t* k,
     int64_t* l,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* alpha,
+    double* beta,
     double* U, int64_t ldu,
     double* V, int64_t ldv,
     double* Q, int64_t ldq,
-    double* tau );
+    int64_t* lwork, int64_t* liwork );
 
-int64_t ggsvp3(
-    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
-    std::complex<float>* A, int64_t lda,
-    std::complex<float>* B, int64_t ldb, float tola, float tolb,
+void ggsvd3_work_size(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
     int64_t* k,
     int64_t* l,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* alpha,
+    float* beta,
     std::complex<float>* U, int64_t ldu,
     std::complex<float>* V, int64_t ldv,
     std::complex<float>* Q, int64_t ldq,
-    std::complex<float>* tau );
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork );
 
-int64_t ggsvp3(
-    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
-    std::complex<double>* A, int64_t lda,
+void ggsvd3_work_size(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* alpha,
+    double* beta,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* V, int64_t ldv,
+    std::complex<double>* Q, int64_t ldq,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork );
+
+int64_t ggsvd3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* alpha,
+    float* beta,
+    float* U, int64_t ldu,
+    float* V, int64_t ldv,
+    float* Q, int64_t ldq,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+int64_t ggsvd3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* alpha,
+    double* beta,
+    double* U, int64_t ldu,
+    double* V, int64_t ldv,
+    double* Q, int64_t ldq,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+int64_t ggsvd3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* alpha,
+    float* beta,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* V, int64_t ldv,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork );
+
+int64_t ggsvd3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* alpha,
+    double* beta,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* V, int64_t ldv,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork );
+
+// -----------------------------------------------------------------------------
+int64_t ggsvp3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb, float tola, float tolb,
+    int64_t* k,
+    int64_t* l,
+    float* U, int64_t ldu,
+    float* V, int64_t ldv,
+    float* Q, int64_t ldq,
+    float* tau );
+
+int64_t ggsvp3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb, double tola, double tolb,
+    int64_t* k,
+    int64_t* l,
+    double* U, int64_t ldu,
+    double* V, int64_t ldv,
+    double* Q, int64_t ldq,
+    double* tau );
+
+int64_t ggsvp3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb, float tola, float tolb,
+    int64_t* k,
+    int64_t* l,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* V, int64_t ldv,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* tau );
+
+int64_t ggsvp3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    std::complex<double>* A, int64_t lda,
     std::complex<double>* B, int64_t ldb, double tola, double tolb,
     int64_t* k,
     int64_t* l,
@@ -2315,6 +3959,108 @@ int64_t ggsvp3(
     std::complex<double>* Q, int64_t ldq,
     std::complex<double>* tau );
 
+void ggsvp3_work_size(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb, float tola, float tolb,
+    int64_t* k,
+    int64_t* l,
+    float* U, int64_t ldu,
+    float* V, int64_t ldv,
+    float* Q, int64_t ldq,
+    float* tau,
+    int64_t* liwork, int64_t* lwork );
+
+void ggsvp3_work_size(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb, double tola, double tolb,
+    int64_t* k,
+    int64_t* l,
+    double* U, int64_t ldu,
+    double* V, int64_t ldv,
+    double* Q, int64_t ldq,
+    double* tau,
+    int64_t* liwork, int64_t* lwork );
+
+void ggsvp3_work_size(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb, float tola, float tolb,
+    int64_t* k,
+    int64_t* l,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* V, int64_t ldv,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* tau,
+    int64_t* liwork, int64_t* lrwork, int64_t* lwork );
+
+void ggsvp3_work_size(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb, double tola, double tolb,
+    int64_t* k,
+    int64_t* l,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* V, int64_t ldv,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* tau,
+    int64_t* liwork, int64_t* lrwork, int64_t* lwork );
+
+int64_t ggsvp3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb, float tola, float tolb,
+    int64_t* k,
+    int64_t* l,
+    float* U, int64_t ldu,
+    float* V, int64_t ldv,
+    float* Q, int64_t ldq,
+    float* tau,
+    int64_t* iwork, int64_t liwork,
+    float* work, int64_t lwork );
+
+int64_t ggsvp3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb, double tola, double tolb,
+    int64_t* k,
+    int64_t* l,
+    double* U, int64_t ldu,
+    double* V, int64_t ldv,
+    double* Q, int64_t ldq,
+    double* tau,
+    int64_t* iwork, int64_t liwork,
+    double* work, int64_t lwork );
+
+int64_t ggsvp3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb, float tola, float tolb,
+    int64_t* k,
+    int64_t* l,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* V, int64_t ldv,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* tau,
+    int64_t* iwork, int64_t liwork,
+    float* rwork, int64_t lrwork,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t ggsvp3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb, double tola, double tolb,
+    int64_t* k,
+    int64_t* l,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* V, int64_t ldv,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* tau,
+    int64_t* iwork, int64_t liwork,
+    double* rwork, int64_t lrwork,
+    std::complex<double>* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t gtcon(
     lapack::Norm norm, int64_t n,
@@ -2603,6 +4349,36 @@ int64_t hbev_2stage(
     double* W,
     std::complex<double>* Z, int64_t ldz );
 
+void hbev_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* lwork, int64_t* lrwork );
+
+void hbev_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* lwork, int64_t* lrwork );
+
+int64_t hbev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork );
+
+int64_t hbev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork );
+
 // -----------------------------------------------------------------------------
 int64_t hbevd(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
@@ -2616,6 +4392,38 @@ int64_t hbevd(
     double* W,
     std::complex<double>* Z, int64_t ldz );
 
+void hbevd_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork );
+
+void hbevd_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork );
+
+int64_t hbevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork );
+
+int64_t hbevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork );
+
 // -----------------------------------------------------------------------------
 int64_t hbevd_2stage(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
@@ -2629,6 +4437,38 @@ int64_t hbevd_2stage(
     double* W,
     std::complex<double>* Z, int64_t ldz );
 
+void hbevd_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork );
+
+void hbevd_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork );
+
+int64_t hbevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork );
+
+int64_t hbevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork );
+
 // -----------------------------------------------------------------------------
 int64_t hbevx(
     lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
@@ -2667,12 +4507,56 @@ int64_t hbevx_2stage(
     std::complex<double>* Z, int64_t ldz,
     int64_t* ifail );
 
-// -----------------------------------------------------------------------------
-int64_t hbgst(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+void hbevx_2stage_work_size(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
     std::complex<float>* AB, int64_t ldab,
-    std::complex<float> const* BB, int64_t ldbb,
-    std::complex<float>* X, int64_t ldx );
+    std::complex<float>* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifail,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork );
+
+void hbevx_2stage_work_size(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    std::complex<double>* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifail,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork );
+
+int64_t hbevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    std::complex<float>* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifail,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork );
+
+int64_t hbevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    std::complex<double>* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifail,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork );
+
+// -----------------------------------------------------------------------------
+int64_t hbgst(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    std::complex<float>* AB, int64_t ldab,
+    std::complex<float> const* BB, int64_t ldbb,
+    std::complex<float>* X, int64_t ldx );
 
 int64_t hbgst(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
@@ -2710,6 +4594,42 @@ int64_t hbgvd(
     double* W,
     std::complex<double>* Z, int64_t ldz );
 
+void hbgvd_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    std::complex<float>* AB, int64_t ldab,
+    std::complex<float>* BB, int64_t ldbb,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork );
+
+void hbgvd_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    std::complex<double>* AB, int64_t ldab,
+    std::complex<double>* BB, int64_t ldbb,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork );
+
+int64_t hbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    std::complex<float>* AB, int64_t ldab,
+    std::complex<float>* BB, int64_t ldbb,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork );
+
+int64_t hbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    std::complex<double>* AB, int64_t ldab,
+    std::complex<double>* BB, int64_t ldbb,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork );
+
 // -----------------------------------------------------------------------------
 int64_t hbgvx(
     lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
@@ -2801,6 +4721,32 @@ int64_t heev(
     std::complex<double>* A, int64_t lda,
     double* W );
 
+void heev_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W,
+    int64_t* lwork, int64_t* lrwork );
+
+void heev_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W,
+    int64_t* lwork, int64_t* lrwork );
+
+int64_t heev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork );
+
+int64_t heev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork );
+
 // -----------------------------------------------------------------------------
 int64_t heev_2stage(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
@@ -2812,6 +4758,32 @@ int64_t heev_2stage(
     std::complex<double>* A, int64_t lda,
     double* W );
 
+void heev_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W,
+    int64_t* lwork, int64_t* lrwork );
+
+void heev_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W,
+    int64_t* lwork, int64_t* lrwork );
+
+int64_t heev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork );
+
+int64_t heev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork );
+
 // -----------------------------------------------------------------------------
 int64_t heevd(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
@@ -2823,6 +4795,34 @@ int64_t heevd(
     std::complex<double>* A, int64_t lda,
     double* W );
 
+void heevd_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork );
+
+void heevd_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork );
+
+int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork );
+
+int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork );
+
 // -----------------------------------------------------------------------------
 int64_t heevd_2stage(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
@@ -2834,6 +4834,34 @@ int64_t heevd_2stage(
     std::complex<double>* A, int64_t lda,
     double* W );
 
+void heevd_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork );
+
+void heevd_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork );
+
+int64_t heevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork );
+
+int64_t heevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork );
+
 // -----------------------------------------------------------------------------
 int64_t heevr(
     lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
@@ -2851,6 +4879,46 @@ int64_t heevr(
     std::complex<double>* Z, int64_t ldz,
     int64_t* isuppz );
 
+void heevr_work_size(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* isuppz,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork );
+
+void heevr_work_size(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* isuppz,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork );
+
+int64_t heevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* isuppz,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork );
+
+int64_t heevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* isuppz,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork );
+
 // -----------------------------------------------------------------------------
 int64_t heevr_2stage(
     lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
@@ -2868,6 +4936,46 @@ int64_t heevr_2stage(
     std::complex<double>* Z, int64_t ldz,
     int64_t* isuppz );
 
+void heevr_2stage_work_size(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* isuppz,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork );
+
+void heevr_2stage_work_size(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* isuppz,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork );
+
+int64_t heevr_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* isuppz,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork );
+
+int64_t heevr_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* isuppz,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork );
+
 // -----------------------------------------------------------------------------
 int64_t heevx(
     lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
@@ -2885,6 +4993,46 @@ int64_t heevx(
     std::complex<double>* Z, int64_t ldz,
     int64_t* ifail );
 
+void heevx_work_size(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifail,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork );
+
+void heevx_work_size(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifail,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork );
+
+int64_t heevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifail,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork );
+
+int64_t heevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifail,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork );
+
 // -----------------------------------------------------------------------------
 int64_t heevx_2stage(
     lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
@@ -2902,6 +5050,46 @@ int64_t heevx_2stage(
     std::complex<double>* Z, int64_t ldz,
     int64_t* ifail );
 
+void heevx_2stage_work_size(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifail,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork );
+
+void heevx_2stage_work_size(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifail,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork );
+
+int64_t heevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifail,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork );
+
+int64_t heevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifail,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork );
+
 // -----------------------------------------------------------------------------
 int64_t hegst(
     int64_t itype, lapack::Uplo uplo, int64_t n,
@@ -2926,31 +5114,123 @@ int64_t hegv(
     std::complex<double>* B, int64_t ldb,
     double* W );
 
-// -----------------------------------------------------------------------------
-int64_t hegv_2stage(
+void hegv_work_size(
     int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb,
-    float* W );
+    float* W,
+    int64_t* lwork, int64_t* lrwork );
 
-int64_t hegv_2stage(
+void hegv_work_size(
     int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda,
     std::complex<double>* B, int64_t ldb,
-    double* W );
+    double* W,
+    int64_t* lwork, int64_t* lrwork );
 
-// -----------------------------------------------------------------------------
-int64_t hegvd(
+int64_t hegv(
     int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb,
-    float* W );
+    float* W,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork );
 
-int64_t hegvd(
+int64_t hegv(
     int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda,
     std::complex<double>* B, int64_t ldb,
-    double* W );
+    double* W,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork );
+
+// -----------------------------------------------------------------------------
+int64_t hegv_2stage(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* W );
+
+int64_t hegv_2stage(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* W );
+
+void hegv_2stage_work_size(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* W,
+    int64_t* lwork, int64_t* lrwork );
+
+void hegv_2stage_work_size(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* W,
+    int64_t* lwork, int64_t* lrwork );
+
+int64_t hegv_2stage(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* W,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork );
+
+int64_t hegv_2stage(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* W,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork );
+
+// -----------------------------------------------------------------------------
+int64_t hegvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* W );
+
+int64_t hegvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* W );
+
+void hegvd_work_size(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* W,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork );
+
+void hegvd_work_size(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* W,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork );
+
+int64_t hegvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* W,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork );
+
+int64_t hegvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* W,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork );
 
 // -----------------------------------------------------------------------------
 int64_t hegvx(
@@ -2971,6 +5251,50 @@ int64_t hegvx(
     std::complex<double>* Z, int64_t ldz,
     int64_t* ifail );
 
+void hegvx_work_size(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifail,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork );
+
+void hegvx_work_size(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifail,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork );
+
+int64_t hegvx(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifail,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork );
+
+int64_t hegvx(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifail,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork );
+
 // -----------------------------------------------------------------------------
 int64_t herfs(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
@@ -3034,6 +5358,34 @@ int64_t hesv(
     int64_t* ipiv,
     std::complex<double>* B, int64_t ldb );
 
+void hesv_work_size(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* lwork );
+
+void hesv_work_size(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* lwork );
+
+int64_t hesv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t hesv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t hesvx(
     lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
@@ -3057,6 +5409,56 @@ int64_t hesvx(
     double* ferr,
     double* berr );
 
+void hesvx_work_size(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float>* AF, int64_t ldaf,
+    int64_t* ipiv,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr,
+    int64_t* lwork, int64_t* lrwork );
+
+void hesvx_work_size(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double>* AF, int64_t ldaf,
+    int64_t* ipiv,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr,
+    int64_t* lwork, int64_t* lrwork );
+
+int64_t hesvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float>* AF, int64_t ldaf,
+    int64_t* ipiv,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork );
+
+int64_t hesvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double>* AF, int64_t ldaf,
+    int64_t* ipiv,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork );
+
 // -----------------------------------------------------------------------------
 int64_t hesv_aa(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
@@ -3070,6 +5472,34 @@ int64_t hesv_aa(
     int64_t* ipiv,
     std::complex<double>* B, int64_t ldb );
 
+void hesv_aa_work_size(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* lwork );
+
+void hesv_aa_work_size(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* lwork );
+
+int64_t hesv_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t hesv_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t hesv_rk(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
@@ -3085,6 +5515,38 @@ int64_t hesv_rk(
     int64_t* ipiv,
     std::complex<double>* B, int64_t ldb );
 
+void hesv_rk_work_size(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* E,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* lwork );
+
+void hesv_rk_work_size(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* E,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* lwork );
+
+int64_t hesv_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* E,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t hesv_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* E,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t hesv_rook(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
@@ -3098,6 +5560,34 @@ int64_t hesv_rook(
     int64_t* ipiv,
     std::complex<double>* B, int64_t ldb );
 
+void hesv_rook_work_size(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* lwork );
+
+void hesv_rook_work_size(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* lwork );
+
+int64_t hesv_rook(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t hesv_rook(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 void heswapr(
     lapack::Uplo uplo, int64_t n,
@@ -3122,33 +5612,125 @@ int64_t hetrd(
     double* E,
     std::complex<double>* tau );
 
-// -----------------------------------------------------------------------------
-int64_t hetrd_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+void hetrd_work_size(
+    lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda,
     float* D,
     float* E,
     std::complex<float>* tau,
-    std::complex<float>* hous2, int64_t lhous2 );
+    int64_t* lwork );
 
-int64_t hetrd_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+void hetrd_work_size(
+    lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda,
     double* D,
     double* E,
     std::complex<double>* tau,
-    std::complex<double>* hous2, int64_t lhous2 );
+    int64_t* lwork );
 
-// -----------------------------------------------------------------------------
-int64_t hetrf(
+int64_t hetrd(
     lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda,
-    int64_t* ipiv );
+    float* D,
+    float* E,
+    std::complex<float>* tau,
+    std::complex<float>* work, int64_t lwork );
 
-int64_t hetrf(
+int64_t hetrd(
     lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda,
-    int64_t* ipiv );
+    double* D,
+    double* E,
+    std::complex<double>* tau,
+    std::complex<double>* work, int64_t lwork );
+
+// -----------------------------------------------------------------------------
+int64_t hetrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* D,
+    float* E,
+    std::complex<float>* tau,
+    std::complex<float>* hous2, int64_t lhous2 );
+
+int64_t hetrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* D,
+    double* E,
+    std::complex<double>* tau,
+    std::complex<double>* hous2, int64_t lhous2 );
+
+void hetrd_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* D,
+    float* E,
+    std::complex<float>* tau,
+    std::complex<float>* hous2, int64_t lhous2,
+    int64_t* lwork );
+
+void hetrd_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* D,
+    double* E,
+    std::complex<double>* tau,
+    std::complex<double>* hous2, int64_t lhous2,
+    int64_t* lwork );
+
+int64_t hetrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* D,
+    float* E,
+    std::complex<float>* tau,
+    std::complex<float>* hous2, int64_t lhous2,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t hetrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* D,
+    double* E,
+    std::complex<double>* tau,
+    std::complex<double>* hous2, int64_t lhous2,
+    std::complex<double>* work, int64_t lwork );
+
+// -----------------------------------------------------------------------------
+int64_t hetrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv );
+
+int64_t hetrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv );
+
+void hetrf_work_size(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    int64_t* lwork );
+
+void hetrf_work_size(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    int64_t* lwork );
+
+int64_t hetrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t hetrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* work, int64_t lwork );
 
 // -----------------------------------------------------------------------------
 int64_t hetrf_aa(
@@ -3161,6 +5743,30 @@ int64_t hetrf_aa(
     std::complex<double>* A, int64_t lda,
     int64_t* ipiv );
 
+void hetrf_aa_work_size(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    int64_t* lwork );
+
+void hetrf_aa_work_size(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    int64_t* lwork );
+
+int64_t hetrf_aa(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t hetrf_aa(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t hetrf_rk(
     lapack::Uplo uplo, int64_t n,
@@ -3174,6 +5780,34 @@ int64_t hetrf_rk(
     std::complex<double>* E,
     int64_t* ipiv );
 
+void hetrf_rk_work_size(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* E,
+    int64_t* ipiv,
+    int64_t* lwork );
+
+void hetrf_rk_work_size(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* E,
+    int64_t* ipiv,
+    int64_t* lwork );
+
+int64_t hetrf_rk(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* E,
+    int64_t* ipiv,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t hetrf_rk(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* E,
+    int64_t* ipiv,
+    std::complex<double>* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t hetrf_rook(
     lapack::Uplo uplo, int64_t n,
@@ -3185,6 +5819,30 @@ int64_t hetrf_rook(
     std::complex<double>* A, int64_t lda,
     int64_t* ipiv );
 
+void hetrf_rook_work_size(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    int64_t* lwork );
+
+void hetrf_rook_work_size(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    int64_t* lwork );
+
+int64_t hetrf_rook(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t hetrf_rook(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t hetri(
     lapack::Uplo uplo, int64_t n,
@@ -3207,6 +5865,30 @@ int64_t hetri2(
     std::complex<double>* A, int64_t lda,
     int64_t const* ipiv );
 
+void hetri2_work_size(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t const* ipiv,
+    int64_t* lwork );
+
+void hetri2_work_size(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t const* ipiv,
+    int64_t* lwork );
+
+int64_t hetri2(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t const* ipiv,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t hetri2(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t const* ipiv,
+    std::complex<double>* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 // hetri_rk wraps hetri_3
 int64_t hetri_rk(
@@ -3221,6 +5903,34 @@ int64_t hetri_rk(
     std::complex<double> const* E,
     int64_t const* ipiv );
 
+void hetri_rk_work_size(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* E,
+    int64_t const* ipiv,
+    int64_t* lwork );
+
+void hetri_rk_work_size(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* E,
+    int64_t const* ipiv,
+    int64_t* lwork );
+
+int64_t hetri_rk(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* E,
+    int64_t const* ipiv,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t hetri_rk(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* E,
+    int64_t const* ipiv,
+    std::complex<double>* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t hetrs(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
@@ -3376,6 +6086,38 @@ int64_t hpevd(
     double* W,
     std::complex<double>* Z, int64_t ldz );
 
+void hpevd_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* AP,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork );
+
+void hpevd_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* AP,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork );
+
+int64_t hpevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* AP,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork );
+
+int64_t hpevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* AP,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork );
+
 // -----------------------------------------------------------------------------
 int64_t hpevx(
     lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
@@ -3434,6 +6176,42 @@ int64_t hpgvd(
     double* W,
     std::complex<double>* Z, int64_t ldz );
 
+void hpgvd_work_size(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* AP,
+    std::complex<float>* BP,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork );
+
+void hpgvd_work_size(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* AP,
+    std::complex<double>* BP,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork );
+
+int64_t hpgvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* AP,
+    std::complex<float>* BP,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork );
+
+int64_t hpgvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* AP,
+    std::complex<double>* BP,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork );
+
 // -----------------------------------------------------------------------------
 int64_t hpgvx(
     int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
@@ -4612,28 +7390,128 @@ inline int64_t uncsd2by1(
     return orcsd2by1( jobu1, jobu2, jobv1t, m, p, q, X11, ldx11, X21, ldx21, theta, U1, ldu1, U2, ldu2, V1T, ldv1t );
 }
 
-// -----------------------------------------------------------------------------
-int64_t orgbr(
-    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
-    float* A, int64_t lda,
-    float const* tau );
+void orcsd2by1_work_size(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
+    float* X11, int64_t ldx11,
+    float* X21, int64_t ldx21,
+    float* theta,
+    float* U1, int64_t ldu1,
+    float* U2, int64_t ldu2,
+    float* V1T, int64_t ldv1t,
+    int64_t* lwork, int64_t* liwork );
 
-// ungbr alias to orgbr
-inline int64_t ungbr(
-    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
-    float* A, int64_t lda,
-    float const* tau )
+// uncsd2by1_work_size alias to orcsd2by1_work_size
+inline void uncsd2by1_work_size(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
+    float* X11, int64_t ldx11,
+    float* X21, int64_t ldx21,
+    float* theta,
+    float* U1, int64_t ldu1,
+    float* U2, int64_t ldu2,
+    float* V1T, int64_t ldv1t,
+    int64_t* lwork, int64_t* liwork )
 {
-    return orgbr( vect, m, n, k, A, lda, tau );
+    orcsd2by1_work_size( jobu1, jobu2, jobv1t, m, p, q, X11, ldx11, X21, ldx21, theta, U1, ldu1, U2, ldu2, V1T, ldv1t, lwork, liwork );
 }
 
-int64_t orgbr(
-    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
-    double* A, int64_t lda,
-    double const* tau );
+void orcsd2by1_work_size(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
+    double* X11, int64_t ldx11,
+    double* X21, int64_t ldx21,
+    double* theta,
+    double* U1, int64_t ldu1,
+    double* U2, int64_t ldu2,
+    double* V1T, int64_t ldv1t,
+    int64_t* lwork, int64_t* liwork );
 
-// ungbr alias to orgbr
-inline int64_t ungbr(
+// uncsd2by1_work_size alias to orcsd2by1_work_size
+inline void uncsd2by1_work_size(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
+    double* X11, int64_t ldx11,
+    double* X21, int64_t ldx21,
+    double* theta,
+    double* U1, int64_t ldu1,
+    double* U2, int64_t ldu2,
+    double* V1T, int64_t ldv1t,
+    int64_t* lwork, int64_t* liwork )
+{
+    orcsd2by1_work_size( jobu1, jobu2, jobv1t, m, p, q, X11, ldx11, X21, ldx21, theta, U1, ldu1, U2, ldu2, V1T, ldv1t, lwork, liwork );
+}
+
+int64_t orcsd2by1(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
+    float* X11, int64_t ldx11,
+    float* X21, int64_t ldx21,
+    float* theta,
+    float* U1, int64_t ldu1,
+    float* U2, int64_t ldu2,
+    float* V1T, int64_t ldv1t,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+// uncsd2by1 alias to orcsd2by1
+inline int64_t uncsd2by1(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
+    float* X11, int64_t ldx11,
+    float* X21, int64_t ldx21,
+    float* theta,
+    float* U1, int64_t ldu1,
+    float* U2, int64_t ldu2,
+    float* V1T, int64_t ldv1t,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    return orcsd2by1( jobu1, jobu2, jobv1t, m, p, q, X11, ldx11, X21, ldx21, theta, U1, ldu1, U2, ldu2, V1T, ldv1t, work, lwork, iwork, liwork );
+}
+
+int64_t orcsd2by1(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
+    double* X11, int64_t ldx11,
+    double* X21, int64_t ldx21,
+    double* theta,
+    double* U1, int64_t ldu1,
+    double* U2, int64_t ldu2,
+    double* V1T, int64_t ldv1t,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+// uncsd2by1 alias to orcsd2by1
+inline int64_t uncsd2by1(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
+    double* X11, int64_t ldx11,
+    double* X21, int64_t ldx21,
+    double* theta,
+    double* U1, int64_t ldu1,
+    double* U2, int64_t ldu2,
+    double* V1T, int64_t ldv1t,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    return orcsd2by1( jobu1, jobu2, jobv1t, m, p, q, X11, ldx11, X21, ldx21, theta, U1, ldu1, U2, ldu2, V1T, ldv1t, work, lwork, iwork, liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t orgbr(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau );
+
+// ungbr alias to orgbr
+inline int64_t ungbr(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau )
+{
+    return orgbr( vect, m, n, k, A, lda, tau );
+}
+
+int64_t orgbr(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau );
+
+// ungbr alias to orgbr
+inline int64_t ungbr(
     lapack::Vect vect, int64_t m, int64_t n, int64_t k,
     double* A, int64_t lda,
     double const* tau )
@@ -4641,6 +7519,70 @@ inline int64_t ungbr(
     return orgbr( vect, m, n, k, A, lda, tau );
 }
 
+void orgbr_work_size(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau,
+    int64_t* lwork );
+
+// ungbr_work_size alias to orgbr_work_size
+inline void ungbr_work_size(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau,
+    int64_t* lwork )
+{
+    orgbr_work_size( vect, m, n, k, A, lda, tau, lwork );
+}
+
+void orgbr_work_size(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau,
+    int64_t* lwork );
+
+// ungbr_work_size alias to orgbr_work_size
+inline void ungbr_work_size(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau,
+    int64_t* lwork )
+{
+    orgbr_work_size( vect, m, n, k, A, lda, tau, lwork );
+}
+
+int64_t orgbr(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau,
+    float* work, int64_t lwork );
+
+// ungbr alias to orgbr
+inline int64_t ungbr(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau,
+    float* work, int64_t lwork )
+{
+    return orgbr( vect, m, n, k, A, lda, tau, work, lwork );
+}
+
+int64_t orgbr(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau,
+    double* work, int64_t lwork );
+
+// ungbr alias to orgbr
+inline int64_t ungbr(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau,
+    double* work, int64_t lwork )
+{
+    return orgbr( vect, m, n, k, A, lda, tau, work, lwork );
+}
+
 // -----------------------------------------------------------------------------
 int64_t orghr(
     int64_t n, int64_t ilo, int64_t ihi,
@@ -4670,6 +7612,70 @@ inline int64_t unghr(
     return orghr( n, ilo, ihi, A, lda, tau );
 }
 
+void orghr_work_size(
+    int64_t n, int64_t ilo, int64_t ihi,
+    float* A, int64_t lda,
+    float const* tau,
+    int64_t* lwork );
+
+// unghr_work_size alias to orghr_work_size
+inline void unghr_work_size(
+    int64_t n, int64_t ilo, int64_t ihi,
+    float* A, int64_t lda,
+    float const* tau,
+    int64_t* lwork )
+{
+    orghr_work_size( n, ilo, ihi, A, lda, tau, lwork );
+}
+
+void orghr_work_size(
+    int64_t n, int64_t ilo, int64_t ihi,
+    double* A, int64_t lda,
+    double const* tau,
+    int64_t* lwork );
+
+// unghr_work_size alias to orghr_work_size
+inline void unghr_work_size(
+    int64_t n, int64_t ilo, int64_t ihi,
+    double* A, int64_t lda,
+    double const* tau,
+    int64_t* lwork )
+{
+    orghr_work_size( n, ilo, ihi, A, lda, tau, lwork );
+}
+
+int64_t orghr(
+    int64_t n, int64_t ilo, int64_t ihi,
+    float* A, int64_t lda,
+    float const* tau,
+    float* work, int64_t lwork );
+
+// unghr alias to orghr
+inline int64_t unghr(
+    int64_t n, int64_t ilo, int64_t ihi,
+    float* A, int64_t lda,
+    float const* tau,
+    float* work, int64_t lwork )
+{
+    return orghr( n, ilo, ihi, A, lda, tau, work, lwork );
+}
+
+int64_t orghr(
+    int64_t n, int64_t ilo, int64_t ihi,
+    double* A, int64_t lda,
+    double const* tau,
+    double* work, int64_t lwork );
+
+// unghr alias to orghr
+inline int64_t unghr(
+    int64_t n, int64_t ilo, int64_t ihi,
+    double* A, int64_t lda,
+    double const* tau,
+    double* work, int64_t lwork )
+{
+    return orghr( n, ilo, ihi, A, lda, tau, work, lwork );
+}
+
 // -----------------------------------------------------------------------------
 int64_t orglq(
     int64_t m, int64_t n, int64_t k,
@@ -4699,1108 +7705,1412 @@ inline int64_t unglq(
     return orglq( m, n, k, A, lda, tau );
 }
 
-// -----------------------------------------------------------------------------
-int64_t orgql(
+void orglq_work_size(
     int64_t m, int64_t n, int64_t k,
     float* A, int64_t lda,
-    float const* tau );
+    float const* tau,
+    int64_t* lwork );
 
-// ungql alias to orgql
-inline int64_t ungql(
+// unglq_work_size alias to orglq_work_size
+inline void unglq_work_size(
     int64_t m, int64_t n, int64_t k,
     float* A, int64_t lda,
-    float const* tau )
+    float const* tau,
+    int64_t* lwork )
 {
-    return orgql( m, n, k, A, lda, tau );
+    orglq_work_size( m, n, k, A, lda, tau, lwork );
 }
 
-int64_t orgql(
+void orglq_work_size(
     int64_t m, int64_t n, int64_t k,
     double* A, int64_t lda,
-    double const* tau );
+    double const* tau,
+    int64_t* lwork );
 
-// ungql alias to orgql
-inline int64_t ungql(
+// unglq_work_size alias to orglq_work_size
+inline void unglq_work_size(
     int64_t m, int64_t n, int64_t k,
     double* A, int64_t lda,
-    double const* tau )
+    double const* tau,
+    int64_t* lwork )
 {
-    return orgql( m, n, k, A, lda, tau );
+    orglq_work_size( m, n, k, A, lda, tau, lwork );
 }
 
-// -----------------------------------------------------------------------------
-int64_t orgqr(
+int64_t orglq(
     int64_t m, int64_t n, int64_t k,
     float* A, int64_t lda,
-    float const* tau );
+    float const* tau,
+    float* work, int64_t lwork );
 
-// ungqr alias to orgqr
-inline int64_t ungqr(
+// unglq alias to orglq
+inline int64_t unglq(
     int64_t m, int64_t n, int64_t k,
     float* A, int64_t lda,
-    float const* tau )
+    float const* tau,
+    float* work, int64_t lwork )
 {
-    return orgqr( m, n, k, A, lda, tau );
+    return orglq( m, n, k, A, lda, tau, work, lwork );
 }
 
-int64_t orgqr(
+int64_t orglq(
     int64_t m, int64_t n, int64_t k,
     double* A, int64_t lda,
-    double const* tau );
+    double const* tau,
+    double* work, int64_t lwork );
 
-// ungqr alias to orgqr
-inline int64_t ungqr(
+// unglq alias to orglq
+inline int64_t unglq(
     int64_t m, int64_t n, int64_t k,
     double* A, int64_t lda,
-    double const* tau )
+    double const* tau,
+    double* work, int64_t lwork )
 {
-    return orgqr( m, n, k, A, lda, tau );
+    return orglq( m, n, k, A, lda, tau, work, lwork );
 }
 
 // -----------------------------------------------------------------------------
-int64_t orgrq(
+int64_t orgql(
     int64_t m, int64_t n, int64_t k,
     float* A, int64_t lda,
     float const* tau );
 
-// ungrq alias to orgrq
-inline int64_t ungrq(
+// ungql alias to orgql
+inline int64_t ungql(
     int64_t m, int64_t n, int64_t k,
     float* A, int64_t lda,
     float const* tau )
 {
-    return orgrq( m, n, k, A, lda, tau );
+    return orgql( m, n, k, A, lda, tau );
 }
 
-int64_t orgrq(
+int64_t orgql(
     int64_t m, int64_t n, int64_t k,
     double* A, int64_t lda,
     double const* tau );
 
-// ungrq alias to orgrq
-inline int64_t ungrq(
+// ungql alias to orgql
+inline int64_t ungql(
     int64_t m, int64_t n, int64_t k,
     double* A, int64_t lda,
     double const* tau )
 {
-    return orgrq( m, n, k, A, lda, tau );
+    return orgql( m, n, k, A, lda, tau );
 }
 
-// -----------------------------------------------------------------------------
-int64_t orgtr(
-    lapack::Uplo uplo, int64_t n,
+void orgql_work_size(
+    int64_t m, int64_t n, int64_t k,
     float* A, int64_t lda,
-    float const* tau );
+    float const* tau,
+    int64_t* lwork );
 
-// ungtr alias to orgtr
-inline int64_t ungtr(
-    lapack::Uplo uplo, int64_t n,
+// ungql_work_size alias to orgql_work_size
+inline void ungql_work_size(
+    int64_t m, int64_t n, int64_t k,
     float* A, int64_t lda,
-    float const* tau )
+    float const* tau,
+    int64_t* lwork )
 {
-    return orgtr( uplo, n, A, lda, tau );
+    orgql_work_size( m, n, k, A, lda, tau, lwork );
 }
 
-int64_t orgtr(
-    lapack::Uplo uplo, int64_t n,
+void orgql_work_size(
+    int64_t m, int64_t n, int64_t k,
     double* A, int64_t lda,
-    double const* tau );
+    double const* tau,
+    int64_t* lwork );
 
-// ungtr alias to orgtr
-inline int64_t ungtr(
-    lapack::Uplo uplo, int64_t n,
+// ungql_work_size alias to orgql_work_size
+inline void ungql_work_size(
+    int64_t m, int64_t n, int64_t k,
     double* A, int64_t lda,
-    double const* tau )
+    double const* tau,
+    int64_t* lwork )
 {
-    return orgtr( uplo, n, A, lda, tau );
+    orgql_work_size( m, n, k, A, lda, tau, lwork );
 }
 
-// -----------------------------------------------------------------------------
-int64_t ormbr(
-    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    float const* A, int64_t lda,
+int64_t orgql(
+    int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
     float const* tau,
-    float* C, int64_t ldc );
+    float* work, int64_t lwork );
 
-// unmbr alias to ormbr
-inline int64_t unmbr(
-    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    float const* A, int64_t lda,
+// ungql alias to orgql
+inline int64_t ungql(
+    int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
     float const* tau,
-    float* C, int64_t ldc )
+    float* work, int64_t lwork )
 {
-    return ormbr( vect, side, trans, m, n, k, A, lda, tau, C, ldc );
+    return orgql( m, n, k, A, lda, tau, work, lwork );
 }
 
-int64_t ormbr(
-    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    double const* A, int64_t lda,
+int64_t orgql(
+    int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
     double const* tau,
-    double* C, int64_t ldc );
+    double* work, int64_t lwork );
 
-// unmbr alias to ormbr
-inline int64_t unmbr(
-    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    double const* A, int64_t lda,
+// ungql alias to orgql
+inline int64_t ungql(
+    int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
     double const* tau,
-    double* C, int64_t ldc )
+    double* work, int64_t lwork )
 {
-    return ormbr( vect, side, trans, m, n, k, A, lda, tau, C, ldc );
+    return orgql( m, n, k, A, lda, tau, work, lwork );
 }
 
 // -----------------------------------------------------------------------------
-int64_t ormhr(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
-    float const* A, int64_t lda,
-    float const* tau,
-    float* C, int64_t ldc );
+int64_t orgqr(
+    int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau );
 
-// unmhr alias to ormhr
-inline int64_t unmhr(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
-    float const* A, int64_t lda,
-    float const* tau,
-    float* C, int64_t ldc )
+// ungqr alias to orgqr
+inline int64_t ungqr(
+    int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau )
 {
-    return ormhr( side, trans, m, n, ilo, ihi, A, lda, tau, C, ldc );
+    return orgqr( m, n, k, A, lda, tau );
 }
 
-int64_t ormhr(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
-    double const* A, int64_t lda,
-    double const* tau,
-    double* C, int64_t ldc );
+int64_t orgqr(
+    int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau );
 
-// unmhr alias to ormhr
-inline int64_t unmhr(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
-    double const* A, int64_t lda,
-    double const* tau,
-    double* C, int64_t ldc )
+// ungqr alias to orgqr
+inline int64_t ungqr(
+    int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau )
 {
-    return ormhr( side, trans, m, n, ilo, ihi, A, lda, tau, C, ldc );
+    return orgqr( m, n, k, A, lda, tau );
 }
 
-// -----------------------------------------------------------------------------
-int64_t ormlq(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    float const* A, int64_t lda,
+void orgqr_work_size(
+    int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
     float const* tau,
-    float* C, int64_t ldc );
+    int64_t* lwork );
 
-// unmlq alias to ormlq
-inline int64_t unmlq(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    float const* A, int64_t lda,
+// ungqr_work_size alias to orgqr_work_size
+inline void ungqr_work_size(
+    int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
     float const* tau,
-    float* C, int64_t ldc )
+    int64_t* lwork )
 {
-    return ormlq( side, trans, m, n, k, A, lda, tau, C, ldc );
+    orgqr_work_size( m, n, k, A, lda, tau, lwork );
 }
 
-int64_t ormlq(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    double const* A, int64_t lda,
+void orgqr_work_size(
+    int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
     double const* tau,
-    double* C, int64_t ldc );
+    int64_t* lwork );
 
-// unmlq alias to ormlq
-inline int64_t unmlq(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    double const* A, int64_t lda,
+// ungqr_work_size alias to orgqr_work_size
+inline void ungqr_work_size(
+    int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
     double const* tau,
-    double* C, int64_t ldc )
+    int64_t* lwork )
 {
-    return ormlq( side, trans, m, n, k, A, lda, tau, C, ldc );
+    orgqr_work_size( m, n, k, A, lda, tau, lwork );
 }
 
-// -----------------------------------------------------------------------------
-int64_t ormql(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    float const* A, int64_t lda,
+int64_t orgqr(
+    int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
     float const* tau,
-    float* C, int64_t ldc );
+    float* work, int64_t lwork );
 
-// unmql alias to ormql
-inline int64_t unmql(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    float const* A, int64_t lda,
+// ungqr alias to orgqr
+inline int64_t ungqr(
+    int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
     float const* tau,
-    float* C, int64_t ldc )
+    float* work, int64_t lwork )
 {
-    return ormql( side, trans, m, n, k, A, lda, tau, C, ldc );
+    return orgqr( m, n, k, A, lda, tau, work, lwork );
 }
 
-int64_t ormql(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    double const* A, int64_t lda,
+int64_t orgqr(
+    int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
     double const* tau,
-    double* C, int64_t ldc );
+    double* work, int64_t lwork );
 
-// unmql alias to ormql
-inline int64_t unmql(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    double const* A, int64_t lda,
+// ungqr alias to orgqr
+inline int64_t ungqr(
+    int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
     double const* tau,
-    double* C, int64_t ldc )
+    double* work, int64_t lwork )
 {
-    return ormql( side, trans, m, n, k, A, lda, tau, C, ldc );
+    return orgqr( m, n, k, A, lda, tau, work, lwork );
 }
 
 // -----------------------------------------------------------------------------
-int64_t ormqr(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    float const* A, int64_t lda,
-    float const* tau,
-    float* C, int64_t ldc );
+int64_t orgrq(
+    int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau );
 
-// unmqr alias to ormqr
-inline int64_t unmqr(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    float const* A, int64_t lda,
-    float const* tau,
-    float* C, int64_t ldc )
+// ungrq alias to orgrq
+inline int64_t ungrq(
+    int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau )
 {
-    return ormqr( side, trans, m, n, k, A, lda, tau, C, ldc );
+    return orgrq( m, n, k, A, lda, tau );
 }
 
-int64_t ormqr(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    double const* A, int64_t lda,
-    double const* tau,
-    double* C, int64_t ldc );
+int64_t orgrq(
+    int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau );
 
-// unmqr alias to ormqr
-inline int64_t unmqr(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    double const* A, int64_t lda,
-    double const* tau,
-    double* C, int64_t ldc )
+// ungrq alias to orgrq
+inline int64_t ungrq(
+    int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau )
 {
-    return ormqr( side, trans, m, n, k, A, lda, tau, C, ldc );
+    return orgrq( m, n, k, A, lda, tau );
 }
 
-// -----------------------------------------------------------------------------
-int64_t ormrq(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    float const* A, int64_t lda,
+void orgrq_work_size(
+    int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
     float const* tau,
-    float* C, int64_t ldc );
+    int64_t* lwork );
 
-// unmrq alias to ormrq
-inline int64_t unmrq(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    float const* A, int64_t lda,
+// ungrq_work_size alias to orgrq_work_size
+inline void ungrq_work_size(
+    int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
     float const* tau,
-    float* C, int64_t ldc )
+    int64_t* lwork )
 {
-    return ormrq( side, trans, m, n, k, A, lda, tau, C, ldc );
+    orgrq_work_size( m, n, k, A, lda, tau, lwork );
 }
 
-int64_t ormrq(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    double const* A, int64_t lda,
+void orgrq_work_size(
+    int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
     double const* tau,
-    double* C, int64_t ldc );
+    int64_t* lwork );
 
-// unmrq alias to ormrq
-inline int64_t unmrq(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    double const* A, int64_t lda,
+// ungrq_work_size alias to orgrq_work_size
+inline void ungrq_work_size(
+    int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
     double const* tau,
-    double* C, int64_t ldc )
+    int64_t* lwork )
 {
-    return ormrq( side, trans, m, n, k, A, lda, tau, C, ldc );
+    orgrq_work_size( m, n, k, A, lda, tau, lwork );
 }
 
-// -----------------------------------------------------------------------------
-int64_t ormrz(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
-    float const* A, int64_t lda,
+int64_t orgrq(
+    int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
     float const* tau,
-    float* C, int64_t ldc );
+    float* work, int64_t lwork );
 
-// unmrz alias to ormrz
-inline int64_t unmrz(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
-    float const* A, int64_t lda,
+// ungrq alias to orgrq
+inline int64_t ungrq(
+    int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
     float const* tau,
-    float* C, int64_t ldc )
+    float* work, int64_t lwork )
 {
-    return ormrz( side, trans, m, n, k, l, A, lda, tau, C, ldc );
+    return orgrq( m, n, k, A, lda, tau, work, lwork );
 }
 
-int64_t ormrz(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
-    double const* A, int64_t lda,
+int64_t orgrq(
+    int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
     double const* tau,
-    double* C, int64_t ldc );
+    double* work, int64_t lwork );
 
-// unmrz alias to ormrz
-inline int64_t unmrz(
-    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
-    double const* A, int64_t lda,
+// ungrq alias to orgrq
+inline int64_t ungrq(
+    int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
     double const* tau,
-    double* C, int64_t ldc )
+    double* work, int64_t lwork )
 {
-    return ormrz( side, trans, m, n, k, l, A, lda, tau, C, ldc );
+    return orgrq( m, n, k, A, lda, tau, work, lwork );
 }
 
 // -----------------------------------------------------------------------------
-int64_t ormtr(
-    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
-    float const* A, int64_t lda,
-    float const* tau,
-    float* C, int64_t ldc );
+int64_t orgtr(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float const* tau );
 
-// unmtr alias to ormtr
-inline int64_t unmtr(
-    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
-    float const* A, int64_t lda,
-    float const* tau,
-    float* C, int64_t ldc )
+// ungtr alias to orgtr
+inline int64_t ungtr(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float const* tau )
 {
-    return ormtr( side, uplo, trans, m, n, A, lda, tau, C, ldc );
+    return orgtr( uplo, n, A, lda, tau );
 }
 
-int64_t ormtr(
-    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
-    double const* A, int64_t lda,
-    double const* tau,
-    double* C, int64_t ldc );
+int64_t orgtr(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double const* tau );
 
-// unmtr alias to ormtr
-inline int64_t unmtr(
-    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
-    double const* A, int64_t lda,
-    double const* tau,
-    double* C, int64_t ldc )
+// ungtr alias to orgtr
+inline int64_t ungtr(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double const* tau )
 {
-    return ormtr( side, uplo, trans, m, n, A, lda, tau, C, ldc );
+    return orgtr( uplo, n, A, lda, tau );
 }
 
-// -----------------------------------------------------------------------------
-int64_t pbcon(
-    lapack::Uplo uplo, int64_t n, int64_t kd,
-    float const* AB, int64_t ldab, float anorm,
-    float* rcond );
+void orgtr_work_size(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float const* tau,
+    int64_t* lwork );
 
-int64_t pbcon(
-    lapack::Uplo uplo, int64_t n, int64_t kd,
-    double const* AB, int64_t ldab, double anorm,
-    double* rcond );
+// ungtr_work_size alias to orgtr_work_size
+inline void ungtr_work_size(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float const* tau,
+    int64_t* lwork )
+{
+    orgtr_work_size( uplo, n, A, lda, tau, lwork );
+}
 
-int64_t pbcon(
-    lapack::Uplo uplo, int64_t n, int64_t kd,
-    std::complex<float> const* AB, int64_t ldab, float anorm,
-    float* rcond );
+void orgtr_work_size(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double const* tau,
+    int64_t* lwork );
 
-int64_t pbcon(
-    lapack::Uplo uplo, int64_t n, int64_t kd,
-    std::complex<double> const* AB, int64_t ldab, double anorm,
-    double* rcond );
+// ungtr_work_size alias to orgtr_work_size
+inline void ungtr_work_size(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double const* tau,
+    int64_t* lwork )
+{
+    orgtr_work_size( uplo, n, A, lda, tau, lwork );
+}
 
-// -----------------------------------------------------------------------------
-int64_t pbequ(
-    lapack::Uplo uplo, int64_t n, int64_t kd,
-    float const* AB, int64_t ldab,
-    float* S,
-    float* scond,
-    float* amax );
+int64_t orgtr(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float const* tau,
+    float* work, int64_t lwork );
 
-int64_t pbequ(
-    lapack::Uplo uplo, int64_t n, int64_t kd,
-    double const* AB, int64_t ldab,
-    double* S,
-    double* scond,
-    double* amax );
+// ungtr alias to orgtr
+inline int64_t ungtr(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float const* tau,
+    float* work, int64_t lwork )
+{
+    return orgtr( uplo, n, A, lda, tau, work, lwork );
+}
 
-int64_t pbequ(
-    lapack::Uplo uplo, int64_t n, int64_t kd,
-    std::complex<float> const* AB, int64_t ldab,
-    float* S,
-    float* scond,
-    float* amax );
+int64_t orgtr(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double const* tau,
+    double* work, int64_t lwork );
 
-int64_t pbequ(
-    lapack::Uplo uplo, int64_t n, int64_t kd,
-    std::complex<double> const* AB, int64_t ldab,
-    double* S,
-    double* scond,
-    double* amax );
+// ungtr alias to orgtr
+inline int64_t ungtr(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double const* tau,
+    double* work, int64_t lwork )
+{
+    return orgtr( uplo, n, A, lda, tau, work, lwork );
+}
 
 // -----------------------------------------------------------------------------
-int64_t pbrfs(
-    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
-    float const* AB, int64_t ldab,
-    float const* AFB, int64_t ldafb,
-    float const* B, int64_t ldb,
-    float* X, int64_t ldx,
-    float* ferr,
-    float* berr );
+int64_t ormbr(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc );
 
-int64_t pbrfs(
-    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
-    double const* AB, int64_t ldab,
-    double const* AFB, int64_t ldafb,
-    double const* B, int64_t ldb,
-    double* X, int64_t ldx,
-    double* ferr,
-    double* berr );
+// unmbr alias to ormbr
+inline int64_t unmbr(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc )
+{
+    return ormbr( vect, side, trans, m, n, k, A, lda, tau, C, ldc );
+}
 
-int64_t pbrfs(
-    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
-    std::complex<float> const* AB, int64_t ldab,
-    std::complex<float> const* AFB, int64_t ldafb,
-    std::complex<float> const* B, int64_t ldb,
-    std::complex<float>* X, int64_t ldx,
-    float* ferr,
-    float* berr );
+int64_t ormbr(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc );
 
-int64_t pbrfs(
-    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
-    std::complex<double> const* AB, int64_t ldab,
-    std::complex<double> const* AFB, int64_t ldafb,
-    std::complex<double> const* B, int64_t ldb,
-    std::complex<double>* X, int64_t ldx,
-    double* ferr,
-    double* berr );
+// unmbr alias to ormbr
+inline int64_t unmbr(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc )
+{
+    return ormbr( vect, side, trans, m, n, k, A, lda, tau, C, ldc );
+}
 
-// -----------------------------------------------------------------------------
-int64_t pbstf(
-    lapack::Uplo uplo, int64_t n, int64_t kd,
-    float* AB, int64_t ldab );
+void ormbr_work_size(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    int64_t* lwork );
 
-int64_t pbstf(
-    lapack::Uplo uplo, int64_t n, int64_t kd,
-    double* AB, int64_t ldab );
+// unmbr_work_size alias to ormbr_work_size
+inline void unmbr_work_size(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    int64_t* lwork )
+{
+    ormbr_work_size( vect, side, trans, m, n, k, A, lda, tau, C, ldc, lwork );
+}
 
-int64_t pbstf(
-    lapack::Uplo uplo, int64_t n, int64_t kd,
-    std::complex<float>* AB, int64_t ldab );
+void ormbr_work_size(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    int64_t* lwork );
 
-int64_t pbstf(
-    lapack::Uplo uplo, int64_t n, int64_t kd,
-    std::complex<double>* AB, int64_t ldab );
+// unmbr_work_size alias to ormbr_work_size
+inline void unmbr_work_size(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    int64_t* lwork )
+{
+    ormbr_work_size( vect, side, trans, m, n, k, A, lda, tau, C, ldc, lwork );
+}
 
-// -----------------------------------------------------------------------------
-int64_t pbsv(
-    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
-    float* AB, int64_t ldab,
-    float* B, int64_t ldb );
+int64_t ormbr(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    float* work, int64_t lwork );
 
-int64_t pbsv(
-    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
-    double* AB, int64_t ldab,
-    double* B, int64_t ldb );
+// unmbr alias to ormbr
+inline int64_t unmbr(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    float* work, int64_t lwork )
+{
+    return ormbr( vect, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork );
+}
 
-int64_t pbsv(
-    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
-    std::complex<float>* AB, int64_t ldab,
-    std::complex<float>* B, int64_t ldb );
+int64_t ormbr(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    double* work, int64_t lwork );
 
-int64_t pbsv(
-    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
-    std::complex<double>* AB, int64_t ldab,
-    std::complex<double>* B, int64_t ldb );
+// unmbr alias to ormbr
+inline int64_t unmbr(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    double* work, int64_t lwork )
+{
+    return ormbr( vect, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork );
+}
 
 // -----------------------------------------------------------------------------
-int64_t pbsvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
-    float* AB, int64_t ldab,
-    float* AFB, int64_t ldafb,
-    lapack::Equed* equed,
-    float* S,
-    float* B, int64_t ldb,
-    float* X, int64_t ldx,
-    float* rcond,
-    float* ferr,
-    float* berr );
+int64_t ormhr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc );
 
-int64_t pbsvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
-    double* AB, int64_t ldab,
-    double* AFB, int64_t ldafb,
-    lapack::Equed* equed,
-    double* S,
-    double* B, int64_t ldb,
-    double* X, int64_t ldx,
-    double* rcond,
-    double* ferr,
-    double* berr );
+// unmhr alias to ormhr
+inline int64_t unmhr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc )
+{
+    return ormhr( side, trans, m, n, ilo, ihi, A, lda, tau, C, ldc );
+}
 
-int64_t pbsvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
-    std::complex<float>* AB, int64_t ldab,
-    std::complex<float>* AFB, int64_t ldafb,
-    lapack::Equed* equed,
-    float* S,
-    std::complex<float>* B, int64_t ldb,
-    std::complex<float>* X, int64_t ldx,
-    float* rcond,
-    float* ferr,
-    float* berr );
+int64_t ormhr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc );
 
-int64_t pbsvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
-    std::complex<double>* AB, int64_t ldab,
-    std::complex<double>* AFB, int64_t ldafb,
-    lapack::Equed* equed,
-    double* S,
-    std::complex<double>* B, int64_t ldb,
-    std::complex<double>* X, int64_t ldx,
-    double* rcond,
-    double* ferr,
-    double* berr );
+// unmhr alias to ormhr
+inline int64_t unmhr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc )
+{
+    return ormhr( side, trans, m, n, ilo, ihi, A, lda, tau, C, ldc );
+}
 
-// -----------------------------------------------------------------------------
-int64_t pbtrf(
-    lapack::Uplo uplo, int64_t n, int64_t kd,
-    float* AB, int64_t ldab );
+void ormhr_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    int64_t* lwork );
 
-int64_t pbtrf(
-    lapack::Uplo uplo, int64_t n, int64_t kd,
-    double* AB, int64_t ldab );
+// unmhr_work_size alias to ormhr_work_size
+inline void unmhr_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    int64_t* lwork )
+{
+    ormhr_work_size( side, trans, m, n, ilo, ihi, A, lda, tau, C, ldc, lwork );
+}
 
-int64_t pbtrf(
-    lapack::Uplo uplo, int64_t n, int64_t kd,
-    std::complex<float>* AB, int64_t ldab );
+void ormhr_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    int64_t* lwork );
 
-int64_t pbtrf(
-    lapack::Uplo uplo, int64_t n, int64_t kd,
-    std::complex<double>* AB, int64_t ldab );
+// unmhr_work_size alias to ormhr_work_size
+inline void unmhr_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    int64_t* lwork )
+{
+    ormhr_work_size( side, trans, m, n, ilo, ihi, A, lda, tau, C, ldc, lwork );
+}
 
-// -----------------------------------------------------------------------------
-int64_t pbtrs(
-    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
-    float const* AB, int64_t ldab,
-    float* B, int64_t ldb );
+int64_t ormhr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    float* work, int64_t lwork );
 
-int64_t pbtrs(
-    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
-    double const* AB, int64_t ldab,
-    double* B, int64_t ldb );
+// unmhr alias to ormhr
+inline int64_t unmhr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    float* work, int64_t lwork )
+{
+    return ormhr( side, trans, m, n, ilo, ihi, A, lda, tau, C, ldc, work, lwork );
+}
 
-int64_t pbtrs(
-    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
-    std::complex<float> const* AB, int64_t ldab,
-    std::complex<float>* B, int64_t ldb );
+int64_t ormhr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    double* work, int64_t lwork );
 
-int64_t pbtrs(
-    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
-    std::complex<double> const* AB, int64_t ldab,
-    std::complex<double>* B, int64_t ldb );
+// unmhr alias to ormhr
+inline int64_t unmhr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    double* work, int64_t lwork )
+{
+    return ormhr( side, trans, m, n, ilo, ihi, A, lda, tau, C, ldc, work, lwork );
+}
 
 // -----------------------------------------------------------------------------
-int64_t pftrf(
-    lapack::Op transr, lapack::Uplo uplo, int64_t n,
-    float* A );
+int64_t ormlq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc );
 
-int64_t pftrf(
-    lapack::Op transr, lapack::Uplo uplo, int64_t n,
-    double* A );
+// unmlq alias to ormlq
+inline int64_t unmlq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc )
+{
+    return ormlq( side, trans, m, n, k, A, lda, tau, C, ldc );
+}
 
-int64_t pftrf(
-    lapack::Op transr, lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A );
+int64_t ormlq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc );
 
-int64_t pftrf(
-    lapack::Op transr, lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A );
+// unmlq alias to ormlq
+inline int64_t unmlq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc )
+{
+    return ormlq( side, trans, m, n, k, A, lda, tau, C, ldc );
+}
 
-// -----------------------------------------------------------------------------
-int64_t pftri(
-    lapack::Op transr, lapack::Uplo uplo, int64_t n,
-    float* A );
+void ormlq_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    int64_t* lwork );
 
-int64_t pftri(
-    lapack::Op transr, lapack::Uplo uplo, int64_t n,
-    double* A );
+// unmlq_work_size alias to ormlq_work_size
+inline void unmlq_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    int64_t* lwork )
+{
+    ormlq_work_size( side, trans, m, n, k, A, lda, tau, C, ldc, lwork );
+}
 
-int64_t pftri(
-    lapack::Op transr, lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A );
+void ormlq_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    int64_t* lwork );
 
-int64_t pftri(
-    lapack::Op transr, lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A );
+// unmlq_work_size alias to ormlq_work_size
+inline void unmlq_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    int64_t* lwork )
+{
+    ormlq_work_size( side, trans, m, n, k, A, lda, tau, C, ldc, lwork );
+}
 
-// -----------------------------------------------------------------------------
-int64_t pftrs(
-    lapack::Op transr, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float const* A,
-    float* B, int64_t ldb );
+int64_t ormlq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    float* work, int64_t lwork );
 
-int64_t pftrs(
-    lapack::Op transr, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double const* A,
-    double* B, int64_t ldb );
+// unmlq alias to ormlq
+inline int64_t unmlq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    float* work, int64_t lwork )
+{
+    return ormlq( side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork );
+}
 
-int64_t pftrs(
-    lapack::Op transr, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float> const* A,
-    std::complex<float>* B, int64_t ldb );
+int64_t ormlq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    double* work, int64_t lwork );
 
-int64_t pftrs(
-    lapack::Op transr, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double> const* A,
-    std::complex<double>* B, int64_t ldb );
+// unmlq alias to ormlq
+inline int64_t unmlq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    double* work, int64_t lwork )
+{
+    return ormlq( side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork );
+}
 
 // -----------------------------------------------------------------------------
-int64_t pocon(
-    lapack::Uplo uplo, int64_t n,
-    float const* A, int64_t lda, float anorm,
-    float* rcond );
+int64_t ormql(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc );
 
-int64_t pocon(
-    lapack::Uplo uplo, int64_t n,
-    double const* A, int64_t lda, double anorm,
-    double* rcond );
+// unmql alias to ormql
+inline int64_t unmql(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc )
+{
+    return ormql( side, trans, m, n, k, A, lda, tau, C, ldc );
+}
 
-int64_t pocon(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float> const* A, int64_t lda, float anorm,
-    float* rcond );
+int64_t ormql(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc );
 
-int64_t pocon(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double> const* A, int64_t lda, double anorm,
-    double* rcond );
+// unmql alias to ormql
+inline int64_t unmql(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc )
+{
+    return ormql( side, trans, m, n, k, A, lda, tau, C, ldc );
+}
 
-// -----------------------------------------------------------------------------
-int64_t poequ(
-    int64_t n,
+void ormql_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
     float const* A, int64_t lda,
-    float* S,
-    float* scond,
-    float* amax );
+    float const* tau,
+    float* C, int64_t ldc,
+    int64_t* lwork );
 
-int64_t poequ(
-    int64_t n,
+// unmql_work_size alias to ormql_work_size
+inline void unmql_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    int64_t* lwork )
+{
+    ormql_work_size( side, trans, m, n, k, A, lda, tau, C, ldc, lwork );
+}
+
+void ormql_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
     double const* A, int64_t lda,
-    double* S,
-    double* scond,
-    double* amax );
+    double const* tau,
+    double* C, int64_t ldc,
+    int64_t* lwork );
 
-int64_t poequ(
-    int64_t n,
-    std::complex<float> const* A, int64_t lda,
-    float* S,
-    float* scond,
-    float* amax );
+// unmql_work_size alias to ormql_work_size
+inline void unmql_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    int64_t* lwork )
+{
+    ormql_work_size( side, trans, m, n, k, A, lda, tau, C, ldc, lwork );
+}
 
-int64_t poequ(
-    int64_t n,
-    std::complex<double> const* A, int64_t lda,
-    double* S,
-    double* scond,
-    double* amax );
+int64_t ormql(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    float* work, int64_t lwork );
 
-// -----------------------------------------------------------------------------
-int64_t poequb(
-    int64_t n,
+// unmql alias to ormql
+inline int64_t unmql(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
     float const* A, int64_t lda,
-    float* S,
-    float* scond,
-    float* amax );
+    float const* tau,
+    float* C, int64_t ldc,
+    float* work, int64_t lwork )
+{
+    return ormql( side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork );
+}
 
-int64_t poequb(
-    int64_t n,
+int64_t ormql(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
     double const* A, int64_t lda,
-    double* S,
-    double* scond,
-    double* amax );
-
-int64_t poequb(
-    int64_t n,
-    std::complex<float> const* A, int64_t lda,
-    float* S,
-    float* scond,
-    float* amax );
+    double const* tau,
+    double* C, int64_t ldc,
+    double* work, int64_t lwork );
 
-int64_t poequb(
-    int64_t n,
-    std::complex<double> const* A, int64_t lda,
-    double* S,
-    double* scond,
-    double* amax );
+// unmql alias to ormql
+inline int64_t unmql(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    double* work, int64_t lwork )
+{
+    return ormql( side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork );
+}
 
 // -----------------------------------------------------------------------------
-int64_t porfs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+int64_t ormqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
     float const* A, int64_t lda,
-    float const* AF, int64_t ldaf,
-    float const* B, int64_t ldb,
-    float* X, int64_t ldx,
-    float* ferr,
-    float* berr );
+    float const* tau,
+    float* C, int64_t ldc );
 
-int64_t porfs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+// unmqr alias to ormqr
+inline int64_t unmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc )
+{
+    return ormqr( side, trans, m, n, k, A, lda, tau, C, ldc );
+}
+
+int64_t ormqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
     double const* A, int64_t lda,
-    double const* AF, int64_t ldaf,
-    double const* B, int64_t ldb,
-    double* X, int64_t ldx,
-    double* ferr,
-    double* berr );
+    double const* tau,
+    double* C, int64_t ldc );
 
-int64_t porfs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float> const* A, int64_t lda,
-    std::complex<float> const* AF, int64_t ldaf,
-    std::complex<float> const* B, int64_t ldb,
-    std::complex<float>* X, int64_t ldx,
-    float* ferr,
-    float* berr );
+// unmqr alias to ormqr
+inline int64_t unmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc )
+{
+    return ormqr( side, trans, m, n, k, A, lda, tau, C, ldc );
+}
 
-int64_t porfs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double> const* A, int64_t lda,
-    std::complex<double> const* AF, int64_t ldaf,
-    std::complex<double> const* B, int64_t ldb,
-    std::complex<double>* X, int64_t ldx,
-    double* ferr,
-    double* berr );
+void ormqr_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    int64_t* lwork );
 
-// -----------------------------------------------------------------------------
-int64_t porfsx(
-    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
+// unmqr_work_size alias to ormqr_work_size
+inline void unmqr_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
     float const* A, int64_t lda,
-    float const* AF, int64_t ldaf,
-    float* S,
-    float const* B, int64_t ldb,
-    float* X, int64_t ldx,
-    float* rcond,
-    float* berr, int64_t n_err_bnds,
-    float* err_bnds_norm,
-    float* err_bnds_comp, int64_t nparams,
-    float* params );
+    float const* tau,
+    float* C, int64_t ldc,
+    int64_t* lwork )
+{
+    ormqr_work_size( side, trans, m, n, k, A, lda, tau, C, ldc, lwork );
+}
 
-int64_t porfsx(
-    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
+void ormqr_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
     double const* A, int64_t lda,
-    double const* AF, int64_t ldaf,
-    double* S,
-    double const* B, int64_t ldb,
-    double* X, int64_t ldx,
-    double* rcond,
-    double* berr, int64_t n_err_bnds,
-    double* err_bnds_norm,
-    double* err_bnds_comp, int64_t nparams,
-    double* params );
-
-int64_t porfsx(
-    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
-    std::complex<float> const* A, int64_t lda,
-    std::complex<float> const* AF, int64_t ldaf,
-    float* S,
-    std::complex<float> const* B, int64_t ldb,
-    std::complex<float>* X, int64_t ldx,
-    float* rcond,
-    float* berr, int64_t n_err_bnds,
-    float* err_bnds_norm,
-    float* err_bnds_comp, int64_t nparams,
-    float* params );
+    double const* tau,
+    double* C, int64_t ldc,
+    int64_t* lwork );
 
-int64_t porfsx(
-    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
-    std::complex<double> const* A, int64_t lda,
-    std::complex<double> const* AF, int64_t ldaf,
-    double* S,
-    std::complex<double> const* B, int64_t ldb,
-    std::complex<double>* X, int64_t ldx,
-    double* rcond,
-    double* berr, int64_t n_err_bnds,
-    double* err_bnds_norm,
-    double* err_bnds_comp, int64_t nparams,
-    double* params );
+// unmqr_work_size alias to ormqr_work_size
+inline void unmqr_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    int64_t* lwork )
+{
+    ormqr_work_size( side, trans, m, n, k, A, lda, tau, C, ldc, lwork );
+}
 
-// -----------------------------------------------------------------------------
-int64_t posv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float* A, int64_t lda,
-    float* B, int64_t ldb );
-
-int64_t posv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double* A, int64_t lda,
-    double* B, int64_t ldb );
-
-int64_t posv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float>* A, int64_t lda,
-    std::complex<float>* B, int64_t ldb );
-
-int64_t posv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double>* A, int64_t lda,
-    std::complex<double>* B, int64_t ldb );
-
-int64_t posv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double* A, int64_t lda,
-    double const* B, int64_t ldb,
-    double* X, int64_t ldx,
-    int64_t* iter );
-
-int64_t posv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double>* A, int64_t lda,
-    std::complex<double> const* B, int64_t ldb,
-    std::complex<double>* X, int64_t ldx,
-    int64_t* iter );
-
-// -----------------------------------------------------------------------------
-int64_t posvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float* A, int64_t lda,
-    float* AF, int64_t ldaf,
-    lapack::Equed* equed,
-    float* S,
-    float* B, int64_t ldb,
-    float* X, int64_t ldx,
-    float* rcond,
-    float* ferr,
-    float* berr );
+int64_t ormqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    float* work, int64_t lwork );
 
-int64_t posvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double* A, int64_t lda,
-    double* AF, int64_t ldaf,
-    lapack::Equed* equed,
-    double* S,
-    double* B, int64_t ldb,
-    double* X, int64_t ldx,
-    double* rcond,
-    double* ferr,
-    double* berr );
+// unmqr alias to ormqr
+inline int64_t unmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    float* work, int64_t lwork )
+{
+    return ormqr( side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork );
+}
 
-int64_t posvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float>* A, int64_t lda,
-    std::complex<float>* AF, int64_t ldaf,
-    lapack::Equed* equed,
-    float* S,
-    std::complex<float>* B, int64_t ldb,
-    std::complex<float>* X, int64_t ldx,
-    float* rcond,
-    float* ferr,
-    float* berr );
+int64_t ormqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    double* work, int64_t lwork );
 
-int64_t posvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double>* A, int64_t lda,
-    std::complex<double>* AF, int64_t ldaf,
-    lapack::Equed* equed,
-    double* S,
-    std::complex<double>* B, int64_t ldb,
-    std::complex<double>* X, int64_t ldx,
-    double* rcond,
-    double* ferr,
-    double* berr );
+// unmqr alias to ormqr
+inline int64_t unmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    double* work, int64_t lwork )
+{
+    return ormqr( side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork );
+}
 
 // -----------------------------------------------------------------------------
-int64_t potf2(
-    lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda );
+int64_t ormrq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc );
 
-int64_t potf2(
-    lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda );
+// unmrq alias to ormrq
+inline int64_t unmrq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc )
+{
+    return ormrq( side, trans, m, n, k, A, lda, tau, C, ldc );
+}
 
-int64_t potf2(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda );
+int64_t ormrq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc );
 
-int64_t potf2(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A, int64_t lda );
+// unmrq alias to ormrq
+inline int64_t unmrq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc )
+{
+    return ormrq( side, trans, m, n, k, A, lda, tau, C, ldc );
+}
 
-// -----------------------------------------------------------------------------
-int64_t potrf(
-    lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda );
+void ormrq_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    int64_t* lwork );
 
-int64_t potrf(
-    lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda );
+// unmrq_work_size alias to ormrq_work_size
+inline void unmrq_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    int64_t* lwork )
+{
+    ormrq_work_size( side, trans, m, n, k, A, lda, tau, C, ldc, lwork );
+}
 
-int64_t potrf(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda );
+void ormrq_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    int64_t* lwork );
 
-int64_t potrf(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A, int64_t lda );
+// unmrq_work_size alias to ormrq_work_size
+inline void unmrq_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    int64_t* lwork )
+{
+    ormrq_work_size( side, trans, m, n, k, A, lda, tau, C, ldc, lwork );
+}
 
-// -----------------------------------------------------------------------------
-int64_t potrf2(
-    lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda );
+int64_t ormrq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    float* work, int64_t lwork );
 
-int64_t potrf2(
-    lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda );
+// unmrq alias to ormrq
+inline int64_t unmrq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    float* work, int64_t lwork )
+{
+    return ormrq( side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork );
+}
 
-int64_t potrf2(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda );
+int64_t ormrq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    double* work, int64_t lwork );
 
-int64_t potrf2(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A, int64_t lda );
+// unmrq alias to ormrq
+inline int64_t unmrq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    double* work, int64_t lwork )
+{
+    return ormrq( side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork );
+}
 
 // -----------------------------------------------------------------------------
-int64_t potri(
-    lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda );
-
-int64_t potri(
-    lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda );
-
-int64_t potri(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda );
-
-int64_t potri(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A, int64_t lda );
+int64_t ormrz(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc );
 
-// -----------------------------------------------------------------------------
-int64_t potrs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+// unmrz alias to ormrz
+inline int64_t unmrz(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
     float const* A, int64_t lda,
-    float* B, int64_t ldb );
+    float const* tau,
+    float* C, int64_t ldc )
+{
+    return ormrz( side, trans, m, n, k, l, A, lda, tau, C, ldc );
+}
 
-int64_t potrs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+int64_t ormrz(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
     double const* A, int64_t lda,
-    double* B, int64_t ldb );
+    double const* tau,
+    double* C, int64_t ldc );
 
-int64_t potrs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float> const* A, int64_t lda,
-    std::complex<float>* B, int64_t ldb );
+// unmrz alias to ormrz
+inline int64_t unmrz(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc )
+{
+    return ormrz( side, trans, m, n, k, l, A, lda, tau, C, ldc );
+}
 
-int64_t potrs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double> const* A, int64_t lda,
-    std::complex<double>* B, int64_t ldb );
+void ormrz_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    int64_t* lwork );
+
+// unmrz_work_size alias to ormrz_work_size
+inline void unmrz_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    int64_t* lwork )
+{
+    ormrz_work_size( side, trans, m, n, k, l, A, lda, tau, C, ldc, lwork );
+}
+
+void ormrz_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    int64_t* lwork );
+
+// unmrz_work_size alias to ormrz_work_size
+inline void unmrz_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    int64_t* lwork )
+{
+    ormrz_work_size( side, trans, m, n, k, l, A, lda, tau, C, ldc, lwork );
+}
+
+int64_t ormrz(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    float* work, int64_t lwork );
+
+// unmrz alias to ormrz
+inline int64_t unmrz(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    float* work, int64_t lwork )
+{
+    return ormrz( side, trans, m, n, k, l, A, lda, tau, C, ldc, work, lwork );
+}
+
+int64_t ormrz(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    double* work, int64_t lwork );
+
+// unmrz alias to ormrz
+inline int64_t unmrz(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    double* work, int64_t lwork )
+{
+    return ormrz( side, trans, m, n, k, l, A, lda, tau, C, ldc, work, lwork );
+}
 
 // -----------------------------------------------------------------------------
-int64_t ppcon(
-    lapack::Uplo uplo, int64_t n,
-    float const* AP, float anorm,
+int64_t ormtr(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc );
+
+// unmtr alias to ormtr
+inline int64_t unmtr(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc )
+{
+    return ormtr( side, uplo, trans, m, n, A, lda, tau, C, ldc );
+}
+
+int64_t ormtr(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc );
+
+// unmtr alias to ormtr
+inline int64_t unmtr(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc )
+{
+    return ormtr( side, uplo, trans, m, n, A, lda, tau, C, ldc );
+}
+
+void ormtr_work_size(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    int64_t* lwork );
+
+// unmtr_work_size alias to ormtr_work_size
+inline void unmtr_work_size(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    int64_t* lwork )
+{
+    ormtr_work_size( side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork );
+}
+
+void ormtr_work_size(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    int64_t* lwork );
+
+// unmtr_work_size alias to ormtr_work_size
+inline void unmtr_work_size(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    int64_t* lwork )
+{
+    ormtr_work_size( side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork );
+}
+
+int64_t ormtr(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    float* work, int64_t lwork );
+
+// unmtr alias to ormtr
+inline int64_t unmtr(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    float* work, int64_t lwork )
+{
+    return ormtr( side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork );
+}
+
+int64_t ormtr(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    double* work, int64_t lwork );
+
+// unmtr alias to ormtr
+inline int64_t unmtr(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    double* work, int64_t lwork )
+{
+    return ormtr( side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t pbcon(
+    lapack::Uplo uplo, int64_t n, int64_t kd,
+    float const* AB, int64_t ldab, float anorm,
     float* rcond );
 
-int64_t ppcon(
-    lapack::Uplo uplo, int64_t n,
-    double const* AP, double anorm,
+int64_t pbcon(
+    lapack::Uplo uplo, int64_t n, int64_t kd,
+    double const* AB, int64_t ldab, double anorm,
     double* rcond );
 
-int64_t ppcon(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float> const* AP, float anorm,
+int64_t pbcon(
+    lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float> const* AB, int64_t ldab, float anorm,
     float* rcond );
 
-int64_t ppcon(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double> const* AP, double anorm,
+int64_t pbcon(
+    lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double> const* AB, int64_t ldab, double anorm,
     double* rcond );
 
 // -----------------------------------------------------------------------------
-int64_t ppequ(
-    lapack::Uplo uplo, int64_t n,
-    float const* AP,
+int64_t pbequ(
+    lapack::Uplo uplo, int64_t n, int64_t kd,
+    float const* AB, int64_t ldab,
     float* S,
     float* scond,
     float* amax );
 
-int64_t ppequ(
-    lapack::Uplo uplo, int64_t n,
-    double const* AP,
+int64_t pbequ(
+    lapack::Uplo uplo, int64_t n, int64_t kd,
+    double const* AB, int64_t ldab,
     double* S,
     double* scond,
     double* amax );
 
-int64_t ppequ(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float> const* AP,
+int64_t pbequ(
+    lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float> const* AB, int64_t ldab,
     float* S,
     float* scond,
     float* amax );
 
-int64_t ppequ(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double> const* AP,
+int64_t pbequ(
+    lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double> const* AB, int64_t ldab,
     double* S,
     double* scond,
     double* amax );
 
 // -----------------------------------------------------------------------------
-int64_t pprfs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float const* AP,
-    float const* AFP,
+int64_t pbrfs(
+    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
+    float const* AB, int64_t ldab,
+    float const* AFB, int64_t ldafb,
     float const* B, int64_t ldb,
     float* X, int64_t ldx,
     float* ferr,
     float* berr );
 
-int64_t pprfs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double const* AP,
-    double const* AFP,
+int64_t pbrfs(
+    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
+    double const* AB, int64_t ldab,
+    double const* AFB, int64_t ldafb,
     double const* B, int64_t ldb,
     double* X, int64_t ldx,
     double* ferr,
     double* berr );
 
-int64_t pprfs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float> const* AP,
-    std::complex<float> const* AFP,
+int64_t pbrfs(
+    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
+    std::complex<float> const* AB, int64_t ldab,
+    std::complex<float> const* AFB, int64_t ldafb,
     std::complex<float> const* B, int64_t ldb,
     std::complex<float>* X, int64_t ldx,
     float* ferr,
     float* berr );
 
-int64_t pprfs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double> const* AP,
-    std::complex<double> const* AFP,
+int64_t pbrfs(
+    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
+    std::complex<double> const* AB, int64_t ldab,
+    std::complex<double> const* AFB, int64_t ldafb,
     std::complex<double> const* B, int64_t ldb,
     std::complex<double>* X, int64_t ldx,
     double* ferr,
     double* berr );
 
 // -----------------------------------------------------------------------------
-int64_t ppsv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float* AP,
-    float* B, int64_t ldb );
-
-int64_t ppsv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double* AP,
-    double* B, int64_t ldb );
+int64_t pbstf(
+    lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab );
 
-int64_t ppsv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float>* AP,
-    std::complex<float>* B, int64_t ldb );
+int64_t pbstf(
+    lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab );
 
-int64_t ppsv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double>* AP,
+int64_t pbstf(
+    lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab );
+
+int64_t pbstf(
+    lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab );
+
+// -----------------------------------------------------------------------------
+int64_t pbsv(
+    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
+    float* AB, int64_t ldab,
+    float* B, int64_t ldb );
+
+int64_t pbsv(
+    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
+    double* AB, int64_t ldab,
+    double* B, int64_t ldb );
+
+int64_t pbsv(
+    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
+    std::complex<float>* AB, int64_t ldab,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t pbsv(
+    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
+    std::complex<double>* AB, int64_t ldab,
     std::complex<double>* B, int64_t ldb );
 
 // -----------------------------------------------------------------------------
-int64_t ppsvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float* AP,
-    float* AFP,
+int64_t pbsvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
+    float* AB, int64_t ldab,
+    float* AFB, int64_t ldafb,
     lapack::Equed* equed,
     float* S,
     float* B, int64_t ldb,
@@ -5809,10 +9119,10 @@ int64_t ppsvx(
     float* ferr,
     float* berr );
 
-int64_t ppsvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double* AP,
-    double* AFP,
+int64_t pbsvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
+    double* AB, int64_t ldab,
+    double* AFB, int64_t ldafb,
     lapack::Equed* equed,
     double* S,
     double* B, int64_t ldb,
@@ -5821,10 +9131,10 @@ int64_t ppsvx(
     double* ferr,
     double* berr );
 
-int64_t ppsvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float>* AP,
-    std::complex<float>* AFP,
+int64_t pbsvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
+    std::complex<float>* AB, int64_t ldab,
+    std::complex<float>* AFB, int64_t ldafb,
     lapack::Equed* equed,
     float* S,
     std::complex<float>* B, int64_t ldb,
@@ -5833,10 +9143,10 @@ int64_t ppsvx(
     float* ferr,
     float* berr );
 
-int64_t ppsvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double>* AP,
-    std::complex<double>* AFP,
+int64_t pbsvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
+    std::complex<double>* AB, int64_t ldab,
+    std::complex<double>* AFB, int64_t ldafb,
     lapack::Equed* equed,
     double* S,
     std::complex<double>* B, int64_t ldb,
@@ -5846,2973 +9156,6525 @@ int64_t ppsvx(
     double* berr );
 
 // -----------------------------------------------------------------------------
-int64_t pptrf(
-    lapack::Uplo uplo, int64_t n,
-    float* AP );
+int64_t pbtrf(
+    lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab );
 
-int64_t pptrf(
-    lapack::Uplo uplo, int64_t n,
-    double* AP );
+int64_t pbtrf(
+    lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab );
 
-int64_t pptrf(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float>* AP );
+int64_t pbtrf(
+    lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab );
 
-int64_t pptrf(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double>* AP );
+int64_t pbtrf(
+    lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab );
 
 // -----------------------------------------------------------------------------
-int64_t pptri(
-    lapack::Uplo uplo, int64_t n,
-    float* AP );
+int64_t pbtrs(
+    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
+    float const* AB, int64_t ldab,
+    float* B, int64_t ldb );
 
-int64_t pptri(
-    lapack::Uplo uplo, int64_t n,
-    double* AP );
+int64_t pbtrs(
+    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
+    double const* AB, int64_t ldab,
+    double* B, int64_t ldb );
 
-int64_t pptri(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float>* AP );
+int64_t pbtrs(
+    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
+    std::complex<float> const* AB, int64_t ldab,
+    std::complex<float>* B, int64_t ldb );
 
-int64_t pptri(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double>* AP );
+int64_t pbtrs(
+    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
+    std::complex<double> const* AB, int64_t ldab,
+    std::complex<double>* B, int64_t ldb );
 
 // -----------------------------------------------------------------------------
-int64_t pptrs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float const* AP,
+int64_t pftrf(
+    lapack::Op transr, lapack::Uplo uplo, int64_t n,
+    float* A );
+
+int64_t pftrf(
+    lapack::Op transr, lapack::Uplo uplo, int64_t n,
+    double* A );
+
+int64_t pftrf(
+    lapack::Op transr, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A );
+
+int64_t pftrf(
+    lapack::Op transr, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A );
+
+// -----------------------------------------------------------------------------
+int64_t pftri(
+    lapack::Op transr, lapack::Uplo uplo, int64_t n,
+    float* A );
+
+int64_t pftri(
+    lapack::Op transr, lapack::Uplo uplo, int64_t n,
+    double* A );
+
+int64_t pftri(
+    lapack::Op transr, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A );
+
+int64_t pftri(
+    lapack::Op transr, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A );
+
+// -----------------------------------------------------------------------------
+int64_t pftrs(
+    lapack::Op transr, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A,
     float* B, int64_t ldb );
 
-int64_t pptrs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double const* AP,
+int64_t pftrs(
+    lapack::Op transr, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A,
     double* B, int64_t ldb );
 
-int64_t pptrs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float> const* AP,
+int64_t pftrs(
+    lapack::Op transr, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A,
     std::complex<float>* B, int64_t ldb );
 
-int64_t pptrs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double> const* AP,
+int64_t pftrs(
+    lapack::Op transr, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A,
     std::complex<double>* B, int64_t ldb );
 
 // -----------------------------------------------------------------------------
-int64_t pstrf(
+int64_t pocon(
     lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda,
-    int64_t* piv,
-    int64_t* rank, float tol );
+    float const* A, int64_t lda, float anorm,
+    float* rcond );
 
-int64_t pstrf(
+int64_t pocon(
     lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda,
-    int64_t* piv,
-    int64_t* rank, double tol );
+    double const* A, int64_t lda, double anorm,
+    double* rcond );
 
-int64_t pstrf(
+int64_t pocon(
     lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda,
-    int64_t* piv,
-    int64_t* rank, float tol );
+    std::complex<float> const* A, int64_t lda, float anorm,
+    float* rcond );
 
-int64_t pstrf(
+int64_t pocon(
     lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A, int64_t lda,
-    int64_t* piv,
-    int64_t* rank, double tol );
+    std::complex<double> const* A, int64_t lda, double anorm,
+    double* rcond );
 
 // -----------------------------------------------------------------------------
-int64_t ptcon(
+int64_t poequ(
     int64_t n,
-    float const* D,
-    float const* E, float anorm,
-    float* rcond );
+    float const* A, int64_t lda,
+    float* S,
+    float* scond,
+    float* amax );
 
-int64_t ptcon(
+int64_t poequ(
     int64_t n,
-    double const* D,
-    double const* E, double anorm,
-    double* rcond );
+    double const* A, int64_t lda,
+    double* S,
+    double* scond,
+    double* amax );
 
-int64_t ptcon(
+int64_t poequ(
     int64_t n,
-    float const* D,
-    std::complex<float> const* E, float anorm,
-    float* rcond );
+    std::complex<float> const* A, int64_t lda,
+    float* S,
+    float* scond,
+    float* amax );
 
-int64_t ptcon(
+int64_t poequ(
     int64_t n,
-    double const* D,
-    std::complex<double> const* E, double anorm,
-    double* rcond );
+    std::complex<double> const* A, int64_t lda,
+    double* S,
+    double* scond,
+    double* amax );
 
 // -----------------------------------------------------------------------------
-int64_t pteqr(
-    lapack::Job compz, int64_t n,
-    float* D,
-    float* E,
-    float* Z, int64_t ldz );
-
-int64_t pteqr(
-    lapack::Job compz, int64_t n,
-    double* D,
-    double* E,
-    double* Z, int64_t ldz );
+int64_t poequb(
+    int64_t n,
+    float const* A, int64_t lda,
+    float* S,
+    float* scond,
+    float* amax );
 
-int64_t pteqr(
-    lapack::Job compz, int64_t n,
-    float* D,
-    float* E,
-    std::complex<float>* Z, int64_t ldz );
+int64_t poequb(
+    int64_t n,
+    double const* A, int64_t lda,
+    double* S,
+    double* scond,
+    double* amax );
 
-int64_t pteqr(
-    lapack::Job compz, int64_t n,
-    double* D,
-    double* E,
-    std::complex<double>* Z, int64_t ldz );
+int64_t poequb(
+    int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    float* S,
+    float* scond,
+    float* amax );
+
+int64_t poequb(
+    int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    double* S,
+    double* scond,
+    double* amax );
 
 // -----------------------------------------------------------------------------
-int64_t ptrfs(
-    int64_t n, int64_t nrhs,
-    float const* D,
-    float const* E,
-    float const* DF,
-    float const* EF,
+int64_t porfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float const* AF, int64_t ldaf,
     float const* B, int64_t ldb,
     float* X, int64_t ldx,
     float* ferr,
     float* berr );
 
-// alias to match complex version (ignoring uplo)
-inline int64_t ptrfs(
-    lapack::Uplo uplo,
-    int64_t n, int64_t nrhs,
-    float const* D,
-    float const* E,
-    float const* DF,
-    float const* EF,
-    float const* B, int64_t ldb,
-    float* X, int64_t ldx,
-    float* ferr,
-    float* berr )
-{
-    return ptrfs( n, nrhs, D, E, DF, EF, B, ldb, X, ldx, ferr, berr );
-}
-
-int64_t ptrfs(
-    int64_t n, int64_t nrhs,
-    double const* D,
-    double const* E,
-    double const* DF,
-    double const* EF,
+int64_t porfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double const* AF, int64_t ldaf,
     double const* B, int64_t ldb,
     double* X, int64_t ldx,
     double* ferr,
     double* berr );
 
-// alias to match complex version (ignoring uplo)
-inline int64_t ptrfs(
-    lapack::Uplo uplo,
-    int64_t n, int64_t nrhs,
-    double const* D,
-    double const* E,
-    double const* DF,
-    double const* EF,
-    double const* B, int64_t ldb,
-    double* X, int64_t ldx,
-    double* ferr,
-    double* berr )
-{
-    return ptrfs( n, nrhs, D, E, DF, EF, B, ldb, X, ldx, ferr, berr );
-}
-
-int64_t ptrfs(
+int64_t porfs(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float const* D,
-    std::complex<float> const* E,
-    float const* DF,
-    std::complex<float> const* EF,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* AF, int64_t ldaf,
     std::complex<float> const* B, int64_t ldb,
     std::complex<float>* X, int64_t ldx,
     float* ferr,
     float* berr );
 
-int64_t ptrfs(
+int64_t porfs(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double const* D,
-    std::complex<double> const* E,
-    double const* DF,
-    std::complex<double> const* EF,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* AF, int64_t ldaf,
     std::complex<double> const* B, int64_t ldb,
     std::complex<double>* X, int64_t ldx,
     double* ferr,
     double* berr );
 
 // -----------------------------------------------------------------------------
-int64_t ptsv(
-    int64_t n, int64_t nrhs,
-    float* D,
-    float* E,
-    float* B, int64_t ldb );
-
-int64_t ptsv(
-    int64_t n, int64_t nrhs,
-    double* D,
-    double* E,
-    double* B, int64_t ldb );
-
-int64_t ptsv(
-    int64_t n, int64_t nrhs,
-    float* D,
-    std::complex<float>* E,
-    std::complex<float>* B, int64_t ldb );
-
-int64_t ptsv(
-    int64_t n, int64_t nrhs,
-    double* D,
-    std::complex<double>* E,
-    std::complex<double>* B, int64_t ldb );
-
-// -----------------------------------------------------------------------------
-int64_t ptsvx(
-    lapack::Factored fact, int64_t n, int64_t nrhs,
-    float const* D,
-    float const* E,
-    float* DF,
-    float* EF,
+int64_t porfsx(
+    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float const* AF, int64_t ldaf,
+    float* S,
     float const* B, int64_t ldb,
     float* X, int64_t ldx,
     float* rcond,
-    float* ferr,
-    float* berr );
+    float* berr, int64_t n_err_bnds,
+    float* err_bnds_norm,
+    float* err_bnds_comp, int64_t nparams,
+    float* params );
 
-int64_t ptsvx(
-    lapack::Factored fact, int64_t n, int64_t nrhs,
-    double const* D,
-    double const* E,
-    double* DF,
-    double* EF,
+int64_t porfsx(
+    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double const* AF, int64_t ldaf,
+    double* S,
     double const* B, int64_t ldb,
     double* X, int64_t ldx,
     double* rcond,
-    double* ferr,
-    double* berr );
+    double* berr, int64_t n_err_bnds,
+    double* err_bnds_norm,
+    double* err_bnds_comp, int64_t nparams,
+    double* params );
 
-int64_t ptsvx(
-    lapack::Factored fact, int64_t n, int64_t nrhs,
-    float const* D,
-    std::complex<float> const* E,
-    float* DF,
-    std::complex<float>* EF,
+int64_t porfsx(
+    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* AF, int64_t ldaf,
+    float* S,
     std::complex<float> const* B, int64_t ldb,
     std::complex<float>* X, int64_t ldx,
     float* rcond,
-    float* ferr,
-    float* berr );
+    float* berr, int64_t n_err_bnds,
+    float* err_bnds_norm,
+    float* err_bnds_comp, int64_t nparams,
+    float* params );
 
-int64_t ptsvx(
-    lapack::Factored fact, int64_t n, int64_t nrhs,
-    double const* D,
-    std::complex<double> const* E,
-    double* DF,
-    std::complex<double>* EF,
+int64_t porfsx(
+    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* AF, int64_t ldaf,
+    double* S,
     std::complex<double> const* B, int64_t ldb,
     std::complex<double>* X, int64_t ldx,
     double* rcond,
-    double* ferr,
-    double* berr );
-
-// -----------------------------------------------------------------------------
-int64_t pttrf(
-    int64_t n,
-    float* D,
-    float* E );
-
-int64_t pttrf(
-    int64_t n,
-    double* D,
-    double* E );
-
-int64_t pttrf(
-    int64_t n,
-    float* D,
-    std::complex<float>* E );
-
-int64_t pttrf(
-    int64_t n,
-    double* D,
-    std::complex<double>* E );
+    double* berr, int64_t n_err_bnds,
+    double* err_bnds_norm,
+    double* err_bnds_comp, int64_t nparams,
+    double* params );
 
 // -----------------------------------------------------------------------------
-int64_t pttrs(
-    int64_t n, int64_t nrhs,
-    float const* D,
-    float const* E,
+int64_t posv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
     float* B, int64_t ldb );
 
-// alias with uplo to match complex (it is ignored)
-inline int64_t pttrs(
+int64_t posv(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float const* D,
-    float const* E,
-    float* B, int64_t ldb )
-{
-    return pttrs( n, nrhs, D, E, B, ldb );
-}
-
-int64_t pttrs(
-    int64_t n, int64_t nrhs,
-    double const* D,
-    double const* E,
+    double* A, int64_t lda,
     double* B, int64_t ldb );
 
-// alias with uplo to match complex (it is ignored)
-inline int64_t pttrs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double const* D,
-    double const* E,
-    double* B, int64_t ldb )
-{
-    return pttrs( n, nrhs, D, E, B, ldb );
-}
-
-int64_t pttrs(
+int64_t posv(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float const* D,
-    std::complex<float> const* E,
+    std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb );
 
-int64_t pttrs(
+int64_t posv(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double const* D,
-    std::complex<double> const* E,
+    std::complex<double>* A, int64_t lda,
     std::complex<double>* B, int64_t ldb );
 
-// -----------------------------------------------------------------------------
-int64_t sbev(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    float* AB, int64_t ldab,
-    float* W,
-    float* Z, int64_t ldz );
+int64_t posv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    int64_t* iter );
 
-// hbev alias to sbev
-inline int64_t hbev(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    float* AB, int64_t ldab,
-    float* W,
-    float* Z, int64_t ldz )
-{
-    return sbev( jobz, uplo, n, kd, AB, ldab, W, Z, ldz );
-}
+int64_t posv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    int64_t* iter );
 
-int64_t sbev(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    double* AB, int64_t ldab,
-    double* W,
-    double* Z, int64_t ldz );
+int64_t posv(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb );
 
-// hbev alias to sbev
-inline int64_t hbev(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    double* AB, int64_t ldab,
-    double* W,
-    double* Z, int64_t ldz )
-{
-    return sbev( jobz, uplo, n, kd, AB, ldab, W, Z, ldz );
-}
+int64_t posv(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb );
+
+int64_t posv(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t posv(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb );
 
 // -----------------------------------------------------------------------------
-int64_t sbev_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    float* AB, int64_t ldab,
-    float* W,
-    float* Z, int64_t ldz );
+int64_t posvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* AF, int64_t ldaf,
+    lapack::Equed* equed,
+    float* S,
+    float* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr );
 
-// hbev_2stage alias to sbev_2stage
-inline int64_t hbev_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    float* AB, int64_t ldab,
-    float* W,
-    float* Z, int64_t ldz )
-{
-    return sbev_2stage( jobz, uplo, n, kd, AB, ldab, W, Z, ldz );
-}
+int64_t posvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* AF, int64_t ldaf,
+    lapack::Equed* equed,
+    double* S,
+    double* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr );
 
-int64_t sbev_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    double* AB, int64_t ldab,
-    double* W,
-    double* Z, int64_t ldz );
+int64_t posvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* AF, int64_t ldaf,
+    lapack::Equed* equed,
+    float* S,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr );
 
-// hbev_2stage alias to sbev_2stage
-inline int64_t hbev_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    double* AB, int64_t ldab,
-    double* W,
-    double* Z, int64_t ldz )
-{
-    return sbev_2stage( jobz, uplo, n, kd, AB, ldab, W, Z, ldz );
-}
+int64_t posvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* AF, int64_t ldaf,
+    lapack::Equed* equed,
+    double* S,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr );
 
 // -----------------------------------------------------------------------------
-int64_t sbevd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    float* AB, int64_t ldab,
-    float* W,
-    float* Z, int64_t ldz );
+int64_t potf2(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda );
 
-// hbevd alias to sbevd
-inline int64_t hbevd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    float* AB, int64_t ldab,
-    float* W,
-    float* Z, int64_t ldz )
-{
-    return sbevd( jobz, uplo, n, kd, AB, ldab, W, Z, ldz );
-}
+int64_t potf2(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda );
 
-int64_t sbevd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    double* AB, int64_t ldab,
-    double* W,
-    double* Z, int64_t ldz );
+int64_t potf2(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda );
 
-// hbevd alias to sbevd
-inline int64_t hbevd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    double* AB, int64_t ldab,
-    double* W,
-    double* Z, int64_t ldz )
-{
-    return sbevd( jobz, uplo, n, kd, AB, ldab, W, Z, ldz );
-}
+int64_t potf2(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda );
 
 // -----------------------------------------------------------------------------
-int64_t sbevd_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    float* AB, int64_t ldab,
-    float* W,
-    float* Z, int64_t ldz );
+int64_t potrf(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda );
 
-// hbevd_2stage alias to sbevd_2stage
-inline int64_t hbevd_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    float* AB, int64_t ldab,
-    float* W,
-    float* Z, int64_t ldz )
-{
-    return sbevd_2stage( jobz, uplo, n, kd, AB, ldab, W, Z, ldz );
-}
+int64_t potrf(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda );
 
-int64_t sbevd_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    double* AB, int64_t ldab,
-    double* W,
-    double* Z, int64_t ldz );
+int64_t potrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda );
 
-// hbevd_2stage alias to sbevd_2stage
-inline int64_t hbevd_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    double* AB, int64_t ldab,
-    double* W,
-    double* Z, int64_t ldz )
-{
-    return sbevd_2stage( jobz, uplo, n, kd, AB, ldab, W, Z, ldz );
-}
+int64_t potrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda );
 
-// -----------------------------------------------------------------------------
-int64_t sbevx(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
-    float* AB, int64_t ldab,
-    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    float* Z, int64_t ldz,
-    int64_t* ifail );
+int64_t potrf(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda );
 
-// hbevx alias to sbevx
-inline int64_t hbevx(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
-    float* AB, int64_t ldab,
-    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    float* Z, int64_t ldz,
-    int64_t* ifail )
-{
-    return sbevx( jobz, range, uplo, n, kd, AB, ldab, Q, ldq, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
-}
+int64_t potrf(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda );
 
-int64_t sbevx(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
-    double* AB, int64_t ldab,
-    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    double* Z, int64_t ldz,
-    int64_t* ifail );
+int64_t potrf(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda );
 
-// hbevx alias to sbevx
-inline int64_t hbevx(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
-    double* AB, int64_t ldab,
-    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    double* Z, int64_t ldz,
-    int64_t* ifail )
-{
-    return sbevx( jobz, range, uplo, n, kd, AB, ldab, Q, ldq, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
-}
+int64_t potrf(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda );
 
 // -----------------------------------------------------------------------------
-int64_t sbevx_2stage(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
-    float* AB, int64_t ldab,
-    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    float* Z, int64_t ldz,
-    int64_t* ifail );
+int64_t potrf_downdate(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* X, int64_t ldx );
 
-// hbevx_2stage alias to sbevx_2stage
-inline int64_t hbevx_2stage(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
-    float* AB, int64_t ldab,
-    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    float* Z, int64_t ldz,
-    int64_t* ifail )
-{
-    return sbevx_2stage( jobz, range, uplo, n, kd, AB, ldab, Q, ldq, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
-}
+int64_t potrf_downdate(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* X, int64_t ldx );
 
-int64_t sbevx_2stage(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
-    double* AB, int64_t ldab,
-    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    double* Z, int64_t ldz,
-    int64_t* ifail );
+int64_t potrf_downdate(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* X, int64_t ldx );
 
-// hbevx_2stage alias to sbevx_2stage
-inline int64_t hbevx_2stage(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
-    double* AB, int64_t ldab,
-    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    double* Z, int64_t ldz,
-    int64_t* ifail )
-{
-    return sbevx_2stage( jobz, range, uplo, n, kd, AB, ldab, Q, ldq, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
-}
+int64_t potrf_downdate(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* X, int64_t ldx );
 
 // -----------------------------------------------------------------------------
-int64_t sbgst(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
-    float* AB, int64_t ldab,
-    float const* BB, int64_t ldbb,
-    float* X, int64_t ldx );
+int64_t potrf_tiled(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, int64_t nb=256 );
 
-// hbgst alias to sbgst
-inline int64_t hbgst(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
-    float* AB, int64_t ldab,
-    float const* BB, int64_t ldbb,
-    float* X, int64_t ldx )
-{
-    return sbgst( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, X, ldx );
-}
+int64_t potrf_tiled(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, int64_t nb=256 );
 
-int64_t sbgst(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
-    double* AB, int64_t ldab,
-    double const* BB, int64_t ldbb,
-    double* X, int64_t ldx );
+int64_t potrf_tiled(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t nb=256 );
 
-// hbgst alias to sbgst
-inline int64_t hbgst(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
-    double* AB, int64_t ldab,
-    double const* BB, int64_t ldbb,
-    double* X, int64_t ldx )
-{
-    return sbgst( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, X, ldx );
-}
+int64_t potrf_tiled(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t nb=256 );
+
+void potrf_set_method(
+    lapack::MethodCholesky method, int64_t nb=256 );
+
+lapack::MethodCholesky potrf_method();
 
 // -----------------------------------------------------------------------------
-int64_t sbgv(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
-    float* AB, int64_t ldab,
-    float* BB, int64_t ldbb,
-    float* W,
-    float* Z, int64_t ldz );
+int64_t potrf_update(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* X, int64_t ldx );
 
-// hbgv alias to sbgv
-inline int64_t hbgv(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
-    float* AB, int64_t ldab,
-    float* BB, int64_t ldbb,
-    float* W,
-    float* Z, int64_t ldz )
-{
-    return sbgv( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz );
-}
+int64_t potrf_update(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* X, int64_t ldx );
 
-int64_t sbgv(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
-    double* AB, int64_t ldab,
-    double* BB, int64_t ldbb,
-    double* W,
-    double* Z, int64_t ldz );
+int64_t potrf_update(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* X, int64_t ldx );
 
-// hbgv alias to sbgv
-inline int64_t hbgv(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
-    double* AB, int64_t ldab,
-    double* BB, int64_t ldbb,
-    double* W,
-    double* Z, int64_t ldz )
-{
-    return sbgv( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz );
-}
+int64_t potrf_update(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* X, int64_t ldx );
 
 // -----------------------------------------------------------------------------
-int64_t sbgvd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
-    float* AB, int64_t ldab,
-    float* BB, int64_t ldbb,
-    float* W,
-    float* Z, int64_t ldz );
+int64_t potrf2(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda );
 
-// hbgvd alias to sbgvd
-inline int64_t hbgvd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
-    float* AB, int64_t ldab,
-    float* BB, int64_t ldbb,
-    float* W,
-    float* Z, int64_t ldz )
-{
-    return sbgvd( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz );
-}
+int64_t potrf2(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda );
 
-int64_t sbgvd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
-    double* AB, int64_t ldab,
-    double* BB, int64_t ldbb,
-    double* W,
-    double* Z, int64_t ldz );
+int64_t potrf2(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda );
 
-// hbgvd alias to sbgvd
-inline int64_t hbgvd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
-    double* AB, int64_t ldab,
-    double* BB, int64_t ldbb,
-    double* W,
-    double* Z, int64_t ldz )
-{
-    return sbgvd( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz );
-}
+int64_t potrf2(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda );
 
 // -----------------------------------------------------------------------------
-int64_t sbgvx(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
-    float* AB, int64_t ldab,
-    float* BB, int64_t ldbb,
-    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    float* Z, int64_t ldz,
-    int64_t* ifail );
+int64_t potri(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda );
 
-// hbgvx alias to sbgvx
-inline int64_t hbgvx(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
-    float* AB, int64_t ldab,
-    float* BB, int64_t ldbb,
-    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    float* Z, int64_t ldz,
-    int64_t* ifail )
-{
-    return sbgvx( jobz, range, uplo, n, ka, kb, AB, ldab, BB, ldbb, Q, ldq, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
-}
+int64_t potri(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda );
 
-int64_t sbgvx(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
-    double* AB, int64_t ldab,
-    double* BB, int64_t ldbb,
-    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    double* Z, int64_t ldz,
-    int64_t* ifail );
+int64_t potri(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda );
 
-// hbgvx alias to sbgvx
-inline int64_t hbgvx(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
-    double* AB, int64_t ldab,
-    double* BB, int64_t ldbb,
-    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    double* Z, int64_t ldz,
-    int64_t* ifail )
-{
-    return sbgvx( jobz, range, uplo, n, ka, kb, AB, ldab, BB, ldbb, Q, ldq, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
-}
+int64_t potri(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda );
 
 // -----------------------------------------------------------------------------
-int64_t sbtrd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    float* AB, int64_t ldab,
-    float* D,
-    float* E,
-    float* Q, int64_t ldq );
+int64_t potrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float* B, int64_t ldb );
 
-// hbtrd alias to sbtrd
-inline int64_t hbtrd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    float* AB, int64_t ldab,
-    float* D,
-    float* E,
-    float* Q, int64_t ldq )
-{
-    return sbtrd( jobz, uplo, n, kd, AB, ldab, D, E, Q, ldq );
-}
+int64_t potrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double* B, int64_t ldb );
 
-int64_t sbtrd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    double* AB, int64_t ldab,
-    double* D,
-    double* E,
-    double* Q, int64_t ldq );
+int64_t potrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb );
 
-// hbtrd alias to sbtrd
-inline int64_t hbtrd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    double* AB, int64_t ldab,
-    double* D,
-    double* E,
-    double* Q, int64_t ldq )
-{
-    return sbtrd( jobz, uplo, n, kd, AB, ldab, D, E, Q, ldq );
-}
+int64_t potrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb );
 
-// -----------------------------------------------------------------------------
-void sfrk(
-    lapack::Op transr, lapack::Uplo uplo, lapack::Op trans, int64_t n, int64_t k, float alpha,
-    float const* A, int64_t lda, float beta,
-    float* C );
+int64_t potrs(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float* B, int64_t ldb );
 
-void sfrk(
-    lapack::Op transr, lapack::Uplo uplo, lapack::Op trans, int64_t n, int64_t k, double alpha,
-    double const* A, int64_t lda, double beta,
-    double* C );
+int64_t potrs(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double* B, int64_t ldb );
+
+int64_t potrs(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t potrs(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb );
 
 // -----------------------------------------------------------------------------
-int64_t spcon(
+int64_t ppcon(
     lapack::Uplo uplo, int64_t n,
-    float const* AP,
-    int64_t const* ipiv, float anorm,
+    float const* AP, float anorm,
     float* rcond );
 
-// hpcon alias to spcon
-inline int64_t hpcon(
+int64_t ppcon(
     lapack::Uplo uplo, int64_t n,
-    float const* AP,
-    int64_t const* ipiv, float anorm,
-    float* rcond )
-{
-    return spcon( uplo, n, AP, ipiv, anorm, rcond );
-}
+    double const* AP, double anorm,
+    double* rcond );
 
-int64_t spcon(
+int64_t ppcon(
     lapack::Uplo uplo, int64_t n,
-    double const* AP,
-    int64_t const* ipiv, double anorm,
+    std::complex<float> const* AP, float anorm,
+    float* rcond );
+
+int64_t ppcon(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double> const* AP, double anorm,
     double* rcond );
 
-// hpcon alias to spcon
-inline int64_t hpcon(
+// -----------------------------------------------------------------------------
+int64_t ppequ(
+    lapack::Uplo uplo, int64_t n,
+    float const* AP,
+    float* S,
+    float* scond,
+    float* amax );
+
+int64_t ppequ(
     lapack::Uplo uplo, int64_t n,
     double const* AP,
-    int64_t const* ipiv, double anorm,
-    double* rcond )
-{
-    return spcon( uplo, n, AP, ipiv, anorm, rcond );
-}
+    double* S,
+    double* scond,
+    double* amax );
 
-int64_t spcon(
+int64_t ppequ(
     lapack::Uplo uplo, int64_t n,
     std::complex<float> const* AP,
-    int64_t const* ipiv, float anorm,
-    float* rcond );
+    float* S,
+    float* scond,
+    float* amax );
 
-int64_t spcon(
+int64_t ppequ(
     lapack::Uplo uplo, int64_t n,
     std::complex<double> const* AP,
-    int64_t const* ipiv, double anorm,
-    double* rcond );
+    double* S,
+    double* scond,
+    double* amax );
 
 // -----------------------------------------------------------------------------
-int64_t spev(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    float* AP,
-    float* W,
-    float* Z, int64_t ldz );
+int64_t pprfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* AP,
+    float const* AFP,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* ferr,
+    float* berr );
 
-// hpev alias to spev
-inline int64_t hpev(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    float* AP,
-    float* W,
-    float* Z, int64_t ldz )
-{
-    return spev( jobz, uplo, n, AP, W, Z, ldz );
-}
+int64_t pprfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* AP,
+    double const* AFP,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* ferr,
+    double* berr );
 
-int64_t spev(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    double* AP,
-    double* W,
-    double* Z, int64_t ldz );
+int64_t pprfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* AP,
+    std::complex<float> const* AFP,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    float* ferr,
+    float* berr );
 
-// hpev alias to spev
-inline int64_t hpev(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    double* AP,
-    double* W,
-    double* Z, int64_t ldz )
-{
-    return spev( jobz, uplo, n, AP, W, Z, ldz );
-}
+int64_t pprfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* AP,
+    std::complex<double> const* AFP,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double* ferr,
+    double* berr );
 
 // -----------------------------------------------------------------------------
-int64_t spevd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    float* AP,
-    float* W,
-    float* Z, int64_t ldz );
-
-// hpevd alias to spevd
-inline int64_t hpevd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+int64_t ppsv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
     float* AP,
-    float* W,
-    float* Z, int64_t ldz )
-{
-    return spevd( jobz, uplo, n, AP, W, Z, ldz );
-}
-
-int64_t spevd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    double* AP,
-    double* W,
-    double* Z, int64_t ldz );
+    float* B, int64_t ldb );
 
-// hpevd alias to spevd
-inline int64_t hpevd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+int64_t ppsv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
     double* AP,
-    double* W,
-    double* Z, int64_t ldz )
-{
-    return spevd( jobz, uplo, n, AP, W, Z, ldz );
-}
-
-// -----------------------------------------------------------------------------
-int64_t spevx(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    float* AP, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    float* Z, int64_t ldz,
-    int64_t* ifail );
-
-// hpevx alias to spevx
-inline int64_t hpevx(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    float* AP, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    float* Z, int64_t ldz,
-    int64_t* ifail )
-{
-    return spevx( jobz, range, uplo, n, AP, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
-}
+    double* B, int64_t ldb );
 
-int64_t spevx(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    double* AP, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    double* Z, int64_t ldz,
-    int64_t* ifail );
+int64_t ppsv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* AP,
+    std::complex<float>* B, int64_t ldb );
 
-// hpevx alias to spevx
-inline int64_t hpevx(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    double* AP, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    double* Z, int64_t ldz,
-    int64_t* ifail )
-{
-    return spevx( jobz, range, uplo, n, AP, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
-}
+int64_t ppsv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* AP,
+    std::complex<double>* B, int64_t ldb );
 
 // -----------------------------------------------------------------------------
-int64_t spgst(
-    int64_t itype, lapack::Uplo uplo, int64_t n,
-    float* AP,
-    float const* BP );
-
-// hpgst alias to spgst
-inline int64_t hpgst(
-    int64_t itype, lapack::Uplo uplo, int64_t n,
+int64_t ppsvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
     float* AP,
-    float const* BP )
-{
-    return spgst( itype, uplo, n, AP, BP );
-}
-
-int64_t spgst(
-    int64_t itype, lapack::Uplo uplo, int64_t n,
-    double* AP,
-    double const* BP );
+    float* AFP,
+    lapack::Equed* equed,
+    float* S,
+    float* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr );
 
-// hpgst alias to spgst
-inline int64_t hpgst(
-    int64_t itype, lapack::Uplo uplo, int64_t n,
+int64_t ppsvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
     double* AP,
-    double const* BP )
-{
-    return spgst( itype, uplo, n, AP, BP );
-}
-
-// -----------------------------------------------------------------------------
-int64_t spgv(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    float* AP,
-    float* BP,
-    float* W,
-    float* Z, int64_t ldz );
-
-// hpgv alias to spgv
-inline int64_t hpgv(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    float* AP,
-    float* BP,
-    float* W,
-    float* Z, int64_t ldz )
-{
-    return spgv( itype, jobz, uplo, n, AP, BP, W, Z, ldz );
-}
+    double* AFP,
+    lapack::Equed* equed,
+    double* S,
+    double* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr );
 
-int64_t spgv(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    double* AP,
-    double* BP,
-    double* W,
-    double* Z, int64_t ldz );
+int64_t ppsvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* AP,
+    std::complex<float>* AFP,
+    lapack::Equed* equed,
+    float* S,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr );
 
-// hpgv alias to spgv
-inline int64_t hpgv(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    double* AP,
-    double* BP,
-    double* W,
-    double* Z, int64_t ldz )
-{
-    return spgv( itype, jobz, uplo, n, AP, BP, W, Z, ldz );
-}
+int64_t ppsvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* AP,
+    std::complex<double>* AFP,
+    lapack::Equed* equed,
+    double* S,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr );
 
 // -----------------------------------------------------------------------------
-int64_t spgvd(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    float* AP,
-    float* BP,
-    float* W,
-    float* Z, int64_t ldz );
+int64_t pptrf(
+    lapack::Uplo uplo, int64_t n,
+    float* AP );
 
-// hpgvd alias to spgvd
-inline int64_t hpgvd(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    float* AP,
-    float* BP,
-    float* W,
-    float* Z, int64_t ldz )
-{
-    return spgvd( itype, jobz, uplo, n, AP, BP, W, Z, ldz );
-}
+int64_t pptrf(
+    lapack::Uplo uplo, int64_t n,
+    double* AP );
 
-int64_t spgvd(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    double* AP,
-    double* BP,
-    double* W,
-    double* Z, int64_t ldz );
+int64_t pptrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* AP );
 
-// hpgvd alias to spgvd
-inline int64_t hpgvd(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    double* AP,
-    double* BP,
-    double* W,
-    double* Z, int64_t ldz )
-{
-    return spgvd( itype, jobz, uplo, n, AP, BP, W, Z, ldz );
-}
+int64_t pptrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* AP );
 
 // -----------------------------------------------------------------------------
-int64_t spgvx(
-    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    float* AP,
-    float* BP, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    float* Z, int64_t ldz,
-    int64_t* ifail );
+int64_t pptri(
+    lapack::Uplo uplo, int64_t n,
+    float* AP );
 
-// hpgvx alias to spgvx
-inline int64_t hpgvx(
-    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    float* AP,
-    float* BP, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    float* Z, int64_t ldz,
-    int64_t* ifail )
-{
-    return spgvx( itype, jobz, range, uplo, n, AP, BP, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
-}
+int64_t pptri(
+    lapack::Uplo uplo, int64_t n,
+    double* AP );
 
-int64_t spgvx(
-    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    double* AP,
-    double* BP, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    double* Z, int64_t ldz,
-    int64_t* ifail );
+int64_t pptri(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* AP );
 
-// hpgvx alias to spgvx
-inline int64_t hpgvx(
-    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    double* AP,
-    double* BP, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    double* Z, int64_t ldz,
-    int64_t* ifail )
-{
-    return spgvx( itype, jobz, range, uplo, n, AP, BP, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
-}
+int64_t pptri(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* AP );
 
 // -----------------------------------------------------------------------------
-int64_t sprfs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float const* AP,
-    float const* AFP,
-    int64_t const* ipiv,
-    float const* B, int64_t ldb,
-    float* X, int64_t ldx,
-    float* ferr,
-    float* berr );
-
-// hprfs alias to sprfs
-inline int64_t hprfs(
+int64_t pptrs(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
     float const* AP,
-    float const* AFP,
-    int64_t const* ipiv,
-    float const* B, int64_t ldb,
-    float* X, int64_t ldx,
-    float* ferr,
-    float* berr )
-{
-    return sprfs( uplo, n, nrhs, AP, AFP, ipiv, B, ldb, X, ldx, ferr, berr );
-}
-
-int64_t sprfs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double const* AP,
-    double const* AFP,
-    int64_t const* ipiv,
-    double const* B, int64_t ldb,
-    double* X, int64_t ldx,
-    double* ferr,
-    double* berr );
+    float* B, int64_t ldb );
 
-// hprfs alias to sprfs
-inline int64_t hprfs(
+int64_t pptrs(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
     double const* AP,
-    double const* AFP,
-    int64_t const* ipiv,
-    double const* B, int64_t ldb,
-    double* X, int64_t ldx,
-    double* ferr,
-    double* berr )
-{
-    return sprfs( uplo, n, nrhs, AP, AFP, ipiv, B, ldb, X, ldx, ferr, berr );
-}
+    double* B, int64_t ldb );
 
-int64_t sprfs(
+int64_t pptrs(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
     std::complex<float> const* AP,
-    std::complex<float> const* AFP,
-    int64_t const* ipiv,
-    std::complex<float> const* B, int64_t ldb,
-    std::complex<float>* X, int64_t ldx,
-    float* ferr,
-    float* berr );
+    std::complex<float>* B, int64_t ldb );
 
-int64_t sprfs(
+int64_t pptrs(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
     std::complex<double> const* AP,
-    std::complex<double> const* AFP,
-    int64_t const* ipiv,
-    std::complex<double> const* B, int64_t ldb,
-    std::complex<double>* X, int64_t ldx,
-    double* ferr,
-    double* berr );
+    std::complex<double>* B, int64_t ldb );
 
 // -----------------------------------------------------------------------------
-int64_t spsv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float* AP,
-    int64_t* ipiv,
-    float* B, int64_t ldb );
+int64_t pstrf(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    int64_t* piv,
+    int64_t* rank, float tol );
 
-// hpsv alias to spsv
-inline int64_t hpsv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float* AP,
-    int64_t* ipiv,
-    float* B, int64_t ldb )
-{
-    return spsv( uplo, n, nrhs, AP, ipiv, B, ldb );
-}
+int64_t pstrf(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    int64_t* piv,
+    int64_t* rank, double tol );
 
-int64_t spsv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double* AP,
-    int64_t* ipiv,
-    double* B, int64_t ldb );
+int64_t pstrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* piv,
+    int64_t* rank, float tol );
 
-// hpsv alias to spsv
-inline int64_t hpsv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double* AP,
-    int64_t* ipiv,
-    double* B, int64_t ldb )
-{
-    return spsv( uplo, n, nrhs, AP, ipiv, B, ldb );
-}
+int64_t pstrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* piv,
+    int64_t* rank, double tol );
 
-int64_t spsv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float>* AP,
-    int64_t* ipiv,
-    std::complex<float>* B, int64_t ldb );
+// -----------------------------------------------------------------------------
+int64_t ptcon(
+    int64_t n,
+    float const* D,
+    float const* E, float anorm,
+    float* rcond );
 
-int64_t spsv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double>* AP,
-    int64_t* ipiv,
-    std::complex<double>* B, int64_t ldb );
+int64_t ptcon(
+    int64_t n,
+    double const* D,
+    double const* E, double anorm,
+    double* rcond );
+
+int64_t ptcon(
+    int64_t n,
+    float const* D,
+    std::complex<float> const* E, float anorm,
+    float* rcond );
+
+int64_t ptcon(
+    int64_t n,
+    double const* D,
+    std::complex<double> const* E, double anorm,
+    double* rcond );
 
 // -----------------------------------------------------------------------------
-int64_t spsvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float const* AP,
-    float* AFP,
-    int64_t* ipiv,
+int64_t pteqr(
+    lapack::Job compz, int64_t n,
+    float* D,
+    float* E,
+    float* Z, int64_t ldz );
+
+int64_t pteqr(
+    lapack::Job compz, int64_t n,
+    double* D,
+    double* E,
+    double* Z, int64_t ldz );
+
+int64_t pteqr(
+    lapack::Job compz, int64_t n,
+    float* D,
+    float* E,
+    std::complex<float>* Z, int64_t ldz );
+
+int64_t pteqr(
+    lapack::Job compz, int64_t n,
+    double* D,
+    double* E,
+    std::complex<double>* Z, int64_t ldz );
+
+// -----------------------------------------------------------------------------
+int64_t ptrfs(
+    int64_t n, int64_t nrhs,
+    float const* D,
+    float const* E,
+    float const* DF,
+    float const* EF,
     float const* B, int64_t ldb,
     float* X, int64_t ldx,
-    float* rcond,
     float* ferr,
     float* berr );
 
-// hpsvx alias to spsvx
-inline int64_t hpsvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float const* AP,
-    float* AFP,
-    int64_t* ipiv,
+// alias to match complex version (ignoring uplo)
+inline int64_t ptrfs(
+    lapack::Uplo uplo,
+    int64_t n, int64_t nrhs,
+    float const* D,
+    float const* E,
+    float const* DF,
+    float const* EF,
     float const* B, int64_t ldb,
     float* X, int64_t ldx,
-    float* rcond,
     float* ferr,
     float* berr )
 {
-    return spsvx( fact, uplo, n, nrhs, AP, AFP, ipiv, B, ldb, X, ldx, rcond, ferr, berr );
+    return ptrfs( n, nrhs, D, E, DF, EF, B, ldb, X, ldx, ferr, berr );
 }
 
-int64_t spsvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double const* AP,
-    double* AFP,
-    int64_t* ipiv,
+int64_t ptrfs(
+    int64_t n, int64_t nrhs,
+    double const* D,
+    double const* E,
+    double const* DF,
+    double const* EF,
     double const* B, int64_t ldb,
     double* X, int64_t ldx,
-    double* rcond,
     double* ferr,
     double* berr );
 
-// hpsvx alias to spsvx
-inline int64_t hpsvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double const* AP,
-    double* AFP,
-    int64_t* ipiv,
+// alias to match complex version (ignoring uplo)
+inline int64_t ptrfs(
+    lapack::Uplo uplo,
+    int64_t n, int64_t nrhs,
+    double const* D,
+    double const* E,
+    double const* DF,
+    double const* EF,
     double const* B, int64_t ldb,
     double* X, int64_t ldx,
-    double* rcond,
     double* ferr,
     double* berr )
 {
-    return spsvx( fact, uplo, n, nrhs, AP, AFP, ipiv, B, ldb, X, ldx, rcond, ferr, berr );
+    return ptrfs( n, nrhs, D, E, DF, EF, B, ldb, X, ldx, ferr, berr );
 }
 
-int64_t spsvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float> const* AP,
-    std::complex<float>* AFP,
-    int64_t* ipiv,
+int64_t ptrfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* D,
+    std::complex<float> const* E,
+    float const* DF,
+    std::complex<float> const* EF,
     std::complex<float> const* B, int64_t ldb,
     std::complex<float>* X, int64_t ldx,
-    float* rcond,
     float* ferr,
     float* berr );
 
-int64_t spsvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double> const* AP,
-    std::complex<double>* AFP,
-    int64_t* ipiv,
+int64_t ptrfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* D,
+    std::complex<double> const* E,
+    double const* DF,
+    std::complex<double> const* EF,
     std::complex<double> const* B, int64_t ldb,
     std::complex<double>* X, int64_t ldx,
-    double* rcond,
     double* ferr,
     double* berr );
 
 // -----------------------------------------------------------------------------
-int64_t sptrd(
-    lapack::Uplo uplo, int64_t n,
-    float* AP,
-    float* D,
-    float* E,
-    float* tau );
-
-// hptrd alias to sptrd
-inline int64_t hptrd(
-    lapack::Uplo uplo, int64_t n,
-    float* AP,
+int64_t ptsv(
+    int64_t n, int64_t nrhs,
     float* D,
     float* E,
-    float* tau )
-{
-    return sptrd( uplo, n, AP, D, E, tau );
-}
+    float* B, int64_t ldb );
 
-int64_t sptrd(
-    lapack::Uplo uplo, int64_t n,
-    double* AP,
+int64_t ptsv(
+    int64_t n, int64_t nrhs,
     double* D,
     double* E,
-    double* tau );
+    double* B, int64_t ldb );
 
-// hptrd alias to sptrd
-inline int64_t hptrd(
-    lapack::Uplo uplo, int64_t n,
-    double* AP,
+int64_t ptsv(
+    int64_t n, int64_t nrhs,
+    float* D,
+    std::complex<float>* E,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t ptsv(
+    int64_t n, int64_t nrhs,
     double* D,
-    double* E,
-    double* tau )
-{
-    return sptrd( uplo, n, AP, D, E, tau );
-}
+    std::complex<double>* E,
+    std::complex<double>* B, int64_t ldb );
 
 // -----------------------------------------------------------------------------
-int64_t sptrf(
-    lapack::Uplo uplo, int64_t n,
-    float* AP,
-    int64_t* ipiv );
+int64_t ptsvx(
+    lapack::Factored fact, int64_t n, int64_t nrhs,
+    float const* D,
+    float const* E,
+    float* DF,
+    float* EF,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr );
 
-// hptrf alias to sptrf
-inline int64_t hptrf(
-    lapack::Uplo uplo, int64_t n,
-    float* AP,
-    int64_t* ipiv )
-{
-    return sptrf( uplo, n, AP, ipiv );
-}
+int64_t ptsvx(
+    lapack::Factored fact, int64_t n, int64_t nrhs,
+    double const* D,
+    double const* E,
+    double* DF,
+    double* EF,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr );
 
-int64_t sptrf(
-    lapack::Uplo uplo, int64_t n,
-    double* AP,
-    int64_t* ipiv );
+int64_t ptsvx(
+    lapack::Factored fact, int64_t n, int64_t nrhs,
+    float const* D,
+    std::complex<float> const* E,
+    float* DF,
+    std::complex<float>* EF,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr );
 
-// hptrf alias to sptrf
-inline int64_t hptrf(
-    lapack::Uplo uplo, int64_t n,
-    double* AP,
-    int64_t* ipiv )
-{
-    return sptrf( uplo, n, AP, ipiv );
-}
-
-int64_t sptrf(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float>* AP,
-    int64_t* ipiv );
-
-int64_t sptrf(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double>* AP,
-    int64_t* ipiv );
+int64_t ptsvx(
+    lapack::Factored fact, int64_t n, int64_t nrhs,
+    double const* D,
+    std::complex<double> const* E,
+    double* DF,
+    std::complex<double>* EF,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr );
 
 // -----------------------------------------------------------------------------
-int64_t sptri(
-    lapack::Uplo uplo, int64_t n,
-    float* AP,
-    int64_t const* ipiv );
-
-// hptri alias to sptri
-inline int64_t hptri(
-    lapack::Uplo uplo, int64_t n,
-    float* AP,
-    int64_t const* ipiv )
-{
-    return sptri( uplo, n, AP, ipiv );
-}
-
-int64_t sptri(
-    lapack::Uplo uplo, int64_t n,
-    double* AP,
-    int64_t const* ipiv );
+int64_t pttrf(
+    int64_t n,
+    float* D,
+    float* E );
 
-// hptri alias to sptri
-inline int64_t hptri(
-    lapack::Uplo uplo, int64_t n,
-    double* AP,
-    int64_t const* ipiv )
-{
-    return sptri( uplo, n, AP, ipiv );
-}
+int64_t pttrf(
+    int64_t n,
+    double* D,
+    double* E );
 
-int64_t sptri(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float>* AP,
-    int64_t const* ipiv );
+int64_t pttrf(
+    int64_t n,
+    float* D,
+    std::complex<float>* E );
 
-int64_t sptri(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double>* AP,
-    int64_t const* ipiv );
+int64_t pttrf(
+    int64_t n,
+    double* D,
+    std::complex<double>* E );
 
 // -----------------------------------------------------------------------------
-int64_t sptrs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float const* AP,
-    int64_t const* ipiv,
+int64_t pttrs(
+    int64_t n, int64_t nrhs,
+    float const* D,
+    float const* E,
     float* B, int64_t ldb );
 
-// hptrs alias to sptrs
-inline int64_t hptrs(
+// alias with uplo to match complex (it is ignored)
+inline int64_t pttrs(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float const* AP,
-    int64_t const* ipiv,
+    float const* D,
+    float const* E,
     float* B, int64_t ldb )
 {
-    return sptrs( uplo, n, nrhs, AP, ipiv, B, ldb );
+    return pttrs( n, nrhs, D, E, B, ldb );
 }
 
-int64_t sptrs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double const* AP,
-    int64_t const* ipiv,
+int64_t pttrs(
+    int64_t n, int64_t nrhs,
+    double const* D,
+    double const* E,
     double* B, int64_t ldb );
 
-// hptrs alias to sptrs
-inline int64_t hptrs(
+// alias with uplo to match complex (it is ignored)
+inline int64_t pttrs(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double const* AP,
-    int64_t const* ipiv,
+    double const* D,
+    double const* E,
     double* B, int64_t ldb )
 {
-    return sptrs( uplo, n, nrhs, AP, ipiv, B, ldb );
+    return pttrs( n, nrhs, D, E, B, ldb );
 }
 
-int64_t sptrs(
+int64_t pttrs(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float> const* AP,
-    int64_t const* ipiv,
+    float const* D,
+    std::complex<float> const* E,
     std::complex<float>* B, int64_t ldb );
 
-int64_t sptrs(
+int64_t pttrs(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double> const* AP,
-    int64_t const* ipiv,
+    double const* D,
+    std::complex<double> const* E,
     std::complex<double>* B, int64_t ldb );
 
 // -----------------------------------------------------------------------------
-int64_t stedc(
-    lapack::Job compz, int64_t n,
-    float* D,
-    float* E,
+int64_t sbev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
     float* Z, int64_t ldz );
 
-int64_t stedc(
-    lapack::Job compz, int64_t n,
-    double* D,
-    double* E,
-    double* Z, int64_t ldz );
+// hbev alias to sbev
+inline int64_t hbev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz )
+{
+    return sbev( jobz, uplo, n, kd, AB, ldab, W, Z, ldz );
+}
 
-int64_t stedc(
-    lapack::Job compz, int64_t n,
-    float* D,
-    float* E,
-    std::complex<float>* Z, int64_t ldz );
+int64_t sbev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz );
 
-int64_t stedc(
-    lapack::Job compz, int64_t n,
-    double* D,
-    double* E,
-    std::complex<double>* Z, int64_t ldz );
+// hbev alias to sbev
+inline int64_t hbev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz )
+{
+    return sbev( jobz, uplo, n, kd, AB, ldab, W, Z, ldz );
+}
 
 // -----------------------------------------------------------------------------
-int64_t stegr(
-    lapack::Job jobz, lapack::Range range, int64_t n,
-    float* D,
-    float* E, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
+int64_t sbev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
     float* W,
-    float* Z, int64_t ldz,
-    int64_t* isuppz );
-
-int64_t stegr(
-    lapack::Job jobz, lapack::Range range, int64_t n,
-    double* D,
-    double* E, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    double* Z, int64_t ldz,
-    int64_t* isuppz );
+    float* Z, int64_t ldz );
 
-int64_t stegr(
-    lapack::Job jobz, lapack::Range range, int64_t n,
-    float* D,
-    float* E, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
+// hbev_2stage alias to sbev_2stage
+inline int64_t hbev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
     float* W,
-    std::complex<float>* Z, int64_t ldz,
-    int64_t* isuppz );
+    float* Z, int64_t ldz )
+{
+    return sbev_2stage( jobz, uplo, n, kd, AB, ldab, W, Z, ldz );
+}
 
-int64_t stegr(
-    lapack::Job jobz, lapack::Range range, int64_t n,
-    double* D,
-    double* E, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
+int64_t sbev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
     double* W,
-    std::complex<double>* Z, int64_t ldz,
-    int64_t* isuppz );
+    double* Z, int64_t ldz );
 
-// -----------------------------------------------------------------------------
-int64_t stein(
-    int64_t n,
-    float const* D,
-    float const* E, int64_t m,
-    float const* W,
-    int64_t const* iblock,
-    int64_t const* isplit,
+// hbev_2stage alias to sbev_2stage
+inline int64_t hbev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz )
+{
+    return sbev_2stage( jobz, uplo, n, kd, AB, ldab, W, Z, ldz );
+}
+
+void sbev_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
     float* Z, int64_t ldz,
-    int64_t* ifail );
+    int64_t* lwork );
 
-int64_t stein(
-    int64_t n,
-    double const* D,
-    double const* E, int64_t m,
-    double const* W,
-    int64_t const* iblock,
-    int64_t const* isplit,
+// hbev_2stage_work_size alias to sbev_2stage_work_size
+inline void hbev_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* lwork )
+{
+    sbev_2stage_work_size( jobz, uplo, n, kd, AB, ldab, W, Z, ldz, lwork );
+}
+
+void sbev_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
     double* Z, int64_t ldz,
-    int64_t* ifail );
+    int64_t* lwork );
 
-int64_t stein(
-    int64_t n,
-    float const* D,
-    float const* E, int64_t m,
-    float const* W,
-    int64_t const* iblock,
-    int64_t const* isplit,
-    std::complex<float>* Z, int64_t ldz,
-    int64_t* ifail );
+// hbev_2stage_work_size alias to sbev_2stage_work_size
+inline void hbev_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* lwork )
+{
+    sbev_2stage_work_size( jobz, uplo, n, kd, AB, ldab, W, Z, ldz, lwork );
+}
 
-int64_t stein(
-    int64_t n,
-    double const* D,
-    double const* E, int64_t m,
-    double const* W,
-    int64_t const* iblock,
-    int64_t const* isplit,
-    std::complex<double>* Z, int64_t ldz,
-    int64_t* ifail );
+int64_t sbev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz,
+    float* work, int64_t lwork );
+
+// hbev_2stage alias to sbev_2stage
+inline int64_t hbev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz,
+    float* work, int64_t lwork )
+{
+    return sbev_2stage( jobz, uplo, n, kd, AB, ldab, W, Z, ldz, work, lwork );
+}
+
+int64_t sbev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz,
+    double* work, int64_t lwork );
+
+// hbev_2stage alias to sbev_2stage
+inline int64_t hbev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz,
+    double* work, int64_t lwork )
+{
+    return sbev_2stage( jobz, uplo, n, kd, AB, ldab, W, Z, ldz, work, lwork );
+}
 
 // -----------------------------------------------------------------------------
-int64_t stemr(
-    lapack::Job jobz, lapack::Range range, int64_t n,
-    float* D,
-    float* E, float vl, float vu, int64_t il, int64_t iu,
-    int64_t* m,
+int64_t sbevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
     float* W,
-    float* Z, int64_t ldz, int64_t nzc,
-    int64_t* isuppz,
-    bool* tryrac );
+    float* Z, int64_t ldz );
 
-int64_t stemr(
-    lapack::Job jobz, lapack::Range range, int64_t n,
-    double* D,
-    double* E, double vl, double vu, int64_t il, int64_t iu,
-    int64_t* m,
+// hbevd alias to sbevd
+inline int64_t hbevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz )
+{
+    return sbevd( jobz, uplo, n, kd, AB, ldab, W, Z, ldz );
+}
+
+int64_t sbevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
     double* W,
-    double* Z, int64_t ldz, int64_t nzc,
-    int64_t* isuppz,
-    bool* tryrac );
+    double* Z, int64_t ldz );
 
-int64_t stemr(
-    lapack::Job jobz, lapack::Range range, int64_t n,
-    float* D,
-    float* E, float vl, float vu, int64_t il, int64_t iu,
-    int64_t* m,
+// hbevd alias to sbevd
+inline int64_t hbevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz )
+{
+    return sbevd( jobz, uplo, n, kd, AB, ldab, W, Z, ldz );
+}
+
+void sbevd_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
     float* W,
-    std::complex<float>* Z, int64_t ldz, int64_t nzc,
-    int64_t* isuppz,
-    bool* tryrac );
+    float* Z, int64_t ldz,
+    int64_t* lwork, int64_t* liwork );
 
-int64_t stemr(
-    lapack::Job jobz, lapack::Range range, int64_t n,
-    double* D,
-    double* E, double vl, double vu, int64_t il, int64_t iu,
-    int64_t* m,
+// hbevd_work_size alias to sbevd_work_size
+inline void hbevd_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* lwork, int64_t* liwork )
+{
+    sbevd_work_size( jobz, uplo, n, kd, AB, ldab, W, Z, ldz, lwork, liwork );
+}
+
+void sbevd_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
     double* W,
-    std::complex<double>* Z, int64_t ldz, int64_t nzc,
-    int64_t* isuppz,
-    bool* tryrac );
+    double* Z, int64_t ldz,
+    int64_t* lwork, int64_t* liwork );
+
+// hbevd_work_size alias to sbevd_work_size
+inline void hbevd_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* lwork, int64_t* liwork )
+{
+    sbevd_work_size( jobz, uplo, n, kd, AB, ldab, W, Z, ldz, lwork, liwork );
+}
+
+int64_t sbevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+// hbevd alias to sbevd
+inline int64_t hbevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    return sbevd( jobz, uplo, n, kd, AB, ldab, W, Z, ldz, work, lwork, iwork, liwork );
+}
+
+int64_t sbevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+// hbevd alias to sbevd
+inline int64_t hbevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    return sbevd( jobz, uplo, n, kd, AB, ldab, W, Z, ldz, work, lwork, iwork, liwork );
+}
 
 // -----------------------------------------------------------------------------
-int64_t steqr(
-    lapack::Job compz, int64_t n,
-    float* D,
-    float* E,
+int64_t sbevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
     float* Z, int64_t ldz );
 
-int64_t steqr(
-    lapack::Job compz, int64_t n,
-    double* D,
-    double* E,
+// hbevd_2stage alias to sbevd_2stage
+inline int64_t hbevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz )
+{
+    return sbevd_2stage( jobz, uplo, n, kd, AB, ldab, W, Z, ldz );
+}
+
+int64_t sbevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
     double* Z, int64_t ldz );
 
-int64_t steqr(
-    lapack::Job compz, int64_t n,
-    float* D,
-    float* E,
-    std::complex<float>* Z, int64_t ldz );
+// hbevd_2stage alias to sbevd_2stage
+inline int64_t hbevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz )
+{
+    return sbevd_2stage( jobz, uplo, n, kd, AB, ldab, W, Z, ldz );
+}
+
+void sbevd_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* lwork, int64_t* liwork );
+
+// hbevd_2stage_work_size alias to sbevd_2stage_work_size
+inline void hbevd_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* lwork, int64_t* liwork )
+{
+    sbevd_2stage_work_size( jobz, uplo, n, kd, AB, ldab, W, Z, ldz, lwork, liwork );
+}
+
+void sbevd_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* lwork, int64_t* liwork );
+
+// hbevd_2stage_work_size alias to sbevd_2stage_work_size
+inline void hbevd_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* lwork, int64_t* liwork )
+{
+    sbevd_2stage_work_size( jobz, uplo, n, kd, AB, ldab, W, Z, ldz, lwork, liwork );
+}
+
+int64_t sbevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+// hbevd_2stage alias to sbevd_2stage
+inline int64_t hbevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    return sbevd_2stage( jobz, uplo, n, kd, AB, ldab, W, Z, ldz, work, lwork, iwork, liwork );
+}
+
+int64_t sbevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+// hbevd_2stage alias to sbevd_2stage
+inline int64_t hbevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    return sbevd_2stage( jobz, uplo, n, kd, AB, ldab, W, Z, ldz, work, lwork, iwork, liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t sbevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail );
+
+// hbevx alias to sbevx
+inline int64_t hbevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail )
+{
+    return sbevx( jobz, range, uplo, n, kd, AB, ldab, Q, ldq, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
+}
+
+int64_t sbevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail );
+
+// hbevx alias to sbevx
+inline int64_t hbevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail )
+{
+    return sbevx( jobz, range, uplo, n, kd, AB, ldab, Q, ldq, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
+}
+
+// -----------------------------------------------------------------------------
+int64_t sbevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail );
+
+// hbevx_2stage alias to sbevx_2stage
+inline int64_t hbevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail )
+{
+    return sbevx_2stage( jobz, range, uplo, n, kd, AB, ldab, Q, ldq, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
+}
+
+int64_t sbevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail );
+
+// hbevx_2stage alias to sbevx_2stage
+inline int64_t hbevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail )
+{
+    return sbevx_2stage( jobz, range, uplo, n, kd, AB, ldab, Q, ldq, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
+}
+
+void sbevx_2stage_work_size(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail,
+    int64_t* lwork, int64_t* liwork );
+
+// hbevx_2stage_work_size alias to sbevx_2stage_work_size
+inline void hbevx_2stage_work_size(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail,
+    int64_t* lwork, int64_t* liwork )
+{
+    sbevx_2stage_work_size( jobz, range, uplo, n, kd, AB, ldab, Q, ldq, vl, vu, il, iu, abstol, nfound, W, Z, ldz, ifail, lwork, liwork );
+}
+
+void sbevx_2stage_work_size(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    int64_t* lwork, int64_t* liwork );
+
+// hbevx_2stage_work_size alias to sbevx_2stage_work_size
+inline void hbevx_2stage_work_size(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    int64_t* lwork, int64_t* liwork )
+{
+    sbevx_2stage_work_size( jobz, range, uplo, n, kd, AB, ldab, Q, ldq, vl, vu, il, iu, abstol, nfound, W, Z, ldz, ifail, lwork, liwork );
+}
+
+int64_t sbevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+// hbevx_2stage alias to sbevx_2stage
+inline int64_t hbevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    return sbevx_2stage( jobz, range, uplo, n, kd, AB, ldab, Q, ldq, vl, vu, il, iu, abstol, nfound, W, Z, ldz, ifail, work, lwork, iwork, liwork );
+}
+
+int64_t sbevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+// hbevx_2stage alias to sbevx_2stage
+inline int64_t hbevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    return sbevx_2stage( jobz, range, uplo, n, kd, AB, ldab, Q, ldq, vl, vu, il, iu, abstol, nfound, W, Z, ldz, ifail, work, lwork, iwork, liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t sbgst(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    float* AB, int64_t ldab,
+    float const* BB, int64_t ldbb,
+    float* X, int64_t ldx );
+
+// hbgst alias to sbgst
+inline int64_t hbgst(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    float* AB, int64_t ldab,
+    float const* BB, int64_t ldbb,
+    float* X, int64_t ldx )
+{
+    return sbgst( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, X, ldx );
+}
+
+int64_t sbgst(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    double* AB, int64_t ldab,
+    double const* BB, int64_t ldbb,
+    double* X, int64_t ldx );
+
+// hbgst alias to sbgst
+inline int64_t hbgst(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    double* AB, int64_t ldab,
+    double const* BB, int64_t ldbb,
+    double* X, int64_t ldx )
+{
+    return sbgst( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, X, ldx );
+}
+
+// -----------------------------------------------------------------------------
+int64_t sbgv(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    float* AB, int64_t ldab,
+    float* BB, int64_t ldbb,
+    float* W,
+    float* Z, int64_t ldz );
+
+// hbgv alias to sbgv
+inline int64_t hbgv(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    float* AB, int64_t ldab,
+    float* BB, int64_t ldbb,
+    float* W,
+    float* Z, int64_t ldz )
+{
+    return sbgv( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz );
+}
+
+int64_t sbgv(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    double* AB, int64_t ldab,
+    double* BB, int64_t ldbb,
+    double* W,
+    double* Z, int64_t ldz );
+
+// hbgv alias to sbgv
+inline int64_t hbgv(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    double* AB, int64_t ldab,
+    double* BB, int64_t ldbb,
+    double* W,
+    double* Z, int64_t ldz )
+{
+    return sbgv( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz );
+}
+
+// -----------------------------------------------------------------------------
+int64_t sbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    float* AB, int64_t ldab,
+    float* BB, int64_t ldbb,
+    float* W,
+    float* Z, int64_t ldz );
+
+// hbgvd alias to sbgvd
+inline int64_t hbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    float* AB, int64_t ldab,
+    float* BB, int64_t ldbb,
+    float* W,
+    float* Z, int64_t ldz )
+{
+    return sbgvd( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz );
+}
+
+int64_t sbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    double* AB, int64_t ldab,
+    double* BB, int64_t ldbb,
+    double* W,
+    double* Z, int64_t ldz );
+
+// hbgvd alias to sbgvd
+inline int64_t hbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    double* AB, int64_t ldab,
+    double* BB, int64_t ldbb,
+    double* W,
+    double* Z, int64_t ldz )
+{
+    return sbgvd( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz );
+}
+
+void sbgvd_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    float* AB, int64_t ldab,
+    float* BB, int64_t ldbb,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* lwork, int64_t* liwork );
+
+// hbgvd_work_size alias to sbgvd_work_size
+inline void hbgvd_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    float* AB, int64_t ldab,
+    float* BB, int64_t ldbb,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* lwork, int64_t* liwork )
+{
+    sbgvd_work_size( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz, lwork, liwork );
+}
+
+void sbgvd_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    double* AB, int64_t ldab,
+    double* BB, int64_t ldbb,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* lwork, int64_t* liwork );
+
+// hbgvd_work_size alias to sbgvd_work_size
+inline void hbgvd_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    double* AB, int64_t ldab,
+    double* BB, int64_t ldbb,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* lwork, int64_t* liwork )
+{
+    sbgvd_work_size( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz, lwork, liwork );
+}
+
+int64_t sbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    float* AB, int64_t ldab,
+    float* BB, int64_t ldbb,
+    float* W,
+    float* Z, int64_t ldz,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+// hbgvd alias to sbgvd
+inline int64_t hbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    float* AB, int64_t ldab,
+    float* BB, int64_t ldbb,
+    float* W,
+    float* Z, int64_t ldz,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    return sbgvd( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz, work, lwork, iwork, liwork );
+}
+
+int64_t sbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    double* AB, int64_t ldab,
+    double* BB, int64_t ldbb,
+    double* W,
+    double* Z, int64_t ldz,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+// hbgvd alias to sbgvd
+inline int64_t hbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    double* AB, int64_t ldab,
+    double* BB, int64_t ldbb,
+    double* W,
+    double* Z, int64_t ldz,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    return sbgvd( jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz, work, lwork, iwork, liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t sbgvx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    float* AB, int64_t ldab,
+    float* BB, int64_t ldbb,
+    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail );
+
+// hbgvx alias to sbgvx
+inline int64_t hbgvx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    float* AB, int64_t ldab,
+    float* BB, int64_t ldbb,
+    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail )
+{
+    return sbgvx( jobz, range, uplo, n, ka, kb, AB, ldab, BB, ldbb, Q, ldq, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
+}
+
+int64_t sbgvx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    double* AB, int64_t ldab,
+    double* BB, int64_t ldbb,
+    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail );
+
+// hbgvx alias to sbgvx
+inline int64_t hbgvx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    double* AB, int64_t ldab,
+    double* BB, int64_t ldbb,
+    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail )
+{
+    return sbgvx( jobz, range, uplo, n, ka, kb, AB, ldab, BB, ldbb, Q, ldq, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
+}
+
+// -----------------------------------------------------------------------------
+int64_t sbtrd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* D,
+    float* E,
+    float* Q, int64_t ldq );
+
+// hbtrd alias to sbtrd
+inline int64_t hbtrd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* D,
+    float* E,
+    float* Q, int64_t ldq )
+{
+    return sbtrd( jobz, uplo, n, kd, AB, ldab, D, E, Q, ldq );
+}
+
+int64_t sbtrd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* D,
+    double* E,
+    double* Q, int64_t ldq );
+
+// hbtrd alias to sbtrd
+inline int64_t hbtrd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* D,
+    double* E,
+    double* Q, int64_t ldq )
+{
+    return sbtrd( jobz, uplo, n, kd, AB, ldab, D, E, Q, ldq );
+}
+
+// -----------------------------------------------------------------------------
+void sfrk(
+    lapack::Op transr, lapack::Uplo uplo, lapack::Op trans, int64_t n, int64_t k, float alpha,
+    float const* A, int64_t lda, float beta,
+    float* C );
+
+void sfrk(
+    lapack::Op transr, lapack::Uplo uplo, lapack::Op trans, int64_t n, int64_t k, double alpha,
+    double const* A, int64_t lda, double beta,
+    double* C );
+
+// -----------------------------------------------------------------------------
+int64_t spcon(
+    lapack::Uplo uplo, int64_t n,
+    float const* AP,
+    int64_t const* ipiv, float anorm,
+    float* rcond );
+
+// hpcon alias to spcon
+inline int64_t hpcon(
+    lapack::Uplo uplo, int64_t n,
+    float const* AP,
+    int64_t const* ipiv, float anorm,
+    float* rcond )
+{
+    return spcon( uplo, n, AP, ipiv, anorm, rcond );
+}
+
+int64_t spcon(
+    lapack::Uplo uplo, int64_t n,
+    double const* AP,
+    int64_t const* ipiv, double anorm,
+    double* rcond );
+
+// hpcon alias to spcon
+inline int64_t hpcon(
+    lapack::Uplo uplo, int64_t n,
+    double const* AP,
+    int64_t const* ipiv, double anorm,
+    double* rcond )
+{
+    return spcon( uplo, n, AP, ipiv, anorm, rcond );
+}
+
+int64_t spcon(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float> const* AP,
+    int64_t const* ipiv, float anorm,
+    float* rcond );
+
+int64_t spcon(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double> const* AP,
+    int64_t const* ipiv, double anorm,
+    double* rcond );
+
+// -----------------------------------------------------------------------------
+int64_t spev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* W,
+    float* Z, int64_t ldz );
+
+// hpev alias to spev
+inline int64_t hpev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* W,
+    float* Z, int64_t ldz )
+{
+    return spev( jobz, uplo, n, AP, W, Z, ldz );
+}
+
+int64_t spev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* W,
+    double* Z, int64_t ldz );
+
+// hpev alias to spev
+inline int64_t hpev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* W,
+    double* Z, int64_t ldz )
+{
+    return spev( jobz, uplo, n, AP, W, Z, ldz );
+}
+
+// -----------------------------------------------------------------------------
+int64_t spevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* W,
+    float* Z, int64_t ldz );
+
+// hpevd alias to spevd
+inline int64_t hpevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* W,
+    float* Z, int64_t ldz )
+{
+    return spevd( jobz, uplo, n, AP, W, Z, ldz );
+}
+
+int64_t spevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* W,
+    double* Z, int64_t ldz );
+
+// hpevd alias to spevd
+inline int64_t hpevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* W,
+    double* Z, int64_t ldz )
+{
+    return spevd( jobz, uplo, n, AP, W, Z, ldz );
+}
+
+void spevd_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* lwork, int64_t* liwork );
+
+// hpevd_work_size alias to spevd_work_size
+inline void hpevd_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* lwork, int64_t* liwork )
+{
+    spevd_work_size( jobz, uplo, n, AP, W, Z, ldz, lwork, liwork );
+}
+
+void spevd_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* lwork, int64_t* liwork );
+
+// hpevd_work_size alias to spevd_work_size
+inline void hpevd_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* lwork, int64_t* liwork )
+{
+    spevd_work_size( jobz, uplo, n, AP, W, Z, ldz, lwork, liwork );
+}
+
+int64_t spevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* W,
+    float* Z, int64_t ldz,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+// hpevd alias to spevd
+inline int64_t hpevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* W,
+    float* Z, int64_t ldz,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    return spevd( jobz, uplo, n, AP, W, Z, ldz, work, lwork, iwork, liwork );
+}
+
+int64_t spevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* W,
+    double* Z, int64_t ldz,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+// hpevd alias to spevd
+inline int64_t hpevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* W,
+    double* Z, int64_t ldz,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    return spevd( jobz, uplo, n, AP, W, Z, ldz, work, lwork, iwork, liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t spevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* AP, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail );
+
+// hpevx alias to spevx
+inline int64_t hpevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* AP, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail )
+{
+    return spevx( jobz, range, uplo, n, AP, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
+}
+
+int64_t spevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* AP, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail );
+
+// hpevx alias to spevx
+inline int64_t hpevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* AP, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail )
+{
+    return spevx( jobz, range, uplo, n, AP, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
+}
+
+// -----------------------------------------------------------------------------
+int64_t spgst(
+    int64_t itype, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float const* BP );
+
+// hpgst alias to spgst
+inline int64_t hpgst(
+    int64_t itype, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float const* BP )
+{
+    return spgst( itype, uplo, n, AP, BP );
+}
+
+int64_t spgst(
+    int64_t itype, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double const* BP );
+
+// hpgst alias to spgst
+inline int64_t hpgst(
+    int64_t itype, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double const* BP )
+{
+    return spgst( itype, uplo, n, AP, BP );
+}
+
+// -----------------------------------------------------------------------------
+int64_t spgv(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* BP,
+    float* W,
+    float* Z, int64_t ldz );
+
+// hpgv alias to spgv
+inline int64_t hpgv(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* BP,
+    float* W,
+    float* Z, int64_t ldz )
+{
+    return spgv( itype, jobz, uplo, n, AP, BP, W, Z, ldz );
+}
+
+int64_t spgv(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* BP,
+    double* W,
+    double* Z, int64_t ldz );
+
+// hpgv alias to spgv
+inline int64_t hpgv(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* BP,
+    double* W,
+    double* Z, int64_t ldz )
+{
+    return spgv( itype, jobz, uplo, n, AP, BP, W, Z, ldz );
+}
+
+// -----------------------------------------------------------------------------
+int64_t spgvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* BP,
+    float* W,
+    float* Z, int64_t ldz );
+
+// hpgvd alias to spgvd
+inline int64_t hpgvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* BP,
+    float* W,
+    float* Z, int64_t ldz )
+{
+    return spgvd( itype, jobz, uplo, n, AP, BP, W, Z, ldz );
+}
+
+int64_t spgvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* BP,
+    double* W,
+    double* Z, int64_t ldz );
+
+// hpgvd alias to spgvd
+inline int64_t hpgvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* BP,
+    double* W,
+    double* Z, int64_t ldz )
+{
+    return spgvd( itype, jobz, uplo, n, AP, BP, W, Z, ldz );
+}
+
+void spgvd_work_size(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* BP,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* lwork, int64_t* liwork );
+
+// hpgvd_work_size alias to spgvd_work_size
+inline void hpgvd_work_size(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* BP,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* lwork, int64_t* liwork )
+{
+    spgvd_work_size( itype, jobz, uplo, n, AP, BP, W, Z, ldz, lwork, liwork );
+}
+
+void spgvd_work_size(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* BP,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* lwork, int64_t* liwork );
+
+// hpgvd_work_size alias to spgvd_work_size
+inline void hpgvd_work_size(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* BP,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* lwork, int64_t* liwork )
+{
+    spgvd_work_size( itype, jobz, uplo, n, AP, BP, W, Z, ldz, lwork, liwork );
+}
+
+int64_t spgvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* BP,
+    float* W,
+    float* Z, int64_t ldz,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+// hpgvd alias to spgvd
+inline int64_t hpgvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* BP,
+    float* W,
+    float* Z, int64_t ldz,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    return spgvd( itype, jobz, uplo, n, AP, BP, W, Z, ldz, work, lwork, iwork, liwork );
+}
+
+int64_t spgvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* BP,
+    double* W,
+    double* Z, int64_t ldz,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+// hpgvd alias to spgvd
+inline int64_t hpgvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* BP,
+    double* W,
+    double* Z, int64_t ldz,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    return spgvd( itype, jobz, uplo, n, AP, BP, W, Z, ldz, work, lwork, iwork, liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t spgvx(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* BP, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail );
+
+// hpgvx alias to spgvx
+inline int64_t hpgvx(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* BP, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail )
+{
+    return spgvx( itype, jobz, range, uplo, n, AP, BP, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
+}
+
+int64_t spgvx(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* BP, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail );
+
+// hpgvx alias to spgvx
+inline int64_t hpgvx(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* BP, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail )
+{
+    return spgvx( itype, jobz, range, uplo, n, AP, BP, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
+}
+
+// -----------------------------------------------------------------------------
+int64_t sprfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* AP,
+    float const* AFP,
+    int64_t const* ipiv,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* ferr,
+    float* berr );
+
+// hprfs alias to sprfs
+inline int64_t hprfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* AP,
+    float const* AFP,
+    int64_t const* ipiv,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* ferr,
+    float* berr )
+{
+    return sprfs( uplo, n, nrhs, AP, AFP, ipiv, B, ldb, X, ldx, ferr, berr );
+}
+
+int64_t sprfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* AP,
+    double const* AFP,
+    int64_t const* ipiv,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* ferr,
+    double* berr );
+
+// hprfs alias to sprfs
+inline int64_t hprfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* AP,
+    double const* AFP,
+    int64_t const* ipiv,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* ferr,
+    double* berr )
+{
+    return sprfs( uplo, n, nrhs, AP, AFP, ipiv, B, ldb, X, ldx, ferr, berr );
+}
+
+int64_t sprfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* AP,
+    std::complex<float> const* AFP,
+    int64_t const* ipiv,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    float* ferr,
+    float* berr );
+
+int64_t sprfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* AP,
+    std::complex<double> const* AFP,
+    int64_t const* ipiv,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double* ferr,
+    double* berr );
+
+// -----------------------------------------------------------------------------
+int64_t spsv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* AP,
+    int64_t* ipiv,
+    float* B, int64_t ldb );
+
+// hpsv alias to spsv
+inline int64_t hpsv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* AP,
+    int64_t* ipiv,
+    float* B, int64_t ldb )
+{
+    return spsv( uplo, n, nrhs, AP, ipiv, B, ldb );
+}
+
+int64_t spsv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* AP,
+    int64_t* ipiv,
+    double* B, int64_t ldb );
+
+// hpsv alias to spsv
+inline int64_t hpsv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* AP,
+    int64_t* ipiv,
+    double* B, int64_t ldb )
+{
+    return spsv( uplo, n, nrhs, AP, ipiv, B, ldb );
+}
+
+int64_t spsv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* AP,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t spsv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* AP,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
+// -----------------------------------------------------------------------------
+int64_t spsvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* AP,
+    float* AFP,
+    int64_t* ipiv,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr );
+
+// hpsvx alias to spsvx
+inline int64_t hpsvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* AP,
+    float* AFP,
+    int64_t* ipiv,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr )
+{
+    return spsvx( fact, uplo, n, nrhs, AP, AFP, ipiv, B, ldb, X, ldx, rcond, ferr, berr );
+}
+
+int64_t spsvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* AP,
+    double* AFP,
+    int64_t* ipiv,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr );
+
+// hpsvx alias to spsvx
+inline int64_t hpsvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* AP,
+    double* AFP,
+    int64_t* ipiv,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr )
+{
+    return spsvx( fact, uplo, n, nrhs, AP, AFP, ipiv, B, ldb, X, ldx, rcond, ferr, berr );
+}
+
+int64_t spsvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* AP,
+    std::complex<float>* AFP,
+    int64_t* ipiv,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr );
+
+int64_t spsvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* AP,
+    std::complex<double>* AFP,
+    int64_t* ipiv,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr );
+
+// -----------------------------------------------------------------------------
+int64_t sptrd(
+    lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* D,
+    float* E,
+    float* tau );
+
+// hptrd alias to sptrd
+inline int64_t hptrd(
+    lapack::Uplo uplo, int64_t n,
+    float* AP,
+    float* D,
+    float* E,
+    float* tau )
+{
+    return sptrd( uplo, n, AP, D, E, tau );
+}
+
+int64_t sptrd(
+    lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* D,
+    double* E,
+    double* tau );
+
+// hptrd alias to sptrd
+inline int64_t hptrd(
+    lapack::Uplo uplo, int64_t n,
+    double* AP,
+    double* D,
+    double* E,
+    double* tau )
+{
+    return sptrd( uplo, n, AP, D, E, tau );
+}
+
+// -----------------------------------------------------------------------------
+int64_t sptrf(
+    lapack::Uplo uplo, int64_t n,
+    float* AP,
+    int64_t* ipiv );
+
+// hptrf alias to sptrf
+inline int64_t hptrf(
+    lapack::Uplo uplo, int64_t n,
+    float* AP,
+    int64_t* ipiv )
+{
+    return sptrf( uplo, n, AP, ipiv );
+}
+
+int64_t sptrf(
+    lapack::Uplo uplo, int64_t n,
+    double* AP,
+    int64_t* ipiv );
+
+// hptrf alias to sptrf
+inline int64_t hptrf(
+    lapack::Uplo uplo, int64_t n,
+    double* AP,
+    int64_t* ipiv )
+{
+    return sptrf( uplo, n, AP, ipiv );
+}
+
+int64_t sptrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* AP,
+    int64_t* ipiv );
+
+int64_t sptrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* AP,
+    int64_t* ipiv );
+
+// -----------------------------------------------------------------------------
+int64_t sptri(
+    lapack::Uplo uplo, int64_t n,
+    float* AP,
+    int64_t const* ipiv );
+
+// hptri alias to sptri
+inline int64_t hptri(
+    lapack::Uplo uplo, int64_t n,
+    float* AP,
+    int64_t const* ipiv )
+{
+    return sptri( uplo, n, AP, ipiv );
+}
+
+int64_t sptri(
+    lapack::Uplo uplo, int64_t n,
+    double* AP,
+    int64_t const* ipiv );
+
+// hptri alias to sptri
+inline int64_t hptri(
+    lapack::Uplo uplo, int64_t n,
+    double* AP,
+    int64_t const* ipiv )
+{
+    return sptri( uplo, n, AP, ipiv );
+}
+
+int64_t sptri(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* AP,
+    int64_t const* ipiv );
+
+int64_t sptri(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* AP,
+    int64_t const* ipiv );
+
+// -----------------------------------------------------------------------------
+int64_t sptrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* AP,
+    int64_t const* ipiv,
+    float* B, int64_t ldb );
+
+// hptrs alias to sptrs
+inline int64_t hptrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* AP,
+    int64_t const* ipiv,
+    float* B, int64_t ldb )
+{
+    return sptrs( uplo, n, nrhs, AP, ipiv, B, ldb );
+}
+
+int64_t sptrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* AP,
+    int64_t const* ipiv,
+    double* B, int64_t ldb );
+
+// hptrs alias to sptrs
+inline int64_t hptrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* AP,
+    int64_t const* ipiv,
+    double* B, int64_t ldb )
+{
+    return sptrs( uplo, n, nrhs, AP, ipiv, B, ldb );
+}
+
+int64_t sptrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* AP,
+    int64_t const* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t sptrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* AP,
+    int64_t const* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
+// -----------------------------------------------------------------------------
+int64_t stedc(
+    lapack::Job compz, int64_t n,
+    float* D,
+    float* E,
+    float* Z, int64_t ldz );
+
+int64_t stedc(
+    lapack::Job compz, int64_t n,
+    double* D,
+    double* E,
+    double* Z, int64_t ldz );
+
+int64_t stedc(
+    lapack::Job compz, int64_t n,
+    float* D,
+    float* E,
+    std::complex<float>* Z, int64_t ldz );
+
+int64_t stedc(
+    lapack::Job compz, int64_t n,
+    double* D,
+    double* E,
+    std::complex<double>* Z, int64_t ldz );
+
+void stedc_work_size(
+    lapack::Job compz, int64_t n,
+    float* D,
+    float* E,
+    float* Z, int64_t ldz,
+    int64_t* lwork, int64_t* liwork );
+
+void stedc_work_size(
+    lapack::Job compz, int64_t n,
+    double* D,
+    double* E,
+    double* Z, int64_t ldz,
+    int64_t* lwork, int64_t* liwork );
+
+void stedc_work_size(
+    lapack::Job compz, int64_t n,
+    float* D,
+    float* E,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork );
+
+void stedc_work_size(
+    lapack::Job compz, int64_t n,
+    double* D,
+    double* E,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork );
+
+int64_t stedc(
+    lapack::Job compz, int64_t n,
+    float* D,
+    float* E,
+    float* Z, int64_t ldz,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+int64_t stedc(
+    lapack::Job compz, int64_t n,
+    double* D,
+    double* E,
+    double* Z, int64_t ldz,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+int64_t stedc(
+    lapack::Job compz, int64_t n,
+    float* D,
+    float* E,
+    std::complex<float>* Z, int64_t ldz,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork );
+
+int64_t stedc(
+    lapack::Job compz, int64_t n,
+    double* D,
+    double* E,
+    std::complex<double>* Z, int64_t ldz,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork );
+
+// -----------------------------------------------------------------------------
+int64_t stegr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz );
+
+int64_t stegr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz );
+
+int64_t stegr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* isuppz );
+
+int64_t stegr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* isuppz );
+
+void stegr_work_size(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz,
+    int64_t* lwork, int64_t* liwork );
+
+void stegr_work_size(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz,
+    int64_t* lwork, int64_t* liwork );
+
+void stegr_work_size(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* isuppz,
+    int64_t* lwork, int64_t* liwork );
+
+void stegr_work_size(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* isuppz,
+    int64_t* lwork, int64_t* liwork );
+
+int64_t stegr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+int64_t stegr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+int64_t stegr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* isuppz,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+int64_t stegr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* isuppz,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+// -----------------------------------------------------------------------------
+int64_t stein(
+    int64_t n,
+    float const* D,
+    float const* E, int64_t m,
+    float const* W,
+    int64_t const* iblock,
+    int64_t const* isplit,
+    float* Z, int64_t ldz,
+    int64_t* ifail );
+
+int64_t stein(
+    int64_t n,
+    double const* D,
+    double const* E, int64_t m,
+    double const* W,
+    int64_t const* iblock,
+    int64_t const* isplit,
+    double* Z, int64_t ldz,
+    int64_t* ifail );
+
+int64_t stein(
+    int64_t n,
+    float const* D,
+    float const* E, int64_t m,
+    float const* W,
+    int64_t const* iblock,
+    int64_t const* isplit,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifail );
+
+int64_t stein(
+    int64_t n,
+    double const* D,
+    double const* E, int64_t m,
+    double const* W,
+    int64_t const* iblock,
+    int64_t const* isplit,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifail );
+
+// -----------------------------------------------------------------------------
+int64_t stemr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac );
+
+int64_t stemr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac );
+
+int64_t stemr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu,
+    int64_t* m,
+    float* W,
+    std::complex<float>* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac );
+
+int64_t stemr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu,
+    int64_t* m,
+    double* W,
+    std::complex<double>* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac );
+
+void stemr_work_size(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac,
+    int64_t* lwork, int64_t* liwork );
+
+void stemr_work_size(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac,
+    int64_t* lwork, int64_t* liwork );
+
+void stemr_work_size(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac,
+    int64_t* lwork, int64_t* liwork );
+
+void stemr_work_size(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu,
+    int64_t* nfound,
+    double* W,
+    std::complex<double>* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac,
+    int64_t* lwork, int64_t* liwork );
+
+int64_t stemr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+int64_t stemr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+int64_t stemr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+int64_t stemr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu,
+    int64_t* nfound,
+    double* W,
+    std::complex<double>* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+// -----------------------------------------------------------------------------
+int64_t steqr(
+    lapack::Job compz, int64_t n,
+    float* D,
+    float* E,
+    float* Z, int64_t ldz );
+
+int64_t steqr(
+    lapack::Job compz, int64_t n,
+    double* D,
+    double* E,
+    double* Z, int64_t ldz );
+
+int64_t steqr(
+    lapack::Job compz, int64_t n,
+    float* D,
+    float* E,
+    std::complex<float>* Z, int64_t ldz );
+
+int64_t steqr(
+    lapack::Job compz, int64_t n,
+    double* D,
+    double* E,
+    std::complex<double>* Z, int64_t ldz );
+
+// -----------------------------------------------------------------------------
+int64_t sterf(
+    int64_t n,
+    float* D,
+    float* E );
+
+int64_t sterf(
+    int64_t n,
+    double* D,
+    double* E );
+
+// -----------------------------------------------------------------------------
+int64_t stev(
+    lapack::Job jobz, int64_t n,
+    float* D,
+    float* E,
+    float* Z, int64_t ldz );
+
+int64_t stev(
+    lapack::Job jobz, int64_t n,
+    double* D,
+    double* E,
+    double* Z, int64_t ldz );
+
+// -----------------------------------------------------------------------------
+int64_t stevd(
+    lapack::Job jobz, int64_t n,
+    float* D,
+    float* E,
+    float* Z, int64_t ldz );
+
+int64_t stevd(
+    lapack::Job jobz, int64_t n,
+    double* D,
+    double* E,
+    double* Z, int64_t ldz );
+
+void stevd_work_size(
+    lapack::Job jobz, int64_t n,
+    float* D,
+    float* E,
+    float* Z, int64_t ldz,
+    int64_t* lwork, int64_t* liwork );
+
+void stevd_work_size(
+    lapack::Job jobz, int64_t n,
+    double* D,
+    double* E,
+    double* Z, int64_t ldz,
+    int64_t* lwork, int64_t* liwork );
+
+int64_t stevd(
+    lapack::Job jobz, int64_t n,
+    float* D,
+    float* E,
+    float* Z, int64_t ldz,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+int64_t stevd(
+    lapack::Job jobz, int64_t n,
+    double* D,
+    double* E,
+    double* Z, int64_t ldz,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+// -----------------------------------------------------------------------------
+int64_t stevr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz );
+
+int64_t stevr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz );
+
+void stevr_work_size(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz,
+    int64_t* lwork, int64_t* liwork );
+
+void stevr_work_size(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz,
+    int64_t* lwork, int64_t* liwork );
+
+int64_t stevr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+int64_t stevr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+// -----------------------------------------------------------------------------
+int64_t stevx(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail );
+
+int64_t stevx(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail );
+
+// -----------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t sturm(
+    int64_t n, scalar_t const* diag,
+    scalar_t const* offd, scalar_t u);
+
+// -----------------------------------------------------------------------------
+int64_t sycon(
+    lapack::Uplo uplo, int64_t n,
+    float const* A, int64_t lda,
+    int64_t const* ipiv, float anorm,
+    float* rcond );
+
+// hecon alias to sycon
+inline int64_t hecon(
+    lapack::Uplo uplo, int64_t n,
+    float const* A, int64_t lda,
+    int64_t const* ipiv, float anorm,
+    float* rcond )
+{
+    return sycon( uplo, n, A, lda, ipiv, anorm, rcond );
+}
+
+int64_t sycon(
+    lapack::Uplo uplo, int64_t n,
+    double const* A, int64_t lda,
+    int64_t const* ipiv, double anorm,
+    double* rcond );
+
+// hecon alias to sycon
+inline int64_t hecon(
+    lapack::Uplo uplo, int64_t n,
+    double const* A, int64_t lda,
+    int64_t const* ipiv, double anorm,
+    double* rcond )
+{
+    return sycon( uplo, n, A, lda, ipiv, anorm, rcond );
+}
+
+int64_t sycon(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    int64_t const* ipiv, float anorm,
+    float* rcond );
+
+int64_t sycon(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    int64_t const* ipiv, double anorm,
+    double* rcond );
+
+// -----------------------------------------------------------------------------
+// sycon_rk wraps sycon_3
+int64_t sycon_rk(
+    lapack::Uplo uplo, int64_t n,
+    float const* A, int64_t lda,
+    float const* E,
+    int64_t const* ipiv, float anorm,
+    float* rcond );
+
+// hecon_rk alias to sycon_rk
+inline int64_t hecon_rk(
+    lapack::Uplo uplo, int64_t n,
+    float const* A, int64_t lda,
+    float const* E,
+    int64_t const* ipiv, float anorm,
+    float* rcond )
+{
+    return sycon_rk( uplo, n, A, lda, E, ipiv, anorm, rcond );
+}
+
+int64_t sycon_rk(
+    lapack::Uplo uplo, int64_t n,
+    double const* A, int64_t lda,
+    double const* E,
+    int64_t const* ipiv, double anorm,
+    double* rcond );
+
+// hecon_rk alias to sycon_rk
+inline int64_t hecon_rk(
+    lapack::Uplo uplo, int64_t n,
+    double const* A, int64_t lda,
+    double const* E,
+    int64_t const* ipiv, double anorm,
+    double* rcond )
+{
+    return sycon_rk( uplo, n, A, lda, E, ipiv, anorm, rcond );
+}
+
+int64_t sycon_rk(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* E,
+    int64_t const* ipiv, float anorm,
+    float* rcond );
+
+int64_t sycon_rk(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* E,
+    int64_t const* ipiv, double anorm,
+    double* rcond );
+
+// -----------------------------------------------------------------------------
+int64_t syequb(
+    lapack::Uplo uplo, int64_t n,
+    float const* A, int64_t lda,
+    float* S,
+    float* scond,
+    float* amax );
+
+// heequb alias to syequb
+inline int64_t heequb(
+    lapack::Uplo uplo, int64_t n,
+    float const* A, int64_t lda,
+    float* S,
+    float* scond,
+    float* amax )
+{
+    return syequb( uplo, n, A, lda, S, scond, amax );
+}
+
+int64_t syequb(
+    lapack::Uplo uplo, int64_t n,
+    double const* A, int64_t lda,
+    double* S,
+    double* scond,
+    double* amax );
+
+// heequb alias to syequb
+inline int64_t heequb(
+    lapack::Uplo uplo, int64_t n,
+    double const* A, int64_t lda,
+    double* S,
+    double* scond,
+    double* amax )
+{
+    return syequb( uplo, n, A, lda, S, scond, amax );
+}
+
+int64_t syequb(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    float* S,
+    float* scond,
+    float* amax );
+
+int64_t syequb(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    double* S,
+    double* scond,
+    double* amax );
+
+// -----------------------------------------------------------------------------
+int64_t syev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W );
+
+// heev alias to syev
+inline int64_t heev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W )
+{
+    return syev( jobz, uplo, n, A, lda, W );
+}
+
+int64_t syev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W );
+
+// heev alias to syev
+inline int64_t heev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W )
+{
+    return syev( jobz, uplo, n, A, lda, W );
+}
+
+void syev_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    int64_t* lwork );
+
+// heev_work_size alias to syev_work_size
+inline void heev_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    int64_t* lwork )
+{
+    syev_work_size( jobz, uplo, n, A, lda, W, lwork );
+}
+
+void syev_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    int64_t* lwork );
+
+// heev_work_size alias to syev_work_size
+inline void heev_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    int64_t* lwork )
+{
+    syev_work_size( jobz, uplo, n, A, lda, W, lwork );
+}
+
+int64_t syev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    float* work, int64_t lwork );
+
+// heev alias to syev
+inline int64_t heev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    float* work, int64_t lwork )
+{
+    return syev( jobz, uplo, n, A, lda, W, work, lwork );
+}
+
+int64_t syev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    double* work, int64_t lwork );
+
+// heev alias to syev
+inline int64_t heev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    double* work, int64_t lwork )
+{
+    return syev( jobz, uplo, n, A, lda, W, work, lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t syev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W );
+
+// heev_2stage alias to syev_2stage
+inline int64_t heev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W )
+{
+    return syev_2stage( jobz, uplo, n, A, lda, W );
+}
+
+int64_t syev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W );
+
+// heev_2stage alias to syev_2stage
+inline int64_t heev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W )
+{
+    return syev_2stage( jobz, uplo, n, A, lda, W );
+}
+
+void syev_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    int64_t* lwork );
+
+// heev_2stage_work_size alias to syev_2stage_work_size
+inline void heev_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    int64_t* lwork )
+{
+    syev_2stage_work_size( jobz, uplo, n, A, lda, W, lwork );
+}
+
+void syev_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    int64_t* lwork );
+
+// heev_2stage_work_size alias to syev_2stage_work_size
+inline void heev_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    int64_t* lwork )
+{
+    syev_2stage_work_size( jobz, uplo, n, A, lda, W, lwork );
+}
+
+int64_t syev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    float* work, int64_t lwork );
+
+// heev_2stage alias to syev_2stage
+inline int64_t heev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    float* work, int64_t lwork )
+{
+    return syev_2stage( jobz, uplo, n, A, lda, W, work, lwork );
+}
+
+int64_t syev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    double* work, int64_t lwork );
+
+// heev_2stage alias to syev_2stage
+inline int64_t heev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    double* work, int64_t lwork )
+{
+    return syev_2stage( jobz, uplo, n, A, lda, W, work, lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t syevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W );
+
+// heevd alias to syevd
+inline int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W )
+{
+    return syevd( jobz, uplo, n, A, lda, W );
+}
+
+int64_t syevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W );
+
+// heevd alias to syevd
+inline int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W )
+{
+    return syevd( jobz, uplo, n, A, lda, W );
+}
+
+void syevd_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    int64_t* lwork, int64_t* liwork );
+
+// heevd_work_size alias to syevd_work_size
+inline void heevd_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    int64_t* lwork, int64_t* liwork )
+{
+    syevd_work_size( jobz, uplo, n, A, lda, W, lwork, liwork );
+}
+
+void syevd_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    int64_t* lwork, int64_t* liwork );
+
+// heevd_work_size alias to syevd_work_size
+inline void heevd_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    int64_t* lwork, int64_t* liwork )
+{
+    syevd_work_size( jobz, uplo, n, A, lda, W, lwork, liwork );
+}
+
+int64_t syevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+// heevd alias to syevd
+inline int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    return syevd( jobz, uplo, n, A, lda, W, work, lwork, iwork, liwork );
+}
+
+int64_t syevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+// heevd alias to syevd
+inline int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    return syevd( jobz, uplo, n, A, lda, W, work, lwork, iwork, liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t syevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W );
+
+// heevd_2stage alias to syevd_2stage
+inline int64_t heevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W )
+{
+    return syevd_2stage( jobz, uplo, n, A, lda, W );
+}
+
+int64_t syevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W );
+
+// heevd_2stage alias to syevd_2stage
+inline int64_t heevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W )
+{
+    return syevd_2stage( jobz, uplo, n, A, lda, W );
+}
+
+void syevd_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    int64_t* lwork, int64_t* liwork );
+
+// heevd_2stage_work_size alias to syevd_2stage_work_size
+inline void heevd_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    int64_t* lwork, int64_t* liwork )
+{
+    syevd_2stage_work_size( jobz, uplo, n, A, lda, W, lwork, liwork );
+}
+
+void syevd_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    int64_t* lwork, int64_t* liwork );
+
+// heevd_2stage_work_size alias to syevd_2stage_work_size
+inline void heevd_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    int64_t* lwork, int64_t* liwork )
+{
+    syevd_2stage_work_size( jobz, uplo, n, A, lda, W, lwork, liwork );
+}
+
+int64_t syevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+// heevd_2stage alias to syevd_2stage
+inline int64_t heevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    return syevd_2stage( jobz, uplo, n, A, lda, W, work, lwork, iwork, liwork );
+}
+
+int64_t syevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+// heevd_2stage alias to syevd_2stage
+inline int64_t heevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    return syevd_2stage( jobz, uplo, n, A, lda, W, work, lwork, iwork, liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t syevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz );
+
+// heevr alias to syevr
+inline int64_t heevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz )
+{
+    return syevr( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, isuppz );
+}
+
+int64_t syevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz );
+
+// heevr alias to syevr
+inline int64_t heevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz )
+{
+    return syevr( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, isuppz );
+}
+
+void syevr_work_size(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz,
+    int64_t* lwork, int64_t* liwork );
+
+// heevr_work_size alias to syevr_work_size
+inline void heevr_work_size(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz,
+    int64_t* lwork, int64_t* liwork )
+{
+    syevr_work_size( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, nfound, W, Z, ldz, isuppz, lwork, liwork );
+}
+
+void syevr_work_size(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz,
+    int64_t* lwork, int64_t* liwork );
+
+// heevr_work_size alias to syevr_work_size
+inline void heevr_work_size(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz,
+    int64_t* lwork, int64_t* liwork )
+{
+    syevr_work_size( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, nfound, W, Z, ldz, isuppz, lwork, liwork );
+}
+
+int64_t syevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+// heevr alias to syevr
+inline int64_t heevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    return syevr( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, nfound, W, Z, ldz, isuppz, work, lwork, iwork, liwork );
+}
+
+int64_t syevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+// heevr alias to syevr
+inline int64_t heevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    return syevr( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, nfound, W, Z, ldz, isuppz, work, lwork, iwork, liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t syevr_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz );
+
+// heevr_2stage alias to syevr_2stage
+inline int64_t heevr_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz )
+{
+    return syevr_2stage( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, isuppz );
+}
+
+int64_t syevr_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz );
+
+// heevr_2stage alias to syevr_2stage
+inline int64_t heevr_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz )
+{
+    return syevr_2stage( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, isuppz );
+}
+
+void syevr_2stage_work_size(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz,
+    int64_t* lwork, int64_t* liwork );
+
+// heevr_2stage_work_size alias to syevr_2stage_work_size
+inline void heevr_2stage_work_size(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz,
+    int64_t* lwork, int64_t* liwork )
+{
+    syevr_2stage_work_size( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, nfound, W, Z, ldz, isuppz, lwork, liwork );
+}
+
+void syevr_2stage_work_size(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz,
+    int64_t* lwork, int64_t* liwork );
+
+// heevr_2stage_work_size alias to syevr_2stage_work_size
+inline void heevr_2stage_work_size(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz,
+    int64_t* lwork, int64_t* liwork )
+{
+    syevr_2stage_work_size( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, nfound, W, Z, ldz, isuppz, lwork, liwork );
+}
+
+int64_t syevr_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+// heevr_2stage alias to syevr_2stage
+inline int64_t heevr_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    return syevr_2stage( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, nfound, W, Z, ldz, isuppz, work, lwork, iwork, liwork );
+}
+
+int64_t syevr_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+// heevr_2stage alias to syevr_2stage
+inline int64_t heevr_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    return syevr_2stage( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, nfound, W, Z, ldz, isuppz, work, lwork, iwork, liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t syevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail );
+
+// heevx alias to syevx
+inline int64_t heevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail )
+{
+    return syevx( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
+}
+
+int64_t syevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail );
+
+// heevx alias to syevx
+inline int64_t heevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail )
+{
+    return syevx( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
+}
+
+void syevx_work_size(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail,
+    int64_t* lwork, int64_t* liwork );
+
+// heevx_work_size alias to syevx_work_size
+inline void heevx_work_size(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail,
+    int64_t* lwork, int64_t* liwork )
+{
+    syevx_work_size( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, nfound, W, Z, ldz, ifail, lwork, liwork );
+}
+
+void syevx_work_size(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    int64_t* lwork, int64_t* liwork );
+
+// heevx_work_size alias to syevx_work_size
+inline void heevx_work_size(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    int64_t* lwork, int64_t* liwork )
+{
+    syevx_work_size( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, nfound, W, Z, ldz, ifail, lwork, liwork );
+}
+
+int64_t syevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+// heevx alias to syevx
+inline int64_t heevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    return syevx( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, nfound, W, Z, ldz, ifail, work, lwork, iwork, liwork );
+}
+
+int64_t syevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+// heevx alias to syevx
+inline int64_t heevx(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    return syevx( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, nfound, W, Z, ldz, ifail, work, lwork, iwork, liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t syevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail );
+
+// heevx_2stage alias to syevx_2stage
+inline int64_t heevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail )
+{
+    return syevx_2stage( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
+}
+
+int64_t syevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail );
+
+// heevx_2stage alias to syevx_2stage
+inline int64_t heevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail )
+{
+    return syevx_2stage( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
+}
+
+void syevx_2stage_work_size(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail,
+    int64_t* lwork, int64_t* liwork );
+
+// heevx_2stage_work_size alias to syevx_2stage_work_size
+inline void heevx_2stage_work_size(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail,
+    int64_t* lwork, int64_t* liwork )
+{
+    syevx_2stage_work_size( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, nfound, W, Z, ldz, ifail, lwork, liwork );
+}
+
+void syevx_2stage_work_size(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    int64_t* lwork, int64_t* liwork );
+
+// heevx_2stage_work_size alias to syevx_2stage_work_size
+inline void heevx_2stage_work_size(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    int64_t* lwork, int64_t* liwork )
+{
+    syevx_2stage_work_size( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, nfound, W, Z, ldz, ifail, lwork, liwork );
+}
+
+int64_t syevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+// heevx_2stage alias to syevx_2stage
+inline int64_t heevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    return syevx_2stage( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, nfound, W, Z, ldz, ifail, work, lwork, iwork, liwork );
+}
+
+int64_t syevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+// heevx_2stage alias to syevx_2stage
+inline int64_t heevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    return syevx_2stage( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, nfound, W, Z, ldz, ifail, work, lwork, iwork, liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t sygst(
+    int64_t itype, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float const* B, int64_t ldb );
+
+// hegst alias to sygst
+inline int64_t hegst(
+    int64_t itype, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float const* B, int64_t ldb )
+{
+    return sygst( itype, uplo, n, A, lda, B, ldb );
+}
+
+int64_t sygst(
+    int64_t itype, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double const* B, int64_t ldb );
+
+// hegst alias to sygst
+inline int64_t hegst(
+    int64_t itype, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double const* B, int64_t ldb )
+{
+    return sygst( itype, uplo, n, A, lda, B, ldb );
+}
+
+// -----------------------------------------------------------------------------
+int64_t sygv(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W );
+
+// hegv alias to sygv
+inline int64_t hegv(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W )
+{
+    return sygv( itype, jobz, uplo, n, A, lda, B, ldb, W );
+}
+
+int64_t sygv(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W );
+
+// hegv alias to sygv
+inline int64_t hegv(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W )
+{
+    return sygv( itype, jobz, uplo, n, A, lda, B, ldb, W );
+}
+
+void sygv_work_size(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W,
+    int64_t* lwork );
+
+// hegv_work_size alias to sygv_work_size
+inline void hegv_work_size(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W,
+    int64_t* lwork )
+{
+    sygv_work_size( itype, jobz, uplo, n, A, lda, B, ldb, W, lwork );
+}
+
+void sygv_work_size(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W,
+    int64_t* lwork );
+
+// hegv_work_size alias to sygv_work_size
+inline void hegv_work_size(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W,
+    int64_t* lwork )
+{
+    sygv_work_size( itype, jobz, uplo, n, A, lda, B, ldb, W, lwork );
+}
+
+int64_t sygv(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W,
+    float* work, int64_t lwork );
+
+// hegv alias to sygv
+inline int64_t hegv(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W,
+    float* work, int64_t lwork )
+{
+    return sygv( itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork );
+}
+
+int64_t sygv(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W,
+    double* work, int64_t lwork );
+
+// hegv alias to sygv
+inline int64_t hegv(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W,
+    double* work, int64_t lwork )
+{
+    return sygv( itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t sygv_2stage(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W );
+
+// hegv_2stage alias to sygv_2stage
+inline int64_t hegv_2stage(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W )
+{
+    return sygv_2stage( itype, jobz, uplo, n, A, lda, B, ldb, W );
+}
+
+int64_t sygv_2stage(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W );
+
+// hegv_2stage alias to sygv_2stage
+inline int64_t hegv_2stage(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W )
+{
+    return sygv_2stage( itype, jobz, uplo, n, A, lda, B, ldb, W );
+}
+
+void sygv_2stage_work_size(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W,
+    int64_t* lwork );
+
+// hegv_2stage_work_size alias to sygv_2stage_work_size
+inline void hegv_2stage_work_size(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W,
+    int64_t* lwork )
+{
+    sygv_2stage_work_size( itype, jobz, uplo, n, A, lda, B, ldb, W, lwork );
+}
+
+void sygv_2stage_work_size(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W,
+    int64_t* lwork );
+
+// hegv_2stage_work_size alias to sygv_2stage_work_size
+inline void hegv_2stage_work_size(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W,
+    int64_t* lwork )
+{
+    sygv_2stage_work_size( itype, jobz, uplo, n, A, lda, B, ldb, W, lwork );
+}
+
+int64_t sygv_2stage(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W,
+    float* work, int64_t lwork );
+
+// hegv_2stage alias to sygv_2stage
+inline int64_t hegv_2stage(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W,
+    float* work, int64_t lwork )
+{
+    return sygv_2stage( itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork );
+}
+
+int64_t sygv_2stage(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W,
+    double* work, int64_t lwork );
+
+// hegv_2stage alias to sygv_2stage
+inline int64_t hegv_2stage(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W,
+    double* work, int64_t lwork )
+{
+    return sygv_2stage( itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t sygvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W );
+
+// hegvd alias to sygvd
+inline int64_t hegvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W )
+{
+    return sygvd( itype, jobz, uplo, n, A, lda, B, ldb, W );
+}
+
+int64_t sygvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W );
+
+// hegvd alias to sygvd
+inline int64_t hegvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W )
+{
+    return sygvd( itype, jobz, uplo, n, A, lda, B, ldb, W );
+}
+
+void sygvd_work_size(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W,
+    int64_t* lwork, int64_t* liwork );
+
+// hegvd_work_size alias to sygvd_work_size
+inline void hegvd_work_size(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W,
+    int64_t* lwork, int64_t* liwork )
+{
+    sygvd_work_size( itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, liwork );
+}
+
+void sygvd_work_size(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W,
+    int64_t* lwork, int64_t* liwork );
+
+// hegvd_work_size alias to sygvd_work_size
+inline void hegvd_work_size(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W,
+    int64_t* lwork, int64_t* liwork )
+{
+    sygvd_work_size( itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, liwork );
+}
+
+int64_t sygvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+// hegvd alias to sygvd
+inline int64_t hegvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    return sygvd( itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, iwork, liwork );
+}
+
+int64_t sygvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+// hegvd alias to sygvd
+inline int64_t hegvd(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    return sygvd( itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, iwork, liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t sygvx(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail );
+
+// hegvx alias to sygvx
+inline int64_t hegvx(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail )
+{
+    return sygvx( itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
+}
+
+int64_t sygvx(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail );
+
+// hegvx alias to sygvx
+inline int64_t hegvx(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail )
+{
+    return sygvx( itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
+}
+
+void sygvx_work_size(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail,
+    int64_t* lwork, int64_t* liwork );
+
+// hegvx_work_size alias to sygvx_work_size
+inline void hegvx_work_size(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail,
+    int64_t* lwork, int64_t* liwork )
+{
+    sygvx_work_size( itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, abstol, nfound, W, Z, ldz, ifail, lwork, liwork );
+}
+
+void sygvx_work_size(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    int64_t* lwork, int64_t* liwork );
+
+// hegvx_work_size alias to sygvx_work_size
+inline void hegvx_work_size(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    int64_t* lwork, int64_t* liwork )
+{
+    sygvx_work_size( itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, abstol, nfound, W, Z, ldz, ifail, lwork, liwork );
+}
+
+int64_t sygvx(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+// hegvx alias to sygvx
+inline int64_t hegvx(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    return sygvx( itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, abstol, nfound, W, Z, ldz, ifail, work, lwork, iwork, liwork );
+}
+
+int64_t sygvx(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+// hegvx alias to sygvx
+inline int64_t hegvx(
+    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    return sygvx( itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, abstol, nfound, W, Z, ldz, ifail, work, lwork, iwork, liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t syrfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float const* AF, int64_t ldaf,
+    int64_t const* ipiv,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* ferr,
+    float* berr );
+
+// herfs alias to syrfs
+inline int64_t herfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float const* AF, int64_t ldaf,
+    int64_t const* ipiv,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* ferr,
+    float* berr )
+{
+    return syrfs( uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx, ferr, berr );
+}
+
+int64_t syrfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double const* AF, int64_t ldaf,
+    int64_t const* ipiv,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* ferr,
+    double* berr );
+
+// herfs alias to syrfs
+inline int64_t herfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double const* AF, int64_t ldaf,
+    int64_t const* ipiv,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* ferr,
+    double* berr )
+{
+    return syrfs( uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx, ferr, berr );
+}
+
+int64_t syrfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* AF, int64_t ldaf,
+    int64_t const* ipiv,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    float* ferr,
+    float* berr );
+
+int64_t syrfs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* AF, int64_t ldaf,
+    int64_t const* ipiv,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double* ferr,
+    double* berr );
+
+// -----------------------------------------------------------------------------
+int64_t syrfsx(
+    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float const* AF, int64_t ldaf,
+    int64_t const* ipiv,
+    float* S,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* rcond,
+    float* berr, int64_t n_err_bnds,
+    float* err_bnds_norm,
+    float* err_bnds_comp, int64_t nparams,
+    float* params );
+
+// herfsx alias to syrfsx
+inline int64_t herfsx(
+    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float const* AF, int64_t ldaf,
+    int64_t const* ipiv,
+    float* S,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* rcond,
+    float* berr, int64_t n_err_bnds,
+    float* err_bnds_norm,
+    float* err_bnds_comp, int64_t nparams,
+    float* params )
+{
+    return syrfsx( uplo, equed, n, nrhs, A, lda, AF, ldaf, ipiv, S, B, ldb, X, ldx, rcond, berr, n_err_bnds, err_bnds_norm, err_bnds_comp, nparams, params );
+}
+
+int64_t syrfsx(
+    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double const* AF, int64_t ldaf,
+    int64_t const* ipiv,
+    double* S,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* rcond,
+    double* berr, int64_t n_err_bnds,
+    double* err_bnds_norm,
+    double* err_bnds_comp, int64_t nparams,
+    double* params );
+
+// herfsx alias to syrfsx
+inline int64_t herfsx(
+    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double const* AF, int64_t ldaf,
+    int64_t const* ipiv,
+    double* S,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* rcond,
+    double* berr, int64_t n_err_bnds,
+    double* err_bnds_norm,
+    double* err_bnds_comp, int64_t nparams,
+    double* params )
+{
+    return syrfsx( uplo, equed, n, nrhs, A, lda, AF, ldaf, ipiv, S, B, ldb, X, ldx, rcond, berr, n_err_bnds, err_bnds_norm, err_bnds_comp, nparams, params );
+}
+
+int64_t syrfsx(
+    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* AF, int64_t ldaf,
+    int64_t const* ipiv,
+    float* S,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    float* rcond,
+    float* berr, int64_t n_err_bnds,
+    float* err_bnds_norm,
+    float* err_bnds_comp, int64_t nparams,
+    float* params );
 
-int64_t steqr(
-    lapack::Job compz, int64_t n,
-    double* D,
-    double* E,
-    std::complex<double>* Z, int64_t ldz );
+int64_t syrfsx(
+    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* AF, int64_t ldaf,
+    int64_t const* ipiv,
+    double* S,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double* rcond,
+    double* berr, int64_t n_err_bnds,
+    double* err_bnds_norm,
+    double* err_bnds_comp, int64_t nparams,
+    double* params );
 
 // -----------------------------------------------------------------------------
-int64_t sterf(
-    int64_t n,
-    float* D,
-    float* E );
+int64_t sysv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    float* B, int64_t ldb );
 
-int64_t sterf(
-    int64_t n,
-    double* D,
-    double* E );
+// hesv alias to sysv
+inline int64_t hesv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    float* B, int64_t ldb )
+{
+    return sysv( uplo, n, nrhs, A, lda, ipiv, B, ldb );
+}
 
-// -----------------------------------------------------------------------------
-int64_t stev(
-    lapack::Job jobz, int64_t n,
-    float* D,
-    float* E,
-    float* Z, int64_t ldz );
+int64_t sysv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double* B, int64_t ldb );
 
-int64_t stev(
-    lapack::Job jobz, int64_t n,
-    double* D,
-    double* E,
-    double* Z, int64_t ldz );
+// hesv alias to sysv
+inline int64_t hesv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double* B, int64_t ldb )
+{
+    return sysv( uplo, n, nrhs, A, lda, ipiv, B, ldb );
+}
 
-// -----------------------------------------------------------------------------
-int64_t stevd(
-    lapack::Job jobz, int64_t n,
-    float* D,
-    float* E,
-    float* Z, int64_t ldz );
+int64_t sysv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb );
 
-int64_t stevd(
-    lapack::Job jobz, int64_t n,
-    double* D,
-    double* E,
-    double* Z, int64_t ldz );
+int64_t sysv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb );
 
-// -----------------------------------------------------------------------------
-int64_t stevr(
-    lapack::Job jobz, lapack::Range range, int64_t n,
-    float* D,
-    float* E, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    float* Z, int64_t ldz,
-    int64_t* isuppz );
+void sysv_work_size(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    float* B, int64_t ldb,
+    int64_t* lwork );
 
-int64_t stevr(
-    lapack::Job jobz, lapack::Range range, int64_t n,
-    double* D,
-    double* E, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    double* Z, int64_t ldz,
-    int64_t* isuppz );
+// hesv_work_size alias to sysv_work_size
+inline void hesv_work_size(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    float* B, int64_t ldb,
+    int64_t* lwork )
+{
+    sysv_work_size( uplo, n, nrhs, A, lda, ipiv, B, ldb, lwork );
+}
 
-// -----------------------------------------------------------------------------
-int64_t stevx(
-    lapack::Job jobz, lapack::Range range, int64_t n,
-    float* D,
-    float* E, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    float* Z, int64_t ldz,
-    int64_t* ifail );
+void sysv_work_size(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double* B, int64_t ldb,
+    int64_t* lwork );
 
-int64_t stevx(
-    lapack::Job jobz, lapack::Range range, int64_t n,
-    double* D,
-    double* E, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    double* Z, int64_t ldz,
-    int64_t* ifail );
+// hesv_work_size alias to sysv_work_size
+inline void hesv_work_size(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double* B, int64_t ldb,
+    int64_t* lwork )
+{
+    sysv_work_size( uplo, n, nrhs, A, lda, ipiv, B, ldb, lwork );
+}
 
-// -----------------------------------------------------------------------------
-template <typename scalar_t>
-int64_t sturm(
-    int64_t n, scalar_t const* diag,
-    scalar_t const* offd, scalar_t u);
+void sysv_work_size(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* lwork );
 
-// -----------------------------------------------------------------------------
-int64_t sycon(
-    lapack::Uplo uplo, int64_t n,
-    float const* A, int64_t lda,
-    int64_t const* ipiv, float anorm,
-    float* rcond );
+void sysv_work_size(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* lwork );
 
-// hecon alias to sycon
-inline int64_t hecon(
-    lapack::Uplo uplo, int64_t n,
-    float const* A, int64_t lda,
-    int64_t const* ipiv, float anorm,
-    float* rcond )
+int64_t sysv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    float* B, int64_t ldb,
+    float* work, int64_t lwork );
+
+// hesv alias to sysv
+inline int64_t hesv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    float* B, int64_t ldb,
+    float* work, int64_t lwork )
 {
-    return sycon( uplo, n, A, lda, ipiv, anorm, rcond );
+    return sysv( uplo, n, nrhs, A, lda, ipiv, B, ldb, work, lwork );
 }
 
-int64_t sycon(
-    lapack::Uplo uplo, int64_t n,
-    double const* A, int64_t lda,
-    int64_t const* ipiv, double anorm,
-    double* rcond );
+int64_t sysv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double* B, int64_t ldb,
+    double* work, int64_t lwork );
 
-// hecon alias to sycon
-inline int64_t hecon(
-    lapack::Uplo uplo, int64_t n,
-    double const* A, int64_t lda,
-    int64_t const* ipiv, double anorm,
-    double* rcond )
+// hesv alias to sysv
+inline int64_t hesv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double* B, int64_t ldb,
+    double* work, int64_t lwork )
 {
-    return sycon( uplo, n, A, lda, ipiv, anorm, rcond );
+    return sysv( uplo, n, nrhs, A, lda, ipiv, B, ldb, work, lwork );
 }
 
-int64_t sycon(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float> const* A, int64_t lda,
-    int64_t const* ipiv, float anorm,
-    float* rcond );
+int64_t sysv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* work, int64_t lwork );
 
-int64_t sycon(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double> const* A, int64_t lda,
-    int64_t const* ipiv, double anorm,
-    double* rcond );
+int64_t sysv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* work, int64_t lwork );
 
 // -----------------------------------------------------------------------------
-// sycon_rk wraps sycon_3
-int64_t sycon_rk(
-    lapack::Uplo uplo, int64_t n,
-    float const* A, int64_t lda,
-    float const* E,
-    int64_t const* ipiv, float anorm,
-    float* rcond );
-
-// hecon_rk alias to sycon_rk
-inline int64_t hecon_rk(
-    lapack::Uplo uplo, int64_t n,
-    float const* A, int64_t lda,
-    float const* E,
-    int64_t const* ipiv, float anorm,
-    float* rcond )
+int64_t sysv_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    float* B, int64_t ldb );
+
+// hesv_aa alias to sysv_aa
+inline int64_t hesv_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    float* B, int64_t ldb )
 {
-    return sycon_rk( uplo, n, A, lda, E, ipiv, anorm, rcond );
+    return sysv_aa( uplo, n, nrhs, A, lda, ipiv, B, ldb );
 }
 
-int64_t sycon_rk(
-    lapack::Uplo uplo, int64_t n,
-    double const* A, int64_t lda,
-    double const* E,
-    int64_t const* ipiv, double anorm,
-    double* rcond );
+int64_t sysv_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double* B, int64_t ldb );
 
-// hecon_rk alias to sycon_rk
-inline int64_t hecon_rk(
-    lapack::Uplo uplo, int64_t n,
-    double const* A, int64_t lda,
-    double const* E,
-    int64_t const* ipiv, double anorm,
-    double* rcond )
+// hesv_aa alias to sysv_aa
+inline int64_t hesv_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double* B, int64_t ldb )
 {
-    return sycon_rk( uplo, n, A, lda, E, ipiv, anorm, rcond );
+    return sysv_aa( uplo, n, nrhs, A, lda, ipiv, B, ldb );
 }
 
-int64_t sycon_rk(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float> const* A, int64_t lda,
-    std::complex<float> const* E,
-    int64_t const* ipiv, float anorm,
-    float* rcond );
+int64_t sysv_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb );
 
-int64_t sycon_rk(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double> const* A, int64_t lda,
-    std::complex<double> const* E,
-    int64_t const* ipiv, double anorm,
-    double* rcond );
+int64_t sysv_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb );
 
 // -----------------------------------------------------------------------------
-int64_t syequb(
-    lapack::Uplo uplo, int64_t n,
-    float const* A, int64_t lda,
-    float* S,
-    float* scond,
-    float* amax );
+int64_t sysv_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* E,
+    int64_t* ipiv,
+    float* B, int64_t ldb );
 
-// heequb alias to syequb
-inline int64_t heequb(
-    lapack::Uplo uplo, int64_t n,
-    float const* A, int64_t lda,
-    float* S,
-    float* scond,
-    float* amax )
+// hesv_rk alias to sysv_rk
+inline int64_t hesv_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* E,
+    int64_t* ipiv,
+    float* B, int64_t ldb )
 {
-    return syequb( uplo, n, A, lda, S, scond, amax );
+    return sysv_rk( uplo, n, nrhs, A, lda, E, ipiv, B, ldb );
 }
 
-int64_t syequb(
-    lapack::Uplo uplo, int64_t n,
-    double const* A, int64_t lda,
-    double* S,
-    double* scond,
-    double* amax );
+int64_t sysv_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* E,
+    int64_t* ipiv,
+    double* B, int64_t ldb );
 
-// heequb alias to syequb
-inline int64_t heequb(
-    lapack::Uplo uplo, int64_t n,
-    double const* A, int64_t lda,
-    double* S,
-    double* scond,
-    double* amax )
+// hesv_rk alias to sysv_rk
+inline int64_t hesv_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* E,
+    int64_t* ipiv,
+    double* B, int64_t ldb )
 {
-    return syequb( uplo, n, A, lda, S, scond, amax );
+    return sysv_rk( uplo, n, nrhs, A, lda, E, ipiv, B, ldb );
 }
 
-int64_t syequb(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<float> const* A, int64_t lda,
-    float* S,
-    float* scond,
-    float* amax );
+int64_t sysv_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* E,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb );
 
-int64_t syequb(
-    lapack::Uplo uplo, int64_t n,
-    std::complex<double> const* A, int64_t lda,
-    double* S,
-    double* scond,
-    double* amax );
+int64_t sysv_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* E,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb );
 
-// -----------------------------------------------------------------------------
-int64_t syev(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+void sysv_rk_work_size(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
     float* A, int64_t lda,
-    float* W );
+    float* E,
+    int64_t* ipiv,
+    float* B, int64_t ldb,
+    int64_t* lwork );
 
-// heev alias to syev
-inline int64_t heev(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+// hesv_rk_work_size alias to sysv_rk_work_size
+inline void hesv_rk_work_size(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
     float* A, int64_t lda,
-    float* W )
+    float* E,
+    int64_t* ipiv,
+    float* B, int64_t ldb,
+    int64_t* lwork )
 {
-    return syev( jobz, uplo, n, A, lda, W );
+    sysv_rk_work_size( uplo, n, nrhs, A, lda, E, ipiv, B, ldb, lwork );
 }
 
-int64_t syev(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+void sysv_rk_work_size(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
     double* A, int64_t lda,
-    double* W );
+    double* E,
+    int64_t* ipiv,
+    double* B, int64_t ldb,
+    int64_t* lwork );
 
-// heev alias to syev
-inline int64_t heev(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+// hesv_rk_work_size alias to sysv_rk_work_size
+inline void hesv_rk_work_size(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
     double* A, int64_t lda,
-    double* W )
+    double* E,
+    int64_t* ipiv,
+    double* B, int64_t ldb,
+    int64_t* lwork )
 {
-    return syev( jobz, uplo, n, A, lda, W );
+    sysv_rk_work_size( uplo, n, nrhs, A, lda, E, ipiv, B, ldb, lwork );
 }
 
-// -----------------------------------------------------------------------------
-int64_t syev_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+void sysv_rk_work_size(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* E,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* lwork );
+
+void sysv_rk_work_size(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* E,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* lwork );
+
+int64_t sysv_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
     float* A, int64_t lda,
-    float* W );
+    float* E,
+    int64_t* ipiv,
+    float* B, int64_t ldb,
+    float* work, int64_t lwork );
 
-// heev_2stage alias to syev_2stage
-inline int64_t heev_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+// hesv_rk alias to sysv_rk
+inline int64_t hesv_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
     float* A, int64_t lda,
-    float* W )
+    float* E,
+    int64_t* ipiv,
+    float* B, int64_t ldb,
+    float* work, int64_t lwork )
 {
-    return syev_2stage( jobz, uplo, n, A, lda, W );
+    return sysv_rk( uplo, n, nrhs, A, lda, E, ipiv, B, ldb, work, lwork );
 }
 
-int64_t syev_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+int64_t sysv_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
     double* A, int64_t lda,
-    double* W );
+    double* E,
+    int64_t* ipiv,
+    double* B, int64_t ldb,
+    double* work, int64_t lwork );
 
-// heev_2stage alias to syev_2stage
-inline int64_t heev_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+// hesv_rk alias to sysv_rk
+inline int64_t hesv_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
     double* A, int64_t lda,
-    double* W )
+    double* E,
+    int64_t* ipiv,
+    double* B, int64_t ldb,
+    double* work, int64_t lwork )
 {
-    return syev_2stage( jobz, uplo, n, A, lda, W );
+    return sysv_rk( uplo, n, nrhs, A, lda, E, ipiv, B, ldb, work, lwork );
 }
 
+int64_t sysv_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* E,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t sysv_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* E,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
-int64_t syevd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+int64_t sysv_rook(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
     float* A, int64_t lda,
-    float* W );
+    int64_t* ipiv,
+    float* B, int64_t ldb );
 
-// heevd alias to syevd
-inline int64_t heevd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+// hesv_rook alias to sysv_rook
+inline int64_t hesv_rook(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
     float* A, int64_t lda,
-    float* W )
+    int64_t* ipiv,
+    float* B, int64_t ldb )
 {
-    return syevd( jobz, uplo, n, A, lda, W );
+    return sysv_rook( uplo, n, nrhs, A, lda, ipiv, B, ldb );
 }
 
-int64_t syevd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+int64_t sysv_rook(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
     double* A, int64_t lda,
-    double* W );
+    int64_t* ipiv,
+    double* B, int64_t ldb );
 
-// heevd alias to syevd
-inline int64_t heevd(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+// hesv_rook alias to sysv_rook
+inline int64_t hesv_rook(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
     double* A, int64_t lda,
-    double* W )
+    int64_t* ipiv,
+    double* B, int64_t ldb )
 {
-    return syevd( jobz, uplo, n, A, lda, W );
+    return sysv_rook( uplo, n, nrhs, A, lda, ipiv, B, ldb );
 }
 
-// -----------------------------------------------------------------------------
-int64_t syevd_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+int64_t sysv_rook(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t sysv_rook(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
+void sysv_rook_work_size(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
     float* A, int64_t lda,
-    float* W );
+    int64_t* ipiv,
+    float* B, int64_t ldb,
+    int64_t* lwork );
 
-// heevd_2stage alias to syevd_2stage
-inline int64_t heevd_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+// hesv_rook_work_size alias to sysv_rook_work_size
+inline void hesv_rook_work_size(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
     float* A, int64_t lda,
-    float* W )
+    int64_t* ipiv,
+    float* B, int64_t ldb,
+    int64_t* lwork )
 {
-    return syevd_2stage( jobz, uplo, n, A, lda, W );
+    sysv_rook_work_size( uplo, n, nrhs, A, lda, ipiv, B, ldb, lwork );
 }
 
-int64_t syevd_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+void sysv_rook_work_size(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
     double* A, int64_t lda,
-    double* W );
+    int64_t* ipiv,
+    double* B, int64_t ldb,
+    int64_t* lwork );
 
-// heevd_2stage alias to syevd_2stage
-inline int64_t heevd_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+// hesv_rook_work_size alias to sysv_rook_work_size
+inline void hesv_rook_work_size(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
     double* A, int64_t lda,
-    double* W )
+    int64_t* ipiv,
+    double* B, int64_t ldb,
+    int64_t* lwork )
 {
-    return syevd_2stage( jobz, uplo, n, A, lda, W );
+    sysv_rook_work_size( uplo, n, nrhs, A, lda, ipiv, B, ldb, lwork );
 }
 
-// -----------------------------------------------------------------------------
-int64_t syevr(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    float* Z, int64_t ldz,
-    int64_t* isuppz );
+void sysv_rook_work_size(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* lwork );
 
-// heevr alias to syevr
-inline int64_t heevr(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    float* Z, int64_t ldz,
-    int64_t* isuppz )
+void sysv_rook_work_size(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* lwork );
+
+int64_t sysv_rook(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    float* B, int64_t ldb,
+    float* work, int64_t lwork );
+
+// hesv_rook alias to sysv_rook
+inline int64_t hesv_rook(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    float* B, int64_t ldb,
+    float* work, int64_t lwork )
 {
-    return syevr( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, isuppz );
+    return sysv_rook( uplo, n, nrhs, A, lda, ipiv, B, ldb, work, lwork );
 }
 
-int64_t syevr(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    double* Z, int64_t ldz,
-    int64_t* isuppz );
+int64_t sysv_rook(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double* B, int64_t ldb,
+    double* work, int64_t lwork );
 
-// heevr alias to syevr
-inline int64_t heevr(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    double* Z, int64_t ldz,
-    int64_t* isuppz )
+// hesv_rook alias to sysv_rook
+inline int64_t hesv_rook(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double* B, int64_t ldb,
+    double* work, int64_t lwork )
 {
-    return syevr( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, isuppz );
+    return sysv_rook( uplo, n, nrhs, A, lda, ipiv, B, ldb, work, lwork );
 }
 
+int64_t sysv_rook(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t sysv_rook(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
-int64_t syevr_2stage(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    float* Z, int64_t ldz,
-    int64_t* isuppz );
+int64_t sysvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float* AF, int64_t ldaf,
+    int64_t* ipiv,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr );
 
-// heevr_2stage alias to syevr_2stage
-inline int64_t heevr_2stage(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    float* Z, int64_t ldz,
-    int64_t* isuppz )
+// hesvx alias to sysvx
+inline int64_t hesvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float* AF, int64_t ldaf,
+    int64_t* ipiv,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr )
 {
-    return syevr_2stage( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, isuppz );
+    return sysvx( fact, uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx, rcond, ferr, berr );
 }
 
-int64_t syevr_2stage(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    double* Z, int64_t ldz,
-    int64_t* isuppz );
+int64_t sysvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double* AF, int64_t ldaf,
+    int64_t* ipiv,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr );
 
-// heevr_2stage alias to syevr_2stage
-inline int64_t heevr_2stage(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    double* Z, int64_t ldz,
-    int64_t* isuppz )
+// hesvx alias to sysvx
+inline int64_t hesvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double* AF, int64_t ldaf,
+    int64_t* ipiv,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr )
 {
-    return syevr_2stage( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, isuppz );
+    return sysvx( fact, uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx, rcond, ferr, berr );
 }
 
-// -----------------------------------------------------------------------------
-int64_t syevx(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    float* Z, int64_t ldz,
-    int64_t* ifail );
+int64_t sysvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float>* AF, int64_t ldaf,
+    int64_t* ipiv,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr );
 
-// heevx alias to syevx
-inline int64_t heevx(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    float* Z, int64_t ldz,
-    int64_t* ifail )
+int64_t sysvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double>* AF, int64_t ldaf,
+    int64_t* ipiv,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr );
+
+void sysvx_work_size(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float* AF, int64_t ldaf,
+    int64_t* ipiv,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr,
+    int64_t* lwork, int64_t* liwork );
+
+// hesvx_work_size alias to sysvx_work_size
+inline void hesvx_work_size(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float* AF, int64_t ldaf,
+    int64_t* ipiv,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr,
+    int64_t* lwork, int64_t* liwork )
 {
-    return syevx( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
+    sysvx_work_size( fact, uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx, rcond, ferr, berr, lwork, liwork );
 }
 
-int64_t syevx(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    double* Z, int64_t ldz,
-    int64_t* ifail );
+void sysvx_work_size(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double* AF, int64_t ldaf,
+    int64_t* ipiv,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr,
+    int64_t* lwork, int64_t* liwork );
 
-// heevx alias to syevx
-inline int64_t heevx(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    double* Z, int64_t ldz,
-    int64_t* ifail )
+// hesvx_work_size alias to sysvx_work_size
+inline void hesvx_work_size(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double* AF, int64_t ldaf,
+    int64_t* ipiv,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr,
+    int64_t* lwork, int64_t* liwork )
 {
-    return syevx( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
+    sysvx_work_size( fact, uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx, rcond, ferr, berr, lwork, liwork );
 }
 
-// -----------------------------------------------------------------------------
-int64_t syevx_2stage(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    float* Z, int64_t ldz,
-    int64_t* ifail );
+void sysvx_work_size(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float>* AF, int64_t ldaf,
+    int64_t* ipiv,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr,
+    int64_t* lwork, int64_t* lrwork );
 
-// heevx_2stage alias to syevx_2stage
-inline int64_t heevx_2stage(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    float* Z, int64_t ldz,
-    int64_t* ifail )
+void sysvx_work_size(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double>* AF, int64_t ldaf,
+    int64_t* ipiv,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr,
+    int64_t* lwork, int64_t* lrwork );
+
+int64_t sysvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float* AF, int64_t ldaf,
+    int64_t* ipiv,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
+
+// hesvx alias to sysvx
+inline int64_t hesvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float* AF, int64_t ldaf,
+    int64_t* ipiv,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
 {
-    return syevx_2stage( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
+    return sysvx( fact, uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx, rcond, ferr, berr, work, lwork, iwork, liwork );
 }
 
-int64_t syevx_2stage(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    double* Z, int64_t ldz,
-    int64_t* ifail );
+int64_t sysvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double* AF, int64_t ldaf,
+    int64_t* ipiv,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
 
-// heevx_2stage alias to syevx_2stage
-inline int64_t heevx_2stage(
-    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    double* Z, int64_t ldz,
-    int64_t* ifail )
+// hesvx alias to sysvx
+inline int64_t hesvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double* AF, int64_t ldaf,
+    int64_t* ipiv,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
 {
-    return syevx_2stage( jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
+    return sysvx( fact, uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx, rcond, ferr, berr, work, lwork, iwork, liwork );
 }
 
+int64_t sysvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float>* AF, int64_t ldaf,
+    int64_t* ipiv,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork );
+
+int64_t sysvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double>* AF, int64_t ldaf,
+    int64_t* ipiv,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork );
+
 // -----------------------------------------------------------------------------
-int64_t sygst(
-    int64_t itype, lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda,
-    float const* B, int64_t ldb );
+void syswapr(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, int64_t i1, int64_t i2 );
 
-// hegst alias to sygst
-inline int64_t hegst(
-    int64_t itype, lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda,
-    float const* B, int64_t ldb )
+// heswapr alias to syswapr
+inline void heswapr(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, int64_t i1, int64_t i2 )
 {
-    return sygst( itype, uplo, n, A, lda, B, ldb );
+    return syswapr( uplo, n, A, lda, i1, i2 );
 }
 
-int64_t sygst(
-    int64_t itype, lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda,
-    double const* B, int64_t ldb );
+void syswapr(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, int64_t i1, int64_t i2 );
 
-// hegst alias to sygst
-inline int64_t hegst(
-    int64_t itype, lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda,
-    double const* B, int64_t ldb )
+// heswapr alias to syswapr
+inline void heswapr(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, int64_t i1, int64_t i2 )
 {
-    return sygst( itype, uplo, n, A, lda, B, ldb );
+    return syswapr( uplo, n, A, lda, i1, i2 );
 }
 
+void syswapr(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t i1, int64_t i2 );
+
+void syswapr(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t i1, int64_t i2 );
+
 // -----------------------------------------------------------------------------
-int64_t sygv(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+int64_t sytrd(
+    lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
-    float* B, int64_t ldb,
-    float* W );
+    float* D,
+    float* E,
+    float* tau );
 
-// hegv alias to sygv
-inline int64_t hegv(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+// hetrd alias to sytrd
+inline int64_t hetrd(
+    lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
-    float* B, int64_t ldb,
-    float* W )
+    float* D,
+    float* E,
+    float* tau )
 {
-    return sygv( itype, jobz, uplo, n, A, lda, B, ldb, W );
+    return sytrd( uplo, n, A, lda, D, E, tau );
 }
 
-int64_t sygv(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+int64_t sytrd(
+    lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
-    double* B, int64_t ldb,
-    double* W );
+    double* D,
+    double* E,
+    double* tau );
 
-// hegv alias to sygv
-inline int64_t hegv(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+// hetrd alias to sytrd
+inline int64_t hetrd(
+    lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
-    double* B, int64_t ldb,
-    double* W )
+    double* D,
+    double* E,
+    double* tau )
 {
-    return sygv( itype, jobz, uplo, n, A, lda, B, ldb, W );
+    return sytrd( uplo, n, A, lda, D, E, tau );
 }
 
-// -----------------------------------------------------------------------------
-int64_t sygv_2stage(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+void sytrd_work_size(
+    lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
-    float* B, int64_t ldb,
-    float* W );
+    float* D,
+    float* E,
+    float* tau,
+    int64_t* lwork );
 
-// hegv_2stage alias to sygv_2stage
-inline int64_t hegv_2stage(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+// hetrd_work_size alias to sytrd_work_size
+inline void hetrd_work_size(
+    lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
-    float* B, int64_t ldb,
-    float* W )
+    float* D,
+    float* E,
+    float* tau,
+    int64_t* lwork )
 {
-    return sygv_2stage( itype, jobz, uplo, n, A, lda, B, ldb, W );
+    sytrd_work_size( uplo, n, A, lda, D, E, tau, lwork );
 }
 
-int64_t sygv_2stage(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+void sytrd_work_size(
+    lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
-    double* B, int64_t ldb,
-    double* W );
+    double* D,
+    double* E,
+    double* tau,
+    int64_t* lwork );
 
-// hegv_2stage alias to sygv_2stage
-inline int64_t hegv_2stage(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+// hetrd_work_size alias to sytrd_work_size
+inline void hetrd_work_size(
+    lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
-    double* B, int64_t ldb,
-    double* W )
+    double* D,
+    double* E,
+    double* tau,
+    int64_t* lwork )
 {
-    return sygv_2stage( itype, jobz, uplo, n, A, lda, B, ldb, W );
+    sytrd_work_size( uplo, n, A, lda, D, E, tau, lwork );
 }
 
-// -----------------------------------------------------------------------------
-int64_t sygvd(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+int64_t sytrd(
+    lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
-    float* B, int64_t ldb,
-    float* W );
+    float* D,
+    float* E,
+    float* tau,
+    float* work, int64_t lwork );
 
-// hegvd alias to sygvd
-inline int64_t hegvd(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+// hetrd alias to sytrd
+inline int64_t hetrd(
+    lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
-    float* B, int64_t ldb,
-    float* W )
+    float* D,
+    float* E,
+    float* tau,
+    float* work, int64_t lwork )
 {
-    return sygvd( itype, jobz, uplo, n, A, lda, B, ldb, W );
+    return sytrd( uplo, n, A, lda, D, E, tau, work, lwork );
 }
 
-int64_t sygvd(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+int64_t sytrd(
+    lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
-    double* B, int64_t ldb,
-    double* W );
+    double* D,
+    double* E,
+    double* tau,
+    double* work, int64_t lwork );
 
-// hegvd alias to sygvd
-inline int64_t hegvd(
-    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+// hetrd alias to sytrd
+inline int64_t hetrd(
+    lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
-    double* B, int64_t ldb,
-    double* W )
+    double* D,
+    double* E,
+    double* tau,
+    double* work, int64_t lwork )
 {
-    return sygvd( itype, jobz, uplo, n, A, lda, B, ldb, W );
+    return sytrd( uplo, n, A, lda, D, E, tau, work, lwork );
 }
 
 // -----------------------------------------------------------------------------
-int64_t sygvx(
-    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+int64_t sytrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
-    float* B, int64_t ldb, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    float* Z, int64_t ldz,
-    int64_t* ifail );
+    float* D,
+    float* E,
+    float* tau,
+    float* hous2, int64_t lhous2 );
 
-// hegvx alias to sygvx
-inline int64_t hegvx(
-    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+// hetrd_2stage alias to sytrd_2stage
+inline int64_t hetrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
-    float* B, int64_t ldb, float vl, float vu, int64_t il, int64_t iu, float abstol,
-    int64_t* m,
-    float* W,
-    float* Z, int64_t ldz,
-    int64_t* ifail )
+    float* D,
+    float* E,
+    float* tau,
+    float* hous2, int64_t lhous2 )
 {
-    return sygvx( itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
+    return sytrd_2stage( jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2 );
 }
 
-int64_t sygvx(
-    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+int64_t sytrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
-    double* B, int64_t ldb, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    double* Z, int64_t ldz,
-    int64_t* ifail );
+    double* D,
+    double* E,
+    double* tau,
+    double* hous2, int64_t lhous2 );
 
-// hegvx alias to sygvx
-inline int64_t hegvx(
-    int64_t itype, lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+// hetrd_2stage alias to sytrd_2stage
+inline int64_t hetrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
-    double* B, int64_t ldb, double vl, double vu, int64_t il, int64_t iu, double abstol,
-    int64_t* m,
-    double* W,
-    double* Z, int64_t ldz,
-    int64_t* ifail )
+    double* D,
+    double* E,
+    double* tau,
+    double* hous2, int64_t lhous2 )
 {
-    return sygvx( itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, abstol, m, W, Z, ldz, ifail );
+    return sytrd_2stage( jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2 );
 }
 
-// -----------------------------------------------------------------------------
-int64_t syrfs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float const* A, int64_t lda,
-    float const* AF, int64_t ldaf,
-    int64_t const* ipiv,
-    float const* B, int64_t ldb,
-    float* X, int64_t ldx,
-    float* ferr,
-    float* berr );
+void sytrd_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tau,
+    float* hous2, int64_t lhous2,
+    int64_t* lwork );
 
-// herfs alias to syrfs
-inline int64_t herfs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float const* A, int64_t lda,
-    float const* AF, int64_t ldaf,
-    int64_t const* ipiv,
-    float const* B, int64_t ldb,
-    float* X, int64_t ldx,
-    float* ferr,
-    float* berr )
+// hetrd_2stage_work_size alias to sytrd_2stage_work_size
+inline void hetrd_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tau,
+    float* hous2, int64_t lhous2,
+    int64_t* lwork )
 {
-    return syrfs( uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx, ferr, berr );
+    sytrd_2stage_work_size( jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2, lwork );
 }
 
-int64_t syrfs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double const* A, int64_t lda,
-    double const* AF, int64_t ldaf,
-    int64_t const* ipiv,
-    double const* B, int64_t ldb,
-    double* X, int64_t ldx,
-    double* ferr,
-    double* berr );
+void sytrd_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tau,
+    double* hous2, int64_t lhous2,
+    int64_t* lwork );
 
-// herfs alias to syrfs
-inline int64_t herfs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double const* A, int64_t lda,
-    double const* AF, int64_t ldaf,
-    int64_t const* ipiv,
-    double const* B, int64_t ldb,
-    double* X, int64_t ldx,
-    double* ferr,
-    double* berr )
+// hetrd_2stage_work_size alias to sytrd_2stage_work_size
+inline void hetrd_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tau,
+    double* hous2, int64_t lhous2,
+    int64_t* lwork )
 {
-    return syrfs( uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx, ferr, berr );
+    sytrd_2stage_work_size( jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2, lwork );
 }
 
-int64_t syrfs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float> const* A, int64_t lda,
-    std::complex<float> const* AF, int64_t ldaf,
-    int64_t const* ipiv,
-    std::complex<float> const* B, int64_t ldb,
-    std::complex<float>* X, int64_t ldx,
-    float* ferr,
-    float* berr );
-
-int64_t syrfs(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double> const* A, int64_t lda,
-    std::complex<double> const* AF, int64_t ldaf,
-    int64_t const* ipiv,
-    std::complex<double> const* B, int64_t ldb,
-    std::complex<double>* X, int64_t ldx,
-    double* ferr,
-    double* berr );
-
-// -----------------------------------------------------------------------------
-int64_t syrfsx(
-    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
-    float const* A, int64_t lda,
-    float const* AF, int64_t ldaf,
-    int64_t const* ipiv,
-    float* S,
-    float const* B, int64_t ldb,
-    float* X, int64_t ldx,
-    float* rcond,
-    float* berr, int64_t n_err_bnds,
-    float* err_bnds_norm,
-    float* err_bnds_comp, int64_t nparams,
-    float* params );
+int64_t sytrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tau,
+    float* hous2, int64_t lhous2,
+    float* work, int64_t lwork );
 
-// herfsx alias to syrfsx
-inline int64_t herfsx(
-    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
-    float const* A, int64_t lda,
-    float const* AF, int64_t ldaf,
-    int64_t const* ipiv,
-    float* S,
-    float const* B, int64_t ldb,
-    float* X, int64_t ldx,
-    float* rcond,
-    float* berr, int64_t n_err_bnds,
-    float* err_bnds_norm,
-    float* err_bnds_comp, int64_t nparams,
-    float* params )
+// hetrd_2stage alias to sytrd_2stage
+inline int64_t hetrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tau,
+    float* hous2, int64_t lhous2,
+    float* work, int64_t lwork )
 {
-    return syrfsx( uplo, equed, n, nrhs, A, lda, AF, ldaf, ipiv, S, B, ldb, X, ldx, rcond, berr, n_err_bnds, err_bnds_norm, err_bnds_comp, nparams, params );
+    return sytrd_2stage( jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2, work, lwork );
 }
 
-int64_t syrfsx(
-    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
-    double const* A, int64_t lda,
-    double const* AF, int64_t ldaf,
-    int64_t const* ipiv,
-    double* S,
-    double const* B, int64_t ldb,
-    double* X, int64_t ldx,
-    double* rcond,
-    double* berr, int64_t n_err_bnds,
-    double* err_bnds_norm,
-    double* err_bnds_comp, int64_t nparams,
-    double* params );
+int64_t sytrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tau,
+    double* hous2, int64_t lhous2,
+    double* work, int64_t lwork );
 
-// herfsx alias to syrfsx
-inline int64_t herfsx(
-    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
-    double const* A, int64_t lda,
-    double const* AF, int64_t ldaf,
-    int64_t const* ipiv,
-    double* S,
-    double const* B, int64_t ldb,
-    double* X, int64_t ldx,
-    double* rcond,
-    double* berr, int64_t n_err_bnds,
-    double* err_bnds_norm,
-    double* err_bnds_comp, int64_t nparams,
-    double* params )
+// hetrd_2stage alias to sytrd_2stage
+inline int64_t hetrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tau,
+    double* hous2, int64_t lhous2,
+    double* work, int64_t lwork )
 {
-    return syrfsx( uplo, equed, n, nrhs, A, lda, AF, ldaf, ipiv, S, B, ldb, X, ldx, rcond, berr, n_err_bnds, err_bnds_norm, err_bnds_comp, nparams, params );
+    return sytrd_2stage( jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2, work, lwork );
 }
 
-int64_t syrfsx(
-    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
-    std::complex<float> const* A, int64_t lda,
-    std::complex<float> const* AF, int64_t ldaf,
-    int64_t const* ipiv,
-    float* S,
-    std::complex<float> const* B, int64_t ldb,
-    std::complex<float>* X, int64_t ldx,
-    float* rcond,
-    float* berr, int64_t n_err_bnds,
-    float* err_bnds_norm,
-    float* err_bnds_comp, int64_t nparams,
-    float* params );
-
-int64_t syrfsx(
-    lapack::Uplo uplo, lapack::Equed equed, int64_t n, int64_t nrhs,
-    std::complex<double> const* A, int64_t lda,
-    std::complex<double> const* AF, int64_t ldaf,
-    int64_t const* ipiv,
-    double* S,
-    std::complex<double> const* B, int64_t ldb,
-    std::complex<double>* X, int64_t ldx,
-    double* rcond,
-    double* berr, int64_t n_err_bnds,
-    double* err_bnds_norm,
-    double* err_bnds_comp, int64_t nparams,
-    double* params );
-
 // -----------------------------------------------------------------------------
-int64_t sysv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+int64_t sytrf(
+    lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
-    int64_t* ipiv,
-    float* B, int64_t ldb );
+    int64_t* ipiv );
 
-// hesv alias to sysv
-inline int64_t hesv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+// hetrf alias to sytrf
+inline int64_t hetrf(
+    lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
-    int64_t* ipiv,
-    float* B, int64_t ldb )
+    int64_t* ipiv )
 {
-    return sysv( uplo, n, nrhs, A, lda, ipiv, B, ldb );
+    return sytrf( uplo, n, A, lda, ipiv );
 }
 
-int64_t sysv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+int64_t sytrf(
+    lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
-    int64_t* ipiv,
-    double* B, int64_t ldb );
+    int64_t* ipiv );
 
-// hesv alias to sysv
-inline int64_t hesv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+// hetrf alias to sytrf
+inline int64_t hetrf(
+    lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
-    int64_t* ipiv,
-    double* B, int64_t ldb )
+    int64_t* ipiv )
 {
-    return sysv( uplo, n, nrhs, A, lda, ipiv, B, ldb );
+    return sytrf( uplo, n, A, lda, ipiv );
 }
 
-int64_t sysv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+int64_t sytrf(
+    lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda,
-    int64_t* ipiv,
-    std::complex<float>* B, int64_t ldb );
+    int64_t* ipiv );
 
-int64_t sysv(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+int64_t sytrf(
+    lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda,
-    int64_t* ipiv,
-    std::complex<double>* B, int64_t ldb );
+    int64_t* ipiv );
 
-// -----------------------------------------------------------------------------
-int64_t sysv_aa(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+void sytrf_work_size(
+    lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
     int64_t* ipiv,
-    float* B, int64_t ldb );
+    int64_t* lwork );
 
-// hesv_aa alias to sysv_aa
-inline int64_t hesv_aa(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+// hetrf_work_size alias to sytrf_work_size
+inline void hetrf_work_size(
+    lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
     int64_t* ipiv,
-    float* B, int64_t ldb )
+    int64_t* lwork )
 {
-    return sysv_aa( uplo, n, nrhs, A, lda, ipiv, B, ldb );
+    sytrf_work_size( uplo, n, A, lda, ipiv, lwork );
 }
 
-int64_t sysv_aa(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+void sytrf_work_size(
+    lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
     int64_t* ipiv,
-    double* B, int64_t ldb );
+    int64_t* lwork );
 
-// hesv_aa alias to sysv_aa
-inline int64_t hesv_aa(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+// hetrf_work_size alias to sytrf_work_size
+inline void hetrf_work_size(
+    lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
     int64_t* ipiv,
-    double* B, int64_t ldb )
+    int64_t* lwork )
 {
-    return sysv_aa( uplo, n, nrhs, A, lda, ipiv, B, ldb );
+    sytrf_work_size( uplo, n, A, lda, ipiv, lwork );
 }
 
-int64_t sysv_aa(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+void sytrf_work_size(
+    lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda,
     int64_t* ipiv,
-    std::complex<float>* B, int64_t ldb );
+    int64_t* lwork );
 
-int64_t sysv_aa(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+void sytrf_work_size(
+    lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda,
     int64_t* ipiv,
-    std::complex<double>* B, int64_t ldb );
+    int64_t* lwork );
 
-// -----------------------------------------------------------------------------
-int64_t sysv_rk(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+int64_t sytrf(
+    lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
-    float* E,
     int64_t* ipiv,
-    float* B, int64_t ldb );
+    float* work, int64_t lwork );
 
-// hesv_rk alias to sysv_rk
-inline int64_t hesv_rk(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+// hetrf alias to sytrf
+inline int64_t hetrf(
+    lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
-    float* E,
     int64_t* ipiv,
-    float* B, int64_t ldb )
+    float* work, int64_t lwork )
 {
-    return sysv_rk( uplo, n, nrhs, A, lda, E, ipiv, B, ldb );
+    return sytrf( uplo, n, A, lda, ipiv, work, lwork );
 }
 
-int64_t sysv_rk(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+int64_t sytrf(
+    lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
-    double* E,
     int64_t* ipiv,
-    double* B, int64_t ldb );
+    double* work, int64_t lwork );
 
-// hesv_rk alias to sysv_rk
-inline int64_t hesv_rk(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+// hetrf alias to sytrf
+inline int64_t hetrf(
+    lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
-    double* E,
     int64_t* ipiv,
-    double* B, int64_t ldb )
+    double* work, int64_t lwork )
 {
-    return sysv_rk( uplo, n, nrhs, A, lda, E, ipiv, B, ldb );
+    return sytrf( uplo, n, A, lda, ipiv, work, lwork );
 }
 
-int64_t sysv_rk(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+int64_t sytrf(
+    lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda,
-    std::complex<float>* E,
     int64_t* ipiv,
-    std::complex<float>* B, int64_t ldb );
+    std::complex<float>* work, int64_t lwork );
 
-int64_t sysv_rk(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+int64_t sytrf(
+    lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda,
-    std::complex<double>* E,
     int64_t* ipiv,
-    std::complex<double>* B, int64_t ldb );
+    std::complex<double>* work, int64_t lwork );
 
 // -----------------------------------------------------------------------------
-int64_t sysv_rook(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+int64_t sytrf_aa(
+    lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
-    int64_t* ipiv,
-    float* B, int64_t ldb );
+    int64_t* ipiv );
 
-// hesv_rook alias to sysv_rook
-inline int64_t hesv_rook(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+// hetrf_aa alias to sytrf_aa
+inline int64_t hetrf_aa(
+    lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
-    int64_t* ipiv,
-    float* B, int64_t ldb )
+    int64_t* ipiv )
 {
-    return sysv_rook( uplo, n, nrhs, A, lda, ipiv, B, ldb );
+    return sytrf_aa( uplo, n, A, lda, ipiv );
 }
 
-int64_t sysv_rook(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+int64_t sytrf_aa(
+    lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
-    int64_t* ipiv,
-    double* B, int64_t ldb );
+    int64_t* ipiv );
 
-// hesv_rook alias to sysv_rook
-inline int64_t hesv_rook(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+// hetrf_aa alias to sytrf_aa
+inline int64_t hetrf_aa(
+    lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
-    int64_t* ipiv,
-    double* B, int64_t ldb )
+    int64_t* ipiv )
 {
-    return sysv_rook( uplo, n, nrhs, A, lda, ipiv, B, ldb );
+    return sytrf_aa( uplo, n, A, lda, ipiv );
 }
 
-int64_t sysv_rook(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+int64_t sytrf_aa(
+    lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda,
-    int64_t* ipiv,
-    std::complex<float>* B, int64_t ldb );
+    int64_t* ipiv );
 
-int64_t sysv_rook(
-    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+int64_t sytrf_aa(
+    lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda,
-    int64_t* ipiv,
-    std::complex<double>* B, int64_t ldb );
+    int64_t* ipiv );
 
-// -----------------------------------------------------------------------------
-int64_t sysvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float const* A, int64_t lda,
-    float* AF, int64_t ldaf,
-    int64_t* ipiv,
-    float const* B, int64_t ldb,
-    float* X, int64_t ldx,
-    float* rcond,
-    float* ferr,
-    float* berr );
+void sytrf_aa_work_size(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    int64_t* lwork );
 
-// hesvx alias to sysvx
-inline int64_t hesvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    float const* A, int64_t lda,
-    float* AF, int64_t ldaf,
+// hetrf_aa_work_size alias to sytrf_aa_work_size
+inline void hetrf_aa_work_size(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
     int64_t* ipiv,
-    float const* B, int64_t ldb,
-    float* X, int64_t ldx,
-    float* rcond,
-    float* ferr,
-    float* berr )
+    int64_t* lwork )
 {
-    return sysvx( fact, uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx, rcond, ferr, berr );
+    sytrf_aa_work_size( uplo, n, A, lda, ipiv, lwork );
 }
 
-int64_t sysvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double const* A, int64_t lda,
-    double* AF, int64_t ldaf,
+void sytrf_aa_work_size(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
     int64_t* ipiv,
-    double const* B, int64_t ldb,
-    double* X, int64_t ldx,
-    double* rcond,
-    double* ferr,
-    double* berr );
+    int64_t* lwork );
 
-// hesvx alias to sysvx
-inline int64_t hesvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double const* A, int64_t lda,
-    double* AF, int64_t ldaf,
+// hetrf_aa_work_size alias to sytrf_aa_work_size
+inline void hetrf_aa_work_size(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
     int64_t* ipiv,
-    double const* B, int64_t ldb,
-    double* X, int64_t ldx,
-    double* rcond,
-    double* ferr,
-    double* berr )
+    int64_t* lwork )
 {
-    return sysvx( fact, uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx, rcond, ferr, berr );
+    sytrf_aa_work_size( uplo, n, A, lda, ipiv, lwork );
 }
 
-int64_t sysvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float> const* A, int64_t lda,
-    std::complex<float>* AF, int64_t ldaf,
+void sytrf_aa_work_size(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
     int64_t* ipiv,
-    std::complex<float> const* B, int64_t ldb,
-    std::complex<float>* X, int64_t ldx,
-    float* rcond,
-    float* ferr,
-    float* berr );
+    int64_t* lwork );
 
-int64_t sysvx(
-    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<double> const* A, int64_t lda,
-    std::complex<double>* AF, int64_t ldaf,
+void sytrf_aa_work_size(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
     int64_t* ipiv,
-    std::complex<double> const* B, int64_t ldb,
-    std::complex<double>* X, int64_t ldx,
-    double* rcond,
-    double* ferr,
-    double* berr );
+    int64_t* lwork );
 
-// -----------------------------------------------------------------------------
-void syswapr(
+int64_t sytrf_aa(
     lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda, int64_t i1, int64_t i2 );
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    float* work, int64_t lwork );
 
-// heswapr alias to syswapr
-inline void heswapr(
+// hetrf_aa alias to sytrf_aa
+inline int64_t hetrf_aa(
     lapack::Uplo uplo, int64_t n,
-    float* A, int64_t lda, int64_t i1, int64_t i2 )
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    float* work, int64_t lwork )
 {
-    return syswapr( uplo, n, A, lda, i1, i2 );
+    return sytrf_aa( uplo, n, A, lda, ipiv, work, lwork );
 }
 
-void syswapr(
+int64_t sytrf_aa(
     lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda, int64_t i1, int64_t i2 );
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double* work, int64_t lwork );
 
-// heswapr alias to syswapr
-inline void heswapr(
+// hetrf_aa alias to sytrf_aa
+inline int64_t hetrf_aa(
     lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda, int64_t i1, int64_t i2 )
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double* work, int64_t lwork )
 {
-    return syswapr( uplo, n, A, lda, i1, i2 );
+    return sytrf_aa( uplo, n, A, lda, ipiv, work, lwork );
 }
 
-void syswapr(
+int64_t sytrf_aa(
     lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda, int64_t i1, int64_t i2 );
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* work, int64_t lwork );
 
-void syswapr(
+int64_t sytrf_aa(
     lapack::Uplo uplo, int64_t n,
-    std::complex<double>* A, int64_t lda, int64_t i1, int64_t i2 );
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* work, int64_t lwork );
 
 // -----------------------------------------------------------------------------
-int64_t sytrd(
+int64_t sytrf_rk(
     lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
-    float* D,
     float* E,
-    float* tau );
+    int64_t* ipiv );
 
-// hetrd alias to sytrd
-inline int64_t hetrd(
+// hetrf_rk alias to sytrf_rk
+inline int64_t hetrf_rk(
     lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
-    float* D,
     float* E,
-    float* tau )
+    int64_t* ipiv )
 {
-    return sytrd( uplo, n, A, lda, D, E, tau );
+    return sytrf_rk( uplo, n, A, lda, E, ipiv );
 }
 
-int64_t sytrd(
+int64_t sytrf_rk(
     lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
-    double* D,
     double* E,
-    double* tau );
+    int64_t* ipiv );
 
-// hetrd alias to sytrd
-inline int64_t hetrd(
+// hetrf_rk alias to sytrf_rk
+inline int64_t hetrf_rk(
     lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
-    double* D,
     double* E,
-    double* tau )
+    int64_t* ipiv )
 {
-    return sytrd( uplo, n, A, lda, D, E, tau );
+    return sytrf_rk( uplo, n, A, lda, E, ipiv );
 }
 
-// -----------------------------------------------------------------------------
-int64_t sytrd_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+int64_t sytrf_rk(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* E,
+    int64_t* ipiv );
+
+int64_t sytrf_rk(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* E,
+    int64_t* ipiv );
+
+void sytrf_rk_work_size(
+    lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
-    float* D,
     float* E,
-    float* tau,
-    float* hous2, int64_t lhous2 );
+    int64_t* ipiv,
+    int64_t* lwork );
 
-// hetrd_2stage alias to sytrd_2stage
-inline int64_t hetrd_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+// hetrf_rk_work_size alias to sytrf_rk_work_size
+inline void hetrf_rk_work_size(
+    lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
-    float* D,
     float* E,
-    float* tau,
-    float* hous2, int64_t lhous2 )
+    int64_t* ipiv,
+    int64_t* lwork )
 {
-    return sytrd_2stage( jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2 );
+    sytrf_rk_work_size( uplo, n, A, lda, E, ipiv, lwork );
 }
 
-int64_t sytrd_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+void sytrf_rk_work_size(
+    lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
-    double* D,
     double* E,
-    double* tau,
-    double* hous2, int64_t lhous2 );
+    int64_t* ipiv,
+    int64_t* lwork );
 
-// hetrd_2stage alias to sytrd_2stage
-inline int64_t hetrd_2stage(
-    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+// hetrf_rk_work_size alias to sytrf_rk_work_size
+inline void hetrf_rk_work_size(
+    lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
-    double* D,
     double* E,
-    double* tau,
-    double* hous2, int64_t lhous2 )
+    int64_t* ipiv,
+    int64_t* lwork )
 {
-    return sytrd_2stage( jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2 );
+    sytrf_rk_work_size( uplo, n, A, lda, E, ipiv, lwork );
 }
 
-// -----------------------------------------------------------------------------
-int64_t sytrf(
+void sytrf_rk_work_size(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* E,
+    int64_t* ipiv,
+    int64_t* lwork );
+
+void sytrf_rk_work_size(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* E,
+    int64_t* ipiv,
+    int64_t* lwork );
+
+int64_t sytrf_rk(
     lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
-    int64_t* ipiv );
+    float* E,
+    int64_t* ipiv,
+    float* work, int64_t lwork );
 
-// hetrf alias to sytrf
-inline int64_t hetrf(
+// hetrf_rk alias to sytrf_rk
+inline int64_t hetrf_rk(
     lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
-    int64_t* ipiv )
+    float* E,
+    int64_t* ipiv,
+    float* work, int64_t lwork )
 {
-    return sytrf( uplo, n, A, lda, ipiv );
+    return sytrf_rk( uplo, n, A, lda, E, ipiv, work, lwork );
 }
 
-int64_t sytrf(
+int64_t sytrf_rk(
     lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
-    int64_t* ipiv );
+    double* E,
+    int64_t* ipiv,
+    double* work, int64_t lwork );
 
-// hetrf alias to sytrf
-inline int64_t hetrf(
+// hetrf_rk alias to sytrf_rk
+inline int64_t hetrf_rk(
     lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
-    int64_t* ipiv )
+    double* E,
+    int64_t* ipiv,
+    double* work, int64_t lwork )
 {
-    return sytrf( uplo, n, A, lda, ipiv );
+    return sytrf_rk( uplo, n, A, lda, E, ipiv, work, lwork );
 }
 
-int64_t sytrf(
+int64_t sytrf_rk(
     lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda,
-    int64_t* ipiv );
+    std::complex<float>* E,
+    int64_t* ipiv,
+    std::complex<float>* work, int64_t lwork );
 
-int64_t sytrf(
+int64_t sytrf_rk(
     lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda,
-    int64_t* ipiv );
+    std::complex<double>* E,
+    int64_t* ipiv,
+    std::complex<double>* work, int64_t lwork );
 
 // -----------------------------------------------------------------------------
-int64_t sytrf_aa(
+int64_t sytrf_rook(
     lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
     int64_t* ipiv );
 
-// hetrf_aa alias to sytrf_aa
-inline int64_t hetrf_aa(
+// hetrf_rook alias to sytrf_rook
+inline int64_t hetrf_rook(
     lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
     int64_t* ipiv )
 {
-    return sytrf_aa( uplo, n, A, lda, ipiv );
+    return sytrf_rook( uplo, n, A, lda, ipiv );
 }
 
-int64_t sytrf_aa(
+int64_t sytrf_rook(
     lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
     int64_t* ipiv );
 
-// hetrf_aa alias to sytrf_aa
-inline int64_t hetrf_aa(
+// hetrf_rook alias to sytrf_rook
+inline int64_t hetrf_rook(
     lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
     int64_t* ipiv )
 {
-    return sytrf_aa( uplo, n, A, lda, ipiv );
+    return sytrf_rook( uplo, n, A, lda, ipiv );
 }
 
-int64_t sytrf_aa(
+int64_t sytrf_rook(
     lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda,
     int64_t* ipiv );
 
-int64_t sytrf_aa(
+int64_t sytrf_rook(
     lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda,
     int64_t* ipiv );
 
-// -----------------------------------------------------------------------------
-int64_t sytrf_rk(
+void sytrf_rook_work_size(
     lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
-    float* E,
-    int64_t* ipiv );
+    int64_t* ipiv,
+    int64_t* lwork );
 
-// hetrf_rk alias to sytrf_rk
-inline int64_t hetrf_rk(
+// hetrf_rook_work_size alias to sytrf_rook_work_size
+inline void hetrf_rook_work_size(
     lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
-    float* E,
-    int64_t* ipiv )
+    int64_t* ipiv,
+    int64_t* lwork )
 {
-    return sytrf_rk( uplo, n, A, lda, E, ipiv );
+    sytrf_rook_work_size( uplo, n, A, lda, ipiv, lwork );
 }
 
-int64_t sytrf_rk(
+void sytrf_rook_work_size(
     lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
-    double* E,
-    int64_t* ipiv );
-
-// hetrf_rk alias to sytrf_rk
-inline int64_t hetrf_rk(
+    int64_t* ipiv,
+    int64_t* lwork );
+
+// hetrf_rook_work_size alias to sytrf_rook_work_size
+inline void hetrf_rook_work_size(
     lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
-    double* E,
-    int64_t* ipiv )
+    int64_t* ipiv,
+    int64_t* lwork )
 {
-    return sytrf_rk( uplo, n, A, lda, E, ipiv );
+    sytrf_rook_work_size( uplo, n, A, lda, ipiv, lwork );
 }
 
-int64_t sytrf_rk(
+void sytrf_rook_work_size(
     lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda,
-    std::complex<float>* E,
-    int64_t* ipiv );
+    int64_t* ipiv,
+    int64_t* lwork );
 
-int64_t sytrf_rk(
+void sytrf_rook_work_size(
     lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda,
-    std::complex<double>* E,
-    int64_t* ipiv );
+    int64_t* ipiv,
+    int64_t* lwork );
 
-// -----------------------------------------------------------------------------
 int64_t sytrf_rook(
     lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
-    int64_t* ipiv );
+    int64_t* ipiv,
+    float* work, int64_t lwork );
 
 // hetrf_rook alias to sytrf_rook
 inline int64_t hetrf_rook(
     lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
-    int64_t* ipiv )
+    int64_t* ipiv,
+    float* work, int64_t lwork )
 {
-    return sytrf_rook( uplo, n, A, lda, ipiv );
+    return sytrf_rook( uplo, n, A, lda, ipiv, work, lwork );
 }
 
 int64_t sytrf_rook(
     lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
-    int64_t* ipiv );
+    int64_t* ipiv,
+    double* work, int64_t lwork );
 
 // hetrf_rook alias to sytrf_rook
 inline int64_t hetrf_rook(
     lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
-    int64_t* ipiv )
+    int64_t* ipiv,
+    double* work, int64_t lwork )
 {
-    return sytrf_rook( uplo, n, A, lda, ipiv );
+    return sytrf_rook( uplo, n, A, lda, ipiv, work, lwork );
 }
 
 int64_t sytrf_rook(
     lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda,
-    int64_t* ipiv );
+    int64_t* ipiv,
+    std::complex<float>* work, int64_t lwork );
 
 int64_t sytrf_rook(
     lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda,
-    int64_t* ipiv );
+    int64_t* ipiv,
+    std::complex<double>* work, int64_t lwork );
 
 // -----------------------------------------------------------------------------
 int64_t sytri(
@@ -8892,6 +15754,94 @@ int64_t sytri2(
     std::complex<double>* A, int64_t lda,
     int64_t const* ipiv );
 
+void sytri2_work_size(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    int64_t const* ipiv,
+    int64_t* lwork );
+
+// hetri2_work_size alias to sytri2_work_size
+inline void hetri2_work_size(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    int64_t const* ipiv,
+    int64_t* lwork )
+{
+    sytri2_work_size( uplo, n, A, lda, ipiv, lwork );
+}
+
+void sytri2_work_size(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    int64_t const* ipiv,
+    int64_t* lwork );
+
+// hetri2_work_size alias to sytri2_work_size
+inline void hetri2_work_size(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    int64_t const* ipiv,
+    int64_t* lwork )
+{
+    sytri2_work_size( uplo, n, A, lda, ipiv, lwork );
+}
+
+void sytri2_work_size(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t const* ipiv,
+    int64_t* lwork );
+
+void sytri2_work_size(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t const* ipiv,
+    int64_t* lwork );
+
+int64_t sytri2(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    int64_t const* ipiv,
+    float* work, int64_t lwork );
+
+// hetri2 alias to sytri2
+inline int64_t hetri2(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    int64_t const* ipiv,
+    float* work, int64_t lwork )
+{
+    return sytri2( uplo, n, A, lda, ipiv, work, lwork );
+}
+
+int64_t sytri2(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    int64_t const* ipiv,
+    double* work, int64_t lwork );
+
+// hetri2 alias to sytri2
+inline int64_t hetri2(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    int64_t const* ipiv,
+    double* work, int64_t lwork )
+{
+    return sytri2( uplo, n, A, lda, ipiv, work, lwork );
+}
+
+int64_t sytri2(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t const* ipiv,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t sytri2(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t const* ipiv,
+    std::complex<double>* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 // sytri_rk wraps sytri_3
 int64_t sytri_rk(
@@ -8938,6 +15888,106 @@ int64_t sytri_rk(
     std::complex<double> const* E,
     int64_t const* ipiv );
 
+void sytri_rk_work_size(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float const* E,
+    int64_t const* ipiv,
+    int64_t* lwork );
+
+// hetri_rk_work_size alias to sytri_rk_work_size
+inline void hetri_rk_work_size(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float const* E,
+    int64_t const* ipiv,
+    int64_t* lwork )
+{
+    sytri_rk_work_size( uplo, n, A, lda, E, ipiv, lwork );
+}
+
+void sytri_rk_work_size(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double const* E,
+    int64_t const* ipiv,
+    int64_t* lwork );
+
+// hetri_rk_work_size alias to sytri_rk_work_size
+inline void hetri_rk_work_size(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double const* E,
+    int64_t const* ipiv,
+    int64_t* lwork )
+{
+    sytri_rk_work_size( uplo, n, A, lda, E, ipiv, lwork );
+}
+
+void sytri_rk_work_size(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* E,
+    int64_t const* ipiv,
+    int64_t* lwork );
+
+void sytri_rk_work_size(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* E,
+    int64_t const* ipiv,
+    int64_t* lwork );
+
+int64_t sytri_rk(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float const* E,
+    int64_t const* ipiv,
+    float* work, int64_t lwork );
+
+// hetri_rk alias to sytri_rk
+inline int64_t hetri_rk(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float const* E,
+    int64_t const* ipiv,
+    float* work, int64_t lwork )
+{
+    return sytri_rk( uplo, n, A, lda, E, ipiv, work, lwork );
+}
+
+int64_t sytri_rk(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double const* E,
+    int64_t const* ipiv,
+    double* work, int64_t lwork );
+
+// hetri_rk alias to sytri_rk
+inline int64_t hetri_rk(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double const* E,
+    int64_t const* ipiv,
+    double* work, int64_t lwork )
+{
+    return sytri_rk( uplo, n, A, lda, E, ipiv, work, lwork );
+}
+
+int64_t sytri_rk(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* E,
+    int64_t const* ipiv,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t sytri_rk(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* E,
+    int64_t const* ipiv,
+    std::complex<double>* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t sytrs(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
@@ -9419,40 +16469,132 @@ int64_t tgsja(
     float* Q, int64_t ldq,
     int64_t* ncycle );
 
-int64_t tgsja(
-    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n, int64_t k, int64_t l,
-    double* A, int64_t lda,
-    double* B, int64_t ldb, double tola, double tolb,
-    double* alpha,
-    double* beta,
-    double* U, int64_t ldu,
-    double* V, int64_t ldv,
-    double* Q, int64_t ldq,
-    int64_t* ncycle );
+int64_t tgsja(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n, int64_t k, int64_t l,
+    double* A, int64_t lda,
+    double* B, int64_t ldb, double tola, double tolb,
+    double* alpha,
+    double* beta,
+    double* U, int64_t ldu,
+    double* V, int64_t ldv,
+    double* Q, int64_t ldq,
+    int64_t* ncycle );
+
+int64_t tgsja(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n, int64_t k, int64_t l,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb, float tola, float tolb,
+    float* alpha,
+    float* beta,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* V, int64_t ldv,
+    std::complex<float>* Q, int64_t ldq,
+    int64_t* ncycle );
+
+int64_t tgsja(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n, int64_t k, int64_t l,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb, double tola, double tolb,
+    double* alpha,
+    double* beta,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* V, int64_t ldv,
+    std::complex<double>* Q, int64_t ldq,
+    int64_t* ncycle );
+
+// -----------------------------------------------------------------------------
+int64_t tgsyl(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    float const* B, int64_t ldb,
+    float* C, int64_t ldc,
+    float const* D, int64_t ldd,
+    float const* E, int64_t lde,
+    float* F, int64_t ldf,
+    float* dif,
+    float* scale );
+
+int64_t tgsyl(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    double const* B, int64_t ldb,
+    double* C, int64_t ldc,
+    double const* D, int64_t ldd,
+    double const* E, int64_t lde,
+    double* F, int64_t ldf,
+    double* dif,
+    double* scale );
+
+int64_t tgsyl(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* C, int64_t ldc,
+    std::complex<float> const* D, int64_t ldd,
+    std::complex<float> const* E, int64_t lde,
+    std::complex<float>* F, int64_t ldf,
+    float* dif,
+    float* scale );
+
+int64_t tgsyl(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* C, int64_t ldc,
+    std::complex<double> const* D, int64_t ldd,
+    std::complex<double> const* E, int64_t lde,
+    std::complex<double>* F, int64_t ldf,
+    double* dif,
+    double* scale );
+
+void tgsyl_work_size(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    float const* B, int64_t ldb,
+    float* C, int64_t ldc,
+    float const* D, int64_t ldd,
+    float const* E, int64_t lde,
+    float* F, int64_t ldf,
+    float* dif,
+    float* scale,
+    int64_t* lwork, int64_t* liwork );
+
+void tgsyl_work_size(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    double const* B, int64_t ldb,
+    double* C, int64_t ldc,
+    double const* D, int64_t ldd,
+    double const* E, int64_t lde,
+    double* F, int64_t ldf,
+    double* dif,
+    double* scale,
+    int64_t* lwork, int64_t* liwork );
 
-int64_t tgsja(
-    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n, int64_t k, int64_t l,
-    std::complex<float>* A, int64_t lda,
-    std::complex<float>* B, int64_t ldb, float tola, float tolb,
-    float* alpha,
-    float* beta,
-    std::complex<float>* U, int64_t ldu,
-    std::complex<float>* V, int64_t ldv,
-    std::complex<float>* Q, int64_t ldq,
-    int64_t* ncycle );
+void tgsyl_work_size(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* C, int64_t ldc,
+    std::complex<float> const* D, int64_t ldd,
+    std::complex<float> const* E, int64_t lde,
+    std::complex<float>* F, int64_t ldf,
+    float* dif,
+    float* scale,
+    int64_t* lwork, int64_t* liwork );
 
-int64_t tgsja(
-    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n, int64_t k, int64_t l,
-    std::complex<double>* A, int64_t lda,
-    std::complex<double>* B, int64_t ldb, double tola, double tolb,
-    double* alpha,
-    double* beta,
-    std::complex<double>* U, int64_t ldu,
-    std::complex<double>* V, int64_t ldv,
-    std::complex<double>* Q, int64_t ldq,
-    int64_t* ncycle );
+void tgsyl_work_size(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* C, int64_t ldc,
+    std::complex<double> const* D, int64_t ldd,
+    std::complex<double> const* E, int64_t lde,
+    std::complex<double>* F, int64_t ldf,
+    double* dif,
+    double* scale,
+    int64_t* lwork, int64_t* liwork );
 
-// -----------------------------------------------------------------------------
 int64_t tgsyl(
     lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
     float const* A, int64_t lda,
@@ -9462,7 +16604,9 @@ int64_t tgsyl(
     float const* E, int64_t lde,
     float* F, int64_t ldf,
     float* dif,
-    float* scale );
+    float* scale,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
 
 int64_t tgsyl(
     lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
@@ -9473,7 +16617,9 @@ int64_t tgsyl(
     double const* E, int64_t lde,
     double* F, int64_t ldf,
     double* dif,
-    double* scale );
+    double* scale,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
 
 int64_t tgsyl(
     lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
@@ -9484,7 +16630,9 @@ int64_t tgsyl(
     std::complex<float> const* E, int64_t lde,
     std::complex<float>* F, int64_t ldf,
     float* dif,
-    float* scale );
+    float* scale,
+    std::complex<float>* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
 
 int64_t tgsyl(
     lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
@@ -9495,7 +16643,9 @@ int64_t tgsyl(
     std::complex<double> const* E, int64_t lde,
     std::complex<double>* F, int64_t ldf,
     double* dif,
-    double* scale );
+    double* scale,
+    std::complex<double>* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork );
 
 // -----------------------------------------------------------------------------
 int64_t tpcon(
@@ -9917,6 +17067,80 @@ int64_t trevc3(
     std::complex<double>* VR, int64_t ldvr,
     int64_t mm, int64_t* m );
 
+void trevc3_work_size(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool* select, int64_t n,
+    float const* T, int64_t ldt,
+    float* VL, int64_t ldvl,
+    float* VR, int64_t ldvr, int64_t mm,
+    int64_t* nfound,
+    int64_t* lwork );
+
+void trevc3_work_size(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool* select, int64_t n,
+    double const* T, int64_t ldt,
+    double* VL, int64_t ldvl,
+    double* VR, int64_t ldvr, int64_t mm,
+    int64_t* nfound,
+    int64_t* lwork );
+
+void trevc3_work_size(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool const* select, int64_t n,
+    std::complex<float>* T, int64_t ldt,
+    std::complex<float>* VL, int64_t ldvl,
+    std::complex<float>* VR, int64_t ldvr, int64_t mm,
+    int64_t* nfound,
+    int64_t* lwork, int64_t* lrwork );
+
+void trevc3_work_size(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool const* select, int64_t n,
+    std::complex<double>* T, int64_t ldt,
+    std::complex<double>* VL, int64_t ldvl,
+    std::complex<double>* VR, int64_t ldvr, int64_t mm,
+    int64_t* nfound,
+    int64_t* lwork, int64_t* lrwork );
+
+int64_t trevc3(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool* select, int64_t n,
+    float const* T, int64_t ldt,
+    float* VL, int64_t ldvl,
+    float* VR, int64_t ldvr, int64_t mm,
+    int64_t* nfound,
+    float* work, int64_t lwork );
+
+int64_t trevc3(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool* select, int64_t n,
+    double const* T, int64_t ldt,
+    double* VL, int64_t ldvl,
+    double* VR, int64_t ldvr, int64_t mm,
+    int64_t* nfound,
+    double* work, int64_t lwork );
+
+int64_t trevc3(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool const* select, int64_t n,
+    std::complex<float>* T, int64_t ldt,
+    std::complex<float>* VL, int64_t ldvl,
+    std::complex<float>* VR, int64_t ldvr, int64_t mm,
+    int64_t* nfound,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork );
+
+int64_t trevc3(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool const* select, int64_t n,
+    std::complex<double>* T, int64_t ldt,
+    std::complex<double>* VL, int64_t ldvl,
+    std::complex<double>* VR, int64_t ldvr, int64_t mm,
+    int64_t* nfound,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork );
+
 // -----------------------------------------------------------------------------
 int64_t trexc(
     lapack::Job compq, int64_t n,
@@ -10096,6 +17320,56 @@ int64_t trttp(
     std::complex<double> const* A, int64_t lda,
     std::complex<double>* AP );
 
+// -----------------------------------------------------------------------------
+int64_t tsmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    int64_t mb,
+    float const* A, int64_t lda,
+    float const* T, int64_t tsize,
+    float* C, int64_t ldc );
+
+int64_t tsmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    int64_t mb,
+    double const* A, int64_t lda,
+    double const* T, int64_t tsize,
+    double* C, int64_t ldc );
+
+int64_t tsmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    int64_t mb,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* T, int64_t tsize,
+    std::complex<float>* C, int64_t ldc );
+
+int64_t tsmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    int64_t mb,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* T, int64_t tsize,
+    std::complex<double>* C, int64_t ldc );
+
+// -----------------------------------------------------------------------------
+int64_t tsqr(
+    int64_t m, int64_t n, int64_t mb,
+    float* A, int64_t lda,
+    float* T, int64_t tsize );
+
+int64_t tsqr(
+    int64_t m, int64_t n, int64_t mb,
+    double* A, int64_t lda,
+    double* T, int64_t tsize );
+
+int64_t tsqr(
+    int64_t m, int64_t n, int64_t mb,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* T, int64_t tsize );
+
+int64_t tsqr(
+    int64_t m, int64_t n, int64_t mb,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* T, int64_t tsize );
+
 // -----------------------------------------------------------------------------
 int64_t tzrzf(
     int64_t m, int64_t n,
@@ -10117,49 +17391,193 @@ int64_t tzrzf(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* tau );
 
+void tzrzf_work_size(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau,
+    int64_t* lwork );
+
+void tzrzf_work_size(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau,
+    int64_t* lwork );
+
+void tzrzf_work_size(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    int64_t* lwork );
+
+void tzrzf_work_size(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    int64_t* lwork );
+
+int64_t tzrzf(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau,
+    float* work, int64_t lwork );
+
+int64_t tzrzf(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau,
+    double* work, int64_t lwork );
+
+int64_t tzrzf(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t tzrzf(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    std::complex<double>* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t ungbr(
     lapack::Vect vect, int64_t m, int64_t n, int64_t k,
     std::complex<float>* A, int64_t lda,
     std::complex<float> const* tau );
 
-int64_t ungbr(
-    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+int64_t ungbr(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* tau );
+
+void ungbr_work_size(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* tau,
+    int64_t* lwork );
+
+void ungbr_work_size(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* tau,
+    int64_t* lwork );
+
+int64_t ungbr(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t ungbr(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* work, int64_t lwork );
+
+// -----------------------------------------------------------------------------
+int64_t unghr(
+    int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* tau );
+
+int64_t unghr(
+    int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* tau );
+
+void unghr_work_size(
+    int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* tau,
+    int64_t* lwork );
+
+void unghr_work_size(
+    int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* tau,
+    int64_t* lwork );
+
+int64_t unghr(
+    int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t unghr(
+    int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* work, int64_t lwork );
+
+// -----------------------------------------------------------------------------
+int64_t unglq(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* tau );
+
+int64_t unglq(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* tau );
+
+void unglq_work_size(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* tau,
+    int64_t* lwork );
+
+void unglq_work_size(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* tau,
+    int64_t* lwork );
+
+int64_t unglq(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t unglq(
+    int64_t m, int64_t n, int64_t k,
     std::complex<double>* A, int64_t lda,
-    std::complex<double> const* tau );
+    std::complex<double> const* tau,
+    std::complex<double>* work, int64_t lwork );
 
 // -----------------------------------------------------------------------------
-int64_t unghr(
-    int64_t n, int64_t ilo, int64_t ihi,
+int64_t ungql(
+    int64_t m, int64_t n, int64_t k,
     std::complex<float>* A, int64_t lda,
     std::complex<float> const* tau );
 
-int64_t unghr(
-    int64_t n, int64_t ilo, int64_t ihi,
+int64_t ungql(
+    int64_t m, int64_t n, int64_t k,
     std::complex<double>* A, int64_t lda,
     std::complex<double> const* tau );
 
-// -----------------------------------------------------------------------------
-int64_t unglq(
+void ungql_work_size(
     int64_t m, int64_t n, int64_t k,
     std::complex<float>* A, int64_t lda,
-    std::complex<float> const* tau );
+    std::complex<float> const* tau,
+    int64_t* lwork );
 
-int64_t unglq(
+void ungql_work_size(
     int64_t m, int64_t n, int64_t k,
     std::complex<double>* A, int64_t lda,
-    std::complex<double> const* tau );
+    std::complex<double> const* tau,
+    int64_t* lwork );
 
-// -----------------------------------------------------------------------------
 int64_t ungql(
     int64_t m, int64_t n, int64_t k,
     std::complex<float>* A, int64_t lda,
-    std::complex<float> const* tau );
+    std::complex<float> const* tau,
+    std::complex<float>* work, int64_t lwork );
 
 int64_t ungql(
     int64_t m, int64_t n, int64_t k,
     std::complex<double>* A, int64_t lda,
-    std::complex<double> const* tau );
+    std::complex<double> const* tau,
+    std::complex<double>* work, int64_t lwork );
 
 // -----------------------------------------------------------------------------
 int64_t ungqr(
@@ -10172,6 +17590,30 @@ int64_t ungqr(
     std::complex<double>* A, int64_t lda,
     std::complex<double> const* tau );
 
+void ungqr_work_size(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* tau,
+    int64_t* lwork );
+
+void ungqr_work_size(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* tau,
+    int64_t* lwork );
+
+int64_t ungqr(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t ungqr(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t ungrq(
     int64_t m, int64_t n, int64_t k,
@@ -10183,6 +17625,30 @@ int64_t ungrq(
     std::complex<double>* A, int64_t lda,
     std::complex<double> const* tau );
 
+void ungrq_work_size(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* tau,
+    int64_t* lwork );
+
+void ungrq_work_size(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* tau,
+    int64_t* lwork );
+
+int64_t ungrq(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t ungrq(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t ungtr(
     lapack::Uplo uplo, int64_t n,
@@ -10194,6 +17660,30 @@ int64_t ungtr(
     std::complex<double>* A, int64_t lda,
     std::complex<double> const* tau );
 
+void ungtr_work_size(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* tau,
+    int64_t* lwork );
+
+void ungtr_work_size(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* tau,
+    int64_t* lwork );
+
+int64_t ungtr(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t ungtr(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t unmbr(
     lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
@@ -10207,6 +17697,34 @@ int64_t unmbr(
     std::complex<double> const* tau,
     std::complex<double>* C, int64_t ldc );
 
+void unmbr_work_size(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* C, int64_t ldc,
+    int64_t* lwork );
+
+void unmbr_work_size(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* C, int64_t ldc,
+    int64_t* lwork );
+
+int64_t unmbr(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* C, int64_t ldc,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t unmbr(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* C, int64_t ldc,
+    std::complex<double>* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t unmhr(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
@@ -10220,6 +17738,34 @@ int64_t unmhr(
     std::complex<double> const* tau,
     std::complex<double>* C, int64_t ldc );
 
+void unmhr_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* C, int64_t ldc,
+    int64_t* lwork );
+
+void unmhr_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* C, int64_t ldc,
+    int64_t* lwork );
+
+int64_t unmhr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* C, int64_t ldc,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t unmhr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* C, int64_t ldc,
+    std::complex<double>* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t unmlq(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
@@ -10233,6 +17779,34 @@ int64_t unmlq(
     std::complex<double> const* tau,
     std::complex<double>* C, int64_t ldc );
 
+void unmlq_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* C, int64_t ldc,
+    int64_t* lwork );
+
+void unmlq_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* C, int64_t ldc,
+    int64_t* lwork );
+
+int64_t unmlq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* C, int64_t ldc,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t unmlq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* C, int64_t ldc,
+    std::complex<double>* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t unmql(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
@@ -10246,6 +17820,34 @@ int64_t unmql(
     std::complex<double> const* tau,
     std::complex<double>* C, int64_t ldc );
 
+void unmql_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* C, int64_t ldc,
+    int64_t* lwork );
+
+void unmql_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* C, int64_t ldc,
+    int64_t* lwork );
+
+int64_t unmql(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* C, int64_t ldc,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t unmql(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* C, int64_t ldc,
+    std::complex<double>* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t unmqr(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
@@ -10259,6 +17861,34 @@ int64_t unmqr(
     std::complex<double> const* tau,
     std::complex<double>* C, int64_t ldc );
 
+void unmqr_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* C, int64_t ldc,
+    int64_t* lwork );
+
+void unmqr_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* C, int64_t ldc,
+    int64_t* lwork );
+
+int64_t unmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* C, int64_t ldc,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t unmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* C, int64_t ldc,
+    std::complex<double>* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t unmrq(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
@@ -10272,6 +17902,34 @@ int64_t unmrq(
     std::complex<double> const* tau,
     std::complex<double>* C, int64_t ldc );
 
+void unmrq_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* C, int64_t ldc,
+    int64_t* lwork );
+
+void unmrq_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* C, int64_t ldc,
+    int64_t* lwork );
+
+int64_t unmrq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* C, int64_t ldc,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t unmrq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* C, int64_t ldc,
+    std::complex<double>* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t unmrz(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
@@ -10285,6 +17943,34 @@ int64_t unmrz(
     std::complex<double> const* tau,
     std::complex<double>* C, int64_t ldc );
 
+void unmrz_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* C, int64_t ldc,
+    int64_t* lwork );
+
+void unmrz_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* C, int64_t ldc,
+    int64_t* lwork );
+
+int64_t unmrz(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* C, int64_t ldc,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t unmrz(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k, int64_t l,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* C, int64_t ldc,
+    std::complex<double>* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t unmtr(
     lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
@@ -10298,6 +17984,34 @@ int64_t unmtr(
     std::complex<double> const* tau,
     std::complex<double>* C, int64_t ldc );
 
+void unmtr_work_size(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* C, int64_t ldc,
+    int64_t* lwork );
+
+void unmtr_work_size(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* C, int64_t ldc,
+    int64_t* lwork );
+
+int64_t unmtr(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* tau,
+    std::complex<float>* C, int64_t ldc,
+    std::complex<float>* work, int64_t lwork );
+
+int64_t unmtr(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, int64_t m, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* tau,
+    std::complex<double>* C, int64_t ldc,
+    std::complex<double>* work, int64_t lwork );
+
 // -----------------------------------------------------------------------------
 int64_t upgtr(
     lapack::Uplo uplo, int64_t n,
@@ -7,6 +7,7 @@
 #define LAPACK_NO_CONSTRUCT_ALLOCATOR_HH
 
 #include <cstddef>  // std::size_t
+#include <cstdint>  // int64_t
 #include <limits>   // std::numeric_limits
 #include <new>      // std::bad_alloc, std::bad_array_new_length
 #include <vector>   // std::vector
@@ -18,6 +19,47 @@
 
 namespace lapack {
 
+namespace internal {
+
+// Thread-local workspace arena, enabled by lapack::WorkspaceScope;
+// see src/workspace.cc.
+void* workspace_allocate( std::size_t bytes );
+bool workspace_deallocate( void* ptr, std::size_t bytes );
+
+//------------------------------------------------------------------------------
+// RAII guard that lends a caller-owned buffer to NoConstructAllocator on
+// this thread. While alive, workspace is bump-allocated from the buffer
+// before trying the WorkspaceScope arena or the heap. Lends may nest;
+// only the innermost is used. peak() is the most workspace, in bytes,
+// that was live at once, counting requests that did not fit as live
+// until the lend ends, so the owner can grow its buffer to make later
+// calls allocation-free.
+class WorkspaceLend
+{
+public:
+    WorkspaceLend( void* data, std::size_t bytes );
+    ~WorkspaceLend();
+
+    WorkspaceLend( WorkspaceLend const& ) = delete;
+    WorkspaceLend& operator = ( WorkspaceLend const& ) = delete;
+
+    std::size_t peak() const { return peak_; }
+
+    void* allocate( std::size_t bytes );
+    bool deallocate( void* ptr, std::size_t bytes );
+
+private:
+    char* begin_;
+    char* end_;
+    char* top_;
+    std::size_t demand_;
+    std::size_t peak_;
+    int64_t live_;
+    WorkspaceLend* prev_;
+};
+
+}  // namespace internal
+
 // No-construct allocator type which allocates / deallocates.
 template <typename T>
 struct NoConstructAllocator
@@ -42,7 +84,11 @@ struct NoConstructAllocator
         if (n > std::numeric_limits<std::size_t>::max() / sizeof(T))
             throw std::bad_array_new_length();
 
-        void* memPtr = nullptr;
+        // Use the lent buffer or the thread's workspace arena, if active.
+        void* memPtr = internal::workspace_allocate( n*sizeof(T) );
+        if (memPtr != nullptr)
+            return static_cast<T*>(memPtr);
+
         #if defined( _WIN32 ) || defined( _WIN64 )
             memPtr = _aligned_malloc( n*sizeof(T), 64 );
             if (memPtr != nullptr) {
@@ -62,6 +108,9 @@ struct NoConstructAllocator
 
     void deallocate(T* p, std::size_t n) noexcept
     {
+        if (internal::workspace_deallocate( p, n*sizeof(T) ))
+            return;
+
         #if defined( _WIN32 ) || defined( _WIN64 )
             _aligned_free( p );
         #else
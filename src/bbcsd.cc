@@ -37,71 +37,22 @@ int64_t bbcsd(
     float* B22D,
     float* B22E )
 {
-    char jobu1_ = to_char_csd( jobu1 );
-    char jobu2_ = to_char_csd( jobu2 );
-    char jobv1t_ = to_char_csd( jobv1t );
-    char jobv2t_ = to_char_csd( jobv2t );
-    char trans_ = to_char( trans );
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int p_ = to_lapack_int( p );
-    lapack_int q_ = to_lapack_int( q );
-    lapack_int ldu1_ = to_lapack_int( ldu1 );
-    lapack_int ldu2_ = to_lapack_int( ldu2 );
-    lapack_int ldv1t_ = to_lapack_int( ldv1t );
-    lapack_int ldv2t_ = to_lapack_int( ldv2t );
-    lapack_int info_ = 0;
-
     // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sbbcsd(
-        &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
-        theta,
-        phi,
-        U1, &ldu1_,
-        U2, &ldu2_,
-        V1T, &ldv1t_,
-        V2T, &ldv2t_,
-        B11D,
-        B11E,
-        B12D,
-        B12E,
-        B21D,
-        B21E,
-        B22D,
+    int64_t lwork;
+    bbcsd_work_size(
+        jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, theta, phi, U1, ldu1, U2,
+        ldu2, V1T, ldv1t, V2T, ldv2t, B11D, B11E, B12D, B12E, B21D, B21E, B22D,
         B22E,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+        &lwork );
 
     // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    lapack::vector< float > work( lwork );
 
-    LAPACK_sbbcsd(
-        &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
-        theta,
-        phi,
-        U1, &ldu1_,
-        U2, &ldu2_,
-        V1T, &ldv1t_,
-        V2T, &ldv2t_,
-        B11D,
-        B11E,
-        B12D,
-        B12E,
-        B21D,
-        B21E,
-        B22D,
+    return bbcsd(
+        jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, theta, phi, U1, ldu1, U2,
+        ldu2, V1T, ldv1t, V2T, ldv2t, B11D, B11E, B12D, B12E, B21D, B21E, B22D,
         B22E,
-        &work[0], &lwork_, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+        &work[0], lwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -123,71 +74,22 @@ int64_t bbcsd(
     double* B22D,
     double* B22E )
 {
-    char jobu1_ = to_char_csd( jobu1 );
-    char jobu2_ = to_char_csd( jobu2 );
-    char jobv1t_ = to_char_csd( jobv1t );
-    char jobv2t_ = to_char_csd( jobv2t );
-    char trans_ = to_char( trans );
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int p_ = to_lapack_int( p );
-    lapack_int q_ = to_lapack_int( q );
-    lapack_int ldu1_ = to_lapack_int( ldu1 );
-    lapack_int ldu2_ = to_lapack_int( ldu2 );
-    lapack_int ldv1t_ = to_lapack_int( ldv1t );
-    lapack_int ldv2t_ = to_lapack_int( ldv2t );
-    lapack_int info_ = 0;
-
     // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dbbcsd(
-        &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
-        theta,
-        phi,
-        U1, &ldu1_,
-        U2, &ldu2_,
-        V1T, &ldv1t_,
-        V2T, &ldv2t_,
-        B11D,
-        B11E,
-        B12D,
-        B12E,
-        B21D,
-        B21E,
-        B22D,
+    int64_t lwork;
+    bbcsd_work_size(
+        jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, theta, phi, U1, ldu1, U2,
+        ldu2, V1T, ldv1t, V2T, ldv2t, B11D, B11E, B12D, B12E, B21D, B21E, B22D,
         B22E,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+        &lwork );
 
     // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    lapack::vector< double > work( lwork );
 
-    LAPACK_dbbcsd(
-        &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
-        theta,
-        phi,
-        U1, &ldu1_,
-        U2, &ldu2_,
-        V1T, &ldv1t_,
-        V2T, &ldv2t_,
-        B11D,
-        B11E,
-        B12D,
-        B12E,
-        B21D,
-        B21E,
-        B22D,
+    return bbcsd(
+        jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, theta, phi, U1, ldu1, U2,
+        ldu2, V1T, ldv1t, V2T, ldv2t, B11D, B11E, B12D, B12E, B21D, B21E, B22D,
         B22E,
-        &work[0], &lwork_, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+        &work[0], lwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -209,71 +111,22 @@ int64_t bbcsd(
     float* B22D,
     float* B22E )
 {
-    char jobu1_ = to_char_csd( jobu1 );
-    char jobu2_ = to_char_csd( jobu2 );
-    char jobv1t_ = to_char_csd( jobv1t );
-    char jobv2t_ = to_char_csd( jobv2t );
-    char trans_ = to_char( trans );
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int p_ = to_lapack_int( p );
-    lapack_int q_ = to_lapack_int( q );
-    lapack_int ldu1_ = to_lapack_int( ldu1 );
-    lapack_int ldu2_ = to_lapack_int( ldu2 );
-    lapack_int ldv1t_ = to_lapack_int( ldv1t );
-    lapack_int ldv2t_ = to_lapack_int( ldv2t );
-    lapack_int info_ = 0;
-
     // query for workspace size
-    float qry_rwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cbbcsd(
-        &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
-        theta,
-        phi,
-        (lapack_complex_float*) U1, &ldu1_,
-        (lapack_complex_float*) U2, &ldu2_,
-        (lapack_complex_float*) V1T, &ldv1t_,
-        (lapack_complex_float*) V2T, &ldv2t_,
-        B11D,
-        B11E,
-        B12D,
-        B12E,
-        B21D,
-        B21E,
-        B22D,
+    int64_t lrwork;
+    bbcsd_work_size(
+        jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, theta, phi, U1, ldu1, U2,
+        ldu2, V1T, ldv1t, V2T, ldv2t, B11D, B11E, B12D, B12E, B21D, B21E, B22D,
         B22E,
-        qry_rwork, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lrwork_ = real(qry_rwork[0]);
+        &lrwork );
 
     // allocate workspace
-    lapack::vector< float > rwork( lrwork_ );
+    lapack::vector< float > rwork( lrwork );
 
-    LAPACK_cbbcsd(
-        &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
-        theta,
-        phi,
-        (lapack_complex_float*) U1, &ldu1_,
-        (lapack_complex_float*) U2, &ldu2_,
-        (lapack_complex_float*) V1T, &ldv1t_,
-        (lapack_complex_float*) V2T, &ldv2t_,
-        B11D,
-        B11E,
-        B12D,
-        B12E,
-        B21D,
-        B21E,
-        B22D,
+    return bbcsd(
+        jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, theta, phi, U1, ldu1, U2,
+        ldu2, V1T, ldv1t, V2T, ldv2t, B11D, B11E, B12D, B12E, B21D, B21E, B22D,
         B22E,
-        &rwork[0], &lrwork_, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+        &rwork[0], lrwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -480,6 +333,50 @@ int64_t bbcsd(
     double* B22D,
     double* B22E )
 {
+    // query for workspace size
+    int64_t lrwork;
+    bbcsd_work_size(
+        jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, theta, phi, U1, ldu1, U2,
+        ldu2, V1T, ldv1t, V2T, ldv2t, B11D, B11E, B12D, B12E, B21D, B21E, B22D,
+        B22E,
+        &lrwork );
+
+    // allocate workspace
+    lapack::vector< double > rwork( lrwork );
+
+    return bbcsd(
+        jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, theta, phi, U1, ldu1, U2,
+        ldu2, V1T, ldv1t, V2T, ldv2t, B11D, B11E, B12D, B12E, B21D, B21E, B22D,
+        B22E,
+        &rwork[0], lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup bbcsd
+void bbcsd_work_size(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    float* theta,
+    float* phi,
+    float* U1, int64_t ldu1,
+    float* U2, int64_t ldu2,
+    float* V1T, int64_t ldv1t,
+    float* V2T, int64_t ldv2t,
+    float* B11D,
+    float* B11E,
+    float* B12D,
+    float* B12E,
+    float* B21D,
+    float* B21E,
+    float* B22D,
+    float* B22E,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "sbbcsd", jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, ldu1, ldu2,
+        ldv1t, ldv2t );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     char jobu1_ = to_char_csd( jobu1 );
     char jobu2_ = to_char_csd( jobu2 );
     char jobv1t_ = to_char_csd( jobv1t );
@@ -494,17 +391,16 @@ int64_t bbcsd(
     lapack_int ldv2t_ = to_lapack_int( ldv2t );
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_rwork[1];
+    float qry_work[1];
     lapack_int ineg_one = -1;
-    LAPACK_zbbcsd(
+    LAPACK_sbbcsd(
         &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
         theta,
         phi,
-        (lapack_complex_double*) U1, &ldu1_,
-        (lapack_complex_double*) U2, &ldu2_,
-        (lapack_complex_double*) V1T, &ldv1t_,
-        (lapack_complex_double*) V2T, &ldv2t_,
+        U1, &ldu1_,
+        U2, &ldu2_,
+        V1T, &ldv1t_,
+        V2T, &ldv2t_,
         B11D,
         B11E,
         B12D,
@@ -513,15 +409,460 @@ int64_t bbcsd(
         B21E,
         B22D,
         B22E,
-        qry_rwork, &ineg_one, &info_
+        qry_work, &ineg_one, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lrwork_ = real(qry_rwork[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< double > rwork( lrwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup bbcsd
+void bbcsd_work_size(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    double* theta,
+    double* phi,
+    double* U1, int64_t ldu1,
+    double* U2, int64_t ldu2,
+    double* V1T, int64_t ldv1t,
+    double* V2T, int64_t ldv2t,
+    double* B11D,
+    double* B11E,
+    double* B12D,
+    double* B12E,
+    double* B21D,
+    double* B21E,
+    double* B22D,
+    double* B22E,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "dbbcsd", jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, ldu1, ldu2,
+        ldv1t, ldv2t );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    char jobu1_ = to_char_csd( jobu1 );
+    char jobu2_ = to_char_csd( jobu2 );
+    char jobv1t_ = to_char_csd( jobv1t );
+    char jobv2t_ = to_char_csd( jobv2t );
+    char trans_ = to_char( trans );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int q_ = to_lapack_int( q );
+    lapack_int ldu1_ = to_lapack_int( ldu1 );
+    lapack_int ldu2_ = to_lapack_int( ldu2 );
+    lapack_int ldv1t_ = to_lapack_int( ldv1t );
+    lapack_int ldv2t_ = to_lapack_int( ldv2t );
+    lapack_int info_ = 0;
+
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dbbcsd(
+        &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
+        theta,
+        phi,
+        U1, &ldu1_,
+        U2, &ldu2_,
+        V1T, &ldv1t_,
+        V2T, &ldv2t_,
+        B11D,
+        B11E,
+        B12D,
+        B12E,
+        B21D,
+        B21E,
+        B22D,
+        B22E,
+        qry_work, &ineg_one, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup bbcsd
+void bbcsd_work_size(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    float* theta,
+    float* phi,
+    std::complex<float>* U1, int64_t ldu1,
+    std::complex<float>* U2, int64_t ldu2,
+    std::complex<float>* V1T, int64_t ldv1t,
+    std::complex<float>* V2T, int64_t ldv2t,
+    float* B11D,
+    float* B11E,
+    float* B12D,
+    float* B12E,
+    float* B21D,
+    float* B21E,
+    float* B22D,
+    float* B22E,
+    int64_t* lrwork )
+{
+    auto key = internal::work_size_key(
+        "cbbcsd", jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, ldu1, ldu2,
+        ldv1t, ldv2t );
+    if (internal::work_size_cache_find( key, lrwork ))
+        return;
+
+    char jobu1_ = to_char_csd( jobu1 );
+    char jobu2_ = to_char_csd( jobu2 );
+    char jobv1t_ = to_char_csd( jobv1t );
+    char jobv2t_ = to_char_csd( jobv2t );
+    char trans_ = to_char( trans );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int q_ = to_lapack_int( q );
+    lapack_int ldu1_ = to_lapack_int( ldu1 );
+    lapack_int ldu2_ = to_lapack_int( ldu2 );
+    lapack_int ldv1t_ = to_lapack_int( ldv1t );
+    lapack_int ldv2t_ = to_lapack_int( ldv2t );
+    lapack_int info_ = 0;
+
+    float qry_rwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_cbbcsd(
+        &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
+        theta,
+        phi,
+        (lapack_complex_float*) U1, &ldu1_,
+        (lapack_complex_float*) U2, &ldu2_,
+        (lapack_complex_float*) V1T, &ldv1t_,
+        (lapack_complex_float*) V2T, &ldv2t_,
+        B11D,
+        B11E,
+        B12D,
+        B12E,
+        B21D,
+        B21E,
+        B22D,
+        B22E,
+        qry_rwork, &ineg_one, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lrwork = real(qry_rwork[0]);
+    internal::work_size_cache_insert( key, *lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::bbcsd with caller-provided workspace.
+/// Returns the array lengths that the workspace overload of `bbcsd`
+/// requires, so the workspace can be allocated once, outside a loop.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// Other arguments are the same as for lapack::bbcsd.
+/// Arrays are used only to select the precision and are not referenced.
+///
+/// @param[out] lrwork
+///     The optimal length of the array rwork.
+///
+/// @ingroup bbcsd
+void bbcsd_work_size(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    double* theta,
+    double* phi,
+    std::complex<double>* U1, int64_t ldu1,
+    std::complex<double>* U2, int64_t ldu2,
+    std::complex<double>* V1T, int64_t ldv1t,
+    std::complex<double>* V2T, int64_t ldv2t,
+    double* B11D,
+    double* B11E,
+    double* B12D,
+    double* B12E,
+    double* B21D,
+    double* B21E,
+    double* B22D,
+    double* B22E,
+    int64_t* lrwork )
+{
+    auto key = internal::work_size_key(
+        "zbbcsd", jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, ldu1, ldu2,
+        ldv1t, ldv2t );
+    if (internal::work_size_cache_find( key, lrwork ))
+        return;
+
+    char jobu1_ = to_char_csd( jobu1 );
+    char jobu2_ = to_char_csd( jobu2 );
+    char jobv1t_ = to_char_csd( jobv1t );
+    char jobv2t_ = to_char_csd( jobv2t );
+    char trans_ = to_char( trans );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int q_ = to_lapack_int( q );
+    lapack_int ldu1_ = to_lapack_int( ldu1 );
+    lapack_int ldu2_ = to_lapack_int( ldu2 );
+    lapack_int ldv1t_ = to_lapack_int( ldv1t );
+    lapack_int ldv2t_ = to_lapack_int( ldv2t );
+    lapack_int info_ = 0;
+
+    double qry_rwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_zbbcsd(
+        &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
+        theta,
+        phi,
+        (lapack_complex_double*) U1, &ldu1_,
+        (lapack_complex_double*) U2, &ldu2_,
+        (lapack_complex_double*) V1T, &ldv1t_,
+        (lapack_complex_double*) V2T, &ldv2t_,
+        B11D,
+        B11E,
+        B12D,
+        B12E,
+        B21D,
+        B21E,
+        B22D,
+        B22E,
+        qry_rwork, &ineg_one, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lrwork = real(qry_rwork[0]);
+    internal::work_size_cache_insert( key, *lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup bbcsd
+int64_t bbcsd(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    float* theta,
+    float* phi,
+    float* U1, int64_t ldu1,
+    float* U2, int64_t ldu2,
+    float* V1T, int64_t ldv1t,
+    float* V2T, int64_t ldv2t,
+    float* B11D,
+    float* B11E,
+    float* B12D,
+    float* B12E,
+    float* B21D,
+    float* B21E,
+    float* B22D,
+    float* B22E,
+    float* work, int64_t lwork )
+{
+    char jobu1_ = to_char_csd( jobu1 );
+    char jobu2_ = to_char_csd( jobu2 );
+    char jobv1t_ = to_char_csd( jobv1t );
+    char jobv2t_ = to_char_csd( jobv2t );
+    char trans_ = to_char( trans );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int q_ = to_lapack_int( q );
+    lapack_int ldu1_ = to_lapack_int( ldu1 );
+    lapack_int ldu2_ = to_lapack_int( ldu2 );
+    lapack_int ldv1t_ = to_lapack_int( ldv1t );
+    lapack_int ldv2t_ = to_lapack_int( ldv2t );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "bbcsd", float, m, 0, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+
+    LAPACK_sbbcsd(
+        &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
+        theta,
+        phi,
+        U1, &ldu1_,
+        U2, &ldu2_,
+        V1T, &ldv1t_,
+        V2T, &ldv2t_,
+        B11D,
+        B11E,
+        B12D,
+        B12E,
+        B21D,
+        B21E,
+        B22D,
+        B22E,
+        work, &lwork_, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup bbcsd
+int64_t bbcsd(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    double* theta,
+    double* phi,
+    double* U1, int64_t ldu1,
+    double* U2, int64_t ldu2,
+    double* V1T, int64_t ldv1t,
+    double* V2T, int64_t ldv2t,
+    double* B11D,
+    double* B11E,
+    double* B12D,
+    double* B12E,
+    double* B21D,
+    double* B21E,
+    double* B22D,
+    double* B22E,
+    double* work, int64_t lwork )
+{
+    char jobu1_ = to_char_csd( jobu1 );
+    char jobu2_ = to_char_csd( jobu2 );
+    char jobv1t_ = to_char_csd( jobv1t );
+    char jobv2t_ = to_char_csd( jobv2t );
+    char trans_ = to_char( trans );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int q_ = to_lapack_int( q );
+    lapack_int ldu1_ = to_lapack_int( ldu1 );
+    lapack_int ldu2_ = to_lapack_int( ldu2 );
+    lapack_int ldv1t_ = to_lapack_int( ldv1t );
+    lapack_int ldv2t_ = to_lapack_int( ldv2t );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "bbcsd", double, m, 0, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+
+    LAPACK_dbbcsd(
+        &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
+        theta,
+        phi,
+        U1, &ldu1_,
+        U2, &ldu2_,
+        V1T, &ldv1t_,
+        V2T, &ldv2t_,
+        B11D,
+        B11E,
+        B12D,
+        B12E,
+        B21D,
+        B21E,
+        B22D,
+        B22E,
+        work, &lwork_, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup bbcsd
+int64_t bbcsd(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    float* theta,
+    float* phi,
+    std::complex<float>* U1, int64_t ldu1,
+    std::complex<float>* U2, int64_t ldu2,
+    std::complex<float>* V1T, int64_t ldv1t,
+    std::complex<float>* V2T, int64_t ldv2t,
+    float* B11D,
+    float* B11E,
+    float* B12D,
+    float* B12E,
+    float* B21D,
+    float* B21E,
+    float* B22D,
+    float* B22E,
+    float* rwork, int64_t lrwork )
+{
+    char jobu1_ = to_char_csd( jobu1 );
+    char jobu2_ = to_char_csd( jobu2 );
+    char jobv1t_ = to_char_csd( jobv1t );
+    char jobv2t_ = to_char_csd( jobv2t );
+    char trans_ = to_char( trans );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int q_ = to_lapack_int( q );
+    lapack_int ldu1_ = to_lapack_int( ldu1 );
+    lapack_int ldu2_ = to_lapack_int( ldu2 );
+    lapack_int ldv1t_ = to_lapack_int( ldv1t );
+    lapack_int ldv2t_ = to_lapack_int( ldv2t );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "bbcsd", std::complex<float>, m, 0, 0, 0, info_ );
+    lapack_int lrwork_ = to_lapack_int( lrwork );
+
+    LAPACK_cbbcsd(
+        &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
+        theta,
+        phi,
+        (lapack_complex_float*) U1, &ldu1_,
+        (lapack_complex_float*) U2, &ldu2_,
+        (lapack_complex_float*) V1T, &ldv1t_,
+        (lapack_complex_float*) V2T, &ldv2t_,
+        B11D,
+        B11E,
+        B12D,
+        B12E,
+        B21D,
+        B21E,
+        B22D,
+        B22E,
+        rwork, &lrwork_, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::bbcsd that takes caller-provided workspace
+/// instead of querying and allocating it on each call.
+/// Use lapack::bbcsd_work_size to get the required lengths.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// Other arguments are the same as for lapack::bbcsd.
+///
+/// @param[out] rwork
+///     The vector rwork of length lrwork. Workspace.
+///
+/// @param[in] lrwork
+///     The length of the array rwork.
+///     Use the value from lapack::bbcsd_work_size for best performance.
+///
+/// @ingroup bbcsd
+int64_t bbcsd(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    double* theta,
+    double* phi,
+    std::complex<double>* U1, int64_t ldu1,
+    std::complex<double>* U2, int64_t ldu2,
+    std::complex<double>* V1T, int64_t ldv1t,
+    std::complex<double>* V2T, int64_t ldv2t,
+    double* B11D,
+    double* B11E,
+    double* B12D,
+    double* B12E,
+    double* B21D,
+    double* B21E,
+    double* B22D,
+    double* B22E,
+    double* rwork, int64_t lrwork )
+{
+    char jobu1_ = to_char_csd( jobu1 );
+    char jobu2_ = to_char_csd( jobu2 );
+    char jobv1t_ = to_char_csd( jobv1t );
+    char jobv2t_ = to_char_csd( jobv2t );
+    char trans_ = to_char( trans );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int q_ = to_lapack_int( q );
+    lapack_int ldu1_ = to_lapack_int( ldu1 );
+    lapack_int ldu2_ = to_lapack_int( ldu2 );
+    lapack_int ldv1t_ = to_lapack_int( ldv1t );
+    lapack_int ldv2t_ = to_lapack_int( ldv2t );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "bbcsd", std::complex<double>, m, 0, 0, 0, info_ );
+    lapack_int lrwork_ = to_lapack_int( lrwork );
 
     LAPACK_zbbcsd(
         &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
@@ -539,7 +880,7 @@ int64_t bbcsd(
         B21E,
         B22D,
         B22E,
-        &rwork[0], &lrwork_, &info_
+        rwork, &lrwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
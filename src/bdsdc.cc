@@ -33,6 +33,7 @@ int64_t bdsdc(
     lapack_int ldu_ = to_lapack_int( ldu );
     lapack_int ldvt_ = to_lapack_int( ldvt );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "bdsdc", float, 0, n, 0, 0, info_ );
 
     // IQ disabled for now, due to complicated dimension
     lapack_int IQ_[1];
@@ -193,6 +194,7 @@ int64_t bdsdc(
     lapack_int ldu_ = to_lapack_int( ldu );
     lapack_int ldvt_ = to_lapack_int( ldvt );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "bdsdc", double, 0, n, 0, 0, info_ );
 
     // IQ disabled for now, due to complicated dimension
     lapack_int IQ_[1];
@@ -35,6 +35,7 @@ int64_t bdsqr(
     lapack_int ldu_ = to_lapack_int( ldu );
     lapack_int ldc_ = to_lapack_int( ldc );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "bdsqr", float, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (4*n) );
@@ -73,6 +74,7 @@ int64_t bdsqr(
     lapack_int ldu_ = to_lapack_int( ldu );
     lapack_int ldc_ = to_lapack_int( ldc );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "bdsqr", double, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (4*n) );
@@ -111,6 +113,7 @@ int64_t bdsqr(
     lapack_int ldu_ = to_lapack_int( ldu );
     lapack_int ldc_ = to_lapack_int( ldc );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "bdsqr", std::complex<float>, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > rwork( (4*n) );
@@ -248,6 +251,7 @@ int64_t bdsqr(
     lapack_int ldu_ = to_lapack_int( ldu );
     lapack_int ldc_ = to_lapack_int( ldc );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "bdsqr", std::complex<double>, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > rwork( (4*n) );
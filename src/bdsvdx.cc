@@ -37,6 +37,7 @@ int64_t bdsvdx(
     lapack_int nfound_ = 0;  // out
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "bdsvdx", float, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (14*n) );
@@ -205,6 +206,7 @@ int64_t bdsvdx(
     lapack_int nfound_ = 0;  // out
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "bdsvdx", double, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (14*n) );
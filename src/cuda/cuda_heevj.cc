@@ -0,0 +1,236 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/defines.h"
+
+#if defined(LAPACK_HAVE_CUBLAS)
+
+#include "lapack/device.hh"
+#include "cuda_common.hh"
+
+//==============================================================================
+namespace blas {
+namespace internal {
+
+cublasFillMode_t uplo2cublas(blas::Uplo uplo);
+
+} // namespace internal
+} // namespace blas
+
+//==============================================================================
+namespace lapack {
+
+//------------------------------------------------------------------------------
+// Intermediate wrappers around cuSolver to deal with precisions.
+cusolverStatus_t cusolver_heevj_bufferSize(
+    cusolverDnHandle_t solver, cusolverEigMode_t jobz,
+    cublasFillMode_t uplo, int n, float* dA,
+    int ldda, float* dW, int* lwork, syevjInfo_t params )
+{
+    return cusolverDnSsyevj_bufferSize(
+        solver, jobz, uplo, n, dA, ldda, dW, lwork, params );
+}
+
+//----------
+cusolverStatus_t cusolver_heevj_bufferSize(
+    cusolverDnHandle_t solver, cusolverEigMode_t jobz,
+    cublasFillMode_t uplo, int n, double* dA,
+    int ldda, double* dW, int* lwork, syevjInfo_t params )
+{
+    return cusolverDnDsyevj_bufferSize(
+        solver, jobz, uplo, n, dA, ldda, dW, lwork, params );
+}
+
+//----------
+cusolverStatus_t cusolver_heevj_bufferSize(
+    cusolverDnHandle_t solver, cusolverEigMode_t jobz,
+    cublasFillMode_t uplo, int n, std::complex<float>* dA,
+    int ldda, float* dW, int* lwork, syevjInfo_t params )
+{
+    return cusolverDnCheevj_bufferSize(
+        solver, jobz, uplo, n,
+        (cuFloatComplex*) dA, ldda, dW, lwork, params );
+}
+
+//----------
+cusolverStatus_t cusolver_heevj_bufferSize(
+    cusolverDnHandle_t solver, cusolverEigMode_t jobz,
+    cublasFillMode_t uplo, int n, std::complex<double>* dA,
+    int ldda, double* dW, int* lwork, syevjInfo_t params )
+{
+    return cusolverDnZheevj_bufferSize(
+        solver, jobz, uplo, n,
+        (cuDoubleComplex*) dA, ldda, dW, lwork, params );
+}
+
+//------------------------------------------------------------------------------
+// Intermediate wrappers around cuSolver to deal with precisions.
+cusolverStatus_t cusolver_heevj(
+    cusolverDnHandle_t solver, cusolverEigMode_t jobz,
+    cublasFillMode_t uplo, int n, float* dA,
+    int ldda, float* dW, float* dev_work, int lwork, int* info,
+    syevjInfo_t params )
+{
+    return cusolverDnSsyevj(
+        solver, jobz, uplo, n, dA, ldda, dW, dev_work, lwork, info, params );
+}
+
+//----------
+cusolverStatus_t cusolver_heevj(
+    cusolverDnHandle_t solver, cusolverEigMode_t jobz,
+    cublasFillMode_t uplo, int n, double* dA,
+    int ldda, double* dW, double* dev_work, int lwork, int* info,
+    syevjInfo_t params )
+{
+    return cusolverDnDsyevj(
+        solver, jobz, uplo, n, dA, ldda, dW, dev_work, lwork, info, params );
+}
+
+//----------
+cusolverStatus_t cusolver_heevj(
+    cusolverDnHandle_t solver, cusolverEigMode_t jobz,
+    cublasFillMode_t uplo, int n, std::complex<float>* dA,
+    int ldda, float* dW, std::complex<float>* dev_work, int lwork, int* info,
+    syevjInfo_t params )
+{
+    return cusolverDnCheevj(
+        solver, jobz, uplo, n,
+        (cuFloatComplex*) dA, ldda, dW,
+        (cuFloatComplex*) dev_work, lwork, info, params );
+}
+
+//----------
+cusolverStatus_t cusolver_heevj(
+    cusolverDnHandle_t solver, cusolverEigMode_t jobz,
+    cublasFillMode_t uplo, int n, std::complex<double>* dA,
+    int ldda, double* dW, std::complex<double>* dev_work, int lwork, int* info,
+    syevjInfo_t params )
+{
+    return cusolverDnZheevj(
+        solver, jobz, uplo, n,
+        (cuDoubleComplex*) dA, ldda, dW,
+        (cuDoubleComplex*) dev_work, lwork, info, params );
+}
+
+//------------------------------------------------------------------------------
+// Wrapper around cuSolver workspace query.
+// dA, dW are only for templating scalar_t; they aren't referenced.
+template <typename scalar_t>
+void heevj_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo,
+    int64_t n, scalar_t* dA, int64_t ldda, blas::real_type<scalar_t>* dW,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue )
+{
+    auto solver = queue.solver();
+    auto jobz_ = job2eigmode_cusolver( jobz );
+    auto uplo_ = blas::internal::uplo2cublas( uplo );
+
+    // for cuda, rocm, call set_device; for oneapi, do nothing.
+    blas::internal_set_device( queue.device() );
+
+    // query for workspace size
+    int lwork;
+    blas_dev_call(
+        cusolver_heevj_bufferSize(
+            solver, jobz_, uplo_, n, dA, ldda, dW, &lwork,
+            queue.syevj_params() ));
+    *dev_work_size = lwork * sizeof(scalar_t);
+    *host_work_size = 0;
+}
+
+//------------------------------------------------------------------------------
+// Wrapper around cuSolver.
+// This is async. Once finished, the return info is in dev_info on the device.
+template <typename scalar_t>
+void heevj(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    scalar_t* dA, int64_t ldda, blas::real_type<scalar_t>* dW,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    auto solver = queue.solver();
+    auto jobz_ = job2eigmode_cusolver( jobz );
+    auto uplo_ = blas::internal::uplo2cublas( uplo );
+
+    // for cuda, rocm, call set_device; for oneapi, do nothing.
+    blas::internal_set_device( queue.device() );
+
+    // launch kernel
+    int lwork = dev_work_size / sizeof(scalar_t);
+    blas_dev_call(
+        cusolver_heevj(
+            solver, jobz_, uplo_, n, dA, ldda, dW,
+            (scalar_t*) dev_work, lwork, dev_info,
+            queue.syevj_params() ));
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void heevj_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo,
+    int64_t n, float* dA, int64_t ldda, float* dW,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void heevj_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo,
+    int64_t n, double* dA, int64_t ldda, double* dW,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void heevj_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo,
+    int64_t n, std::complex<float>* dA, int64_t ldda, float* dW,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void heevj_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo,
+    int64_t n, std::complex<double>* dA, int64_t ldda, double* dW,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+//--------------------
+template
+void heevj(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* dA, int64_t ldda, float* dW,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void heevj(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* dA, int64_t ldda, double* dW,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void heevj(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* dA, int64_t ldda, float* dW,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void heevj(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* dA, int64_t ldda, double* dW,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+} // namespace lapack
+
+#endif // LAPACK_HAVE_CUBLAS
@@ -0,0 +1,221 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/defines.h"
+
+#if defined(LAPACK_HAVE_CUBLAS)
+
+#include "lapack/device.hh"
+#include "cuda_common.hh"
+
+//==============================================================================
+namespace blas {
+namespace internal {
+
+cublasFillMode_t uplo2cublas(blas::Uplo uplo);
+
+} // namespace internal
+} // namespace blas
+
+//==============================================================================
+namespace lapack {
+
+//------------------------------------------------------------------------------
+// Intermediate wrappers around cuSolver to deal with precisions.
+cusolverStatus_t cusolver_potri_bufferSize(
+    cusolverDnHandle_t solver, cublasFillMode_t uplo, int n,
+    float* dA, int ldda, int* lwork )
+{
+    return cusolverDnSpotri_bufferSize(
+        solver, uplo, n, dA, ldda, lwork );
+}
+
+//----------
+cusolverStatus_t cusolver_potri_bufferSize(
+    cusolverDnHandle_t solver, cublasFillMode_t uplo, int n,
+    double* dA, int ldda, int* lwork )
+{
+    return cusolverDnDpotri_bufferSize(
+        solver, uplo, n, dA, ldda, lwork );
+}
+
+//----------
+cusolverStatus_t cusolver_potri_bufferSize(
+    cusolverDnHandle_t solver, cublasFillMode_t uplo, int n,
+    std::complex<float>* dA, int ldda, int* lwork )
+{
+    return cusolverDnCpotri_bufferSize(
+        solver, uplo, n,
+        (cuFloatComplex*) dA, ldda, lwork );
+}
+
+//----------
+cusolverStatus_t cusolver_potri_bufferSize(
+    cusolverDnHandle_t solver, cublasFillMode_t uplo, int n,
+    std::complex<double>* dA, int ldda, int* lwork )
+{
+    return cusolverDnZpotri_bufferSize(
+        solver, uplo, n,
+        (cuDoubleComplex*) dA, ldda, lwork );
+}
+
+//------------------------------------------------------------------------------
+// Intermediate wrappers around cuSolver to deal with precisions.
+cusolverStatus_t cusolver_potri(
+    cusolverDnHandle_t solver, cublasFillMode_t uplo, int n,
+    float* dA, int ldda, float* dev_work, int lwork, int* info )
+{
+    return cusolverDnSpotri(
+        solver, uplo, n, dA, ldda, dev_work, lwork, info );
+}
+
+//----------
+cusolverStatus_t cusolver_potri(
+    cusolverDnHandle_t solver, cublasFillMode_t uplo, int n,
+    double* dA, int ldda, double* dev_work, int lwork, int* info )
+{
+    return cusolverDnDpotri(
+        solver, uplo, n, dA, ldda, dev_work, lwork, info );
+}
+
+//----------
+cusolverStatus_t cusolver_potri(
+    cusolverDnHandle_t solver, cublasFillMode_t uplo, int n,
+    std::complex<float>* dA, int ldda,
+    std::complex<float>* dev_work, int lwork, int* info )
+{
+    return cusolverDnCpotri(
+        solver, uplo, n,
+        (cuFloatComplex*) dA, ldda,
+        (cuFloatComplex*) dev_work, lwork, info );
+}
+
+//----------
+cusolverStatus_t cusolver_potri(
+    cusolverDnHandle_t solver, cublasFillMode_t uplo, int n,
+    std::complex<double>* dA, int ldda,
+    std::complex<double>* dev_work, int lwork, int* info )
+{
+    return cusolverDnZpotri(
+        solver, uplo, n,
+        (cuDoubleComplex*) dA, ldda,
+        (cuDoubleComplex*) dev_work, lwork, info );
+}
+
+//------------------------------------------------------------------------------
+// Wrapper around cuSolver workspace query.
+// dA is only for templating scalar_t; it isn't referenced.
+template <typename scalar_t>
+void potri_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* dA, int64_t ldda,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue )
+{
+    auto solver = queue.solver();
+    auto uplo_ = blas::internal::uplo2cublas( uplo );
+
+    // for cuda, rocm, call set_device; for oneapi, do nothing.
+    blas::internal_set_device( queue.device() );
+
+    // query for workspace size
+    int lwork;
+    blas_dev_call(
+        cusolver_potri_bufferSize( solver, uplo_, n, dA, ldda, &lwork ));
+    *dev_work_size = lwork * sizeof(scalar_t);
+    *host_work_size = 0;
+}
+
+//------------------------------------------------------------------------------
+// Wrapper around cuSolver.
+// This is async. Once finished, the return info is in dev_info on the device.
+template <typename scalar_t>
+void potri(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* dA, int64_t ldda,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    auto solver = queue.solver();
+    auto uplo_ = blas::internal::uplo2cublas( uplo );
+
+    // for cuda, rocm, call set_device; for oneapi, do nothing.
+    blas::internal_set_device( queue.device() );
+
+    // launch kernel
+    int lwork = dev_work_size / sizeof(scalar_t);
+    blas_dev_call(
+        cusolver_potri(
+            solver, uplo_, n, dA, ldda,
+            (scalar_t*) dev_work, lwork, dev_info ));
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void potri_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    float* dA, int64_t ldda,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void potri_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    double* dA, int64_t ldda,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void potri_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* dA, int64_t ldda,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void potri_work_size_bytes(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* dA, int64_t ldda,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+//--------------------
+template
+void potri(
+    lapack::Uplo uplo, int64_t n,
+    float* dA, int64_t ldda,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void potri(
+    lapack::Uplo uplo, int64_t n,
+    double* dA, int64_t ldda,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void potri(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* dA, int64_t ldda,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void potri(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* dA, int64_t ldda,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+} // namespace lapack
+
+#endif // LAPACK_HAVE_CUBLAS
@@ -0,0 +1,191 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/defines.h"
+
+#if defined(LAPACK_HAVE_CUBLAS)
+
+#include "lapack/device.hh"
+#include "cuda_common.hh"
+
+//==============================================================================
+namespace blas {
+namespace internal {
+
+cublasFillMode_t uplo2cublas(blas::Uplo uplo);
+
+} // namespace internal
+} // namespace blas
+
+//==============================================================================
+namespace lapack {
+
+#if CUSOLVER_VERSION < 11000
+//------------------------------------------------------------------------------
+// Intermediate wrappers around cuSolver to deal with precisions.
+cusolverStatus_t cusolver_potrs(
+    cusolverDnHandle_t solver, cublasFillMode_t uplo, int n, int nrhs,
+    float const* dA, int ldda, float* dB, int lddb, int* info )
+{
+    return cusolverDnSpotrs(
+        solver, uplo, n, nrhs, dA, ldda, dB, lddb, info );
+}
+
+//----------
+cusolverStatus_t cusolver_potrs(
+    cusolverDnHandle_t solver, cublasFillMode_t uplo, int n, int nrhs,
+    double const* dA, int ldda, double* dB, int lddb, int* info )
+{
+    return cusolverDnDpotrs(
+        solver, uplo, n, nrhs, dA, ldda, dB, lddb, info );
+}
+
+//----------
+cusolverStatus_t cusolver_potrs(
+    cusolverDnHandle_t solver, cublasFillMode_t uplo, int n, int nrhs,
+    std::complex<float> const* dA, int ldda,
+    std::complex<float>* dB, int lddb, int* info )
+{
+    return cusolverDnCpotrs(
+        solver, uplo, n, nrhs,
+        (cuFloatComplex const*) dA, ldda,
+        (cuFloatComplex*) dB, lddb, info );
+}
+
+//----------
+cusolverStatus_t cusolver_potrs(
+    cusolverDnHandle_t solver, cublasFillMode_t uplo, int n, int nrhs,
+    std::complex<double> const* dA, int ldda,
+    std::complex<double>* dB, int lddb, int* info )
+{
+    return cusolverDnZpotrs(
+        solver, uplo, n, nrhs,
+        (cuDoubleComplex const*) dA, ldda,
+        (cuDoubleComplex*) dB, lddb, info );
+}
+#endif
+
+//------------------------------------------------------------------------------
+// Workspace query. cuSolver potrs needs no workspace.
+// dA, dB are only for templating scalar_t; they aren't referenced.
+template <typename scalar_t>
+void potrs_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t const* dA, int64_t ldda,
+    scalar_t* dB, int64_t lddb,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue )
+{
+    *dev_work_size  = 0;
+    *host_work_size = 0;
+}
+
+//------------------------------------------------------------------------------
+// Wrapper around cuSolver.
+// This is async. Once finished, the return info is in dev_info on the device.
+template <typename scalar_t>
+void potrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t const* dA, int64_t ldda,
+    scalar_t* dB, int64_t lddb,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    auto solver = queue.solver();
+    auto uplo_ = blas::internal::uplo2cublas( uplo );
+
+    // for cuda, rocm, call set_device; for oneapi, do nothing.
+    blas::internal_set_device( queue.device() );
+
+    // launch kernel
+    #if CUSOLVER_VERSION >= 11000
+        auto params = queue.solver_params();
+        blas_dev_call(
+            cusolverDnXpotrs(
+                solver, params, uplo_, n, nrhs,
+                CudaTraits<scalar_t>::datatype, dA, ldda,
+                CudaTraits<scalar_t>::datatype, dB, lddb, dev_info ));
+    #else
+        blas_dev_call(
+            cusolver_potrs(
+                solver, uplo_, n, nrhs, dA, ldda, dB, lddb, dev_info ));
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void potrs_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* dA, int64_t ldda,
+    float* dB, int64_t lddb,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void potrs_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* dA, int64_t ldda,
+    double* dB, int64_t lddb,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void potrs_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* dA, int64_t ldda,
+    std::complex<float>* dB, int64_t lddb,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void potrs_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* dA, int64_t ldda,
+    std::complex<double>* dB, int64_t lddb,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+//--------------------
+template
+void potrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* dA, int64_t ldda,
+    float* dB, int64_t lddb,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void potrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* dA, int64_t ldda,
+    double* dB, int64_t lddb,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void potrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* dA, int64_t ldda,
+    std::complex<float>* dB, int64_t lddb,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void potrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* dA, int64_t ldda,
+    std::complex<double>* dB, int64_t lddb,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+} // namespace lapack
+
+#endif // LAPACK_HAVE_CUBLAS
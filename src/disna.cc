@@ -25,6 +25,7 @@ int64_t disna(
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "disna", float, m, n, 0, 0, info_ );
 
     LAPACK_sdisna(
         &jobcond_, &m_, &n_,
@@ -47,6 +48,7 @@ int64_t disna(
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "disna", double, m, n, 0, 0, info_ );
 
     LAPACK_ddisna(
         &jobcond_, &m_, &n_,
@@ -0,0 +1,595 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "NoConstructAllocator.hh"
+
+#include <algorithm>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+using blas::real;
+
+namespace {
+
+//------------------------------------------------------------------------------
+// Runs fn with work lent to the wrappers it calls, then grows work if fn
+// needed more, so the next such call fits. Calls must not nest, as
+// nested lends of one buffer would overlap.
+template <typename Fn>
+auto with_work( std::vector< char >& work, Fn&& fn ) -> decltype( fn() )
+{
+    std::size_t peak;
+    decltype( fn() ) result;
+    {
+        internal::WorkspaceLend lend( work.data(), work.size() );
+        result = fn();
+        peak = lend.peak();
+    }
+    // Allow for the lend aligning the start of the buffer.
+    if (peak + 64 > work.size())
+        work.resize( peak + 64 );
+    return result;
+}
+
+//------------------------------------------------------------------------------
+// Presizes work for a few allocations of the given number of
+// scalars, reals, and integers.
+template <typename scalar_t>
+void reserve_work(
+    std::vector< char >& work, int64_t scalars, int64_t reals, int64_t ints )
+{
+    using real_t = blas::real_type< scalar_t >;
+    std::size_t bytes = scalars * sizeof( scalar_t )
+                      + reals * sizeof( real_t )
+                      + ints * sizeof( int64_t )
+                      + 8*64;  // rounding of each allocation, alignment
+    if (work.size() < bytes)
+        work.resize( bytes );
+}
+
+//------------------------------------------------------------------------------
+// Sets the triangle of Hermitian A opposite uplo from the uplo triangle.
+template <typename scalar_t>
+void he_fill( lapack::Uplo uplo, int64_t n, scalar_t* A, int64_t lda )
+{
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = j + 1; i < n; ++i) {
+            if (uplo == Uplo::Lower)
+                A[ j + i*lda ] = blas::conj( A[ i + j*lda ] );
+            else
+                A[ i + j*lda ] = blas::conj( A[ j + i*lda ] );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Least squares solve with QR factors of m-by-n A; see QR::solve.
+template <typename scalar_t>
+int64_t qr_solve(
+    int64_t m, int64_t n, int64_t nrhs,
+    scalar_t const* QR, int64_t ld, scalar_t const* tau,
+    scalar_t* B, int64_t ldb )
+{
+    lapack::unmqr( Side::Left, Op::ConjTrans, m, nrhs, n,
+                   QR, ld, tau, B, ldb );
+    return lapack::trtrs( Uplo::Upper, Op::NoTrans, Diag::NonUnit,
+                          n, nrhs, QR, ld, B, ldb );
+}
+
+}  // namespace
+
+//==============================================================================
+// LU
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+LU< scalar_t >::LU()
+    : n_( 0 ),
+      ld_( 1 ),
+      info_( 0 ),
+      anorm_one_( 0 ),
+      anorm_inf_( 0 ),
+      anorm_max_( 0 ),
+      anorm_fro_( 0 )
+{}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+LU< scalar_t >::LU( int64_t n, scalar_t const* A, int64_t lda )
+    : LU()
+{
+    factor( n, A, lda );
+}
+
+//------------------------------------------------------------------------------
+/// Copies A, keeping the original for refine(), and computes its norms
+/// while it is in cache, before factoring the copy.
+template <typename scalar_t>
+int64_t LU< scalar_t >::factor( int64_t n, scalar_t const* A, int64_t lda )
+{
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+
+    n_ = n;
+    ld_ = max( 1, n );
+    A_.resize( ld_ * n );
+    LU_.resize( ld_ * n );
+    ipiv_.resize( n );
+    // gecon, gerfs, getri need O(n) work; getri uses n*nb.
+    reserve_work< scalar_t >( work_, 68*n, 2*n, 2*n );
+
+    lapack::lacpy( MatrixType::General, n, n, A, lda, A_.data(), ld_ );
+    std::copy( A_.begin(), A_.end(), LU_.begin() );
+    info_ = with_work( work_, [&]() {
+        anorm_one_ = lapack::lange( Norm::One, n, n, A_.data(), ld_ );
+        anorm_inf_ = lapack::lange( Norm::Inf, n, n, A_.data(), ld_ );
+        anorm_max_ = lapack::lange( Norm::Max, n, n, A_.data(), ld_ );
+        anorm_fro_ = lapack::lange( Norm::Fro, n, n, A_.data(), ld_ );
+        return lapack::getrf( n, n, LU_.data(), ld_, ipiv_.data() );
+    } );
+    return info_;
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t LU< scalar_t >::solve(
+    int64_t nrhs, scalar_t* B, int64_t ldb, lapack::Op trans )
+{
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( ldb < max( 1, n_ ) );
+    if (info_ > 0)
+        return info_;
+
+    return with_work( work_, [&]() {
+        return lapack::getrs( trans, n_, nrhs, LU_.data(), ld_, ipiv_.data(),
+                              B, ldb );
+    } );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+blas::real_type< scalar_t > LU< scalar_t >::rcond( lapack::Norm norm )
+{
+    lapack_error_if( norm != Norm::One && norm != Norm::Inf );
+    if (info_ > 0)
+        return 0;
+
+    real_t anorm = (norm == Norm::One ? anorm_one_ : anorm_inf_);
+    real_t rcond_ = 0;
+    with_work( work_, [&]() {
+        return lapack::gecon( norm, n_, LU_.data(), ld_, anorm, &rcond_ );
+    } );
+    return rcond_;
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t LU< scalar_t >::refine(
+    int64_t nrhs,
+    scalar_t const* B, int64_t ldb,
+    scalar_t* X, int64_t ldx,
+    real_t* ferr, real_t* berr,
+    lapack::Op trans )
+{
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( ldb < max( 1, n_ ) );
+    lapack_error_if( ldx < max( 1, n_ ) );
+    if (info_ > 0)
+        return info_;
+
+    return with_work( work_, [&]() {
+        return lapack::gerfs( trans, n_, nrhs, A_.data(), ld_, LU_.data(), ld_,
+                              ipiv_.data(), B, ldb, X, ldx, ferr, berr );
+    } );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t LU< scalar_t >::inverse( scalar_t* Ainv, int64_t ldainv )
+{
+    lapack_error_if( ldainv < max( 1, n_ ) );
+    if (info_ > 0)
+        return info_;
+
+    lapack::lacpy( MatrixType::General, n_, n_, LU_.data(), ld_,
+                   Ainv, ldainv );
+    return with_work( work_, [&]() {
+        return lapack::getri( n_, Ainv, ldainv, ipiv_.data() );
+    } );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+blas::real_type< scalar_t > LU< scalar_t >::anorm( lapack::Norm norm ) const
+{
+    switch (norm) {
+        case Norm::One: return anorm_one_;
+        case Norm::Inf: return anorm_inf_;
+        case Norm::Max: return anorm_max_;
+        case Norm::Fro: return anorm_fro_;
+        default:
+            lapack_error_if( true );
+            return 0;
+    }
+}
+
+template class LU< float >;
+template class LU< double >;
+template class LU< std::complex<float> >;
+template class LU< std::complex<double> >;
+
+//==============================================================================
+// Cholesky
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+Cholesky< scalar_t >::Cholesky()
+    : uplo_( Uplo::Lower ),
+      n_( 0 ),
+      ld_( 1 ),
+      info_( 0 ),
+      anorm_( 0 )
+{}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+Cholesky< scalar_t >::Cholesky(
+    lapack::Uplo uplo, int64_t n, scalar_t const* A, int64_t lda )
+    : Cholesky()
+{
+    factor( uplo, n, A, lda );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t Cholesky< scalar_t >::factor(
+    lapack::Uplo uplo, int64_t n, scalar_t const* A, int64_t lda )
+{
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+
+    uplo_ = uplo;
+    n_ = n;
+    ld_ = max( 1, n );
+    A_.resize( ld_ * n );
+    L_.resize( ld_ * n );
+    // pocon, porfs need O(n) work.
+    reserve_work< scalar_t >( work_, 3*n, 2*n, n );
+
+    auto type = (uplo == Uplo::Lower ? MatrixType::Lower : MatrixType::Upper);
+    lapack::lacpy( type, n, n, A, lda, A_.data(), ld_ );
+    std::copy( A_.begin(), A_.end(), L_.begin() );
+    info_ = with_work( work_, [&]() {
+        anorm_ = lapack::lanhe( Norm::One, uplo, n, A_.data(), ld_ );
+        return lapack::potrf( uplo, n, L_.data(), ld_ );
+    } );
+    return info_;
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t Cholesky< scalar_t >::solve( int64_t nrhs, scalar_t* B, int64_t ldb )
+{
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( ldb < max( 1, n_ ) );
+    if (info_ > 0)
+        return info_;
+
+    return with_work( work_, [&]() {
+        return lapack::potrs( uplo_, n_, nrhs, L_.data(), ld_, B, ldb );
+    } );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+blas::real_type< scalar_t > Cholesky< scalar_t >::rcond()
+{
+    if (info_ > 0)
+        return 0;
+
+    real_t rcond_ = 0;
+    with_work( work_, [&]() {
+        return lapack::pocon( uplo_, n_, L_.data(), ld_, anorm_, &rcond_ );
+    } );
+    return rcond_;
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t Cholesky< scalar_t >::refine(
+    int64_t nrhs,
+    scalar_t const* B, int64_t ldb,
+    scalar_t* X, int64_t ldx,
+    real_t* ferr, real_t* berr )
+{
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( ldb < max( 1, n_ ) );
+    lapack_error_if( ldx < max( 1, n_ ) );
+    if (info_ > 0)
+        return info_;
+
+    return with_work( work_, [&]() {
+        return lapack::porfs( uplo_, n_, nrhs, A_.data(), ld_, L_.data(), ld_,
+                              B, ldb, X, ldx, ferr, berr );
+    } );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t Cholesky< scalar_t >::inverse( scalar_t* Ainv, int64_t ldainv )
+{
+    lapack_error_if( ldainv < max( 1, n_ ) );
+    if (info_ > 0)
+        return info_;
+
+    auto type = (uplo_ == Uplo::Lower ? MatrixType::Lower : MatrixType::Upper);
+    lapack::lacpy( type, n_, n_, L_.data(), ld_, Ainv, ldainv );
+    int64_t info = with_work( work_, [&]() {
+        return lapack::potri( uplo_, n_, Ainv, ldainv );
+    } );
+    he_fill( uplo_, n_, Ainv, ldainv );
+    return info;
+}
+
+template class Cholesky< float >;
+template class Cholesky< double >;
+template class Cholesky< std::complex<float> >;
+template class Cholesky< std::complex<double> >;
+
+//==============================================================================
+// LDLT
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+LDLT< scalar_t >::LDLT()
+    : uplo_( Uplo::Lower ),
+      n_( 0 ),
+      ld_( 1 ),
+      info_( 0 ),
+      anorm_( 0 )
+{}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+LDLT< scalar_t >::LDLT(
+    lapack::Uplo uplo, int64_t n, scalar_t const* A, int64_t lda )
+    : LDLT()
+{
+    factor( uplo, n, A, lda );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t LDLT< scalar_t >::factor(
+    lapack::Uplo uplo, int64_t n, scalar_t const* A, int64_t lda )
+{
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+
+    uplo_ = uplo;
+    n_ = n;
+    ld_ = max( 1, n );
+    A_.resize( ld_ * n );
+    LD_.resize( ld_ * n );
+    ipiv_.resize( n );
+    // hecon, herfs, hetri need O(n) work; hetrf uses n*nb.
+    reserve_work< scalar_t >( work_, 67*n, n, 3*n );
+
+    auto type = (uplo == Uplo::Lower ? MatrixType::Lower : MatrixType::Upper);
+    lapack::lacpy( type, n, n, A, lda, A_.data(), ld_ );
+    std::copy( A_.begin(), A_.end(), LD_.begin() );
+    info_ = with_work( work_, [&]() {
+        anorm_ = lapack::lanhe( Norm::One, uplo, n, A_.data(), ld_ );
+        return lapack::hetrf( uplo, n, LD_.data(), ld_, ipiv_.data() );
+    } );
+    return info_;
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t LDLT< scalar_t >::solve( int64_t nrhs, scalar_t* B, int64_t ldb )
+{
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( ldb < max( 1, n_ ) );
+    if (info_ > 0)
+        return info_;
+
+    return with_work( work_, [&]() {
+        return lapack::hetrs( uplo_, n_, nrhs, LD_.data(), ld_, ipiv_.data(),
+                              B, ldb );
+    } );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+blas::real_type< scalar_t > LDLT< scalar_t >::rcond()
+{
+    if (info_ > 0)
+        return 0;
+
+    real_t rcond_ = 0;
+    with_work( work_, [&]() {
+        return lapack::hecon( uplo_, n_, LD_.data(), ld_, ipiv_.data(),
+                              anorm_, &rcond_ );
+    } );
+    return rcond_;
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t LDLT< scalar_t >::refine(
+    int64_t nrhs,
+    scalar_t const* B, int64_t ldb,
+    scalar_t* X, int64_t ldx,
+    real_t* ferr, real_t* berr )
+{
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( ldb < max( 1, n_ ) );
+    lapack_error_if( ldx < max( 1, n_ ) );
+    if (info_ > 0)
+        return info_;
+
+    return with_work( work_, [&]() {
+        return lapack::herfs( uplo_, n_, nrhs, A_.data(), ld_, LD_.data(), ld_,
+                              ipiv_.data(), B, ldb, X, ldx, ferr, berr );
+    } );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t LDLT< scalar_t >::inverse( scalar_t* Ainv, int64_t ldainv )
+{
+    lapack_error_if( ldainv < max( 1, n_ ) );
+    if (info_ > 0)
+        return info_;
+
+    auto type = (uplo_ == Uplo::Lower ? MatrixType::Lower : MatrixType::Upper);
+    lapack::lacpy( type, n_, n_, LD_.data(), ld_, Ainv, ldainv );
+    int64_t info = with_work( work_, [&]() {
+        return lapack::hetri( uplo_, n_, Ainv, ldainv, ipiv_.data() );
+    } );
+    he_fill( uplo_, n_, Ainv, ldainv );
+    return info;
+}
+
+template class LDLT< float >;
+template class LDLT< double >;
+template class LDLT< std::complex<float> >;
+template class LDLT< std::complex<double> >;
+
+//==============================================================================
+// QR
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+QR< scalar_t >::QR()
+    : m_( 0 ),
+      n_( 0 ),
+      ld_( 1 )
+{}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+QR< scalar_t >::QR( int64_t m, int64_t n, scalar_t const* A, int64_t lda )
+    : QR()
+{
+    factor( m, n, A, lda );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void QR< scalar_t >::factor(
+    int64_t m, int64_t n, scalar_t const* A, int64_t lda )
+{
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 || n > m );
+    lapack_error_if( lda < max( 1, m ) );
+
+    m_ = m;
+    n_ = n;
+    ld_ = max( 1, m );
+    A_.resize( ld_ * n );
+    QR_.resize( ld_ * n );
+    tau_.resize( n );
+    // geqrf, unmqr use n*nb; trcon needs O(n).
+    reserve_work< scalar_t >( work_, 66*n, n, n );
+
+    lapack::lacpy( MatrixType::General, m, n, A, lda, A_.data(), ld_ );
+    std::copy( A_.begin(), A_.end(), QR_.begin() );
+    with_work( work_, [&]() {
+        return lapack::geqrf( m, n, QR_.data(), ld_, tau_.data() );
+    } );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t QR< scalar_t >::solve( int64_t nrhs, scalar_t* B, int64_t ldb )
+{
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( ldb < max( 1, m_ ) );
+
+    return with_work( work_, [&]() {
+        return qr_solve( m_, n_, nrhs, QR_.data(), ld_, tau_.data(), B, ldb );
+    } );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+blas::real_type< scalar_t > QR< scalar_t >::rcond( lapack::Norm norm )
+{
+    lapack_error_if( norm != Norm::One && norm != Norm::Inf );
+
+    real_t rcond_ = 0;
+    with_work( work_, [&]() {
+        return lapack::trcon( norm, Uplo::Upper, Diag::NonUnit, n_,
+                              QR_.data(), ld_, &rcond_ );
+    } );
+    return rcond_;
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t QR< scalar_t >::refine(
+    int64_t nrhs,
+    scalar_t const* B, int64_t ldb,
+    scalar_t* X, int64_t ldx )
+{
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( ldb < max( 1, m_ ) );
+    lapack_error_if( ldx < max( 1, n_ ) );
+
+    return with_work( work_, [&]() {
+        // R = B - A X, then D = argmin || A D - R || in R( 0:n-1, : ).
+        lapack::vector< scalar_t > R( ld_ * nrhs );
+        lapack::lacpy( MatrixType::General, m_, nrhs, B, ldb, R.data(), ld_ );
+        blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                    m_, nrhs, n_,
+                    -1.0, A_.data(), ld_,
+                          X, ldx,
+                     1.0, R.data(), ld_ );
+        int64_t info = qr_solve( m_, n_, nrhs, QR_.data(), ld_, tau_.data(),
+                                 R.data(), ld_ );
+        if (info == 0) {
+            for (int64_t j = 0; j < nrhs; ++j) {
+                blas::axpy( n_, 1.0, &R[ j*ld_ ], 1, &X[ j*ldx ], 1 );
+            }
+        }
+        return info;
+    } );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t QR< scalar_t >::inverse( scalar_t* Ainv, int64_t ldainv )
+{
+    lapack_error_if( m_ != n_ );
+    lapack_error_if( ldainv < max( 1, n_ ) );
+
+    // Ainv = R^{-1} Q^H.
+    lapack::laset( MatrixType::Lower, n_, n_, 0.0, 0.0, Ainv, ldainv );
+    lapack::lacpy( MatrixType::Upper, n_, n_, QR_.data(), ld_, Ainv, ldainv );
+    return with_work( work_, [&]() {
+        int64_t info = lapack::trtri( Uplo::Upper, Diag::NonUnit, n_,
+                                      Ainv, ldainv );
+        if (info == 0) {
+            lapack::unmqr( Side::Right, Op::ConjTrans, n_, n_, n_,
+                           QR_.data(), ld_, tau_.data(), Ainv, ldainv );
+        }
+        return info;
+    } );
+}
+
+template class QR< float >;
+template class QR< double >;
+template class QR< std::complex<float> >;
+template class QR< std::complex<double> >;
+
+}  // namespace lapack
@@ -38,6 +38,7 @@ int64_t gbbrd(
     lapack_int ldpt_ = to_lapack_int( ldpt );
     lapack_int ldc_ = to_lapack_int( ldc );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gbbrd", float, m, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (2*max(m,n)) );
@@ -80,6 +81,7 @@ int64_t gbbrd(
     lapack_int ldpt_ = to_lapack_int( ldpt );
     lapack_int ldc_ = to_lapack_int( ldc );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gbbrd", double, m, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (2*max(m,n)) );
@@ -122,6 +124,7 @@ int64_t gbbrd(
     lapack_int ldpt_ = to_lapack_int( ldpt );
     lapack_int ldc_ = to_lapack_int( ldc );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gbbrd", std::complex<float>, m, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<float> > work( (max(m,n)) );
@@ -251,6 +254,7 @@ int64_t gbbrd(
     lapack_int ldpt_ = to_lapack_int( ldpt );
     lapack_int ldc_ = to_lapack_int( ldc );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gbbrd", std::complex<double>, m, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (max(m,n)) );
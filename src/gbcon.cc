@@ -37,6 +37,7 @@ int64_t gbcon(
         lapack_int const* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gbcon", float, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (3*n) );
@@ -76,6 +77,7 @@ int64_t gbcon(
         lapack_int const* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gbcon", double, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (3*n) );
@@ -115,6 +117,7 @@ int64_t gbcon(
         lapack_int const* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gbcon", std::complex<float>, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
@@ -206,6 +209,7 @@ int64_t gbcon(
         lapack_int const* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gbcon", std::complex<double>, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
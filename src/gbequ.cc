@@ -32,6 +32,7 @@ int64_t gbequ(
     lapack_int ku_ = to_lapack_int( ku );
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gbequ", float, m, n, 0, 0, info_ );
 
     LAPACK_sgbequ(
         &m_, &n_, &kl_, &ku_,
@@ -61,6 +62,7 @@ int64_t gbequ(
     lapack_int ku_ = to_lapack_int( ku );
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gbequ", double, m, n, 0, 0, info_ );
 
     LAPACK_dgbequ(
         &m_, &n_, &kl_, &ku_,
@@ -90,6 +92,7 @@ int64_t gbequ(
     lapack_int ku_ = to_lapack_int( ku );
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gbequ", std::complex<float>, m, n, 0, 0, info_ );
 
     LAPACK_cgbequ(
         &m_, &n_, &kl_, &ku_,
@@ -184,6 +187,7 @@ int64_t gbequ(
     lapack_int ku_ = to_lapack_int( ku );
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gbequ", std::complex<double>, m, n, 0, 0, info_ );
 
     LAPACK_zgbequ(
         &m_, &n_, &kl_, &ku_,
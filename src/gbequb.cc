@@ -32,6 +32,7 @@ int64_t gbequb(
     lapack_int ku_ = to_lapack_int( ku );
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gbequb", float, m, n, 0, 0, info_ );
 
     LAPACK_sgbequb(
         &m_, &n_, &kl_, &ku_,
@@ -61,6 +62,7 @@ int64_t gbequb(
     lapack_int ku_ = to_lapack_int( ku );
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gbequb", double, m, n, 0, 0, info_ );
 
     LAPACK_dgbequb(
         &m_, &n_, &kl_, &ku_,
@@ -90,6 +92,7 @@ int64_t gbequb(
     lapack_int ku_ = to_lapack_int( ku );
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gbequb", std::complex<float>, m, n, 0, 0, info_ );
 
     LAPACK_cgbequb(
         &m_, &n_, &kl_, &ku_,
@@ -191,6 +194,7 @@ int64_t gbequb(
     lapack_int ku_ = to_lapack_int( ku );
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gbequb", std::complex<double>, m, n, 0, 0, info_ );
 
     LAPACK_zgbequb(
         &m_, &n_, &kl_, &ku_,
@@ -45,6 +45,7 @@ int64_t gbrfs(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int ldx_ = to_lapack_int( ldx );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gbrfs", float, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (3*n) );
@@ -97,6 +98,7 @@ int64_t gbrfs(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int ldx_ = to_lapack_int( ldx );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gbrfs", double, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (3*n) );
@@ -149,6 +151,7 @@ int64_t gbrfs(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int ldx_ = to_lapack_int( ldx );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gbrfs", std::complex<float>, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
@@ -287,6 +290,7 @@ int64_t gbrfs(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int ldx_ = to_lapack_int( ldx );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gbrfs", std::complex<double>, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
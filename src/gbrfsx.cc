@@ -55,6 +55,7 @@ int64_t gbrfsx(
     lapack_int n_err_bnds_ = to_lapack_int( n_err_bnds );
     lapack_int nparams_ = to_lapack_int( nparams );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gbrfsx", float, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (4*n) );
@@ -119,6 +120,7 @@ int64_t gbrfsx(
     lapack_int n_err_bnds_ = to_lapack_int( n_err_bnds );
     lapack_int nparams_ = to_lapack_int( nparams );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gbrfsx", double, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (4*n) );
@@ -183,6 +185,7 @@ int64_t gbrfsx(
     lapack_int n_err_bnds_ = to_lapack_int( n_err_bnds );
     lapack_int nparams_ = to_lapack_int( nparams );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gbrfsx", std::complex<float>, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
@@ -548,6 +551,7 @@ int64_t gbrfsx(
     lapack_int n_err_bnds_ = to_lapack_int( n_err_bnds );
     lapack_int nparams_ = to_lapack_int( nparams );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gbrfsx", std::complex<double>, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
@@ -30,14 +30,14 @@ int64_t gbsv(
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldab_ = to_lapack_int( ldab );
     #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( (n) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+        // 32-bit pivots in first half of ipiv; widened below
+        lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gbsv", float, 0, n, 0, nrhs, info_ );
 
     LAPACK_sgbsv(
         &n_, &kl_, &ku_, &nrhs_,
@@ -48,7 +48,7 @@ int64_t gbsv(
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        widen_pivots( ipiv, n );
     #endif
     return info_;
 }
@@ -67,14 +67,14 @@ int64_t gbsv(
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldab_ = to_lapack_int( ldab );
     #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( (n) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+        // 32-bit pivots in first half of ipiv; widened below
+        lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gbsv", double, 0, n, 0, nrhs, info_ );
 
     LAPACK_dgbsv(
         &n_, &kl_, &ku_, &nrhs_,
@@ -85,7 +85,7 @@ int64_t gbsv(
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        widen_pivots( ipiv, n );
     #endif
     return info_;
 }
@@ -104,14 +104,14 @@ int64_t gbsv(
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldab_ = to_lapack_int( ldab );
     #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( (n) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+        // 32-bit pivots in first half of ipiv; widened below
+        lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gbsv", std::complex<float>, 0, n, 0, nrhs, info_ );
 
     LAPACK_cgbsv(
         &n_, &kl_, &ku_, &nrhs_,
@@ -122,7 +122,7 @@ int64_t gbsv(
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        widen_pivots( ipiv, n );
     #endif
     return info_;
 }
@@ -223,14 +223,14 @@ int64_t gbsv(
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldab_ = to_lapack_int( ldab );
     #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( (n) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+        // 32-bit pivots in first half of ipiv; widened below
+        lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gbsv", std::complex<double>, 0, n, 0, nrhs, info_ );
 
     LAPACK_zgbsv(
         &n_, &kl_, &ku_, &nrhs_,
@@ -241,7 +241,7 @@ int64_t gbsv(
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        widen_pivots( ipiv, n );
     #endif
     return info_;
 }
@@ -51,6 +51,7 @@ int64_t gbsvx(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int ldx_ = to_lapack_int( ldx );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gbsvx", float, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (3*n) );
@@ -116,6 +117,7 @@ int64_t gbsvx(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int ldx_ = to_lapack_int( ldx );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gbsvx", double, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (3*n) );
@@ -181,6 +183,7 @@ int64_t gbsvx(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int ldx_ = to_lapack_int( ldx );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gbsvx", std::complex<float>, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
@@ -467,6 +470,7 @@ int64_t gbsvx(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int ldx_ = to_lapack_int( ldx );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gbsvx", std::complex<double>, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
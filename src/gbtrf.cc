@@ -29,13 +29,13 @@ int64_t gbtrf(
     lapack_int ku_ = to_lapack_int( ku );
     lapack_int ldab_ = to_lapack_int( ldab );
     #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( (min(m,n)) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+        // 32-bit pivots in first half of ipiv; widened below
+        lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gbtrf", float, m, n, 0, 0, info_ );
 
     LAPACK_sgbtrf(
         &m_, &n_, &kl_, &ku_,
@@ -45,7 +45,7 @@ int64_t gbtrf(
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        widen_pivots( ipiv, min( m, n ) );
     #endif
     return info_;
 }
@@ -63,13 +63,13 @@ int64_t gbtrf(
     lapack_int ku_ = to_lapack_int( ku );
     lapack_int ldab_ = to_lapack_int( ldab );
     #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( (min(m,n)) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+        // 32-bit pivots in first half of ipiv; widened below
+        lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gbtrf", double, m, n, 0, 0, info_ );
 
     LAPACK_dgbtrf(
         &m_, &n_, &kl_, &ku_,
@@ -79,7 +79,7 @@ int64_t gbtrf(
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        widen_pivots( ipiv, min( m, n ) );
     #endif
     return info_;
 }
@@ -97,13 +97,13 @@ int64_t gbtrf(
     lapack_int ku_ = to_lapack_int( ku );
     lapack_int ldab_ = to_lapack_int( ldab );
     #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( (min(m,n)) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+        // 32-bit pivots in first half of ipiv; widened below
+        lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gbtrf", std::complex<float>, m, n, 0, 0, info_ );
 
     LAPACK_cgbtrf(
         &m_, &n_, &kl_, &ku_,
@@ -113,7 +113,7 @@ int64_t gbtrf(
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        widen_pivots( ipiv, min( m, n ) );
     #endif
     return info_;
 }
@@ -199,13 +199,13 @@ int64_t gbtrf(
     lapack_int ku_ = to_lapack_int( ku );
     lapack_int ldab_ = to_lapack_int( ldab );
     #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( (min(m,n)) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+        // 32-bit pivots in first half of ipiv; widened below
+        lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gbtrf", std::complex<double>, m, n, 0, 0, info_ );
 
     LAPACK_zgbtrf(
         &m_, &n_, &kl_, &ku_,
@@ -215,7 +215,7 @@ int64_t gbtrf(
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        widen_pivots( ipiv, min( m, n ) );
     #endif
     return info_;
 }
@@ -39,6 +39,7 @@ int64_t gbtrs(
     #endif
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gbtrs", float, 0, n, 0, nrhs, info_ );
 
     LAPACK_sgbtrs(
         &trans_, &n_, &kl_, &ku_, &nrhs_,
@@ -75,6 +76,7 @@ int64_t gbtrs(
     #endif
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gbtrs", double, 0, n, 0, nrhs, info_ );
 
     LAPACK_dgbtrs(
         &trans_, &n_, &kl_, &ku_, &nrhs_,
@@ -111,6 +113,7 @@ int64_t gbtrs(
     #endif
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gbtrs", std::complex<float>, 0, n, 0, nrhs, info_ );
 
     LAPACK_cgbtrs(
         &trans_, &n_, &kl_, &ku_, &nrhs_,
@@ -209,6 +212,7 @@ int64_t gbtrs(
     #endif
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gbtrs", std::complex<double>, 0, n, 0, nrhs, info_ );
 
     LAPACK_zgbtrs(
         &trans_, &n_, &kl_, &ku_, &nrhs_,
@@ -30,6 +30,7 @@ int64_t gebak(
     lapack_int m_ = to_lapack_int( m );
     lapack_int ldv_ = to_lapack_int( ldv );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gebak", float, m, n, 0, 0, info_ );
 
     LAPACK_sgebak(
         &balance_, &side_, &n_, &ilo_, &ihi_,
@@ -57,6 +58,7 @@ int64_t gebak(
     lapack_int m_ = to_lapack_int( m );
     lapack_int ldv_ = to_lapack_int( ldv );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gebak", double, m, n, 0, 0, info_ );
 
     LAPACK_dgebak(
         &balance_, &side_, &n_, &ilo_, &ihi_,
@@ -84,6 +86,7 @@ int64_t gebak(
     lapack_int m_ = to_lapack_int( m );
     lapack_int ldv_ = to_lapack_int( ldv );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gebak", std::complex<float>, m, n, 0, 0, info_ );
 
     LAPACK_cgebak(
         &balance_, &side_, &n_, &ilo_, &ihi_,
@@ -160,6 +163,7 @@ int64_t gebak(
     lapack_int m_ = to_lapack_int( m );
     lapack_int ldv_ = to_lapack_int( ldv );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gebak", std::complex<double>, m, n, 0, 0, info_ );
 
     LAPACK_zgebak(
         &balance_, &side_, &n_, &ilo_, &ihi_,
@@ -30,6 +30,7 @@ int64_t gebal(
     lapack_int ilo_ = 0;  // out
     lapack_int ihi_ = 0;  // out
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gebal", float, 0, n, 0, 0, info_ );
 
     LAPACK_sgebal(
         &balance_, &n_,
@@ -59,6 +60,7 @@ int64_t gebal(
     lapack_int ilo_ = 0;  // out
     lapack_int ihi_ = 0;  // out
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gebal", double, 0, n, 0, 0, info_ );
 
     LAPACK_dgebal(
         &balance_, &n_,
@@ -88,6 +90,7 @@ int64_t gebal(
     lapack_int ilo_ = 0;  // out
     lapack_int ihi_ = 0;  // out
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gebal", std::complex<float>, 0, n, 0, 0, info_ );
 
     LAPACK_cgebal(
         &balance_, &n_,
@@ -206,6 +209,7 @@ int64_t gebal(
     lapack_int ilo_ = 0;  // out
     lapack_int ihi_ = 0;  // out
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gebal", std::complex<double>, 0, n, 0, 0, info_ );
 
     LAPACK_zgebal(
         &balance_, &n_,
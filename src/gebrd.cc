@@ -26,12 +26,89 @@ int64_t gebrd(
     float* tauq,
     float* taup )
 {
+    // query for workspace size
+    int64_t lwork;
+    gebrd_work_size(
+        m, n, A, lda, D, E, tauq, taup,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return gebrd(
+        m, n, A, lda, D, E, tauq, taup,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd_computational
+int64_t gebrd(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tauq,
+    double* taup )
+{
+    // query for workspace size
+    int64_t lwork;
+    gebrd_work_size(
+        m, n, A, lda, D, E, tauq, taup,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return gebrd(
+        m, n, A, lda, D, E, tauq, taup,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd_computational
+int64_t gebrd(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* D,
+    float* E,
+    std::complex<float>* tauq,
+    std::complex<float>* taup )
+{
+    // query for workspace size
+    int64_t lwork;
+    gebrd_work_size(
+        m, n, A, lda, D, E, tauq, taup,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+
+    return gebrd(
+        m, n, A, lda, D, E, tauq, taup,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd_computational
+void gebrd_work_size(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tauq,
+    float* taup,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "sgebrd", m, n, lda );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
 
-    // query for workspace size
     float qry_work[1];
     lapack_int ineg_one = -1;
     LAPACK_sgebrd(
@@ -45,67 +122,112 @@ int64_t gebrd(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd_computational
+void gebrd_work_size(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tauq,
+    double* taup,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "dgebrd", m, n, lda );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
 
-    LAPACK_sgebrd(
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dgebrd(
         &m_, &n_,
         A, &lda_,
         D,
         E,
         tauq,
         taup,
-        &work[0], &lwork_, &info_ );
+        qry_work, &ineg_one, &info_ );
     if (info_ < 0) {
         throw Error();
     }
-    return info_;
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
 }
 
 // -----------------------------------------------------------------------------
 /// @ingroup gesvd_computational
-int64_t gebrd(
+void gebrd_work_size(
     int64_t m, int64_t n,
-    double* A, int64_t lda,
-    double* D,
-    double* E,
-    double* tauq,
-    double* taup )
+    std::complex<float>* A, int64_t lda,
+    float* D,
+    float* E,
+    std::complex<float>* tauq,
+    std::complex<float>* taup,
+    int64_t* lwork )
 {
+    auto key = internal::work_size_key(
+        "cgebrd", m, n, lda );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
+    std::complex<float> qry_work[1];
     lapack_int ineg_one = -1;
-    LAPACK_dgebrd(
+    LAPACK_cgebrd(
         &m_, &n_,
-        A, &lda_,
+        (lapack_complex_float*) A, &lda_,
         D,
         E,
-        tauq,
-        taup,
-        qry_work, &ineg_one, &info_ );
+        (lapack_complex_float*) tauq,
+        (lapack_complex_float*) taup,
+        (lapack_complex_float*) qry_work, &ineg_one, &info_ );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd_computational
+int64_t gebrd(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tauq,
+    float* taup,
+    float* work, int64_t lwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gebrd", float, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
-    LAPACK_dgebrd(
+    LAPACK_sgebrd(
         &m_, &n_,
         A, &lda_,
         D,
         E,
         tauq,
         taup,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -116,35 +238,51 @@ int64_t gebrd(
 /// @ingroup gesvd_computational
 int64_t gebrd(
     int64_t m, int64_t n,
-    std::complex<float>* A, int64_t lda,
-    float* D,
-    float* E,
-    std::complex<float>* tauq,
-    std::complex<float>* taup )
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tauq,
+    double* taup,
+    double* work, int64_t lwork )
 {
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gebrd", double, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cgebrd(
+    LAPACK_dgebrd(
         &m_, &n_,
-        (lapack_complex_float*) A, &lda_,
+        A, &lda_,
         D,
         E,
-        (lapack_complex_float*) tauq,
-        (lapack_complex_float*) taup,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_ );
+        tauq,
+        taup,
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd_computational
+int64_t gebrd(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* D,
+    float* E,
+    std::complex<float>* tauq,
+    std::complex<float>* taup,
+    std::complex<float>* work, int64_t lwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gebrd", std::complex<float>, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
     LAPACK_cgebrd(
         &m_, &n_,
@@ -153,7 +291,7 @@ int64_t gebrd(
         E,
         (lapack_complex_float*) tauq,
         (lapack_complex_float*) taup,
-        (lapack_complex_float*) &work[0], &lwork_, &info_ );
+        (lapack_complex_float*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -302,6 +440,7 @@ int64_t gebrd(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gebrd", std::complex<double>, m, n, 0, 0, info_ );
 
     // query for workspace size
     std::complex<double> qry_work[1];
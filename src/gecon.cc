@@ -27,6 +27,7 @@ int64_t gecon(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gecon", float, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (4*n) );
@@ -55,6 +56,7 @@ int64_t gecon(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gecon", double, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (4*n) );
@@ -83,6 +85,7 @@ int64_t gecon(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gecon", std::complex<float>, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
@@ -149,6 +152,7 @@ int64_t gecon(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gecon", std::complex<double>, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
@@ -30,6 +30,7 @@ int64_t geequ(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geequ", float, m, n, 0, 0, info_ );
 
     LAPACK_sgeequ(
         &m_, &n_,
@@ -57,6 +58,7 @@ int64_t geequ(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geequ", double, m, n, 0, 0, info_ );
 
     LAPACK_dgeequ(
         &m_, &n_,
@@ -84,6 +86,7 @@ int64_t geequ(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geequ", std::complex<float>, m, n, 0, 0, info_ );
 
     LAPACK_cgeequ(
         &m_, &n_,
@@ -168,6 +171,7 @@ int64_t geequ(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geequ", std::complex<double>, m, n, 0, 0, info_ );
 
     LAPACK_zgeequ(
         &m_, &n_,
@@ -30,6 +30,7 @@ int64_t geequb(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geequb", float, m, n, 0, 0, info_ );
 
     LAPACK_sgeequb(
         &m_, &n_,
@@ -57,6 +58,7 @@ int64_t geequb(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geequb", double, m, n, 0, 0, info_ );
 
     LAPACK_dgeequb(
         &m_, &n_,
@@ -84,6 +86,7 @@ int64_t geequb(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geequb", std::complex<float>, m, n, 0, 0, info_ );
 
     LAPACK_cgeequb(
         &m_, &n_,
@@ -175,6 +178,7 @@ int64_t geequb(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geequb", std::complex<double>, m, n, 0, 0, info_ );
 
     LAPACK_zgeequb(
         &m_, &n_,
@@ -31,6 +31,7 @@ int64_t gees(
     lapack_int sdim_ = 0;  // out
     lapack_int ldvs_ = to_lapack_int( ldvs );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gees", std::complex<float>, 0, n, 0, 0, info_ );
 
     // split-complex representation
     lapack::vector< float > WR( max( 1, n ) );
@@ -95,6 +96,7 @@ int64_t gees(
     lapack_int sdim_ = 0;  // out
     lapack_int ldvs_ = to_lapack_int( ldvs );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gees", std::complex<double>, 0, n, 0, 0, info_ );
 
     // split-complex representation
     lapack::vector< double > WR( max( 1, n ) );
@@ -159,6 +161,7 @@ int64_t gees(
     lapack_int sdim_ = 0;  // out
     lapack_int ldvs_ = to_lapack_int( ldvs );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gees", std::complex<float>, 0, n, 0, 0, info_ );
 
     // query for workspace size
     std::complex<float> qry_work[1];
@@ -217,6 +220,7 @@ int64_t gees(
     lapack_int sdim_ = 0;  // out
     lapack_int ldvs_ = to_lapack_int( ldvs );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gees", std::complex<double>, 0, n, 0, 0, info_ );
 
     // query for workspace size
     std::complex<double> qry_work[1];
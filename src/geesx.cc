@@ -34,6 +34,7 @@ int64_t geesx(
     lapack_int sdim_ = 0;  // out
     lapack_int ldvs_ = to_lapack_int( ldvs );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geesx", std::complex<float>, 0, n, 0, 0, info_ );
 
     // split-complex representation
     lapack::vector< float > WR( max( 1, n ) );
@@ -106,6 +107,7 @@ int64_t geesx(
     lapack_int sdim_ = 0;  // out
     lapack_int ldvs_ = to_lapack_int( ldvs );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geesx", std::complex<double>, 0, n, 0, 0, info_ );
 
     // split-complex representation
     lapack::vector< double > WR( max( 1, n ) );
@@ -178,6 +180,7 @@ int64_t geesx(
     lapack_int sdim_ = 0;  // out
     lapack_int ldvs_ = to_lapack_int( ldvs );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geesx", std::complex<float>, 0, n, 0, 0, info_ );
 
     // query for workspace size
     std::complex<float> qry_work[1];
@@ -239,6 +242,7 @@ int64_t geesx(
     lapack_int sdim_ = 0;  // out
     lapack_int ldvs_ = to_lapack_int( ldvs );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geesx", std::complex<double>, 0, n, 0, 0, info_ );
 
     // query for workspace size
     std::complex<double> qry_work[1];
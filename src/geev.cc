@@ -32,6 +32,7 @@ int64_t geev(
     lapack_int ldvl_ = to_lapack_int( ldvl );
     lapack_int ldvr_ = to_lapack_int( ldvr );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geev", std::complex<float>, 0, n, 0, 0, info_ );
 
     // split-complex representation
     lapack::vector< float > WR( max( 1, n ) );
@@ -90,6 +91,7 @@ int64_t geev(
     lapack_int ldvl_ = to_lapack_int( ldvl );
     lapack_int ldvr_ = to_lapack_int( ldvr );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geev", std::complex<double>, 0, n, 0, 0, info_ );
 
     // split-complex representation
     lapack::vector< double > WR( max( 1, n ) );
@@ -148,6 +150,7 @@ int64_t geev(
     lapack_int ldvl_ = to_lapack_int( ldvl );
     lapack_int ldvr_ = to_lapack_int( ldvr );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geev", std::complex<float>, 0, n, 0, 0, info_ );
 
     // query for workspace size
     std::complex<float> qry_work[1];
@@ -302,6 +305,7 @@ int64_t geev(
     lapack_int ldvl_ = to_lapack_int( ldvl );
     lapack_int ldvr_ = to_lapack_int( ldvr );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geev", std::complex<double>, 0, n, 0, 0, info_ );
 
     // query for workspace size
     std::complex<double> qry_work[1];
@@ -23,37 +23,18 @@ int64_t gehrd(
     float* A, int64_t lda,
     float* tau )
 {
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int ilo_ = to_lapack_int( ilo );
-    lapack_int ihi_ = to_lapack_int( ihi );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int info_ = 0;
-
     // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgehrd(
-        &n_, &ilo_, &ihi_,
-        A, &lda_,
-        tau,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork;
+    gehrd_work_size(
+        n, ilo, ihi, A, lda, tau,
+        &lwork );
 
     // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    lapack::vector< float > work( lwork );
 
-    LAPACK_sgehrd(
-        &n_, &ilo_, &ihi_,
-        A, &lda_,
-        tau,
-        &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return gehrd(
+        n, ilo, ihi, A, lda, tau,
+        &work[0], lwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -63,37 +44,18 @@ int64_t gehrd(
     double* A, int64_t lda,
     double* tau )
 {
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int ilo_ = to_lapack_int( ilo );
-    lapack_int ihi_ = to_lapack_int( ihi );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int info_ = 0;
-
     // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgehrd(
-        &n_, &ilo_, &ihi_,
-        A, &lda_,
-        tau,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork;
+    gehrd_work_size(
+        n, ilo, ihi, A, lda, tau,
+        &lwork );
 
     // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    lapack::vector< double > work( lwork );
 
-    LAPACK_dgehrd(
-        &n_, &ilo_, &ihi_,
-        A, &lda_,
-        tau,
-        &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return gehrd(
+        n, ilo, ihi, A, lda, tau,
+        &work[0], lwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -103,37 +65,18 @@ int64_t gehrd(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* tau )
 {
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int ilo_ = to_lapack_int( ilo );
-    lapack_int ihi_ = to_lapack_int( ihi );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int info_ = 0;
-
     // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cgehrd(
-        &n_, &ilo_, &ihi_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) tau,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork;
+    gehrd_work_size(
+        n, ilo, ihi, A, lda, tau,
+        &lwork );
 
     // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+    lapack::vector< std::complex<float> > work( lwork );
 
-    LAPACK_cgehrd(
-        &n_, &ilo_, &ihi_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) tau,
-        (lapack_complex_float*) &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return gehrd(
+        n, ilo, ihi, A, lda, tau,
+        &work[0], lwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -220,13 +163,148 @@ int64_t gehrd(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* tau )
 {
+    // query for workspace size
+    int64_t lwork;
+    gehrd_work_size(
+        n, ilo, ihi, A, lda, tau,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+
+    return gehrd(
+        n, ilo, ihi, A, lda, tau,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+void gehrd_work_size(
+    int64_t n, int64_t ilo, int64_t ihi,
+    float* A, int64_t lda,
+    float* tau,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "sgehrd", n, ilo, ihi, lda );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ilo_ = to_lapack_int( ilo );
+    lapack_int ihi_ = to_lapack_int( ihi );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+
+    float qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_sgehrd(
+        &n_, &ilo_, &ihi_,
+        A, &lda_,
+        tau,
+        qry_work, &ineg_one, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+void gehrd_work_size(
+    int64_t n, int64_t ilo, int64_t ihi,
+    double* A, int64_t lda,
+    double* tau,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "dgehrd", n, ilo, ihi, lda );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ilo_ = to_lapack_int( ilo );
+    lapack_int ihi_ = to_lapack_int( ihi );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dgehrd(
+        &n_, &ilo_, &ihi_,
+        A, &lda_,
+        tau,
+        qry_work, &ineg_one, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+void gehrd_work_size(
+    int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "cgehrd", n, ilo, ihi, lda );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ilo_ = to_lapack_int( ilo );
+    lapack_int ihi_ = to_lapack_int( ihi );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+
+    std::complex<float> qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_cgehrd(
+        &n_, &ilo_, &ihi_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) tau,
+        (lapack_complex_float*) qry_work, &ineg_one, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::gehrd with caller-provided workspace.
+/// Returns the array lengths that the workspace overload of `gehrd`
+/// requires, so the workspace can be allocated once, outside a loop.
+///
+/// Other arguments are the same as for lapack::gehrd.
+/// Arrays are used only to select the precision and are not referenced.
+///
+/// @param[out] lwork
+///     The optimal length of the array work.
+///
+/// @ingroup geev_computational
+void gehrd_work_size(
+    int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "zgehrd", n, ilo, ihi, lda );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int ilo_ = to_lapack_int( ilo );
     lapack_int ihi_ = to_lapack_int( ihi );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
 
-    // query for workspace size
     std::complex<double> qry_work[1];
     lapack_int ineg_one = -1;
     LAPACK_zgehrd(
@@ -237,16 +315,125 @@ int64_t gehrd(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+int64_t gehrd(
+    int64_t n, int64_t ilo, int64_t ihi,
+    float* A, int64_t lda,
+    float* tau,
+    float* work, int64_t lwork )
+{
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ilo_ = to_lapack_int( ilo );
+    lapack_int ihi_ = to_lapack_int( ihi );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gehrd", float, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+
+    LAPACK_sgehrd(
+        &n_, &ilo_, &ihi_,
+        A, &lda_,
+        tau,
+        work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+int64_t gehrd(
+    int64_t n, int64_t ilo, int64_t ihi,
+    double* A, int64_t lda,
+    double* tau,
+    double* work, int64_t lwork )
+{
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ilo_ = to_lapack_int( ilo );
+    lapack_int ihi_ = to_lapack_int( ihi );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gehrd", double, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+
+    LAPACK_dgehrd(
+        &n_, &ilo_, &ihi_,
+        A, &lda_,
+        tau,
+        work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+int64_t gehrd(
+    int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    std::complex<float>* work, int64_t lwork )
+{
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ilo_ = to_lapack_int( ilo );
+    lapack_int ihi_ = to_lapack_int( ihi );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gehrd", std::complex<float>, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+
+    LAPACK_cgehrd(
+        &n_, &ilo_, &ihi_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) tau,
+        (lapack_complex_float*) work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::gehrd that takes caller-provided workspace
+/// instead of querying and allocating it on each call.
+/// Use lapack::gehrd_work_size to get the required lengths.
+///
+/// Other arguments are the same as for lapack::gehrd.
+///
+/// @param[out] work
+///     The vector work of length lwork. Workspace.
+///
+/// @param[in] lwork
+///     The length of the array work.
+///     Use the value from lapack::gehrd_work_size for best performance.
+///
+/// @ingroup geev_computational
+int64_t gehrd(
+    int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    std::complex<double>* work, int64_t lwork )
+{
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ilo_ = to_lapack_int( ilo );
+    lapack_int ihi_ = to_lapack_int( ihi );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gehrd", std::complex<double>, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
     LAPACK_zgehrd(
         &n_, &ilo_, &ihi_,
         (lapack_complex_double*) A, &lda_,
         (lapack_complex_double*) tau,
-        (lapack_complex_double*) &work[0], &lwork_, &info_ );
+        (lapack_complex_double*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
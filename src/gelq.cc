@@ -24,13 +24,98 @@ int64_t gelq(
     float* A, int64_t lda,
     float* T, int64_t tsize )
 {
+    // query for workspace size
+    int64_t lwork;
+    gelq_work_size(
+        m, n, A, lda, T, tsize,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return gelq(
+        m, n, A, lda, T, tsize,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gelq(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* T, int64_t tsize )
+{
+    // query for workspace size
+    int64_t lwork;
+    gelq_work_size(
+        m, n, A, lda, T, tsize,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return gelq(
+        m, n, A, lda, T, tsize,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gelq(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* T, int64_t tsize )
+{
+    // query for workspace size
+    int64_t lwork;
+    gelq_work_size(
+        m, n, A, lda, T, tsize,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+
+    return gelq(
+        m, n, A, lda, T, tsize,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gelq(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* T, int64_t tsize )
+{
+    // query for workspace size
+    int64_t lwork;
+    gelq_work_size(
+        m, n, A, lda, T, tsize,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+
+    return gelq(
+        m, n, A, lda, T, tsize,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+void gelq_work_size(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* T, int64_t tsize,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "sgelq", m, n, lda, tsize );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int tsize_ = to_lapack_int( tsize );
     lapack_int info_ = 0;
 
-    // query for workspace size
     float qry_work[1];
     lapack_int ineg_one = -1;
     LAPACK_sgelq(
@@ -41,55 +126,126 @@ int64_t gelq(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+void gelq_work_size(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* T, int64_t tsize,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "dgelq", m, n, lda, tsize );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
 
-    LAPACK_sgelq(
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int tsize_ = to_lapack_int( tsize );
+    lapack_int info_ = 0;
+
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dgelq(
         &m_, &n_,
         A, &lda_,
         T, &tsize_,
-        &work[0], &lwork_, &info_ );
+        qry_work, &ineg_one, &info_ );
     if (info_ < 0) {
         throw Error();
     }
-    return info_;
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
 }
 
 // -----------------------------------------------------------------------------
-int64_t gelq(
+void gelq_work_size(
     int64_t m, int64_t n,
-    double* A, int64_t lda,
-    double* T, int64_t tsize )
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* T, int64_t tsize,
+    int64_t* lwork )
 {
+    auto key = internal::work_size_key(
+        "cgelq", m, n, lda, tsize );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int tsize_ = to_lapack_int( tsize );
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
+    std::complex<float> qry_work[1];
     lapack_int ineg_one = -1;
-    LAPACK_dgelq(
+    LAPACK_cgelq(
         &m_, &n_,
-        A, &lda_,
-        T, &tsize_,
-        qry_work, &ineg_one, &info_ );
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) T, &tsize_,
+        (lapack_complex_float*) qry_work, &ineg_one, &info_ );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+void gelq_work_size(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* T, int64_t tsize,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "zgelq", m, n, lda, tsize );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
 
-    LAPACK_dgelq(
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int tsize_ = to_lapack_int( tsize );
+    lapack_int info_ = 0;
+
+    std::complex<double> qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_zgelq(
+        &m_, &n_,
+        (lapack_complex_double*) A, &lda_,
+        (lapack_complex_double*) T, &tsize_,
+        (lapack_complex_double*) qry_work, &ineg_one, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gelq(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* T, int64_t tsize,
+    float* work, int64_t lwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int tsize_ = to_lapack_int( tsize );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gelq", float, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+
+    LAPACK_sgelq(
         &m_, &n_,
         A, &lda_,
         T, &tsize_,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -99,36 +255,49 @@ int64_t gelq(
 // -----------------------------------------------------------------------------
 int64_t gelq(
     int64_t m, int64_t n,
-    std::complex<float>* A, int64_t lda,
-    std::complex<float>* T, int64_t tsize )
+    double* A, int64_t lda,
+    double* T, int64_t tsize,
+    double* work, int64_t lwork )
 {
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int tsize_ = to_lapack_int( tsize );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gelq", double, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cgelq(
+    LAPACK_dgelq(
         &m_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) T, &tsize_,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_ );
+        A, &lda_,
+        T, &tsize_,
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+// -----------------------------------------------------------------------------
+int64_t gelq(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* T, int64_t tsize,
+    std::complex<float>* work, int64_t lwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int tsize_ = to_lapack_int( tsize );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gelq", std::complex<float>, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
     LAPACK_cgelq(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
         (lapack_complex_float*) T, &tsize_,
-        (lapack_complex_float*) &work[0], &lwork_, &info_ );
+        (lapack_complex_float*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -139,35 +308,22 @@ int64_t gelq(
 int64_t gelq(
     int64_t m, int64_t n,
     std::complex<double>* A, int64_t lda,
-    std::complex<double>* T, int64_t tsize )
+    std::complex<double>* T, int64_t tsize,
+    std::complex<double>* work, int64_t lwork )
 {
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int tsize_ = to_lapack_int( tsize );
     lapack_int info_ = 0;
-
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgelq(
-        &m_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) T, &tsize_,
-        (lapack_complex_double*) qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+    LAPACK_TRACE_BLOCK( "gelq", std::complex<double>, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
     LAPACK_zgelq(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
         (lapack_complex_double*) T, &tsize_,
-        (lapack_complex_double*) &work[0], &lwork_, &info_ );
+        (lapack_complex_double*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
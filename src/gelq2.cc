@@ -27,6 +27,7 @@ int64_t gelq2(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gelq2", float, m, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (m) );
@@ -53,6 +54,7 @@ int64_t gelq2(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gelq2", double, m, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (m) );
@@ -79,6 +81,7 @@ int64_t gelq2(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gelq2", std::complex<float>, m, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<float> > work( (m) );
@@ -154,6 +157,7 @@ int64_t gelq2(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gelq2", std::complex<double>, m, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (m) );
@@ -23,36 +23,18 @@ int64_t gelqf(
     float* A, int64_t lda,
     float* tau )
 {
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int info_ = 0;
-
     // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgelqf(
-        &m_, &n_,
-        A, &lda_,
-        tau,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork;
+    gelqf_work_size(
+        m, n, A, lda, tau,
+        &lwork );
 
     // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    lapack::vector< float > work( lwork );
 
-    LAPACK_sgelqf(
-        &m_, &n_,
-        A, &lda_,
-        tau,
-        &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return gelqf(
+        m, n, A, lda, tau,
+        &work[0], lwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -62,36 +44,18 @@ int64_t gelqf(
     double* A, int64_t lda,
     double* tau )
 {
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int info_ = 0;
-
     // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgelqf(
-        &m_, &n_,
-        A, &lda_,
-        tau,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork;
+    gelqf_work_size(
+        m, n, A, lda, tau,
+        &lwork );
 
     // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    lapack::vector< double > work( lwork );
 
-    LAPACK_dgelqf(
-        &m_, &n_,
-        A, &lda_,
-        tau,
-        &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return gelqf(
+        m, n, A, lda, tau,
+        &work[0], lwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -101,36 +65,18 @@ int64_t gelqf(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* tau )
 {
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int info_ = 0;
-
     // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cgelqf(
-        &m_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) tau,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork;
+    gelqf_work_size(
+        m, n, A, lda, tau,
+        &lwork );
 
     // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+    lapack::vector< std::complex<float> > work( lwork );
 
-    LAPACK_cgelqf(
-        &m_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) tau,
-        (lapack_complex_float*) &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return gelqf(
+        m, n, A, lda, tau,
+        &work[0], lwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -189,12 +135,147 @@ int64_t gelqf(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* tau )
 {
+    // query for workspace size
+    int64_t lwork;
+    gelqf_work_size(
+        m, n, A, lda, tau,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+
+    return gelqf(
+        m, n, A, lda, tau,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gelqf
+void gelqf_work_size(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "sgelqf", m, n, lda );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+
+    float qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_sgelqf(
+        &m_, &n_,
+        A, &lda_,
+        tau,
+        qry_work, &ineg_one, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gelqf
+void gelqf_work_size(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "dgelqf", m, n, lda );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dgelqf(
+        &m_, &n_,
+        A, &lda_,
+        tau,
+        qry_work, &ineg_one, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gelqf
+void gelqf_work_size(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "cgelqf", m, n, lda );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+
+    std::complex<float> qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_cgelqf(
+        &m_, &n_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) tau,
+        (lapack_complex_float*) qry_work, &ineg_one, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::gelqf with caller-provided workspace.
+/// Returns the array lengths that the workspace overload of `gelqf`
+/// requires, so the workspace can be allocated once, outside a loop.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// Other arguments are the same as for lapack::gelqf.
+/// Arrays are used only to select the precision and are not referenced.
+///
+/// @param[out] lwork
+///     The optimal length of the array work.
+///
+/// @ingroup gelqf
+void gelqf_work_size(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "zgelqf", m, n, lda );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
 
-    // query for workspace size
     std::complex<double> qry_work[1];
     lapack_int ineg_one = -1;
     LAPACK_zgelqf(
@@ -205,20 +286,221 @@ int64_t gelqf(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup gelqf
+int64_t gelqf(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau,
+    float* work, int64_t lwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gelqf", float, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+
+    LAPACK_sgelqf(
+        &m_, &n_,
+        A, &lda_,
+        tau,
+        work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gelqf
+int64_t gelqf(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau,
+    double* work, int64_t lwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gelqf", double, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+
+    LAPACK_dgelqf(
+        &m_, &n_,
+        A, &lda_,
+        tau,
+        work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gelqf
+int64_t gelqf(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    std::complex<float>* work, int64_t lwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gelqf", std::complex<float>, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+
+    LAPACK_cgelqf(
+        &m_, &n_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) tau,
+        (lapack_complex_float*) work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::gelqf that takes caller-provided workspace
+/// instead of querying and allocating it on each call.
+/// Use lapack::gelqf_work_size to get the required lengths.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// Other arguments are the same as for lapack::gelqf.
+///
+/// @param[out] work
+///     The vector work of length lwork. Workspace.
+///
+/// @param[in] lwork
+///     The length of the array work.
+///     Use the value from lapack::gelqf_work_size for best performance.
+///
+/// @ingroup gelqf
+int64_t gelqf(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    std::complex<double>* work, int64_t lwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gelqf", std::complex<double>, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
     LAPACK_zgelqf(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
         (lapack_complex_double*) tau,
-        (lapack_complex_double*) &work[0], &lwork_, &info_ );
+        (lapack_complex_double*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
     return info_;
 }
 
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper for either layout.
+/// @ingroup gelqf
+///
+template <typename scalar_t>
+int64_t gelqf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    scalar_t* tau )
+{
+    if (layout == Layout::ColMajor)
+        return lapack::gelqf( m, n, A, lda, tau );
+
+    lapack_error_if( layout != Layout::RowMajor );
+
+    // Row-major A is column-major A^T. If A^T = Q R by geqrf, then
+    // A = R^T Q^T = L Q2 with L = R^T, where Q2 = Q^T has the same
+    // reflectors as Q, read row-major, with tau conjugated.
+    int64_t info = lapack::geqrf( n, m, A, lda, tau );
+    if constexpr (blas::is_complex_v< scalar_t >) {
+        for (int64_t i = 0; i < min( m, n ); ++i)
+            tau[ i ] = blas::conj( tau[ i ] );
+    }
+    return info;
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// @ingroup gelqf
+int64_t gelqf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau )
+{
+    return impl::gelqf( layout, m, n, A, lda, tau );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gelqf
+int64_t gelqf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau )
+{
+    return impl::gelqf( layout, m, n, A, lda, tau );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gelqf
+int64_t gelqf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau )
+{
+    return impl::gelqf( layout, m, n, A, lda, tau );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::gelqf that takes the matrix layout.
+/// For row-major layout, A, L, and the Householder vectors are stored
+/// row-major, in the same positions as for column-major.
+///
+/// For row-major, this computes the QR factorization of the column-major
+/// A^T with lapack::geqrf, $A^T = Q R$, so $A = R^T Q^T$, where
+/// $L = R^T$ and the reflectors of $Q^T$ are those of Q with tau
+/// conjugated. Nothing is copied.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// Other arguments are the same as for lapack::gelqf.
+///
+/// @param[in] layout
+///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
+///
+/// @param[in] lda
+///     The leading dimension of the array A.
+///     If layout = ColMajor, lda >= max(1,m);
+///     if layout = RowMajor, lda >= max(1,n).
+///
+/// @ingroup gelqf
+int64_t gelqf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau )
+{
+    return impl::gelqf( layout, m, n, A, lda, tau );
+}
+
 }  // namespace lapack
@@ -23,45 +23,18 @@ int64_t gels(
     float* A, int64_t lda,
     float* B, int64_t ldb )
 {
-    // for real, map ConjTrans to Trans
-    if (trans == Op::ConjTrans)
-        trans = Op::Trans;
-
-    char trans_ = to_char( trans );
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int nrhs_ = to_lapack_int( nrhs );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int ldb_ = to_lapack_int( ldb );
-    lapack_int info_ = 0;
-
     // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgels(
-        &trans_, &m_, &n_, &nrhs_,
-        A, &lda_,
-        B, &ldb_,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork;
+    gels_work_size(
+        trans, m, n, nrhs, A, lda, B, ldb,
+        &lwork );
 
     // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    lapack::vector< float > work( lwork );
 
-    LAPACK_sgels(
-        &trans_, &m_, &n_, &nrhs_,
-        A, &lda_,
-        B, &ldb_,
-        &work[0], &lwork_, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return gels(
+        trans, m, n, nrhs, A, lda, B, ldb,
+        &work[0], lwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -71,45 +44,18 @@ int64_t gels(
     double* A, int64_t lda,
     double* B, int64_t ldb )
 {
-    // for real, map ConjTrans to Trans
-    if (trans == Op::ConjTrans)
-        trans = Op::Trans;
-
-    char trans_ = to_char( trans );
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int nrhs_ = to_lapack_int( nrhs );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int ldb_ = to_lapack_int( ldb );
-    lapack_int info_ = 0;
-
     // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgels(
-        &trans_, &m_, &n_, &nrhs_,
-        A, &lda_,
-        B, &ldb_,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork;
+    gels_work_size(
+        trans, m, n, nrhs, A, lda, B, ldb,
+        &lwork );
 
     // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    lapack::vector< double > work( lwork );
 
-    LAPACK_dgels(
-        &trans_, &m_, &n_, &nrhs_,
-        A, &lda_,
-        B, &ldb_,
-        &work[0], &lwork_, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return gels(
+        trans, m, n, nrhs, A, lda, B, ldb,
+        &work[0], lwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -119,41 +65,18 @@ int64_t gels(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb )
 {
-    char trans_ = to_char( trans );
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int nrhs_ = to_lapack_int( nrhs );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int ldb_ = to_lapack_int( ldb );
-    lapack_int info_ = 0;
-
     // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cgels(
-        &trans_, &m_, &n_, &nrhs_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork;
+    gels_work_size(
+        trans, m, n, nrhs, A, lda, B, ldb,
+        &lwork );
 
     // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+    lapack::vector< std::complex<float> > work( lwork );
 
-    LAPACK_cgels(
-        &trans_, &m_, &n_, &nrhs_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_,
-        (lapack_complex_float*) &work[0], &lwork_, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return gels(
+        trans, m, n, nrhs, A, lda, B, ldb,
+        &work[0], lwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -253,6 +176,162 @@ int64_t gels(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* B, int64_t ldb )
 {
+    // query for workspace size
+    int64_t lwork;
+    gels_work_size(
+        trans, m, n, nrhs, A, lda, B, ldb,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+
+    return gels(
+        trans, m, n, nrhs, A, lda, B, ldb,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+void gels_work_size(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "sgels", trans, m, n, nrhs, lda, ldb );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    // for real, map ConjTrans to Trans
+    if (trans == Op::ConjTrans)
+        trans = Op::Trans;
+
+    char trans_ = to_char( trans );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int info_ = 0;
+
+    float qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_sgels(
+        &trans_, &m_, &n_, &nrhs_,
+        A, &lda_,
+        B, &ldb_,
+        qry_work, &ineg_one, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+void gels_work_size(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "dgels", trans, m, n, nrhs, lda, ldb );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    // for real, map ConjTrans to Trans
+    if (trans == Op::ConjTrans)
+        trans = Op::Trans;
+
+    char trans_ = to_char( trans );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int info_ = 0;
+
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dgels(
+        &trans_, &m_, &n_, &nrhs_,
+        A, &lda_,
+        B, &ldb_,
+        qry_work, &ineg_one, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+void gels_work_size(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "cgels", trans, m, n, nrhs, lda, ldb );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    char trans_ = to_char( trans );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int info_ = 0;
+
+    std::complex<float> qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_cgels(
+        &trans_, &m_, &n_, &nrhs_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) B, &ldb_,
+        (lapack_complex_float*) qry_work, &ineg_one, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::gels with caller-provided workspace.
+/// Returns the array lengths that the workspace overload of `gels`
+/// requires, so the workspace can be allocated once, outside a loop.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// Other arguments are the same as for lapack::gels.
+/// Arrays are used only to select the precision and are not referenced.
+///
+/// @param[out] lwork
+///     The optimal length of the array work.
+///
+/// @ingroup gels
+void gels_work_size(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "zgels", trans, m, n, nrhs, lda, ldb );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     char trans_ = to_char( trans );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -261,7 +340,6 @@ int64_t gels(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
 
-    // query for workspace size
     std::complex<double> qry_work[1];
     lapack_int ineg_one = -1;
     LAPACK_zgels(
@@ -273,16 +351,147 @@ int64_t gels(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gels(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* work, int64_t lwork )
+{
+    // for real, map ConjTrans to Trans
+    if (trans == Op::ConjTrans)
+        trans = Op::Trans;
+
+    char trans_ = to_char( trans );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gels", float, m, n, 0, nrhs, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+
+    LAPACK_sgels(
+        &trans_, &m_, &n_, &nrhs_,
+        A, &lda_,
+        B, &ldb_,
+        work, &lwork_, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gels(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* work, int64_t lwork )
+{
+    // for real, map ConjTrans to Trans
+    if (trans == Op::ConjTrans)
+        trans = Op::Trans;
+
+    char trans_ = to_char( trans );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gels", double, m, n, 0, nrhs, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+
+    LAPACK_dgels(
+        &trans_, &m_, &n_, &nrhs_,
+        A, &lda_,
+        B, &ldb_,
+        work, &lwork_, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gels(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* work, int64_t lwork )
+{
+    char trans_ = to_char( trans );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gels", std::complex<float>, m, n, 0, nrhs, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+
+    LAPACK_cgels(
+        &trans_, &m_, &n_, &nrhs_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) B, &ldb_,
+        (lapack_complex_float*) work, &lwork_, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::gels that takes caller-provided workspace
+/// instead of querying and allocating it on each call.
+/// Use lapack::gels_work_size to get the required lengths.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// Other arguments are the same as for lapack::gels.
+///
+/// @param[out] work
+///     The vector work of length lwork. Workspace.
+///
+/// @param[in] lwork
+///     The length of the array work.
+///     Use the value from lapack::gels_work_size for best performance.
+///
+/// @ingroup gels
+int64_t gels(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* work, int64_t lwork )
+{
+    char trans_ = to_char( trans );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gels", std::complex<double>, m, n, 0, nrhs, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
     LAPACK_zgels(
         &trans_, &m_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
         (lapack_complex_double*) B, &ldb_,
-        (lapack_complex_double*) &work[0], &lwork_, &info_
+        (lapack_complex_double*) work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
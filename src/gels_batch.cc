@@ -0,0 +1,454 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "lapack/fortran.h"
+#include "NoConstructAllocator.hh"
+
+namespace lapack {
+
+using blas::max;
+using blas::is_complex_v;
+
+//==============================================================================
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, float version.
+/// @ingroup gels_batch_internal
+inline void gels(
+    char trans, lapack_int m, lapack_int n, lapack_int nrhs,
+    float* A, lapack_int lda,
+    float* B, lapack_int ldb,
+    float* work, lapack_int lwork,
+    lapack_int* info )
+{
+    LAPACK_sgels(
+        &trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, double version.
+/// @ingroup gels_batch_internal
+inline void gels(
+    char trans, lapack_int m, lapack_int n, lapack_int nrhs,
+    double* A, lapack_int lda,
+    double* B, lapack_int ldb,
+    double* work, lapack_int lwork,
+    lapack_int* info )
+{
+    LAPACK_dgels(
+        &trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, complex<float> version.
+/// @ingroup gels_batch_internal
+inline void gels(
+    char trans, lapack_int m, lapack_int n, lapack_int nrhs,
+    std::complex<float>* A, lapack_int lda,
+    std::complex<float>* B, lapack_int ldb,
+    std::complex<float>* work, lapack_int lwork,
+    lapack_int* info )
+{
+    LAPACK_cgels(
+        &trans, &m, &n, &nrhs,
+        (lapack_complex_float*) A, &lda,
+        (lapack_complex_float*) B, &ldb,
+        (lapack_complex_float*) work, &lwork, info );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, complex<double> version.
+/// @ingroup gels_batch_internal
+inline void gels(
+    char trans, lapack_int m, lapack_int n, lapack_int nrhs,
+    std::complex<double>* A, lapack_int lda,
+    std::complex<double>* B, lapack_int ldb,
+    std::complex<double>* work, lapack_int lwork,
+    lapack_int* info )
+{
+    LAPACK_zgels(
+        &trans, &m, &n, &nrhs,
+        (lapack_complex_double*) A, &lda,
+        (lapack_complex_double*) B, &ldb,
+        (lapack_complex_double*) work, &lwork, info );
+}
+
+}  // namespace internal
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks and converts arguments once,
+/// queries workspace once for the largest problem, then solves each
+/// problem in parallel, with one workspace per thread.
+/// m(i), n(i), nrhs(i), lda(i), ldb(i) return the dimensions of the
+/// i-th problem, and Aarray(i), Barray(i) return pointers to its data.
+/// @ingroup gels_batch_internal
+///
+template <typename scalar_t, typename dim_t,
+          typename Aarray_t, typename Barray_t>
+void gels_batch(
+    lapack::Op trans, dim_t m, dim_t n, dim_t nrhs,
+    Aarray_t Aarray, dim_t lda,
+    Barray_t Barray, dim_t ldb,
+    int64_t batch_count, int64_t* info )
+{
+    // for real, map ConjTrans to Trans
+    if constexpr (! is_complex_v< scalar_t >) {
+        if (trans == Op::ConjTrans)
+            trans = Op::Trans;
+    }
+    else {
+        lapack_error_if( trans == Op::Trans );
+    }
+    lapack_error_if( trans != Op::NoTrans && trans != Op::Trans
+                     && trans != Op::ConjTrans );
+    lapack_error_if( batch_count < 0 );
+
+    int64_t m_max = 0, n_max = 0, nrhs_max = 0, lda_max = 1, ldb_max = 1;
+    for (int64_t i = 0; i < batch_count; ++i) {
+        lapack_error_if( m( i ) < 0 );
+        lapack_error_if( n( i ) < 0 );
+        lapack_error_if( nrhs( i ) < 0 );
+        lapack_error_if( lda( i ) < max( 1, m( i ) ) );
+        lapack_error_if( ldb( i ) < max( 1, m( i ), n( i ) ) );
+        m_max    = max( m_max,    m( i ) );
+        n_max    = max( n_max,    n( i ) );
+        nrhs_max = max( nrhs_max, nrhs( i ) );
+        lda_max  = max( lda_max,  lda( i ) );
+        ldb_max  = max( ldb_max,  ldb( i ) );
+    }
+    // After these, all dimensions fit in lapack_int.
+    to_lapack_int( m_max );
+    to_lapack_int( n_max );
+    to_lapack_int( nrhs_max );
+    to_lapack_int( lda_max );
+    to_lapack_int( ldb_max );
+
+    char trans_ = to_char( trans );
+
+    // One query for the largest problem; gels's lwork grows with
+    // m, n, and nrhs.
+    int64_t lwork;
+    gels_work_size( trans, m_max, n_max, nrhs_max,
+                    (scalar_t*) nullptr, max( 1, m_max ),
+                    (scalar_t*) nullptr, max( 1, m_max, n_max ), &lwork );
+    lapack_int lwork_ = to_lapack_int( lwork );
+
+    #pragma omp parallel if (batch_count > 1)
+    {
+        lapack::vector< scalar_t > work( max( 1, lwork ) );
+
+        #pragma omp for schedule( dynamic, 1 )
+        for (int64_t i = 0; i < batch_count; ++i) {
+            lapack_int info_ = 0;
+            internal::gels(
+                trans_, lapack_int( m( i ) ), lapack_int( n( i ) ),
+                lapack_int( nrhs( i ) ),
+                Aarray( i ), lapack_int( lda( i ) ),
+                Barray( i ), lapack_int( ldb( i ) ),
+                &work[0], lwork_, &info_ );
+            info[ i ] = info_;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Strided version: A_i is A + i*strideA, B_i is B + i*strideB.
+/// @ingroup gels_batch_internal
+///
+template <typename scalar_t>
+void gels_batch(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    scalar_t* A, int64_t lda, int64_t strideA,
+    scalar_t* B, int64_t ldb, int64_t strideB,
+    int64_t batch_count, int64_t* info )
+{
+    if (batch_count > 1) {
+        lapack_error_if( strideA < lda*n );
+        lapack_error_if( strideB < ldb*nrhs );
+    }
+
+    gels_batch< scalar_t >(
+        trans, internal::batch_value{ m }, internal::batch_value{ n },
+        internal::batch_value{ nrhs },
+        [=]( int64_t i ) { return A + i*strideA; },
+        internal::batch_value{ lda },
+        [=]( int64_t i ) { return B + i*strideB; },
+        internal::batch_value{ ldb },
+        batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// Pointer-array version: A_i is Aarray[ i ], B_i is Barray[ i ].
+/// @ingroup gels_batch_internal
+///
+template <typename scalar_t>
+void gels_batch(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    scalar_t* const* Aarray, int64_t lda,
+    scalar_t* const* Barray, int64_t ldb,
+    int64_t batch_count, int64_t* info )
+{
+    gels_batch< scalar_t >(
+        trans, internal::batch_value{ m }, internal::batch_value{ n },
+        internal::batch_value{ nrhs },
+        [=]( int64_t i ) { return Aarray[ i ]; },
+        internal::batch_value{ lda },
+        [=]( int64_t i ) { return Barray[ i ]; },
+        internal::batch_value{ ldb },
+        batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// Variable-size version: A_i is m[ i ]-by-n[ i ],
+/// B_i has nrhs[ i ] columns.
+/// @ingroup gels_batch_internal
+///
+template <typename scalar_t>
+void gels_vbatch(
+    lapack::Op trans,
+    int64_t const* m, int64_t const* n, int64_t const* nrhs,
+    scalar_t* const* Aarray, int64_t const* lda,
+    scalar_t* const* Barray, int64_t const* ldb,
+    int64_t batch_count, int64_t* info )
+{
+    gels_batch< scalar_t >(
+        trans, internal::batch_array{ m }, internal::batch_array{ n },
+        internal::batch_array{ nrhs },
+        [=]( int64_t i ) { return Aarray[ i ]; },
+        internal::batch_array{ lda },
+        [=]( int64_t i ) { return Barray[ i ]; },
+        internal::batch_array{ ldb },
+        batch_count, info );
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// @ingroup gels_batch
+void gels_batch(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda, int64_t strideA,
+    float* B, int64_t ldb, int64_t strideB,
+    int64_t batch_count, int64_t* info )
+{
+    impl::gels_batch( trans, m, n, nrhs, A, lda, strideA, B, ldb, strideB,
+                      batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gels_batch
+void gels_batch(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda, int64_t strideA,
+    double* B, int64_t ldb, int64_t strideB,
+    int64_t batch_count, int64_t* info )
+{
+    impl::gels_batch( trans, m, n, nrhs, A, lda, strideA, B, ldb, strideB,
+                      batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gels_batch
+void gels_batch(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_count, int64_t* info )
+{
+    impl::gels_batch( trans, m, n, nrhs, A, lda, strideA, B, ldb, strideB,
+                      batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// Solves a batch of overdetermined or underdetermined systems
+/// $op(A_i) X_i = B_i$, using a QR or LQ factorization of each A_i,
+/// as in lapack::gels. A_i is assumed to have full rank.
+/// Problems are solved in parallel using OpenMP. The workspace size
+/// is queried once for the batch, and each thread allocates one
+/// workspace that it reuses for all its problems.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`,
+/// for strided storage (shown here), pointer-array storage:
+///
+///     gels_batch( trans, m, n, nrhs, Aarray, lda, Barray, ldb,
+///                 batch_count, info )
+///
+/// and variable-size pointer-array storage, where A_i is
+/// m[ i ]-by-n[ i ] and B_i has nrhs[ i ] columns, with leading
+/// dimensions lda[ i ] and ldb[ i ]:
+///
+///     gels_vbatch( trans, m, n, nrhs, Aarray, lda, Barray, ldb,
+///                  batch_count, info )
+///
+/// @param[in] trans
+///     - lapack::Op::NoTrans:   A_i is not transposed;
+///     - lapack::Op::Trans:     A_i is transposed (real only);
+///     - lapack::Op::ConjTrans: A_i is conjugate transposed.
+///
+/// @param[in] m
+///     The number of rows of each matrix A_i. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of each matrix A_i. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of
+///     columns of each matrix B_i. nrhs >= 0.
+///
+/// @param[in,out] A
+///     The batch of m-by-n matrices, each stored in an lda-by-n array,
+///     with A_i starting at A + i*strideA.
+///     On exit, A_i is overwritten by its QR or LQ factorization,
+///     as in lapack::gels.
+///
+/// @param[in] lda
+///     The leading dimension of each A_i. lda >= max(1,m).
+///
+/// @param[in] strideA
+///     Distance between the starts of consecutive A_i. strideA >= lda*n.
+///
+/// @param[in,out] B
+///     The batch of right hand side matrices, each stored in an
+///     ldb-by-nrhs array, with B_i starting at B + i*strideB.
+///     On exit, B_i is overwritten by the solution X_i, as in lapack::gels.
+///
+/// @param[in] ldb
+///     The leading dimension of each B_i. ldb >= max(1,m,n).
+///
+/// @param[in] strideB
+///     Distance between the starts of consecutive B_i.
+///     strideB >= ldb*nrhs.
+///
+/// @param[in] batch_count
+///     The number of problems. batch_count >= 0.
+///
+/// @param[out] info
+///     The vector info of length batch_count.
+///     - info[ i ] = 0: successful exit.
+///     - info[ i ] > 0: the info[ i ]-th diagonal element of the
+///       triangular factor of A_i is zero, so A_i does not have full
+///       rank; the least squares solution could not be computed.
+///
+/// Invalid arguments throw lapack::Error.
+///
+/// @ingroup gels_batch
+void gels_batch(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_count, int64_t* info )
+{
+    impl::gels_batch( trans, m, n, nrhs, A, lda, strideA, B, ldb, strideB,
+                      batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gels_batch
+void gels_batch(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    float* const* Aarray, int64_t lda,
+    float* const* Barray, int64_t ldb,
+    int64_t batch_count, int64_t* info )
+{
+    impl::gels_batch( trans, m, n, nrhs, Aarray, lda, Barray, ldb,
+                      batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gels_batch
+void gels_batch(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    double* const* Aarray, int64_t lda,
+    double* const* Barray, int64_t ldb,
+    int64_t batch_count, int64_t* info )
+{
+    impl::gels_batch( trans, m, n, nrhs, Aarray, lda, Barray, ldb,
+                      batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gels_batch
+void gels_batch(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* const* Aarray, int64_t lda,
+    std::complex<float>* const* Barray, int64_t ldb,
+    int64_t batch_count, int64_t* info )
+{
+    impl::gels_batch( trans, m, n, nrhs, Aarray, lda, Barray, ldb,
+                      batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gels_batch
+void gels_batch(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* const* Aarray, int64_t lda,
+    std::complex<double>* const* Barray, int64_t ldb,
+    int64_t batch_count, int64_t* info )
+{
+    impl::gels_batch( trans, m, n, nrhs, Aarray, lda, Barray, ldb,
+                      batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gels_batch
+void gels_vbatch(
+    lapack::Op trans,
+    int64_t const* m, int64_t const* n, int64_t const* nrhs,
+    float* const* Aarray, int64_t const* lda,
+    float* const* Barray, int64_t const* ldb,
+    int64_t batch_count, int64_t* info )
+{
+    impl::gels_vbatch( trans, m, n, nrhs, Aarray, lda, Barray, ldb,
+                       batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gels_batch
+void gels_vbatch(
+    lapack::Op trans,
+    int64_t const* m, int64_t const* n, int64_t const* nrhs,
+    double* const* Aarray, int64_t const* lda,
+    double* const* Barray, int64_t const* ldb,
+    int64_t batch_count, int64_t* info )
+{
+    impl::gels_vbatch( trans, m, n, nrhs, Aarray, lda, Barray, ldb,
+                       batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gels_batch
+void gels_vbatch(
+    lapack::Op trans,
+    int64_t const* m, int64_t const* n, int64_t const* nrhs,
+    std::complex<float>* const* Aarray, int64_t const* lda,
+    std::complex<float>* const* Barray, int64_t const* ldb,
+    int64_t batch_count, int64_t* info )
+{
+    impl::gels_vbatch( trans, m, n, nrhs, Aarray, lda, Barray, ldb,
+                       batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gels_batch
+void gels_vbatch(
+    lapack::Op trans,
+    int64_t const* m, int64_t const* n, int64_t const* nrhs,
+    std::complex<double>* const* Aarray, int64_t const* lda,
+    std::complex<double>* const* Barray, int64_t const* ldb,
+    int64_t batch_count, int64_t* info )
+{
+    impl::gels_vbatch( trans, m, n, nrhs, Aarray, lda, Barray, ldb,
+                       batch_count, info );
+}
+
+}  // namespace lapack
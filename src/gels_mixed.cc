@@ -0,0 +1,282 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "mixed_refine.hh"
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+using blas::real;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks arguments, factors A in the inner
+/// precision, refines each column of X on the normal equations
+/// A^H A x = A^H b, preconditioned by R^H R, and falls back to
+/// gels in working precision if needed.
+/// @ingroup gels
+///
+template <typename scalar_t>
+int64_t gels_mixed(
+    int64_t m, int64_t n, int64_t nrhs,
+    scalar_t const* A, int64_t lda,
+    scalar_t const* B, int64_t ldb,
+    scalar_t* X, int64_t ldx,
+    RefineOptions const& opts,
+    RefineInfo* rinfo )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using inner_t = internal::inner_t< scalar_t >;
+
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 || n > m );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+    lapack_error_if( ldb < max( 1, m ) );
+    lapack_error_if( ldx < max( 1, n ) );
+    lapack_error_if( opts.max_iter < 0 );
+    lapack_error_if( opts.gmres_max_iter < 1 );
+
+    RefineInfo rinfo_local;
+    if (rinfo == nullptr)
+        rinfo = &rinfo_local;
+    *rinfo = RefineInfo();
+
+    if (n == 0 || nrhs == 0) {
+        lapack::laset( MatrixType::General, n, nrhs, 0.0, 0.0, X, ldx );
+        rinfo->converged = true;
+        return 0;
+    }
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = (opts.tol > 0 ? real_t( opts.tol ) : std::sqrt( real_t( m ) ) * eps);
+    real_t Anorm_one = lapack::lange( Norm::One, m, n, A, lda );
+    real_t Anorm_inf = lapack::lange( Norm::Inf, m, n, A, lda );
+
+    // Factor s A = Q R in the inner precision.
+    real_t s = internal::inner_scale( opts.precision,
+                                      lapack::lange( Norm::Max, m, n, A, lda ) );
+    lapack::vector< inner_t > QR( m*n ), tau( n ), w( m );
+    lapack::vector< scalar_t > t( m );
+    int64_t iter = 0;
+    if (! internal::to_inner( opts.precision, Uplo::General, m, n,
+                              A, lda, s, &QR[0], m )) {
+        iter = -2;
+    }
+    else {
+        lapack::geqrf( m, n, &QR[0], m, &tau[0] );
+        bool singular = false;
+        for (int64_t i = 0; i < n; ++i)
+            singular = singular || QR[ i + i*m ] == inner_t( 0 );
+        if (singular || ! internal::round_inner( opts.precision, Uplo::Upper,
+                                                 n, n, &QR[0], m )) {
+            iter = -3;
+        }
+    }
+
+    if (iter == 0) {
+        // v = (A^H A)^{-1} v = s^2 (R^H R)^{-1} v, normalizing v to avoid
+        // overflow.
+        auto precond = [&]( scalar_t* v ) {
+            real_t vmax = lapack::lange( Norm::Max, n, 1, v, n );
+            if (vmax == 0)
+                return;
+            for (int64_t i = 0; i < n; ++i)
+                w[ i ] = inner_t( v[ i ] / vmax );
+            blas::trsv( Layout::ColMajor, Uplo::Upper, Op::ConjTrans,
+                        Diag::NonUnit, n, &QR[0], m, &w[0], 1 );
+            blas::trsv( Layout::ColMajor, Uplo::Upper, Op::NoTrans,
+                        Diag::NonUnit, n, &QR[0], m, &w[0], 1 );
+            for (int64_t i = 0; i < n; ++i)
+                v[ i ] = scalar_t( w[ i ] ) * (s * s * vmax);
+        };
+        auto op = [&]( scalar_t const* v, scalar_t* y ) {
+            blas::gemv( Layout::ColMajor, Op::NoTrans, m, n,
+                        1.0, A, lda, v, 1, 0.0, &t[0], 1 );
+            blas::gemv( Layout::ColMajor, Op::ConjTrans, m, n,
+                        1.0, A, lda, &t[0], 1, 0.0, y, 1 );
+        };
+        // r = A^H (b - A x), with scale || A ||_1 (|| A ||_inf || x ||_inf
+        // + || b ||_inf), since A^H r cannot be smaller than about
+        // eps || A || || b - A x || when the residual is large.
+        auto residual = [&]( int64_t j, scalar_t const* x, scalar_t* r ) {
+            scalar_t const* b = &B[ j*ldb ];
+            std::copy( b, b + m, &t[0] );
+            blas::gemv( Layout::ColMajor, Op::NoTrans, m, n,
+                        -1.0, A, lda, x, 1, 1.0, &t[0], 1 );
+            blas::gemv( Layout::ColMajor, Op::ConjTrans, m, n,
+                        1.0, A, lda, &t[0], 1, 0.0, r, 1 );
+            return Anorm_one * (Anorm_inf * lapack::lange( Norm::Max, n, 1, x, n )
+                                + lapack::lange( Norm::Max, m, 1, b, m ));
+        };
+
+        // Initial x = s R^{-1} Q^H b, in the inner precision.
+        for (int64_t j = 0; j < nrhs; ++j) {
+            scalar_t const* b = &B[ j*ldb ];
+            scalar_t* x = &X[ j*ldx ];
+            real_t bmax = lapack::lange( Norm::Max, m, 1, b, m );
+            if (bmax == 0) {
+                std::fill( x, x + n, scalar_t( 0 ) );
+                continue;
+            }
+            for (int64_t i = 0; i < m; ++i)
+                w[ i ] = inner_t( b[ i ] / bmax );
+            lapack::unmqr( Side::Left, Op::ConjTrans, m, 1, n,
+                           &QR[0], m, &tau[0], &w[0], m );
+            blas::trsv( Layout::ColMajor, Uplo::Upper, Op::NoTrans,
+                        Diag::NonUnit, n, &QR[0], m, &w[0], 1 );
+            for (int64_t i = 0; i < n; ++i)
+                x[ i ] = scalar_t( w[ i ] ) * (s * bmax);
+        }
+        iter = internal::refine_columns( opts, n, nrhs, X, ldx, tol,
+                                         residual, op, precond, rinfo );
+    }
+    rinfo->iter = iter;
+
+    if (iter >= 0 || (iter == -31 && ! opts.fallback))
+        return 0;
+
+    // Fall back to working precision.
+    lapack::vector< scalar_t > A_work( m*n ), B_work( m*nrhs );
+    lapack::lacpy( MatrixType::General, m, n, A, lda, &A_work[0], m );
+    lapack::lacpy( MatrixType::General, m, nrhs, B, ldb, &B_work[0], m );
+    int64_t info = lapack::gels( Op::NoTrans, m, n, nrhs,
+                                 &A_work[0], m, &B_work[0], m );
+    if (info == 0)
+        lapack::lacpy( MatrixType::General, n, nrhs, &B_work[0], m, X, ldx );
+    return info;
+}
+
+}  // namespace impl
+
+//==============================================================================
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gels_mixed(
+    int64_t m, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    RefineOptions const& opts,
+    RefineInfo* rinfo )
+{
+    return impl::gels_mixed( m, n, nrhs, A, lda, B, ldb, X, ldx, opts, rinfo );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gels_mixed(
+    int64_t m, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    RefineOptions const& opts,
+    RefineInfo* rinfo )
+{
+    return impl::gels_mixed( m, n, nrhs, A, lda, B, ldb, X, ldx, opts, rinfo );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gels_mixed(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    RefineOptions const& opts,
+    RefineInfo* rinfo )
+{
+    return impl::gels_mixed( m, n, nrhs, A, lda, B, ldb, X, ldx, opts, rinfo );
+}
+
+// -----------------------------------------------------------------------------
+/// Solves the overdetermined least squares problem
+/// \[
+///     \min_X || B - A X ||_2,
+/// \]
+/// where A is an m-by-n matrix, m >= n, of full rank, using a QR
+/// factorization in a lower inner precision with iterative refinement
+/// in working precision.
+///
+/// Refinement is on the normal equations $A^H A x = A^H b$, with the
+/// residual $A^H (b - A x)$ computed in working precision from the
+/// original A, and preconditioned by $R^H R$ from the inner QR factors,
+/// which makes the preconditioned system well conditioned when
+/// $\kappa(A) u_{inner} < 1$. This is the method of corrected
+/// semi-normal equations, with GMRES-IR for the corrections if
+/// opts.method = GMRES. As with any normal equations approach, the
+/// forward error can grow with $\kappa(A)^2$ when the residual is large;
+/// it matches lapack::gels when the residual is small.
+///
+/// If the inner factorization fails or refinement does not converge,
+/// lapack::gels is called in working precision; see RefineInfo::iter.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     The number of rows of the matrix A. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. m >= n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of
+///     columns of the matrices B and X. nrhs >= 0.
+///
+/// @param[in] A
+///     The m-by-n matrix A, stored in an lda-by-n array.
+///     A is not modified.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,m).
+///
+/// @param[in] B
+///     The m-by-nrhs right hand side matrix B, stored in an ldb-by-nrhs array.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= max(1,m).
+///
+/// @param[out] X
+///     The n-by-nrhs matrix X, stored in an ldx-by-nrhs array.
+///     If return value = 0, the least squares solution X.
+///
+/// @param[in] ldx
+///     The leading dimension of the array X. ldx >= max(1,n).
+///
+/// @param[in] opts
+///     Inner precision, refinement method, tolerance, and limits;
+///     see lapack::RefineOptions. The default tolerance is
+///     sqrt(m) times working precision epsilon.
+///
+/// @param[out] rinfo
+///     If not null, the number of refinement steps and GMRES iterations,
+///     whether refinement converged, and the final backward error
+///     of the normal equations; see lapack::RefineInfo.
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, the i-th diagonal element of the
+///     triangular factor of A, computed in working precision, is zero,
+///     so that A does not have full rank; the least squares solution
+///     could not be computed.
+///
+/// @ingroup gels
+int64_t gels_mixed(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    RefineOptions const& opts,
+    RefineInfo* rinfo )
+{
+    return impl::gels_mixed( m, n, nrhs, A, lda, B, ldb, X, ldx, opts, rinfo );
+}
+
+}  // namespace lapack
@@ -0,0 +1,342 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+
+#if ! defined( _WIN32 )
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+using blas::real;
+
+//==============================================================================
+// MappedMatrix
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+MappedMatrix< scalar_t >::MappedMatrix(
+    std::string const& path, int64_t m, int64_t n )
+    : data_( nullptr ),
+      m_( m ),
+      n_( n ),
+      bytes_( 0 ),
+      released_( max( 0, n ), 0 )
+{
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+
+#if defined( _WIN32 )
+    throw Error( "memory-mapped files require POSIX mmap", __func__ );
+#else
+    int fd = open( path.c_str(), O_RDONLY );
+    lapack_error_if_msg( fd < 0, "cannot open %s: %s",
+                         path.c_str(), strerror( errno ) );
+
+    bytes_ = std::size_t( m ) * std::size_t( n ) * sizeof( scalar_t );
+    struct stat st;
+    bool ok = (fstat( fd, &st ) == 0);
+    int err = errno;  // before close changes it
+    std::size_t file_bytes = ok ? std::size_t( st.st_size ) : 0;
+    if (! ok || file_bytes != bytes_)
+        close( fd );
+    lapack_error_if_msg( ! ok, "cannot stat %s: %s",
+                         path.c_str(), strerror( err ) );
+    lapack_error_if_msg( file_bytes != bytes_,
+                         "%s has %lld bytes, expected m*n*%lld = %lld",
+                         path.c_str(), llong( file_bytes ),
+                         llong( sizeof( scalar_t ) ), llong( bytes_ ) );
+
+    if (bytes_ > 0) {
+        void* ptr = mmap( nullptr, bytes_, PROT_READ, MAP_SHARED, fd, 0 );
+        err = errno;
+        close( fd );
+        lapack_error_if_msg( ptr == MAP_FAILED, "cannot map %s: %s",
+                             path.c_str(), strerror( err ) );
+        data_ = static_cast< scalar_t const* >( ptr );
+    }
+    else {
+        close( fd );
+    }
+#endif
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+MappedMatrix< scalar_t >::~MappedMatrix()
+{
+#if ! defined( _WIN32 )
+    if (data_ != nullptr)
+        munmap( const_cast< scalar_t* >( data_ ), bytes_ );
+#endif
+}
+
+//------------------------------------------------------------------------------
+/// Pages that straddle two columns hold rows near m of one column and
+/// rows near 0 of the next, so only pages wholly inside rows [0, i) of a
+/// column are released.
+template <typename scalar_t>
+void MappedMatrix< scalar_t >::release_rows( int64_t i ) const
+{
+#if ! defined( _WIN32 )
+    i = min( max( i, 0 ), m_ );
+    if (data_ == nullptr || i == 0)
+        return;
+
+    std::size_t page = sysconf( _SC_PAGESIZE );
+    char* base = (char*) const_cast< scalar_t* >( data_ );
+    std::size_t col_bytes = std::size_t( m_ ) * sizeof( scalar_t );
+    for (int64_t j = 0; j < n_; ++j) {
+        std::size_t col = j * col_bytes;
+        std::size_t begin = max( (col + page - 1) / page * page, released_[ j ] );
+        std::size_t end = (col + i * sizeof( scalar_t )) / page * page;
+        if (begin < end) {
+            madvise( base + begin, end - begin, MADV_DONTNEED );
+            released_[ j ] = end;
+        }
+    }
+#endif
+}
+
+template class MappedMatrix< float >;
+template class MappedMatrix< double >;
+template class MappedMatrix< std::complex<float> >;
+template class MappedMatrix< std::complex<double> >;
+
+#if LAPACK_VERSION >= 30400  // >= 3.4
+
+//==============================================================================
+// GelsStream
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+GelsStream< scalar_t >::GelsStream( int64_t n, int64_t nrhs, int64_t mb )
+    : n_( n ),
+      nrhs_( nrhs ),
+      mb_( mb ),
+      ib_( max( 1, min( n, 32 ) ) ),
+      ldr_( max( 1, n ) ),
+      rows_( 0 )
+{
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( mb < 1 );
+
+    R_.resize( ldr_ * n_ );
+    D_.resize( ldr_ * nrhs_ );
+    Ablk_.resize( mb_ * n_ );
+    Bblk_.resize( mb_ * nrhs_ );
+    T_.resize( ib_ * n_ );
+    scale_.resize( nrhs_ );
+    sumsq_.resize( nrhs_ );
+    reset();
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void GelsStream< scalar_t >::reset()
+{
+    std::fill( R_.begin(), R_.end(), scalar_t( 0 ) );
+    std::fill( D_.begin(), D_.end(), scalar_t( 0 ) );
+    std::fill( scale_.begin(), scale_.end(), real_t( 0 ) );
+    std::fill( sumsq_.begin(), sumsq_.end(), real_t( 1 ) );
+    rows_ = 0;
+}
+
+//------------------------------------------------------------------------------
+/// Each chunk of up to mb rows is copied, since tpqrt overwrites it with
+/// Householder vectors, then [ R; A_i ] is factored with l = 0 (A_i is
+/// rectangular) and Q_i^H is applied to [ D; B_i ].
+template <typename scalar_t>
+void GelsStream< scalar_t >::push(
+    int64_t m,
+    scalar_t const* A, int64_t lda,
+    scalar_t const* B, int64_t ldb )
+{
+    lapack_error_if( m < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+    lapack_error_if( ldb < max( 1, m ) );
+
+    for (int64_t i = 0; i < m; i += mb_) {
+        int64_t mi = min( mb_, m - i );
+        lapack::lacpy( MatrixType::General, mi, n_, &A[ i ], lda,
+                       Ablk_.data(), mb_ );
+        lapack::lacpy( MatrixType::General, mi, nrhs_, &B[ i ], ldb,
+                       Bblk_.data(), mb_ );
+        if (n_ > 0) {
+            lapack::tpqrt( mi, n_, 0, ib_, R_.data(), ldr_,
+                           Ablk_.data(), mb_, T_.data(), ib_ );
+            if (nrhs_ > 0) {
+                lapack::tpmqrt( Side::Left, Op::ConjTrans,
+                                mi, nrhs_, n_, 0, ib_,
+                                Ablk_.data(), mb_, T_.data(), ib_,
+                                D_.data(), ldr_, Bblk_.data(), mb_ );
+            }
+        }
+        for (int64_t j = 0; j < nrhs_; ++j) {
+            lapack::lassq( mi, &Bblk_[ j*mb_ ], 1, &scale_[ j ], &sumsq_[ j ] );
+        }
+    }
+    rows_ += m;
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+int64_t GelsStream< scalar_t >::solve( scalar_t* X, int64_t ldx ) const
+{
+    lapack_error_if( ldx < max( 1, n_ ) );
+
+    lapack::lacpy( MatrixType::General, n_, nrhs_, D_.data(), ldr_, X, ldx );
+    return lapack::trtrs( Uplo::Upper, Op::NoTrans, Diag::NonUnit,
+                          n_, nrhs_, R_.data(), ldr_, X, ldx );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void GelsStream< scalar_t >::residual_norms( real_t* rnorm ) const
+{
+    for (int64_t j = 0; j < nrhs_; ++j) {
+        rnorm[ j ] = scale_[ j ] * std::sqrt( sumsq_[ j ] );
+    }
+}
+
+template class GelsStream< float >;
+template class GelsStream< double >;
+template class GelsStream< std::complex<float> >;
+template class GelsStream< std::complex<double> >;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks arguments, then streams mb rows at
+/// a time from the mapped files, releasing their pages once folded.
+/// @ingroup gels
+///
+template <typename scalar_t>
+int64_t gels_stream(
+    MappedMatrix< scalar_t > const& A,
+    MappedMatrix< scalar_t > const& B,
+    scalar_t* X, int64_t ldx,
+    int64_t mb )
+{
+    int64_t m = A.m();
+    int64_t n = A.n();
+    int64_t nrhs = B.n();
+
+    lapack_error_if( B.m() != m );
+    lapack_error_if( ldx < max( 1, n ) );
+    lapack_error_if( mb < 1 );
+
+    mb = min( mb, max( 1, m ) );
+    GelsStream< scalar_t > ls( n, nrhs, mb );
+    for (int64_t i = 0; i < m; i += mb) {
+        int64_t mi = min( mb, m - i );
+        ls.push( mi, &A.data()[ i ], A.ld(), &B.data()[ i ], B.ld() );
+        A.release_rows( i + mi );
+        B.release_rows( i + mi );
+    }
+    return ls.solve( X, ldx );
+}
+
+}  // namespace impl
+
+//==============================================================================
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gels_stream(
+    MappedMatrix< float > const& A,
+    MappedMatrix< float > const& B,
+    float* X, int64_t ldx,
+    int64_t mb )
+{
+    return impl::gels_stream( A, B, X, ldx, mb );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gels_stream(
+    MappedMatrix< double > const& A,
+    MappedMatrix< double > const& B,
+    double* X, int64_t ldx,
+    int64_t mb )
+{
+    return impl::gels_stream( A, B, X, ldx, mb );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gels_stream(
+    MappedMatrix< std::complex<float> > const& A,
+    MappedMatrix< std::complex<float> > const& B,
+    std::complex<float>* X, int64_t ldx,
+    int64_t mb )
+{
+    return impl::gels_stream( A, B, X, ldx, mb );
+}
+
+// -----------------------------------------------------------------------------
+/// Solves the least squares problem
+/// \[
+///     \min_X || B - A X ||_2,
+/// \]
+/// for an m-by-n matrix A, m >= n, of full rank, where A and B are too
+/// large for memory and are read from column-major binary files mapped
+/// with lapack::MappedMatrix.
+///
+/// Rows are streamed mb at a time through lapack::GelsStream, which
+/// folds them into the R factor of A with tpqrt and tpmqrt. Pages of
+/// the files are released once their rows are folded, so memory use is
+/// O( n^2 + mb (n + nrhs) ), independent of m.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] A
+///     The m-by-n matrix A.
+///
+/// @param[in] B
+///     The m-by-nrhs right hand side matrix B.
+///
+/// @param[out] X
+///     The n-by-nrhs matrix X, stored in an ldx-by-nrhs array.
+///     On successful exit, the least squares solution.
+///
+/// @param[in] ldx
+///     The leading dimension of the array X. ldx >= max(1,n).
+///
+/// @param[in] mb
+///     The number of rows streamed at a time. mb >= 1.
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, the i-th diagonal element of the
+///     triangular factor of A is zero, so that A does not have full
+///     rank; the least squares solution could not be computed.
+///
+/// @ingroup gels
+int64_t gels_stream(
+    MappedMatrix< std::complex<double> > const& A,
+    MappedMatrix< std::complex<double> > const& B,
+    std::complex<double>* X, int64_t ldx,
+    int64_t mb )
+{
+    return impl::gels_stream( A, B, X, ldx, mb );
+}
+
+#endif  // LAPACK >= 3.4
+
+}  // namespace lapack
@@ -25,47 +25,19 @@ int64_t gelsd(
     float* S, float rcond,
     int64_t* rank )
 {
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int nrhs_ = to_lapack_int( nrhs );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int ldb_ = to_lapack_int( ldb );
-    lapack_int rank_ = 0;  // out
-    lapack_int info_ = 0;
-
     // query for workspace size
-    float qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgelsd(
-        &m_, &n_, &nrhs_,
-        A, &lda_,
-        B, &ldb_,
-        S, &rcond, &rank_,
-        qry_work, &ineg_one,
-        qry_iwork, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = qry_iwork[0];
+    int64_t lwork, liwork;
+    gelsd_work_size(
+        m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+        &lwork, &liwork );
 
     // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    lapack::vector< float > work( lwork );
+    lapack::vector< int64_t > iwork( liwork );
 
-    LAPACK_sgelsd(
-        &m_, &n_, &nrhs_,
-        A, &lda_,
-        B, &ldb_,
-        S, &rcond, &rank_,
-        &work[0], &lwork_,
-        &iwork[0], &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *rank = rank_;
-    return info_;
+    return gelsd(
+        m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+        &work[0], lwork, &iwork[0], liwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -77,47 +49,19 @@ int64_t gelsd(
     double* S, double rcond,
     int64_t* rank )
 {
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int nrhs_ = to_lapack_int( nrhs );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int ldb_ = to_lapack_int( ldb );
-    lapack_int rank_ = 0;  // out
-    lapack_int info_ = 0;
-
     // query for workspace size
-    double qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgelsd(
-        &m_, &n_, &nrhs_,
-        A, &lda_,
-        B, &ldb_,
-        S, &rcond, &rank_,
-        qry_work, &ineg_one,
-        qry_iwork, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = qry_iwork[0];
+    int64_t lwork, liwork;
+    gelsd_work_size(
+        m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+        &lwork, &liwork );
 
     // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    lapack::vector< double > work( lwork );
+    lapack::vector< int64_t > iwork( liwork );
 
-    LAPACK_dgelsd(
-        &m_, &n_, &nrhs_,
-        A, &lda_,
-        B, &ldb_,
-        S, &rcond, &rank_,
-        &work[0], &lwork_,
-        &iwork[0], &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *rank = rank_;
-    return info_;
+    return gelsd(
+        m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+        &work[0], lwork, &iwork[0], liwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -129,52 +73,20 @@ int64_t gelsd(
     float* S, float rcond,
     int64_t* rank )
 {
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int nrhs_ = to_lapack_int( nrhs );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int ldb_ = to_lapack_int( ldb );
-    lapack_int rank_ = 0;  // out
-    lapack_int info_ = 0;
-
     // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cgelsd(
-        &m_, &n_, &nrhs_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_,
-        S, &rcond, &rank_,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork,
-        qry_iwork, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = qry_rwork[0];
-    lapack_int liwork_ = qry_iwork[0];
+    int64_t lwork, lrwork, liwork;
+    gelsd_work_size(
+        m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+        &lwork, &lrwork, &liwork );
 
     // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+    lapack::vector< int64_t > iwork( liwork );
 
-    LAPACK_cgelsd(
-        &m_, &n_, &nrhs_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_,
-        S, &rcond, &rank_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0],
-        &iwork[0], &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *rank = rank_;
-    return info_;
+    return gelsd(
+        m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+        &work[0], lwork, &rwork[0], lrwork, &iwork[0], liwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -267,6 +179,182 @@ int64_t gelsd(
     double* S, double rcond,
     int64_t* rank )
 {
+    // query for workspace size
+    int64_t lwork, lrwork, liwork;
+    gelsd_work_size(
+        m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+        &lwork, &lrwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+    lapack::vector< int64_t > iwork( liwork );
+
+    return gelsd(
+        m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+        &work[0], lwork, &rwork[0], lrwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+void gelsd_work_size(
+    int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank,
+    int64_t* lwork, int64_t* liwork )
+{
+    auto key = internal::work_size_key(
+        "sgelsd", m, n, nrhs, lda, ldb );
+    if (internal::work_size_cache_find( key, lwork, liwork ))
+        return;
+
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int rank_ = 0;  // out
+    lapack_int info_ = 0;
+
+    float qry_work[1];
+    lapack_int qry_iwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_sgelsd(
+        &m_, &n_, &nrhs_,
+        A, &lda_,
+        B, &ldb_,
+        S, &rcond, &rank_,
+        qry_work, &ineg_one,
+        qry_iwork, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    *liwork = qry_iwork[0];
+    internal::work_size_cache_insert( key, *lwork, *liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+void gelsd_work_size(
+    int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    int64_t* lwork, int64_t* liwork )
+{
+    auto key = internal::work_size_key(
+        "dgelsd", m, n, nrhs, lda, ldb );
+    if (internal::work_size_cache_find( key, lwork, liwork ))
+        return;
+
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int rank_ = 0;  // out
+    lapack_int info_ = 0;
+
+    double qry_work[1];
+    lapack_int qry_iwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dgelsd(
+        &m_, &n_, &nrhs_,
+        A, &lda_,
+        B, &ldb_,
+        S, &rcond, &rank_,
+        qry_work, &ineg_one,
+        qry_iwork, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    *liwork = qry_iwork[0];
+    internal::work_size_cache_insert( key, *lwork, *liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+void gelsd_work_size(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
+{
+    auto key = internal::work_size_key(
+        "cgelsd", m, n, nrhs, lda, ldb );
+    if (internal::work_size_cache_find( key, lwork, lrwork, liwork ))
+        return;
+
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int rank_ = 0;  // out
+    lapack_int info_ = 0;
+
+    std::complex<float> qry_work[1];
+    float qry_rwork[1];
+    lapack_int qry_iwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_cgelsd(
+        &m_, &n_, &nrhs_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) B, &ldb_,
+        S, &rcond, &rank_,
+        (lapack_complex_float*) qry_work, &ineg_one,
+        qry_rwork,
+        qry_iwork, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    *lrwork = qry_rwork[0];
+    *liwork = qry_iwork[0];
+    internal::work_size_cache_insert( key, *lwork, *lrwork, *liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::gelsd with caller-provided workspace.
+/// Returns the array lengths that the workspace overload of `gelsd`
+/// requires, so the workspace can be allocated once, outside a loop.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// Other arguments are the same as for lapack::gelsd.
+/// Arrays are used only to select the precision and are not referenced.
+///
+/// @param[out] lwork
+///     The optimal length of the array work.
+///
+/// @param[out] lrwork
+///     The minimum length of the array rwork.
+///
+/// @param[out] liwork
+///     The minimum length of the array iwork.
+///
+/// @ingroup gels
+void gelsd_work_size(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
+{
+    auto key = internal::work_size_key(
+        "zgelsd", m, n, nrhs, lda, ldb );
+    if (internal::work_size_cache_find( key, lwork, lrwork, liwork ))
+        return;
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -275,7 +363,6 @@ int64_t gelsd(
     lapack_int rank_ = 0;  // out
     lapack_int info_ = 0;
 
-    // query for workspace size
     std::complex<double> qry_work[1];
     double qry_rwork[1];
     lapack_int qry_iwork[1];
@@ -291,23 +378,223 @@ int64_t gelsd(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = qry_rwork[0];
-    lapack_int liwork_ = qry_iwork[0];
+    *lwork = real(qry_work[0]);
+    *lrwork = qry_rwork[0];
+    *liwork = qry_iwork[0];
+    internal::work_size_cache_insert( key, *lwork, *lrwork, *liwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelsd(
+    int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int rank_ = 0;  // out
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gelsd", float, m, n, 0, nrhs, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    {
+        // LAPACK doesn't check liwork; its query gives the minimum
+        int64_t lwork_min, liwork_min;
+        gelsd_work_size(
+            m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+            &lwork_min, &liwork_min );
+        lapack_error_if( liwork < liwork_min );
+    }
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
+
+    LAPACK_sgelsd(
+        &m_, &n_, &nrhs_,
+        A, &lda_,
+        B, &ldb_,
+        S, &rcond, &rank_,
+        work, &lwork_,
+        iwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *rank = rank_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelsd(
+    int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int rank_ = 0;  // out
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gelsd", double, m, n, 0, nrhs, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    {
+        // LAPACK doesn't check liwork; its query gives the minimum
+        int64_t lwork_min, liwork_min;
+        gelsd_work_size(
+            m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+            &lwork_min, &liwork_min );
+        lapack_error_if( liwork < liwork_min );
+    }
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
+
+    LAPACK_dgelsd(
+        &m_, &n_, &nrhs_,
+        A, &lda_,
+        B, &ldb_,
+        S, &rcond, &rank_,
+        work, &lwork_,
+        iwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *rank = rank_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelsd(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int rank_ = 0;  // out
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gelsd", std::complex<float>, m, n, 0, nrhs, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    {
+        // LAPACK doesn't check lrwork or liwork; its query gives the minimums
+        int64_t lwork_min, lrwork_min, liwork_min;
+        gelsd_work_size(
+            m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+            &lwork_min, &lrwork_min, &liwork_min );
+        lapack_error_if( lrwork < lrwork_min );
+        lapack_error_if( liwork < liwork_min );
+    }
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
+
+    LAPACK_cgelsd(
+        &m_, &n_, &nrhs_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) B, &ldb_,
+        S, &rcond, &rank_,
+        (lapack_complex_float*) work, &lwork_,
+        rwork,
+        iwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *rank = rank_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::gelsd that takes caller-provided workspace
+/// instead of querying and allocating it on each call.
+/// Use lapack::gelsd_work_size to get the required lengths.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// Other arguments are the same as for lapack::gelsd.
+///
+/// @param[out] work
+///     The vector work of length lwork. Workspace.
+///
+/// @param[in] lwork
+///     The length of the array work.
+///     Use the value from lapack::gelsd_work_size for best performance.
+///
+/// @param[out] rwork
+///     The vector rwork of length lrwork. Workspace.
+///
+/// @param[in] lrwork
+///     The length of the array rwork.
+///     At least the value from lapack::gelsd_work_size.
+///
+/// @param[out] iwork
+///     The vector iwork of length liwork. Workspace.
+///     This is 64-bit for a uniform API; with 32-bit LAPACK integers,
+///     only the first half of its bytes are used.
+///
+/// @param[in] liwork
+///     The length of the array iwork.
+///     At least the value from lapack::gelsd_work_size.
+///
+/// @ingroup gels
+int64_t gelsd(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int rank_ = 0;  // out
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gelsd", std::complex<double>, m, n, 0, nrhs, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    {
+        // LAPACK doesn't check lrwork or liwork; its query gives the minimums
+        int64_t lwork_min, lrwork_min, liwork_min;
+        gelsd_work_size(
+            m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+            &lwork_min, &lrwork_min, &liwork_min );
+        lapack_error_if( lrwork < lrwork_min );
+        lapack_error_if( liwork < liwork_min );
+    }
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
 
     LAPACK_zgelsd(
         &m_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
         (lapack_complex_double*) B, &ldb_,
         S, &rcond, &rank_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0],
-        &iwork[0], &info_ );
+        (lapack_complex_double*) work, &lwork_,
+        rwork,
+        iwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -25,42 +25,18 @@ int64_t gelss(
     float* S, float rcond,
     int64_t* rank )
 {
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int nrhs_ = to_lapack_int( nrhs );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int ldb_ = to_lapack_int( ldb );
-    lapack_int rank_ = 0;  // out
-    lapack_int info_ = 0;
-
     // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgelss(
-        &m_, &n_, &nrhs_,
-        A, &lda_,
-        B, &ldb_,
-        S, &rcond, &rank_,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork;
+    gelss_work_size(
+        m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+        &lwork );
 
     // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    lapack::vector< float > work( lwork );
 
-    LAPACK_sgelss(
-        &m_, &n_, &nrhs_,
-        A, &lda_,
-        B, &ldb_,
-        S, &rcond, &rank_,
-        &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *rank = rank_;
-    return info_;
+    return gelss(
+        m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+        &work[0], lwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -72,42 +48,18 @@ int64_t gelss(
     double* S, double rcond,
     int64_t* rank )
 {
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int nrhs_ = to_lapack_int( nrhs );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int ldb_ = to_lapack_int( ldb );
-    lapack_int rank_ = 0;  // out
-    lapack_int info_ = 0;
-
     // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgelss(
-        &m_, &n_, &nrhs_,
-        A, &lda_,
-        B, &ldb_,
-        S, &rcond, &rank_,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork;
+    gelss_work_size(
+        m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+        &lwork );
 
     // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    lapack::vector< double > work( lwork );
 
-    LAPACK_dgelss(
-        &m_, &n_, &nrhs_,
-        A, &lda_,
-        B, &ldb_,
-        S, &rcond, &rank_,
-        &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *rank = rank_;
-    return info_;
+    return gelss(
+        m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+        &work[0], lwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -119,46 +71,19 @@ int64_t gelss(
     float* S, float rcond,
     int64_t* rank )
 {
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int nrhs_ = to_lapack_int( nrhs );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int ldb_ = to_lapack_int( ldb );
-    lapack_int rank_ = 0;  // out
-    lapack_int info_ = 0;
-
     // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cgelss(
-        &m_, &n_, &nrhs_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_,
-        S, &rcond, &rank_,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork, lrwork;
+    gelss_work_size(
+        m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+        &lwork, &lrwork );
 
     // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (5*min(m,n)) );
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
 
-    LAPACK_cgelss(
-        &m_, &n_, &nrhs_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_,
-        S, &rcond, &rank_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0], &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *rank = rank_;
-    return info_;
+    return gelss(
+        m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+        &work[0], lwork, &rwork[0], lrwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -237,6 +162,169 @@ int64_t gelss(
     double* S, double rcond,
     int64_t* rank )
 {
+    // query for workspace size
+    int64_t lwork, lrwork;
+    gelss_work_size(
+        m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+        &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+
+    return gelss(
+        m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+        &work[0], lwork, &rwork[0], lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+void gelss_work_size(
+    int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "sgelss", m, n, nrhs, lda, ldb );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int rank_ = 0;  // out
+    lapack_int info_ = 0;
+
+    float qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_sgelss(
+        &m_, &n_, &nrhs_,
+        A, &lda_,
+        B, &ldb_,
+        S, &rcond, &rank_,
+        qry_work, &ineg_one, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+void gelss_work_size(
+    int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "dgelss", m, n, nrhs, lda, ldb );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int rank_ = 0;  // out
+    lapack_int info_ = 0;
+
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dgelss(
+        &m_, &n_, &nrhs_,
+        A, &lda_,
+        B, &ldb_,
+        S, &rcond, &rank_,
+        qry_work, &ineg_one, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+void gelss_work_size(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank,
+    int64_t* lwork, int64_t* lrwork )
+{
+    auto key = internal::work_size_key(
+        "cgelss", m, n, nrhs, lda, ldb );
+    if (internal::work_size_cache_find( key, lwork, lrwork ))
+        return;
+
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int rank_ = 0;  // out
+    lapack_int info_ = 0;
+
+    std::complex<float> qry_work[1];
+    float qry_rwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_cgelss(
+        &m_, &n_, &nrhs_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) B, &ldb_,
+        S, &rcond, &rank_,
+        (lapack_complex_float*) qry_work, &ineg_one,
+        qry_rwork, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    *lrwork = 5*min(m,n);
+    internal::work_size_cache_insert( key, *lwork, *lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::gelss with caller-provided workspace.
+/// Returns the array lengths that the workspace overload of `gelss`
+/// requires, so the workspace can be allocated once, outside a loop.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// Other arguments are the same as for lapack::gelss.
+/// Arrays are used only to select the precision and are not referenced.
+///
+/// @param[out] lwork
+///     The optimal length of the array work.
+///
+/// @param[out] lrwork
+///     The length of the array rwork, 5*min(m,n).
+///
+/// @ingroup gels
+void gelss_work_size(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    int64_t* lwork, int64_t* lrwork )
+{
+    auto key = internal::work_size_key(
+        "zgelss", m, n, nrhs, lda, ldb );
+    if (internal::work_size_cache_find( key, lwork, lrwork ))
+        return;
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -245,7 +333,6 @@ int64_t gelss(
     lapack_int rank_ = 0;  // out
     lapack_int info_ = 0;
 
-    // query for workspace size
     std::complex<double> qry_work[1];
     double qry_rwork[1];
     lapack_int ineg_one = -1;
@@ -259,19 +346,164 @@ int64_t gelss(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    *lrwork = 5*min(m,n);
+    internal::work_size_cache_insert( key, *lwork, *lrwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (5*min(m,n)) );
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelss(
+    int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank,
+    float* work, int64_t lwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int rank_ = 0;  // out
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gelss", float, m, n, 0, nrhs, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+
+    LAPACK_sgelss(
+        &m_, &n_, &nrhs_,
+        A, &lda_,
+        B, &ldb_,
+        S, &rcond, &rank_,
+        work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *rank = rank_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelss(
+    int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    double* work, int64_t lwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int rank_ = 0;  // out
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gelss", double, m, n, 0, nrhs, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+
+    LAPACK_dgelss(
+        &m_, &n_, &nrhs_,
+        A, &lda_,
+        B, &ldb_,
+        S, &rcond, &rank_,
+        work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *rank = rank_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelss(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int rank_ = 0;  // out
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gelss", std::complex<float>, m, n, 0, nrhs, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( lrwork < 5*min(m,n) );
+
+    LAPACK_cgelss(
+        &m_, &n_, &nrhs_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) B, &ldb_,
+        S, &rcond, &rank_,
+        (lapack_complex_float*) work, &lwork_,
+        rwork, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *rank = rank_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::gelss that takes caller-provided workspace
+/// instead of querying and allocating it on each call.
+/// Use lapack::gelss_work_size to get the required lengths.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// Other arguments are the same as for lapack::gelss.
+///
+/// @param[out] work
+///     The vector work of length lwork. Workspace.
+///
+/// @param[in] lwork
+///     The length of the array work.
+///     Use the value from lapack::gelss_work_size for best performance.
+///
+/// @param[out] rwork
+///     The vector rwork of length lrwork. Workspace.
+///
+/// @param[in] lrwork
+///     The length of the array rwork, lrwork >= 5*min(m,n).
+///
+/// @ingroup gels
+int64_t gelss(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int rank_ = 0;  // out
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gelss", std::complex<double>, m, n, 0, nrhs, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( lrwork < 5*min(m,n) );
 
     LAPACK_zgelss(
         &m_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
         (lapack_complex_double*) B, &ldb_,
         S, &rcond, &rank_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0], &info_ );
+        (lapack_complex_double*) work, &lwork_,
+        rwork, &info_ );
     if (info_ < 0) {
         throw Error();
     }
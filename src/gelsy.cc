@@ -25,52 +25,18 @@ int64_t gelsy(
     int64_t* jpvt, float rcond,
     int64_t* rank )
 {
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int nrhs_ = to_lapack_int( nrhs );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int ldb_ = to_lapack_int( ldb );
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        std::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
-        lapack_int* jpvt_ptr = &jpvt_[0];
-    #else
-        lapack_int* jpvt_ptr = jpvt;
-    #endif
-    lapack_int rank_ = 0;  // out
-    lapack_int info_ = 0;
-
     // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgelsy(
-        &m_, &n_, &nrhs_,
-        A, &lda_,
-        B, &ldb_,
-        jpvt_ptr, &rcond, &rank_,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork;
+    gelsy_work_size(
+        m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank,
+        &lwork );
 
     // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    lapack::vector< float > work( lwork );
 
-    LAPACK_sgelsy(
-        &m_, &n_, &nrhs_,
-        A, &lda_,
-        B, &ldb_,
-        jpvt_ptr, &rcond, &rank_,
-        &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    #ifndef LAPACK_ILP64
-        std::copy( jpvt_.begin(), jpvt_.end(), jpvt );
-    #endif
-    *rank = rank_;
-    return info_;
+    return gelsy(
+        m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank,
+        &work[0], lwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -82,52 +48,18 @@ int64_t gelsy(
     int64_t* jpvt, double rcond,
     int64_t* rank )
 {
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int nrhs_ = to_lapack_int( nrhs );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int ldb_ = to_lapack_int( ldb );
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        std::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
-        lapack_int* jpvt_ptr = &jpvt_[0];
-    #else
-        lapack_int* jpvt_ptr = jpvt;
-    #endif
-    lapack_int rank_ = 0;  // out
-    lapack_int info_ = 0;
-
     // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgelsy(
-        &m_, &n_, &nrhs_,
-        A, &lda_,
-        B, &ldb_,
-        jpvt_ptr, &rcond, &rank_,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork;
+    gelsy_work_size(
+        m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank,
+        &lwork );
 
     // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    lapack::vector< double > work( lwork );
 
-    LAPACK_dgelsy(
-        &m_, &n_, &nrhs_,
-        A, &lda_,
-        B, &ldb_,
-        jpvt_ptr, &rcond, &rank_,
-        &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    #ifndef LAPACK_ILP64
-        std::copy( jpvt_.begin(), jpvt_.end(), jpvt );
-    #endif
-    *rank = rank_;
-    return info_;
+    return gelsy(
+        m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank,
+        &work[0], lwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -139,56 +71,19 @@ int64_t gelsy(
     int64_t* jpvt, float rcond,
     int64_t* rank )
 {
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int nrhs_ = to_lapack_int( nrhs );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int ldb_ = to_lapack_int( ldb );
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        std::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
-        lapack_int* jpvt_ptr = &jpvt_[0];
-    #else
-        lapack_int* jpvt_ptr = jpvt;
-    #endif
-    lapack_int rank_ = 0;  // out
-    lapack_int info_ = 0;
-
     // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cgelsy(
-        &m_, &n_, &nrhs_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_,
-        jpvt_ptr, &rcond, &rank_,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork, lrwork;
+    gelsy_work_size(
+        m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank,
+        &lwork, &lrwork );
 
     // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (2*n) );
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
 
-    LAPACK_cgelsy(
-        &m_, &n_, &nrhs_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_,
-        jpvt_ptr, &rcond, &rank_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0], &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    #ifndef LAPACK_ILP64
-        std::copy( jpvt_.begin(), jpvt_.end(), jpvt );
-    #endif
-    *rank = rank_;
-    return info_;
+    return gelsy(
+        m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank,
+        &work[0], lwork, &rwork[0], lrwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -299,22 +194,181 @@ int64_t gelsy(
     int64_t* jpvt, double rcond,
     int64_t* rank )
 {
+    // query for workspace size
+    int64_t lwork, lrwork;
+    gelsy_work_size(
+        m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank,
+        &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+
+    return gelsy(
+        m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank,
+        &work[0], lwork, &rwork[0], lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+void gelsy_work_size(
+    int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    int64_t* jpvt, float rcond,
+    int64_t* rank,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "sgelsy", m, n, nrhs, lda, ldb );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldb_ = to_lapack_int( ldb );
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        std::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
-        lapack_int* jpvt_ptr = &jpvt_[0];
-    #else
-        lapack_int* jpvt_ptr = jpvt;
-    #endif
+    lapack_int* jpvt_ptr = reinterpret_cast< lapack_int* >( jpvt );  // not referenced
+    lapack_int rank_ = 0;  // out
+    lapack_int info_ = 0;
+
+    float qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_sgelsy(
+        &m_, &n_, &nrhs_,
+        A, &lda_,
+        B, &ldb_,
+        jpvt_ptr, &rcond, &rank_,
+        qry_work, &ineg_one, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+void gelsy_work_size(
+    int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    int64_t* jpvt, double rcond,
+    int64_t* rank,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "dgelsy", m, n, nrhs, lda, ldb );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int* jpvt_ptr = reinterpret_cast< lapack_int* >( jpvt );  // not referenced
+    lapack_int rank_ = 0;  // out
+    lapack_int info_ = 0;
+
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dgelsy(
+        &m_, &n_, &nrhs_,
+        A, &lda_,
+        B, &ldb_,
+        jpvt_ptr, &rcond, &rank_,
+        qry_work, &ineg_one, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+void gelsy_work_size(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* jpvt, float rcond,
+    int64_t* rank,
+    int64_t* lwork, int64_t* lrwork )
+{
+    auto key = internal::work_size_key(
+        "cgelsy", m, n, nrhs, lda, ldb );
+    if (internal::work_size_cache_find( key, lwork, lrwork ))
+        return;
+
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int* jpvt_ptr = reinterpret_cast< lapack_int* >( jpvt );  // not referenced
+    lapack_int rank_ = 0;  // out
+    lapack_int info_ = 0;
+
+    std::complex<float> qry_work[1];
+    float qry_rwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_cgelsy(
+        &m_, &n_, &nrhs_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) B, &ldb_,
+        jpvt_ptr, &rcond, &rank_,
+        (lapack_complex_float*) qry_work, &ineg_one,
+        qry_rwork, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    *lrwork = 2*n;
+    internal::work_size_cache_insert( key, *lwork, *lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::gelsy with caller-provided workspace.
+/// Returns the array lengths that the workspace overload of `gelsy`
+/// requires, so the workspace can be allocated once, outside a loop.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// Other arguments are the same as for lapack::gelsy.
+/// Arrays are used only to select the precision and are not referenced.
+///
+/// @param[out] lwork
+///     The optimal length of the array work.
+///
+/// @param[out] lrwork
+///     The length of the array rwork, 2*n.
+///
+/// @ingroup gels
+void gelsy_work_size(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* jpvt, double rcond,
+    int64_t* rank,
+    int64_t* lwork, int64_t* lrwork )
+{
+    auto key = internal::work_size_key(
+        "zgelsy", m, n, nrhs, lda, ldb );
+    if (internal::work_size_cache_find( key, lwork, lrwork ))
+        return;
+
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int* jpvt_ptr = reinterpret_cast< lapack_int* >( jpvt );  // not referenced
     lapack_int rank_ = 0;  // out
     lapack_int info_ = 0;
 
-    // query for workspace size
     std::complex<double> qry_work[1];
     double qry_rwork[1];
     lapack_int ineg_one = -1;
@@ -328,19 +382,201 @@ int64_t gelsy(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    *lrwork = 2*n;
+    internal::work_size_cache_insert( key, *lwork, *lrwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (2*n) );
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelsy(
+    int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    int64_t* jpvt, float rcond,
+    int64_t* rank,
+    float* work, int64_t lwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        std::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
+        lapack_int* jpvt_ptr = &jpvt_[0];
+    #else
+        lapack_int* jpvt_ptr = jpvt;
+    #endif
+    lapack_int rank_ = 0;  // out
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gelsy", float, m, n, 0, nrhs, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+
+    LAPACK_sgelsy(
+        &m_, &n_, &nrhs_,
+        A, &lda_,
+        B, &ldb_,
+        jpvt_ptr, &rcond, &rank_,
+        work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    #ifndef LAPACK_ILP64
+        std::copy( jpvt_.begin(), jpvt_.end(), jpvt );
+    #endif
+    *rank = rank_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelsy(
+    int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    int64_t* jpvt, double rcond,
+    int64_t* rank,
+    double* work, int64_t lwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        std::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
+        lapack_int* jpvt_ptr = &jpvt_[0];
+    #else
+        lapack_int* jpvt_ptr = jpvt;
+    #endif
+    lapack_int rank_ = 0;  // out
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gelsy", double, m, n, 0, nrhs, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+
+    LAPACK_dgelsy(
+        &m_, &n_, &nrhs_,
+        A, &lda_,
+        B, &ldb_,
+        jpvt_ptr, &rcond, &rank_,
+        work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    #ifndef LAPACK_ILP64
+        std::copy( jpvt_.begin(), jpvt_.end(), jpvt );
+    #endif
+    *rank = rank_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelsy(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* jpvt, float rcond,
+    int64_t* rank,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        std::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
+        lapack_int* jpvt_ptr = &jpvt_[0];
+    #else
+        lapack_int* jpvt_ptr = jpvt;
+    #endif
+    lapack_int rank_ = 0;  // out
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gelsy", std::complex<float>, m, n, 0, nrhs, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( lrwork < 2*n );
+
+    LAPACK_cgelsy(
+        &m_, &n_, &nrhs_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) B, &ldb_,
+        jpvt_ptr, &rcond, &rank_,
+        (lapack_complex_float*) work, &lwork_,
+        rwork, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    #ifndef LAPACK_ILP64
+        std::copy( jpvt_.begin(), jpvt_.end(), jpvt );
+    #endif
+    *rank = rank_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::gelsy that takes caller-provided workspace
+/// instead of querying and allocating it on each call.
+/// Use lapack::gelsy_work_size to get the required lengths.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// Other arguments are the same as for lapack::gelsy.
+///
+/// @param[out] work
+///     The vector work of length lwork. Workspace.
+///
+/// @param[in] lwork
+///     The length of the array work.
+///     Use the value from lapack::gelsy_work_size for best performance.
+///
+/// @param[out] rwork
+///     The vector rwork of length lrwork. Workspace.
+///
+/// @param[in] lrwork
+///     The length of the array rwork, lrwork >= 2*n.
+///
+/// @ingroup gels
+int64_t gelsy(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* jpvt, double rcond,
+    int64_t* rank,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        std::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
+        lapack_int* jpvt_ptr = &jpvt_[0];
+    #else
+        lapack_int* jpvt_ptr = jpvt;
+    #endif
+    lapack_int rank_ = 0;  // out
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gelsy", std::complex<double>, m, n, 0, nrhs, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( lrwork < 2*n );
 
     LAPACK_zgelsy(
         &m_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
         (lapack_complex_double*) B, &ldb_,
         jpvt_ptr, &rcond, &rank_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0], &info_ );
+        (lapack_complex_double*) work, &lwork_,
+        rwork, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -34,6 +34,7 @@ int64_t gemqr(
     lapack_int tsize_ = to_lapack_int( tsize );
     lapack_int ldc_ = to_lapack_int( ldc );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gemqr", float, m, n, k, 0, info_ );
 
     // query for workspace size
     float qry_work[1];
@@ -82,6 +83,7 @@ int64_t gemqr(
     lapack_int tsize_ = to_lapack_int( tsize );
     lapack_int ldc_ = to_lapack_int( ldc );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gemqr", double, m, n, k, 0, info_ );
 
     // query for workspace size
     double qry_work[1];
@@ -130,6 +132,7 @@ int64_t gemqr(
     lapack_int tsize_ = to_lapack_int( tsize );
     lapack_int ldc_ = to_lapack_int( ldc );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gemqr", std::complex<float>, m, n, k, 0, info_ );
 
     // query for workspace size
     std::complex<float> qry_work[1];
@@ -178,6 +181,7 @@ int64_t gemqr(
     lapack_int tsize_ = to_lapack_int( tsize );
     lapack_int ldc_ = to_lapack_int( ldc );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gemqr", std::complex<double>, m, n, k, 0, info_ );
 
     // query for workspace size
     std::complex<double> qry_work[1];
@@ -39,6 +39,7 @@ int64_t gemqrt(
     lapack_int ldt_ = to_lapack_int( ldt );
     lapack_int ldc_ = to_lapack_int( ldc );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gemqrt", float, m, n, k, 0, info_ );
 
     // Set workspace size
     lapack_int lwork_ = real((side == lapack::Side::Right) ? (m * nb) : (n * nb));
@@ -81,6 +82,7 @@ int64_t gemqrt(
     lapack_int ldt_ = to_lapack_int( ldt );
     lapack_int ldc_ = to_lapack_int( ldc );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gemqrt", double, m, n, k, 0, info_ );
 
     // Set workspace size
     lapack_int lwork_ = real((side == lapack::Side::Right) ? (m * nb) : (n * nb));
@@ -123,6 +125,7 @@ int64_t gemqrt(
     lapack_int ldt_ = to_lapack_int( ldt );
     lapack_int ldc_ = to_lapack_int( ldc );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gemqrt", std::complex<float>, m, n, k, 0, info_ );
 
     // Set workspace size
     lapack_int lwork_ = real((side == lapack::Side::Right) ? (m * nb) : (n * nb));
@@ -240,6 +243,7 @@ int64_t gemqrt(
     lapack_int ldt_ = to_lapack_int( ldt );
     lapack_int ldc_ = to_lapack_int( ldc );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gemqrt", std::complex<double>, m, n, k, 0, info_ );
 
     // Set workspace size
     lapack_int lwork_ = real((side == lapack::Side::Right) ? (m * nb) : (n * nb));
@@ -23,36 +23,18 @@ int64_t geqlf(
     float* A, int64_t lda,
     float* tau )
 {
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int info_ = 0;
-
     // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgeqlf(
-        &m_, &n_,
-        A, &lda_,
-        tau,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork;
+    geqlf_work_size(
+        m, n, A, lda, tau,
+        &lwork );
 
     // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    lapack::vector< float > work( lwork );
 
-    LAPACK_sgeqlf(
-        &m_, &n_,
-        A, &lda_,
-        tau,
-        &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return geqlf(
+        m, n, A, lda, tau,
+        &work[0], lwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -62,36 +44,18 @@ int64_t geqlf(
     double* A, int64_t lda,
     double* tau )
 {
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int info_ = 0;
-
     // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgeqlf(
-        &m_, &n_,
-        A, &lda_,
-        tau,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork;
+    geqlf_work_size(
+        m, n, A, lda, tau,
+        &lwork );
 
     // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    lapack::vector< double > work( lwork );
 
-    LAPACK_dgeqlf(
-        &m_, &n_,
-        A, &lda_,
-        tau,
-        &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return geqlf(
+        m, n, A, lda, tau,
+        &work[0], lwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -101,36 +65,18 @@ int64_t geqlf(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* tau )
 {
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int info_ = 0;
-
     // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cgeqlf(
-        &m_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) tau,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork;
+    geqlf_work_size(
+        m, n, A, lda, tau,
+        &lwork );
 
     // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+    lapack::vector< std::complex<float> > work( lwork );
 
-    LAPACK_cgeqlf(
-        &m_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) tau,
-        (lapack_complex_float*) &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return geqlf(
+        m, n, A, lda, tau,
+        &work[0], lwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -194,12 +140,144 @@ int64_t geqlf(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* tau )
 {
+    // query for workspace size
+    int64_t lwork;
+    geqlf_work_size(
+        m, n, A, lda, tau,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+
+    return geqlf(
+        m, n, A, lda, tau,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqlf
+void geqlf_work_size(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "sgeqlf", m, n, lda );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+
+    float qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_sgeqlf(
+        &m_, &n_,
+        A, &lda_,
+        tau,
+        qry_work, &ineg_one, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqlf
+void geqlf_work_size(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "dgeqlf", m, n, lda );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dgeqlf(
+        &m_, &n_,
+        A, &lda_,
+        tau,
+        qry_work, &ineg_one, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqlf
+void geqlf_work_size(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "cgeqlf", m, n, lda );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+
+    std::complex<float> qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_cgeqlf(
+        &m_, &n_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) tau,
+        (lapack_complex_float*) qry_work, &ineg_one, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::geqlf with caller-provided workspace.
+/// Returns the array lengths that the workspace overload of `geqlf`
+/// requires, so the workspace can be allocated once, outside a loop.
+///
+/// Other arguments are the same as for lapack::geqlf.
+/// Arrays are used only to select the precision and are not referenced.
+///
+/// @param[out] lwork
+///     The optimal length of the array work.
+///
+/// @ingroup geqlf
+void geqlf_work_size(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "zgeqlf", m, n, lda );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
 
-    // query for workspace size
     std::complex<double> qry_work[1];
     lapack_int ineg_one = -1;
     LAPACK_zgeqlf(
@@ -210,16 +288,121 @@ int64_t geqlf(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup geqlf
+int64_t geqlf(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau,
+    float* work, int64_t lwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geqlf", float, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+
+    LAPACK_sgeqlf(
+        &m_, &n_,
+        A, &lda_,
+        tau,
+        work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqlf
+int64_t geqlf(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau,
+    double* work, int64_t lwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geqlf", double, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+
+    LAPACK_dgeqlf(
+        &m_, &n_,
+        A, &lda_,
+        tau,
+        work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqlf
+int64_t geqlf(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    std::complex<float>* work, int64_t lwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geqlf", std::complex<float>, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+
+    LAPACK_cgeqlf(
+        &m_, &n_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) tau,
+        (lapack_complex_float*) work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::geqlf that takes caller-provided workspace
+/// instead of querying and allocating it on each call.
+/// Use lapack::geqlf_work_size to get the required lengths.
+///
+/// Other arguments are the same as for lapack::geqlf.
+///
+/// @param[out] work
+///     The vector work of length lwork. Workspace.
+///
+/// @param[in] lwork
+///     The length of the array work.
+///     Use the value from lapack::geqlf_work_size for best performance.
+///
+/// @ingroup geqlf
+int64_t geqlf(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    std::complex<double>* work, int64_t lwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geqlf", std::complex<double>, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
     LAPACK_zgeqlf(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
         (lapack_complex_double*) tau,
-        (lapack_complex_double*) &work[0], &lwork_, &info_ );
+        (lapack_complex_double*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -23,19 +23,104 @@ int64_t geqp3(
     int64_t* jpvt,
     float* tau )
 {
+    // query for workspace size
+    int64_t lwork;
+    geqp3_work_size(
+        m, n, A, lda, jpvt, tau,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return geqp3(
+        m, n, A, lda, jpvt, tau,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t geqp3(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    int64_t* jpvt,
+    double* tau )
+{
+    // query for workspace size
+    int64_t lwork;
+    geqp3_work_size(
+        m, n, A, lda, jpvt, tau,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return geqp3(
+        m, n, A, lda, jpvt, tau,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t geqp3(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* jpvt,
+    std::complex<float>* tau )
+{
+    // query for workspace size
+    int64_t lwork, lrwork;
+    geqp3_work_size(
+        m, n, A, lda, jpvt, tau,
+        &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+
+    return geqp3(
+        m, n, A, lda, jpvt, tau,
+        &work[0], lwork, &rwork[0], lrwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t geqp3(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* jpvt,
+    std::complex<double>* tau )
+{
+    // query for workspace size
+    int64_t lwork, lrwork;
+    geqp3_work_size(
+        m, n, A, lda, jpvt, tau,
+        &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+
+    return geqp3(
+        m, n, A, lda, jpvt, tau,
+        &work[0], lwork, &rwork[0], lrwork );
+}
+
+// -----------------------------------------------------------------------------
+void geqp3_work_size(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    int64_t* jpvt,
+    float* tau,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "sgeqp3", m, n, lda );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        std::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
-        lapack_int* jpvt_ptr = &jpvt_[0];
-    #else
-        lapack_int* jpvt_ptr = jpvt;
-    #endif
+    lapack_int* jpvt_ptr = reinterpret_cast< lapack_int* >( jpvt );  // not referenced
     lapack_int info_ = 0;
 
-    // query for workspace size
     float qry_work[1];
     lapack_int ineg_one = -1;
     LAPACK_sgeqp3(
@@ -47,32 +132,125 @@ int64_t geqp3(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+void geqp3_work_size(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    int64_t* jpvt,
+    double* tau,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "dgeqp3", m, n, lda );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
 
-    LAPACK_sgeqp3(
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int* jpvt_ptr = reinterpret_cast< lapack_int* >( jpvt );  // not referenced
+    lapack_int info_ = 0;
+
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dgeqp3(
         &m_, &n_,
         A, &lda_,
         jpvt_ptr,
         tau,
-        &work[0], &lwork_, &info_ );
+        qry_work, &ineg_one, &info_ );
     if (info_ < 0) {
         throw Error();
     }
-    #ifndef LAPACK_ILP64
-        std::copy( jpvt_.begin(), jpvt_.end(), jpvt );
-    #endif
-    return info_;
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+void geqp3_work_size(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* jpvt,
+    std::complex<float>* tau,
+    int64_t* lwork, int64_t* lrwork )
+{
+    auto key = internal::work_size_key(
+        "cgeqp3", m, n, lda );
+    if (internal::work_size_cache_find( key, lwork, lrwork ))
+        return;
+
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int* jpvt_ptr = reinterpret_cast< lapack_int* >( jpvt );  // not referenced
+    lapack_int info_ = 0;
+
+    std::complex<float> qry_work[1];
+    float qry_rwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_cgeqp3(
+        &m_, &n_,
+        (lapack_complex_float*) A, &lda_,
+        jpvt_ptr,
+        (lapack_complex_float*) tau,
+        (lapack_complex_float*) qry_work, &ineg_one,
+        qry_rwork, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    *lrwork = 2*n;
+    internal::work_size_cache_insert( key, *lwork, *lrwork );
+}
+
+// -----------------------------------------------------------------------------
+void geqp3_work_size(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* jpvt,
+    std::complex<double>* tau,
+    int64_t* lwork, int64_t* lrwork )
+{
+    auto key = internal::work_size_key(
+        "zgeqp3", m, n, lda );
+    if (internal::work_size_cache_find( key, lwork, lrwork ))
+        return;
+
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int* jpvt_ptr = reinterpret_cast< lapack_int* >( jpvt );  // not referenced
+    lapack_int info_ = 0;
+
+    std::complex<double> qry_work[1];
+    double qry_rwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_zgeqp3(
+        &m_, &n_,
+        (lapack_complex_double*) A, &lda_,
+        jpvt_ptr,
+        (lapack_complex_double*) tau,
+        (lapack_complex_double*) qry_work, &ineg_one,
+        qry_rwork, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    *lrwork = 2*n;
+    internal::work_size_cache_insert( key, *lwork, *lrwork );
 }
 
 // -----------------------------------------------------------------------------
 int64_t geqp3(
     int64_t m, int64_t n,
-    double* A, int64_t lda,
+    float* A, int64_t lda,
     int64_t* jpvt,
-    double* tau )
+    float* tau,
+    float* work, int64_t lwork )
 {
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -85,30 +263,52 @@ int64_t geqp3(
         lapack_int* jpvt_ptr = jpvt;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geqp3", float, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgeqp3(
+    LAPACK_sgeqp3(
         &m_, &n_,
         A, &lda_,
         jpvt_ptr,
         tau,
-        qry_work, &ineg_one, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    #ifndef LAPACK_ILP64
+        std::copy( jpvt_.begin(), jpvt_.end(), jpvt );
+    #endif
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+int64_t geqp3(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    int64_t* jpvt,
+    double* tau,
+    double* work, int64_t lwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        std::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
+        lapack_int* jpvt_ptr = &jpvt_[0];
+    #else
+        lapack_int* jpvt_ptr = jpvt;
+    #endif
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geqp3", double, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
     LAPACK_dgeqp3(
         &m_, &n_,
         A, &lda_,
         jpvt_ptr,
         tau,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -123,7 +323,9 @@ int64_t geqp3(
     int64_t m, int64_t n,
     std::complex<float>* A, int64_t lda,
     int64_t* jpvt,
-    std::complex<float>* tau )
+    std::complex<float>* tau,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork )
 {
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -136,34 +338,17 @@ int64_t geqp3(
         lapack_int* jpvt_ptr = jpvt;
     #endif
     lapack_int info_ = 0;
-
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cgeqp3(
-        &m_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        jpvt_ptr,
-        (lapack_complex_float*) tau,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (2*n) );
+    LAPACK_TRACE_BLOCK( "geqp3", std::complex<float>, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( lrwork < 2*n );
 
     LAPACK_cgeqp3(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
         jpvt_ptr,
         (lapack_complex_float*) tau,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0], &info_ );
+        (lapack_complex_float*) work, &lwork_,
+        rwork, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -178,7 +363,9 @@ int64_t geqp3(
     int64_t m, int64_t n,
     std::complex<double>* A, int64_t lda,
     int64_t* jpvt,
-    std::complex<double>* tau )
+    std::complex<double>* tau,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork )
 {
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -191,34 +378,17 @@ int64_t geqp3(
         lapack_int* jpvt_ptr = jpvt;
     #endif
     lapack_int info_ = 0;
-
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgeqp3(
-        &m_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        jpvt_ptr,
-        (lapack_complex_double*) tau,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (2*n) );
+    LAPACK_TRACE_BLOCK( "geqp3", std::complex<double>, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( lrwork < 2*n );
 
     LAPACK_zgeqp3(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
         jpvt_ptr,
         (lapack_complex_double*) tau,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0], &info_ );
+        (lapack_complex_double*) work, &lwork_,
+        rwork, &info_ );
     if (info_ < 0) {
         throw Error();
     }
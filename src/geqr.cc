@@ -30,6 +30,7 @@ int64_t geqr(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int tsize_ = to_lapack_int( tsize );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geqr", float, m, n, 0, 0, info_ );
 
     // query for workspace size
     float qry_work[1];
@@ -74,6 +75,7 @@ int64_t geqr(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int tsize_ = to_lapack_int( tsize );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geqr", double, m, n, 0, 0, info_ );
 
     // query for workspace size
     double qry_work[1];
@@ -118,6 +120,7 @@ int64_t geqr(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int tsize_ = to_lapack_int( tsize );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geqr", std::complex<float>, m, n, 0, 0, info_ );
 
     // query for workspace size
     std::complex<float> qry_work[1];
@@ -251,6 +254,7 @@ int64_t geqr(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int tsize_ = to_lapack_int( tsize );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geqr", std::complex<double>, m, n, 0, 0, info_ );
 
     // query for workspace size
     std::complex<double> qry_work[1];
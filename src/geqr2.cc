@@ -27,6 +27,7 @@ int64_t geqr2(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geqr2", float, m, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (n) );
@@ -53,6 +54,7 @@ int64_t geqr2(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geqr2", double, m, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (n) );
@@ -79,6 +81,7 @@ int64_t geqr2(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geqr2", std::complex<float>, m, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<float> > work( (n) );
@@ -157,6 +160,7 @@ int64_t geqr2(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geqr2", std::complex<double>, m, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (n) );
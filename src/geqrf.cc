@@ -23,36 +23,18 @@ int64_t geqrf(
     float* A, int64_t lda,
     float* tau )
 {
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int info_ = 0;
-
     // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgeqrf(
-        &m_, &n_,
-        A, &lda_,
-        tau,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork;
+    geqrf_work_size(
+        m, n, A, lda, tau,
+        &lwork );
 
     // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    lapack::vector< float > work( lwork );
 
-    LAPACK_sgeqrf(
-        &m_, &n_,
-        A, &lda_,
-        tau,
-        &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return geqrf(
+        m, n, A, lda, tau,
+        &work[0], lwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -62,36 +44,18 @@ int64_t geqrf(
     double* A, int64_t lda,
     double* tau )
 {
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int info_ = 0;
-
     // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgeqrf(
-        &m_, &n_,
-        A, &lda_,
-        tau,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork;
+    geqrf_work_size(
+        m, n, A, lda, tau,
+        &lwork );
 
     // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    lapack::vector< double > work( lwork );
 
-    LAPACK_dgeqrf(
-        &m_, &n_,
-        A, &lda_,
-        tau,
-        &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return geqrf(
+        m, n, A, lda, tau,
+        &work[0], lwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -101,36 +65,18 @@ int64_t geqrf(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* tau )
 {
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int info_ = 0;
-
     // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cgeqrf(
-        &m_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) tau,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork;
+    geqrf_work_size(
+        m, n, A, lda, tau,
+        &lwork );
 
     // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+    lapack::vector< std::complex<float> > work( lwork );
 
-    LAPACK_cgeqrf(
-        &m_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) tau,
-        (lapack_complex_float*) &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return geqrf(
+        m, n, A, lda, tau,
+        &work[0], lwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -191,12 +137,147 @@ int64_t geqrf(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* tau )
 {
+    // query for workspace size
+    int64_t lwork;
+    geqrf_work_size(
+        m, n, A, lda, tau,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+
+    return geqrf(
+        m, n, A, lda, tau,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+void geqrf_work_size(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "sgeqrf", m, n, lda );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+
+    float qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_sgeqrf(
+        &m_, &n_,
+        A, &lda_,
+        tau,
+        qry_work, &ineg_one, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+void geqrf_work_size(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "dgeqrf", m, n, lda );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dgeqrf(
+        &m_, &n_,
+        A, &lda_,
+        tau,
+        qry_work, &ineg_one, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+void geqrf_work_size(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "cgeqrf", m, n, lda );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+
+    std::complex<float> qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_cgeqrf(
+        &m_, &n_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) tau,
+        (lapack_complex_float*) qry_work, &ineg_one, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::geqrf with caller-provided workspace.
+/// Returns the array lengths that the workspace overload of `geqrf`
+/// requires, so the workspace can be allocated once, outside a loop.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// Other arguments are the same as for lapack::geqrf.
+/// Arrays are used only to select the precision and are not referenced.
+///
+/// @param[out] lwork
+///     The optimal length of the array work.
+///
+/// @ingroup geqrf
+void geqrf_work_size(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "zgeqrf", m, n, lda );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
 
-    // query for workspace size
     std::complex<double> qry_work[1];
     lapack_int ineg_one = -1;
     LAPACK_zgeqrf(
@@ -207,20 +288,221 @@ int64_t geqrf(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t geqrf(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau,
+    float* work, int64_t lwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geqrf", float, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+
+    LAPACK_sgeqrf(
+        &m_, &n_,
+        A, &lda_,
+        tau,
+        work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t geqrf(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau,
+    double* work, int64_t lwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geqrf", double, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+
+    LAPACK_dgeqrf(
+        &m_, &n_,
+        A, &lda_,
+        tau,
+        work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t geqrf(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    std::complex<float>* work, int64_t lwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geqrf", std::complex<float>, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+
+    LAPACK_cgeqrf(
+        &m_, &n_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) tau,
+        (lapack_complex_float*) work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::geqrf that takes caller-provided workspace
+/// instead of querying and allocating it on each call.
+/// Use lapack::geqrf_work_size to get the required lengths.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// Other arguments are the same as for lapack::geqrf.
+///
+/// @param[out] work
+///     The vector work of length lwork. Workspace.
+///
+/// @param[in] lwork
+///     The length of the array work.
+///     Use the value from lapack::geqrf_work_size for best performance.
+///
+/// @ingroup geqrf
+int64_t geqrf(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    std::complex<double>* work, int64_t lwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geqrf", std::complex<double>, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
     LAPACK_zgeqrf(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
         (lapack_complex_double*) tau,
-        (lapack_complex_double*) &work[0], &lwork_, &info_ );
+        (lapack_complex_double*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
     return info_;
 }
 
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper for either layout.
+/// @ingroup geqrf
+///
+template <typename scalar_t>
+int64_t geqrf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    scalar_t* tau )
+{
+    if (layout == Layout::ColMajor)
+        return lapack::geqrf( m, n, A, lda, tau );
+
+    lapack_error_if( layout != Layout::RowMajor );
+
+    // Row-major A is column-major A^T. If A^T = L Q by gelqf, then
+    // A = Q^T L^T = Q2 R with R = L^T, where Q2 = Q^T has the same
+    // reflectors as Q, read row-major, with tau conjugated.
+    int64_t info = lapack::gelqf( n, m, A, lda, tau );
+    if constexpr (blas::is_complex_v< scalar_t >) {
+        for (int64_t i = 0; i < min( m, n ); ++i)
+            tau[ i ] = blas::conj( tau[ i ] );
+    }
+    return info;
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// @ingroup geqrf
+int64_t geqrf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau )
+{
+    return impl::geqrf( layout, m, n, A, lda, tau );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t geqrf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau )
+{
+    return impl::geqrf( layout, m, n, A, lda, tau );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t geqrf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau )
+{
+    return impl::geqrf( layout, m, n, A, lda, tau );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::geqrf that takes the matrix layout.
+/// For row-major layout, A, R, and the Householder vectors are stored
+/// row-major, in the same positions as for column-major.
+///
+/// For row-major, this computes the LQ factorization of the column-major
+/// A^T with lapack::gelqf, $A^T = L Q$, so $A = Q^T L^T$, where
+/// $R = L^T$ and the reflectors of $Q^T$ are those of Q with tau
+/// conjugated. Nothing is copied.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// Other arguments are the same as for lapack::geqrf.
+///
+/// @param[in] layout
+///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
+///
+/// @param[in] lda
+///     The leading dimension of the array A.
+///     If layout = ColMajor, lda >= max(1,m);
+///     if layout = RowMajor, lda >= max(1,n).
+///
+/// @ingroup geqrf
+int64_t geqrf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau )
+{
+    return impl::geqrf( layout, m, n, A, lda, tau );
+}
+
 }  // namespace lapack
@@ -0,0 +1,392 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "lapack/fortran.h"
+#include "NoConstructAllocator.hh"
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+//==============================================================================
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, float version.
+/// @ingroup geqrf_batch_internal
+inline void geqrf(
+    lapack_int m, lapack_int n,
+    float* A, lapack_int lda,
+    float* tau,
+    float* work, lapack_int lwork,
+    lapack_int* info )
+{
+    LAPACK_sgeqrf( &m, &n, A, &lda, tau, work, &lwork, info );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, double version.
+/// @ingroup geqrf_batch_internal
+inline void geqrf(
+    lapack_int m, lapack_int n,
+    double* A, lapack_int lda,
+    double* tau,
+    double* work, lapack_int lwork,
+    lapack_int* info )
+{
+    LAPACK_dgeqrf( &m, &n, A, &lda, tau, work, &lwork, info );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, complex<float> version.
+/// @ingroup geqrf_batch_internal
+inline void geqrf(
+    lapack_int m, lapack_int n,
+    std::complex<float>* A, lapack_int lda,
+    std::complex<float>* tau,
+    std::complex<float>* work, lapack_int lwork,
+    lapack_int* info )
+{
+    LAPACK_cgeqrf(
+        &m, &n,
+        (lapack_complex_float*) A, &lda,
+        (lapack_complex_float*) tau,
+        (lapack_complex_float*) work, &lwork, info );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, complex<double> version.
+/// @ingroup geqrf_batch_internal
+inline void geqrf(
+    lapack_int m, lapack_int n,
+    std::complex<double>* A, lapack_int lda,
+    std::complex<double>* tau,
+    std::complex<double>* work, lapack_int lwork,
+    lapack_int* info )
+{
+    LAPACK_zgeqrf(
+        &m, &n,
+        (lapack_complex_double*) A, &lda,
+        (lapack_complex_double*) tau,
+        (lapack_complex_double*) work, &lwork, info );
+}
+
+}  // namespace internal
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks and converts arguments once,
+/// queries workspace once for the largest matrix, then factors each
+/// matrix in parallel, with one workspace per thread.
+/// m(i), n(i), lda(i) return the dimensions of the i-th matrix, and
+/// Aarray(i), tau_array(i) return pointers to its data.
+/// @ingroup geqrf_batch_internal
+///
+template <typename scalar_t, typename dim_t,
+          typename Aarray_t, typename tau_array_t>
+void geqrf_batch(
+    dim_t m, dim_t n,
+    Aarray_t Aarray, dim_t lda,
+    tau_array_t tau_array,
+    int64_t batch_count, int64_t* info )
+{
+    lapack_error_if( batch_count < 0 );
+
+    int64_t m_max = 0, n_max = 0, lda_max = 1;
+    for (int64_t i = 0; i < batch_count; ++i) {
+        lapack_error_if( m( i ) < 0 );
+        lapack_error_if( n( i ) < 0 );
+        lapack_error_if( lda( i ) < max( 1, m( i ) ) );
+        m_max   = max( m_max,   m( i ) );
+        n_max   = max( n_max,   n( i ) );
+        lda_max = max( lda_max, lda( i ) );
+    }
+    // After these, all dimensions fit in lapack_int.
+    to_lapack_int( m_max );
+    to_lapack_int( n_max );
+    to_lapack_int( lda_max );
+
+    // One query for the largest matrix; geqrf's lwork grows with n.
+    int64_t lwork;
+    geqrf_work_size( m_max, n_max, (scalar_t*) nullptr, max( 1, m_max ),
+                     (scalar_t*) nullptr, &lwork );
+    lapack_int lwork_ = to_lapack_int( lwork );
+
+    #pragma omp parallel if (batch_count > 1)
+    {
+        lapack::vector< scalar_t > work( max( 1, lwork ) );
+
+        #pragma omp for schedule( dynamic, 1 )
+        for (int64_t i = 0; i < batch_count; ++i) {
+            lapack_int info_ = 0;
+            internal::geqrf(
+                lapack_int( m( i ) ), lapack_int( n( i ) ),
+                Aarray( i ), lapack_int( lda( i ) ), tau_array( i ),
+                &work[0], lwork_, &info_ );
+            info[ i ] = info_;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Strided version: matrix i is A + i*strideA, tau_i is tau + i*stride_tau.
+/// @ingroup geqrf_batch_internal
+///
+template <typename scalar_t>
+void geqrf_batch(
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda, int64_t strideA,
+    scalar_t* tau, int64_t stride_tau,
+    int64_t batch_count, int64_t* info )
+{
+    if (batch_count > 1) {
+        lapack_error_if( strideA < lda*n );
+        lapack_error_if( stride_tau < min( m, n ) );
+    }
+
+    geqrf_batch< scalar_t >(
+        internal::batch_value{ m }, internal::batch_value{ n },
+        [=]( int64_t i ) { return A + i*strideA; },
+        internal::batch_value{ lda },
+        [=]( int64_t i ) { return tau + i*stride_tau; },
+        batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// Pointer-array version: matrix i is Aarray[ i ], tau_i is tau_array[ i ].
+/// @ingroup geqrf_batch_internal
+///
+template <typename scalar_t>
+void geqrf_batch(
+    int64_t m, int64_t n,
+    scalar_t* const* Aarray, int64_t lda,
+    scalar_t* const* tau_array,
+    int64_t batch_count, int64_t* info )
+{
+    geqrf_batch< scalar_t >(
+        internal::batch_value{ m }, internal::batch_value{ n },
+        [=]( int64_t i ) { return Aarray[ i ]; },
+        internal::batch_value{ lda },
+        [=]( int64_t i ) { return tau_array[ i ]; },
+        batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// Variable-size version: matrix i is m[ i ]-by-n[ i ].
+/// @ingroup geqrf_batch_internal
+///
+template <typename scalar_t>
+void geqrf_vbatch(
+    int64_t const* m, int64_t const* n,
+    scalar_t* const* Aarray, int64_t const* lda,
+    scalar_t* const* tau_array,
+    int64_t batch_count, int64_t* info )
+{
+    geqrf_batch< scalar_t >(
+        internal::batch_array{ m }, internal::batch_array{ n },
+        [=]( int64_t i ) { return Aarray[ i ]; },
+        internal::batch_array{ lda },
+        [=]( int64_t i ) { return tau_array[ i ]; },
+        batch_count, info );
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// @ingroup geqrf_batch
+void geqrf_batch(
+    int64_t m, int64_t n,
+    float* A, int64_t lda, int64_t strideA,
+    float* tau, int64_t stride_tau,
+    int64_t batch_count, int64_t* info )
+{
+    impl::geqrf_batch( m, n, A, lda, strideA, tau, stride_tau,
+                       batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup geqrf_batch
+void geqrf_batch(
+    int64_t m, int64_t n,
+    double* A, int64_t lda, int64_t strideA,
+    double* tau, int64_t stride_tau,
+    int64_t batch_count, int64_t* info )
+{
+    impl::geqrf_batch( m, n, A, lda, strideA, tau, stride_tau,
+                       batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup geqrf_batch
+void geqrf_batch(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    std::complex<float>* tau, int64_t stride_tau,
+    int64_t batch_count, int64_t* info )
+{
+    impl::geqrf_batch( m, n, A, lda, strideA, tau, stride_tau,
+                       batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// Computes QR factorizations of a batch of general m-by-n matrices,
+/// $A_i = Q_i R_i$, as in lapack::geqrf.
+/// Matrices are factored in parallel using OpenMP. The workspace size
+/// is queried once for the batch, and each thread allocates one
+/// workspace that it reuses for all its matrices.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`,
+/// for strided storage (shown here), pointer-array storage:
+///
+///     geqrf_batch( m, n, Aarray, lda, tau_array, batch_count, info )
+///
+/// and variable-size pointer-array storage, where the i-th matrix
+/// is m[ i ]-by-n[ i ], with leading dimension lda[ i ]:
+///
+///     geqrf_vbatch( m, n, Aarray, lda, tau_array, batch_count, info )
+///
+/// @param[in] m
+///     The number of rows of each matrix A_i. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of each matrix A_i. n >= 0.
+///
+/// @param[in,out] A
+///     The batch of m-by-n matrices, each stored in an lda-by-n array,
+///     with A_i starting at A + i*strideA.
+///     On exit, the elements on and above the diagonal of A_i contain
+///     R_i, and the elements below the diagonal, with tau_i, represent
+///     Q_i as a product of elementary reflectors, as in lapack::geqrf.
+///
+/// @param[in] lda
+///     The leading dimension of each A_i. lda >= max(1,m).
+///
+/// @param[in] strideA
+///     Distance between the starts of consecutive matrices.
+///     strideA >= lda*n.
+///
+/// @param[out] tau
+///     The batch of vectors tau_i, each of length min(m,n),
+///     with tau_i starting at tau + i*stride_tau.
+///
+/// @param[in] stride_tau
+///     Distance between the starts of consecutive tau vectors.
+///     stride_tau >= min(m,n).
+///
+/// @param[in] batch_count
+///     The number of matrices. batch_count >= 0.
+///
+/// @param[out] info
+///     The vector info of length batch_count.
+///     info[ i ] = 0: successful exit.
+///
+/// Invalid arguments throw lapack::Error.
+///
+/// @ingroup geqrf_batch
+void geqrf_batch(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    std::complex<double>* tau, int64_t stride_tau,
+    int64_t batch_count, int64_t* info )
+{
+    impl::geqrf_batch( m, n, A, lda, strideA, tau, stride_tau,
+                       batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup geqrf_batch
+void geqrf_batch(
+    int64_t m, int64_t n,
+    float* const* Aarray, int64_t lda,
+    float* const* tau_array,
+    int64_t batch_count, int64_t* info )
+{
+    impl::geqrf_batch( m, n, Aarray, lda, tau_array, batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup geqrf_batch
+void geqrf_batch(
+    int64_t m, int64_t n,
+    double* const* Aarray, int64_t lda,
+    double* const* tau_array,
+    int64_t batch_count, int64_t* info )
+{
+    impl::geqrf_batch( m, n, Aarray, lda, tau_array, batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup geqrf_batch
+void geqrf_batch(
+    int64_t m, int64_t n,
+    std::complex<float>* const* Aarray, int64_t lda,
+    std::complex<float>* const* tau_array,
+    int64_t batch_count, int64_t* info )
+{
+    impl::geqrf_batch( m, n, Aarray, lda, tau_array, batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup geqrf_batch
+void geqrf_batch(
+    int64_t m, int64_t n,
+    std::complex<double>* const* Aarray, int64_t lda,
+    std::complex<double>* const* tau_array,
+    int64_t batch_count, int64_t* info )
+{
+    impl::geqrf_batch( m, n, Aarray, lda, tau_array, batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup geqrf_batch
+void geqrf_vbatch(
+    int64_t const* m, int64_t const* n,
+    float* const* Aarray, int64_t const* lda,
+    float* const* tau_array,
+    int64_t batch_count, int64_t* info )
+{
+    impl::geqrf_vbatch( m, n, Aarray, lda, tau_array, batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup geqrf_batch
+void geqrf_vbatch(
+    int64_t const* m, int64_t const* n,
+    double* const* Aarray, int64_t const* lda,
+    double* const* tau_array,
+    int64_t batch_count, int64_t* info )
+{
+    impl::geqrf_vbatch( m, n, Aarray, lda, tau_array, batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup geqrf_batch
+void geqrf_vbatch(
+    int64_t const* m, int64_t const* n,
+    std::complex<float>* const* Aarray, int64_t const* lda,
+    std::complex<float>* const* tau_array,
+    int64_t batch_count, int64_t* info )
+{
+    impl::geqrf_vbatch( m, n, Aarray, lda, tau_array, batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup geqrf_batch
+void geqrf_vbatch(
+    int64_t const* m, int64_t const* n,
+    std::complex<double>* const* Aarray, int64_t const* lda,
+    std::complex<double>* const* tau_array,
+    int64_t batch_count, int64_t* info )
+{
+    impl::geqrf_vbatch( m, n, Aarray, lda, tau_array, batch_count, info );
+}
+
+}  // namespace lapack
@@ -0,0 +1,258 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "NoConstructAllocator.hh"
+#include "rank_update.hh"
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+using blas::real;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks arguments, then inserts the k
+/// rows in turn. Appending row w^T to A adds conj( w ) w^T to A^H A,
+/// so each row is a rank-1 update of R with w.
+/// @ingroup geqrf
+///
+template <typename scalar_t>
+int64_t geqrf_insert_rows(
+    int64_t n, int64_t k,
+    scalar_t* A, int64_t lda,
+    scalar_t const* W, int64_t ldw )
+{
+    lapack_error_if( n < 0 );
+    lapack_error_if( k < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( ldw < max( 1, k ) );
+
+    if (n == 0)
+        return 0;
+
+    lapack::vector< scalar_t > w( n );
+    for (int64_t i = 0; i < k; ++i) {
+        for (int64_t j = 0; j < n; ++j)
+            w[ j ] = W[ i + j*ldw ];
+        internal::rank1_update( Uplo::Upper, n, A, lda, &w[0] );
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks arguments, then deletes the k
+/// rows in turn, stopping at the first that fails. Each is a rank-1
+/// downdate of R with x = conj( w ).
+/// @ingroup geqrf
+///
+template <typename scalar_t>
+int64_t geqrf_delete_rows(
+    int64_t n, int64_t k,
+    scalar_t* A, int64_t lda,
+    scalar_t const* W, int64_t ldw )
+{
+    lapack_error_if( n < 0 );
+    lapack_error_if( k < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( ldw < max( 1, k ) );
+
+    if (n == 0)
+        return 0;
+
+    lapack::vector< scalar_t > work( 2*n );
+    scalar_t* p = &work[ 0 ];
+    scalar_t* e = &work[ n ];
+    for (int64_t i = 0; i < k; ++i) {
+        for (int64_t j = 0; j < n; ++j)
+            p[ j ] = blas::conj( W[ i + j*ldw ] );
+        if (internal::rank1_downdate( Uplo::Upper, n, A, lda, p, e ) != 0)
+            return i + 1;
+    }
+    return 0;
+}
+
+}  // namespace impl
+
+//==============================================================================
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t geqrf_insert_rows(
+    int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* W, int64_t ldw )
+{
+    return impl::geqrf_insert_rows( n, k, A, lda, W, ldw );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t geqrf_insert_rows(
+    int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* W, int64_t ldw )
+{
+    return impl::geqrf_insert_rows( n, k, A, lda, W, ldw );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t geqrf_insert_rows(
+    int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* W, int64_t ldw )
+{
+    return impl::geqrf_insert_rows( n, k, A, lda, W, ldw );
+}
+
+// -----------------------------------------------------------------------------
+/// Updates the R factor of a QR factorization, as computed by
+/// lapack::geqrf of an m-by-n matrix A, m >= n, to that of A with k rows
+/// appended:
+/// \[
+///     \tilde{A} = \begin{bmatrix} A
+///                 \\              W
+///                 \end{bmatrix}
+///     = \tilde{Q} \begin{bmatrix} \tilde{R}
+///                 \\              0
+///                 \end{bmatrix},
+/// \]
+/// where W is k-by-n. Rows may be appended in any order, since row order
+/// does not affect R. This takes $O(k n^2)$ operations, using n plane
+/// rotations per row, computed by lapack::lartg.
+///
+/// Only R is updated; Q is not formed. The Householder vectors below
+/// the diagonal and tau no longer represent $\tilde{Q}$ and should not
+/// be used. To solve least squares problems min || A x - b || as rows
+/// arrive, factor the augmented matrix [ A, b ], with n+1 columns,
+/// and insert augmented rows [ w, beta ]. Then the leading n-by-n block
+/// of R and the first n entries of its last column give the solution by
+/// lapack::trtrs, and |R(n, n)| is the residual norm.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. n >= 0.
+///
+/// @param[in] k
+///     The number of rows to insert. k >= 0.
+///
+/// @param[in,out] A
+///     The n-by-n matrix R, stored in the upper triangle of an
+///     lda-by-n array, as returned by lapack::geqrf.
+///     On exit, the upper triangle contains $\tilde{R}$.
+///     The strictly lower triangle is not referenced.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[in] W
+///     The k-by-n matrix W of rows to insert, stored in an ldw-by-n array.
+///
+/// @param[in] ldw
+///     The leading dimension of the array W. ldw >= max(1,k).
+///
+/// @return = 0: successful exit
+///
+/// @ingroup geqrf
+int64_t geqrf_insert_rows(
+    int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* W, int64_t ldw )
+{
+    return impl::geqrf_insert_rows( n, k, A, lda, W, ldw );
+}
+
+//==============================================================================
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t geqrf_delete_rows(
+    int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* W, int64_t ldw )
+{
+    return impl::geqrf_delete_rows( n, k, A, lda, W, ldw );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t geqrf_delete_rows(
+    int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* W, int64_t ldw )
+{
+    return impl::geqrf_delete_rows( n, k, A, lda, W, ldw );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t geqrf_delete_rows(
+    int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* W, int64_t ldw )
+{
+    return impl::geqrf_delete_rows( n, k, A, lda, W, ldw );
+}
+
+// -----------------------------------------------------------------------------
+/// Downdates the R factor of a QR factorization, as computed by
+/// lapack::geqrf of an m-by-n matrix A, m >= n, to that of A with k
+/// of its rows, given in the k-by-n matrix W, deleted. Since
+/// $\tilde{A}^H \tilde{A} = A^H A - W^H W$, this is a rank-k downdate
+/// of R, applied as in LINPACK xCHDD, taking $O(k n^2)$ operations.
+/// $\tilde{R}$ may differ from the R of lapack::geqrf applied to
+/// $\tilde{A}$ by the signs (phases) of its rows.
+///
+/// Only R is updated; Q is not formed. As with lapack::geqrf_insert_rows,
+/// the Householder vectors and tau are no longer valid, and augmenting
+/// A with right-hand sides b gives sliding-window least squares.
+/// The accuracy depends on the condition of $\tilde{A}$.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. n >= 0.
+///
+/// @param[in] k
+///     The number of rows to delete. k >= 0.
+///
+/// @param[in,out] A
+///     The n-by-n matrix R, stored in the upper triangle of an
+///     lda-by-n array, as returned by lapack::geqrf.
+///     On exit, if return value = 0, the upper triangle contains
+///     $\tilde{R}$. If return value = i > 0, it contains R with the
+///     first i-1 rows of W deleted.
+///     The strictly lower triangle is not referenced.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[in] W
+///     The k-by-n matrix W of rows to delete, stored in an ldw-by-n array.
+///
+/// @param[in] ldw
+///     The leading dimension of the array W. ldw >= max(1,k).
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, R is singular or deleting row i
+///     of W would leave A without full column rank, so that row and
+///     later rows were not deleted.
+///
+/// @ingroup geqrf
+int64_t geqrf_delete_rows(
+    int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* W, int64_t ldw )
+{
+    return impl::geqrf_delete_rows( n, k, A, lda, W, ldw );
+}
+
+}  // namespace lapack
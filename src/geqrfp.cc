@@ -24,12 +24,97 @@ int64_t geqrfp(
     float* A, int64_t lda,
     float* tau )
 {
+    // query for workspace size
+    int64_t lwork;
+    geqrfp_work_size(
+        m, n, A, lda, tau,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return geqrfp(
+        m, n, A, lda, tau,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t geqrfp(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau )
+{
+    // query for workspace size
+    int64_t lwork;
+    geqrfp_work_size(
+        m, n, A, lda, tau,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return geqrfp(
+        m, n, A, lda, tau,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t geqrfp(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau )
+{
+    // query for workspace size
+    int64_t lwork;
+    geqrfp_work_size(
+        m, n, A, lda, tau,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+
+    return geqrfp(
+        m, n, A, lda, tau,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t geqrfp(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau )
+{
+    // query for workspace size
+    int64_t lwork;
+    geqrfp_work_size(
+        m, n, A, lda, tau,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+
+    return geqrfp(
+        m, n, A, lda, tau,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+void geqrfp_work_size(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "sgeqrfp", m, n, lda );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
 
-    // query for workspace size
     float qry_work[1];
     lapack_int ineg_one = -1;
     LAPACK_sgeqrfp(
@@ -40,54 +125,122 @@ int64_t geqrfp(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+void geqrfp_work_size(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* tau,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "dgeqrfp", m, n, lda );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
 
-    LAPACK_sgeqrfp(
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dgeqrfp(
         &m_, &n_,
         A, &lda_,
         tau,
-        &work[0], &lwork_, &info_ );
+        qry_work, &ineg_one, &info_ );
     if (info_ < 0) {
         throw Error();
     }
-    return info_;
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
 }
 
 // -----------------------------------------------------------------------------
-int64_t geqrfp(
+void geqrfp_work_size(
     int64_t m, int64_t n,
-    double* A, int64_t lda,
-    double* tau )
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    int64_t* lwork )
 {
+    auto key = internal::work_size_key(
+        "cgeqrfp", m, n, lda );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
+    std::complex<float> qry_work[1];
     lapack_int ineg_one = -1;
-    LAPACK_dgeqrfp(
+    LAPACK_cgeqrfp(
         &m_, &n_,
-        A, &lda_,
-        tau,
-        qry_work, &ineg_one, &info_ );
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) tau,
+        (lapack_complex_float*) qry_work, &ineg_one, &info_ );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+void geqrfp_work_size(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "zgeqrfp", m, n, lda );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
 
-    LAPACK_dgeqrfp(
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+
+    std::complex<double> qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_zgeqrfp(
+        &m_, &n_,
+        (lapack_complex_double*) A, &lda_,
+        (lapack_complex_double*) tau,
+        (lapack_complex_double*) qry_work, &ineg_one, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t geqrfp(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* tau,
+    float* work, int64_t lwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geqrfp", float, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+
+    LAPACK_sgeqrfp(
         &m_, &n_,
         A, &lda_,
         tau,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -97,35 +250,47 @@ int64_t geqrfp(
 // -----------------------------------------------------------------------------
 int64_t geqrfp(
     int64_t m, int64_t n,
-    std::complex<float>* A, int64_t lda,
-    std::complex<float>* tau )
+    double* A, int64_t lda,
+    double* tau,
+    double* work, int64_t lwork )
 {
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geqrfp", double, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cgeqrfp(
+    LAPACK_dgeqrfp(
         &m_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) tau,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_ );
+        A, &lda_,
+        tau,
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+// -----------------------------------------------------------------------------
+int64_t geqrfp(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    std::complex<float>* work, int64_t lwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geqrfp", std::complex<float>, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
     LAPACK_cgeqrfp(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
         (lapack_complex_float*) tau,
-        (lapack_complex_float*) &work[0], &lwork_, &info_ );
+        (lapack_complex_float*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -136,34 +301,21 @@ int64_t geqrfp(
 int64_t geqrfp(
     int64_t m, int64_t n,
     std::complex<double>* A, int64_t lda,
-    std::complex<double>* tau )
+    std::complex<double>* tau,
+    std::complex<double>* work, int64_t lwork )
 {
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
-
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgeqrfp(
-        &m_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) tau,
-        (lapack_complex_double*) qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+    LAPACK_TRACE_BLOCK( "geqrfp", std::complex<double>, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
     LAPACK_zgeqrfp(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
         (lapack_complex_double*) tau,
-        (lapack_complex_double*) &work[0], &lwork_, &info_ );
+        (lapack_complex_double*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -30,6 +30,7 @@ int64_t geqrt(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldt_ = to_lapack_int( ldt );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geqrt", float, m, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (nb*n) );
@@ -57,6 +58,7 @@ int64_t geqrt(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldt_ = to_lapack_int( ldt );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geqrt", double, m, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (nb*n) );
@@ -84,6 +86,7 @@ int64_t geqrt(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldt_ = to_lapack_int( ldt );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geqrt", std::complex<float>, m, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<float> > work( (nb*n) );
@@ -111,6 +114,7 @@ int64_t geqrt(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldt_ = to_lapack_int( ldt );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geqrt", std::complex<double>, m, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (nb*n) );
@@ -28,6 +28,7 @@ int64_t geqrt3(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldt_ = to_lapack_int( ldt );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geqrt3", float, m, n, 0, 0, info_ );
 
     LAPACK_sgeqrt3(
         &m_, &n_,
@@ -50,6 +51,7 @@ int64_t geqrt3(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldt_ = to_lapack_int( ldt );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geqrt3", double, m, n, 0, 0, info_ );
 
     LAPACK_dgeqrt3(
         &m_, &n_,
@@ -72,6 +74,7 @@ int64_t geqrt3(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldt_ = to_lapack_int( ldt );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geqrt3", std::complex<float>, m, n, 0, 0, info_ );
 
     LAPACK_cgeqrt3(
         &m_, &n_,
@@ -94,6 +97,7 @@ int64_t geqrt3(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldt_ = to_lapack_int( ldt );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "geqrt3", std::complex<double>, m, n, 0, 0, info_ );
 
     LAPACK_zgeqrt3(
         &m_, &n_,
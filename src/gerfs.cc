@@ -35,7 +35,8 @@ int64_t gerfs(
     lapack_int ldaf_ = to_lapack_int( ldaf );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( max( 1, (n) ) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -43,6 +44,7 @@ int64_t gerfs(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int ldx_ = to_lapack_int( ldx );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gerfs", float, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (3*n) );
@@ -85,7 +87,8 @@ int64_t gerfs(
     lapack_int ldaf_ = to_lapack_int( ldaf );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( max( 1, (n) ) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -93,6 +96,7 @@ int64_t gerfs(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int ldx_ = to_lapack_int( ldx );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gerfs", double, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (3*n) );
@@ -135,7 +139,8 @@ int64_t gerfs(
     lapack_int ldaf_ = to_lapack_int( ldaf );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( max( 1, (n) ) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -143,6 +148,7 @@ int64_t gerfs(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int ldx_ = to_lapack_int( ldx );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gerfs", std::complex<float>, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
@@ -259,7 +265,8 @@ int64_t gerfs(
     lapack_int ldaf_ = to_lapack_int( ldaf );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( max( 1, (n) ) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -267,6 +274,7 @@ int64_t gerfs(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int ldx_ = to_lapack_int( ldx );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gerfs", std::complex<double>, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
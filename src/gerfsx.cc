@@ -53,6 +53,7 @@ int64_t gerfsx(
     lapack_int n_err_bnds_ = to_lapack_int( n_err_bnds );
     lapack_int nparams_ = to_lapack_int( nparams );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gerfsx", float, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (4*n) );
@@ -115,6 +116,7 @@ int64_t gerfsx(
     lapack_int n_err_bnds_ = to_lapack_int( n_err_bnds );
     lapack_int nparams_ = to_lapack_int( nparams );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gerfsx", double, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (4*n) );
@@ -177,6 +179,7 @@ int64_t gerfsx(
     lapack_int n_err_bnds_ = to_lapack_int( n_err_bnds );
     lapack_int nparams_ = to_lapack_int( nparams );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gerfsx", std::complex<float>, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
@@ -511,6 +514,7 @@ int64_t gerfsx(
     lapack_int n_err_bnds_ = to_lapack_int( n_err_bnds );
     lapack_int nparams_ = to_lapack_int( nparams );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gerfsx", std::complex<double>, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
@@ -25,49 +25,19 @@ int64_t gesdd(
     float* U, int64_t ldu,
     float* VT, int64_t ldvt )
 {
-    char jobz_ = to_char( jobz );
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int ldu_ = to_lapack_int( ldu );
-    lapack_int ldvt_ = to_lapack_int( ldvt );
-    lapack_int info_ = 0;
-
     // query for workspace size
-    float qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgesdd(
-        &jobz_, &m_, &n_,
-        A, &lda_,
-        S,
-        U, &ldu_,
-        VT, &ldvt_,
-        qry_work, &ineg_one,
-        qry_iwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork, liwork;
+    gesdd_work_size(
+        jobz, m, n, A, lda, S, U, ldu, VT, ldvt,
+        &lwork, &liwork );
 
     // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (8*min(m,n)) );
+    lapack::vector< float > work( lwork );
+    lapack::vector< int64_t > iwork( liwork );
 
-    LAPACK_sgesdd(
-        &jobz_, &m_, &n_,
-        A, &lda_,
-        S,
-        U, &ldu_,
-        VT, &ldvt_,
-        &work[0], &lwork_,
-        &iwork[0], &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return gesdd(
+        jobz, m, n, A, lda, S, U, ldu, VT, ldvt,
+        &work[0], lwork, &iwork[0], liwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -79,49 +49,19 @@ int64_t gesdd(
     double* U, int64_t ldu,
     double* VT, int64_t ldvt )
 {
-    char jobz_ = to_char( jobz );
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int ldu_ = to_lapack_int( ldu );
-    lapack_int ldvt_ = to_lapack_int( ldvt );
-    lapack_int info_ = 0;
-
     // query for workspace size
-    double qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgesdd(
-        &jobz_, &m_, &n_,
-        A, &lda_,
-        S,
-        U, &ldu_,
-        VT, &ldvt_,
-        qry_work, &ineg_one,
-        qry_iwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork, liwork;
+    gesdd_work_size(
+        jobz, m, n, A, lda, S, U, ldu, VT, ldvt,
+        &lwork, &liwork );
 
     // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (8*min(m,n)) );
+    lapack::vector< double > work( lwork );
+    lapack::vector< int64_t > iwork( liwork );
 
-    LAPACK_dgesdd(
-        &jobz_, &m_, &n_,
-        A, &lda_,
-        S,
-        U, &ldu_,
-        VT, &ldvt_,
-        &work[0], &lwork_,
-        &iwork[0], &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return gesdd(
+        jobz, m, n, A, lda, S, U, ldu, VT, ldvt,
+        &work[0], lwork, &iwork[0], liwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -133,66 +73,20 @@ int64_t gesdd(
     std::complex<float>* U, int64_t ldu,
     std::complex<float>* VT, int64_t ldvt )
 {
-    char jobz_ = to_char( jobz );
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int ldu_ = to_lapack_int( ldu );
-    lapack_int ldvt_ = to_lapack_int( ldvt );
-    lapack_int info_ = 0;
-
     // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1] = { 0 };
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cgesdd(
-        &jobz_, &m_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        S,
-        (lapack_complex_float*) U, &ldu_,
-        (lapack_complex_float*) VT, &ldvt_,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork,
-        qry_iwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = qry_rwork[0];
-    if (lrwork_ == 0) {
-        // if query doesn't work, this is from documentation
-        lapack_int mx = max( m, n );
-        lapack_int mn = min( m, n );
-        if (jobz == lapack::Job::NoVec) {
-            lrwork_ = 7*mn;  // LAPACK > 3.6 needs only 5*mn
-        }
-        else {
-            lrwork_ = max( 5*mn*mn + 5*mn, 2*mx*mn + 2*mn*mn + mn );
-        }
-        lrwork_ = max( 1, lrwork_ );
-    }
+    int64_t lwork, lrwork, liwork;
+    gesdd_work_size(
+        jobz, m, n, A, lda, S, U, ldu, VT, ldvt,
+        &lwork, &lrwork, &liwork );
 
     // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( (8*min(m,n)) );
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+    lapack::vector< int64_t > iwork( liwork );
 
-    LAPACK_cgesdd(
-        &jobz_, &m_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        S,
-        (lapack_complex_float*) U, &ldu_,
-        (lapack_complex_float*) VT, &ldvt_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0],
-        &iwork[0], &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return gesdd(
+        jobz, m, n, A, lda, S, U, ldu, VT, ldvt,
+        &work[0], lwork, &rwork[0], lrwork, &iwork[0], liwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -310,6 +204,201 @@ int64_t gesdd(
     std::complex<double>* U, int64_t ldu,
     std::complex<double>* VT, int64_t ldvt )
 {
+    // query for workspace size
+    int64_t lwork, lrwork, liwork;
+    gesdd_work_size(
+        jobz, m, n, A, lda, S, U, ldu, VT, ldvt,
+        &lwork, &lrwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+    lapack::vector< int64_t > iwork( liwork );
+
+    return gesdd(
+        jobz, m, n, A, lda, S, U, ldu, VT, ldvt,
+        &work[0], lwork, &rwork[0], lrwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+void gesdd_work_size(
+    lapack::Job jobz, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt,
+    int64_t* lwork, int64_t* liwork )
+{
+    auto key = internal::work_size_key(
+        "sgesdd", jobz, m, n, lda, ldu, ldvt );
+    if (internal::work_size_cache_find( key, lwork, liwork ))
+        return;
+
+    char jobz_ = to_char( jobz );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldu_ = to_lapack_int( ldu );
+    lapack_int ldvt_ = to_lapack_int( ldvt );
+    lapack_int info_ = 0;
+
+    float qry_work[1];
+    lapack_int qry_iwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_sgesdd(
+        &jobz_, &m_, &n_,
+        A, &lda_,
+        S,
+        U, &ldu_,
+        VT, &ldvt_,
+        qry_work, &ineg_one,
+        qry_iwork, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    *liwork = 8*min(m,n);
+    internal::work_size_cache_insert( key, *lwork, *liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+void gesdd_work_size(
+    lapack::Job jobz, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt,
+    int64_t* lwork, int64_t* liwork )
+{
+    auto key = internal::work_size_key(
+        "dgesdd", jobz, m, n, lda, ldu, ldvt );
+    if (internal::work_size_cache_find( key, lwork, liwork ))
+        return;
+
+    char jobz_ = to_char( jobz );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldu_ = to_lapack_int( ldu );
+    lapack_int ldvt_ = to_lapack_int( ldvt );
+    lapack_int info_ = 0;
+
+    double qry_work[1];
+    lapack_int qry_iwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dgesdd(
+        &jobz_, &m_, &n_,
+        A, &lda_,
+        S,
+        U, &ldu_,
+        VT, &ldvt_,
+        qry_work, &ineg_one,
+        qry_iwork, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    *liwork = 8*min(m,n);
+    internal::work_size_cache_insert( key, *lwork, *liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+void gesdd_work_size(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
+{
+    auto key = internal::work_size_key(
+        "cgesdd", jobz, m, n, lda, ldu, ldvt );
+    if (internal::work_size_cache_find( key, lwork, lrwork, liwork ))
+        return;
+
+    char jobz_ = to_char( jobz );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldu_ = to_lapack_int( ldu );
+    lapack_int ldvt_ = to_lapack_int( ldvt );
+    lapack_int info_ = 0;
+
+    std::complex<float> qry_work[1];
+    float qry_rwork[1] = { 0 };
+    lapack_int qry_iwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_cgesdd(
+        &jobz_, &m_, &n_,
+        (lapack_complex_float*) A, &lda_,
+        S,
+        (lapack_complex_float*) U, &ldu_,
+        (lapack_complex_float*) VT, &ldvt_,
+        (lapack_complex_float*) qry_work, &ineg_one,
+        qry_rwork,
+        qry_iwork, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    lapack_int lrwork_ = qry_rwork[0];
+    if (lrwork_ == 0) {
+        // if query doesn't work, this is from documentation
+        lapack_int mx = max( m, n );
+        lapack_int mn = min( m, n );
+        if (jobz == lapack::Job::NoVec) {
+            lrwork_ = 7*mn;  // LAPACK > 3.6 needs only 5*mn
+        }
+        else {
+            lrwork_ = max( 5*mn*mn + 5*mn, 2*mx*mn + 2*mn*mn + mn );
+        }
+        lrwork_ = max( 1, lrwork_ );
+    }
+    *lrwork = lrwork_;
+    *liwork = 8*min(m,n);
+    internal::work_size_cache_insert( key, *lwork, *lrwork, *liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::gesdd with caller-provided workspace.
+/// Returns the array lengths that the workspace overload of `gesdd`
+/// requires, so the workspace can be allocated once, outside a loop.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// Other arguments are the same as for lapack::gesdd.
+/// Arrays are used only to select the precision and are not referenced.
+///
+/// @param[out] lwork
+///     The optimal length of the array work.
+///
+/// @param[out] lrwork
+///     The optimal length of the array rwork.
+///
+/// @param[out] liwork
+///     The length of the array iwork, 8*min(m,n).
+///
+/// @ingroup gesvd
+void gesdd_work_size(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
+{
+    auto key = internal::work_size_key(
+        "zgesdd", jobz, m, n, lda, ldu, ldvt );
+    if (internal::work_size_cache_find( key, lwork, lrwork, liwork ))
+        return;
+
     char jobz_ = to_char( jobz );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -318,7 +407,6 @@ int64_t gesdd(
     lapack_int ldvt_ = to_lapack_int( ldvt );
     lapack_int info_ = 0;
 
-    // query for workspace size
     std::complex<double> qry_work[1];
     double qry_rwork[1] = { 0 };
     lapack_int qry_iwork[1];
@@ -336,7 +424,7 @@ int64_t gesdd(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
     lapack_int lrwork_ = qry_rwork[0];
     if (lrwork_ == 0) {
         // if query doesn't work, this is from documentation
@@ -350,11 +438,205 @@ int64_t gesdd(
         }
         lrwork_ = max( 1, lrwork_ );
     }
+    *lrwork = lrwork_;
+    *liwork = 8*min(m,n);
+    internal::work_size_cache_insert( key, *lwork, *lrwork, *liwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( (8*min(m,n)) );
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesdd(
+    lapack::Job jobz, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    char jobz_ = to_char( jobz );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldu_ = to_lapack_int( ldu );
+    lapack_int ldvt_ = to_lapack_int( ldvt );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gesdd", float, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( liwork < 8*min(m,n) );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
+
+    LAPACK_sgesdd(
+        &jobz_, &m_, &n_,
+        A, &lda_,
+        S,
+        U, &ldu_,
+        VT, &ldvt_,
+        work, &lwork_,
+        iwork_, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesdd(
+    lapack::Job jobz, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    char jobz_ = to_char( jobz );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldu_ = to_lapack_int( ldu );
+    lapack_int ldvt_ = to_lapack_int( ldvt );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gesdd", double, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( liwork < 8*min(m,n) );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
+
+    LAPACK_dgesdd(
+        &jobz_, &m_, &n_,
+        A, &lda_,
+        S,
+        U, &ldu_,
+        VT, &ldvt_,
+        work, &lwork_,
+        iwork_, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesdd(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork )
+{
+    char jobz_ = to_char( jobz );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldu_ = to_lapack_int( ldu );
+    lapack_int ldvt_ = to_lapack_int( ldvt );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gesdd", std::complex<float>, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    {
+        // LAPACK doesn't check lrwork, so check the documented minimum
+        int64_t mx = max( m, n );
+        int64_t mn = min( m, n );
+        int64_t lrwork_min = (jobz == lapack::Job::NoVec)
+                           ? 5*mn
+                           : max( 5*mn*mn + 5*mn, 2*mx*mn + 2*mn*mn + mn );
+        lapack_error_if( lrwork < max( 1, lrwork_min ) );
+    }
+    lapack_error_if( liwork < 8*min(m,n) );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
+
+    LAPACK_cgesdd(
+        &jobz_, &m_, &n_,
+        (lapack_complex_float*) A, &lda_,
+        S,
+        (lapack_complex_float*) U, &ldu_,
+        (lapack_complex_float*) VT, &ldvt_,
+        (lapack_complex_float*) work, &lwork_,
+        rwork,
+        iwork_, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::gesdd that takes caller-provided workspace
+/// instead of querying and allocating it on each call.
+/// Use lapack::gesdd_work_size to get the required lengths.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// Other arguments are the same as for lapack::gesdd.
+/// Throws lapack::Error if lrwork or liwork is below its minimum,
+/// or if LAPACK rejects lwork.
+///
+/// @param[out] work
+///     The vector work of length lwork. Workspace.
+///
+/// @param[in] lwork
+///     The length of the array work.
+///     Use the value from lapack::gesdd_work_size for best performance.
+///
+/// @param[out] rwork
+///     The vector rwork of length lrwork. Workspace.
+///
+/// @param[in] lrwork
+///     The length of the array rwork.
+///     Use the value from lapack::gesdd_work_size for best performance.
+///
+/// @param[out] iwork
+///     The vector iwork of length liwork. Workspace.
+///     This is 64-bit for a uniform API; with 32-bit LAPACK integers,
+///     only the first half of its bytes are used.
+///
+/// @param[in] liwork
+///     The length of the array iwork, liwork >= 8*min(m,n).
+///
+/// @ingroup gesvd
+int64_t gesdd(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork )
+{
+    char jobz_ = to_char( jobz );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldu_ = to_lapack_int( ldu );
+    lapack_int ldvt_ = to_lapack_int( ldvt );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gesdd", std::complex<double>, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    {
+        // LAPACK doesn't check lrwork, so check the documented minimum
+        int64_t mx = max( m, n );
+        int64_t mn = min( m, n );
+        int64_t lrwork_min = (jobz == lapack::Job::NoVec)
+                           ? 5*mn
+                           : max( 5*mn*mn + 5*mn, 2*mx*mn + 2*mn*mn + mn );
+        lapack_error_if( lrwork < max( 1, lrwork_min ) );
+    }
+    lapack_error_if( liwork < 8*min(m,n) );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
 
     LAPACK_zgesdd(
         &jobz_, &m_, &n_,
@@ -362,9 +644,9 @@ int64_t gesdd(
         S,
         (lapack_complex_double*) U, &ldu_,
         (lapack_complex_double*) VT, &ldvt_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0],
-        &iwork[0], &info_
+        (lapack_complex_double*) work, &lwork_,
+        rwork,
+        iwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -372,4 +654,123 @@ int64_t gesdd(
     return info_;
 }
 
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper for either layout.
+/// @ingroup gesvd
+///
+template <typename scalar_t>
+int64_t gesdd(
+    lapack::Layout layout, lapack::Job jobz, int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    blas::real_type< scalar_t >* S,
+    scalar_t* U, int64_t ldu,
+    scalar_t* VT, int64_t ldvt )
+{
+    if (layout == Layout::ColMajor)
+        return lapack::gesdd( jobz, m, n, A, lda, S, U, ldu, VT, ldvt );
+
+    lapack_error_if( layout != Layout::RowMajor );
+
+    // Row-major A is column-major A^T. If A^T = U2 S V2^H, then
+    // A = conj( V2 ) S U2^T, where conj( V2 ) read row-major is V2^H,
+    // and U2^T read row-major is U2. So swap U and VT.
+    // With jobz = OverwriteVec, gesdd overwrites A with U2 if n >= m,
+    // which is VT of A, else with V2^H, which is U of A. That matches
+    // column-major except for m == n, where A should be overwritten by U.
+    if (jobz == Job::OverwriteVec && m == n) {
+        // Compute U in VT, then swap A and VT row by row.
+        int64_t info = lapack::gesdd( jobz, n, m, A, lda, S, U, ldu, VT, ldvt );
+        for (int64_t i = 0; i < m; ++i)
+            blas::swap( n, &A[ i*lda ], 1, &VT[ i*ldvt ], 1 );
+        return info;
+    }
+    return lapack::gesdd( jobz, n, m, A, lda, S, VT, ldvt, U, ldu );
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// @ingroup gesvd
+int64_t gesdd(
+    lapack::Layout layout, lapack::Job jobz, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt )
+{
+    return impl::gesdd( layout, jobz, m, n, A, lda, S, U, ldu, VT, ldvt );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesdd(
+    lapack::Layout layout, lapack::Job jobz, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt )
+{
+    return impl::gesdd( layout, jobz, m, n, A, lda, S, U, ldu, VT, ldvt );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesdd(
+    lapack::Layout layout, lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt )
+{
+    return impl::gesdd( layout, jobz, m, n, A, lda, S, U, ldu, VT, ldvt );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::gesdd that takes the matrix layout.
+/// For row-major layout, A, U, and VT are stored row-major.
+///
+/// For row-major, this computes the SVD of the column-major A^T,
+/// swapping the roles of U and VT, so nothing is copied. With
+/// jobz = OverwriteVec and m == n, U and VT are swapped in place afterwards
+/// so A is overwritten by U, as for column-major.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// Other arguments are the same as for lapack::gesdd.
+///
+/// @param[in] layout
+///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
+///
+/// @param[in] lda
+///     The leading dimension of the array A.
+///     If layout = ColMajor, lda >= max(1,m);
+///     if layout = RowMajor, lda >= max(1,n).
+///
+/// @param[in] ldu
+///     The leading dimension of the array U.
+///     If layout = ColMajor, ldu >= max(1,m) if U is computed;
+///     if layout = RowMajor, ldu >= m if U is m-by-m,
+///     ldu >= min(m,n) if U is m-by-min(m,n), else ldu >= 1.
+///
+/// @param[in] ldvt
+///     The leading dimension of the array VT.
+///     If layout = ColMajor, ldvt >= n if VT is n-by-n,
+///     ldvt >= min(m,n) if VT is min(m,n)-by-n, else ldvt >= 1;
+///     if layout = RowMajor, ldvt >= max(1,n) if VT is computed.
+///
+/// @ingroup gesvd
+int64_t gesdd(
+    lapack::Layout layout, lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt )
+{
+    return impl::gesdd( layout, jobz, m, n, A, lda, S, U, ldu, VT, ldvt );
+}
+
 }  // namespace lapack
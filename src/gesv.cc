@@ -28,14 +28,14 @@ int64_t gesv(
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int lda_ = to_lapack_int( lda );
     #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( max( 1, (n) ) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+        // 32-bit pivots in first half of ipiv; widened below
+        lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gesv", float, 0, n, 0, nrhs, info_ );
 
     LAPACK_sgesv(
         &n_, &nrhs_,
@@ -46,7 +46,7 @@ int64_t gesv(
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        widen_pivots( ipiv, n );
     #endif
     return info_;
 }
@@ -63,14 +63,14 @@ int64_t gesv(
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int lda_ = to_lapack_int( lda );
     #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( max( 1, (n) ) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+        // 32-bit pivots in first half of ipiv; widened below
+        lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gesv", double, 0, n, 0, nrhs, info_ );
 
     LAPACK_dgesv(
         &n_, &nrhs_,
@@ -81,7 +81,7 @@ int64_t gesv(
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        widen_pivots( ipiv, n );
     #endif
     return info_;
 }
@@ -98,14 +98,14 @@ int64_t gesv(
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int lda_ = to_lapack_int( lda );
     #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( max( 1, (n) ) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+        // 32-bit pivots in first half of ipiv; widened below
+        lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gesv", std::complex<float>, 0, n, 0, nrhs, info_ );
 
     LAPACK_cgesv(
         &n_, &nrhs_,
@@ -116,7 +116,7 @@ int64_t gesv(
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        widen_pivots( ipiv, n );
     #endif
     return info_;
 }
@@ -182,14 +182,14 @@ int64_t gesv(
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int lda_ = to_lapack_int( lda );
     #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( max( 1, (n) ) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+        // 32-bit pivots in first half of ipiv; widened below
+        lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gesv", std::complex<double>, 0, n, 0, nrhs, info_ );
 
     LAPACK_zgesv(
         &n_, &nrhs_,
@@ -200,7 +200,7 @@ int64_t gesv(
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        widen_pivots( ipiv, n );
     #endif
     return info_;
 }
@@ -218,9 +218,8 @@ int64_t gesv(
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int lda_ = to_lapack_int( lda );
     #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( max( 1, (n) ) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+        // 32-bit pivots in first half of ipiv; widened below
+        lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
@@ -228,6 +227,7 @@ int64_t gesv(
     lapack_int ldx_ = to_lapack_int( ldx );
     lapack_int iter_ = 0;  // out
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gesv", double, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (n)*(nrhs) );
@@ -245,7 +245,7 @@ int64_t gesv(
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        widen_pivots( ipiv, n );
     #endif
     *iter = iter_;
     return info_;
@@ -264,9 +264,8 @@ int64_t gesv(
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int lda_ = to_lapack_int( lda );
     #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( max( 1, (n) ) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+        // 32-bit pivots in first half of ipiv; widened below
+        lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
@@ -274,6 +273,7 @@ int64_t gesv(
     lapack_int ldx_ = to_lapack_int( ldx );
     lapack_int iter_ = 0;  // out
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gesv", std::complex<double>, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (n)*(nrhs) );
@@ -293,10 +293,101 @@ int64_t gesv(
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        widen_pivots( ipiv, n );
     #endif
     *iter = iter_;
     return info_;
 }
 
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper for either layout.
+/// @ingroup gesv
+///
+template <typename scalar_t>
+int64_t gesv(
+    lapack::Layout layout, int64_t n, int64_t nrhs,
+    scalar_t* A, int64_t lda,
+    int64_t* ipiv,
+    scalar_t* B, int64_t ldb )
+{
+    if (layout == Layout::ColMajor)
+        return lapack::gesv( n, nrhs, A, lda, ipiv, B, ldb );
+
+    lapack_error_if( layout != Layout::RowMajor );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( ldb < max( 1, nrhs ) );
+
+    int64_t info = lapack::getrf( layout, n, n, A, lda, ipiv );
+    if (info == 0) {
+        lapack::getrs( layout, Op::NoTrans, n, nrhs, A, lda, ipiv, B, ldb );
+    }
+    return info;
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// @ingroup gesv
+int64_t gesv(
+    lapack::Layout layout, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    float* B, int64_t ldb )
+{
+    return impl::gesv( layout, n, nrhs, A, lda, ipiv, B, ldb );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv
+int64_t gesv(
+    lapack::Layout layout, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double* B, int64_t ldb )
+{
+    return impl::gesv( layout, n, nrhs, A, lda, ipiv, B, ldb );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv
+int64_t gesv(
+    lapack::Layout layout, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb )
+{
+    return impl::gesv( layout, n, nrhs, A, lda, ipiv, B, ldb );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::gesv that takes the matrix layout.
+/// For row-major layout, A, its factors, B, and X are stored row-major.
+/// Calls lapack::getrf and lapack::getrs with the same layout.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// Other arguments are the same as for lapack::gesv.
+///
+/// @param[in] layout
+///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B.
+///     If layout = ColMajor, ldb >= max(1,n);
+///     if layout = RowMajor, ldb >= max(1,nrhs).
+///
+/// @ingroup gesv
+int64_t gesv(
+    lapack::Layout layout, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb )
+{
+    return impl::gesv( layout, n, nrhs, A, lda, ipiv, B, ldb );
+}
+
 }  // namespace lapack
@@ -0,0 +1,245 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "mixed_refine.hh"
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+using blas::real;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks arguments, factors A in the inner
+/// precision, refines each column of X, and falls back to
+/// getrf and getrs in working precision if needed.
+/// @ingroup gesv
+///
+template <typename scalar_t>
+int64_t gesv_mixed(
+    int64_t n, int64_t nrhs,
+    scalar_t const* A, int64_t lda,
+    scalar_t const* B, int64_t ldb,
+    scalar_t* X, int64_t ldx,
+    RefineOptions const& opts,
+    RefineInfo* rinfo )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using inner_t = internal::inner_t< scalar_t >;
+
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( ldb < max( 1, n ) );
+    lapack_error_if( ldx < max( 1, n ) );
+    lapack_error_if( opts.max_iter < 0 );
+    lapack_error_if( opts.gmres_max_iter < 1 );
+
+    RefineInfo rinfo_local;
+    if (rinfo == nullptr)
+        rinfo = &rinfo_local;
+    *rinfo = RefineInfo();
+
+    if (n == 0 || nrhs == 0) {
+        rinfo->converged = true;
+        return 0;
+    }
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = (opts.tol > 0 ? real_t( opts.tol ) : std::sqrt( real_t( n ) ) * eps);
+    real_t Anorm = lapack::lange( Norm::Inf, n, n, A, lda );
+
+    // Factor s A = P L U in the inner precision.
+    real_t s = internal::inner_scale( opts.precision,
+                                      lapack::lange( Norm::Max, n, n, A, lda ) );
+    lapack::vector< inner_t > LU( n*n ), w( n );
+    lapack::vector< int64_t > ipiv( n );
+    int64_t iter = 0;
+    if (! internal::to_inner( opts.precision, Uplo::General, n, n,
+                              A, lda, s, &LU[0], n )) {
+        iter = -2;
+    }
+    else if (lapack::getrf( n, n, &LU[0], n, &ipiv[0] ) != 0
+             || ! internal::round_inner( opts.precision, Uplo::General,
+                                         n, n, &LU[0], n )) {
+        iter = -3;
+    }
+
+    if (iter == 0) {
+        // v = A^{-1} v = s (s A)^{-1} v, normalizing v to avoid overflow.
+        auto precond = [&]( scalar_t* v ) {
+            real_t vmax = lapack::lange( Norm::Max, n, 1, v, n );
+            if (vmax == 0)
+                return;
+            for (int64_t i = 0; i < n; ++i)
+                w[ i ] = inner_t( v[ i ] / vmax );
+            lapack::getrs( Op::NoTrans, n, 1, &LU[0], n, &ipiv[0], &w[0], n );
+            for (int64_t i = 0; i < n; ++i)
+                v[ i ] = scalar_t( w[ i ] ) * (s * vmax);
+        };
+        auto op = [&]( scalar_t const* v, scalar_t* y ) {
+            blas::gemv( Layout::ColMajor, Op::NoTrans, n, n,
+                        1.0, A, lda, v, 1, 0.0, y, 1 );
+        };
+        auto residual = [&]( int64_t j, scalar_t const* x, scalar_t* r ) {
+            std::copy( &B[ j*ldb ], &B[ j*ldb + n ], r );
+            blas::gemv( Layout::ColMajor, Op::NoTrans, n, n,
+                        -1.0, A, lda, x, 1, 1.0, r, 1 );
+            return Anorm * lapack::lange( Norm::Max, n, 1, x, n );
+        };
+
+        for (int64_t j = 0; j < nrhs; ++j) {
+            std::copy( &B[ j*ldb ], &B[ j*ldb + n ], &X[ j*ldx ] );
+            precond( &X[ j*ldx ] );
+        }
+        iter = internal::refine_columns( opts, n, nrhs, X, ldx, tol,
+                                         residual, op, precond, rinfo );
+    }
+    rinfo->iter = iter;
+
+    if (iter >= 0 || (iter == -31 && ! opts.fallback))
+        return 0;
+
+    // Fall back to working precision.
+    lapack::vector< scalar_t > A_work( n*n );
+    lapack::lacpy( MatrixType::General, n, n, A, lda, &A_work[0], n );
+    int64_t info = lapack::getrf( n, n, &A_work[0], n, &ipiv[0] );
+    if (info == 0) {
+        lapack::lacpy( MatrixType::General, n, nrhs, B, ldb, X, ldx );
+        lapack::getrs( Op::NoTrans, n, nrhs, &A_work[0], n, &ipiv[0], X, ldx );
+    }
+    return info;
+}
+
+}  // namespace impl
+
+//==============================================================================
+// -----------------------------------------------------------------------------
+/// @ingroup gesv
+int64_t gesv_mixed(
+    int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    RefineOptions const& opts,
+    RefineInfo* rinfo )
+{
+    return impl::gesv_mixed( n, nrhs, A, lda, B, ldb, X, ldx, opts, rinfo );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv
+int64_t gesv_mixed(
+    int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    RefineOptions const& opts,
+    RefineInfo* rinfo )
+{
+    return impl::gesv_mixed( n, nrhs, A, lda, B, ldb, X, ldx, opts, rinfo );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv
+int64_t gesv_mixed(
+    int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    RefineOptions const& opts,
+    RefineInfo* rinfo )
+{
+    return impl::gesv_mixed( n, nrhs, A, lda, B, ldb, X, ldx, opts, rinfo );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes the solution to a system of linear equations
+/// \[
+///     A X = B,
+/// \]
+/// where A is an n-by-n matrix and X and B are n-by-nrhs matrices,
+/// using an LU factorization in a lower inner precision with iterative
+/// refinement in working precision.
+///
+/// Unlike the mixed-precision lapack::gesv, which calls LAPACK dsgesv or
+/// zcgesv, the inner precision, refinement method, tolerance, and
+/// iteration limits are set in opts, and all four types are supported.
+/// With opts.precision = Single, this factors A in float, about twice
+/// as fast as in double, then refines to double accuracy when
+/// $\kappa(A) u_{single} < 1$. With opts.method = GMRES (the default),
+/// each correction is computed by GMRES preconditioned by the
+/// low-precision LU factors, as in GMRES-IR (Carson and Higham, 2018),
+/// which converges for much more ill-conditioned A, and allows the
+/// emulated Bfloat16 and Half factorizations to be useful.
+///
+/// If the inner factorization fails or refinement does not converge,
+/// A is refactored in working precision, as dsgesv does;
+/// see RefineInfo::iter.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+/// For float, only Bfloat16 and Half are lower precisions.
+///
+/// @param[in] n
+///     The number of linear equations, i.e., the order of the
+///     matrix A. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns
+///     of the matrix B. nrhs >= 0.
+///
+/// @param[in] A
+///     The n-by-n coefficient matrix A, stored in an lda-by-n array.
+///     A is not modified.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[in] B
+///     The n-by-nrhs right hand side matrix B, stored in an ldb-by-nrhs array.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= max(1,n).
+///
+/// @param[out] X
+///     The n-by-nrhs matrix X, stored in an ldx-by-nrhs array.
+///     If return value = 0, the n-by-nrhs solution matrix X.
+///
+/// @param[in] ldx
+///     The leading dimension of the array X. ldx >= max(1,n).
+///
+/// @param[in] opts
+///     Inner precision, refinement method, tolerance, and limits;
+///     see lapack::RefineOptions.
+///
+/// @param[out] rinfo
+///     If not null, the number of refinement steps and GMRES iterations,
+///     whether refinement converged, and the final backward error;
+///     see lapack::RefineInfo.
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, U(i,i) computed in working precision
+///     is exactly zero. The factorization has been completed, but the
+///     factor U is exactly singular, so the solution could not be computed.
+///
+/// @ingroup gesv
+int64_t gesv_mixed(
+    int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    RefineOptions const& opts,
+    RefineInfo* rinfo )
+{
+    return impl::gesv_mixed( n, nrhs, A, lda, B, ldb, X, ldx, opts, rinfo );
+}
+
+}  // namespace lapack
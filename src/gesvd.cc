@@ -25,46 +25,18 @@ int64_t gesvd(
     float* U, int64_t ldu,
     float* VT, int64_t ldvt )
 {
-    char jobu_ = to_char( jobu );
-    char jobvt_ = to_char( jobvt );
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int ldu_ = to_lapack_int( ldu );
-    lapack_int ldvt_ = to_lapack_int( ldvt );
-    lapack_int info_ = 0;
-
     // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgesvd(
-        &jobu_, &jobvt_, &m_, &n_,
-        A, &lda_,
-        S,
-        U, &ldu_,
-        VT, &ldvt_,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork;
+    gesvd_work_size(
+        jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt,
+        &lwork );
 
     // allocate workspace
-    std::vector< float > work( lwork_ );
+    lapack::vector< float > work( lwork );
 
-    LAPACK_sgesvd(
-        &jobu_, &jobvt_, &m_, &n_,
-        A, &lda_,
-        S,
-        U, &ldu_,
-        VT, &ldvt_,
-        &work[0], &lwork_, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return gesvd(
+        jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt,
+        &work[0], lwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -76,46 +48,18 @@ int64_t gesvd(
     double* U, int64_t ldu,
     double* VT, int64_t ldvt )
 {
-    char jobu_ = to_char( jobu );
-    char jobvt_ = to_char( jobvt );
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int ldu_ = to_lapack_int( ldu );
-    lapack_int ldvt_ = to_lapack_int( ldvt );
-    lapack_int info_ = 0;
-
     // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgesvd(
-        &jobu_, &jobvt_, &m_, &n_,
-        A, &lda_,
-        S,
-        U, &ldu_,
-        VT, &ldvt_,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork;
+    gesvd_work_size(
+        jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt,
+        &lwork );
 
     // allocate workspace
-    std::vector< double > work( lwork_ );
+    lapack::vector< double > work( lwork );
 
-    LAPACK_dgesvd(
-        &jobu_, &jobvt_, &m_, &n_,
-        A, &lda_,
-        S,
-        U, &ldu_,
-        VT, &ldvt_,
-        &work[0], &lwork_, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return gesvd(
+        jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt,
+        &work[0], lwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -127,50 +71,19 @@ int64_t gesvd(
     std::complex<float>* U, int64_t ldu,
     std::complex<float>* VT, int64_t ldvt )
 {
-    char jobu_ = to_char( jobu );
-    char jobvt_ = to_char( jobvt );
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int ldu_ = to_lapack_int( ldu );
-    lapack_int ldvt_ = to_lapack_int( ldvt );
-    lapack_int info_ = 0;
-
     // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cgesvd(
-        &jobu_, &jobvt_, &m_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        S,
-        (lapack_complex_float*) U, &ldu_,
-        (lapack_complex_float*) VT, &ldvt_,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork, lrwork;
+    gesvd_work_size(
+        jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt,
+        &lwork, &lrwork );
 
     // allocate workspace
-    std::vector< std::complex<float> > work( lwork_ );
-    std::vector< float > rwork( (5*min(m,n)) );
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
 
-    LAPACK_cgesvd(
-        &jobu_, &jobvt_, &m_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        S,
-        (lapack_complex_float*) U, &ldu_,
-        (lapack_complex_float*) VT, &ldvt_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0], &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return gesvd(
+        jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt,
+        &work[0], lwork, &rwork[0], lrwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -291,6 +204,178 @@ int64_t gesvd(
     std::complex<double>* U, int64_t ldu,
     std::complex<double>* VT, int64_t ldvt )
 {
+    // query for workspace size
+    int64_t lwork, lrwork;
+    gesvd_work_size(
+        jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt,
+        &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+
+    return gesvd(
+        jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt,
+        &work[0], lwork, &rwork[0], lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+void gesvd_work_size(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "sgesvd", jobu, jobvt, m, n, lda, ldu, ldvt );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    char jobu_ = to_char( jobu );
+    char jobvt_ = to_char( jobvt );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldu_ = to_lapack_int( ldu );
+    lapack_int ldvt_ = to_lapack_int( ldvt );
+    lapack_int info_ = 0;
+
+    float qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_sgesvd(
+        &jobu_, &jobvt_, &m_, &n_,
+        A, &lda_,
+        S,
+        U, &ldu_,
+        VT, &ldvt_,
+        qry_work, &ineg_one, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+void gesvd_work_size(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "dgesvd", jobu, jobvt, m, n, lda, ldu, ldvt );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    char jobu_ = to_char( jobu );
+    char jobvt_ = to_char( jobvt );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldu_ = to_lapack_int( ldu );
+    lapack_int ldvt_ = to_lapack_int( ldvt );
+    lapack_int info_ = 0;
+
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dgesvd(
+        &jobu_, &jobvt_, &m_, &n_,
+        A, &lda_,
+        S,
+        U, &ldu_,
+        VT, &ldvt_,
+        qry_work, &ineg_one, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+void gesvd_work_size(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt,
+    int64_t* lwork, int64_t* lrwork )
+{
+    auto key = internal::work_size_key(
+        "cgesvd", jobu, jobvt, m, n, lda, ldu, ldvt );
+    if (internal::work_size_cache_find( key, lwork, lrwork ))
+        return;
+
+    char jobu_ = to_char( jobu );
+    char jobvt_ = to_char( jobvt );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldu_ = to_lapack_int( ldu );
+    lapack_int ldvt_ = to_lapack_int( ldvt );
+    lapack_int info_ = 0;
+
+    std::complex<float> qry_work[1];
+    float qry_rwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_cgesvd(
+        &jobu_, &jobvt_, &m_, &n_,
+        (lapack_complex_float*) A, &lda_,
+        S,
+        (lapack_complex_float*) U, &ldu_,
+        (lapack_complex_float*) VT, &ldvt_,
+        (lapack_complex_float*) qry_work, &ineg_one,
+        qry_rwork, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    *lrwork = 5*min(m,n);
+    internal::work_size_cache_insert( key, *lwork, *lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::gesvd with caller-provided workspace.
+/// Returns the array lengths that the workspace overload of `gesvd`
+/// requires, so the workspace can be allocated once, outside a loop.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// Other arguments are the same as for lapack::gesvd.
+/// Arrays are used only to select the precision and are not referenced.
+///
+/// @param[out] lwork
+///     The optimal length of the array work.
+///
+/// @param[out] lrwork
+///     The length of the array rwork, 5*min(m,n).
+///
+/// @ingroup gesvd
+void gesvd_work_size(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt,
+    int64_t* lwork, int64_t* lrwork )
+{
+    auto key = internal::work_size_key(
+        "zgesvd", jobu, jobvt, m, n, lda, ldu, ldvt );
+    if (internal::work_size_cache_find( key, lwork, lrwork ))
+        return;
+
     char jobu_ = to_char( jobu );
     char jobvt_ = to_char( jobvt );
     lapack_int m_ = to_lapack_int( m );
@@ -300,7 +385,6 @@ int64_t gesvd(
     lapack_int ldvt_ = to_lapack_int( ldvt );
     lapack_int info_ = 0;
 
-    // query for workspace size
     std::complex<double> qry_work[1];
     double qry_rwork[1];
     lapack_int ineg_one = -1;
@@ -316,11 +400,163 @@ int64_t gesvd(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    *lrwork = 5*min(m,n);
+    internal::work_size_cache_insert( key, *lwork, *lrwork );
+}
 
-    // allocate workspace
-    std::vector< std::complex<double> > work( lwork_ );
-    std::vector< double > rwork( (5*min(m,n)) );
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt,
+    float* work, int64_t lwork )
+{
+    char jobu_ = to_char( jobu );
+    char jobvt_ = to_char( jobvt );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldu_ = to_lapack_int( ldu );
+    lapack_int ldvt_ = to_lapack_int( ldvt );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gesvd", float, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+
+    LAPACK_sgesvd(
+        &jobu_, &jobvt_, &m_, &n_,
+        A, &lda_,
+        S,
+        U, &ldu_,
+        VT, &ldvt_,
+        work, &lwork_, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt,
+    double* work, int64_t lwork )
+{
+    char jobu_ = to_char( jobu );
+    char jobvt_ = to_char( jobvt );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldu_ = to_lapack_int( ldu );
+    lapack_int ldvt_ = to_lapack_int( ldvt );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gesvd", double, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+
+    LAPACK_dgesvd(
+        &jobu_, &jobvt_, &m_, &n_,
+        A, &lda_,
+        S,
+        U, &ldu_,
+        VT, &ldvt_,
+        work, &lwork_, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork )
+{
+    char jobu_ = to_char( jobu );
+    char jobvt_ = to_char( jobvt );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldu_ = to_lapack_int( ldu );
+    lapack_int ldvt_ = to_lapack_int( ldvt );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gesvd", std::complex<float>, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( lrwork < 5*min(m,n) );
+
+    LAPACK_cgesvd(
+        &jobu_, &jobvt_, &m_, &n_,
+        (lapack_complex_float*) A, &lda_,
+        S,
+        (lapack_complex_float*) U, &ldu_,
+        (lapack_complex_float*) VT, &ldvt_,
+        (lapack_complex_float*) work, &lwork_,
+        rwork, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::gesvd that takes caller-provided workspace
+/// instead of querying and allocating it on each call.
+/// Use lapack::gesvd_work_size to get the required lengths.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// Other arguments are the same as for lapack::gesvd.
+///
+/// @param[out] work
+///     The vector work of length lwork. Workspace.
+///
+/// @param[in] lwork
+///     The length of the array work.
+///     Use the value from lapack::gesvd_work_size for best performance.
+///
+/// @param[out] rwork
+///     The vector rwork of length lrwork. Workspace.
+///
+/// @param[in] lrwork
+///     The length of the array rwork, lrwork >= 5*min(m,n).
+///
+/// @ingroup gesvd
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork )
+{
+    char jobu_ = to_char( jobu );
+    char jobvt_ = to_char( jobvt );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldu_ = to_lapack_int( ldu );
+    lapack_int ldvt_ = to_lapack_int( ldvt );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gesvd", std::complex<double>, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( lrwork < 5*min(m,n) );
 
     LAPACK_zgesvd(
         &jobu_, &jobvt_, &m_, &n_,
@@ -328,8 +564,8 @@ int64_t gesvd(
         S,
         (lapack_complex_double*) U, &ldu_,
         (lapack_complex_double*) VT, &ldvt_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0], &info_
+        (lapack_complex_double*) work, &lwork_,
+        rwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -337,4 +573,117 @@ int64_t gesvd(
     return info_;
 }
 
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper for either layout.
+/// @ingroup gesvd
+///
+template <typename scalar_t>
+int64_t gesvd(
+    lapack::Layout layout, lapack::Job jobu, lapack::Job jobvt,
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    blas::real_type< scalar_t >* S,
+    scalar_t* U, int64_t ldu,
+    scalar_t* VT, int64_t ldvt )
+{
+    if (layout == Layout::ColMajor)
+        return lapack::gesvd( jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt );
+
+    lapack_error_if( layout != Layout::RowMajor );
+
+    // Row-major A is column-major A^T. If A^T = U2 S V2^H, then
+    // A = conj( V2 ) S U2^T, where conj( V2 ) read row-major is V2^H,
+    // and U2^T read row-major is U2. So swap jobs and U, VT.
+    return lapack::gesvd( jobvt, jobu, n, m, A, lda, S, VT, ldvt, U, ldu );
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// @ingroup gesvd
+int64_t gesvd(
+    lapack::Layout layout, lapack::Job jobu, lapack::Job jobvt,
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt )
+{
+    return impl::gesvd( layout, jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesvd(
+    lapack::Layout layout, lapack::Job jobu, lapack::Job jobvt,
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt )
+{
+    return impl::gesvd( layout, jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesvd(
+    lapack::Layout layout, lapack::Job jobu, lapack::Job jobvt,
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt )
+{
+    return impl::gesvd( layout, jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::gesvd that takes the matrix layout.
+/// For row-major layout, A, U, and VT are stored row-major.
+///
+/// For row-major, this computes the SVD of the column-major A^T,
+/// swapping the roles of jobu and jobvt and of U and VT, so nothing
+/// is copied.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// Other arguments are the same as for lapack::gesvd.
+///
+/// @param[in] layout
+///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
+///
+/// @param[in] lda
+///     The leading dimension of the array A.
+///     If layout = ColMajor, lda >= max(1,m);
+///     if layout = RowMajor, lda >= max(1,n).
+///
+/// @param[in] ldu
+///     The leading dimension of the array U.
+///     If layout = ColMajor, ldu >= max(1,m) if U is computed;
+///     if layout = RowMajor, ldu >= m if jobu = AllVec,
+///     ldu >= min(m,n) if jobu = SomeVec, else ldu >= 1.
+///
+/// @param[in] ldvt
+///     The leading dimension of the array VT.
+///     If layout = ColMajor, ldvt >= n if jobvt = AllVec,
+///     ldvt >= min(m,n) if jobvt = SomeVec, else ldvt >= 1;
+///     if layout = RowMajor, ldvt >= max(1,n) if VT is computed.
+///
+/// @ingroup gesvd
+int64_t gesvd(
+    lapack::Layout layout, lapack::Job jobu, lapack::Job jobvt,
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt )
+{
+    return impl::gesvd( layout, jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt );
+}
+
 }  // namespace lapack
@@ -0,0 +1,480 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "lapack/fortran.h"
+#include "NoConstructAllocator.hh"
+#include "gesvd_native.hh"
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+using blas::is_complex_v;
+
+//==============================================================================
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, float version.
+/// rwork is not referenced.
+/// @ingroup gesvd_batch_internal
+inline void gesvd(
+    char jobu, char jobvt, lapack_int m, lapack_int n,
+    float* A, lapack_int lda,
+    float* S,
+    float* U, lapack_int ldu,
+    float* VT, lapack_int ldvt,
+    float* work, lapack_int lwork,
+    float* rwork,
+    lapack_int* info )
+{
+    LAPACK_sgesvd(
+        &jobu, &jobvt, &m, &n, A, &lda, S, U, &ldu, VT, &ldvt,
+        work, &lwork, info );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, double version.
+/// rwork is not referenced.
+/// @ingroup gesvd_batch_internal
+inline void gesvd(
+    char jobu, char jobvt, lapack_int m, lapack_int n,
+    double* A, lapack_int lda,
+    double* S,
+    double* U, lapack_int ldu,
+    double* VT, lapack_int ldvt,
+    double* work, lapack_int lwork,
+    double* rwork,
+    lapack_int* info )
+{
+    LAPACK_dgesvd(
+        &jobu, &jobvt, &m, &n, A, &lda, S, U, &ldu, VT, &ldvt,
+        work, &lwork, info );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, complex<float> version.
+/// @ingroup gesvd_batch_internal
+inline void gesvd(
+    char jobu, char jobvt, lapack_int m, lapack_int n,
+    std::complex<float>* A, lapack_int lda,
+    float* S,
+    std::complex<float>* U, lapack_int ldu,
+    std::complex<float>* VT, lapack_int ldvt,
+    std::complex<float>* work, lapack_int lwork,
+    float* rwork,
+    lapack_int* info )
+{
+    LAPACK_cgesvd(
+        &jobu, &jobvt, &m, &n,
+        (lapack_complex_float*) A, &lda, S,
+        (lapack_complex_float*) U, &ldu,
+        (lapack_complex_float*) VT, &ldvt,
+        (lapack_complex_float*) work, &lwork,
+        rwork, info );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, complex<double> version.
+/// @ingroup gesvd_batch_internal
+inline void gesvd(
+    char jobu, char jobvt, lapack_int m, lapack_int n,
+    std::complex<double>* A, lapack_int lda,
+    double* S,
+    std::complex<double>* U, lapack_int ldu,
+    std::complex<double>* VT, lapack_int ldvt,
+    std::complex<double>* work, lapack_int lwork,
+    double* rwork,
+    lapack_int* info )
+{
+    LAPACK_zgesvd(
+        &jobu, &jobvt, &m, &n,
+        (lapack_complex_double*) A, &lda, S,
+        (lapack_complex_double*) U, &ldu,
+        (lapack_complex_double*) VT, &ldvt,
+        (lapack_complex_double*) work, &lwork,
+        rwork, info );
+}
+
+}  // namespace internal
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks and converts arguments once,
+/// then computes each SVD in parallel. For small min(m,n)
+/// (see internal::gesvd_use_native), uses one-sided Jacobi; otherwise,
+/// queries workspace once and calls low-level wrapper, with one
+/// workspace per thread.
+/// Aarray(i), Sarray(i), Uarray(i), and VTarray(i) return pointers to
+/// the i-th matrix, singular values, and singular vectors.
+/// @ingroup gesvd_batch_internal
+///
+template <typename scalar_t, typename Aarray_t, typename Sarray_t,
+          typename Uarray_t, typename VTarray_t>
+void gesvd_batch(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    Aarray_t Aarray, int64_t lda,
+    Sarray_t Sarray,
+    Uarray_t Uarray, int64_t ldu,
+    VTarray_t VTarray, int64_t ldvt,
+    int64_t batch_count, int64_t* info )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    auto valid = []( lapack::Job job ) {
+        return job == Job::NoVec || job == Job::SomeVec
+            || job == Job::AllVec || job == Job::OverwriteVec;
+    };
+    lapack_error_if( ! valid( jobu ) );
+    lapack_error_if( ! valid( jobvt ) );
+    lapack_error_if( jobu == Job::OverwriteVec && jobvt == Job::OverwriteVec );
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+    lapack_error_if( ldu < 1 );
+    lapack_error_if( (jobu == Job::AllVec || jobu == Job::SomeVec) && ldu < m );
+    lapack_error_if( ldvt < 1 );
+    lapack_error_if( jobvt == Job::AllVec && ldvt < n );
+    lapack_error_if( jobvt == Job::SomeVec && ldvt < min( m, n ) );
+    lapack_error_if( batch_count < 0 );
+
+    if (internal::gesvd_use_native( jobu, jobvt, m, n )) {
+        int64_t maxmn = max( m, n );
+        int64_t minmn = min( m, n );
+        bool wantu  = (jobu  != Job::NoVec);
+        bool wantvt = (jobvt != Job::NoVec);
+
+        #pragma omp parallel if (batch_count > 1)
+        {
+            lapack::vector< scalar_t > work( max( 1, (maxmn + minmn)*minmn ) );
+            lapack::vector< real_t > rwork( max( 1, minmn ) );
+
+            #pragma omp for schedule( static )
+            for (int64_t i = 0; i < batch_count; ++i) {
+                info[ i ] = internal::gesvd_jacobi(
+                    wantu, wantvt, m, n, Aarray( i ), lda, Sarray( i ),
+                    Uarray( i ), ldu, VTarray( i ), ldvt,
+                    &work[0], &rwork[0] );
+            }
+        }
+    }
+    else {
+        char jobu_ = to_char( jobu );
+        char jobvt_ = to_char( jobvt );
+        lapack_int m_ = to_lapack_int( m );
+        lapack_int n_ = to_lapack_int( n );
+        lapack_int lda_ = to_lapack_int( lda );
+        lapack_int ldu_ = to_lapack_int( ldu );
+        lapack_int ldvt_ = to_lapack_int( ldvt );
+
+        int64_t lwork, lrwork = 0;
+        if constexpr (is_complex_v< scalar_t >) {
+            gesvd_work_size( jobu, jobvt, m, n, (scalar_t*) nullptr, lda,
+                             (real_t*) nullptr, (scalar_t*) nullptr, ldu,
+                             (scalar_t*) nullptr, ldvt, &lwork, &lrwork );
+        }
+        else {
+            gesvd_work_size( jobu, jobvt, m, n, (scalar_t*) nullptr, lda,
+                             (real_t*) nullptr, (scalar_t*) nullptr, ldu,
+                             (scalar_t*) nullptr, ldvt, &lwork );
+        }
+        lapack_int lwork_ = to_lapack_int( lwork );
+
+        #pragma omp parallel if (batch_count > 1)
+        {
+            lapack::vector< scalar_t > work( max( 1, lwork ) );
+            lapack::vector< real_t > rwork( max( 1, lrwork ) );
+
+            #pragma omp for schedule( static )
+            for (int64_t i = 0; i < batch_count; ++i) {
+                lapack_int info_ = 0;
+                internal::gesvd(
+                    jobu_, jobvt_, m_, n_, Aarray( i ), lda_, Sarray( i ),
+                    Uarray( i ), ldu_, VTarray( i ), ldvt_,
+                    &work[0], lwork_, &rwork[0], &info_ );
+                info[ i ] = info_;
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Strided version: A_i is A + i*strideA, S_i is S + i*strideS,
+/// U_i is U + i*strideU, VT_i is VT + i*strideVT.
+/// @ingroup gesvd_batch_internal
+///
+template <typename scalar_t>
+void gesvd_batch(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    scalar_t* A, int64_t lda, int64_t strideA,
+    blas::real_type< scalar_t >* S, int64_t strideS,
+    scalar_t* U, int64_t ldu, int64_t strideU,
+    scalar_t* VT, int64_t ldvt, int64_t strideVT,
+    int64_t batch_count, int64_t* info )
+{
+    if (batch_count > 1) {
+        int64_t ucol = (jobu == Job::AllVec  ? m
+                     :  jobu == Job::SomeVec ? min( m, n ) : 0);
+        int64_t vtcol = (jobvt == Job::AllVec || jobvt == Job::SomeVec
+                         ? n : 0);
+        lapack_error_if( strideA < lda*n );
+        lapack_error_if( strideS < min( m, n ) );
+        lapack_error_if( strideU < ldu*ucol );
+        lapack_error_if( strideVT < ldvt*vtcol );
+    }
+
+    gesvd_batch< scalar_t >(
+        jobu, jobvt, m, n,
+        [=]( int64_t i ) { return A + i*strideA; }, lda,
+        [=]( int64_t i ) { return S + i*strideS; },
+        [=]( int64_t i ) { return U + i*strideU; }, ldu,
+        [=]( int64_t i ) { return VT + i*strideVT; }, ldvt,
+        batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// Pointer-array version: A_i is Aarray[ i ], S_i is Sarray[ i ],
+/// U_i is Uarray[ i ], VT_i is VTarray[ i ].
+/// @ingroup gesvd_batch_internal
+///
+template <typename scalar_t>
+void gesvd_batch(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    scalar_t* const* Aarray, int64_t lda,
+    blas::real_type< scalar_t >* const* Sarray,
+    scalar_t* const* Uarray, int64_t ldu,
+    scalar_t* const* VTarray, int64_t ldvt,
+    int64_t batch_count, int64_t* info )
+{
+    // U and VT are not referenced for some jobs,
+    // so their arrays may be null.
+    gesvd_batch< scalar_t >(
+        jobu, jobvt, m, n,
+        [=]( int64_t i ) { return Aarray[ i ]; }, lda,
+        [=]( int64_t i ) { return Sarray[ i ]; },
+        [=]( int64_t i ) { return Uarray  ? Uarray[ i ]  : nullptr; }, ldu,
+        [=]( int64_t i ) { return VTarray ? VTarray[ i ] : nullptr; }, ldvt,
+        batch_count, info );
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// @ingroup gesvd_batch
+void gesvd_batch(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    float* A, int64_t lda, int64_t strideA,
+    float* S, int64_t strideS,
+    float* U, int64_t ldu, int64_t strideU,
+    float* VT, int64_t ldvt, int64_t strideVT,
+    int64_t batch_count, int64_t* info )
+{
+    impl::gesvd_batch( jobu, jobvt, m, n, A, lda, strideA, S, strideS,
+                       U, ldu, strideU, VT, ldvt, strideVT,
+                       batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gesvd_batch
+void gesvd_batch(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    double* A, int64_t lda, int64_t strideA,
+    double* S, int64_t strideS,
+    double* U, int64_t ldu, int64_t strideU,
+    double* VT, int64_t ldvt, int64_t strideVT,
+    int64_t batch_count, int64_t* info )
+{
+    impl::gesvd_batch( jobu, jobvt, m, n, A, lda, strideA, S, strideS,
+                       U, ldu, strideU, VT, ldvt, strideVT,
+                       batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gesvd_batch
+void gesvd_batch(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    float* S, int64_t strideS,
+    std::complex<float>* U, int64_t ldu, int64_t strideU,
+    std::complex<float>* VT, int64_t ldvt, int64_t strideVT,
+    int64_t batch_count, int64_t* info )
+{
+    impl::gesvd_batch( jobu, jobvt, m, n, A, lda, strideA, S, strideS,
+                       U, ldu, strideU, VT, ldvt, strideVT,
+                       batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// Computes the singular value decomposition (SVD) of a batch of
+/// m-by-n matrices A_i, as in lapack::gesvd,
+/// \[
+///     A_i = U_i \Sigma_i V_i^H.
+/// \]
+/// Matrices are processed in parallel using OpenMP.
+///
+/// For min(m,n) <= 5, one-sided Jacobi is used instead of calling LAPACK
+/// for each matrix, unless jobu or jobvt = OverwriteVec, or all m (or n)
+/// singular vectors are requested when m > n (or n > m). Singular values
+/// agree with LAPACK to O( eps ||A_i|| ); singular vectors may differ by
+/// a unit scalar factor. Otherwise, the workspace size is queried once
+/// for the batch, and each thread allocates one workspace that it
+/// reuses for all its matrices.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`,
+/// for both strided storage (shown here) and pointer-array storage:
+///
+///     gesvd_batch( jobu, jobvt, m, n, Aarray, lda, Sarray,
+///                  Uarray, ldu, VTarray, ldvt, batch_count, info )
+///
+/// where Uarray and VTarray may be null if not referenced.
+///
+/// @param[in] jobu
+///     Specifies options for computing all or part of each U_i,
+///     as in lapack::gesvd: AllVec, SomeVec, OverwriteVec, or NoVec.
+///
+/// @param[in] jobvt
+///     Specifies options for computing all or part of each $V_i^H$,
+///     as in lapack::gesvd: AllVec, SomeVec, OverwriteVec, or NoVec.
+///     jobvt and jobu cannot both be OverwriteVec.
+///
+/// @param[in] m
+///     The number of rows of each matrix A_i. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of each matrix A_i. n >= 0.
+///
+/// @param[in,out] A
+///     The batch of m-by-n matrices, each stored in an lda-by-n array,
+///     with A_i starting at A + i*strideA.
+///     On exit, as in lapack::gesvd: overwritten by singular vectors
+///     if jobu or jobvt = OverwriteVec; otherwise, destroyed.
+///
+/// @param[in] lda
+///     The leading dimension of each A_i. lda >= max(1,m).
+///
+/// @param[in] strideA
+///     Distance between the starts of consecutive A_i. strideA >= lda*n.
+///
+/// @param[out] S
+///     The batch of vectors S_i, each of length min(m,n), with S_i
+///     starting at S + i*strideS. The singular values of A_i, sorted so
+///     that S_i(j) >= S_i(j+1).
+///
+/// @param[in] strideS
+///     Distance between the starts of consecutive S_i. strideS >= min(m,n).
+///
+/// @param[out] U
+///     The batch of m-by-ucol matrices U_i, each stored in an ldu-by-ucol
+///     array, with U_i starting at U + i*strideU, where ucol = m if
+///     jobu = AllVec, ucol = min(m,n) if jobu = SomeVec;
+///     otherwise, U is not referenced.
+///
+/// @param[in] ldu
+///     The leading dimension of each U_i. ldu >= 1;
+///     if jobu = SomeVec or AllVec, ldu >= m.
+///
+/// @param[in] strideU
+///     Distance between the starts of consecutive U_i. strideU >= ldu*ucol.
+///
+/// @param[out] VT
+///     The batch of vrow-by-n matrices $V_i^H$, each stored in an
+///     ldvt-by-n array, with VT_i starting at VT + i*strideVT, where
+///     vrow = n if jobvt = AllVec, vrow = min(m,n) if jobvt = SomeVec;
+///     otherwise, VT is not referenced.
+///
+/// @param[in] ldvt
+///     The leading dimension of each VT_i. ldvt >= 1;
+///     if jobvt = AllVec, ldvt >= n; if jobvt = SomeVec, ldvt >= min(m,n).
+///
+/// @param[in] strideVT
+///     Distance between the starts of consecutive VT_i.
+///     If jobvt = AllVec or SomeVec, strideVT >= ldvt*n.
+///
+/// @param[in] batch_count
+///     The number of matrices. batch_count >= 0.
+///
+/// @param[out] info
+///     The vector info of length batch_count.
+///     - info[ i ] = 0: successful exit.
+///     - info[ i ] > 0: the algorithm failed to converge for A_i.
+///
+/// Invalid arguments throw lapack::Error.
+///
+/// @ingroup gesvd_batch
+void gesvd_batch(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    double* S, int64_t strideS,
+    std::complex<double>* U, int64_t ldu, int64_t strideU,
+    std::complex<double>* VT, int64_t ldvt, int64_t strideVT,
+    int64_t batch_count, int64_t* info )
+{
+    impl::gesvd_batch( jobu, jobvt, m, n, A, lda, strideA, S, strideS,
+                       U, ldu, strideU, VT, ldvt, strideVT,
+                       batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gesvd_batch
+void gesvd_batch(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    float* const* Aarray, int64_t lda,
+    float* const* Sarray,
+    float* const* Uarray, int64_t ldu,
+    float* const* VTarray, int64_t ldvt,
+    int64_t batch_count, int64_t* info )
+{
+    impl::gesvd_batch( jobu, jobvt, m, n, Aarray, lda, Sarray,
+                       Uarray, ldu, VTarray, ldvt, batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gesvd_batch
+void gesvd_batch(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    double* const* Aarray, int64_t lda,
+    double* const* Sarray,
+    double* const* Uarray, int64_t ldu,
+    double* const* VTarray, int64_t ldvt,
+    int64_t batch_count, int64_t* info )
+{
+    impl::gesvd_batch( jobu, jobvt, m, n, Aarray, lda, Sarray,
+                       Uarray, ldu, VTarray, ldvt, batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gesvd_batch
+void gesvd_batch(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<float>* const* Aarray, int64_t lda,
+    float* const* Sarray,
+    std::complex<float>* const* Uarray, int64_t ldu,
+    std::complex<float>* const* VTarray, int64_t ldvt,
+    int64_t batch_count, int64_t* info )
+{
+    impl::gesvd_batch( jobu, jobvt, m, n, Aarray, lda, Sarray,
+                       Uarray, ldu, VTarray, ldvt, batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gesvd_batch
+void gesvd_batch(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<double>* const* Aarray, int64_t lda,
+    double* const* Sarray,
+    std::complex<double>* const* Uarray, int64_t ldu,
+    std::complex<double>* const* VTarray, int64_t ldvt,
+    int64_t batch_count, int64_t* info )
+{
+    impl::gesvd_batch( jobu, jobvt, m, n, Aarray, lda, Sarray,
+                       Uarray, ldu, VTarray, ldvt, batch_count, info );
+}
+
+}  // namespace lapack
@@ -0,0 +1,291 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_GESVD_NATIVE_HH
+#define LAPACK_GESVD_NATIVE_HH
+
+#include "lapack.hh"
+
+#include <cmath>
+#include <limits>
+
+// Native SVD for small matrices, used by the batched routines. For small
+// sizes, the per-call overhead of Fortran gesvd and gesdd, which query
+// ilaenv, reduce to bidiagonal form, and call bdsqr or bdsdc, dominates
+// the O(mn^2) work.
+
+namespace lapack {
+namespace internal {
+
+/// Largest min(m,n) for which batched SVD routines use one-sided Jacobi
+/// instead of calling LAPACK for each matrix. Jacobi needs several
+/// sweeps of O(mn^2) each, so it is faster only while the per-call
+/// overhead of gesvd dominates.
+const int64_t gesvd_native_max = 5;
+
+//------------------------------------------------------------------------------
+/// Returns true if the batched SVD routines should use gesvd_jacobi for
+/// an m-by-n matrix with the given jobs. Jacobi computes only the
+/// min(m,n) singular vectors on each side, so AllVec is accepted only
+/// where those are all the vectors, and OverwriteVec is not supported.
+///
+inline bool gesvd_use_native(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n )
+{
+    auto supported = []( lapack::Job job ) {
+        return job == Job::NoVec || job == Job::SomeVec || job == Job::AllVec;
+    };
+    return blas::min( m, n ) <= gesvd_native_max
+           && supported( jobu ) && supported( jobvt )
+           && (jobu  != Job::AllVec || m <= n)
+           && (jobvt != Job::AllVec || n <= m);
+}
+
+//------------------------------------------------------------------------------
+/// One-sided (Hestenes) Jacobi SVD of a small m-by-n matrix A.
+///
+/// With p = max(m,n) and q = min(m,n), copies A (if m >= n) or A^H
+/// (if m < n) to the p-by-q matrix G in work, scaled so max |g_ij| = 1,
+/// then applies complex Jacobi rotations to pairs of columns,
+///
+///     [ g_j  g_k ] = [ g_j  g_k ] [   c           s e ]
+///                                 [ -s conj(e)    c   ],
+///
+/// chosen to make g_j^H g_k = 0, until every pair satisfies
+/// |g_j^H g_k| <= sqrt(p) eps ||g_j|| ||g_k||, as in LAPACK gesvj.
+/// Then G = Ug Sigma Vg^H, where the columns of Ug are the normalized
+/// columns of G and Vg accumulates the rotations. Singular vectors for
+/// zero singular values are completed to an orthonormal set.
+///
+/// Singular values are returned in descending order, as in LAPACK gesvd.
+/// If wantu, the first min(m,n) columns of U are computed, plus all m
+/// columns if m <= n; if wantvt, the first min(m,n) rows of VT,
+/// plus all n rows if n <= m. A is not modified.
+///
+/// @param[out] work
+///     Workspace of length max(m,n)*min(m,n) + min(m,n)^2.
+///
+/// @param[out] rwork
+///     Workspace of length min(m,n).
+///
+/// @return 0 if converged, or min(m,n) if not converged after max_sweeps.
+///
+template <typename scalar_t>
+int64_t gesvd_jacobi(
+    bool wantu, bool wantvt, int64_t m, int64_t n,
+    scalar_t const* A, int64_t lda,
+    blas::real_type< scalar_t >* S,
+    scalar_t* U, int64_t ldu,
+    scalar_t* VT, int64_t ldvt,
+    scalar_t* work, blas::real_type< scalar_t >* rwork )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    const int max_sweeps = 30;
+    const real_t eps = std::numeric_limits< real_t >::epsilon();
+    const real_t zeta_max = 1 / eps;
+
+    const bool tall = (m >= n);
+    const int64_t p = (tall ? m : n);
+    const int64_t q = (tall ? n : m);
+    if (q == 0)
+        return 0;
+
+    // Vectors from G's columns (Ug) and from the rotations (Vg).
+    const bool want_ug = (tall ? wantu : wantvt);
+    const bool want_vg = (tall ? wantvt : wantu);
+
+    scalar_t* g = work;
+    scalar_t* v = work + p*q;
+    real_t* d = rwork;
+
+    // G = A or A^H, scaled by 1 / max |a_ij|.
+    real_t amax = 0;
+    for (int64_t j = 0; j < n; ++j)
+        for (int64_t i = 0; i < m; ++i)
+            amax = blas::max( amax, std::abs( A[ i + j*lda ] ) );
+    real_t scl = (amax > 0 ? 1 / amax : real_t( 1 ));
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = 0; i < m; ++i) {
+            if (tall)
+                g[ i + j*p ] = scl * A[ i + j*lda ];
+            else
+                g[ j + i*p ] = scl * blas::conj( A[ i + j*lda ] );
+        }
+    }
+    if (want_vg) {
+        for (int64_t j = 0; j < q; ++j)
+            for (int64_t i = 0; i < q; ++i)
+                v[ i + j*q ] = (i == j ? 1 : 0);
+    }
+
+    auto dot = [p]( scalar_t const* x, scalar_t const* y ) {
+        scalar_t sum = 0;
+        for (int64_t i = 0; i < p; ++i)
+            sum += blas::conj( x[ i ] ) * y[ i ];
+        return sum;
+    };
+    auto nrm2 = [p]( scalar_t const* x ) {
+        real_t sum = 0;
+        for (int64_t i = 0; i < p; ++i)
+            sum += std::real( blas::conj( x[ i ] ) * x[ i ] );
+        return sum;
+    };
+
+    const real_t tol = std::sqrt( real_t( p ) ) * eps;
+    int64_t info = q;
+    for (int sweep = 0; sweep < max_sweeps; ++sweep) {
+        // Squared column norms, updated by each rotation and
+        // recomputed every sweep to limit drift.
+        for (int64_t j = 0; j < q; ++j)
+            d[ j ] = nrm2( &g[ j*p ] );
+
+        bool rotated = false;
+        for (int64_t k = 1; k < q; ++k) {
+            for (int64_t j = 0; j < k; ++j) {
+                scalar_t* gj = &g[ j*p ];
+                scalar_t* gk = &g[ k*p ];
+                real_t alpha = d[ j ];
+                real_t beta  = d[ k ];
+                scalar_t gamma = dot( gj, gk );
+                real_t abs_gamma2 = std::real( blas::conj( gamma ) * gamma );
+                if (abs_gamma2 <= tol*tol * alpha*beta)
+                    continue;
+                rotated = true;
+                // std::abs and std::hypot are much slower than sqrt.
+                real_t abs_gamma = std::sqrt( abs_gamma2 );
+
+                // Same rotation as Jacobi on the 2-by-2 Gram matrix
+                // [ alpha gamma; conj(gamma) beta ].
+                real_t zeta = (beta - alpha) / (2*abs_gamma);
+                real_t t;
+                if (std::abs( zeta ) < zeta_max)
+                    t = 1 / (std::abs( zeta ) + std::sqrt( 1 + zeta*zeta ));
+                else
+                    t = 1 / (2*std::abs( zeta ));
+                if (zeta < 0)
+                    t = -t;
+                real_t c = 1 / std::sqrt( 1 + t*t );
+                real_t s = t*c;
+                scalar_t e = gamma / abs_gamma;
+                scalar_t se  = s*e;
+                scalar_t sce = s*blas::conj( e );
+
+                for (int64_t i = 0; i < p; ++i) {
+                    scalar_t gij = gj[ i ];
+                    scalar_t gik = gk[ i ];
+                    gj[ i ] = c*gij - sce*gik;
+                    gk[ i ] = se*gij + c*gik;
+                }
+                d[ j ] = blas::max( alpha - t*abs_gamma, real_t( 0 ) );
+                d[ k ] = beta + t*abs_gamma;
+                if (want_vg) {
+                    scalar_t* vj = &v[ j*q ];
+                    scalar_t* vk = &v[ k*q ];
+                    for (int64_t i = 0; i < q; ++i) {
+                        scalar_t vij = vj[ i ];
+                        scalar_t vik = vk[ i ];
+                        vj[ i ] = c*vij - sce*vik;
+                        vk[ i ] = se*vij + c*vik;
+                    }
+                }
+            }
+        }
+        if (! rotated) {
+            info = 0;
+            break;
+        }
+    }
+
+    for (int64_t j = 0; j < q; ++j)
+        S[ j ] = std::sqrt( nrm2( &g[ j*p ] ) );
+
+    // Selection sort into descending order, moving vectors along.
+    for (int64_t j = 0; j < q - 1; ++j) {
+        int64_t k = j;
+        for (int64_t i = j + 1; i < q; ++i) {
+            if (S[ i ] > S[ k ])
+                k = i;
+        }
+        if (k != j) {
+            std::swap( S[ j ], S[ k ] );
+            for (int64_t i = 0; i < p; ++i)
+                std::swap( g[ i + j*p ], g[ i + k*p ] );
+            if (want_vg) {
+                for (int64_t i = 0; i < q; ++i)
+                    std::swap( v[ i + j*q ], v[ i + k*q ] );
+            }
+        }
+    }
+
+    if (want_ug) {
+        // Normalize columns of G. Zero columns, which are last after
+        // sorting, are replaced by unit vectors e_i orthogonalized
+        // against the previous columns, twice for stability.
+        int64_t i_next = 0;
+        for (int64_t j = 0; j < q; ++j) {
+            scalar_t* gj = &g[ j*p ];
+            if (S[ j ] > 0) {
+                for (int64_t i = 0; i < p; ++i)
+                    gj[ i ] /= S[ j ];
+                continue;
+            }
+            for (; i_next < p; ++i_next) {
+                for (int64_t i = 0; i < p; ++i)
+                    gj[ i ] = (i == i_next ? 1 : 0);
+                for (int pass = 0; pass < 2; ++pass) {
+                    for (int64_t l = 0; l < j; ++l) {
+                        scalar_t* gl = &g[ l*p ];
+                        scalar_t h = dot( gl, gj );
+                        for (int64_t i = 0; i < p; ++i)
+                            gj[ i ] -= h * gl[ i ];
+                    }
+                }
+                real_t norm = std::sqrt( nrm2( gj ) );
+                if (norm > real_t( 0.5 )) {
+                    for (int64_t i = 0; i < p; ++i)
+                        gj[ i ] /= norm;
+                    ++i_next;
+                    break;
+                }
+            }
+        }
+    }
+
+    for (int64_t j = 0; j < q; ++j)
+        S[ j ] *= amax;
+
+    // A = G^H if m < n, so U and VT swap roles.
+    if (tall) {
+        if (wantu) {
+            for (int64_t j = 0; j < q; ++j)
+                for (int64_t i = 0; i < p; ++i)
+                    U[ i + j*ldu ] = g[ i + j*p ];
+        }
+        if (wantvt) {
+            for (int64_t j = 0; j < q; ++j)
+                for (int64_t i = 0; i < q; ++i)
+                    VT[ i + j*ldvt ] = blas::conj( v[ j + i*q ] );
+        }
+    }
+    else {
+        if (wantu) {
+            for (int64_t j = 0; j < q; ++j)
+                for (int64_t i = 0; i < q; ++i)
+                    U[ i + j*ldu ] = v[ i + j*q ];
+        }
+        if (wantvt) {
+            for (int64_t j = 0; j < p; ++j)
+                for (int64_t i = 0; i < q; ++i)
+                    VT[ i + j*ldvt ] = blas::conj( g[ j + i*p ] );
+        }
+    }
+    return info;
+}
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_GESVD_NATIVE_HH
@@ -40,6 +40,7 @@ int64_t gesvdx(
     lapack_int ldu_ = to_lapack_int( ldu );
     lapack_int ldvt_ = to_lapack_int( ldvt );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gesvdx", float, m, n, 0, 0, info_ );
 
     // query for workspace size
     float qry_work[1];
@@ -101,6 +102,7 @@ int64_t gesvdx(
     lapack_int ldu_ = to_lapack_int( ldu );
     lapack_int ldvt_ = to_lapack_int( ldvt );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gesvdx", double, m, n, 0, 0, info_ );
 
     // query for workspace size
     double qry_work[1];
@@ -162,6 +164,7 @@ int64_t gesvdx(
     lapack_int ldu_ = to_lapack_int( ldu );
     lapack_int ldvt_ = to_lapack_int( ldvt );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gesvdx", std::complex<float>, m, n, 0, 0, info_ );
 
     // query for workspace size
     std::complex<float> qry_work[1];
@@ -357,6 +360,7 @@ int64_t gesvdx(
     lapack_int ldu_ = to_lapack_int( ldu );
     lapack_int ldvt_ = to_lapack_int( ldvt );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gesvdx", std::complex<double>, m, n, 0, 0, info_ );
 
     // query for workspace size
     std::complex<double> qry_work[1];
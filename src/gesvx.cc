@@ -50,6 +50,7 @@ int64_t gesvx(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int ldx_ = to_lapack_int( ldx );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gesvx", float, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (4*n) );
@@ -115,6 +116,7 @@ int64_t gesvx(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int ldx_ = to_lapack_int( ldx );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gesvx", double, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (4*n) );
@@ -180,6 +182,7 @@ int64_t gesvx(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int ldx_ = to_lapack_int( ldx );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gesvx", std::complex<float>, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
@@ -456,6 +459,7 @@ int64_t gesvx(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int ldx_ = to_lapack_int( ldx );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gesvx", std::complex<double>, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
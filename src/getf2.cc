@@ -27,13 +27,13 @@ int64_t getf2(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( max( 1, min( m, n )) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+        // 32-bit pivots in first half of ipiv; widened below
+        lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "getf2", float, m, n, 0, 0, info_ );
 
     LAPACK_sgetf2(
         &m_, &n_,
@@ -43,7 +43,7 @@ int64_t getf2(
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        widen_pivots( ipiv, min( m, n ) );
     #endif
     return info_;
 }
@@ -59,13 +59,13 @@ int64_t getf2(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( max( 1, min( m, n )) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+        // 32-bit pivots in first half of ipiv; widened below
+        lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "getf2", double, m, n, 0, 0, info_ );
 
     LAPACK_dgetf2(
         &m_, &n_,
@@ -75,7 +75,7 @@ int64_t getf2(
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        widen_pivots( ipiv, min( m, n ) );
     #endif
     return info_;
 }
@@ -91,13 +91,13 @@ int64_t getf2(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( max( 1, min( m, n )) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+        // 32-bit pivots in first half of ipiv; widened below
+        lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "getf2", std::complex<float>, m, n, 0, 0, info_ );
 
     LAPACK_cgetf2(
         &m_, &n_,
@@ -107,7 +107,7 @@ int64_t getf2(
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        widen_pivots( ipiv, min( m, n ) );
     #endif
     return info_;
 }
@@ -165,13 +165,13 @@ int64_t getf2(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( max( 1, min( m, n )) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+        // 32-bit pivots in first half of ipiv; widened below
+        lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "getf2", std::complex<double>, m, n, 0, 0, info_ );
 
     LAPACK_zgetf2(
         &m_, &n_,
@@ -181,7 +181,7 @@ int64_t getf2(
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        widen_pivots( ipiv, min( m, n ) );
     #endif
     return info_;
 }
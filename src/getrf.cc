@@ -23,13 +23,17 @@ int64_t getrf(
     float* A, int64_t lda,
     int64_t* ipiv )
 {
+    int64_t info = 0;
+    LAPACK_TRACE_BLOCK( "getrf", float, m, n, 0, 0, info );
+    if (internal::getrf_dispatch( m, n, A, lda, ipiv, &info ))
+        return info;
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( max( 1, min( m, n )) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+        // 32-bit pivots in first half of ipiv; widened below
+        lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
@@ -39,13 +43,14 @@ int64_t getrf(
         &m_, &n_,
         A, &lda_,
         ipiv_ptr, &info_ );
+    info = info_;
     if (info_ < 0) {
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        widen_pivots( ipiv, min( m, n ) );
     #endif
-    return info_;
+    return info;
 }
 
 // -----------------------------------------------------------------------------
@@ -55,13 +60,17 @@ int64_t getrf(
     double* A, int64_t lda,
     int64_t* ipiv )
 {
+    int64_t info = 0;
+    LAPACK_TRACE_BLOCK( "getrf", double, m, n, 0, 0, info );
+    if (internal::getrf_dispatch( m, n, A, lda, ipiv, &info ))
+        return info;
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( max( 1, min( m, n )) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+        // 32-bit pivots in first half of ipiv; widened below
+        lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
@@ -71,13 +80,14 @@ int64_t getrf(
         &m_, &n_,
         A, &lda_,
         ipiv_ptr, &info_ );
+    info = info_;
     if (info_ < 0) {
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        widen_pivots( ipiv, min( m, n ) );
     #endif
-    return info_;
+    return info;
 }
 
 // -----------------------------------------------------------------------------
@@ -87,13 +97,17 @@ int64_t getrf(
     std::complex<float>* A, int64_t lda,
     int64_t* ipiv )
 {
+    int64_t info = 0;
+    LAPACK_TRACE_BLOCK( "getrf", std::complex<float>, m, n, 0, 0, info );
+    if (internal::getrf_dispatch( m, n, A, lda, ipiv, &info ))
+        return info;
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( max( 1, min( m, n )) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+        // 32-bit pivots in first half of ipiv; widened below
+        lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
@@ -103,13 +117,14 @@ int64_t getrf(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
         ipiv_ptr, &info_ );
+    info = info_;
     if (info_ < 0) {
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        widen_pivots( ipiv, min( m, n ) );
     #endif
-    return info_;
+    return info;
 }
 
 // -----------------------------------------------------------------------------
@@ -161,13 +176,17 @@ int64_t getrf(
     std::complex<double>* A, int64_t lda,
     int64_t* ipiv )
 {
+    int64_t info = 0;
+    LAPACK_TRACE_BLOCK( "getrf", std::complex<double>, m, n, 0, 0, info );
+    if (internal::getrf_dispatch( m, n, A, lda, ipiv, &info ))
+        return info;
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( max( 1, min( m, n )) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+        // 32-bit pivots in first half of ipiv; widened below
+        lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
@@ -177,13 +196,117 @@ int64_t getrf(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
         ipiv_ptr, &info_ );
+    info = info_;
     if (info_ < 0) {
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        widen_pivots( ipiv, min( m, n ) );
     #endif
-    return info_;
+    return info;
+}
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper for either layout.
+/// @ingroup gesv_computational
+///
+template <typename scalar_t>
+int64_t getrf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    int64_t* ipiv )
+{
+    if (layout == Layout::ColMajor)
+        return lapack::getrf( m, n, A, lda, ipiv );
+
+    lapack_error_if( layout != Layout::RowMajor );
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+
+    // Row-major A is column-major A^T, but LU of A^T would pivot
+    // columns of A instead of rows. So transpose, factor, and transpose
+    // back: in place if A is square, otherwise through workspace.
+    int64_t info;
+    if (m == n) {
+        internal::transpose_in_place( n, A, lda );
+        info = lapack::getrf( n, n, A, lda, ipiv );
+        internal::transpose_in_place( n, A, lda );
+    }
+    else {
+        int64_t ldw = max( 1, m );
+        lapack::vector< scalar_t > W( ldw * n );
+        internal::transpose( n, m, A, lda, W.data(), ldw );
+        info = lapack::getrf( m, n, W.data(), ldw, ipiv );
+        internal::transpose( m, n, W.data(), ldw, A, lda );
+    }
+    return info;
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// @ingroup gesv_computational
+int64_t getrf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    int64_t* ipiv )
+{
+    return impl::getrf( layout, m, n, A, lda, ipiv );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getrf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    int64_t* ipiv )
+{
+    return impl::getrf( layout, m, n, A, lda, ipiv );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getrf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv )
+{
+    return impl::getrf( layout, m, n, A, lda, ipiv );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::getrf that takes the matrix layout.
+/// For row-major layout, A and its factors L and U are stored row-major;
+/// the factorization $A = P L U$ with row interchanges is the same.
+///
+/// LU with row pivoting has no identity in terms of the column-major
+/// A^T, so for row-major, A is transposed in place if square,
+/// otherwise copied through workspace.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// Other arguments are the same as for lapack::getrf.
+///
+/// @param[in] layout
+///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
+///
+/// @param[in] lda
+///     The leading dimension of the array A.
+///     If layout = ColMajor, lda >= max(1,m);
+///     if layout = RowMajor, lda >= max(1,n).
+///
+/// @ingroup gesv_computational
+int64_t getrf(
+    lapack::Layout layout, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv )
+{
+    return impl::getrf( layout, m, n, A, lda, ipiv );
 }
 
 }  // namespace lapack
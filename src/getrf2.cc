@@ -29,13 +29,13 @@ int64_t getrf2(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( max( 1, min( m, n )) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+        // 32-bit pivots in first half of ipiv; widened below
+        lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "getrf2", float, m, n, 0, 0, info_ );
 
     LAPACK_sgetrf2(
         &m_, &n_,
@@ -45,7 +45,7 @@ int64_t getrf2(
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        widen_pivots( ipiv, min( m, n ) );
     #endif
     return info_;
 }
@@ -61,13 +61,13 @@ int64_t getrf2(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( max( 1, min( m, n )) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+        // 32-bit pivots in first half of ipiv; widened below
+        lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "getrf2", double, m, n, 0, 0, info_ );
 
     LAPACK_dgetrf2(
         &m_, &n_,
@@ -77,7 +77,7 @@ int64_t getrf2(
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        widen_pivots( ipiv, min( m, n ) );
     #endif
     return info_;
 }
@@ -93,13 +93,13 @@ int64_t getrf2(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( max( 1, min( m, n )) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+        // 32-bit pivots in first half of ipiv; widened below
+        lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "getrf2", std::complex<float>, m, n, 0, 0, info_ );
 
     LAPACK_cgetrf2(
         &m_, &n_,
@@ -109,7 +109,7 @@ int64_t getrf2(
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        widen_pivots( ipiv, min( m, n ) );
     #endif
     return info_;
 }
@@ -195,13 +195,13 @@ int64_t getrf2(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( (min(m,n)) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+        // 32-bit pivots in first half of ipiv; widened below
+        lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "getrf2", std::complex<double>, m, n, 0, 0, info_ );
 
     LAPACK_zgetrf2(
         &m_, &n_,
@@ -211,7 +211,7 @@ int64_t getrf2(
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        widen_pivots( ipiv, min( m, n ) );
     #endif
     return info_;
 }
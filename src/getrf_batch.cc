@@ -0,0 +1,299 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/batch.hh"
+#include "lapack_internal.hh"
+#include "lapack/fortran.h"
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+//==============================================================================
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, float version.
+/// @ingroup gesv_batch_internal
+inline void getrf(
+    lapack_int m, lapack_int n,
+    float* A, lapack_int lda,
+    lapack_int* ipiv, lapack_int* info )
+{
+    LAPACK_sgetrf( &m, &n, A, &lda, ipiv, info );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, double version.
+/// @ingroup gesv_batch_internal
+inline void getrf(
+    lapack_int m, lapack_int n,
+    double* A, lapack_int lda,
+    lapack_int* ipiv, lapack_int* info )
+{
+    LAPACK_dgetrf( &m, &n, A, &lda, ipiv, info );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, complex<float> version.
+/// @ingroup gesv_batch_internal
+inline void getrf(
+    lapack_int m, lapack_int n,
+    std::complex<float>* A, lapack_int lda,
+    lapack_int* ipiv, lapack_int* info )
+{
+    LAPACK_cgetrf( &m, &n, (lapack_complex_float*) A, &lda, ipiv, info );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, complex<double> version.
+/// @ingroup gesv_batch_internal
+inline void getrf(
+    lapack_int m, lapack_int n,
+    std::complex<double>* A, lapack_int lda,
+    lapack_int* ipiv, lapack_int* info )
+{
+    LAPACK_zgetrf( &m, &n, (lapack_complex_double*) A, &lda, ipiv, info );
+}
+
+}  // namespace internal
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks and converts arguments once,
+/// then calls low-level wrapper for each matrix in parallel.
+/// Aarray(i) and ipiv_array(i) return pointers to the i-th matrix and
+/// pivot vector, for either strided or pointer-array storage.
+/// @ingroup gesv_batch_internal
+///
+template <typename scalar_t, typename Aarray_t, typename ipiv_array_t>
+void getrf_batch(
+    int64_t m, int64_t n,
+    Aarray_t Aarray, int64_t lda,
+    ipiv_array_t ipiv_array,
+    int64_t batch_count, int64_t* info )
+{
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+    lapack_error_if( batch_count < 0 );
+
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    int64_t mn = min( m, n );
+
+    #pragma omp parallel for schedule( static ) if (batch_count > 1)
+    for (int64_t i = 0; i < batch_count; ++i) {
+        int64_t* ipiv = ipiv_array( i );
+        #ifndef LAPACK_ILP64
+            // 32-bit pivots in first half of ipiv; widened below
+            lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );
+        #else
+            lapack_int* ipiv_ptr = ipiv;
+        #endif
+        lapack_int info_ = 0;
+
+        internal::getrf( m_, n_, Aarray( i ), lda_, ipiv_ptr, &info_ );
+
+        #ifndef LAPACK_ILP64
+            widen_pivots( ipiv, mn );
+        #endif
+        info[ i ] = info_;
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Strided version: matrix i is A + i*strideA, pivots ipiv + i*stride_ipiv.
+/// @ingroup gesv_batch_internal
+///
+template <typename scalar_t>
+void getrf_batch(
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    int64_t batch_count, int64_t* info )
+{
+    if (batch_count > 1) {
+        lapack_error_if( strideA < lda*n );
+        lapack_error_if( stride_ipiv < min( m, n ) );
+    }
+
+    getrf_batch< scalar_t >(
+        m, n,
+        [=]( int64_t i ) { return A + i*strideA; }, lda,
+        [=]( int64_t i ) { return ipiv + i*stride_ipiv; },
+        batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// Pointer-array version: matrix i is Aarray[ i ], pivots ipiv_array[ i ].
+/// @ingroup gesv_batch_internal
+///
+template <typename scalar_t>
+void getrf_batch(
+    int64_t m, int64_t n,
+    scalar_t* const* Aarray, int64_t lda,
+    int64_t* const* ipiv_array,
+    int64_t batch_count, int64_t* info )
+{
+    getrf_batch< scalar_t >(
+        m, n,
+        [=]( int64_t i ) { return Aarray[ i ]; }, lda,
+        [=]( int64_t i ) { return ipiv_array[ i ]; },
+        batch_count, info );
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// @ingroup gesv_batch
+void getrf_batch(
+    int64_t m, int64_t n,
+    float* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    int64_t batch_count, int64_t* info )
+{
+    impl::getrf_batch( m, n, A, lda, strideA, ipiv, stride_ipiv,
+                       batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gesv_batch
+void getrf_batch(
+    int64_t m, int64_t n,
+    double* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    int64_t batch_count, int64_t* info )
+{
+    impl::getrf_batch( m, n, A, lda, strideA, ipiv, stride_ipiv,
+                       batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gesv_batch
+void getrf_batch(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    int64_t batch_count, int64_t* info )
+{
+    impl::getrf_batch( m, n, A, lda, strideA, ipiv, stride_ipiv,
+                       batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// Computes LU factorizations of a batch of general m-by-n matrices,
+/// $A_i = P_i L_i U_i$, using partial pivoting with row interchanges,
+/// as in lapack::getrf. Matrices are factored in parallel using OpenMP.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`,
+/// for both strided storage (shown here) and pointer-array storage:
+///
+///     getrf_batch( m, n, Aarray, lda, ipiv_array, batch_count, info )
+///
+/// where matrix i is Aarray[ i ] and its pivots are ipiv_array[ i ].
+///
+/// @param[in] m
+///     The number of rows of each matrix A_i. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of each matrix A_i. n >= 0.
+///
+/// @param[in,out] A
+///     The batch of m-by-n matrices, each stored in an lda-by-n array,
+///     with A_i starting at A + i*strideA.
+///     On exit, the factors L_i and U_i; the unit diagonal
+///     elements of L_i are not stored.
+///
+/// @param[in] lda
+///     The leading dimension of each A_i. lda >= max(1,m).
+///
+/// @param[in] strideA
+///     Distance between the starts of consecutive matrices.
+///     strideA >= lda*n.
+///
+/// @param[out] ipiv
+///     The batch of pivot vectors, each of length min(m,n),
+///     with the pivots of A_i starting at ipiv + i*stride_ipiv.
+///     For 1 <= j <= min(m,n), row j of A_i was interchanged with
+///     row ipiv_i(j).
+///
+/// @param[in] stride_ipiv
+///     Distance between the starts of consecutive pivot vectors.
+///     stride_ipiv >= min(m,n).
+///
+/// @param[in] batch_count
+///     The number of matrices. batch_count >= 0.
+///
+/// @param[out] info
+///     The vector info of length batch_count.
+///     As for the return value of lapack::getrf:
+///     - info[ i ] = 0: successful exit.
+///     - info[ i ] = j > 0: U_i(j,j) is exactly zero. The factorization
+///       has been completed, but U_i is exactly singular.
+///
+/// Invalid arguments throw lapack::Error.
+///
+/// @ingroup gesv_batch
+void getrf_batch(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    int64_t batch_count, int64_t* info )
+{
+    impl::getrf_batch( m, n, A, lda, strideA, ipiv, stride_ipiv,
+                       batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gesv_batch
+void getrf_batch(
+    int64_t m, int64_t n,
+    float* const* Aarray, int64_t lda,
+    int64_t* const* ipiv_array,
+    int64_t batch_count, int64_t* info )
+{
+    impl::getrf_batch( m, n, Aarray, lda, ipiv_array, batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gesv_batch
+void getrf_batch(
+    int64_t m, int64_t n,
+    double* const* Aarray, int64_t lda,
+    int64_t* const* ipiv_array,
+    int64_t batch_count, int64_t* info )
+{
+    impl::getrf_batch( m, n, Aarray, lda, ipiv_array, batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gesv_batch
+void getrf_batch(
+    int64_t m, int64_t n,
+    std::complex<float>* const* Aarray, int64_t lda,
+    int64_t* const* ipiv_array,
+    int64_t batch_count, int64_t* info )
+{
+    impl::getrf_batch( m, n, Aarray, lda, ipiv_array, batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gesv_batch
+void getrf_batch(
+    int64_t m, int64_t n,
+    std::complex<double>* const* Aarray, int64_t lda,
+    int64_t* const* ipiv_array,
+    int64_t batch_count, int64_t* info )
+{
+    impl::getrf_batch( m, n, Aarray, lda, ipiv_array, batch_count, info );
+}
+
+}  // namespace lapack
@@ -0,0 +1,502 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+
+#include <atomic>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+using blas::real;
+
+//==============================================================================
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Runtime selection for lapack::getrf. Initialized from the environment
+/// variable LAPACKPP_GETRF ("lapack" or "native") on first use.
+struct GetrfMethodState
+{
+    GetrfMethodState()
+    {
+        const char* env = std::getenv( "LAPACKPP_GETRF" );
+        if (env != nullptr) {
+            MethodLU value = MethodLU::Lapack;
+            try {
+                from_string( env, &value );
+            }
+            catch (Error const&) {
+                // Unknown values leave the default LAPACK method.
+            }
+            method.store( value );
+        }
+    }
+
+    std::atomic< MethodLU > method { MethodLU::Lapack };
+    std::atomic< int64_t >  nb { 256 };
+    std::atomic< int64_t >  lookahead { 1 };
+};
+
+//------------------------------------------------------------------------------
+/// @return global getrf method state.
+GetrfMethodState& getrf_method_state()
+{
+    static GetrfMethodState state;
+    return state;
+}
+
+//------------------------------------------------------------------------------
+/// Applies row interchanges ipiv[ k1 : k2-1 ] to the n columns of A.
+/// Unlike LAPACK laswp, pivot indices are 0-based.
+/// Loops over columns in the outer loop to access A by column.
+/// @ingroup gesv_computational
+///
+template <typename scalar_t>
+void laswp(
+    int64_t n, scalar_t* A, int64_t lda,
+    int64_t k1, int64_t k2, int64_t const* ipiv )
+{
+    for (int64_t j = 0; j < n; ++j) {
+        scalar_t* Aj = &A[ j*lda ];
+        for (int64_t i = k1; i < k2; ++i) {
+            int64_t ip = ipiv[ i ];
+            if (ip != i)
+                std::swap( Aj[ i ], Aj[ ip ] );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Recursive LU panel factorization, as in LAPACK getrf2.
+/// Splits the columns [ A1 A2 ] at n1 = min(m, n)/2, factors the left
+/// half recursively, updates the right half with trsm and gemm, then
+/// factors the trailing submatrix recursively. Nearly all flops are in
+/// Level 3 BLAS, even for tall-skinny panels.
+///
+/// Pivot indices are 0-based, relative to A.
+///
+/// @return 0, or i (1-based) if U(i,i) is exactly zero.
+/// @ingroup gesv_computational
+///
+template <typename scalar_t>
+int64_t getrf_recursive(
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    int64_t* ipiv )
+{
+    using real_t = blas::real_type< scalar_t >;
+    const scalar_t zero = 0.0;
+    const scalar_t one  = 1.0;
+
+    if (m == 0 || n == 0)
+        return 0;
+
+    int64_t info = 0;
+    if (m == 1) {
+        // One row: no pivoting, only check for a zero pivot.
+        ipiv[ 0 ] = 0;
+        if (A[ 0 ] == zero)
+            info = 1;
+    }
+    else if (n == 1) {
+        // One column: find pivot, swap, and scale by its reciprocal,
+        // unless that would overflow.
+        const real_t sfmin = std::numeric_limits< real_t >::min();
+        int64_t ip = blas::iamax( m, A, 1 );
+        ipiv[ 0 ] = ip;
+        if (A[ ip ] != zero) {
+            if (ip != 0)
+                std::swap( A[ 0 ], A[ ip ] );
+            if (std::abs( A[ 0 ] ) >= sfmin) {
+                blas::scal( m - 1, one / A[ 0 ], &A[ 1 ], 1 );
+            }
+            else {
+                for (int64_t i = 1; i < m; ++i)
+                    A[ i ] /= A[ 0 ];
+            }
+        }
+        else {
+            info = 1;
+        }
+    }
+    else {
+        int64_t mn = min( m, n );
+        int64_t n1 = mn / 2;
+        int64_t n2 = n - n1;
+        scalar_t* A11 = &A[ 0 ];
+        scalar_t* A21 = &A[ n1 ];
+        scalar_t* A12 = &A[ n1*lda ];
+        scalar_t* A22 = &A[ n1 + n1*lda ];
+
+        // Factor [ A11; A21 ].
+        int64_t iinfo = getrf_recursive( m, n1, A11, lda, ipiv );
+        if (info == 0 && iinfo > 0)
+            info = iinfo;
+
+        // Apply pivots to [ A12; A22 ], then
+        // A12 = L11^{-1} A12,
+        // A22 = A22 - A21 A12.
+        laswp( n2, A12, lda, 0, n1, ipiv );
+        blas::trsm( Layout::ColMajor, Side::Left, Uplo::Lower,
+                    Op::NoTrans, Diag::Unit, n1, n2,
+                    one, A11, lda, A12, lda );
+        blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                    m - n1, n2, n1,
+                    -one, A21, lda, A12, lda,
+                    one,  A22, lda );
+
+        // Factor A22, then apply its pivots to A21.
+        iinfo = getrf_recursive( m - n1, n2, A22, lda, &ipiv[ n1 ] );
+        if (info == 0 && iinfo > 0)
+            info = iinfo + n1;
+        for (int64_t i = n1; i < mn; ++i)
+            ipiv[ i ] += n1;
+        laswp( n1, A11, lda, n1, mn, ipiv );
+    }
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// Updates block column A(:, j0 : j0+jb-1) with panel k, which starts at
+/// row and column k0 and has kb pivots: swaps rows, solves with the unit
+/// lower triangle of the panel, and updates the rows below the panel.
+/// Pivot indices are 0-based, global.
+/// @ingroup gesv_computational
+///
+template <typename scalar_t>
+void getrf_update(
+    int64_t m, scalar_t* A, int64_t lda, int64_t const* ipiv,
+    int64_t k0, int64_t kb, int64_t j0, int64_t jb )
+{
+    const scalar_t one = 1.0;
+
+    scalar_t* Akk = &A[ k0 + k0*lda ];
+    scalar_t* Akj = &A[ k0 + j0*lda ];
+    laswp( jb, &A[ j0*lda ], lda, k0, k0 + kb, ipiv );
+    blas::trsm( Layout::ColMajor, Side::Left, Uplo::Lower,
+                Op::NoTrans, Diag::Unit, kb, jb,
+                one, Akk, lda, Akj, lda );
+    if (k0 + kb < m) {
+        blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                    m - k0 - kb, jb, kb,
+                    -one, &Akk[ kb ], lda, Akj, lda,
+                    one,  &Akj[ kb ], lda );
+    }
+}
+
+}  // namespace internal
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated native LU factorization.
+/// Right-looking blocked algorithm over block columns of width nb.
+/// Each panel is factored by internal::getrf_recursive.
+/// Updates of the next lookahead block columns are separate OpenMP tasks,
+/// so the next panel can start while the rest of the trailing matrix,
+/// split into one task per block column, is still being updated.
+/// Task dependencies are tracked on one sentinel per block column.
+/// Without OpenMP, tasks execute in program order.
+/// @ingroup gesv_computational
+///
+template <typename scalar_t>
+int64_t getrf_native(
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    int64_t* ipiv, int64_t nb, int64_t lookahead )
+{
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+    lapack_error_if( nb < 1 );
+    lapack_error_if( lookahead < 0 );
+
+    int64_t mn = min( m, n );
+    if (mn == 0)
+        return 0;
+
+    int64_t info = 0;
+    if (nb >= mn) {
+        // Single panel.
+        info = internal::getrf_recursive( m, n, A, lda, ipiv );
+    }
+    else {
+        int64_t nt  = (mn + nb - 1) / nb;  // number of panels
+        int64_t ntc = (n  + nb - 1) / nb;  // number of block columns
+        std::vector< char > column_vector( ntc );
+        char* column = column_vector.data();
+
+        #pragma omp parallel
+        #pragma omp master
+        for (int64_t k = 0; k < nt; ++k) {
+            int64_t k0 = k*nb;
+            int64_t kb = min( nb, mn - k0 );
+
+            // Factor panel k. Its width may exceed kb only in the last
+            // panel when m < n; getrf_recursive also updates those columns.
+            #pragma omp task depend( inout: column[ k ] ) priority( 1 ) \
+                shared( info )
+            {
+                int64_t pb = min( nb, n - k0 );
+                int64_t iinfo = internal::getrf_recursive(
+                    m - k0, pb, &A[ k0 + k0*lda ], lda, &ipiv[ k0 ] );
+                if (info == 0 && iinfo > 0)
+                    info = iinfo + k0;
+                for (int64_t i = k0; i < k0 + kb; ++i)
+                    ipiv[ i ] += k0;
+            }
+
+            // Update lookahead block columns.
+            for (int64_t j = k + 1; j < min( k + 1 + lookahead, ntc ); ++j) {
+                #pragma omp task depend( in: column[ k ] ) \
+                    depend( inout: column[ j ] ) priority( 1 )
+                {
+                    int64_t j0 = j*nb;
+                    internal::getrf_update(
+                        m, A, lda, ipiv, k0, kb, j0, min( nb, n - j0 ) );
+                }
+            }
+
+            // Update trailing block columns, one task per block column.
+            // Depending on the first and last trailing block columns
+            // orders this after the previous trailing update and
+            // before the next panel or lookahead update that reads them.
+            if (k + 1 + lookahead < ntc) {
+                #pragma omp task depend( in: column[ k ] ) \
+                    depend( inout: column[ k + 1 + lookahead ] ) \
+                    depend( inout: column[ ntc - 1 ] )
+                {
+                    for (int64_t j = k + 1 + lookahead; j < ntc; ++j) {
+                        #pragma omp task
+                        {
+                            int64_t j0 = j*nb;
+                            internal::getrf_update(
+                                m, A, lda, ipiv, k0, kb, j0, min( nb, n - j0 ) );
+                        }
+                    }
+                    #pragma omp taskwait
+                }
+            }
+        }
+        // implicit barrier at end of parallel region waits for all tasks
+
+        // Apply each panel's row interchanges to the block columns on its left.
+        for (int64_t k = 1; k < nt; ++k) {
+            int64_t k0 = k*nb;
+            int64_t kb = min( nb, mn - k0 );
+            internal::laswp( k0, A, lda, k0, k0 + kb, ipiv );
+        }
+    }
+
+    // Convert pivots to 1-based, as in LAPACK.
+    for (int64_t i = 0; i < mn; ++i)
+        ipiv[ i ] += 1;
+
+    return info;
+}
+
+}  // namespace impl
+
+//==============================================================================
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getrf_native(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    int64_t* ipiv, int64_t nb, int64_t lookahead )
+{
+    return impl::getrf_native( m, n, A, lda, ipiv, nb, lookahead );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getrf_native(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    int64_t* ipiv, int64_t nb, int64_t lookahead )
+{
+    return impl::getrf_native( m, n, A, lda, ipiv, nb, lookahead );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getrf_native(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv, int64_t nb, int64_t lookahead )
+{
+    return impl::getrf_native( m, n, A, lda, ipiv, nb, lookahead );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes an LU factorization of a general m-by-n matrix A
+/// using partial pivoting with row interchanges, using a native C++
+/// implementation built on BLAS++, without calling LAPACK.
+/// The result is the same factorization as lapack::getrf;
+/// see lapack::getrf for details.
+///
+/// This is a right-looking blocked algorithm. Each panel of nb columns
+/// is factored with a recursive algorithm, as in LAPACK getrf2.
+/// When compiled with OpenMP, updates of the trailing matrix are OpenMP
+/// tasks, one per block column, and the next lookahead block columns
+/// are updated first so the next panel factorization overlaps the rest
+/// of the trailing update. Call from outside an OpenMP parallel region
+/// to use all threads.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     The number of rows of the matrix A. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. n >= 0.
+///
+/// @param[in,out] A
+///     The m-by-n matrix A, stored in an lda-by-n array.
+///     On entry, the m-by-n matrix to be factored.
+///     On exit, the factors L and U from the factorization
+///     $A = P L U;$ the unit diagonal elements of L are not stored.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,m).
+///
+/// @param[out] ipiv
+///     The vector ipiv of length min(m,n).
+///     The pivot indices; for 1 <= i <= min(m,n), row i of the
+///     matrix was interchanged with row ipiv(i).
+///
+/// @param[in] nb
+///     Block size (panel width). nb >= 1.
+///     If nb >= min(m,n), the whole matrix is factored recursively.
+///
+/// @param[in] lookahead
+///     Number of block columns after each panel to update eagerly.
+///     lookahead >= 0. With 0, the next panel waits for the whole
+///     trailing update.
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, U(i,i) is exactly zero. The factorization
+///              has been completed, but the factor U is exactly
+///              singular, and division by zero will occur if it is used
+///              to solve a system of equations.
+///
+/// @see getrf_set_method to use this in lapack::getrf.
+///
+/// @ingroup gesv_computational
+int64_t getrf_native(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv, int64_t nb, int64_t lookahead )
+{
+    return impl::getrf_native( m, n, A, lda, ipiv, nb, lookahead );
+}
+
+//==============================================================================
+// -----------------------------------------------------------------------------
+/// Selects the algorithm used by lapack::getrf for all precisions,
+/// and by routines that call lapack::getrf, such as lapack::LU,
+/// lapack::gesv_mixed, and the Layout overload of lapack::gesv.
+/// The column-major lapack::gesv
+/// calls LAPACK's gesv directly, so it always uses the LAPACK library.
+///
+///     - MethodLU::Lapack: call the LAPACK library getrf (default).
+///     - MethodLU::Native: call lapack::getrf_native with the given
+///       block size and lookahead, for deployments without an
+///       optimized LAPACK.
+///
+/// The initial method can also be set with the environment variable
+/// LAPACKPP_GETRF=lapack or LAPACKPP_GETRF=native.
+/// The setting is global and may be changed at any time; calls already
+/// in progress are not affected.
+///
+/// @param[in] method
+///     LU method.
+///
+/// @param[in] nb
+///     Block size for the native method. nb >= 1. Default 256.
+///
+/// @param[in] lookahead
+///     Lookahead depth for the native method. lookahead >= 0. Default 1.
+///
+/// @ingroup gesv_computational
+void getrf_set_method( MethodLU method, int64_t nb, int64_t lookahead )
+{
+    lapack_error_if( nb < 1 );
+    lapack_error_if( lookahead < 0 );
+
+    auto& state = internal::getrf_method_state();
+    state.nb.store( nb );
+    state.lookahead.store( lookahead );
+    state.method.store( method );
+}
+
+// -----------------------------------------------------------------------------
+/// @return algorithm currently used by lapack::getrf.
+/// @see getrf_set_method
+/// @ingroup gesv_computational
+MethodLU getrf_method()
+{
+    return internal::getrf_method_state().method.load();
+}
+
+//==============================================================================
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Called by lapack::getrf. If the native method is selected,
+/// factors A with getrf_native and sets info.
+/// @return true if A was factored, false to call LAPACK.
+/// @ingroup gesv_computational
+///
+template <typename scalar_t>
+bool getrf_dispatch(
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    int64_t* ipiv, int64_t* info )
+{
+    auto& state = getrf_method_state();
+    if (state.method.load() != MethodLU::Native)
+        return false;
+
+    *info = impl::getrf_native( m, n, A, lda, ipiv,
+                                state.nb.load(), state.lookahead.load() );
+    return true;
+}
+
+template
+bool getrf_dispatch(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    int64_t* ipiv, int64_t* info );
+
+template
+bool getrf_dispatch(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    int64_t* ipiv, int64_t* info );
+
+template
+bool getrf_dispatch(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv, int64_t* info );
+
+template
+bool getrf_dispatch(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv, int64_t* info );
+
+}  // namespace internal
+
+}  // namespace lapack
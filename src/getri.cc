@@ -23,19 +23,134 @@ int64_t getri(
     float* A, int64_t lda,
     int64_t const* ipiv )
 {
+    // query for workspace size
+    int64_t lwork;
+    getri_work_size(
+        n, A, lda, ipiv,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return getri(
+        n, A, lda, ipiv,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getri(
+    int64_t n,
+    double* A, int64_t lda,
+    int64_t const* ipiv )
+{
+    // query for workspace size
+    int64_t lwork;
+    getri_work_size(
+        n, A, lda, ipiv,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return getri(
+        n, A, lda, ipiv,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getri(
+    int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t const* ipiv )
+{
+    // query for workspace size
+    int64_t lwork;
+    getri_work_size(
+        n, A, lda, ipiv,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+
+    return getri(
+        n, A, lda, ipiv,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes the inverse of a matrix using the LU factorization
+/// computed by `lapack::getrf`.
+///
+/// This method inverts U and then computes $A^{-1}$ by solving the system
+/// \[
+///     A^{-1} L = U^{-1} \text{ for } A^{-1}.
+/// \]
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in,out] A
+///     The n-by-n matrix A, stored in an lda-by-n array.
+///     On entry, the factors L and U from the factorization
+///     $A = P L U$ as computed by `lapack::getrf`.
+///     On successful exit, the inverse of the original matrix A.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[in] ipiv
+///     The vector ipiv of length n.
+///     The pivot indices from `lapack::getrf`; for 1 <= i <= n, row i of the
+///     matrix was interchanged with row ipiv(i).
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, U(i,i) is exactly zero; the matrix is
+///     singular and its inverse could not be computed.
+///
+/// @ingroup gesv_computational
+int64_t getri(
+    int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t const* ipiv )
+{
+    // query for workspace size
+    int64_t lwork;
+    getri_work_size(
+        n, A, lda, ipiv,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+
+    return getri(
+        n, A, lda, ipiv,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void getri_work_size(
+    int64_t n,
+    float* A, int64_t lda,
+    int64_t const* ipiv,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "sgetri", n, lda );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( max( 1, (n) ) );
-        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
-        lapack_int const* ipiv_ptr = &ipiv_[0];
-    #else
-        lapack_int const* ipiv_ptr = ipiv;
-    #endif
+    // ipiv is not referenced by the query, so skip the 32-bit copy
+    lapack_int const* ipiv_ptr = nullptr;
     lapack_int info_ = 0;
 
-    // query for workspace size
     float qry_work[1];
     lapack_int ineg_one = -1;
     LAPACK_sgetri(
@@ -46,28 +161,129 @@ int64_t getri(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void getri_work_size(
+    int64_t n,
+    double* A, int64_t lda,
+    int64_t const* ipiv,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "dgetri", n, lda );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
 
-    LAPACK_sgetri(
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    // ipiv is not referenced by the query, so skip the 32-bit copy
+    lapack_int const* ipiv_ptr = nullptr;
+    lapack_int info_ = 0;
+
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dgetri(
         &n_,
         A, &lda_,
         ipiv_ptr,
-        &work[0], &lwork_, &info_ );
+        qry_work, &ineg_one, &info_ );
     if (info_ < 0) {
         throw Error();
     }
-    return info_;
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void getri_work_size(
+    int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t const* ipiv,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "cgetri", n, lda );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    // ipiv is not referenced by the query, so skip the 32-bit copy
+    lapack_int const* ipiv_ptr = nullptr;
+    lapack_int info_ = 0;
+
+    std::complex<float> qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_cgetri(
+        &n_,
+        (lapack_complex_float*) A, &lda_,
+        ipiv_ptr,
+        (lapack_complex_float*) qry_work, &ineg_one, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::getri with caller-provided workspace.
+/// Returns the array lengths that the workspace overload of `getri`
+/// requires, so the workspace can be allocated once, outside a loop.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// Other arguments are the same as for lapack::getri.
+/// Arrays are used only to select the precision and are not referenced.
+///
+/// @param[out] lwork
+///     The optimal length of the array work.
+///
+/// @ingroup gesv_computational
+void getri_work_size(
+    int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t const* ipiv,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "zgetri", n, lda );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    // ipiv is not referenced by the query, so skip the 32-bit copy
+    lapack_int const* ipiv_ptr = nullptr;
+    lapack_int info_ = 0;
+
+    std::complex<double> qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_zgetri(
+        &n_,
+        (lapack_complex_double*) A, &lda_,
+        ipiv_ptr,
+        (lapack_complex_double*) qry_work, &ineg_one, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
 }
 
 // -----------------------------------------------------------------------------
 /// @ingroup gesv_computational
 int64_t getri(
     int64_t n,
-    double* A, int64_t lda,
-    int64_t const* ipiv )
+    float* A, int64_t lda,
+    int64_t const* ipiv,
+    float* work, int64_t lwork )
 {
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -80,28 +296,47 @@ int64_t getri(
         lapack_int const* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "getri", float, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgetri(
+    LAPACK_sgetri(
         &n_,
         A, &lda_,
         ipiv_ptr,
-        qry_work, &ineg_one, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getri(
+    int64_t n,
+    double* A, int64_t lda,
+    int64_t const* ipiv,
+    double* work, int64_t lwork )
+{
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > ipiv_( max( 1, (n) ) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
+        lapack_int const* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int const* ipiv_ptr = ipiv;
+    #endif
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "getri", double, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
     LAPACK_dgetri(
         &n_,
         A, &lda_,
         ipiv_ptr,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -113,7 +348,8 @@ int64_t getri(
 int64_t getri(
     int64_t n,
     std::complex<float>* A, int64_t lda,
-    int64_t const* ipiv )
+    int64_t const* ipiv,
+    std::complex<float>* work, int64_t lwork )
 {
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -126,28 +362,14 @@ int64_t getri(
         lapack_int const* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
-
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cgetri(
-        &n_,
-        (lapack_complex_float*) A, &lda_,
-        ipiv_ptr,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+    LAPACK_TRACE_BLOCK( "getri", std::complex<float>, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
     LAPACK_cgetri(
         &n_,
         (lapack_complex_float*) A, &lda_,
         ipiv_ptr,
-        (lapack_complex_float*) &work[0], &lwork_, &info_ );
+        (lapack_complex_float*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -155,43 +377,28 @@ int64_t getri(
 }
 
 // -----------------------------------------------------------------------------
-/// Computes the inverse of a matrix using the LU factorization
-/// computed by `lapack::getrf`.
-///
-/// This method inverts U and then computes $A^{-1}$ by solving the system
-/// \[
-///     A^{-1} L = U^{-1} \text{ for } A^{-1}.
-/// \]
+/// Variant of lapack::getri that takes caller-provided workspace
+/// instead of querying and allocating it on each call.
+/// Use lapack::getri_work_size to get the required lengths.
 ///
 /// Overloaded versions are available for
 /// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
 ///
-/// @param[in] n
-///     The order of the matrix A. n >= 0.
-///
-/// @param[in,out] A
-///     The n-by-n matrix A, stored in an lda-by-n array.
-///     On entry, the factors L and U from the factorization
-///     $A = P L U$ as computed by `lapack::getrf`.
-///     On successful exit, the inverse of the original matrix A.
+/// Other arguments are the same as for lapack::getri.
 ///
-/// @param[in] lda
-///     The leading dimension of the array A. lda >= max(1,n).
+/// @param[out] work
+///     The vector work of length lwork. Workspace.
 ///
-/// @param[in] ipiv
-///     The vector ipiv of length n.
-///     The pivot indices from `lapack::getrf`; for 1 <= i <= n, row i of the
-///     matrix was interchanged with row ipiv(i).
-///
-/// @return = 0: successful exit
-/// @return > 0: if return value = i, U(i,i) is exactly zero; the matrix is
-///     singular and its inverse could not be computed.
+/// @param[in] lwork
+///     The length of the array work.
+///     Use the value from lapack::getri_work_size for best performance.
 ///
 /// @ingroup gesv_computational
 int64_t getri(
     int64_t n,
     std::complex<double>* A, int64_t lda,
-    int64_t const* ipiv )
+    int64_t const* ipiv,
+    std::complex<double>* work, int64_t lwork )
 {
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -204,28 +411,14 @@ int64_t getri(
         lapack_int const* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
-
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgetri(
-        &n_,
-        (lapack_complex_double*) A, &lda_,
-        ipiv_ptr,
-        (lapack_complex_double*) qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+    LAPACK_TRACE_BLOCK( "getri", std::complex<double>, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
     LAPACK_zgetri(
         &n_,
         (lapack_complex_double*) A, &lda_,
         ipiv_ptr,
-        (lapack_complex_double*) &work[0], &lwork_, &info_ );
+        (lapack_complex_double*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
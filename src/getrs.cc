@@ -38,6 +38,7 @@ int64_t getrs(
     #endif
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "getrs", float, 0, n, 0, nrhs, info_ );
 
     LAPACK_sgetrs(
         &trans_, &n_, &nrhs_,
@@ -73,6 +74,7 @@ int64_t getrs(
     #endif
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "getrs", double, 0, n, 0, nrhs, info_ );
 
     LAPACK_dgetrs(
         &trans_, &n_, &nrhs_,
@@ -108,6 +110,7 @@ int64_t getrs(
     #endif
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "getrs", std::complex<float>, 0, n, 0, nrhs, info_ );
 
     LAPACK_cgetrs(
         &trans_, &n_, &nrhs_,
@@ -196,6 +199,7 @@ int64_t getrs(
     #endif
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "getrs", std::complex<double>, 0, n, 0, nrhs, info_ );
 
     LAPACK_zgetrs(
         &trans_, &n_, &nrhs_,
@@ -209,4 +213,129 @@ int64_t getrs(
     return info_;
 }
 
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper for either layout.
+/// @ingroup gesv_computational
+///
+template <typename scalar_t>
+int64_t getrs(
+    lapack::Layout layout, lapack::Op trans, int64_t n, int64_t nrhs,
+    scalar_t const* A, int64_t lda,
+    int64_t const* ipiv,
+    scalar_t* B, int64_t ldb )
+{
+    if (layout == Layout::ColMajor)
+        return lapack::getrs( trans, n, nrhs, A, lda, ipiv, B, ldb );
+
+    lapack_error_if( layout != Layout::RowMajor );
+    lapack_error_if( trans != Op::NoTrans &&
+                     trans != Op::Trans &&
+                     trans != Op::ConjTrans );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( ldb < max( 1, nrhs ) );
+
+    if (n == 0 || nrhs == 0)
+        return 0;
+
+    // Rows of row-major B are contiguous, so swaps are vector swaps,
+    // and the triangular solves use row-major BLAS; no copies.
+    const scalar_t one = 1;
+    auto swap_rows = [&]( int64_t i ) {
+        int64_t p = ipiv[ i ] - 1;
+        if (p != i)
+            blas::swap( nrhs, &B[ i*ldb ], 1, &B[ p*ldb ], 1 );
+    };
+    if (trans == Op::NoTrans) {
+        // Solve A X = B with A = P L U.
+        for (int64_t i = 0; i < n; ++i)
+            swap_rows( i );
+        blas::trsm( Layout::RowMajor, blas::Side::Left, Uplo::Lower,
+                    Op::NoTrans, Diag::Unit, n, nrhs, one, A, lda, B, ldb );
+        blas::trsm( Layout::RowMajor, blas::Side::Left, Uplo::Upper,
+                    Op::NoTrans, Diag::NonUnit, n, nrhs, one, A, lda, B, ldb );
+    }
+    else {
+        // Solve A^T X = B with A^T = U^T L^T P^T, or A^H likewise.
+        blas::trsm( Layout::RowMajor, blas::Side::Left, Uplo::Upper,
+                    trans, Diag::NonUnit, n, nrhs, one, A, lda, B, ldb );
+        blas::trsm( Layout::RowMajor, blas::Side::Left, Uplo::Lower,
+                    trans, Diag::Unit, n, nrhs, one, A, lda, B, ldb );
+        for (int64_t i = n - 1; i >= 0; --i)
+            swap_rows( i );
+    }
+    return 0;
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// @ingroup gesv_computational
+int64_t getrs(
+    lapack::Layout layout, lapack::Op trans, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    int64_t const* ipiv,
+    float* B, int64_t ldb )
+{
+    return impl::getrs( layout, trans, n, nrhs, A, lda, ipiv, B, ldb );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getrs(
+    lapack::Layout layout, lapack::Op trans, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    int64_t const* ipiv,
+    double* B, int64_t ldb )
+{
+    return impl::getrs( layout, trans, n, nrhs, A, lda, ipiv, B, ldb );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getrs(
+    lapack::Layout layout, lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    int64_t const* ipiv,
+    std::complex<float>* B, int64_t ldb )
+{
+    return impl::getrs( layout, trans, n, nrhs, A, lda, ipiv, B, ldb );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::getrs that takes the matrix layout.
+/// For row-major layout, A holds the factors from lapack::getrf
+/// with the same layout, and B and X are stored row-major.
+///
+/// For row-major, the row interchanges swap contiguous rows of B,
+/// and the triangular solves call row-major BLAS trsm, so nothing
+/// is copied.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// Other arguments are the same as for lapack::getrs.
+///
+/// @param[in] layout
+///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B.
+///     If layout = ColMajor, ldb >= max(1,n);
+///     if layout = RowMajor, ldb >= max(1,nrhs).
+///
+/// @ingroup gesv_computational
+int64_t getrs(
+    lapack::Layout layout, lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    int64_t const* ipiv,
+    std::complex<double>* B, int64_t ldb )
+{
+    return impl::getrs( layout, trans, n, nrhs, A, lda, ipiv, B, ldb );
+}
+
 }  // namespace lapack
@@ -0,0 +1,357 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/batch.hh"
+#include "lapack_internal.hh"
+#include "lapack/fortran.h"
+#include "NoConstructAllocator.hh"
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+//==============================================================================
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, float version.
+/// @ingroup gesv_batch_internal
+inline void getrs(
+    char trans, lapack_int n, lapack_int nrhs,
+    float const* A, lapack_int lda,
+    lapack_int const* ipiv,
+    float* B, lapack_int ldb,
+    lapack_int* info )
+{
+    LAPACK_sgetrs( &trans, &n, &nrhs, A, &lda, ipiv, B, &ldb, info );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, double version.
+/// @ingroup gesv_batch_internal
+inline void getrs(
+    char trans, lapack_int n, lapack_int nrhs,
+    double const* A, lapack_int lda,
+    lapack_int const* ipiv,
+    double* B, lapack_int ldb,
+    lapack_int* info )
+{
+    LAPACK_dgetrs( &trans, &n, &nrhs, A, &lda, ipiv, B, &ldb, info );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, complex<float> version.
+/// @ingroup gesv_batch_internal
+inline void getrs(
+    char trans, lapack_int n, lapack_int nrhs,
+    std::complex<float> const* A, lapack_int lda,
+    lapack_int const* ipiv,
+    std::complex<float>* B, lapack_int ldb,
+    lapack_int* info )
+{
+    LAPACK_cgetrs(
+        &trans, &n, &nrhs,
+        (lapack_complex_float*) A, &lda, ipiv,
+        (lapack_complex_float*) B, &ldb, info );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, complex<double> version.
+/// @ingroup gesv_batch_internal
+inline void getrs(
+    char trans, lapack_int n, lapack_int nrhs,
+    std::complex<double> const* A, lapack_int lda,
+    lapack_int const* ipiv,
+    std::complex<double>* B, lapack_int ldb,
+    lapack_int* info )
+{
+    LAPACK_zgetrs(
+        &trans, &n, &nrhs,
+        (lapack_complex_double*) A, &lda, ipiv,
+        (lapack_complex_double*) B, &ldb, info );
+}
+
+}  // namespace internal
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks and converts arguments once,
+/// then calls low-level wrapper for each matrix in parallel.
+/// Aarray(i), ipiv_array(i), Barray(i) return pointers to the i-th
+/// matrix, pivot vector, and right-hand sides.
+/// @ingroup gesv_batch_internal
+///
+template <typename scalar_t,
+          typename Aarray_t, typename ipiv_array_t, typename Barray_t>
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    Aarray_t Aarray, int64_t lda,
+    ipiv_array_t ipiv_array,
+    Barray_t Barray, int64_t ldb,
+    int64_t batch_count, int64_t* info )
+{
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( ldb < max( 1, n ) );
+    lapack_error_if( batch_count < 0 );
+
+    char trans_ = to_char( trans );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+
+    #pragma omp parallel if (batch_count > 1)
+    {
+        #ifndef LAPACK_ILP64
+            // 32-bit copy, one per thread
+            lapack::vector< lapack_int > ipiv_( max( 1, n ) );
+        #endif
+
+        #pragma omp for schedule( static )
+        for (int64_t i = 0; i < batch_count; ++i) {
+            int64_t const* ipiv = ipiv_array( i );
+            #ifndef LAPACK_ILP64
+                std::copy( &ipiv[0], &ipiv[n], ipiv_.begin() );
+                lapack_int const* ipiv_ptr = &ipiv_[0];
+            #else
+                lapack_int const* ipiv_ptr = ipiv;
+            #endif
+            lapack_int info_ = 0;
+
+            internal::getrs(
+                trans_, n_, nrhs_, Aarray( i ), lda_, ipiv_ptr,
+                Barray( i ), ldb_, &info_ );
+            info[ i ] = info_;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Strided version.
+/// @ingroup gesv_batch_internal
+///
+template <typename scalar_t>
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    scalar_t const* A, int64_t lda, int64_t strideA,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    scalar_t* B, int64_t ldb, int64_t strideB,
+    int64_t batch_count, int64_t* info )
+{
+    if (batch_count > 1) {
+        lapack_error_if( strideA < lda*n );
+        lapack_error_if( stride_ipiv < n );
+        lapack_error_if( strideB < ldb*nrhs );
+    }
+
+    getrs_batch< scalar_t >(
+        trans, n, nrhs,
+        [=]( int64_t i ) { return A + i*strideA; }, lda,
+        [=]( int64_t i ) { return ipiv + i*stride_ipiv; },
+        [=]( int64_t i ) { return B + i*strideB; }, ldb,
+        batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// Pointer-array version.
+/// @ingroup gesv_batch_internal
+///
+template <typename scalar_t>
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    scalar_t const* const* Aarray, int64_t lda,
+    int64_t const* const* ipiv_array,
+    scalar_t* const* Barray, int64_t ldb,
+    int64_t batch_count, int64_t* info )
+{
+    getrs_batch< scalar_t >(
+        trans, n, nrhs,
+        [=]( int64_t i ) { return Aarray[ i ]; }, lda,
+        [=]( int64_t i ) { return ipiv_array[ i ]; },
+        [=]( int64_t i ) { return Barray[ i ]; }, ldb,
+        batch_count, info );
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// @ingroup gesv_batch
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda, int64_t strideA,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    float* B, int64_t ldb, int64_t strideB,
+    int64_t batch_count, int64_t* info )
+{
+    impl::getrs_batch( trans, n, nrhs, A, lda, strideA, ipiv, stride_ipiv,
+                       B, ldb, strideB, batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gesv_batch
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda, int64_t strideA,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    double* B, int64_t ldb, int64_t strideB,
+    int64_t batch_count, int64_t* info )
+{
+    impl::getrs_batch( trans, n, nrhs, A, lda, strideA, ipiv, stride_ipiv,
+                       B, ldb, strideB, batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gesv_batch
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda, int64_t strideA,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_count, int64_t* info )
+{
+    impl::getrs_batch( trans, n, nrhs, A, lda, strideA, ipiv, stride_ipiv,
+                       B, ldb, strideB, batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// Solves a batch of systems of linear equations
+///     $A_i X_i = B_i$,
+///     $A_i^T X_i = B_i$, or
+///     $A_i^H X_i = B_i$
+/// with general n-by-n matrices A_i, using the LU factorizations computed
+/// by lapack::getrf_batch, as in lapack::getrs.
+/// Systems are solved in parallel using OpenMP.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`,
+/// for both strided storage (shown here) and pointer-array storage:
+///
+///     getrs_batch( trans, n, nrhs, Aarray, lda, ipiv_array,
+///                  Barray, ldb, batch_count, info )
+///
+/// @param[in] trans
+///     The form of the systems of equations:
+///     - lapack::Op::NoTrans:   $A_i   X_i = B_i$ (No transpose)
+///     - lapack::Op::Trans:     $A_i^T X_i = B_i$ (Transpose)
+///     - lapack::Op::ConjTrans: $A_i^H X_i = B_i$ (Conjugate transpose)
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns
+///     of each matrix B_i. nrhs >= 0.
+///
+/// @param[in] A
+///     The batch of factors L_i and U_i from lapack::getrf_batch,
+///     each stored in an lda-by-n array, with A_i starting at A + i*strideA.
+///
+/// @param[in] lda
+///     The leading dimension of each A_i. lda >= max(1,n).
+///
+/// @param[in] strideA
+///     Distance between the starts of consecutive matrices.
+///     strideA >= lda*n.
+///
+/// @param[in] ipiv
+///     The batch of pivot vectors from lapack::getrf_batch, each of length n,
+///     with the pivots of A_i starting at ipiv + i*stride_ipiv.
+///
+/// @param[in] stride_ipiv
+///     Distance between the starts of consecutive pivot vectors.
+///     stride_ipiv >= n.
+///
+/// @param[in,out] B
+///     The batch of n-by-nrhs matrices, each stored in an ldb-by-nrhs array,
+///     with B_i starting at B + i*strideB.
+///     On entry, the right hand side matrices B_i.
+///     On exit, the solution matrices X_i.
+///
+/// @param[in] ldb
+///     The leading dimension of each B_i. ldb >= max(1,n).
+///
+/// @param[in] strideB
+///     Distance between the starts of consecutive right hand sides.
+///     strideB >= ldb*nrhs.
+///
+/// @param[in] batch_count
+///     The number of systems. batch_count >= 0.
+///
+/// @param[out] info
+///     The vector info of length batch_count; info[ i ] = 0 on
+///     successful exit.
+///
+/// Invalid arguments throw lapack::Error.
+///
+/// @ingroup gesv_batch
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda, int64_t strideA,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_count, int64_t* info )
+{
+    impl::getrs_batch( trans, n, nrhs, A, lda, strideA, ipiv, stride_ipiv,
+                       B, ldb, strideB, batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gesv_batch
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    float const* const* Aarray, int64_t lda,
+    int64_t const* const* ipiv_array,
+    float* const* Barray, int64_t ldb,
+    int64_t batch_count, int64_t* info )
+{
+    impl::getrs_batch( trans, n, nrhs, Aarray, lda, ipiv_array,
+                       Barray, ldb, batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gesv_batch
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    double const* const* Aarray, int64_t lda,
+    int64_t const* const* ipiv_array,
+    double* const* Barray, int64_t ldb,
+    int64_t batch_count, int64_t* info )
+{
+    impl::getrs_batch( trans, n, nrhs, Aarray, lda, ipiv_array,
+                       Barray, ldb, batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gesv_batch
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<float> const* const* Aarray, int64_t lda,
+    int64_t const* const* ipiv_array,
+    std::complex<float>* const* Barray, int64_t ldb,
+    int64_t batch_count, int64_t* info )
+{
+    impl::getrs_batch( trans, n, nrhs, Aarray, lda, ipiv_array,
+                       Barray, ldb, batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gesv_batch
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<double> const* const* Aarray, int64_t lda,
+    int64_t const* const* ipiv_array,
+    std::complex<double>* const* Barray, int64_t ldb,
+    int64_t batch_count, int64_t* info )
+{
+    impl::getrs_batch( trans, n, nrhs, Aarray, lda, ipiv_array,
+                       Barray, ldb, batch_count, info );
+}
+
+}  // namespace lapack
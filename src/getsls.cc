@@ -35,6 +35,7 @@ int64_t getsls(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "getsls", float, m, n, 0, nrhs, info_ );
 
     // query for workspace size
     float qry_work[1];
@@ -95,6 +96,7 @@ int64_t getsls(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "getsls", double, m, n, 0, nrhs, info_ );
 
     // query for workspace size
     double qry_work[1];
@@ -151,6 +153,7 @@ int64_t getsls(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "getsls", std::complex<float>, m, n, 0, nrhs, info_ );
 
     // query for workspace size
     std::complex<float> qry_work[1];
@@ -207,6 +210,7 @@ int64_t getsls(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "getsls", std::complex<double>, m, n, 0, nrhs, info_ );
 
     // query for workspace size
     std::complex<double> qry_work[1];
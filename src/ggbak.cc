@@ -30,6 +30,7 @@ int64_t ggbak(
     lapack_int m_ = to_lapack_int( m );
     lapack_int ldv_ = to_lapack_int( ldv );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ggbak", float, m, n, 0, 0, info_ );
 
     LAPACK_sggbak(
         &balance_, &side_, &n_, &ilo_, &ihi_,
@@ -58,6 +59,7 @@ int64_t ggbak(
     lapack_int m_ = to_lapack_int( m );
     lapack_int ldv_ = to_lapack_int( ldv );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ggbak", double, m, n, 0, 0, info_ );
 
     LAPACK_dggbak(
         &balance_, &side_, &n_, &ilo_, &ihi_,
@@ -86,6 +88,7 @@ int64_t ggbak(
     lapack_int m_ = to_lapack_int( m );
     lapack_int ldv_ = to_lapack_int( ldv );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ggbak", std::complex<float>, m, n, 0, 0, info_ );
 
     LAPACK_cggbak(
         &balance_, &side_, &n_, &ilo_, &ihi_,
@@ -114,6 +117,7 @@ int64_t ggbak(
     lapack_int m_ = to_lapack_int( m );
     lapack_int ldv_ = to_lapack_int( ldv );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ggbak", std::complex<double>, m, n, 0, 0, info_ );
 
     LAPACK_zggbak(
         &balance_, &side_, &n_, &ilo_, &ihi_,
@@ -33,6 +33,7 @@ int64_t ggbal(
     lapack_int ilo_ = 0;  // out
     lapack_int ihi_ = 0;  // out
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ggbal", float, 0, n, 0, 0, info_ );
 
     // from docs
     int64_t lwork = (balance == Balance::Scale || balance == Balance::Both ? max( 1, 6*n ) : 1);
@@ -73,6 +74,7 @@ int64_t ggbal(
     lapack_int ilo_ = 0;  // out
     lapack_int ihi_ = 0;  // out
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ggbal", double, 0, n, 0, 0, info_ );
 
     // from docs
     int64_t lwork = (balance == Balance::Scale || balance == Balance::Both ? max( 1, 6*n ) : 1);
@@ -113,6 +115,7 @@ int64_t ggbal(
     lapack_int ilo_ = 0;  // out
     lapack_int ihi_ = 0;  // out
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ggbal", std::complex<float>, 0, n, 0, 0, info_ );
 
     // from docs
     int64_t lwork = (balance == Balance::Scale || balance == Balance::Both ? max( 1, 6*n ) : 1);
@@ -153,6 +156,7 @@ int64_t ggbal(
     lapack_int ilo_ = 0;  // out
     lapack_int ihi_ = 0;  // out
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ggbal", std::complex<double>, 0, n, 0, 0, info_ );
 
     // from docs
     int64_t lwork = (balance == Balance::Scale || balance == Balance::Both ? max( 1, 6*n ) : 1);
@@ -38,6 +38,7 @@ int64_t gges(
     lapack_int ldvsl_ = to_lapack_int( ldvsl );
     lapack_int ldvsr_ = to_lapack_int( ldvsr );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gges", std::complex<float>, 0, n, 0, 0, info_ );
 
     // split-complex representation
     lapack::vector< float > alphar( max( 1, n ) );
@@ -115,6 +116,7 @@ int64_t gges(
     lapack_int ldvsl_ = to_lapack_int( ldvsl );
     lapack_int ldvsr_ = to_lapack_int( ldvsr );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gges", std::complex<double>, 0, n, 0, 0, info_ );
 
     // split-complex representation
     lapack::vector< double > alphar( max( 1, n ) );
@@ -192,6 +194,7 @@ int64_t gges(
     lapack_int ldvsl_ = to_lapack_int( ldvsl );
     lapack_int ldvsr_ = to_lapack_int( ldvsr );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gges", std::complex<float>, 0, n, 0, 0, info_ );
 
     // query for workspace size
     std::complex<float> qry_work[1];
@@ -263,6 +266,7 @@ int64_t gges(
     lapack_int ldvsl_ = to_lapack_int( ldvsl );
     lapack_int ldvsr_ = to_lapack_int( ldvsr );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gges", std::complex<double>, 0, n, 0, 0, info_ );
 
     // query for workspace size
     std::complex<double> qry_work[1];
@@ -40,6 +40,7 @@ int64_t gges3(
     lapack_int ldvsl_ = to_lapack_int( ldvsl );
     lapack_int ldvsr_ = to_lapack_int( ldvsr );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gges3", std::complex<float>, 0, n, 0, 0, info_ );
 
     // split-complex representation
     lapack::vector< float > alphar( max( 1, n ) );
@@ -117,6 +118,7 @@ int64_t gges3(
     lapack_int ldvsl_ = to_lapack_int( ldvsl );
     lapack_int ldvsr_ = to_lapack_int( ldvsr );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gges3", std::complex<double>, 0, n, 0, 0, info_ );
 
     // split-complex representation
     lapack::vector< double > alphar( max( 1, n ) );
@@ -194,6 +196,7 @@ int64_t gges3(
     lapack_int ldvsl_ = to_lapack_int( ldvsl );
     lapack_int ldvsr_ = to_lapack_int( ldvsr );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gges3", std::complex<float>, 0, n, 0, 0, info_ );
 
     // query for workspace size
     std::complex<float> qry_work[1];
@@ -265,6 +268,7 @@ int64_t gges3(
     lapack_int ldvsl_ = to_lapack_int( ldvsl );
     lapack_int ldvsr_ = to_lapack_int( ldvsr );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gges3", std::complex<double>, 0, n, 0, 0, info_ );
 
     // query for workspace size
     std::complex<double> qry_work[1];
@@ -41,6 +41,7 @@ int64_t ggesx(
     lapack_int ldvsl_ = to_lapack_int( ldvsl );
     lapack_int ldvsr_ = to_lapack_int( ldvsr );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ggesx", std::complex<float>, 0, n, 0, 0, info_ );
 
     // split-complex representation
     lapack::vector< float > alphar( max( 1, n ) );
@@ -130,6 +131,7 @@ int64_t ggesx(
     lapack_int ldvsl_ = to_lapack_int( ldvsl );
     lapack_int ldvsr_ = to_lapack_int( ldvsr );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ggesx", std::complex<double>, 0, n, 0, 0, info_ );
 
     // split-complex representation
     lapack::vector< double > alphar( max( 1, n ) );
@@ -219,6 +221,7 @@ int64_t ggesx(
     lapack_int ldvsl_ = to_lapack_int( ldvsl );
     lapack_int ldvsr_ = to_lapack_int( ldvsr );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ggesx", std::complex<float>, 0, n, 0, 0, info_ );
 
     // query for workspace size
     std::complex<float> qry_work[1];
@@ -302,6 +305,7 @@ int64_t ggesx(
     lapack_int ldvsl_ = to_lapack_int( ldvsl );
     lapack_int ldvsr_ = to_lapack_int( ldvsr );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ggesx", std::complex<double>, 0, n, 0, 0, info_ );
 
     // query for workspace size
     std::complex<double> qry_work[1];
@@ -34,6 +34,7 @@ int64_t ggev(
     lapack_int ldvl_ = to_lapack_int( ldvl );
     lapack_int ldvr_ = to_lapack_int( ldvr );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ggev", std::complex<float>, 0, n, 0, 0, info_ );
 
     // split-complex representation
     lapack::vector< float > alphar( max( 1, n ) );
@@ -98,6 +99,7 @@ int64_t ggev(
     lapack_int ldvl_ = to_lapack_int( ldvl );
     lapack_int ldvr_ = to_lapack_int( ldvr );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ggev", std::complex<double>, 0, n, 0, 0, info_ );
 
     // split-complex representation
     lapack::vector< double > alphar( max( 1, n ) );
@@ -162,6 +164,7 @@ int64_t ggev(
     lapack_int ldvl_ = to_lapack_int( ldvl );
     lapack_int ldvr_ = to_lapack_int( ldvr );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ggev", std::complex<float>, 0, n, 0, 0, info_ );
 
     // query for workspace size
     std::complex<float> qry_work[1];
@@ -222,6 +225,7 @@ int64_t ggev(
     lapack_int ldvl_ = to_lapack_int( ldvl );
     lapack_int ldvr_ = to_lapack_int( ldvr );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ggev", std::complex<double>, 0, n, 0, 0, info_ );
 
     // query for workspace size
     std::complex<double> qry_work[1];
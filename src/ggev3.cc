@@ -36,6 +36,7 @@ int64_t ggev3(
     lapack_int ldvl_ = to_lapack_int( ldvl );
     lapack_int ldvr_ = to_lapack_int( ldvr );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ggev3", std::complex<float>, 0, n, 0, 0, info_ );
 
     // split-complex representation
     lapack::vector< float > alphar( max( 1, n ) );
@@ -100,6 +101,7 @@ int64_t ggev3(
     lapack_int ldvl_ = to_lapack_int( ldvl );
     lapack_int ldvr_ = to_lapack_int( ldvr );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ggev3", std::complex<double>, 0, n, 0, 0, info_ );
 
     // split-complex representation
     lapack::vector< double > alphar( max( 1, n ) );
@@ -164,6 +166,7 @@ int64_t ggev3(
     lapack_int ldvl_ = to_lapack_int( ldvl );
     lapack_int ldvr_ = to_lapack_int( ldvr );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ggev3", std::complex<float>, 0, n, 0, 0, info_ );
 
     // query for workspace size
     std::complex<float> qry_work[1];
@@ -224,6 +227,7 @@ int64_t ggev3(
     lapack_int ldvl_ = to_lapack_int( ldvl );
     lapack_int ldvr_ = to_lapack_int( ldvr );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ggev3", std::complex<double>, 0, n, 0, 0, info_ );
 
     // query for workspace size
     std::complex<double> qry_work[1];
@@ -26,44 +26,18 @@ int64_t ggglm(
     float* X,
     float* Y )
 {
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int p_ = to_lapack_int( p );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int ldb_ = to_lapack_int( ldb );
-    lapack_int info_ = 0;
-
     // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sggglm(
-        &n_, &m_, &p_,
-        A, &lda_,
-        B, &ldb_,
-        D,
-        X,
-        Y,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork;
+    ggglm_work_size(
+        n, m, p, A, lda, B, ldb, D, X, Y,
+        &lwork );
 
     // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    lapack::vector< float > work( lwork );
 
-    LAPACK_sggglm(
-        &n_, &m_, &p_,
-        A, &lda_,
-        B, &ldb_,
-        D,
-        X,
-        Y,
-        &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return ggglm(
+        n, m, p, A, lda, B, ldb, D, X, Y,
+        &work[0], lwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -76,44 +50,18 @@ int64_t ggglm(
     double* X,
     double* Y )
 {
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int p_ = to_lapack_int( p );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int ldb_ = to_lapack_int( ldb );
-    lapack_int info_ = 0;
-
     // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dggglm(
-        &n_, &m_, &p_,
-        A, &lda_,
-        B, &ldb_,
-        D,
-        X,
-        Y,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork;
+    ggglm_work_size(
+        n, m, p, A, lda, B, ldb, D, X, Y,
+        &lwork );
 
     // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    lapack::vector< double > work( lwork );
 
-    LAPACK_dggglm(
-        &n_, &m_, &p_,
-        A, &lda_,
-        B, &ldb_,
-        D,
-        X,
-        Y,
-        &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return ggglm(
+        n, m, p, A, lda, B, ldb, D, X, Y,
+        &work[0], lwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -126,44 +74,18 @@ int64_t ggglm(
     std::complex<float>* X,
     std::complex<float>* Y )
 {
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int p_ = to_lapack_int( p );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int ldb_ = to_lapack_int( ldb );
-    lapack_int info_ = 0;
-
     // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cggglm(
-        &n_, &m_, &p_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_,
-        (lapack_complex_float*) D,
-        (lapack_complex_float*) X,
-        (lapack_complex_float*) Y,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork;
+    ggglm_work_size(
+        n, m, p, A, lda, B, ldb, D, X, Y,
+        &lwork );
 
     // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+    lapack::vector< std::complex<float> > work( lwork );
 
-    LAPACK_cggglm(
-        &n_, &m_, &p_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_,
-        (lapack_complex_float*) D,
-        (lapack_complex_float*) X,
-        (lapack_complex_float*) Y,
-        (lapack_complex_float*) &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return ggglm(
+        n, m, p, A, lda, B, ldb, D, X, Y,
+        &work[0], lwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -260,6 +182,169 @@ int64_t ggglm(
     std::complex<double>* X,
     std::complex<double>* Y )
 {
+    // query for workspace size
+    int64_t lwork;
+    ggglm_work_size(
+        n, m, p, A, lda, B, ldb, D, X, Y,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+
+    return ggglm(
+        n, m, p, A, lda, B, ldb, D, X, Y,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup ggls
+void ggglm_work_size(
+    int64_t n, int64_t m, int64_t p,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* D,
+    float* X,
+    float* Y,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "sggglm", n, m, p, lda, ldb );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int info_ = 0;
+
+    float qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_sggglm(
+        &n_, &m_, &p_,
+        A, &lda_,
+        B, &ldb_,
+        D,
+        X,
+        Y,
+        qry_work, &ineg_one, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup ggls
+void ggglm_work_size(
+    int64_t n, int64_t m, int64_t p,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* D,
+    double* X,
+    double* Y,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "dggglm", n, m, p, lda, ldb );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int info_ = 0;
+
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dggglm(
+        &n_, &m_, &p_,
+        A, &lda_,
+        B, &ldb_,
+        D,
+        X,
+        Y,
+        qry_work, &ineg_one, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup ggls
+void ggglm_work_size(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* D,
+    std::complex<float>* X,
+    std::complex<float>* Y,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "cggglm", n, m, p, lda, ldb );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int info_ = 0;
+
+    std::complex<float> qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_cggglm(
+        &n_, &m_, &p_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) B, &ldb_,
+        (lapack_complex_float*) D,
+        (lapack_complex_float*) X,
+        (lapack_complex_float*) Y,
+        (lapack_complex_float*) qry_work, &ineg_one, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::ggglm with caller-provided workspace.
+/// Returns the array lengths that the workspace overload of `ggglm`
+/// requires, so the workspace can be allocated once, outside a loop.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// Other arguments are the same as for lapack::ggglm.
+/// Arrays are used only to select the precision and are not referenced.
+///
+/// @param[out] lwork
+///     The optimal length of the array work.
+///
+/// @ingroup ggls
+void ggglm_work_size(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* D,
+    std::complex<double>* X,
+    std::complex<double>* Y,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "zggglm", n, m, p, lda, ldb );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int m_ = to_lapack_int( m );
     lapack_int p_ = to_lapack_int( p );
@@ -267,7 +352,6 @@ int64_t ggglm(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
 
-    // query for workspace size
     std::complex<double> qry_work[1];
     lapack_int ineg_one = -1;
     LAPACK_zggglm(
@@ -281,10 +365,147 @@ int64_t ggglm(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup ggls
+int64_t ggglm(
+    int64_t n, int64_t m, int64_t p,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* D,
+    float* X,
+    float* Y,
+    float* work, int64_t lwork )
+{
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ggglm", float, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+
+    LAPACK_sggglm(
+        &n_, &m_, &p_,
+        A, &lda_,
+        B, &ldb_,
+        D,
+        X,
+        Y,
+        work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup ggls
+int64_t ggglm(
+    int64_t n, int64_t m, int64_t p,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* D,
+    double* X,
+    double* Y,
+    double* work, int64_t lwork )
+{
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ggglm", double, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+
+    LAPACK_dggglm(
+        &n_, &m_, &p_,
+        A, &lda_,
+        B, &ldb_,
+        D,
+        X,
+        Y,
+        work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup ggls
+int64_t ggglm(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* D,
+    std::complex<float>* X,
+    std::complex<float>* Y,
+    std::complex<float>* work, int64_t lwork )
+{
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ggglm", std::complex<float>, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+
+    LAPACK_cggglm(
+        &n_, &m_, &p_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) B, &ldb_,
+        (lapack_complex_float*) D,
+        (lapack_complex_float*) X,
+        (lapack_complex_float*) Y,
+        (lapack_complex_float*) work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::ggglm that takes caller-provided workspace
+/// instead of querying and allocating it on each call.
+/// Use lapack::ggglm_work_size to get the required lengths.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// Other arguments are the same as for lapack::ggglm.
+///
+/// @param[out] work
+///     The vector work of length lwork. Workspace.
+///
+/// @param[in] lwork
+///     The length of the array work.
+///     Use the value from lapack::ggglm_work_size for best performance.
+///
+/// @ingroup ggls
+int64_t ggglm(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* D,
+    std::complex<double>* X,
+    std::complex<double>* Y,
+    std::complex<double>* work, int64_t lwork )
+{
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ggglm", std::complex<double>, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
     LAPACK_zggglm(
         &n_, &m_, &p_,
@@ -293,7 +514,7 @@ int64_t ggglm(
         (lapack_complex_double*) D,
         (lapack_complex_double*) X,
         (lapack_complex_double*) Y,
-        (lapack_complex_double*) &work[0], &lwork_, &info_ );
+        (lapack_complex_double*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
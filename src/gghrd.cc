@@ -33,6 +33,7 @@ int64_t gghrd(
     lapack_int ldq_ = to_lapack_int( ldq );
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gghrd", float, 0, n, 0, 0, info_ );
 
     LAPACK_sgghrd(
         &compq_, &compz_, &n_, &ilo_, &ihi_,
@@ -65,6 +66,7 @@ int64_t gghrd(
     lapack_int ldq_ = to_lapack_int( ldq );
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gghrd", double, 0, n, 0, 0, info_ );
 
     LAPACK_dgghrd(
         &compq_, &compz_, &n_, &ilo_, &ihi_,
@@ -97,6 +99,7 @@ int64_t gghrd(
     lapack_int ldq_ = to_lapack_int( ldq );
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gghrd", std::complex<float>, 0, n, 0, 0, info_ );
 
     LAPACK_cgghrd(
         &compq_, &compz_, &n_, &ilo_, &ihi_,
@@ -129,6 +132,7 @@ int64_t gghrd(
     lapack_int ldq_ = to_lapack_int( ldq );
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gghrd", std::complex<double>, 0, n, 0, 0, info_ );
 
     LAPACK_zgghrd(
         &compq_, &compz_, &n_, &ilo_, &ihi_,
@@ -26,44 +26,18 @@ int64_t gglse(
     float* D,
     float* X )
 {
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int p_ = to_lapack_int( p );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int ldb_ = to_lapack_int( ldb );
-    lapack_int info_ = 0;
-
     // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgglse(
-        &m_, &n_, &p_,
-        A, &lda_,
-        B, &ldb_,
-        C,
-        D,
-        X,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork;
+    gglse_work_size(
+        m, n, p, A, lda, B, ldb, C, D, X,
+        &lwork );
 
     // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    lapack::vector< float > work( lwork );
 
-    LAPACK_sgglse(
-        &m_, &n_, &p_,
-        A, &lda_,
-        B, &ldb_,
-        C,
-        D,
-        X,
-        &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return gglse(
+        m, n, p, A, lda, B, ldb, C, D, X,
+        &work[0], lwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -76,44 +50,18 @@ int64_t gglse(
     double* D,
     double* X )
 {
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int p_ = to_lapack_int( p );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int ldb_ = to_lapack_int( ldb );
-    lapack_int info_ = 0;
-
     // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgglse(
-        &m_, &n_, &p_,
-        A, &lda_,
-        B, &ldb_,
-        C,
-        D,
-        X,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork;
+    gglse_work_size(
+        m, n, p, A, lda, B, ldb, C, D, X,
+        &lwork );
 
     // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    lapack::vector< double > work( lwork );
 
-    LAPACK_dgglse(
-        &m_, &n_, &p_,
-        A, &lda_,
-        B, &ldb_,
-        C,
-        D,
-        X,
-        &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return gglse(
+        m, n, p, A, lda, B, ldb, C, D, X,
+        &work[0], lwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -126,44 +74,18 @@ int64_t gglse(
     std::complex<float>* D,
     std::complex<float>* X )
 {
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int p_ = to_lapack_int( p );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int ldb_ = to_lapack_int( ldb );
-    lapack_int info_ = 0;
-
     // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cgglse(
-        &m_, &n_, &p_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_,
-        (lapack_complex_float*) C,
-        (lapack_complex_float*) D,
-        (lapack_complex_float*) X,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork;
+    gglse_work_size(
+        m, n, p, A, lda, B, ldb, C, D, X,
+        &lwork );
 
     // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+    lapack::vector< std::complex<float> > work( lwork );
 
-    LAPACK_cgglse(
-        &m_, &n_, &p_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_,
-        (lapack_complex_float*) C,
-        (lapack_complex_float*) D,
-        (lapack_complex_float*) X,
-        (lapack_complex_float*) &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return gglse(
+        m, n, p, A, lda, B, ldb, C, D, X,
+        &work[0], lwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -267,6 +189,169 @@ int64_t gglse(
     std::complex<double>* D,
     std::complex<double>* X )
 {
+    // query for workspace size
+    int64_t lwork;
+    gglse_work_size(
+        m, n, p, A, lda, B, ldb, C, D, X,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+
+    return gglse(
+        m, n, p, A, lda, B, ldb, C, D, X,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup ggls
+void gglse_work_size(
+    int64_t m, int64_t n, int64_t p,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* C,
+    float* D,
+    float* X,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "sgglse", m, n, p, lda, ldb );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int info_ = 0;
+
+    float qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_sgglse(
+        &m_, &n_, &p_,
+        A, &lda_,
+        B, &ldb_,
+        C,
+        D,
+        X,
+        qry_work, &ineg_one, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup ggls
+void gglse_work_size(
+    int64_t m, int64_t n, int64_t p,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* C,
+    double* D,
+    double* X,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "dgglse", m, n, p, lda, ldb );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int info_ = 0;
+
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dgglse(
+        &m_, &n_, &p_,
+        A, &lda_,
+        B, &ldb_,
+        C,
+        D,
+        X,
+        qry_work, &ineg_one, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup ggls
+void gglse_work_size(
+    int64_t m, int64_t n, int64_t p,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* C,
+    std::complex<float>* D,
+    std::complex<float>* X,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "cgglse", m, n, p, lda, ldb );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int info_ = 0;
+
+    std::complex<float> qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_cgglse(
+        &m_, &n_, &p_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) B, &ldb_,
+        (lapack_complex_float*) C,
+        (lapack_complex_float*) D,
+        (lapack_complex_float*) X,
+        (lapack_complex_float*) qry_work, &ineg_one, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::gglse with caller-provided workspace.
+/// Returns the array lengths that the workspace overload of `gglse`
+/// requires, so the workspace can be allocated once, outside a loop.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// Other arguments are the same as for lapack::gglse.
+/// Arrays are used only to select the precision and are not referenced.
+///
+/// @param[out] lwork
+///     The optimal length of the array work.
+///
+/// @ingroup ggls
+void gglse_work_size(
+    int64_t m, int64_t n, int64_t p,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* C,
+    std::complex<double>* D,
+    std::complex<double>* X,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "zgglse", m, n, p, lda, ldb );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int p_ = to_lapack_int( p );
@@ -274,7 +359,6 @@ int64_t gglse(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
 
-    // query for workspace size
     std::complex<double> qry_work[1];
     lapack_int ineg_one = -1;
     LAPACK_zgglse(
@@ -288,10 +372,147 @@ int64_t gglse(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup ggls
+int64_t gglse(
+    int64_t m, int64_t n, int64_t p,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* C,
+    float* D,
+    float* X,
+    float* work, int64_t lwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gglse", float, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+
+    LAPACK_sgglse(
+        &m_, &n_, &p_,
+        A, &lda_,
+        B, &ldb_,
+        C,
+        D,
+        X,
+        work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup ggls
+int64_t gglse(
+    int64_t m, int64_t n, int64_t p,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* C,
+    double* D,
+    double* X,
+    double* work, int64_t lwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gglse", double, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+
+    LAPACK_dgglse(
+        &m_, &n_, &p_,
+        A, &lda_,
+        B, &ldb_,
+        C,
+        D,
+        X,
+        work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup ggls
+int64_t gglse(
+    int64_t m, int64_t n, int64_t p,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* C,
+    std::complex<float>* D,
+    std::complex<float>* X,
+    std::complex<float>* work, int64_t lwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gglse", std::complex<float>, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+
+    LAPACK_cgglse(
+        &m_, &n_, &p_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) B, &ldb_,
+        (lapack_complex_float*) C,
+        (lapack_complex_float*) D,
+        (lapack_complex_float*) X,
+        (lapack_complex_float*) work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::gglse that takes caller-provided workspace
+/// instead of querying and allocating it on each call.
+/// Use lapack::gglse_work_size to get the required lengths.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// Other arguments are the same as for lapack::gglse.
+///
+/// @param[out] work
+///     The vector work of length lwork. Workspace.
+///
+/// @param[in] lwork
+///     The length of the array work.
+///     Use the value from lapack::gglse_work_size for best performance.
+///
+/// @ingroup ggls
+int64_t gglse(
+    int64_t m, int64_t n, int64_t p,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* C,
+    std::complex<double>* D,
+    std::complex<double>* X,
+    std::complex<double>* work, int64_t lwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gglse", std::complex<double>, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
     LAPACK_zgglse(
         &m_, &n_, &p_,
@@ -300,7 +521,7 @@ int64_t gglse(
         (lapack_complex_double*) C,
         (lapack_complex_double*) D,
         (lapack_complex_double*) X,
-        (lapack_complex_double*) &work[0], &lwork_, &info_ );
+        (lapack_complex_double*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -24,6 +24,100 @@ int64_t ggqrf(
     float* B, int64_t ldb,
     float* taub )
 {
+    // query for workspace size
+    int64_t lwork;
+    ggqrf_work_size(
+        n, m, p, A, lda, taua, B, ldb, taub,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return ggqrf(
+        n, m, p, A, lda, taua, B, ldb, taub,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggqrf(
+    int64_t n, int64_t m, int64_t p,
+    double* A, int64_t lda,
+    double* taua,
+    double* B, int64_t ldb,
+    double* taub )
+{
+    // query for workspace size
+    int64_t lwork;
+    ggqrf_work_size(
+        n, m, p, A, lda, taua, B, ldb, taub,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return ggqrf(
+        n, m, p, A, lda, taua, B, ldb, taub,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggqrf(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* taua,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* taub )
+{
+    // query for workspace size
+    int64_t lwork;
+    ggqrf_work_size(
+        n, m, p, A, lda, taua, B, ldb, taub,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+
+    return ggqrf(
+        n, m, p, A, lda, taua, B, ldb, taub,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggqrf(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* taua,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* taub )
+{
+    // query for workspace size
+    int64_t lwork;
+    ggqrf_work_size(
+        n, m, p, A, lda, taua, B, ldb, taub,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+
+    return ggqrf(
+        n, m, p, A, lda, taua, B, ldb, taub,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+void ggqrf_work_size(
+    int64_t n, int64_t m, int64_t p,
+    float* A, int64_t lda,
+    float* taua,
+    float* B, int64_t ldb,
+    float* taub,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "sggqrf", n, m, p, lda, ldb );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int m_ = to_lapack_int( m );
     lapack_int p_ = to_lapack_int( p );
@@ -31,7 +125,6 @@ int64_t ggqrf(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
 
-    // query for workspace size
     float qry_work[1];
     lapack_int ineg_one = -1;
     LAPACK_sggqrf(
@@ -44,32 +137,61 @@ int64_t ggqrf(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+void ggqrf_work_size(
+    int64_t n, int64_t m, int64_t p,
+    double* A, int64_t lda,
+    double* taua,
+    double* B, int64_t ldb,
+    double* taub,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "dggqrf", n, m, p, lda, ldb );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
 
-    LAPACK_sggqrf(
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int info_ = 0;
+
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dggqrf(
         &n_, &m_, &p_,
         A, &lda_,
         taua,
         B, &ldb_,
         taub,
-        &work[0], &lwork_, &info_ );
+        qry_work, &ineg_one, &info_ );
     if (info_ < 0) {
         throw Error();
     }
-    return info_;
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
 }
 
 // -----------------------------------------------------------------------------
-int64_t ggqrf(
+void ggqrf_work_size(
     int64_t n, int64_t m, int64_t p,
-    double* A, int64_t lda,
-    double* taua,
-    double* B, int64_t ldb,
-    double* taub )
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* taua,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* taub,
+    int64_t* lwork )
 {
+    auto key = internal::work_size_key(
+        "cggqrf", n, m, p, lda, ldb );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int m_ = to_lapack_int( m );
     lapack_int p_ = to_lapack_int( p );
@@ -77,23 +199,107 @@ int64_t ggqrf(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
+    std::complex<float> qry_work[1];
     lapack_int ineg_one = -1;
-    LAPACK_dggqrf(
+    LAPACK_cggqrf(
+        &n_, &m_, &p_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) taua,
+        (lapack_complex_float*) B, &ldb_,
+        (lapack_complex_float*) taub,
+        (lapack_complex_float*) qry_work, &ineg_one, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+void ggqrf_work_size(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* taua,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* taub,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "zggqrf", n, m, p, lda, ldb );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int info_ = 0;
+
+    std::complex<double> qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_zggqrf(
+        &n_, &m_, &p_,
+        (lapack_complex_double*) A, &lda_,
+        (lapack_complex_double*) taua,
+        (lapack_complex_double*) B, &ldb_,
+        (lapack_complex_double*) taub,
+        (lapack_complex_double*) qry_work, &ineg_one, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggqrf(
+    int64_t n, int64_t m, int64_t p,
+    float* A, int64_t lda,
+    float* taua,
+    float* B, int64_t ldb,
+    float* taub,
+    float* work, int64_t lwork )
+{
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ggqrf", float, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+
+    LAPACK_sggqrf(
         &n_, &m_, &p_,
         A, &lda_,
         taua,
         B, &ldb_,
         taub,
-        qry_work, &ineg_one, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+int64_t ggqrf(
+    int64_t n, int64_t m, int64_t p,
+    double* A, int64_t lda,
+    double* taua,
+    double* B, int64_t ldb,
+    double* taub,
+    double* work, int64_t lwork )
+{
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ggqrf", double, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
     LAPACK_dggqrf(
         &n_, &m_, &p_,
@@ -101,7 +307,7 @@ int64_t ggqrf(
         taua,
         B, &ldb_,
         taub,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -114,7 +320,8 @@ int64_t ggqrf(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* taua,
     std::complex<float>* B, int64_t ldb,
-    std::complex<float>* taub )
+    std::complex<float>* taub,
+    std::complex<float>* work, int64_t lwork )
 {
     lapack_int n_ = to_lapack_int( n );
     lapack_int m_ = to_lapack_int( m );
@@ -122,32 +329,16 @@ int64_t ggqrf(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ggqrf", std::complex<float>, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
     LAPACK_cggqrf(
         &n_, &m_, &p_,
         (lapack_complex_float*) A, &lda_,
         (lapack_complex_float*) taua,
         (lapack_complex_float*) B, &ldb_,
         (lapack_complex_float*) taub,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-
-    LAPACK_cggqrf(
-        &n_, &m_, &p_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) taua,
-        (lapack_complex_float*) B, &ldb_,
-        (lapack_complex_float*) taub,
-        (lapack_complex_float*) &work[0], &lwork_, &info_ );
+        (lapack_complex_float*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -160,7 +351,8 @@ int64_t ggqrf(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* taua,
     std::complex<double>* B, int64_t ldb,
-    std::complex<double>* taub )
+    std::complex<double>* taub,
+    std::complex<double>* work, int64_t lwork )
 {
     lapack_int n_ = to_lapack_int( n );
     lapack_int m_ = to_lapack_int( m );
@@ -168,24 +360,8 @@ int64_t ggqrf(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
-
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zggqrf(
-        &n_, &m_, &p_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) taua,
-        (lapack_complex_double*) B, &ldb_,
-        (lapack_complex_double*) taub,
-        (lapack_complex_double*) qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+    LAPACK_TRACE_BLOCK( "ggqrf", std::complex<double>, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
     LAPACK_zggqrf(
         &n_, &m_, &p_,
@@ -193,7 +369,7 @@ int64_t ggqrf(
         (lapack_complex_double*) taua,
         (lapack_complex_double*) B, &ldb_,
         (lapack_complex_double*) taub,
-        (lapack_complex_double*) &work[0], &lwork_, &info_ );
+        (lapack_complex_double*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
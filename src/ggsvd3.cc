@@ -31,6 +31,134 @@ int64_t ggsvd3(
     float* V, int64_t ldv,
     float* Q, int64_t ldq )
 {
+    // query for workspace size
+    int64_t lwork, liwork;
+    ggsvd3_work_size(
+        jobu, jobv, jobq, m, n, p, k, l, A, lda, B, ldb, alpha, beta, U, ldu, V,
+        ldv, Q, ldq,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+    lapack::vector< int64_t > iwork( liwork );
+
+    return ggsvd3(
+        jobu, jobv, jobq, m, n, p, k, l, A, lda, B, ldb, alpha, beta, U, ldu, V,
+        ldv, Q, ldq,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggsvd3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* alpha,
+    double* beta,
+    double* U, int64_t ldu,
+    double* V, int64_t ldv,
+    double* Q, int64_t ldq )
+{
+    // query for workspace size
+    int64_t lwork, liwork;
+    ggsvd3_work_size(
+        jobu, jobv, jobq, m, n, p, k, l, A, lda, B, ldb, alpha, beta, U, ldu, V,
+        ldv, Q, ldq,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+    lapack::vector< int64_t > iwork( liwork );
+
+    return ggsvd3(
+        jobu, jobv, jobq, m, n, p, k, l, A, lda, B, ldb, alpha, beta, U, ldu, V,
+        ldv, Q, ldq,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggsvd3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* alpha,
+    float* beta,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* V, int64_t ldv,
+    std::complex<float>* Q, int64_t ldq )
+{
+    // query for workspace size
+    int64_t lwork, lrwork, liwork;
+    ggsvd3_work_size(
+        jobu, jobv, jobq, m, n, p, k, l, A, lda, B, ldb, alpha, beta, U, ldu, V,
+        ldv, Q, ldq,
+        &lwork, &lrwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+    lapack::vector< int64_t > iwork( liwork );
+
+    return ggsvd3(
+        jobu, jobv, jobq, m, n, p, k, l, A, lda, B, ldb, alpha, beta, U, ldu, V,
+        ldv, Q, ldq,
+        &work[0], lwork, &rwork[0], lrwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggsvd3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* alpha,
+    double* beta,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* V, int64_t ldv,
+    std::complex<double>* Q, int64_t ldq )
+{
+    // query for workspace size
+    int64_t lwork, lrwork, liwork;
+    ggsvd3_work_size(
+        jobu, jobv, jobq, m, n, p, k, l, A, lda, B, ldb, alpha, beta, U, ldu, V,
+        ldv, Q, ldq,
+        &lwork, &lrwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+    lapack::vector< int64_t > iwork( liwork );
+
+    return ggsvd3(
+        jobu, jobv, jobq, m, n, p, k, l, A, lda, B, ldb, alpha, beta, U, ldu, V,
+        ldv, Q, ldq,
+        &work[0], lwork, &rwork[0], lrwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+void ggsvd3_work_size(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* alpha,
+    float* beta,
+    float* U, int64_t ldu,
+    float* V, int64_t ldv,
+    float* Q, int64_t ldq,
+    int64_t* lwork, int64_t* liwork )
+{
+    auto key = internal::work_size_key(
+        "sggsvd3", jobu, jobv, jobq, m, n, p, lda, ldb, ldu, ldv, ldq );
+    if (internal::work_size_cache_find( key, lwork, liwork ))
+        return;
+
     char jobu_ = to_char_jobu( jobu );
     char jobv_ = to_char( jobv );
     char jobq_ = to_char_jobq( jobq );
@@ -46,7 +174,6 @@ int64_t ggsvd3(
     lapack_int ldq_ = to_lapack_int( ldq );
     lapack_int info_ = 0;
 
-    // query for workspace size
     float qry_work[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
@@ -65,34 +192,13 @@ int64_t ggsvd3(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (n) );
-
-    LAPACK_sggsvd3(
-        &jobu_, &jobv_, &jobq_, &m_, &n_, &p_, &k_, &l_,
-        A, &lda_,
-        B, &ldb_,
-        alpha,
-        beta,
-        U, &ldu_,
-        V, &ldv_,
-        Q, &ldq_,
-        &work[0], &lwork_,
-        &iwork[0], &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *k = k_;
-    *l = l_;
-    return info_;
+    *lwork = real(qry_work[0]);
+    *liwork = n;
+    internal::work_size_cache_insert( key, *lwork, *liwork );
 }
 
 // -----------------------------------------------------------------------------
-int64_t ggsvd3(
+void ggsvd3_work_size(
     lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
     int64_t* k,
     int64_t* l,
@@ -102,8 +208,14 @@ int64_t ggsvd3(
     double* beta,
     double* U, int64_t ldu,
     double* V, int64_t ldv,
-    double* Q, int64_t ldq )
+    double* Q, int64_t ldq,
+    int64_t* lwork, int64_t* liwork )
 {
+    auto key = internal::work_size_key(
+        "dggsvd3", jobu, jobv, jobq, m, n, p, lda, ldb, ldu, ldv, ldq );
+    if (internal::work_size_cache_find( key, lwork, liwork ))
+        return;
+
     char jobu_ = to_char_jobu( jobu );
     char jobv_ = to_char( jobv );
     char jobq_ = to_char_jobq( jobq );
@@ -119,7 +231,6 @@ int64_t ggsvd3(
     lapack_int ldq_ = to_lapack_int( ldq );
     lapack_int info_ = 0;
 
-    // query for workspace size
     double qry_work[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
@@ -138,34 +249,13 @@ int64_t ggsvd3(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (n) );
-
-    LAPACK_dggsvd3(
-        &jobu_, &jobv_, &jobq_, &m_, &n_, &p_, &k_, &l_,
-        A, &lda_,
-        B, &ldb_,
-        alpha,
-        beta,
-        U, &ldu_,
-        V, &ldv_,
-        Q, &ldq_,
-        &work[0], &lwork_,
-        &iwork[0], &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *k = k_;
-    *l = l_;
-    return info_;
+    *lwork = real(qry_work[0]);
+    *liwork = n;
+    internal::work_size_cache_insert( key, *lwork, *liwork );
 }
 
 // -----------------------------------------------------------------------------
-int64_t ggsvd3(
+void ggsvd3_work_size(
     lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
     int64_t* k,
     int64_t* l,
@@ -175,8 +265,14 @@ int64_t ggsvd3(
     float* beta,
     std::complex<float>* U, int64_t ldu,
     std::complex<float>* V, int64_t ldv,
-    std::complex<float>* Q, int64_t ldq )
+    std::complex<float>* Q, int64_t ldq,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
 {
+    auto key = internal::work_size_key(
+        "cggsvd3", jobu, jobv, jobq, m, n, p, lda, ldb, ldu, ldv, ldq );
+    if (internal::work_size_cache_find( key, lwork, lrwork, liwork ))
+        return;
+
     char jobu_ = to_char_jobu( jobu );
     char jobv_ = to_char( jobv );
     char jobq_ = to_char_jobq( jobq );
@@ -192,7 +288,6 @@ int64_t ggsvd3(
     lapack_int ldq_ = to_lapack_int( ldq );
     lapack_int info_ = 0;
 
-    // query for workspace size
     std::complex<float> qry_work[1];
     float qry_rwork[1];
     lapack_int qry_iwork[1];
@@ -213,36 +308,14 @@ int64_t ggsvd3(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (2*n) );
-    lapack::vector< lapack_int > iwork( (n) );
-
-    LAPACK_cggsvd3(
-        &jobu_, &jobv_, &jobq_, &m_, &n_, &p_, &k_, &l_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_,
-        alpha,
-        beta,
-        (lapack_complex_float*) U, &ldu_,
-        (lapack_complex_float*) V, &ldv_,
-        (lapack_complex_float*) Q, &ldq_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0],
-        &iwork[0], &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *k = k_;
-    *l = l_;
-    return info_;
+    *lwork = real(qry_work[0]);
+    *lrwork = 2*n;
+    *liwork = n;
+    internal::work_size_cache_insert( key, *lwork, *lrwork, *liwork );
 }
 
 // -----------------------------------------------------------------------------
-int64_t ggsvd3(
+void ggsvd3_work_size(
     lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
     int64_t* k,
     int64_t* l,
@@ -252,8 +325,14 @@ int64_t ggsvd3(
     double* beta,
     std::complex<double>* U, int64_t ldu,
     std::complex<double>* V, int64_t ldv,
-    std::complex<double>* Q, int64_t ldq )
+    std::complex<double>* Q, int64_t ldq,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
 {
+    auto key = internal::work_size_key(
+        "zggsvd3", jobu, jobv, jobq, m, n, p, lda, ldb, ldu, ldv, ldq );
+    if (internal::work_size_cache_find( key, lwork, lrwork, liwork ))
+        return;
+
     char jobu_ = to_char_jobu( jobu );
     char jobv_ = to_char( jobv );
     char jobq_ = to_char_jobq( jobq );
@@ -269,7 +348,6 @@ int64_t ggsvd3(
     lapack_int ldq_ = to_lapack_int( ldq );
     lapack_int info_ = 0;
 
-    // query for workspace size
     std::complex<double> qry_work[1];
     double qry_rwork[1];
     lapack_int qry_iwork[1];
@@ -290,12 +368,216 @@ int64_t ggsvd3(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    *lrwork = 2*n;
+    *liwork = n;
+    internal::work_size_cache_insert( key, *lwork, *lrwork, *liwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (2*n) );
-    lapack::vector< lapack_int > iwork( (n) );
+// -----------------------------------------------------------------------------
+int64_t ggsvd3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* alpha,
+    float* beta,
+    float* U, int64_t ldu,
+    float* V, int64_t ldv,
+    float* Q, int64_t ldq,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    char jobu_ = to_char_jobu( jobu );
+    char jobv_ = to_char( jobv );
+    char jobq_ = to_char_jobq( jobq );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int k_ = 0;  // out
+    lapack_int l_ = 0;  // out
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int ldu_ = to_lapack_int( ldu );
+    lapack_int ldv_ = to_lapack_int( ldv );
+    lapack_int ldq_ = to_lapack_int( ldq );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ggsvd3", float, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( liwork < n );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
+
+    LAPACK_sggsvd3(
+        &jobu_, &jobv_, &jobq_, &m_, &n_, &p_, &k_, &l_,
+        A, &lda_,
+        B, &ldb_,
+        alpha,
+        beta,
+        U, &ldu_,
+        V, &ldv_,
+        Q, &ldq_,
+        work, &lwork_,
+        iwork_, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *k = k_;
+    *l = l_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggsvd3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* alpha,
+    double* beta,
+    double* U, int64_t ldu,
+    double* V, int64_t ldv,
+    double* Q, int64_t ldq,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    char jobu_ = to_char_jobu( jobu );
+    char jobv_ = to_char( jobv );
+    char jobq_ = to_char_jobq( jobq );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int k_ = 0;  // out
+    lapack_int l_ = 0;  // out
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int ldu_ = to_lapack_int( ldu );
+    lapack_int ldv_ = to_lapack_int( ldv );
+    lapack_int ldq_ = to_lapack_int( ldq );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ggsvd3", double, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( liwork < n );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
+
+    LAPACK_dggsvd3(
+        &jobu_, &jobv_, &jobq_, &m_, &n_, &p_, &k_, &l_,
+        A, &lda_,
+        B, &ldb_,
+        alpha,
+        beta,
+        U, &ldu_,
+        V, &ldv_,
+        Q, &ldq_,
+        work, &lwork_,
+        iwork_, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *k = k_;
+    *l = l_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggsvd3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* alpha,
+    float* beta,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* V, int64_t ldv,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork )
+{
+    char jobu_ = to_char_jobu( jobu );
+    char jobv_ = to_char( jobv );
+    char jobq_ = to_char_jobq( jobq );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int k_ = 0;  // out
+    lapack_int l_ = 0;  // out
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int ldu_ = to_lapack_int( ldu );
+    lapack_int ldv_ = to_lapack_int( ldv );
+    lapack_int ldq_ = to_lapack_int( ldq );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ggsvd3", std::complex<float>, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( lrwork < 2*n );
+    lapack_error_if( liwork < n );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
+
+    LAPACK_cggsvd3(
+        &jobu_, &jobv_, &jobq_, &m_, &n_, &p_, &k_, &l_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) B, &ldb_,
+        alpha,
+        beta,
+        (lapack_complex_float*) U, &ldu_,
+        (lapack_complex_float*) V, &ldv_,
+        (lapack_complex_float*) Q, &ldq_,
+        (lapack_complex_float*) work, &lwork_,
+        rwork,
+        iwork_, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *k = k_;
+    *l = l_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggsvd3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* alpha,
+    double* beta,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* V, int64_t ldv,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork )
+{
+    char jobu_ = to_char_jobu( jobu );
+    char jobv_ = to_char( jobv );
+    char jobq_ = to_char_jobq( jobq );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int k_ = 0;  // out
+    lapack_int l_ = 0;  // out
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int ldu_ = to_lapack_int( ldu );
+    lapack_int ldv_ = to_lapack_int( ldv );
+    lapack_int ldq_ = to_lapack_int( ldq );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ggsvd3", std::complex<double>, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( lrwork < 2*n );
+    lapack_error_if( liwork < n );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
 
     LAPACK_zggsvd3(
         &jobu_, &jobv_, &jobq_, &m_, &n_, &p_, &k_, &l_,
@@ -306,9 +588,9 @@ int64_t ggsvd3(
         (lapack_complex_double*) U, &ldu_,
         (lapack_complex_double*) V, &ldv_,
         (lapack_complex_double*) Q, &ldq_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0],
-        &iwork[0], &info_
+        (lapack_complex_double*) work, &lwork_,
+        rwork,
+        iwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
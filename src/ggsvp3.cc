@@ -30,6 +30,130 @@ int64_t ggsvp3(
     float* Q, int64_t ldq,
     float* tau )
 {
+    // query for workspace size
+    int64_t liwork, lwork;
+    ggsvp3_work_size(
+        jobu, jobv, jobq, m, p, n, A, lda, B, ldb, tola, tolb, k, l, U, ldu, V,
+        ldv, Q, ldq, tau,
+        &liwork, &lwork );
+
+    // allocate workspace
+    lapack::vector< int64_t > iwork( liwork );
+    lapack::vector< float > work( lwork );
+
+    return ggsvp3(
+        jobu, jobv, jobq, m, p, n, A, lda, B, ldb, tola, tolb, k, l, U, ldu, V,
+        ldv, Q, ldq, tau,
+        &iwork[0], liwork, &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggsvp3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb, double tola, double tolb,
+    int64_t* k,
+    int64_t* l,
+    double* U, int64_t ldu,
+    double* V, int64_t ldv,
+    double* Q, int64_t ldq,
+    double* tau )
+{
+    // query for workspace size
+    int64_t liwork, lwork;
+    ggsvp3_work_size(
+        jobu, jobv, jobq, m, p, n, A, lda, B, ldb, tola, tolb, k, l, U, ldu, V,
+        ldv, Q, ldq, tau,
+        &liwork, &lwork );
+
+    // allocate workspace
+    lapack::vector< int64_t > iwork( liwork );
+    lapack::vector< double > work( lwork );
+
+    return ggsvp3(
+        jobu, jobv, jobq, m, p, n, A, lda, B, ldb, tola, tolb, k, l, U, ldu, V,
+        ldv, Q, ldq, tau,
+        &iwork[0], liwork, &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggsvp3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb, float tola, float tolb,
+    int64_t* k,
+    int64_t* l,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* V, int64_t ldv,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* tau )
+{
+    // query for workspace size
+    int64_t liwork, lrwork, lwork;
+    ggsvp3_work_size(
+        jobu, jobv, jobq, m, p, n, A, lda, B, ldb, tola, tolb, k, l, U, ldu, V,
+        ldv, Q, ldq, tau,
+        &liwork, &lrwork, &lwork );
+
+    // allocate workspace
+    lapack::vector< int64_t > iwork( liwork );
+    lapack::vector< float > rwork( lrwork );
+    lapack::vector< std::complex<float> > work( lwork );
+
+    return ggsvp3(
+        jobu, jobv, jobq, m, p, n, A, lda, B, ldb, tola, tolb, k, l, U, ldu, V,
+        ldv, Q, ldq, tau,
+        &iwork[0], liwork, &rwork[0], lrwork, &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggsvp3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb, double tola, double tolb,
+    int64_t* k,
+    int64_t* l,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* V, int64_t ldv,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* tau )
+{
+    // query for workspace size
+    int64_t liwork, lrwork, lwork;
+    ggsvp3_work_size(
+        jobu, jobv, jobq, m, p, n, A, lda, B, ldb, tola, tolb, k, l, U, ldu, V,
+        ldv, Q, ldq, tau,
+        &liwork, &lrwork, &lwork );
+
+    // allocate workspace
+    lapack::vector< int64_t > iwork( liwork );
+    lapack::vector< double > rwork( lrwork );
+    lapack::vector< std::complex<double> > work( lwork );
+
+    return ggsvp3(
+        jobu, jobv, jobq, m, p, n, A, lda, B, ldb, tola, tolb, k, l, U, ldu, V,
+        ldv, Q, ldq, tau,
+        &iwork[0], liwork, &rwork[0], lrwork, &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+void ggsvp3_work_size(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb, float tola, float tolb,
+    int64_t* k,
+    int64_t* l,
+    float* U, int64_t ldu,
+    float* V, int64_t ldv,
+    float* Q, int64_t ldq,
+    float* tau,
+    int64_t* liwork, int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "sggsvp3", jobu, jobv, jobq, m, p, n, lda, ldb, ldu, ldv, ldq );
+    if (internal::work_size_cache_find( key, liwork, lwork ))
+        return;
+
     char jobu_ = to_char_jobu( jobu );
     char jobv_ = to_char( jobv );
     char jobq_ = to_char_jobq( jobq );
@@ -45,7 +169,6 @@ int64_t ggsvp3(
     lapack_int ldq_ = to_lapack_int( ldq );
     lapack_int info_ = 0;
 
-    // query for workspace size
     lapack_int qry_iwork[1];
     float qry_work[1];
     lapack_int ineg_one = -1;
@@ -63,33 +186,13 @@ int64_t ggsvp3(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< lapack_int > iwork( (n) );
-    lapack::vector< float > work( lwork_ );
-
-    LAPACK_sggsvp3(
-        &jobu_, &jobv_, &jobq_, &m_, &p_, &n_,
-        A, &lda_,
-        B, &ldb_, &tola, &tolb, &k_, &l_,
-        U, &ldu_,
-        V, &ldv_,
-        Q, &ldq_,
-        &iwork[0],
-        tau,
-        &work[0], &lwork_, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *k = k_;
-    *l = l_;
-    return info_;
+    *lwork = real(qry_work[0]);
+    *liwork = n;
+    internal::work_size_cache_insert( key, *liwork, *lwork );
 }
 
 // -----------------------------------------------------------------------------
-int64_t ggsvp3(
+void ggsvp3_work_size(
     lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
     double* A, int64_t lda,
     double* B, int64_t ldb, double tola, double tolb,
@@ -98,8 +201,14 @@ int64_t ggsvp3(
     double* U, int64_t ldu,
     double* V, int64_t ldv,
     double* Q, int64_t ldq,
-    double* tau )
+    double* tau,
+    int64_t* liwork, int64_t* lwork )
 {
+    auto key = internal::work_size_key(
+        "dggsvp3", jobu, jobv, jobq, m, p, n, lda, ldb, ldu, ldv, ldq );
+    if (internal::work_size_cache_find( key, liwork, lwork ))
+        return;
+
     char jobu_ = to_char_jobu( jobu );
     char jobv_ = to_char( jobv );
     char jobq_ = to_char_jobq( jobq );
@@ -115,7 +224,6 @@ int64_t ggsvp3(
     lapack_int ldq_ = to_lapack_int( ldq );
     lapack_int info_ = 0;
 
-    // query for workspace size
     lapack_int qry_iwork[1];
     double qry_work[1];
     lapack_int ineg_one = -1;
@@ -133,33 +241,13 @@ int64_t ggsvp3(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< lapack_int > iwork( (n) );
-    lapack::vector< double > work( lwork_ );
-
-    LAPACK_dggsvp3(
-        &jobu_, &jobv_, &jobq_, &m_, &p_, &n_,
-        A, &lda_,
-        B, &ldb_, &tola, &tolb, &k_, &l_,
-        U, &ldu_,
-        V, &ldv_,
-        Q, &ldq_,
-        &iwork[0],
-        tau,
-        &work[0], &lwork_, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *k = k_;
-    *l = l_;
-    return info_;
+    *lwork = real(qry_work[0]);
+    *liwork = n;
+    internal::work_size_cache_insert( key, *liwork, *lwork );
 }
 
 // -----------------------------------------------------------------------------
-int64_t ggsvp3(
+void ggsvp3_work_size(
     lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb, float tola, float tolb,
@@ -168,8 +256,14 @@ int64_t ggsvp3(
     std::complex<float>* U, int64_t ldu,
     std::complex<float>* V, int64_t ldv,
     std::complex<float>* Q, int64_t ldq,
-    std::complex<float>* tau )
+    std::complex<float>* tau,
+    int64_t* liwork, int64_t* lrwork, int64_t* lwork )
 {
+    auto key = internal::work_size_key(
+        "cggsvp3", jobu, jobv, jobq, m, p, n, lda, ldb, ldu, ldv, ldq );
+    if (internal::work_size_cache_find( key, liwork, lrwork, lwork ))
+        return;
+
     char jobu_ = to_char_jobu( jobu );
     char jobv_ = to_char( jobv );
     char jobq_ = to_char_jobq( jobq );
@@ -185,7 +279,6 @@ int64_t ggsvp3(
     lapack_int ldq_ = to_lapack_int( ldq );
     lapack_int info_ = 0;
 
-    // query for workspace size
     lapack_int qry_iwork[1];
     float qry_rwork[1];
     std::complex<float> qry_work[1];
@@ -205,35 +298,14 @@ int64_t ggsvp3(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< lapack_int > iwork( (n) );
-    lapack::vector< float > rwork( (2*n) );
-    lapack::vector< std::complex<float> > work( lwork_ );
-
-    LAPACK_cggsvp3(
-        &jobu_, &jobv_, &jobq_, &m_, &p_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_, &tola, &tolb, &k_, &l_,
-        (lapack_complex_float*) U, &ldu_,
-        (lapack_complex_float*) V, &ldv_,
-        (lapack_complex_float*) Q, &ldq_,
-        &iwork[0],
-        &rwork[0],
-        (lapack_complex_float*) tau,
-        (lapack_complex_float*) &work[0], &lwork_, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *k = k_;
-    *l = l_;
-    return info_;
+    *lwork = real(qry_work[0]);
+    *liwork = n;
+    *lrwork = 2*n;
+    internal::work_size_cache_insert( key, *liwork, *lrwork, *lwork );
 }
 
 // -----------------------------------------------------------------------------
-int64_t ggsvp3(
+void ggsvp3_work_size(
     lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
     std::complex<double>* A, int64_t lda,
     std::complex<double>* B, int64_t ldb, double tola, double tolb,
@@ -242,8 +314,14 @@ int64_t ggsvp3(
     std::complex<double>* U, int64_t ldu,
     std::complex<double>* V, int64_t ldv,
     std::complex<double>* Q, int64_t ldq,
-    std::complex<double>* tau )
+    std::complex<double>* tau,
+    int64_t* liwork, int64_t* lrwork, int64_t* lwork )
 {
+    auto key = internal::work_size_key(
+        "zggsvp3", jobu, jobv, jobq, m, p, n, lda, ldb, ldu, ldv, ldq );
+    if (internal::work_size_cache_find( key, liwork, lrwork, lwork ))
+        return;
+
     char jobu_ = to_char_jobu( jobu );
     char jobv_ = to_char( jobv );
     char jobq_ = to_char_jobq( jobq );
@@ -259,7 +337,6 @@ int64_t ggsvp3(
     lapack_int ldq_ = to_lapack_int( ldq );
     lapack_int info_ = 0;
 
-    // query for workspace size
     lapack_int qry_iwork[1];
     double qry_rwork[1];
     std::complex<double> qry_work[1];
@@ -279,12 +356,209 @@ int64_t ggsvp3(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    *liwork = n;
+    *lrwork = 2*n;
+    internal::work_size_cache_insert( key, *liwork, *lrwork, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< lapack_int > iwork( (n) );
-    lapack::vector< double > rwork( (2*n) );
-    lapack::vector< std::complex<double> > work( lwork_ );
+// -----------------------------------------------------------------------------
+int64_t ggsvp3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb, float tola, float tolb,
+    int64_t* k,
+    int64_t* l,
+    float* U, int64_t ldu,
+    float* V, int64_t ldv,
+    float* Q, int64_t ldq,
+    float* tau,
+    int64_t* iwork, int64_t liwork,
+    float* work, int64_t lwork )
+{
+    char jobu_ = to_char_jobu( jobu );
+    char jobv_ = to_char( jobv );
+    char jobq_ = to_char_jobq( jobq );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int k_ = 0;  // out
+    lapack_int l_ = 0;  // out
+    lapack_int ldu_ = to_lapack_int( ldu );
+    lapack_int ldv_ = to_lapack_int( ldv );
+    lapack_int ldq_ = to_lapack_int( ldq );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ggsvp3", float, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( liwork < n );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
+
+    LAPACK_sggsvp3(
+        &jobu_, &jobv_, &jobq_, &m_, &p_, &n_,
+        A, &lda_,
+        B, &ldb_, &tola, &tolb, &k_, &l_,
+        U, &ldu_,
+        V, &ldv_,
+        Q, &ldq_,
+        iwork_,
+        tau,
+        work, &lwork_, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *k = k_;
+    *l = l_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggsvp3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb, double tola, double tolb,
+    int64_t* k,
+    int64_t* l,
+    double* U, int64_t ldu,
+    double* V, int64_t ldv,
+    double* Q, int64_t ldq,
+    double* tau,
+    int64_t* iwork, int64_t liwork,
+    double* work, int64_t lwork )
+{
+    char jobu_ = to_char_jobu( jobu );
+    char jobv_ = to_char( jobv );
+    char jobq_ = to_char_jobq( jobq );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int k_ = 0;  // out
+    lapack_int l_ = 0;  // out
+    lapack_int ldu_ = to_lapack_int( ldu );
+    lapack_int ldv_ = to_lapack_int( ldv );
+    lapack_int ldq_ = to_lapack_int( ldq );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ggsvp3", double, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( liwork < n );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
+
+    LAPACK_dggsvp3(
+        &jobu_, &jobv_, &jobq_, &m_, &p_, &n_,
+        A, &lda_,
+        B, &ldb_, &tola, &tolb, &k_, &l_,
+        U, &ldu_,
+        V, &ldv_,
+        Q, &ldq_,
+        iwork_,
+        tau,
+        work, &lwork_, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *k = k_;
+    *l = l_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggsvp3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb, float tola, float tolb,
+    int64_t* k,
+    int64_t* l,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* V, int64_t ldv,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* tau,
+    int64_t* iwork, int64_t liwork,
+    float* rwork, int64_t lrwork,
+    std::complex<float>* work, int64_t lwork )
+{
+    char jobu_ = to_char_jobu( jobu );
+    char jobv_ = to_char( jobv );
+    char jobq_ = to_char_jobq( jobq );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int k_ = 0;  // out
+    lapack_int l_ = 0;  // out
+    lapack_int ldu_ = to_lapack_int( ldu );
+    lapack_int ldv_ = to_lapack_int( ldv );
+    lapack_int ldq_ = to_lapack_int( ldq );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ggsvp3", std::complex<float>, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( liwork < n );
+    lapack_error_if( lrwork < 2*n );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
+
+    LAPACK_cggsvp3(
+        &jobu_, &jobv_, &jobq_, &m_, &p_, &n_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) B, &ldb_, &tola, &tolb, &k_, &l_,
+        (lapack_complex_float*) U, &ldu_,
+        (lapack_complex_float*) V, &ldv_,
+        (lapack_complex_float*) Q, &ldq_,
+        iwork_,
+        rwork,
+        (lapack_complex_float*) tau,
+        (lapack_complex_float*) work, &lwork_, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *k = k_;
+    *l = l_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggsvp3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb, double tola, double tolb,
+    int64_t* k,
+    int64_t* l,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* V, int64_t ldv,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* tau,
+    int64_t* iwork, int64_t liwork,
+    double* rwork, int64_t lrwork,
+    std::complex<double>* work, int64_t lwork )
+{
+    char jobu_ = to_char_jobu( jobu );
+    char jobv_ = to_char( jobv );
+    char jobq_ = to_char_jobq( jobq );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int k_ = 0;  // out
+    lapack_int l_ = 0;  // out
+    lapack_int ldu_ = to_lapack_int( ldu );
+    lapack_int ldv_ = to_lapack_int( ldv );
+    lapack_int ldq_ = to_lapack_int( ldq );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ggsvp3", std::complex<double>, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( liwork < n );
+    lapack_error_if( lrwork < 2*n );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
 
     LAPACK_zggsvp3(
         &jobu_, &jobv_, &jobq_, &m_, &p_, &n_,
@@ -293,10 +567,10 @@ int64_t ggsvp3(
         (lapack_complex_double*) U, &ldu_,
         (lapack_complex_double*) V, &ldv_,
         (lapack_complex_double*) Q, &ldq_,
-        &iwork[0],
-        &rwork[0],
+        iwork_,
+        rwork,
         (lapack_complex_double*) tau,
-        (lapack_complex_double*) &work[0], &lwork_, &info_
+        (lapack_complex_double*) work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -37,6 +37,7 @@ int64_t gtcon(
         lapack_int const* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gtcon", float, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (2*n) );
@@ -79,6 +80,7 @@ int64_t gtcon(
         lapack_int const* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gtcon", double, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (2*n) );
@@ -121,6 +123,7 @@ int64_t gtcon(
         lapack_int const* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gtcon", std::complex<float>, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
@@ -217,6 +220,7 @@ int64_t gtcon(
         lapack_int const* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gtcon", std::complex<double>, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
@@ -46,6 +46,7 @@ int64_t gtrfs(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int ldx_ = to_lapack_int( ldx );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gtrfs", float, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (3*n) );
@@ -104,6 +105,7 @@ int64_t gtrfs(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int ldx_ = to_lapack_int( ldx );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gtrfs", double, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (3*n) );
@@ -162,6 +164,7 @@ int64_t gtrfs(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int ldx_ = to_lapack_int( ldx );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gtrfs", std::complex<float>, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
@@ -311,6 +314,7 @@ int64_t gtrfs(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int ldx_ = to_lapack_int( ldx );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gtrfs", std::complex<double>, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
@@ -28,6 +28,7 @@ int64_t gtsv(
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gtsv", float, 0, n, 0, nrhs, info_ );
 
     LAPACK_sgtsv(
         &n_, &nrhs_,
@@ -54,6 +55,7 @@ int64_t gtsv(
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gtsv", double, 0, n, 0, nrhs, info_ );
 
     LAPACK_dgtsv(
         &n_, &nrhs_,
@@ -80,6 +82,7 @@ int64_t gtsv(
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gtsv", std::complex<float>, 0, n, 0, nrhs, info_ );
 
     LAPACK_cgtsv(
         &n_, &nrhs_,
@@ -157,6 +160,7 @@ int64_t gtsv(
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gtsv", std::complex<double>, 0, n, 0, nrhs, info_ );
 
     LAPACK_zgtsv(
         &n_, &nrhs_,
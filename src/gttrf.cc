@@ -28,13 +28,13 @@ int64_t gttrf(
 {
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( (n) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+        // 32-bit pivots in first half of ipiv; widened below
+        lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gttrf", float, 0, n, 0, 0, info_ );
 
     LAPACK_sgttrf(
         &n_,
@@ -47,7 +47,7 @@ int64_t gttrf(
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        widen_pivots( ipiv, n );
     #endif
     return info_;
 }
@@ -64,13 +64,13 @@ int64_t gttrf(
 {
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( (n) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+        // 32-bit pivots in first half of ipiv; widened below
+        lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gttrf", double, 0, n, 0, 0, info_ );
 
     LAPACK_dgttrf(
         &n_,
@@ -83,7 +83,7 @@ int64_t gttrf(
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        widen_pivots( ipiv, n );
     #endif
     return info_;
 }
@@ -100,13 +100,13 @@ int64_t gttrf(
 {
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( (n) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+        // 32-bit pivots in first half of ipiv; widened below
+        lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gttrf", std::complex<float>, 0, n, 0, 0, info_ );
 
     LAPACK_cgttrf(
         &n_,
@@ -119,7 +119,7 @@ int64_t gttrf(
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        widen_pivots( ipiv, n );
     #endif
     return info_;
 }
@@ -192,13 +192,13 @@ int64_t gttrf(
 {
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( (n) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+        // 32-bit pivots in first half of ipiv; widened below
+        lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gttrf", std::complex<double>, 0, n, 0, 0, info_ );
 
     LAPACK_zgttrf(
         &n_,
@@ -211,7 +211,7 @@ int64_t gttrf(
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        widen_pivots( ipiv, n );
     #endif
     return info_;
 }
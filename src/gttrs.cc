@@ -39,6 +39,7 @@ int64_t gttrs(
     #endif
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gttrs", float, 0, n, 0, nrhs, info_ );
 
     LAPACK_sgttrs(
         &trans_, &n_, &nrhs_,
@@ -78,6 +79,7 @@ int64_t gttrs(
     #endif
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gttrs", double, 0, n, 0, nrhs, info_ );
 
     LAPACK_dgttrs(
         &trans_, &n_, &nrhs_,
@@ -117,6 +119,7 @@ int64_t gttrs(
     #endif
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gttrs", std::complex<float>, 0, n, 0, nrhs, info_ );
 
     LAPACK_cgttrs(
         &trans_, &n_, &nrhs_,
@@ -221,6 +224,7 @@ int64_t gttrs(
     #endif
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "gttrs", std::complex<double>, 0, n, 0, nrhs, info_ );
 
     LAPACK_zgttrs(
         &trans_, &n_, &nrhs_,
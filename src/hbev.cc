@@ -30,6 +30,7 @@ int64_t hbev(
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hbev", std::complex<float>, 0, n, kd, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<float> > work( (n) );
@@ -63,6 +64,7 @@ int64_t hbev(
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hbev", std::complex<double>, 0, n, kd, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (n) );
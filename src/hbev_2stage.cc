@@ -25,6 +25,56 @@ int64_t hbev_2stage(
     float* W,
     std::complex<float>* Z, int64_t ldz )
 {
+    // query for workspace size
+    int64_t lwork, lrwork;
+    hbev_2stage_work_size(
+        jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+        &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+
+    return hbev_2stage(
+        jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+        &work[0], lwork, &rwork[0], lrwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t hbev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    double* W,
+    std::complex<double>* Z, int64_t ldz )
+{
+    // query for workspace size
+    int64_t lwork, lrwork;
+    hbev_2stage_work_size(
+        jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+        &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+
+    return hbev_2stage(
+        jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+        &work[0], lwork, &rwork[0], lrwork );
+}
+
+// -----------------------------------------------------------------------------
+void hbev_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* lwork, int64_t* lrwork )
+{
+    auto key = internal::work_size_key(
+        "chbev_2stage", jobz, uplo, n, kd, ldab, ldz );
+    if (internal::work_size_cache_find( key, lwork, lrwork ))
+        return;
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -33,7 +83,6 @@ int64_t hbev_2stage(
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
 
-    // query for workspace size
     std::complex<float> qry_work[1];
     float qry_rwork[1];
     lapack_int ineg_one = -1;
@@ -48,33 +97,24 @@ int64_t hbev_2stage(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (max( 1, 3*n-2 )) );
-
-    LAPACK_chbev_2stage(
-        &jobz_, &uplo_, &n_, &kd_,
-        (lapack_complex_float*) AB, &ldab_,
-        W,
-        (lapack_complex_float*) Z, &ldz_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0], &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    *lwork = real(qry_work[0]);
+    *lrwork = max( 1, 3*n-2 );
+    internal::work_size_cache_insert( key, *lwork, *lrwork );
 }
 
 // -----------------------------------------------------------------------------
-int64_t hbev_2stage(
+void hbev_2stage_work_size(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
     std::complex<double>* AB, int64_t ldab,
     double* W,
-    std::complex<double>* Z, int64_t ldz )
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* lwork, int64_t* lrwork )
 {
+    auto key = internal::work_size_key(
+        "zhbev_2stage", jobz, uplo, n, kd, ldab, ldz );
+    if (internal::work_size_cache_find( key, lwork, lrwork ))
+        return;
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -83,7 +123,6 @@ int64_t hbev_2stage(
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
 
-    // query for workspace size
     std::complex<double> qry_work[1];
     double qry_rwork[1];
     lapack_int ineg_one = -1;
@@ -98,19 +137,72 @@ int64_t hbev_2stage(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    *lrwork = max( 1, 3*n-2 );
+    internal::work_size_cache_insert( key, *lwork, *lrwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (max( 1, 3*n-2 )) );
+// -----------------------------------------------------------------------------
+int64_t hbev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork )
+{
+    char jobz_ = to_char( jobz );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int kd_ = to_lapack_int( kd );
+    lapack_int ldab_ = to_lapack_int( ldab );
+    lapack_int ldz_ = to_lapack_int( ldz );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hbev_2stage", std::complex<float>, 0, n, kd, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( lrwork < max( 1, 3*n-2 ) );
+
+    LAPACK_chbev_2stage(
+        &jobz_, &uplo_, &n_, &kd_,
+        (lapack_complex_float*) AB, &ldab_,
+        W,
+        (lapack_complex_float*) Z, &ldz_,
+        (lapack_complex_float*) work, &lwork_,
+        rwork, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t hbev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork )
+{
+    char jobz_ = to_char( jobz );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int kd_ = to_lapack_int( kd );
+    lapack_int ldab_ = to_lapack_int( ldab );
+    lapack_int ldz_ = to_lapack_int( ldz );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hbev_2stage", std::complex<double>, 0, n, kd, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( lrwork < max( 1, 3*n-2 ) );
 
     LAPACK_zhbev_2stage(
         &jobz_, &uplo_, &n_, &kd_,
         (lapack_complex_double*) AB, &ldab_,
         W,
         (lapack_complex_double*) Z, &ldz_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0], &info_
+        (lapack_complex_double*) work, &lwork_,
+        rwork, &info_
     );
     if (info_ < 0) {
         throw Error();
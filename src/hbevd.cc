@@ -23,6 +23,58 @@ int64_t hbevd(
     float* W,
     std::complex<float>* Z, int64_t ldz )
 {
+    // query for workspace size
+    int64_t lwork, lrwork, liwork;
+    hbevd_work_size(
+        jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+        &lwork, &lrwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+    lapack::vector< int64_t > iwork( liwork );
+
+    return hbevd(
+        jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+        &work[0], lwork, &rwork[0], lrwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t hbevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    double* W,
+    std::complex<double>* Z, int64_t ldz )
+{
+    // query for workspace size
+    int64_t lwork, lrwork, liwork;
+    hbevd_work_size(
+        jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+        &lwork, &lrwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+    lapack::vector< int64_t > iwork( liwork );
+
+    return hbevd(
+        jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+        &work[0], lwork, &rwork[0], lrwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+void hbevd_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
+{
+    auto key = internal::work_size_key(
+        "chbevd", jobz, uplo, n, kd, ldab, ldz );
+    if (internal::work_size_cache_find( key, lwork, lrwork, liwork ))
+        return;
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -31,7 +83,6 @@ int64_t hbevd(
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
 
-    // query for workspace size
     std::complex<float> qry_work[1];
     float qry_rwork[1];
     lapack_int qry_iwork[1];
@@ -48,37 +99,25 @@ int64_t hbevd(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = real(qry_rwork[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
-
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
-
-    LAPACK_chbevd(
-        &jobz_, &uplo_, &n_, &kd_,
-        (lapack_complex_float*) AB, &ldab_,
-        W,
-        (lapack_complex_float*) Z, &ldz_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0], &lrwork_,
-        &iwork[0], &liwork_, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    *lwork = real(qry_work[0]);
+    *lrwork = real(qry_rwork[0]);
+    *liwork = real(qry_iwork[0]);
+    internal::work_size_cache_insert( key, *lwork, *lrwork, *liwork );
 }
 
 // -----------------------------------------------------------------------------
-int64_t hbevd(
+void hbevd_work_size(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
     std::complex<double>* AB, int64_t ldab,
     double* W,
-    std::complex<double>* Z, int64_t ldz )
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
 {
+    auto key = internal::work_size_key(
+        "zhbevd", jobz, uplo, n, kd, ldab, ldz );
+    if (internal::work_size_cache_find( key, lwork, lrwork, liwork ))
+        return;
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -87,7 +126,6 @@ int64_t hbevd(
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
 
-    // query for workspace size
     std::complex<double> qry_work[1];
     double qry_rwork[1];
     lapack_int qry_iwork[1];
@@ -104,23 +142,83 @@ int64_t hbevd(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = real(qry_rwork[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    *lwork = real(qry_work[0]);
+    *lrwork = real(qry_rwork[0]);
+    *liwork = real(qry_iwork[0]);
+    internal::work_size_cache_insert( key, *lwork, *lrwork, *liwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+// -----------------------------------------------------------------------------
+int64_t hbevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork )
+{
+    char jobz_ = to_char( jobz );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int kd_ = to_lapack_int( kd );
+    lapack_int ldab_ = to_lapack_int( ldab );
+    lapack_int ldz_ = to_lapack_int( ldz );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hbevd", std::complex<float>, 0, n, kd, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int lrwork_ = to_lapack_int( lrwork );
+    lapack_int liwork_ = to_lapack_int( liwork );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
+
+    LAPACK_chbevd(
+        &jobz_, &uplo_, &n_, &kd_,
+        (lapack_complex_float*) AB, &ldab_,
+        W,
+        (lapack_complex_float*) Z, &ldz_,
+        (lapack_complex_float*) work, &lwork_,
+        rwork, &lrwork_,
+        iwork_, &liwork_, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t hbevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork )
+{
+    char jobz_ = to_char( jobz );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int kd_ = to_lapack_int( kd );
+    lapack_int ldab_ = to_lapack_int( ldab );
+    lapack_int ldz_ = to_lapack_int( ldz );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hbevd", std::complex<double>, 0, n, kd, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int lrwork_ = to_lapack_int( lrwork );
+    lapack_int liwork_ = to_lapack_int( liwork );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
 
     LAPACK_zhbevd(
         &jobz_, &uplo_, &n_, &kd_,
         (lapack_complex_double*) AB, &ldab_,
         W,
         (lapack_complex_double*) Z, &ldz_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0], &lrwork_,
-        &iwork[0], &liwork_, &info_
+        (lapack_complex_double*) work, &lwork_,
+        rwork, &lrwork_,
+        iwork_, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
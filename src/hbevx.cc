@@ -45,6 +45,7 @@ int64_t hbevx(
         lapack_int* ifail_ptr = ifail;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hbevx", std::complex<float>, 0, n, kd, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<float> > work( (n) );
@@ -103,6 +104,7 @@ int64_t hbevx(
         lapack_int* ifail_ptr = ifail;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hbevx", std::complex<double>, 0, n, kd, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (n) );
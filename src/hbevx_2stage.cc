@@ -28,6 +28,68 @@ int64_t hbevx_2stage(
     std::complex<float>* Z, int64_t ldz,
     int64_t* ifail )
 {
+    // query for workspace size
+    int64_t lwork, lrwork, liwork;
+    hbevx_2stage_work_size(
+        jobz, range, uplo, n, kd, AB, ldab, Q, ldq, vl, vu, il, iu, abstol,
+        nfound, W, Z, ldz, ifail,
+        &lwork, &lrwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+    lapack::vector< int64_t > iwork( liwork );
+
+    return hbevx_2stage(
+        jobz, range, uplo, n, kd, AB, ldab, Q, ldq, vl, vu, il, iu, abstol,
+        nfound, W, Z, ldz, ifail,
+        &work[0], lwork, &rwork[0], lrwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t hbevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    std::complex<double>* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifail )
+{
+    // query for workspace size
+    int64_t lwork, lrwork, liwork;
+    hbevx_2stage_work_size(
+        jobz, range, uplo, n, kd, AB, ldab, Q, ldq, vl, vu, il, iu, abstol,
+        nfound, W, Z, ldz, ifail,
+        &lwork, &lrwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+    lapack::vector< int64_t > iwork( liwork );
+
+    return hbevx_2stage(
+        jobz, range, uplo, n, kd, AB, ldab, Q, ldq, vl, vu, il, iu, abstol,
+        nfound, W, Z, ldz, ifail,
+        &work[0], lwork, &rwork[0], lrwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+void hbevx_2stage_work_size(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    std::complex<float>* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifail,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
+{
+    auto key = internal::work_size_key(
+        "chbevx_2stage", jobz, range, uplo, n, kd, ldab, ldq, il, iu, ldz );
+    if (internal::work_size_cache_find( key, lwork, lrwork, liwork ))
+        return;
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     char uplo_ = to_char( uplo );
@@ -39,16 +101,9 @@ int64_t hbevx_2stage(
     lapack_int iu_ = to_lapack_int( iu );
     lapack_int nfound_ = 0;  // out
     lapack_int ldz_ = to_lapack_int( ldz );
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ifail_( (n) );
-        lapack_int* ifail_ptr = &ifail_[0];
-    #else
-        lapack_int* ifail_ptr = ifail;
-    #endif
+    lapack_int* ifail_ptr = reinterpret_cast< lapack_int* >( ifail );  // not referenced
     lapack_int info_ = 0;
 
-    // query for workspace size
     std::complex<float> qry_work[1];
     float qry_rwork[1];
     lapack_int qry_iwork[1];
@@ -67,12 +122,104 @@ int64_t hbevx_2stage(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    *lrwork = 7*n;
+    *liwork = 5*n;
+    internal::work_size_cache_insert( key, *lwork, *lrwork, *liwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (7*n) );
-    lapack::vector< lapack_int > iwork( (5*n) );
+// -----------------------------------------------------------------------------
+void hbevx_2stage_work_size(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<double>* AB, int64_t ldab,
+    std::complex<double>* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifail,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
+{
+    auto key = internal::work_size_key(
+        "zhbevx_2stage", jobz, range, uplo, n, kd, ldab, ldq, il, iu, ldz );
+    if (internal::work_size_cache_find( key, lwork, lrwork, liwork ))
+        return;
+
+    char jobz_ = to_char( jobz );
+    char range_ = to_char( range );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int kd_ = to_lapack_int( kd );
+    lapack_int ldab_ = to_lapack_int( ldab );
+    lapack_int ldq_ = to_lapack_int( ldq );
+    lapack_int il_ = to_lapack_int( il );
+    lapack_int iu_ = to_lapack_int( iu );
+    lapack_int nfound_ = 0;  // out
+    lapack_int ldz_ = to_lapack_int( ldz );
+    lapack_int* ifail_ptr = reinterpret_cast< lapack_int* >( ifail );  // not referenced
+    lapack_int info_ = 0;
+
+    std::complex<double> qry_work[1];
+    double qry_rwork[1];
+    lapack_int qry_iwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_zhbevx_2stage(
+        &jobz_, &range_, &uplo_, &n_, &kd_,
+        (lapack_complex_double*) AB, &ldab_,
+        (lapack_complex_double*) Q, &ldq_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
+        W,
+        (lapack_complex_double*) Z, &ldz_,
+        (lapack_complex_double*) qry_work, &ineg_one,
+        qry_rwork,
+        qry_iwork,
+        ifail_ptr, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    *lrwork = 7*n;
+    *liwork = 5*n;
+    internal::work_size_cache_insert( key, *lwork, *lrwork, *liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t hbevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    std::complex<float>* AB, int64_t ldab,
+    std::complex<float>* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifail,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork )
+{
+    char jobz_ = to_char( jobz );
+    char range_ = to_char( range );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int kd_ = to_lapack_int( kd );
+    lapack_int ldab_ = to_lapack_int( ldab );
+    lapack_int ldq_ = to_lapack_int( ldq );
+    lapack_int il_ = to_lapack_int( il );
+    lapack_int iu_ = to_lapack_int( iu );
+    lapack_int nfound_ = 0;  // out
+    lapack_int ldz_ = to_lapack_int( ldz );
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > ifail_( (n) );
+        lapack_int* ifail_ptr = &ifail_[0];
+    #else
+        lapack_int* ifail_ptr = ifail;
+    #endif
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hbevx_2stage", std::complex<float>, 0, n, kd, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( lrwork < 7*n );
+    lapack_error_if( liwork < 5*n );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
 
     LAPACK_chbevx_2stage(
         &jobz_, &range_, &uplo_, &n_, &kd_,
@@ -80,9 +227,9 @@ int64_t hbevx_2stage(
         (lapack_complex_float*) Q, &ldq_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
         W,
         (lapack_complex_float*) Z, &ldz_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0],
-        &iwork[0],
+        (lapack_complex_float*) work, &lwork_,
+        rwork,
+        iwork_,
         ifail_ptr, &info_
     );
     if (info_ < 0) {
@@ -105,7 +252,10 @@ int64_t hbevx_2stage(
     int64_t* nfound,
     double* W,
     std::complex<double>* Z, int64_t ldz,
-    int64_t* ifail )
+    int64_t* ifail,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork )
 {
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
@@ -126,32 +276,12 @@ int64_t hbevx_2stage(
         lapack_int* ifail_ptr = ifail;
     #endif
     lapack_int info_ = 0;
-
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zhbevx_2stage(
-        &jobz_, &range_, &uplo_, &n_, &kd_,
-        (lapack_complex_double*) AB, &ldab_,
-        (lapack_complex_double*) Q, &ldq_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
-        W,
-        (lapack_complex_double*) Z, &ldz_,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork,
-        qry_iwork,
-        ifail_ptr, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (7*n) );
-    lapack::vector< lapack_int > iwork( (5*n) );
+    LAPACK_TRACE_BLOCK( "hbevx_2stage", std::complex<double>, 0, n, kd, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( lrwork < 7*n );
+    lapack_error_if( liwork < 5*n );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
 
     LAPACK_zhbevx_2stage(
         &jobz_, &range_, &uplo_, &n_, &kd_,
@@ -159,9 +289,9 @@ int64_t hbevx_2stage(
         (lapack_complex_double*) Q, &ldq_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
         W,
         (lapack_complex_double*) Z, &ldz_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0],
-        &iwork[0],
+        (lapack_complex_double*) work, &lwork_,
+        rwork,
+        iwork_,
         ifail_ptr, &info_
     );
     if (info_ < 0) {
@@ -32,6 +32,7 @@ int64_t hbgst(
     lapack_int ldbb_ = to_lapack_int( ldbb );
     lapack_int ldx_ = to_lapack_int( ldx );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hbgst", std::complex<float>, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<float> > work( (n) );
@@ -67,6 +68,7 @@ int64_t hbgst(
     lapack_int ldbb_ = to_lapack_int( ldbb );
     lapack_int ldx_ = to_lapack_int( ldx );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hbgst", std::complex<double>, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (n) );
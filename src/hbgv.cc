@@ -33,6 +33,7 @@ int64_t hbgv(
     lapack_int ldbb_ = to_lapack_int( ldbb );
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hbgv", std::complex<float>, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<float> > work( (n) );
@@ -70,6 +71,7 @@ int64_t hbgv(
     lapack_int ldbb_ = to_lapack_int( ldbb );
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hbgv", std::complex<double>, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (n) );
@@ -24,6 +24,60 @@ int64_t hbgvd(
     float* W,
     std::complex<float>* Z, int64_t ldz )
 {
+    // query for workspace size
+    int64_t lwork, lrwork, liwork;
+    hbgvd_work_size(
+        jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz,
+        &lwork, &lrwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+    lapack::vector< int64_t > iwork( liwork );
+
+    return hbgvd(
+        jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz,
+        &work[0], lwork, &rwork[0], lrwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t hbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    std::complex<double>* AB, int64_t ldab,
+    std::complex<double>* BB, int64_t ldbb,
+    double* W,
+    std::complex<double>* Z, int64_t ldz )
+{
+    // query for workspace size
+    int64_t lwork, lrwork, liwork;
+    hbgvd_work_size(
+        jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz,
+        &lwork, &lrwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+    lapack::vector< int64_t > iwork( liwork );
+
+    return hbgvd(
+        jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz,
+        &work[0], lwork, &rwork[0], lrwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+void hbgvd_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    std::complex<float>* AB, int64_t ldab,
+    std::complex<float>* BB, int64_t ldbb,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
+{
+    auto key = internal::work_size_key(
+        "chbgvd", jobz, uplo, n, ka, kb, ldab, ldbb, ldz );
+    if (internal::work_size_cache_find( key, lwork, lrwork, liwork ))
+        return;
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -34,7 +88,6 @@ int64_t hbgvd(
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
 
-    // query for workspace size
     std::complex<float> qry_work[1];
     float qry_rwork[1];
     lapack_int qry_iwork[1];
@@ -52,42 +105,30 @@ int64_t hbgvd(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
     lapack_int lrwork_ = real(qry_rwork[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    *liwork = real(qry_iwork[0]);
 
     // LAPACK <= 3.6.0 needed 2*n, but query returned n. Be safe.
     lrwork_ = max( lrwork_, 2*n_ );
-
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
-
-    LAPACK_chbgvd(
-        &jobz_, &uplo_, &n_, &ka_, &kb_,
-        (lapack_complex_float*) AB, &ldab_,
-        (lapack_complex_float*) BB, &ldbb_,
-        W,
-        (lapack_complex_float*) Z, &ldz_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0], &lrwork_,
-        &iwork[0], &liwork_, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    *lrwork = lrwork_;
+    internal::work_size_cache_insert( key, *lwork, *lrwork, *liwork );
 }
 
 // -----------------------------------------------------------------------------
-int64_t hbgvd(
+void hbgvd_work_size(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
     std::complex<double>* AB, int64_t ldab,
     std::complex<double>* BB, int64_t ldbb,
     double* W,
-    std::complex<double>* Z, int64_t ldz )
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
 {
+    auto key = internal::work_size_key(
+        "zhbgvd", jobz, uplo, n, ka, kb, ldab, ldbb, ldz );
+    if (internal::work_size_cache_find( key, lwork, lrwork, liwork ))
+        return;
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -98,7 +139,6 @@ int64_t hbgvd(
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
 
-    // query for workspace size
     std::complex<double> qry_work[1];
     double qry_rwork[1];
     lapack_int qry_iwork[1];
@@ -116,17 +156,85 @@ int64_t hbgvd(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
     lapack_int lrwork_ = real(qry_rwork[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    *liwork = real(qry_iwork[0]);
 
     // LAPACK <= 3.6.0 needed 2*n, but query returned n. Be safe.
     lrwork_ = max( lrwork_, 2*n_ );
+    *lrwork = lrwork_;
+    internal::work_size_cache_insert( key, *lwork, *lrwork, *liwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+// -----------------------------------------------------------------------------
+int64_t hbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    std::complex<float>* AB, int64_t ldab,
+    std::complex<float>* BB, int64_t ldbb,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork )
+{
+    char jobz_ = to_char( jobz );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ka_ = to_lapack_int( ka );
+    lapack_int kb_ = to_lapack_int( kb );
+    lapack_int ldab_ = to_lapack_int( ldab );
+    lapack_int ldbb_ = to_lapack_int( ldbb );
+    lapack_int ldz_ = to_lapack_int( ldz );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hbgvd", std::complex<float>, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int lrwork_ = to_lapack_int( lrwork );
+    lapack_int liwork_ = to_lapack_int( liwork );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
+
+    LAPACK_chbgvd(
+        &jobz_, &uplo_, &n_, &ka_, &kb_,
+        (lapack_complex_float*) AB, &ldab_,
+        (lapack_complex_float*) BB, &ldbb_,
+        W,
+        (lapack_complex_float*) Z, &ldz_,
+        (lapack_complex_float*) work, &lwork_,
+        rwork, &lrwork_,
+        iwork_, &liwork_, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t hbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    std::complex<double>* AB, int64_t ldab,
+    std::complex<double>* BB, int64_t ldbb,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork )
+{
+    char jobz_ = to_char( jobz );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ka_ = to_lapack_int( ka );
+    lapack_int kb_ = to_lapack_int( kb );
+    lapack_int ldab_ = to_lapack_int( ldab );
+    lapack_int ldbb_ = to_lapack_int( ldbb );
+    lapack_int ldz_ = to_lapack_int( ldz );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hbgvd", std::complex<double>, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int lrwork_ = to_lapack_int( lrwork );
+    lapack_int liwork_ = to_lapack_int( liwork );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
 
     LAPACK_zhbgvd(
         &jobz_, &uplo_, &n_, &ka_, &kb_,
@@ -134,9 +242,9 @@ int64_t hbgvd(
         (lapack_complex_double*) BB, &ldbb_,
         W,
         (lapack_complex_double*) Z, &ldz_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0], &lrwork_,
-        &iwork[0], &liwork_, &info_
+        (lapack_complex_double*) work, &lwork_,
+        rwork, &lrwork_,
+        iwork_, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
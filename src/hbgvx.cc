@@ -48,6 +48,7 @@ int64_t hbgvx(
         lapack_int* ifail_ptr = ifail;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hbgvx", std::complex<float>, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<float> > work( (n) );
@@ -110,6 +111,7 @@ int64_t hbgvx(
         lapack_int* ifail_ptr = ifail;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hbgvx", std::complex<double>, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (n) );
@@ -31,6 +31,7 @@ int64_t hbtrd(
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int ldq_ = to_lapack_int( ldq );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hbtrd", std::complex<float>, 0, n, kd, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<float> > work( (n) );
@@ -64,6 +65,7 @@ int64_t hbtrd(
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int ldq_ = to_lapack_int( ldq );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hbtrd", std::complex<double>, 0, n, kd, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (n) );
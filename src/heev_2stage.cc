@@ -25,43 +25,19 @@ int64_t heev_2stage(
     std::complex<float>* A, int64_t lda,
     float* W )
 {
-    char jobz_ = to_char( jobz );
-    char uplo_ = to_char( uplo );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int info_ = 0;
-
     // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cheev_2stage(
-        &jobz_, &uplo_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        W,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork, lrwork;
+    heev_2stage_work_size(
+        jobz, uplo, n, A, lda, W,
+        &lwork, &lrwork );
 
     // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (max( 1, 3*n-2 )) );
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
 
-    LAPACK_cheev_2stage(
-        &jobz_, &uplo_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        W,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0], &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return heev_2stage(
+        jobz, uplo, n, A, lda, W,
+        &work[0], lwork, &rwork[0], lrwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -148,13 +124,90 @@ int64_t heev_2stage(
     std::complex<double>* A, int64_t lda,
     double* W )
 {
+    // query for workspace size
+    int64_t lwork, lrwork;
+    heev_2stage_work_size(
+        jobz, uplo, n, A, lda, W,
+        &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+
+    return heev_2stage(
+        jobz, uplo, n, A, lda, W,
+        &work[0], lwork, &rwork[0], lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup heev
+void heev_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W,
+    int64_t* lwork, int64_t* lrwork )
+{
+    auto key = internal::work_size_key(
+        "cheev_2stage", jobz, uplo, n, lda );
+    if (internal::work_size_cache_find( key, lwork, lrwork ))
+        return;
+
+    char jobz_ = to_char( jobz );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+
+    std::complex<float> qry_work[1];
+    float qry_rwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_cheev_2stage(
+        &jobz_, &uplo_, &n_,
+        (lapack_complex_float*) A, &lda_,
+        W,
+        (lapack_complex_float*) qry_work, &ineg_one,
+        qry_rwork, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    *lrwork = max( 1, 3*n-2 );
+    internal::work_size_cache_insert( key, *lwork, *lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::heev_2stage with caller-provided workspace.
+/// Returns the array lengths that the workspace overload of `heev_2stage`
+/// requires, so the workspace can be allocated once, outside a loop.
+///
+/// Other arguments are the same as for lapack::heev_2stage.
+/// Arrays are used only to select the precision and are not referenced.
+///
+/// @param[out] lwork
+///     The optimal length of the array work.
+///
+/// @param[out] lrwork
+///     The length of the array rwork, max( 1, 3*n-2 ).
+///
+/// @ingroup heev
+void heev_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W,
+    int64_t* lwork, int64_t* lrwork )
+{
+    auto key = internal::work_size_key(
+        "zheev_2stage", jobz, uplo, n, lda );
+    if (internal::work_size_cache_find( key, lwork, lrwork ))
+        return;
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
 
-    // query for workspace size
     std::complex<double> qry_work[1];
     double qry_rwork[1];
     lapack_int ineg_one = -1;
@@ -168,18 +221,85 @@ int64_t heev_2stage(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    *lrwork = max( 1, 3*n-2 );
+    internal::work_size_cache_insert( key, *lwork, *lrwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (max( 1, 3*n-2 )) );
+// -----------------------------------------------------------------------------
+/// @ingroup heev
+int64_t heev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork )
+{
+    char jobz_ = to_char( jobz );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "heev_2stage", std::complex<float>, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( lrwork < max( 1, 3*n-2 ) );
+
+    LAPACK_cheev_2stage(
+        &jobz_, &uplo_, &n_,
+        (lapack_complex_float*) A, &lda_,
+        W,
+        (lapack_complex_float*) work, &lwork_,
+        rwork, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::heev_2stage that takes caller-provided workspace
+/// instead of querying and allocating it on each call.
+/// Use lapack::heev_2stage_work_size to get the required lengths.
+///
+/// Other arguments are the same as for lapack::heev_2stage.
+///
+/// @param[out] work
+///     The vector work of length lwork. Workspace.
+///
+/// @param[in] lwork
+///     The length of the array work.
+///     Use the value from lapack::heev_2stage_work_size for best performance.
+///
+/// @param[out] rwork
+///     The vector rwork of length lrwork. Workspace.
+///
+/// @param[in] lrwork
+///     The length of the array rwork, lrwork >= max( 1, 3*n-2 ).
+///
+/// @ingroup heev
+int64_t heev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork )
+{
+    char jobz_ = to_char( jobz );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "heev_2stage", std::complex<double>, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( lrwork < max( 1, 3*n-2 ) );
 
     LAPACK_zheev_2stage(
         &jobz_, &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
         W,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0], &info_
+        (lapack_complex_double*) work, &lwork_,
+        rwork, &info_
     );
     if (info_ < 0) {
         throw Error();
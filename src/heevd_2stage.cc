@@ -25,49 +25,20 @@ int64_t heevd_2stage(
     std::complex<float>* A, int64_t lda,
     float* W )
 {
-    char jobz_ = to_char( jobz );
-    char uplo_ = to_char( uplo );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int info_ = 0;
-
     // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cheevd_2stage(
-        &jobz_, &uplo_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        W,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork, &ineg_one,
-        qry_iwork, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = real(qry_rwork[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    int64_t lwork, lrwork, liwork;
+    heevd_2stage_work_size(
+        jobz, uplo, n, A, lda, W,
+        &lwork, &lrwork, &liwork );
 
     // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+    lapack::vector< int64_t > iwork( liwork );
 
-    LAPACK_cheevd_2stage(
-        &jobz_, &uplo_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        W,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0], &lrwork_,
-        &iwork[0], &liwork_, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return heevd_2stage(
+        jobz, uplo, n, A, lda, W,
+        &work[0], lwork, &rwork[0], lrwork, &iwork[0], liwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -166,13 +137,97 @@ int64_t heevd_2stage(
     std::complex<double>* A, int64_t lda,
     double* W )
 {
+    // query for workspace size
+    int64_t lwork, lrwork, liwork;
+    heevd_2stage_work_size(
+        jobz, uplo, n, A, lda, W,
+        &lwork, &lrwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+    lapack::vector< int64_t > iwork( liwork );
+
+    return heevd_2stage(
+        jobz, uplo, n, A, lda, W,
+        &work[0], lwork, &rwork[0], lrwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup heev
+void heevd_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
+{
+    auto key = internal::work_size_key(
+        "cheevd_2stage", jobz, uplo, n, lda );
+    if (internal::work_size_cache_find( key, lwork, lrwork, liwork ))
+        return;
+
+    char jobz_ = to_char( jobz );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+
+    std::complex<float> qry_work[1];
+    float qry_rwork[1];
+    lapack_int qry_iwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_cheevd_2stage(
+        &jobz_, &uplo_, &n_,
+        (lapack_complex_float*) A, &lda_,
+        W,
+        (lapack_complex_float*) qry_work, &ineg_one,
+        qry_rwork, &ineg_one,
+        qry_iwork, &ineg_one, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    *lrwork = real(qry_rwork[0]);
+    *liwork = real(qry_iwork[0]);
+    internal::work_size_cache_insert( key, *lwork, *lrwork, *liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::heevd_2stage with caller-provided workspace.
+/// Returns the array lengths that the workspace overload of `heevd_2stage`
+/// requires, so the workspace can be allocated once, outside a loop.
+///
+/// Other arguments are the same as for lapack::heevd_2stage.
+/// Arrays are used only to select the precision and are not referenced.
+///
+/// @param[out] lwork
+///     The optimal length of the array work.
+///
+/// @param[out] lrwork
+///     The optimal length of the array rwork.
+///
+/// @param[out] liwork
+///     The optimal length of the array iwork.
+///
+/// @ingroup heev
+void heevd_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
+{
+    auto key = internal::work_size_key(
+        "zheevd_2stage", jobz, uplo, n, lda );
+    if (internal::work_size_cache_find( key, lwork, lrwork, liwork ))
+        return;
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
 
-    // query for workspace size
     std::complex<double> qry_work[1];
     double qry_rwork[1];
     lapack_int qry_iwork[1];
@@ -188,22 +243,106 @@ int64_t heevd_2stage(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = real(qry_rwork[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    *lwork = real(qry_work[0]);
+    *lrwork = real(qry_rwork[0]);
+    *liwork = real(qry_iwork[0]);
+    internal::work_size_cache_insert( key, *lwork, *lrwork, *liwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup heev
+int64_t heevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork )
+{
+    char jobz_ = to_char( jobz );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "heevd_2stage", std::complex<float>, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int lrwork_ = to_lapack_int( lrwork );
+    lapack_int liwork_ = to_lapack_int( liwork );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
+
+    LAPACK_cheevd_2stage(
+        &jobz_, &uplo_, &n_,
+        (lapack_complex_float*) A, &lda_,
+        W,
+        (lapack_complex_float*) work, &lwork_,
+        rwork, &lrwork_,
+        iwork_, &liwork_, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::heevd_2stage that takes caller-provided workspace
+/// instead of querying and allocating it on each call.
+/// Use lapack::heevd_2stage_work_size to get the required lengths.
+///
+/// Other arguments are the same as for lapack::heevd_2stage.
+///
+/// @param[out] work
+///     The vector work of length lwork. Workspace.
+///
+/// @param[in] lwork
+///     The length of the array work.
+///     Use the value from lapack::heevd_2stage_work_size for best performance.
+///
+/// @param[out] rwork
+///     The vector rwork of length lrwork. Workspace.
+///
+/// @param[in] lrwork
+///     The length of the array rwork.
+///     Use the value from lapack::heevd_2stage_work_size for best performance.
+///
+/// @param[out] iwork
+///     The vector iwork of length liwork. Workspace.
+///     This is 64-bit for a uniform API; with 32-bit LAPACK integers,
+///     only the first half of its bytes are used.
+///
+/// @param[in] liwork
+///     The length of the array iwork.
+///     Use the value from lapack::heevd_2stage_work_size for best performance.
+///
+/// @ingroup heev
+int64_t heevd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork )
+{
+    char jobz_ = to_char( jobz );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "heevd_2stage", std::complex<double>, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int lrwork_ = to_lapack_int( lrwork );
+    lapack_int liwork_ = to_lapack_int( liwork );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
 
     LAPACK_zheevd_2stage(
         &jobz_, &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
         W,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0], &lrwork_,
-        &iwork[0], &liwork_, &info_
+        (lapack_complex_double*) work, &lwork_,
+        rwork, &lrwork_,
+        iwork_, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
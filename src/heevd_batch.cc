@@ -0,0 +1,377 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "lapack/fortran.h"
+#include "NoConstructAllocator.hh"
+#include "heevd_native.hh"
+
+namespace lapack {
+
+using blas::max;
+using blas::is_complex_v;
+
+//==============================================================================
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, float version.
+/// rwork is not referenced.
+/// @ingroup heevd_batch_internal
+inline void heevd(
+    char jobz, char uplo, lapack_int n,
+    float* A, lapack_int lda,
+    float* W,
+    float* work, lapack_int lwork,
+    float* rwork, lapack_int lrwork,
+    lapack_int* iwork, lapack_int liwork,
+    lapack_int* info )
+{
+    LAPACK_ssyevd(
+        &jobz, &uplo, &n, A, &lda, W,
+        work, &lwork, iwork, &liwork, info );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, double version.
+/// rwork is not referenced.
+/// @ingroup heevd_batch_internal
+inline void heevd(
+    char jobz, char uplo, lapack_int n,
+    double* A, lapack_int lda,
+    double* W,
+    double* work, lapack_int lwork,
+    double* rwork, lapack_int lrwork,
+    lapack_int* iwork, lapack_int liwork,
+    lapack_int* info )
+{
+    LAPACK_dsyevd(
+        &jobz, &uplo, &n, A, &lda, W,
+        work, &lwork, iwork, &liwork, info );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, complex<float> version.
+/// @ingroup heevd_batch_internal
+inline void heevd(
+    char jobz, char uplo, lapack_int n,
+    std::complex<float>* A, lapack_int lda,
+    float* W,
+    std::complex<float>* work, lapack_int lwork,
+    float* rwork, lapack_int lrwork,
+    lapack_int* iwork, lapack_int liwork,
+    lapack_int* info )
+{
+    LAPACK_cheevd(
+        &jobz, &uplo, &n,
+        (lapack_complex_float*) A, &lda, W,
+        (lapack_complex_float*) work, &lwork,
+        rwork, &lrwork, iwork, &liwork, info );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, complex<double> version.
+/// @ingroup heevd_batch_internal
+inline void heevd(
+    char jobz, char uplo, lapack_int n,
+    std::complex<double>* A, lapack_int lda,
+    double* W,
+    std::complex<double>* work, lapack_int lwork,
+    double* rwork, lapack_int lrwork,
+    lapack_int* iwork, lapack_int liwork,
+    lapack_int* info )
+{
+    LAPACK_zheevd(
+        &jobz, &uplo, &n,
+        (lapack_complex_double*) A, &lda, W,
+        (lapack_complex_double*) work, &lwork,
+        rwork, &lrwork, iwork, &liwork, info );
+}
+
+}  // namespace internal
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks and converts arguments once,
+/// then solves each eigenproblem in parallel. For small n
+/// (see internal::heev_use_native), uses native kernels; otherwise,
+/// queries workspace once and calls low-level wrapper, with one
+/// workspace per thread.
+/// Aarray(i) and Warray(i) return pointers to the i-th matrix and
+/// eigenvalues.
+/// @ingroup heevd_batch_internal
+///
+template <typename scalar_t, typename Aarray_t, typename Warray_t>
+void heevd_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    Aarray_t Aarray, int64_t lda,
+    Warray_t Warray,
+    int64_t batch_count, int64_t* info )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    lapack_error_if( jobz != Job::NoVec && jobz != Job::Vec );
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( batch_count < 0 );
+
+    if (internal::heev_use_native( jobz, n )) {
+        #pragma omp parallel if (batch_count > 1)
+        {
+            lapack::vector< scalar_t > work( max( 1, 2*n*n ) );
+
+            #pragma omp for schedule( static )
+            for (int64_t i = 0; i < batch_count; ++i) {
+                info[ i ] = internal::heev_native(
+                    jobz, uplo, n, Aarray( i ), lda, Warray( i ), &work[0] );
+            }
+        }
+    }
+    else {
+        char jobz_ = to_char( jobz );
+        char uplo_ = to_char( uplo );
+        lapack_int n_ = to_lapack_int( n );
+        lapack_int lda_ = to_lapack_int( lda );
+
+        int64_t lwork, lrwork = 0, liwork;
+        if constexpr (is_complex_v< scalar_t >) {
+            heevd_work_size( jobz, uplo, n, (scalar_t*) nullptr, lda,
+                             (real_t*) nullptr, &lwork, &lrwork, &liwork );
+        }
+        else {
+            syevd_work_size( jobz, uplo, n, (scalar_t*) nullptr, lda,
+                             (real_t*) nullptr, &lwork, &liwork );
+        }
+        lapack_int lwork_  = to_lapack_int( lwork );
+        lapack_int lrwork_ = to_lapack_int( lrwork );
+        lapack_int liwork_ = to_lapack_int( liwork );
+
+        #pragma omp parallel if (batch_count > 1)
+        {
+            lapack::vector< scalar_t > work( max( 1, lwork ) );
+            lapack::vector< real_t > rwork( max( 1, lrwork ) );
+            lapack::vector< lapack_int > iwork( max( 1, liwork ) );
+
+            #pragma omp for schedule( static )
+            for (int64_t i = 0; i < batch_count; ++i) {
+                lapack_int info_ = 0;
+                internal::heevd(
+                    jobz_, uplo_, n_, Aarray( i ), lda_, Warray( i ),
+                    &work[0], lwork_, &rwork[0], lrwork_,
+                    &iwork[0], liwork_, &info_ );
+                info[ i ] = info_;
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Strided version: A_i is A + i*strideA, W_i is W + i*strideW.
+/// @ingroup heevd_batch_internal
+///
+template <typename scalar_t>
+void heevd_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda, int64_t strideA,
+    blas::real_type< scalar_t >* W, int64_t strideW,
+    int64_t batch_count, int64_t* info )
+{
+    if (batch_count > 1) {
+        lapack_error_if( strideA < lda*n );
+        lapack_error_if( strideW < n );
+    }
+
+    heevd_batch< scalar_t >(
+        jobz, uplo, n,
+        [=]( int64_t i ) { return A + i*strideA; }, lda,
+        [=]( int64_t i ) { return W + i*strideW; },
+        batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// Pointer-array version: A_i is Aarray[ i ], W_i is Warray[ i ].
+/// @ingroup heevd_batch_internal
+///
+template <typename scalar_t>
+void heevd_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    scalar_t* const* Aarray, int64_t lda,
+    blas::real_type< scalar_t >* const* Warray,
+    int64_t batch_count, int64_t* info )
+{
+    heevd_batch< scalar_t >(
+        jobz, uplo, n,
+        [=]( int64_t i ) { return Aarray[ i ]; }, lda,
+        [=]( int64_t i ) { return Warray[ i ]; },
+        batch_count, info );
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// @ingroup heevd_batch
+void heevd_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, int64_t strideA,
+    float* W, int64_t strideW,
+    int64_t batch_count, int64_t* info )
+{
+    impl::heevd_batch( jobz, uplo, n, A, lda, strideA, W, strideW,
+                       batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup heevd_batch
+void heevd_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, int64_t strideA,
+    double* W, int64_t strideW,
+    int64_t batch_count, int64_t* info )
+{
+    impl::heevd_batch( jobz, uplo, n, A, lda, strideA, W, strideW,
+                       batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup heevd_batch
+void heevd_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    float* W, int64_t strideW,
+    int64_t batch_count, int64_t* info )
+{
+    impl::heevd_batch( jobz, uplo, n, A, lda, strideA, W, strideW,
+                       batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// Computes all eigenvalues and, optionally, eigenvectors of a batch of
+/// n-by-n Hermitian matrices A_i, as in lapack::heevd.
+/// Matrices are processed in parallel using OpenMP.
+///
+/// For small n, native kernels are used instead of calling LAPACK for
+/// each matrix: closed forms based on lapack::lae2 and lapack::laev2
+/// for n <= 2, a closed form for well-conditioned eigenvalues only
+/// with n = 3, and cyclic Jacobi otherwise. Eigenvalues agree with LAPACK to
+/// O( eps ||A_i|| ); eigenvectors may differ by a unit scalar factor.
+/// For larger n, the workspace size is queried once for the batch, and
+/// each thread allocates one workspace that it reuses for all its
+/// matrices.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`,
+/// for both strided storage (shown here) and pointer-array storage:
+///
+///     heevd_batch( jobz, uplo, n, Aarray, lda, Warray, batch_count, info )
+///
+/// For real matrices, this is an alias for `lapack::syevd_batch`.
+///
+/// @param[in] jobz
+///     - lapack::Job::NoVec: Compute eigenvalues only;
+///     - lapack::Job::Vec:   Compute eigenvalues and eigenvectors.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangle of each A_i is stored;
+///     - lapack::Uplo::Lower: Lower triangle of each A_i is stored.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in,out] A
+///     The batch of n-by-n matrices, each stored in an lda-by-n array,
+///     with A_i starting at A + i*strideA.
+///     On exit, if jobz = Vec, then if info[ i ] = 0, A_i contains the
+///     orthonormal eigenvectors of the matrix A_i.
+///     If jobz = NoVec, then on exit the uplo triangle of A_i,
+///     including the diagonal, may be destroyed.
+///
+/// @param[in] lda
+///     The leading dimension of each A_i. lda >= max(1,n).
+///
+/// @param[in] strideA
+///     Distance between the starts of consecutive A_i. strideA >= lda*n.
+///
+/// @param[out] W
+///     The batch of vectors W_i, each of length n, with W_i starting at
+///     W + i*strideW. If info[ i ] = 0, W_i contains the eigenvalues of
+///     A_i in ascending order.
+///
+/// @param[in] strideW
+///     Distance between the starts of consecutive W_i. strideW >= n.
+///
+/// @param[in] batch_count
+///     The number of matrices. batch_count >= 0.
+///
+/// @param[out] info
+///     The vector info of length batch_count.
+///     - info[ i ] = 0: successful exit.
+///     - info[ i ] > 0: the algorithm failed to converge for A_i.
+///
+/// Invalid arguments throw lapack::Error.
+///
+/// @ingroup heevd_batch
+void heevd_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    double* W, int64_t strideW,
+    int64_t batch_count, int64_t* info )
+{
+    impl::heevd_batch( jobz, uplo, n, A, lda, strideA, W, strideW,
+                       batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup heevd_batch
+void heevd_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* const* Aarray, int64_t lda,
+    float* const* Warray,
+    int64_t batch_count, int64_t* info )
+{
+    impl::heevd_batch( jobz, uplo, n, Aarray, lda, Warray,
+                       batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup heevd_batch
+void heevd_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* const* Aarray, int64_t lda,
+    double* const* Warray,
+    int64_t batch_count, int64_t* info )
+{
+    impl::heevd_batch( jobz, uplo, n, Aarray, lda, Warray,
+                       batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup heevd_batch
+void heevd_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* const* Aarray, int64_t lda,
+    float* const* Warray,
+    int64_t batch_count, int64_t* info )
+{
+    impl::heevd_batch( jobz, uplo, n, Aarray, lda, Warray,
+                       batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup heevd_batch
+void heevd_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* const* Aarray, int64_t lda,
+    double* const* Warray,
+    int64_t batch_count, int64_t* info )
+{
+    impl::heevd_batch( jobz, uplo, n, Aarray, lda, Warray,
+                       batch_count, info );
+}
+
+}  // namespace lapack
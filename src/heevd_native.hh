@@ -0,0 +1,370 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_HEEVD_NATIVE_HH
+#define LAPACK_HEEVD_NATIVE_HH
+
+#include "lapack.hh"
+
+#include <cmath>
+#include <limits>
+
+// Native Hermitian eigensolvers for small matrices, used by the batched
+// routines. For small n, the per-call overhead of Fortran heevd, which
+// queries ilaenv, reduces to tridiagonal form, and calls steqr or stedc,
+// dominates the O(n^3) work.
+
+namespace lapack {
+namespace internal {
+
+/// Largest n for which batched eigensolvers use the native kernels
+/// instead of calling LAPACK for each matrix, when computing
+/// eigenvectors and eigenvalues only, respectively.
+/// Jacobi does several times the flops of heevd, so it is faster only
+/// while heevd's per-call overhead dominates.
+const int64_t heev_native_max = 6;
+const int64_t heev_native_novec_max = 4;
+
+//------------------------------------------------------------------------------
+/// Closed-form eigenvalues and eigenvectors of a 2-by-2 Hermitian matrix,
+/// using lapack::lae2 and lapack::laev2.
+/// Eigenvalues are returned in ascending order, as in LAPACK heevd.
+///
+template <typename scalar_t>
+inline void heev_2x2(
+    lapack::Job jobz, lapack::Uplo uplo,
+    scalar_t* A, int64_t lda,
+    blas::real_type< scalar_t >* W )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    real_t a = std::real( A[ 0 ] );
+    real_t c = std::real( A[ 1 + lda ] );
+    scalar_t b = (uplo == Uplo::Upper ? A[ lda ] : blas::conj( A[ 1 ] ));
+
+    real_t rt1, rt2;
+    if (jobz == Job::NoVec) {
+        // Eigenvalues of [ a b; conj(b) c ] equal those of [ a |b|; |b| c ].
+        lapack::lae2( a, std::abs( b ), c, &rt1, &rt2 );
+        W[ 0 ] = blas::min( rt1, rt2 );
+        W[ 1 ] = blas::max( rt1, rt2 );
+        return;
+    }
+
+    // ( cs1, sn1 ) is the eigenvector for rt1,
+    // ( -conj( sn1 ), cs1 ) is the eigenvector for rt2.
+    real_t cs1;
+    scalar_t sn1;
+    lapack::laev2( scalar_t( a ), b, scalar_t( c ), &rt1, &rt2, &cs1, &sn1 );
+    if (rt1 <= rt2) {
+        W[ 0 ] = rt1;
+        W[ 1 ] = rt2;
+        A[ 0 ]       = cs1;
+        A[ 1 ]       = sn1;
+        A[ lda ]     = -blas::conj( sn1 );
+        A[ 1 + lda ] = cs1;
+    }
+    else {
+        W[ 0 ] = rt2;
+        W[ 1 ] = rt1;
+        A[ 0 ]       = -blas::conj( sn1 );
+        A[ 1 ]       = cs1;
+        A[ lda ]     = cs1;
+        A[ 1 + lda ] = sn1;
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Closed-form eigenvalues of a 3-by-3 Hermitian matrix, from the
+/// trigonometric solution of its characteristic polynomial, after
+/// shifting by the mean eigenvalue and scaling.
+/// Eigenvalues are returned in ascending order.
+///
+/// The error in phi = acos( r ) / 3 grows like eps / sqrt( 1 - r^2 ),
+/// up to O( sqrt( eps ) ) for a repeated eigenvalue, where |r| = 1.
+/// To keep absolute accuracy O( eps ||A|| ), as for LAPACK heevd,
+/// this gives up if r^2 > r2_max.
+///
+/// @return true if W was computed; false if the caller should use
+///         another method.
+///
+template <typename scalar_t>
+inline bool heev_3x3_values(
+    lapack::Uplo uplo,
+    scalar_t const* A, int64_t lda,
+    blas::real_type< scalar_t >* W )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    const real_t pi = 3.14159265358979323846;
+    const real_t r2_max = 0.75;
+
+    scalar_t a01, a02, a12;
+    if (uplo == Uplo::Upper) {
+        a01 = A[ lda ];
+        a02 = A[ 2*lda ];
+        a12 = A[ 1 + 2*lda ];
+    }
+    else {
+        a01 = blas::conj( A[ 1 ] );
+        a02 = blas::conj( A[ 2 ] );
+        a12 = blas::conj( A[ 2 + lda ] );
+    }
+
+    // B = A - q I, where q is the mean eigenvalue. The trigonometric
+    // solution assumes trace( B ) = 0, so shift again by the residual
+    // trace left by rounding q, which matters when |q| >> ||B||.
+    real_t q = (std::real( A[ 0 ] ) + std::real( A[ 1 + lda ] )
+                + std::real( A[ 2 + 2*lda ] )) / 3;
+    real_t b00 = std::real( A[ 0 ] ) - q;
+    real_t b11 = std::real( A[ 1 + lda ] ) - q;
+    real_t b22 = std::real( A[ 2 + 2*lda ] ) - q;
+    real_t dq = (b00 + b11 + b22) / 3;
+    b00 -= dq;
+    b11 -= dq;
+    b22 -= dq;
+    real_t n01 = std::real( blas::conj( a01 ) * a01 );
+    real_t n02 = std::real( blas::conj( a02 ) * a02 );
+    real_t n12 = std::real( blas::conj( a12 ) * a12 );
+
+    // p^2 = ||B||_F^2 / 6; if p = 0, A = q I.
+    real_t p = std::sqrt( (b00*b00 + b11*b11 + b22*b22
+                           + 2*(n01 + n02 + n12)) / 6 );
+    if (p == 0) {
+        W[ 0 ] = W[ 1 ] = W[ 2 ] = q + dq;
+        return true;
+    }
+
+    // r = det( B / p ) / 2, computed on scaled entries to avoid overflow.
+    real_t rp = 1 / p;
+    b00 *= rp;
+    b11 *= rp;
+    b22 *= rp;
+    real_t rp2 = rp*rp;
+    real_t r = (b00*b11*b22
+                + 2*std::real( a01*a12*blas::conj( a02 ) )*rp2*rp
+                - b00*n12*rp2 - b11*n02*rp2 - b22*n01*rp2) / 2;
+    if (r*r > r2_max)
+        return false;
+
+    // Roots are q + 2 p cos( phi + 2 pi k / 3 ), for k = 0, 1, 2.
+    // Computing the middle one as trace( A ) - w0 - w2 loses accuracy
+    // when |q| >> p.
+    real_t phi = std::acos( r ) / 3;
+    real_t w2 = q + (dq + 2*p*std::cos( phi ));
+    real_t w1 = q + (dq + 2*p*std::cos( phi + 4*pi/3 ));
+    real_t w0 = q + (dq + 2*p*std::cos( phi + 2*pi/3 ));
+    W[ 0 ] = w0;
+    W[ 1 ] = blas::min( blas::max( w1, w0 ), w2 );
+    W[ 2 ] = w2;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+/// Cyclic Jacobi eigensolver for a small Hermitian matrix.
+/// Copies the uplo triangle to the full n-by-n Hermitian matrix in work,
+/// then applies complex Jacobi rotations
+///
+///     J = [   c           s e ]
+///         [ -s conj(e)    c   ],  e = a_pq / |a_pq|,
+///
+/// that zero a_pq, until the off-diagonal part is O( eps ||A||_F ).
+/// Eigenvalues are returned in ascending order. If jobz = Vec, A is
+/// overwritten by the eigenvectors.
+///
+/// @param[out] work
+///     Workspace of length 2*n*n.
+///
+/// @return 0 if converged, or n if not converged after max_sweeps.
+///
+template <typename scalar_t>
+inline int64_t heev_jacobi(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda,
+    blas::real_type< scalar_t >* W,
+    scalar_t* work )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    const int max_sweeps = 30;
+    const real_t eps = std::numeric_limits< real_t >::epsilon();
+    const real_t theta_max = 1 / eps;
+    const bool wantz = (jobz == Job::Vec);
+
+    scalar_t* a = work;
+    scalar_t* v = work + n*n;
+
+    // Copy to full Hermitian matrix a.
+    real_t norm2 = 0;
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = 0; i < j; ++i) {
+            scalar_t aij = (uplo == Uplo::Upper ? A[ i + j*lda ]
+                                                : blas::conj( A[ j + i*lda ] ));
+            a[ i + j*n ] = aij;
+            a[ j + i*n ] = blas::conj( aij );
+            norm2 += 2*std::real( blas::conj( aij ) * aij );
+        }
+        real_t ajj = std::real( A[ j + j*lda ] );
+        a[ j + j*n ] = ajj;
+        norm2 += ajj*ajj;
+    }
+    if (wantz) {
+        for (int64_t j = 0; j < n; ++j)
+            for (int64_t i = 0; i < n; ++i)
+                v[ i + j*n ] = (i == j ? 1 : 0);
+    }
+    real_t tol2 = eps*eps*norm2;
+
+    int64_t info = n;
+    for (int sweep = 0; sweep < max_sweeps; ++sweep) {
+        real_t off2 = 0;
+        for (int64_t q = 1; q < n; ++q)
+            for (int64_t p = 0; p < q; ++p)
+                off2 += std::real( blas::conj( a[ p + q*n ] ) * a[ p + q*n ] );
+        if (off2 <= tol2) {
+            info = 0;
+            break;
+        }
+
+        for (int64_t q = 1; q < n; ++q) {
+            for (int64_t p = 0; p < q; ++p) {
+                scalar_t apq = a[ p + q*n ];
+                real_t abs_apq2 = std::real( blas::conj( apq ) * apq );
+                if (abs_apq2 == 0)
+                    continue;
+                // std::abs and std::hypot are much slower than sqrt.
+                real_t abs_apq = std::sqrt( abs_apq2 );
+
+                // t = tan of the rotation angle; for large theta,
+                // t = 1/(2 theta) avoids overflow in theta^2.
+                real_t app = std::real( a[ p + p*n ] );
+                real_t aqq = std::real( a[ q + q*n ] );
+                real_t theta = (aqq - app) / (2*abs_apq);
+                real_t t;
+                if (std::abs( theta ) < theta_max)
+                    t = 1 / (std::abs( theta ) + std::sqrt( 1 + theta*theta ));
+                else
+                    t = 1 / (2*std::abs( theta ));
+                if (theta < 0)
+                    t = -t;
+                real_t c = 1 / std::sqrt( 1 + t*t );
+                real_t s = t*c;
+                scalar_t e = apq / abs_apq;
+                scalar_t se  = s*e;
+                scalar_t sce = s*blas::conj( e );
+
+                // a = J^H a J. Update columns p and q, and mirror them
+                // to rows p and q, since a stays Hermitian.
+                scalar_t* ap = &a[ p*n ];
+                scalar_t* aq = &a[ q*n ];
+                for (int64_t k = 0; k < n; ++k) {
+                    scalar_t akp = ap[ k ];
+                    scalar_t akq = aq[ k ];
+                    ap[ k ] = c*akp - sce*akq;
+                    aq[ k ] = se*akp + c*akq;
+                    a[ p + k*n ] = blas::conj( ap[ k ] );
+                    a[ q + k*n ] = blas::conj( aq[ k ] );
+                }
+                a[ p + p*n ] = app - t*abs_apq;
+                a[ q + q*n ] = aqq + t*abs_apq;
+                a[ p + q*n ] = 0;
+                a[ q + p*n ] = 0;
+
+                if (wantz) {
+                    scalar_t* vp = &v[ p*n ];
+                    scalar_t* vq = &v[ q*n ];
+                    for (int64_t k = 0; k < n; ++k) {
+                        scalar_t vkp = vp[ k ];
+                        scalar_t vkq = vq[ k ];
+                        vp[ k ] = c*vkp - sce*vkq;
+                        vq[ k ] = se*vkp + c*vkq;
+                    }
+                }
+            }
+        }
+    }
+
+    for (int64_t j = 0; j < n; ++j)
+        W[ j ] = std::real( a[ j + j*n ] );
+
+    // Selection sort into ascending order, moving eigenvectors along.
+    for (int64_t j = 0; j < n - 1; ++j) {
+        int64_t k = j;
+        for (int64_t i = j + 1; i < n; ++i) {
+            if (W[ i ] < W[ k ])
+                k = i;
+        }
+        if (k != j) {
+            std::swap( W[ j ], W[ k ] );
+            if (wantz) {
+                for (int64_t i = 0; i < n; ++i)
+                    std::swap( v[ i + j*n ], v[ i + k*n ] );
+            }
+        }
+    }
+
+    if (wantz) {
+        for (int64_t j = 0; j < n; ++j)
+            for (int64_t i = 0; i < n; ++i)
+                A[ i + j*lda ] = v[ i + j*n ];
+    }
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// @return true if batched eigensolvers should use heev_native.
+///
+inline bool heev_use_native( lapack::Job jobz, int64_t n )
+{
+    return n <= (jobz == Job::Vec ? heev_native_max : heev_native_novec_max);
+}
+
+//------------------------------------------------------------------------------
+/// Native Hermitian eigensolver for small n; see heev_use_native.
+/// Uses closed forms for n <= 2, and for n = 3 without eigenvectors;
+/// otherwise uses heev_jacobi.
+/// Returns info as in LAPACK heevd.
+///
+/// @param[out] work
+///     Workspace of length 2*n*n.
+///
+template <typename scalar_t>
+inline int64_t heev_native(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda,
+    blas::real_type< scalar_t >* W,
+    scalar_t* work )
+{
+    switch (n) {
+        case 0:
+            return 0;
+
+        case 1:
+            W[ 0 ] = std::real( A[ 0 ] );
+            if (jobz == Job::Vec)
+                A[ 0 ] = 1;
+            return 0;
+
+        case 2:
+            heev_2x2( jobz, uplo, A, lda, W );
+            return 0;
+
+        case 3:
+            if (jobz == Job::NoVec && heev_3x3_values( uplo, A, lda, W ))
+                return 0;
+            return heev_jacobi( jobz, uplo, 3, A, lda, W, work );
+
+        // Constant n lets the compiler unroll the inner loops.
+        case 4: return heev_jacobi( jobz, uplo, 4, A, lda, W, work );
+        case 5: return heev_jacobi( jobz, uplo, 5, A, lda, W, work );
+        case 6: return heev_jacobi( jobz, uplo, 6, A, lda, W, work );
+        default: return heev_jacobi( jobz, uplo, n, A, lda, W, work );
+    }
+}
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_HEEVD_NATIVE_HH
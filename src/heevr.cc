@@ -26,69 +26,22 @@ int64_t heevr(
     std::complex<float>* Z, int64_t ldz,
     int64_t* isuppz )
 {
-    char jobz_ = to_char( jobz );
-    char range_ = to_char( range );
-    char uplo_ = to_char( uplo );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int il_ = to_lapack_int( il );
-    lapack_int iu_ = to_lapack_int( iu );
-    lapack_int nfound_ = 0;  // out
-    lapack_int ldz_ = to_lapack_int( ldz );
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > isuppz_( (2*max( 1, n )) );  // was max(1,nfound), n >= nfound
-        lapack_int* isuppz_ptr = &isuppz_[0];
-    #else
-        lapack_int* isuppz_ptr = isuppz;
-    #endif
-    lapack_int info_ = 0;
-
     // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cheevr(
-        &jobz_, &range_, &uplo_, &n_,
-        (lapack_complex_float*) A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
-        W,
-        (lapack_complex_float*) Z, &ldz_,
-        isuppz_ptr,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork, &ineg_one,
-        qry_iwork, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = real(qry_rwork[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    int64_t lwork, lrwork, liwork;
+    heevr_work_size(
+        jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, nfound, W, Z, ldz,
+        isuppz,
+        &lwork, &lrwork, &liwork );
 
     // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+    lapack::vector< int64_t > iwork( liwork );
 
-    LAPACK_cheevr(
-        &jobz_, &range_, &uplo_, &n_,
-        (lapack_complex_float*) A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
-        W,
-        (lapack_complex_float*) Z, &ldz_,
-        isuppz_ptr,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0], &lrwork_,
-        &iwork[0], &liwork_, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *nfound = nfound_;
-    #ifndef LAPACK_ILP64
-        std::copy( isuppz_.begin(), isuppz_.end(), isuppz );
-    #endif
-    return info_;
+    return heevr(
+        jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, nfound, W, Z, ldz,
+        isuppz,
+        &work[0], lwork, &rwork[0], lrwork, &iwork[0], liwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -294,6 +247,40 @@ int64_t heevr(
     std::complex<double>* Z, int64_t ldz,
     int64_t* isuppz )
 {
+    // query for workspace size
+    int64_t lwork, lrwork, liwork;
+    heevr_work_size(
+        jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, nfound, W, Z, ldz,
+        isuppz,
+        &lwork, &lrwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+    lapack::vector< int64_t > iwork( liwork );
+
+    return heevr(
+        jobz, range, uplo, n, A, lda, vl, vu, il, iu, abstol, nfound, W, Z, ldz,
+        isuppz,
+        &work[0], lwork, &rwork[0], lrwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup heev
+void heevr_work_size(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* isuppz,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
+{
+    auto key = internal::work_size_key(
+        "cheevr", jobz, range, uplo, n, lda, il, iu, ldz );
+    if (internal::work_size_cache_find( key, lwork, lrwork, liwork ))
+        return;
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     char uplo_ = to_char( uplo );
@@ -303,16 +290,80 @@ int64_t heevr(
     lapack_int iu_ = to_lapack_int( iu );
     lapack_int nfound_ = 0;  // out
     lapack_int ldz_ = to_lapack_int( ldz );
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > isuppz_( (2*max( 1, n )) );  // was max(1,nfound), n >= nfound
-        lapack_int* isuppz_ptr = &isuppz_[0];
-    #else
-        lapack_int* isuppz_ptr = isuppz;
-    #endif
+    lapack_int* isuppz_ptr = reinterpret_cast< lapack_int* >( isuppz );  // not referenced
+    lapack_int info_ = 0;
+
+    std::complex<float> qry_work[1];
+    float qry_rwork[1];
+    lapack_int qry_iwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_cheevr(
+        &jobz_, &range_, &uplo_, &n_,
+        (lapack_complex_float*) A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
+        W,
+        (lapack_complex_float*) Z, &ldz_,
+        isuppz_ptr,
+        (lapack_complex_float*) qry_work, &ineg_one,
+        qry_rwork, &ineg_one,
+        qry_iwork, &ineg_one, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    *lrwork = real(qry_rwork[0]);
+    *liwork = real(qry_iwork[0]);
+    internal::work_size_cache_insert( key, *lwork, *lrwork, *liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::heevr with caller-provided workspace.
+/// Returns the array lengths that the workspace overload of `heevr`
+/// requires, so the workspace can be allocated once, outside a loop.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+/// For real matrices, this is an alias for `lapack::syevr`.
+///
+/// Other arguments are the same as for lapack::heevr.
+/// Arrays are used only to select the precision and are not referenced.
+///
+/// @param[out] lwork
+///     The optimal length of the array work.
+///
+/// @param[out] lrwork
+///     The optimal length of the array rwork.
+///
+/// @param[out] liwork
+///     The optimal length of the array iwork.
+///
+/// @ingroup heev
+void heevr_work_size(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* isuppz,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
+{
+    auto key = internal::work_size_key(
+        "zheevr", jobz, range, uplo, n, lda, il, iu, ldz );
+    if (internal::work_size_cache_find( key, lwork, lrwork, liwork ))
+        return;
+
+    char jobz_ = to_char( jobz );
+    char range_ = to_char( range );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int il_ = to_lapack_int( il );
+    lapack_int iu_ = to_lapack_int( iu );
+    lapack_int nfound_ = 0;  // out
+    lapack_int ldz_ = to_lapack_int( ldz );
+    lapack_int* isuppz_ptr = reinterpret_cast< lapack_int* >( isuppz );  // not referenced
     lapack_int info_ = 0;
 
-    // query for workspace size
     std::complex<double> qry_work[1];
     double qry_rwork[1];
     lapack_int qry_iwork[1];
@@ -330,14 +381,138 @@ int64_t heevr(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = real(qry_rwork[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    *lwork = real(qry_work[0]);
+    *lrwork = real(qry_rwork[0]);
+    *liwork = real(qry_iwork[0]);
+    internal::work_size_cache_insert( key, *lwork, *lrwork, *liwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup heev
+int64_t heevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* isuppz,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork )
+{
+    char jobz_ = to_char( jobz );
+    char range_ = to_char( range );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int il_ = to_lapack_int( il );
+    lapack_int iu_ = to_lapack_int( iu );
+    lapack_int nfound_ = 0;  // out
+    lapack_int ldz_ = to_lapack_int( ldz );
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > isuppz_( (2*max( 1, n )) );  // was max(1,nfound), n >= nfound
+        lapack_int* isuppz_ptr = &isuppz_[0];
+    #else
+        lapack_int* isuppz_ptr = isuppz;
+    #endif
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "heevr", std::complex<float>, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int lrwork_ = to_lapack_int( lrwork );
+    lapack_int liwork_ = to_lapack_int( liwork );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
+
+    LAPACK_cheevr(
+        &jobz_, &range_, &uplo_, &n_,
+        (lapack_complex_float*) A, &lda_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
+        W,
+        (lapack_complex_float*) Z, &ldz_,
+        isuppz_ptr,
+        (lapack_complex_float*) work, &lwork_,
+        rwork, &lrwork_,
+        iwork_, &liwork_, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *nfound = nfound_;
+    #ifndef LAPACK_ILP64
+        std::copy( isuppz_.begin(), isuppz_.end(), isuppz );
+    #endif
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::heevr that takes caller-provided workspace
+/// instead of querying and allocating it on each call.
+/// Use lapack::heevr_work_size to get the required lengths.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+/// For real matrices, this is an alias for `lapack::syevr`.
+///
+/// Other arguments are the same as for lapack::heevr.
+///
+/// @param[out] work
+///     The vector work of length lwork. Workspace.
+///
+/// @param[in] lwork
+///     The length of the array work.
+///     Use the value from lapack::heevr_work_size for best performance.
+///
+/// @param[out] rwork
+///     The vector rwork of length lrwork. Workspace.
+///
+/// @param[in] lrwork
+///     The length of the array rwork.
+///     Use the value from lapack::heevr_work_size for best performance.
+///
+/// @param[out] iwork
+///     The vector iwork of length liwork. Workspace.
+///     This is 64-bit for a uniform API; with 32-bit LAPACK integers,
+///     only the first half of its bytes are used.
+///
+/// @param[in] liwork
+///     The length of the array iwork.
+///     Use the value from lapack::heevr_work_size for best performance.
+///
+/// @ingroup heev
+int64_t heevr(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* isuppz,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork )
+{
+    char jobz_ = to_char( jobz );
+    char range_ = to_char( range );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int il_ = to_lapack_int( il );
+    lapack_int iu_ = to_lapack_int( iu );
+    lapack_int nfound_ = 0;  // out
+    lapack_int ldz_ = to_lapack_int( ldz );
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > isuppz_( (2*max( 1, n )) );  // was max(1,nfound), n >= nfound
+        lapack_int* isuppz_ptr = &isuppz_[0];
+    #else
+        lapack_int* isuppz_ptr = isuppz;
+    #endif
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "heevr", std::complex<double>, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int lrwork_ = to_lapack_int( lrwork );
+    lapack_int liwork_ = to_lapack_int( liwork );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
 
     LAPACK_zheevr(
         &jobz_, &range_, &uplo_, &n_,
@@ -345,9 +520,9 @@ int64_t heevr(
         W,
         (lapack_complex_double*) Z, &ldz_,
         isuppz_ptr,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0], &lrwork_,
-        &iwork[0], &liwork_, &info_
+        (lapack_complex_double*) work, &lwork_,
+        rwork, &lrwork_,
+        iwork_, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
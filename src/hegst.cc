@@ -27,6 +27,7 @@ int64_t hegst(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hegst", std::complex<float>, 0, n, 0, 0, info_ );
 
     LAPACK_chegst(
         &itype_, &uplo_, &n_,
@@ -51,6 +52,7 @@ int64_t hegst(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hegst", std::complex<double>, 0, n, 0, 0, info_ );
 
     LAPACK_zhegst(
         &itype_, &uplo_, &n_,
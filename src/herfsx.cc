@@ -52,6 +52,7 @@ int64_t herfsx(
     lapack_int n_err_bnds_ = to_lapack_int( n_err_bnds );
     lapack_int nparams_ = to_lapack_int( nparams );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "herfsx", std::complex<float>, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
@@ -384,6 +385,7 @@ int64_t herfsx(
     lapack_int n_err_bnds_ = to_lapack_int( n_err_bnds );
     lapack_int nparams_ = to_lapack_int( nparams );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "herfsx", std::complex<double>, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
@@ -28,46 +28,18 @@ int64_t hetrd_2stage(
     std::complex<float>* tau,
     std::complex<float>* hous2, int64_t lhous2 )
 {
-    char jobz_ = to_char( jobz );
-    char uplo_ = to_char( uplo );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int lhous2_ = to_lapack_int( lhous2 );
-    lapack_int info_ = 0;
-
     // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_chetrd_2stage(
-        &jobz_, &uplo_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        D,
-        E,
-        (lapack_complex_float*) tau,
-        (lapack_complex_float*) hous2, &lhous2_,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork;
+    hetrd_2stage_work_size(
+        jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2,
+        &lwork );
 
     // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+    lapack::vector< std::complex<float> > work( lwork );
 
-    LAPACK_chetrd_2stage(
-        &jobz_, &uplo_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        D,
-        E,
-        (lapack_complex_float*) tau,
-        (lapack_complex_float*) hous2, &lhous2_,
-        (lapack_complex_float*) &work[0], &lwork_, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return hetrd_2stage(
+        jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2,
+        &work[0], lwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -191,6 +163,87 @@ int64_t hetrd_2stage(
     std::complex<double>* tau,
     std::complex<double>* hous2, int64_t lhous2 )
 {
+    // query for workspace size
+    int64_t lwork;
+    hetrd_2stage_work_size(
+        jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+
+    return hetrd_2stage(
+        jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup heev_computational
+void hetrd_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* D,
+    float* E,
+    std::complex<float>* tau,
+    std::complex<float>* hous2, int64_t lhous2,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "chetrd_2stage", jobz, uplo, n, lda, lhous2 );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    char jobz_ = to_char( jobz );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int lhous2_ = to_lapack_int( lhous2 );
+    lapack_int info_ = 0;
+
+    std::complex<float> qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_chetrd_2stage(
+        &jobz_, &uplo_, &n_,
+        (lapack_complex_float*) A, &lda_,
+        D,
+        E,
+        (lapack_complex_float*) tau,
+        (lapack_complex_float*) hous2, &lhous2_,
+        (lapack_complex_float*) qry_work, &ineg_one, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::hetrd_2stage with caller-provided workspace.
+/// Returns the array lengths that the workspace overload of `hetrd_2stage`
+/// requires, so the workspace can be allocated once, outside a loop.
+///
+/// Other arguments are the same as for lapack::hetrd_2stage.
+/// Arrays are used only to select the precision and are not referenced.
+///
+/// @param[out] lwork
+///     The optimal length of the array work.
+///
+/// @ingroup heev_computational
+void hetrd_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* D,
+    double* E,
+    std::complex<double>* tau,
+    std::complex<double>* hous2, int64_t lhous2,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "zhetrd_2stage", jobz, uplo, n, lda, lhous2 );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -198,7 +251,6 @@ int64_t hetrd_2stage(
     lapack_int lhous2_ = to_lapack_int( lhous2 );
     lapack_int info_ = 0;
 
-    // query for workspace size
     std::complex<double> qry_work[1];
     lapack_int ineg_one = -1;
     LAPACK_zhetrd_2stage(
@@ -213,10 +265,77 @@ int64_t hetrd_2stage(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup heev_computational
+int64_t hetrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* D,
+    float* E,
+    std::complex<float>* tau,
+    std::complex<float>* hous2, int64_t lhous2,
+    std::complex<float>* work, int64_t lwork )
+{
+    char jobz_ = to_char( jobz );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int lhous2_ = to_lapack_int( lhous2 );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hetrd_2stage", std::complex<float>, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+
+    LAPACK_chetrd_2stage(
+        &jobz_, &uplo_, &n_,
+        (lapack_complex_float*) A, &lda_,
+        D,
+        E,
+        (lapack_complex_float*) tau,
+        (lapack_complex_float*) hous2, &lhous2_,
+        (lapack_complex_float*) work, &lwork_, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::hetrd_2stage that takes caller-provided workspace
+/// instead of querying and allocating it on each call.
+/// Use lapack::hetrd_2stage_work_size to get the required lengths.
+///
+/// Other arguments are the same as for lapack::hetrd_2stage.
+///
+/// @param[out] work
+///     The vector work of length lwork. Workspace.
+///
+/// @param[in] lwork
+///     The length of the array work.
+///     Use the value from lapack::hetrd_2stage_work_size for best performance.
+///
+/// @ingroup heev_computational
+int64_t hetrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* D,
+    double* E,
+    std::complex<double>* tau,
+    std::complex<double>* hous2, int64_t lhous2,
+    std::complex<double>* work, int64_t lwork )
+{
+    char jobz_ = to_char( jobz );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int lhous2_ = to_lapack_int( lhous2 );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hetrd_2stage", std::complex<double>, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
     LAPACK_zhetrd_2stage(
         &jobz_, &uplo_, &n_,
@@ -225,7 +344,7 @@ int64_t hetrd_2stage(
         E,
         (lapack_complex_double*) tau,
         (lapack_complex_double*) hous2, &lhous2_,
-        (lapack_complex_double*) &work[0], &lwork_, &info_
+        (lapack_complex_double*) work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
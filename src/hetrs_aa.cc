@@ -40,6 +40,7 @@ int64_t hetrs_aa(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int lwork_ = max( 1, 3*n-2 );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hetrs_aa", std::complex<float>, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<float> > work( (max(1,lwork_)) );
@@ -122,6 +123,7 @@ int64_t hetrs_aa(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int lwork_ = max( 1, 3*n-2 );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hetrs_aa", std::complex<double>, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (max(1,lwork_)) );
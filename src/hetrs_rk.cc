@@ -40,6 +40,7 @@ int64_t hetrs_rk(
     #endif
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hetrs_rk", std::complex<float>, 0, n, 0, nrhs, info_ );
 
     LAPACK_chetrs_3(
         &uplo_, &n_, &nrhs_,
@@ -165,6 +166,7 @@ int64_t hetrs_rk(
     #endif
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hetrs_rk", std::complex<double>, 0, n, 0, nrhs, info_ );
 
     LAPACK_zhetrs_3(
         &uplo_, &n_, &nrhs_,
@@ -39,6 +39,7 @@ int64_t hetrs_rook(
     #endif
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hetrs_rook", std::complex<float>, 0, n, 0, nrhs, info_ );
 
     LAPACK_chetrs_rook(
         &uplo_, &n_, &nrhs_,
@@ -75,6 +76,7 @@ int64_t hetrs_rook(
     #endif
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hetrs_rook", std::complex<double>, 0, n, 0, nrhs, info_ );
 
     LAPACK_zhetrs_rook(
         &uplo_, &n_, &nrhs_,
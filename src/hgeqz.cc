@@ -37,6 +37,7 @@ int64_t hgeqz(
     lapack_int ldq_ = to_lapack_int( ldq );
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hgeqz", std::complex<float>, 0, n, 0, 0, info_ );
 
     // split-complex representation
     lapack::vector< float > alphar( max( 1, n ) );
@@ -106,6 +107,7 @@ int64_t hgeqz(
     lapack_int ldq_ = to_lapack_int( ldq );
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hgeqz", std::complex<double>, 0, n, 0, 0, info_ );
 
     // split-complex representation
     lapack::vector< double > alphar( max( 1, n ) );
@@ -175,6 +177,7 @@ int64_t hgeqz(
     lapack_int ldq_ = to_lapack_int( ldq );
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hgeqz", std::complex<float>, 0, n, 0, 0, info_ );
 
     // query for workspace size
     std::complex<float> qry_work[1];
@@ -238,6 +241,7 @@ int64_t hgeqz(
     lapack_int ldq_ = to_lapack_int( ldq );
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hgeqz", std::complex<double>, 0, n, 0, 0, info_ );
 
     // query for workspace size
     std::complex<double> qry_work[1];
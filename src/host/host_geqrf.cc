@@ -3,17 +3,18 @@
 // This program is free software: you can redistribute it and/or modify it under
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
-#include "lapack/defines.h"
+#include "lapack/device.hh"
 
-#if ! (defined(LAPACK_HAVE_ROCBLAS) || defined(LAPACK_HAVE_CUBLAS) || defined(LAPACK_HAVE_SYCL))
+#if defined(LAPACK_HAVE_HOST_QUEUE)
 
-#include "lapack/device.hh"
+#include "lapack.hh"
 
 //==============================================================================
 namespace lapack {
 
 //------------------------------------------------------------------------------
-// Wrapper around workspace query.
+// Wrapper around host LAPACK workspace query. The device workspace
+// holds the LAPACK work array.
 // dA is only for templating scalar_t; it isn't referenced.
 template <typename scalar_t>
 void geqrf_work_size_bytes(
@@ -22,13 +23,16 @@ void geqrf_work_size_bytes(
     size_t* dev_work_size, size_t* host_work_size,
     lapack::Queue& queue )
 {
-    *dev_work_size  = 0;
+    // dA serves as dummy tau; the query references neither.
+    int64_t lwork;
+    lapack::geqrf_work_size( m, n, dA, blas::max( 1, ldda ), dA, &lwork );
+    *dev_work_size = blas::max( 1, lwork ) * sizeof(scalar_t);
     *host_work_size = 0;
 }
 
 //------------------------------------------------------------------------------
-// Wrapper stub.
-// This is async. Once finished, the return info is in dev_info on the device.
+// Wrapper around host LAPACK, run on the queue's thread.
+// This is async. Once finished, the return info is in dev_info.
 template <typename scalar_t>
 void geqrf(
     int64_t m, int64_t n,
@@ -37,7 +41,16 @@ void geqrf(
     void* host_work, size_t host_work_size,
     device_info_int* dev_info, lapack::Queue& queue )
 {
-    throw lapack::Error( "device LAPACK not available", __func__ );
+    int64_t lwork = dev_work_size / sizeof(scalar_t);
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( ldda < blas::max( 1, m ) );
+    lapack_error_if( lwork < blas::max( 1, n ) );
+
+    queue.submit( [=]() {
+        *dev_info = lapack::geqrf( m, n, dA, ldda, dtau,
+                                   (scalar_t*) dev_work, lwork );
+    } );
 }
 
 //------------------------------------------------------------------------------
@@ -105,4 +118,4 @@ void geqrf(
 
 } // namespace lapack
 
-#endif // ! (LAPACK_HAVE_ROCBLAS || LAPACK_HAVE_CUBLAS || LAPACK_HAVE_SYCL)
+#endif // LAPACK_HAVE_HOST_QUEUE
@@ -0,0 +1,277 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/device.hh"
+
+#if defined(LAPACK_HAVE_HOST_QUEUE)
+
+#include "lapack.hh"
+
+//==============================================================================
+namespace lapack {
+
+//------------------------------------------------------------------------------
+// Overloaded wrappers to deal with real gesvd having no rwork.
+static void host_gesvd_work_size(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    float* dA, int64_t ldda, float* dS,
+    float* dU, int64_t lddu, float* dVT, int64_t lddvt,
+    int64_t* lwork, int64_t* lrwork )
+{
+    lapack::gesvd_work_size( jobu, jobvt, m, n, dA, ldda, dS,
+                             dU, lddu, dVT, lddvt, lwork );
+    *lrwork = 0;
+}
+
+//----------
+static void host_gesvd_work_size(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    double* dA, int64_t ldda, double* dS,
+    double* dU, int64_t lddu, double* dVT, int64_t lddvt,
+    int64_t* lwork, int64_t* lrwork )
+{
+    lapack::gesvd_work_size( jobu, jobvt, m, n, dA, ldda, dS,
+                             dU, lddu, dVT, lddvt, lwork );
+    *lrwork = 0;
+}
+
+//----------
+static void host_gesvd_work_size(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<float>* dA, int64_t ldda, float* dS,
+    std::complex<float>* dU, int64_t lddu,
+    std::complex<float>* dVT, int64_t lddvt,
+    int64_t* lwork, int64_t* lrwork )
+{
+    lapack::gesvd_work_size( jobu, jobvt, m, n, dA, ldda, dS,
+                             dU, lddu, dVT, lddvt, lwork, lrwork );
+}
+
+//----------
+static void host_gesvd_work_size(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<double>* dA, int64_t ldda, double* dS,
+    std::complex<double>* dU, int64_t lddu,
+    std::complex<double>* dVT, int64_t lddvt,
+    int64_t* lwork, int64_t* lrwork )
+{
+    lapack::gesvd_work_size( jobu, jobvt, m, n, dA, ldda, dS,
+                             dU, lddu, dVT, lddvt, lwork, lrwork );
+}
+
+//------------------------------------------------------------------------------
+static int64_t host_gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    float* dA, int64_t ldda, float* dS,
+    float* dU, int64_t lddu, float* dVT, int64_t lddvt,
+    float* work, int64_t lwork,
+    float* rwork, int64_t lrwork )
+{
+    return lapack::gesvd( jobu, jobvt, m, n, dA, ldda, dS,
+                          dU, lddu, dVT, lddvt, work, lwork );
+}
+
+//----------
+static int64_t host_gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    double* dA, int64_t ldda, double* dS,
+    double* dU, int64_t lddu, double* dVT, int64_t lddvt,
+    double* work, int64_t lwork,
+    double* rwork, int64_t lrwork )
+{
+    return lapack::gesvd( jobu, jobvt, m, n, dA, ldda, dS,
+                          dU, lddu, dVT, lddvt, work, lwork );
+}
+
+//----------
+static int64_t host_gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<float>* dA, int64_t ldda, float* dS,
+    std::complex<float>* dU, int64_t lddu,
+    std::complex<float>* dVT, int64_t lddvt,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork )
+{
+    return lapack::gesvd( jobu, jobvt, m, n, dA, ldda, dS,
+                          dU, lddu, dVT, lddvt, work, lwork, rwork, lrwork );
+}
+
+//----------
+static int64_t host_gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<double>* dA, int64_t ldda, double* dS,
+    std::complex<double>* dU, int64_t lddu,
+    std::complex<double>* dVT, int64_t lddvt,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork )
+{
+    return lapack::gesvd( jobu, jobvt, m, n, dA, ldda, dS,
+                          dU, lddu, dVT, lddvt, work, lwork, rwork, lrwork );
+}
+
+//------------------------------------------------------------------------------
+// The device workspace holds the LAPACK work and rwork arrays,
+// in that order, rwork starting at a multiple of 64 bytes.
+const size_t host_gesvd_align = 64;
+
+static inline size_t host_gesvd_round_up( size_t bytes )
+{
+    return (bytes + host_gesvd_align - 1) / host_gesvd_align * host_gesvd_align;
+}
+
+//------------------------------------------------------------------------------
+// Wrapper around host LAPACK workspace query.
+// dA, dS, dU, dVT are only for templating scalar_t; they aren't referenced.
+template <typename scalar_t>
+void gesvd_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    scalar_t* dA, int64_t ldda, blas::real_type<scalar_t>* dS,
+    scalar_t* dU, int64_t lddu,
+    scalar_t* dVT, int64_t lddvt,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue )
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    int64_t lwork, lrwork;
+    host_gesvd_work_size( jobu, jobvt, m, n, dA, blas::max( 1, ldda ), dS,
+                          dU, blas::max( 1, lddu ), dVT, blas::max( 1, lddvt ),
+                          &lwork, &lrwork );
+    *dev_work_size = host_gesvd_round_up( lwork * sizeof(scalar_t) )
+                   + lrwork * sizeof(real_t);
+    *host_work_size = 0;
+}
+
+//------------------------------------------------------------------------------
+// Wrapper around host LAPACK, run on the queue's thread.
+// This is async. Once finished, the return info is in dev_info.
+template <typename scalar_t>
+void gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    scalar_t* dA, int64_t ldda, blas::real_type<scalar_t>* dS,
+    scalar_t* dU, int64_t lddu,
+    scalar_t* dVT, int64_t lddvt,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    auto valid_job = []( lapack::Job job ) {
+        return job == Job::AllVec || job == Job::SomeVec
+            || job == Job::OverwriteVec || job == Job::NoVec;
+    };
+    int64_t min_mn = blas::min( m, n );
+    lapack_error_if( ! valid_job( jobu ) );
+    lapack_error_if( ! valid_job( jobvt ) );
+    lapack_error_if( jobu == Job::OverwriteVec && jobvt == Job::OverwriteVec );
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( ldda < blas::max( 1, m ) );
+    lapack_error_if( lddu < 1 ||
+                     ((jobu == Job::AllVec || jobu == Job::SomeVec)
+                      && lddu < m) );
+    lapack_error_if( lddvt < 1 ||
+                     (jobvt == Job::AllVec && lddvt < n) ||
+                     (jobvt == Job::SomeVec && lddvt < min_mn) );
+
+    // Split the workspace, as in gesvd_work_size_bytes.
+    int64_t lwork, lrwork;
+    host_gesvd_work_size( jobu, jobvt, m, n, dA, ldda, dS,
+                          dU, lddu, dVT, lddvt, &lwork, &lrwork );
+    size_t rwork_offset = host_gesvd_round_up( lwork * sizeof(scalar_t) );
+    lapack_error_if( dev_work_size < rwork_offset + lrwork * sizeof(real_t) );
+
+    char* work = (char*) dev_work;
+    queue.submit( [=]() {
+        *dev_info = host_gesvd(
+            jobu, jobvt, m, n, dA, ldda, dS, dU, lddu, dVT, lddvt,
+            (scalar_t*) work, lwork,
+            (real_t*)   (work + rwork_offset), lrwork );
+    } );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void gesvd_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    float* dA, int64_t ldda, float* dS,
+    float* dU, int64_t lddu,
+    float* dVT, int64_t lddvt,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void gesvd_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    double* dA, int64_t ldda, double* dS,
+    double* dU, int64_t lddu,
+    double* dVT, int64_t lddvt,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void gesvd_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<float>* dA, int64_t ldda, float* dS,
+    std::complex<float>* dU, int64_t lddu,
+    std::complex<float>* dVT, int64_t lddvt,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void gesvd_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<double>* dA, int64_t ldda, double* dS,
+    std::complex<double>* dU, int64_t lddu,
+    std::complex<double>* dVT, int64_t lddvt,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+//--------------------
+template
+void gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    float* dA, int64_t ldda, float* dS,
+    float* dU, int64_t lddu,
+    float* dVT, int64_t lddvt,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    double* dA, int64_t ldda, double* dS,
+    double* dU, int64_t lddu,
+    double* dVT, int64_t lddvt,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<float>* dA, int64_t ldda, float* dS,
+    std::complex<float>* dU, int64_t lddu,
+    std::complex<float>* dVT, int64_t lddvt,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<double>* dA, int64_t ldda, double* dS,
+    std::complex<double>* dU, int64_t lddu,
+    std::complex<double>* dVT, int64_t lddvt,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+} // namespace lapack
+
+#endif // LAPACK_HAVE_HOST_QUEUE
@@ -3,17 +3,17 @@
 // This program is free software: you can redistribute it and/or modify it under
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
-#include "lapack/defines.h"
+#include "lapack/device.hh"
 
-#if ! (defined(LAPACK_HAVE_ROCBLAS) || defined(LAPACK_HAVE_CUBLAS) || defined(LAPACK_HAVE_SYCL))
+#if defined(LAPACK_HAVE_HOST_QUEUE)
 
-#include "lapack/device.hh"
+#include "lapack.hh"
 
 //==============================================================================
 namespace lapack {
 
 //------------------------------------------------------------------------------
-// Wrapper around workspace query.
+// Workspace query. getrf needs no workspace.
 // dA is only for templating scalar_t; it isn't referenced.
 template <typename scalar_t>
 void getrf_work_size_bytes(
@@ -22,22 +22,28 @@ void getrf_work_size_bytes(
     size_t* dev_work_size, size_t* host_work_size,
     lapack::Queue& queue )
 {
-    *dev_work_size  = 0;
+    *dev_work_size = 0;
     *host_work_size = 0;
 }
 
 //------------------------------------------------------------------------------
-// Wrapper stub.
-// This is async. Once finished, the return info is in dev_info on the device.
+// Wrapper around host LAPACK, run on the queue's thread.
+// This is async. Once finished, the return info is in dev_info.
 template <typename scalar_t>
 void getrf(
     int64_t m, int64_t n,
-    scalar_t* dA, int64_t ldda, device_pivot_int* dipiv,
+    scalar_t* dA, int64_t ldda, device_pivot_int* dev_ipiv,
     void*  dev_work, size_t  dev_work_size,
     void* host_work, size_t host_work_size,
     device_info_int* dev_info, lapack::Queue& queue )
 {
-    throw lapack::Error( "device LAPACK not available", __func__ );
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( ldda < blas::max( 1, m ) );
+
+    queue.submit( [=]() {
+        *dev_info = lapack::getrf( m, n, dA, ldda, dev_ipiv );
+    } );
 }
 
 //------------------------------------------------------------------------------
@@ -74,7 +80,7 @@ void getrf_work_size_bytes(
 template
 void getrf(
     int64_t m, int64_t n,
-    float* dA, int64_t ldda, device_pivot_int* dipiv,
+    float* dA, int64_t ldda, device_pivot_int* dev_ipiv,
     void*  dev_work, size_t  dev_work_size,
     void* host_work, size_t host_work_size,
     device_info_int* dev_info, lapack::Queue& queue );
@@ -82,7 +88,7 @@ void getrf(
 template
 void getrf(
     int64_t m, int64_t n,
-    double* dA, int64_t ldda, device_pivot_int* dipiv,
+    double* dA, int64_t ldda, device_pivot_int* dev_ipiv,
     void*  dev_work, size_t  dev_work_size,
     void* host_work, size_t host_work_size,
     device_info_int* dev_info, lapack::Queue& queue );
@@ -90,7 +96,7 @@ void getrf(
 template
 void getrf(
     int64_t m, int64_t n,
-    std::complex<float>* dA, int64_t ldda, device_pivot_int* dipiv,
+    std::complex<float>* dA, int64_t ldda, device_pivot_int* dev_ipiv,
     void*  dev_work, size_t  dev_work_size,
     void* host_work, size_t host_work_size,
     device_info_int* dev_info, lapack::Queue& queue );
@@ -98,11 +104,11 @@ void getrf(
 template
 void getrf(
     int64_t m, int64_t n,
-    std::complex<double>* dA, int64_t ldda, device_pivot_int* dipiv,
+    std::complex<double>* dA, int64_t ldda, device_pivot_int* dev_ipiv,
     void*  dev_work, size_t  dev_work_size,
     void* host_work, size_t host_work_size,
     device_info_int* dev_info, lapack::Queue& queue );
 
 } // namespace lapack
 
-#endif // ! (LAPACK_HAVE_ROCBLAS || LAPACK_HAVE_CUBLAS || LAPACK_HAVE_SYCL)
+#endif // LAPACK_HAVE_HOST_QUEUE
@@ -0,0 +1,236 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/device.hh"
+
+#if defined(LAPACK_HAVE_HOST_QUEUE)
+
+#include "lapack.hh"
+
+//==============================================================================
+namespace lapack {
+
+//------------------------------------------------------------------------------
+// Intermediate wrappers around host LAPACK to give real and complex
+// precisions the same interface. For real, there is no rwork.
+static void host_heevd_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* dA, int64_t ldda, float* dW,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
+{
+    lapack::syevd_work_size( jobz, uplo, n, dA, ldda, dW, lwork, liwork );
+    *lrwork = 0;
+}
+
+//----------
+static void host_heevd_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* dA, int64_t ldda, double* dW,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
+{
+    lapack::syevd_work_size( jobz, uplo, n, dA, ldda, dW, lwork, liwork );
+    *lrwork = 0;
+}
+
+//----------
+static void host_heevd_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* dA, int64_t ldda, float* dW,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
+{
+    lapack::heevd_work_size( jobz, uplo, n, dA, ldda, dW, lwork, lrwork, liwork );
+}
+
+//----------
+static void host_heevd_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* dA, int64_t ldda, double* dW,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
+{
+    lapack::heevd_work_size( jobz, uplo, n, dA, ldda, dW, lwork, lrwork, liwork );
+}
+
+//------------------------------------------------------------------------------
+static int64_t host_heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* dA, int64_t ldda, float* dW,
+    float* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork )
+{
+    return lapack::syevd( jobz, uplo, n, dA, ldda, dW,
+                          work, lwork, iwork, liwork );
+}
+
+//----------
+static int64_t host_heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* dA, int64_t ldda, double* dW,
+    double* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork )
+{
+    return lapack::syevd( jobz, uplo, n, dA, ldda, dW,
+                          work, lwork, iwork, liwork );
+}
+
+//----------
+static int64_t host_heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* dA, int64_t ldda, float* dW,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork )
+{
+    return lapack::heevd( jobz, uplo, n, dA, ldda, dW,
+                          work, lwork, rwork, lrwork, iwork, liwork );
+}
+
+//----------
+static int64_t host_heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* dA, int64_t ldda, double* dW,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    int64_t* iwork, int64_t liwork )
+{
+    return lapack::heevd( jobz, uplo, n, dA, ldda, dW,
+                          work, lwork, rwork, lrwork, iwork, liwork );
+}
+
+//------------------------------------------------------------------------------
+// The device workspace holds the LAPACK work, rwork, and iwork arrays,
+// in that order, each starting at a multiple of 64 bytes.
+const size_t host_heevd_align = 64;
+
+static inline size_t host_heevd_round_up( size_t bytes )
+{
+    return (bytes + host_heevd_align - 1) / host_heevd_align * host_heevd_align;
+}
+
+//------------------------------------------------------------------------------
+// Wrapper around host LAPACK workspace query.
+// dA is only for templating scalar_t; it isn't referenced.
+template <typename scalar_t>
+void heevd_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo,
+    int64_t n, scalar_t* dA, int64_t ldda, blas::real_type<scalar_t>* dW,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue )
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    int64_t lwork, lrwork, liwork;
+    host_heevd_work_size( jobz, uplo, n, dA, blas::max( 1, ldda ), dW,
+                          &lwork, &lrwork, &liwork );
+    *dev_work_size = host_heevd_round_up( lwork  * sizeof(scalar_t) )
+                   + host_heevd_round_up( lrwork * sizeof(real_t) )
+                   + liwork * sizeof(int64_t);
+    *host_work_size = 0;
+}
+
+//------------------------------------------------------------------------------
+// Wrapper around host LAPACK, run on the queue's thread.
+// This is async. Once finished, the return info is in dev_info.
+template <typename scalar_t>
+void heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    scalar_t* dA, int64_t ldda, blas::real_type<scalar_t>* dW,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    lapack_error_if( jobz != Job::NoVec && jobz != Job::Vec );
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( ldda < blas::max( 1, n ) );
+
+    // Split the workspace, as in heevd_work_size_bytes.
+    int64_t lwork, lrwork, liwork;
+    host_heevd_work_size( jobz, uplo, n, dA, ldda, dW,
+                          &lwork, &lrwork, &liwork );
+    size_t rwork_offset = host_heevd_round_up( lwork * sizeof(scalar_t) );
+    size_t iwork_offset = rwork_offset
+                        + host_heevd_round_up( lrwork * sizeof(real_t) );
+    lapack_error_if( dev_work_size < iwork_offset + liwork * sizeof(int64_t) );
+
+    char* work = (char*) dev_work;
+    queue.submit( [=]() {
+        *dev_info = host_heevd(
+            jobz, uplo, n, dA, ldda, dW,
+            (scalar_t*)   work, lwork,
+            (real_t*)     (work + rwork_offset), lrwork,
+            (int64_t*)    (work + iwork_offset), liwork );
+    } );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void heevd_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo,
+    int64_t n, float* dA, int64_t ldda, float* dW,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void heevd_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo,
+    int64_t n, double* dA, int64_t ldda, double* dW,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void heevd_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo,
+    int64_t n, std::complex<float>* dA, int64_t ldda, float* dW,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void heevd_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo,
+    int64_t n, std::complex<double>* dA, int64_t ldda, double* dW,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+//--------------------
+template
+void heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* dA, int64_t ldda, float* dW,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* dA, int64_t ldda, double* dW,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* dA, int64_t ldda, float* dW,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* dA, int64_t ldda, double* dW,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+} // namespace lapack
+
+#endif // LAPACK_HAVE_HOST_QUEUE
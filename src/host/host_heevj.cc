@@ -0,0 +1,246 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/device.hh"
+
+#if defined(LAPACK_HAVE_HOST_QUEUE)
+
+#include "lapack.hh"
+
+#include <cmath>
+#include <limits>
+
+//==============================================================================
+namespace lapack {
+
+//------------------------------------------------------------------------------
+// Cyclic Jacobi eigensolver for Hermitian A, using the full matrix.
+// If jobz = Vec, V is n-by-n workspace for the eigenvectors, which
+// are copied to A at the end.
+// Each rotation J = [ c, s e; -s conj(e), c ], with e = a_pq / |a_pq|,
+// zeros a_pq in J^H A J; see Golub and Van Loan, sec. 8.5.
+// @return 0 on convergence, otherwise n + 1.
+template <typename scalar_t>
+static int64_t host_heevj(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda, blas::real_type<scalar_t>* W,
+    scalar_t* V, int64_t ldv )
+{
+    using real_t = blas::real_type<scalar_t>;
+
+    const real_t eps = std::numeric_limits< real_t >::epsilon();
+    const int max_sweeps = 100;
+    bool wantz = (jobz == Job::Vec);
+
+    #define A(i_, j_) A[ (i_) + (j_)*lda ]
+    #define V(i_, j_) V[ (i_) + (j_)*ldv ]
+
+    // Fill in the other triangle.
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = 0; i < j; ++i) {
+            if (uplo == Uplo::Lower)
+                A( i, j ) = blas::conj( A( j, i ) );
+            else
+                A( j, i ) = blas::conj( A( i, j ) );
+        }
+        A( j, j ) = std::real( A( j, j ) );
+    }
+    if (wantz) {
+        lapack::laset( MatrixType::General, n, n,
+                       scalar_t( 0 ), scalar_t( 1 ), V, ldv );
+    }
+
+    real_t tol = eps * lapack::lange( Norm::Fro, n, n, A, lda );
+    int64_t info = n + 1;
+    for (int sweep = 0; sweep <= max_sweeps; ++sweep) {
+        real_t off = 0;
+        for (int64_t j = 0; j < n; ++j) {
+            for (int64_t i = 0; i < j; ++i) {
+                real_t a = std::abs( A( i, j ) );
+                off += 2*a*a;
+            }
+        }
+        if (std::sqrt( off ) <= tol) {
+            info = 0;
+            break;
+        }
+        if (sweep == max_sweeps)
+            break;
+
+        for (int64_t p = 0; p < n - 1; ++p) {
+            for (int64_t q = p + 1; q < n; ++q) {
+                scalar_t apq = A( p, q );
+                real_t abs_apq = std::abs( apq );
+                if (abs_apq == 0)
+                    continue;
+
+                real_t app = std::real( A( p, p ) );
+                real_t aqq = std::real( A( q, q ) );
+                real_t theta = (aqq - app) / (2*abs_apq);
+                real_t t = (theta >= 0 ? 1 : -1)
+                         / (std::abs( theta ) + std::sqrt( 1 + theta*theta ));
+                real_t c = 1 / std::sqrt( 1 + t*t );
+                real_t s = t*c;
+                scalar_t e = apq / abs_apq;
+
+                // A = A J, V = V J
+                for (int64_t k = 0; k < n; ++k) {
+                    scalar_t akp = A( k, p );
+                    scalar_t akq = A( k, q );
+                    A( k, p ) = c*akp - s*blas::conj( e )*akq;
+                    A( k, q ) = s*e*akp + c*akq;
+                }
+                if (wantz) {
+                    for (int64_t k = 0; k < n; ++k) {
+                        scalar_t vkp = V( k, p );
+                        scalar_t vkq = V( k, q );
+                        V( k, p ) = c*vkp - s*blas::conj( e )*vkq;
+                        V( k, q ) = s*e*vkp + c*vkq;
+                    }
+                }
+                // A = J^H A
+                for (int64_t k = 0; k < n; ++k) {
+                    scalar_t apk = A( p, k );
+                    scalar_t aqk = A( q, k );
+                    A( p, k ) = c*apk - s*e*aqk;
+                    A( q, k ) = s*blas::conj( e )*apk + c*aqk;
+                }
+                A( p, p ) = app - t*abs_apq;
+                A( q, q ) = aqq + t*abs_apq;
+                A( p, q ) = 0;
+                A( q, p ) = 0;
+            }
+        }
+    }
+
+    // Sort eigenvalues ascending, with their vectors.
+    for (int64_t j = 0; j < n; ++j)
+        W[ j ] = std::real( A( j, j ) );
+    for (int64_t j = 0; j < n - 1; ++j) {
+        int64_t jmin = j;
+        for (int64_t i = j + 1; i < n; ++i) {
+            if (W[ i ] < W[ jmin ])
+                jmin = i;
+        }
+        if (jmin != j) {
+            std::swap( W[ j ], W[ jmin ] );
+            if (wantz)
+                blas::swap( n, &V( 0, j ), 1, &V( 0, jmin ), 1 );
+        }
+    }
+    if (wantz) {
+        lapack::lacpy( MatrixType::General, n, n, V, ldv, A, lda );
+    }
+
+    #undef A
+    #undef V
+
+    return info;
+}
+
+//------------------------------------------------------------------------------
+// Workspace query. The device workspace holds the eigenvectors.
+// dA, dW are only for templating scalar_t; they aren't referenced.
+template <typename scalar_t>
+void heevj_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo,
+    int64_t n, scalar_t* dA, int64_t ldda, blas::real_type<scalar_t>* dW,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue )
+{
+    *dev_work_size = (jobz == Job::Vec ? n*n*sizeof(scalar_t) : 0);
+    *host_work_size = 0;
+}
+
+//------------------------------------------------------------------------------
+// Host Jacobi eigensolver, run on the queue's thread.
+// This is async. Once finished, the return info is in dev_info.
+template <typename scalar_t>
+void heevj(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    scalar_t* dA, int64_t ldda, blas::real_type<scalar_t>* dW,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    lapack_error_if( jobz != Job::NoVec && jobz != Job::Vec );
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( ldda < blas::max( 1, n ) );
+    lapack_error_if( jobz == Job::Vec
+                     && dev_work_size < n*n*sizeof(scalar_t) );
+
+    scalar_t* dV = (scalar_t*) dev_work;
+    queue.submit( [=]() {
+        *dev_info = host_heevj( jobz, uplo, n, dA, ldda, dW, dV, n );
+    } );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void heevj_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo,
+    int64_t n, float* dA, int64_t ldda, float* dW,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void heevj_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo,
+    int64_t n, double* dA, int64_t ldda, double* dW,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void heevj_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo,
+    int64_t n, std::complex<float>* dA, int64_t ldda, float* dW,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void heevj_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo,
+    int64_t n, std::complex<double>* dA, int64_t ldda, double* dW,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+//--------------------
+template
+void heevj(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* dA, int64_t ldda, float* dW,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void heevj(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* dA, int64_t ldda, double* dW,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void heevj(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* dA, int64_t ldda, float* dW,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void heevj(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* dA, int64_t ldda, double* dW,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+} // namespace lapack
+
+#endif // LAPACK_HAVE_HOST_QUEUE
@@ -3,25 +3,31 @@
 // This program is free software: you can redistribute it and/or modify it under
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
-#include "lapack/defines.h"
+#include "lapack/device.hh"
 
-#if ! (defined(LAPACK_HAVE_ROCBLAS) || defined(LAPACK_HAVE_CUBLAS) || defined(LAPACK_HAVE_SYCL))
+#if defined(LAPACK_HAVE_HOST_QUEUE)
 
-#include "lapack/device.hh"
+#include "lapack.hh"
 
 //==============================================================================
 namespace lapack {
 
 //------------------------------------------------------------------------------
-// Wrapper stub.
-// This is async. Once finished, the return info is in dev_info on the device.
+// Wrapper around host LAPACK, run on the queue's thread.
+// This is async. Once finished, the return info is in dev_info.
 template <typename scalar_t>
 void potrf(
     lapack::Uplo uplo, int64_t n,
     scalar_t* dA, int64_t ldda,
     device_info_int* dev_info, lapack::Queue& queue )
 {
-    throw lapack::Error( "device LAPACK not available", __func__ );
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( ldda < blas::max( 1, n ) );
+
+    queue.submit( [=]() {
+        *dev_info = lapack::potrf( uplo, n, dA, ldda );
+    } );
 }
 
 //------------------------------------------------------------------------------
@@ -52,4 +58,4 @@ void potrf(
 
 } // namespace lapack
 
-#endif // ! (LAPACK_HAVE_ROCBLAS || LAPACK_HAVE_CUBLAS || LAPACK_HAVE_SYCL)
+#endif // LAPACK_HAVE_HOST_QUEUE
@@ -0,0 +1,81 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/device.hh"
+
+#if defined(LAPACK_HAVE_HOST_QUEUE)
+
+//==============================================================================
+namespace lapack {
+
+//------------------------------------------------------------------------------
+void Queue::submit( std::function< void () > task )
+{
+    std::lock_guard< std::mutex > lock( mutex_ );
+    if (! thread_.joinable())
+        thread_ = std::thread( &Queue::run, this );
+    tasks_.push_back( std::move( task ) );
+    ++pending_;
+    ready_.notify_one();
+}
+
+//------------------------------------------------------------------------------
+void Queue::sync()
+{
+    std::unique_lock< std::mutex > lock( mutex_ );
+    idle_.wait( lock, [this] { return pending_ == 0; } );
+    if (error_) {
+        std::exception_ptr error = error_;
+        error_ = nullptr;
+        std::rethrow_exception( error );
+    }
+}
+
+//------------------------------------------------------------------------------
+// Executes tasks in order until shutdown. Exceptions are saved for sync.
+void Queue::run()
+{
+    std::unique_lock< std::mutex > lock( mutex_ );
+    while (true) {
+        ready_.wait( lock, [this] { return stop_ || ! tasks_.empty(); } );
+        if (tasks_.empty())
+            break;  // stop_ and no more work
+
+        std::function< void () > task = std::move( tasks_.front() );
+        tasks_.pop_front();
+        lock.unlock();
+        std::exception_ptr error;
+        try {
+            task();
+        }
+        catch (...) {
+            error = std::current_exception();
+        }
+        lock.lock();
+        if (error && ! error_)
+            error_ = error;
+        --pending_;
+        if (pending_ == 0)
+            idle_.notify_all();
+    }
+}
+
+//------------------------------------------------------------------------------
+// Finishes pending tasks, then joins the thread. Called by ~Queue,
+// so an exception from a task is discarded.
+void Queue::shutdown()
+{
+    {
+        std::lock_guard< std::mutex > lock( mutex_ );
+        stop_ = true;
+        ready_.notify_one();
+    }
+    if (thread_.joinable())
+        thread_.join();
+}
+
+} // namespace lapack
+
+#endif // LAPACK_HAVE_HOST_QUEUE
@@ -0,0 +1,311 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/host_stream.hh"
+#include "lapack/threads.hh"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Completion flag, with callbacks for streams waiting on it.
+class HostEventState
+{
+public:
+    // Marks the event complete, then runs the callbacks.
+    void complete()
+    {
+        std::vector< std::function< void () > > callbacks;
+        {
+            std::lock_guard< std::mutex > lock( mutex_ );
+            done_ = true;
+            callbacks.swap( callbacks_ );
+        }
+        done_cv_.notify_all();
+        for (auto& callback : callbacks)
+            callback();
+    }
+
+    // If the event is incomplete, saves callback to run on completion and
+    // returns true; otherwise returns false without running it.
+    bool defer( std::function< void () > callback )
+    {
+        std::lock_guard< std::mutex > lock( mutex_ );
+        if (done_)
+            return false;
+        callbacks_.push_back( std::move( callback ) );
+        return true;
+    }
+
+    bool query()
+    {
+        std::lock_guard< std::mutex > lock( mutex_ );
+        return done_;
+    }
+
+    void wait()
+    {
+        std::unique_lock< std::mutex > lock( mutex_ );
+        done_cv_.wait( lock, [this] { return done_; } );
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable done_cv_;
+    std::vector< std::function< void () > > callbacks_;
+    bool done_ = false;
+};
+
+//------------------------------------------------------------------------------
+// Entry in a stream: a function to run, or an event to wait for.
+struct HostTask
+{
+    std::function< void () > func;
+    std::shared_ptr< HostEventState > event;
+};
+
+//------------------------------------------------------------------------------
+// Stream's tasks. All members are guarded by the pool's mutex.
+class HostStreamState
+{
+public:
+    std::deque< HostTask > tasks;
+    int64_t pending = 0;        ///< tasks queued, running, or waiting
+    bool scheduled = false;     ///< in ready queue, running, or waiting
+    std::condition_variable idle;
+};
+
+//------------------------------------------------------------------------------
+// Workers take streams from the ready queue and run one task of each,
+// then requeue the stream at the back if it has more. A stream is in
+// the ready queue at most once, so its tasks run in order, one at a time.
+class HostPoolState
+    : public std::enable_shared_from_this< HostPoolState >
+{
+public:
+    HostPoolState( int threads_per_worker )
+        : threads_per_worker_( threads_per_worker )
+    {}
+
+    //----------
+    void start( int num_workers )
+    {
+        workers_.reserve( num_workers );
+        for (int i = 0; i < num_workers; ++i)
+            workers_.emplace_back( &HostPoolState::run, this );
+    }
+
+    //----------
+    // Finishes streams in the ready queue, then joins the workers.
+    void stop()
+    {
+        {
+            std::lock_guard< std::mutex > lock( mutex_ );
+            stop_ = true;
+        }
+        ready_cv_.notify_all();
+        for (auto& worker : workers_)
+            worker.join();
+        workers_.clear();
+    }
+
+    //----------
+    void submit( std::shared_ptr< HostStreamState > const& stream,
+                 HostTask task )
+    {
+        std::lock_guard< std::mutex > lock( mutex_ );
+        stream->tasks.push_back( std::move( task ) );
+        ++stream->pending;
+        if (! stream->scheduled) {
+            stream->scheduled = true;
+            ready_.push_back( stream );
+            ready_cv_.notify_one();
+        }
+    }
+
+    //----------
+    void sync( std::shared_ptr< HostStreamState > const& stream )
+    {
+        std::unique_lock< std::mutex > lock( mutex_ );
+        stream->idle.wait( lock, [&stream] { return stream->pending == 0; } );
+    }
+
+    //----------
+    int num_workers() const
+    {
+        return int( workers_.size() );
+    }
+
+private:
+    //----------
+    // Retires stream's current task. Requires mutex_ be held.
+    void finish( std::shared_ptr< HostStreamState > const& stream )
+    {
+        --stream->pending;
+        if (stream->tasks.empty()) {
+            stream->scheduled = false;
+            if (stream->pending == 0)
+                stream->idle.notify_all();
+        }
+        else {
+            ready_.push_back( stream );
+            ready_cv_.notify_one();
+        }
+    }
+
+    //----------
+    void run()
+    {
+        std::unique_lock< std::mutex > lock( mutex_ );
+        while (true) {
+            ready_cv_.wait( lock, [this] { return stop_ || ! ready_.empty(); } );
+            if (ready_.empty())
+                break;  // stop_ and no more work
+
+            std::shared_ptr< HostStreamState > stream = ready_.front();
+            ready_.pop_front();
+            HostTask task = std::move( stream->tasks.front() );
+            stream->tasks.pop_front();
+            lock.unlock();
+
+            if (task.event) {
+                // Park the stream, off the ready queue, until the event
+                // completes, rather than blocking this worker.
+                auto self = shared_from_this();
+                bool deferred = task.event->defer( [self, stream]() {
+                    std::lock_guard< std::mutex > lock2( self->mutex_ );
+                    self->finish( stream );
+                } );
+                lock.lock();
+                if (! deferred)
+                    finish( stream );
+            }
+            else {
+                // Tasks from enqueue and record do not throw; exceptions
+                // from user functions go to their futures. The scope is
+                // per task, not per worker, since with OpenBLAS and BLIS
+                // it sets the process-wide count while alive.
+                {
+                    ThreadScope scope( threads_per_worker_ );
+                    task.func();
+                }
+                lock.lock();
+                finish( stream );
+            }
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable ready_cv_;
+    std::deque< std::shared_ptr< HostStreamState > > ready_;
+    std::vector< std::thread > workers_;
+    int threads_per_worker_;
+    bool stop_ = false;
+};
+
+}  // namespace internal
+
+//==============================================================================
+// HostPool
+
+//------------------------------------------------------------------------------
+HostPool::HostPool( int num_workers, int threads_per_worker )
+{
+    lapack_error_if( num_workers < 1 );
+    lapack_error_if( threads_per_worker < 1 );
+
+    state_ = std::make_shared< internal::HostPoolState >( threads_per_worker );
+    state_->start( num_workers );
+}
+
+//------------------------------------------------------------------------------
+HostPool::~HostPool()
+{
+    state_->stop();
+}
+
+//------------------------------------------------------------------------------
+int HostPool::num_workers() const
+{
+    return state_->num_workers();
+}
+
+//------------------------------------------------------------------------------
+HostPool& HostPool::default_pool()
+{
+    static HostPool pool(
+        std::max( 1, int( std::thread::hardware_concurrency() ) ) );
+    return pool;
+}
+
+//==============================================================================
+// HostEvent
+
+//------------------------------------------------------------------------------
+bool HostEvent::query() const
+{
+    return state_ == nullptr || state_->query();
+}
+
+//------------------------------------------------------------------------------
+void HostEvent::wait() const
+{
+    if (state_)
+        state_->wait();
+}
+
+//==============================================================================
+// HostStream
+
+//------------------------------------------------------------------------------
+HostStream::HostStream( HostPool& pool )
+    : state_( std::make_shared< internal::HostStreamState >() ),
+      pool_( pool.state_ )
+{}
+
+//------------------------------------------------------------------------------
+HostStream::~HostStream()
+{
+    sync();
+}
+
+//------------------------------------------------------------------------------
+void HostStream::submit( std::function< void () > task )
+{
+    pool_->submit( state_, internal::HostTask{ std::move( task ), nullptr } );
+}
+
+//------------------------------------------------------------------------------
+HostEvent HostStream::record()
+{
+    HostEvent event;
+    event.state_ = std::make_shared< internal::HostEventState >();
+    auto state = event.state_;
+    submit( [state]() { state->complete(); } );
+    return event;
+}
+
+//------------------------------------------------------------------------------
+void HostStream::wait( HostEvent const& event )
+{
+    if (event.state_)
+        pool_->submit( state_, internal::HostTask{ nullptr, event.state_ } );
+}
+
+//------------------------------------------------------------------------------
+void HostStream::sync()
+{
+    pool_->sync( state_ );
+}
+
+}  // namespace lapack
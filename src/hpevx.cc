@@ -41,6 +41,7 @@ int64_t hpevx(
         lapack_int* ifail_ptr = ifail;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hpevx", std::complex<float>, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
@@ -94,6 +95,7 @@ int64_t hpevx(
         lapack_int* ifail_ptr = ifail;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hpevx", std::complex<double>, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
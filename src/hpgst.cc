@@ -25,6 +25,7 @@ int64_t hpgst(
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hpgst", std::complex<float>, 0, n, 0, 0, info_ );
 
     LAPACK_chpgst(
         &itype_, &uplo_, &n_,
@@ -47,6 +48,7 @@ int64_t hpgst(
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hpgst", std::complex<double>, 0, n, 0, 0, info_ );
 
     LAPACK_zhpgst(
         &itype_, &uplo_, &n_,
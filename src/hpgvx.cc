@@ -43,6 +43,7 @@ int64_t hpgvx(
         lapack_int* ifail_ptr = ifail;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hpgvx", std::complex<float>, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
@@ -99,6 +100,7 @@ int64_t hpgvx(
         lapack_int* ifail_ptr = ifail;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hpgvx", std::complex<double>, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
@@ -26,6 +26,7 @@ int64_t hptrd(
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hptrd", std::complex<float>, 0, n, 0, 0, info_ );
 
     LAPACK_chptrd(
         &uplo_, &n_,
@@ -51,6 +52,7 @@ int64_t hptrd(
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hptrd", std::complex<double>, 0, n, 0, 0, info_ );
 
     LAPACK_zhptrd(
         &uplo_, &n_,
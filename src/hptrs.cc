@@ -35,6 +35,7 @@ int64_t hptrs(
     #endif
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hptrs", std::complex<float>, 0, n, 0, nrhs, info_ );
 
     LAPACK_chptrs(
         &uplo_, &n_, &nrhs_,
@@ -67,6 +68,7 @@ int64_t hptrs(
     #endif
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hptrs", std::complex<double>, 0, n, 0, nrhs, info_ );
 
     LAPACK_zhptrs(
         &uplo_, &n_, &nrhs_,
@@ -32,6 +32,7 @@ int64_t hseqr(
     lapack_int ldh_ = to_lapack_int( ldh );
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hseqr", std::complex<float>, 0, n, 0, 0, info_ );
 
     // split-complex representation
     lapack::vector< float > WR( max( 1, n ) );
@@ -90,6 +91,7 @@ int64_t hseqr(
     lapack_int ldh_ = to_lapack_int( ldh );
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hseqr", std::complex<double>, 0, n, 0, 0, info_ );
 
     // split-complex representation
     lapack::vector< double > WR( max( 1, n ) );
@@ -148,6 +150,7 @@ int64_t hseqr(
     lapack_int ldh_ = to_lapack_int( ldh );
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hseqr", std::complex<float>, 0, n, 0, 0, info_ );
 
     // query for workspace size
     std::complex<float> qry_work[1];
@@ -323,6 +326,7 @@ int64_t hseqr(
     lapack_int ldh_ = to_lapack_int( ldh );
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "hseqr", std::complex<double>, 0, n, 0, 0, info_ );
 
     // query for workspace size
     std::complex<double> qry_work[1];
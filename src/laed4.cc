@@ -27,6 +27,7 @@ int64_t laed4(
     lapack_int n_ = to_lapack_int( n );
     lapack_int i_ = to_lapack_int( i ) + 1;  // change to 1-based
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "laed4", float, 0, n, 0, 0, info_ );
 
     LAPACK_slaed4(
         &n_, &i_,
@@ -103,6 +104,7 @@ int64_t laed4(
     lapack_int n_ = to_lapack_int( n );
     lapack_int i_ = to_lapack_int( i ) + 1;  // change to 1-based
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "laed4", double, 0, n, 0, 0, info_ );
 
     LAPACK_dlaed4(
         &n_, &i_,
@@ -26,6 +26,7 @@ int64_t lag2c(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldsa_ = to_lapack_int( ldsa );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "lag2c", std::complex<float>, m, n, 0, 0, info_ );
 
     LAPACK_zlag2c(
         &m_, &n_,
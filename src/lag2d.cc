@@ -26,6 +26,7 @@ int64_t lag2d(
     lapack_int ldsa_ = to_lapack_int( ldsa );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "lag2d", float, m, n, 0, 0, info_ );
 
     LAPACK_slag2d(
         &m_, &n_,
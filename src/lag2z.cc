@@ -26,6 +26,7 @@ int64_t lag2z(
     lapack_int ldsa_ = to_lapack_int( ldsa );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "lag2z", std::complex<float>, m, n, 0, 0, info_ );
 
     LAPACK_clag2z(
         &m_, &n_,
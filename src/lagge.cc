@@ -38,6 +38,7 @@ int64_t lagge(
         lapack_int* iseed_ptr = iseed;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "lagge", float, m, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (m+n) );
@@ -77,6 +78,7 @@ int64_t lagge(
         lapack_int* iseed_ptr = iseed;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "lagge", double, m, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (m+n) );
@@ -116,6 +118,7 @@ int64_t lagge(
         lapack_int* iseed_ptr = iseed;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "lagge", std::complex<float>, m, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<float> > work( (m+n) );
@@ -155,6 +158,7 @@ int64_t lagge(
         lapack_int* iseed_ptr = iseed;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "lagge", std::complex<double>, m, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (m+n) );
@@ -36,6 +36,7 @@ int64_t laghe(
         lapack_int* iseed_ptr = iseed;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "laghe", std::complex<float>, 0, n, k, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
@@ -73,6 +74,7 @@ int64_t laghe(
         lapack_int* iseed_ptr = iseed;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "laghe", std::complex<double>, 0, n, k, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
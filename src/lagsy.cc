@@ -36,6 +36,7 @@ int64_t lagsy(
         lapack_int* iseed_ptr = iseed;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "lagsy", float, 0, n, k, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (2*n) );
@@ -73,6 +74,7 @@ int64_t lagsy(
         lapack_int* iseed_ptr = iseed;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "lagsy", double, 0, n, k, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (2*n) );
@@ -110,6 +112,7 @@ int64_t lagsy(
         lapack_int* iseed_ptr = iseed;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "lagsy", std::complex<float>, 0, n, k, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
@@ -147,6 +150,7 @@ int64_t lagsy(
         lapack_int* iseed_ptr = iseed;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "lagsy", std::complex<double>, 0, n, k, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
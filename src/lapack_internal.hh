@@ -8,6 +8,9 @@
 
 #include "lapack/util.hh"
 
+#include <algorithm>
+#include <cstring>
+
 namespace lapack {
 
 //------------------------------------------------------------------------------
@@ -31,6 +34,155 @@ inline lapack_int to_lapack_int_( int64_t x, const char* x_str )
 ///
 #define to_lapack_int( x ) lapack::to_lapack_int_( x, #x )
 
+//------------------------------------------------------------------------------
+/// Widens n pivots, which LAPACK stored as lapack_int in the first half
+/// of the int64_t array ipiv, to int64_t in place. This avoids a
+/// separate 32-bit pivot array when lapack_int is 32-bit.
+/// Goes backwards so each 32-bit pivot is read before it is overwritten.
+///
+inline void widen_pivots( int64_t* ipiv, int64_t n )
+{
+    if constexpr (sizeof(lapack_int) < sizeof(int64_t)) {
+        char const* ipiv32 = reinterpret_cast< char const* >( ipiv );
+        for (int64_t i = n - 1; i >= 0; --i) {
+            lapack_int p;
+            std::memcpy( &p, ipiv32 + i*sizeof(lapack_int), sizeof(lapack_int) );
+            ipiv[ i ] = p;
+        }
+    }
+}
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Key for the workspace size cache: the LAPACK routine name,
+/// e.g., "sgesvd", and the scalar arguments that determine the workspace
+/// size (jobs, dimensions, leading dimensions).
+/// @see lapack::work_size_cache_set_capacity
+///
+struct WorkSizeKey
+{
+    static constexpr int max_args = 12;
+
+    char const* routine;
+    int nargs;
+    int64_t args[ max_args ];
+};
+
+//----------------------------------------
+/// @return key for routine with given scalar arguments.
+/// Enums are stored by value, e.g., lapack::Job::AllVec => 'A'.
+///
+template <typename... Args>
+inline WorkSizeKey work_size_key( char const* routine, Args... args )
+{
+    static_assert( sizeof...(Args) <= WorkSizeKey::max_args,
+                   "too many arguments for WorkSizeKey" );
+    return WorkSizeKey{ routine, int( sizeof...(Args) ), { int64_t( args )... } };
+}
+
+//----------------------------------------
+/// If the cache is enabled and has key, sets the workspace sizes
+/// (e.g., lwork, lrwork, liwork, in the routine's order; those that are
+/// non-null) and returns true; otherwise returns false.
+/// Defined in src/work_size_cache.cc.
+///
+bool work_size_cache_find(
+    WorkSizeKey const& key,
+    int64_t* size1, int64_t* size2=nullptr, int64_t* size3=nullptr );
+
+//----------------------------------------
+/// If the cache is enabled, inserts key with workspace sizes,
+/// evicting the least recently used entry if the cache is full.
+///
+void work_size_cache_insert(
+    WorkSizeKey const& key,
+    int64_t size1, int64_t size2=0, int64_t size3=0 );
+
+//------------------------------------------------------------------------------
+/// If getrf_set_method selected MethodLU::Native, factors A with
+/// getrf_native, sets info, and returns true; otherwise returns false
+/// so lapack::getrf calls LAPACK.
+/// Defined in src/getrf_native.cc for float, double, and complex.
+///
+template <typename scalar_t>
+bool getrf_dispatch(
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    int64_t* ipiv, int64_t* info );
+
+//------------------------------------------------------------------------------
+/// If potrf_set_method selected MethodCholesky::Tiled, factors A with
+/// potrf_tiled, sets info, and returns true; otherwise returns false
+/// so lapack::potrf calls LAPACK.
+/// Defined in src/potrf_tiled.cc for float, double, and complex.
+///
+template <typename scalar_t>
+bool potrf_dispatch(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda,
+    int64_t* info );
+
+//------------------------------------------------------------------------------
+/// Dimension accessors for batched routines: d( i ) returns the dimension
+/// of the i-th matrix. batch_value is for a dimension shared by all
+/// matrices; batch_array is for a dimension that varies, in vbatch routines.
+///
+struct batch_value {
+    int64_t value;
+    int64_t operator() ( int64_t i ) const { return value; }
+};
+
+struct batch_array {
+    int64_t const* array;
+    int64_t operator() ( int64_t i ) const { return array[ i ]; }
+};
+
+//------------------------------------------------------------------------------
+/// Copies B = A^T, where A is m-by-n and B is n-by-m, both column-major.
+/// Used by Layout overloads where no algebraic identity avoids the copy.
+/// Goes by tiles so both A and B are accessed with unit stride in cache.
+///
+template <typename scalar_t>
+void transpose(
+    int64_t m, int64_t n,
+    scalar_t const* A, int64_t lda,
+    scalar_t* B, int64_t ldb )
+{
+    const int64_t nb = 32;
+    for (int64_t jj = 0; jj < n; jj += nb) {
+        int64_t jb = std::min( nb, n - jj );
+        for (int64_t ii = 0; ii < m; ii += nb) {
+            int64_t ib = std::min( nb, m - ii );
+            for (int64_t i = ii; i < ii + ib; ++i)
+                for (int64_t j = jj; j < jj + jb; ++j)
+                    B[ j + i*ldb ] = A[ i + j*lda ];
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Transposes the n-by-n matrix A in place, A = A^T.
+///
+template <typename scalar_t>
+void transpose_in_place( int64_t n, scalar_t* A, int64_t lda )
+{
+    for (int64_t j = 0; j < n; ++j)
+        for (int64_t i = j + 1; i < n; ++i)
+            std::swap( A[ i + j*lda ], A[ j + i*lda ] );
+}
+
+//------------------------------------------------------------------------------
+/// @return Upper for Lower, and Lower for Upper. A row-major triangle is
+/// the opposite column-major triangle of A^T.
+///
+inline lapack::Uplo flip_uplo( lapack::Uplo uplo )
+{
+    return uplo == Uplo::Upper ? Uplo::Lower : Uplo::Upper;
+}
+
+}  // namespace internal
+
 }  // namespace lapack
 
 #endif // LAPACK_INTERNAL_HH
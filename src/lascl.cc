@@ -28,6 +28,7 @@ int64_t lascl(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "lascl", float, m, n, 0, 0, info_ );
 
     LAPACK_slascl(
         &matrixtype_, &kl_, &ku_, &cfrom, &cto, &m_, &n_,
@@ -52,6 +53,7 @@ int64_t lascl(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "lascl", double, m, n, 0, 0, info_ );
 
     LAPACK_dlascl(
         &matrixtype_, &kl_, &ku_, &cfrom, &cto, &m_, &n_,
@@ -76,6 +78,7 @@ int64_t lascl(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "lascl", std::complex<float>, m, n, 0, 0, info_ );
 
     LAPACK_clascl(
         &matrixtype_, &kl_, &ku_, &cfrom, &cto, &m_, &n_,
@@ -173,6 +176,7 @@ int64_t lascl(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "lascl", std::complex<double>, m, n, 0, 0, info_ );
 
     LAPACK_zlascl(
         &matrixtype_, &kl_, &ku_, &cfrom, &cto, &m_, &n_,
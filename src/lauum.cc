@@ -25,6 +25,7 @@ int64_t lauum(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "lauum", float, 0, n, 0, 0, info_ );
 
     LAPACK_slauum(
         &uplo_, &n_,
@@ -46,6 +47,7 @@ int64_t lauum(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "lauum", double, 0, n, 0, 0, info_ );
 
     LAPACK_dlauum(
         &uplo_, &n_,
@@ -67,6 +69,7 @@ int64_t lauum(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "lauum", std::complex<float>, 0, n, 0, 0, info_ );
 
     LAPACK_clauum(
         &uplo_, &n_,
@@ -126,6 +129,7 @@ int64_t lauum(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "lauum", std::complex<double>, 0, n, 0, 0, info_ );
 
     LAPACK_zlauum(
         &uplo_, &n_,
@@ -0,0 +1,291 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_MIXED_REFINE_HH
+#define LAPACK_MIXED_REFINE_HH
+
+#include "lapack.hh"
+#include "NoConstructAllocator.hh"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+// Low-precision emulation and GMRES-based iterative refinement shared by
+// gesv_mixed, posv_mixed, and gels_mixed.
+
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Type the inner factorization is computed in: float or complex<float>.
+template <typename scalar_t>
+struct inner_type { using type = float; };
+
+template <typename real_t>
+struct inner_type< std::complex< real_t > > { using type = std::complex< float >; };
+
+template <typename scalar_t>
+using inner_t = typename inner_type< scalar_t >::type;
+
+//------------------------------------------------------------------------------
+/// Rounds x to the nearest value in the given format, ties to even.
+/// Bfloat16 has float's exponent range, with an 8-bit significand;
+/// Half has an 11-bit significand, overflows above 65504, and is
+/// subnormal below 2^-14.
+inline float round_inner( InnerPrecision precision, float x )
+{
+    if (precision == InnerPrecision::Single || std::isnan( x ))
+        return x;
+
+    if (precision == InnerPrecision::Half) {
+        float ax = std::abs( x );
+        if (ax >= 65520.0f)
+            return std::copysign( std::numeric_limits< float >::infinity(), x );
+        if (ax < 6.103515625e-05f) {
+            // Subnormal half has fixed spacing 2^-24.
+            return std::nearbyint( x * 16777216.0f ) / 16777216.0f;
+        }
+    }
+
+    // Round to nearest even by adding half an ulp of the target format,
+    // less one if the last kept bit is 0, then truncating.
+    int shift = (precision == InnerPrecision::Half ? 13 : 16);
+    uint32_t bits;
+    std::memcpy( &bits, &x, sizeof( bits ) );
+    uint32_t half_ulp = (uint32_t( 1 ) << (shift - 1)) - 1;
+    bits += half_ulp + ((bits >> shift) & 1);
+    bits &= ~((uint32_t( 1 ) << shift) - 1);
+    std::memcpy( &x, &bits, sizeof( bits ) );
+    return x;
+}
+
+inline std::complex< float > round_inner(
+    InnerPrecision precision, std::complex< float > x )
+{
+    return std::complex< float >( round_inner( precision, std::real( x ) ),
+                                  round_inner( precision, std::imag( x ) ) );
+}
+
+inline bool is_finite( float x )
+{
+    return std::isfinite( x );
+}
+
+inline bool is_finite( std::complex< float > x )
+{
+    return std::isfinite( std::real( x ) ) && std::isfinite( std::imag( x ) );
+}
+
+//------------------------------------------------------------------------------
+/// @return power of 2 to scale A by before converting, given its
+/// largest entry amax. For Half, this brings amax into [2048, 4096),
+/// leaving headroom for growth in the factors; otherwise 1.
+template <typename real_t>
+real_t inner_scale( InnerPrecision precision, real_t amax )
+{
+    if (precision != InnerPrecision::Half || amax == 0 || ! std::isfinite( amax ))
+        return 1;
+    int e;
+    std::frexp( amax, &e );
+    return std::ldexp( real_t( 1 ), 12 - e );
+}
+
+//------------------------------------------------------------------------------
+/// Rounds the uplo part of the m-by-n matrix A to the inner format,
+/// in place.
+/// @return true if all entries are finite.
+template <typename inner_t>
+bool round_inner(
+    InnerPrecision precision, lapack::Uplo uplo, int64_t m, int64_t n,
+    inner_t* A, int64_t lda )
+{
+    bool finite = true;
+    for (int64_t j = 0; j < n; ++j) {
+        int64_t i0 = (uplo == Uplo::Lower ? j : 0);
+        int64_t i1 = (uplo == Uplo::Upper ? blas::min( j + 1, m ) : m);
+        for (int64_t i = i0; i < i1; ++i) {
+            inner_t& a = A[ i + j*lda ];
+            a = round_inner( precision, a );
+            finite = finite && is_finite( a );
+        }
+    }
+    return finite;
+}
+
+//------------------------------------------------------------------------------
+/// Converts the uplo part of the m-by-n matrix A, scaled by s, to the
+/// inner format in Ai.
+/// @return true if all entries are finite, i.e., none overflowed.
+template <typename scalar_t>
+bool to_inner(
+    InnerPrecision precision, lapack::Uplo uplo, int64_t m, int64_t n,
+    scalar_t const* A, int64_t lda, blas::real_type< scalar_t > s,
+    inner_t< scalar_t >* Ai, int64_t ldai )
+{
+    for (int64_t j = 0; j < n; ++j) {
+        int64_t i0 = (uplo == Uplo::Lower ? j : 0);
+        int64_t i1 = (uplo == Uplo::Upper ? blas::min( j + 1, m ) : m);
+        for (int64_t i = i0; i < i1; ++i)
+            Ai[ i + j*ldai ] = inner_t< scalar_t >( s * A[ i + j*lda ] );
+    }
+    return round_inner( precision, uplo, m, n, Ai, ldai );
+}
+
+//------------------------------------------------------------------------------
+/// Solves Op d = r by GMRES from d = 0, left preconditioned by M,
+/// with at most kmax iterations, stopping when the preconditioned
+/// residual is reduced by tol. The Arnoldi basis is orthogonalized by
+/// classical Gram-Schmidt with reorthogonalization, using gemv, and
+/// the Hessenberg matrix is reduced by plane rotations from lartg.
+///
+/// op( v, w ) sets w = Op v; precond( v ) overwrites v with M^{-1} v.
+/// Workspace V is n-by-(kmax + 1), H is (kmax + 1)-by-kmax,
+/// cs and sn are length kmax, and g and h are length kmax + 1.
+///
+/// @return number of iterations.
+template <typename scalar_t, typename op_fn, typename precond_fn>
+int64_t gmres(
+    int64_t n, int64_t kmax, blas::real_type< scalar_t > tol,
+    scalar_t const* r, scalar_t* d,
+    op_fn&& op, precond_fn&& precond,
+    scalar_t* V, scalar_t* H,
+    blas::real_type< scalar_t >* cs, scalar_t* sn,
+    scalar_t* g, scalar_t* h )
+{
+    using real_t = blas::real_type< scalar_t >;
+    const scalar_t one = 1.0;
+    const scalar_t zero = 0.0;
+    int64_t ldh = kmax + 1;
+
+    std::copy( r, r + n, V );
+    precond( V );
+    real_t beta = blas::nrm2( n, V, 1 );
+    std::fill( d, d + n, zero );
+    if (beta == 0)
+        return 0;
+    blas::scal( n, one / beta, V, 1 );
+    std::fill( g, g + kmax + 1, zero );
+    g[ 0 ] = beta;
+
+    int64_t j = 0;
+    while (j < kmax) {
+        scalar_t* w = &V[ (j + 1)*n ];
+        op( &V[ j*n ], w );
+        precond( w );
+
+        scalar_t* Hj = &H[ j*ldh ];
+        std::fill( Hj, Hj + j + 2, zero );
+        for (int pass = 0; pass < 2; ++pass) {
+            blas::gemv( blas::Layout::ColMajor, blas::Op::ConjTrans, n, j + 1,
+                        one, V, n, w, 1, zero, h, 1 );
+            blas::gemv( blas::Layout::ColMajor, blas::Op::NoTrans, n, j + 1,
+                        -one, V, n, h, 1, one, w, 1 );
+            blas::axpy( j + 1, one, h, 1, Hj, 1 );
+        }
+        real_t hnext = blas::nrm2( n, w, 1 );
+        Hj[ j + 1 ] = hnext;
+        if (hnext > 0)
+            blas::scal( n, one / hnext, w, 1 );
+
+        // Apply previous rotations, then eliminate H(j+1, j).
+        for (int64_t i = 0; i < j; ++i) {
+            scalar_t t = cs[ i ] * Hj[ i ] + sn[ i ] * Hj[ i + 1 ];
+            Hj[ i + 1 ] = -blas::conj( sn[ i ] ) * Hj[ i ] + cs[ i ] * Hj[ i + 1 ];
+            Hj[ i ] = t;
+        }
+        scalar_t rjj;
+        lapack::lartg( Hj[ j ], Hj[ j + 1 ], &cs[ j ], &sn[ j ], &rjj );
+        Hj[ j ] = rjj;
+        Hj[ j + 1 ] = zero;
+        g[ j + 1 ] = -blas::conj( sn[ j ] ) * g[ j ];
+        g[ j ] = cs[ j ] * g[ j ];
+        ++j;
+
+        if (std::abs( g[ j ] ) <= tol * beta || hnext == 0)
+            break;
+    }
+
+    // d = V y, where H y = g.
+    blas::trsv( blas::Layout::ColMajor, blas::Uplo::Upper, blas::Op::NoTrans,
+                blas::Diag::NonUnit, j, H, ldh, g, 1 );
+    blas::gemv( blas::Layout::ColMajor, blas::Op::NoTrans, n, j,
+                one, V, n, g, 1, zero, d, 1 );
+    return j;
+}
+
+//------------------------------------------------------------------------------
+/// Refines each column x_j of the n-by-nrhs X, which holds an initial
+/// solution of Op X = B.
+///
+/// residual( j, x, r ) sets r = b_j - Op x and returns the scale s,
+/// such as || A ||_inf || x ||_inf, for the backward error || r ||_inf / s;
+/// op( v, w ) sets w = Op v; precond( v ) overwrites v with M^{-1} v.
+/// Each step solves Op d = r for the correction either as d = M^{-1} r,
+/// or by GMRES, then sets x += d, until the backward error is <= tol.
+///
+/// Sets rinfo gmres_iter, berr, and converged.
+/// @return max number of steps over the columns if all converged,
+///         else -31.
+template <typename scalar_t, typename residual_fn, typename op_fn,
+          typename precond_fn>
+int64_t refine_columns(
+    RefineOptions const& opts, int64_t n, int64_t nrhs,
+    scalar_t* X, int64_t ldx, blas::real_type< scalar_t > tol,
+    residual_fn&& residual, op_fn&& op, precond_fn&& precond,
+    RefineInfo* rinfo )
+{
+    using real_t = blas::real_type< scalar_t >;
+    const scalar_t one = 1.0;
+
+    bool use_gmres = (opts.method == MethodRefine::GMRES);
+    int64_t kmax = (use_gmres ? blas::min( opts.gmres_max_iter, n ) : 0);
+
+    lapack::vector< scalar_t > r( n ), d( n );
+    lapack::vector< scalar_t > V( n*(kmax + 1) ), H( (kmax + 1)*kmax );
+    lapack::vector< scalar_t > sn( kmax ), g( kmax + 1 ), h( kmax + 1 );
+    lapack::vector< real_t > cs( kmax );
+
+    int64_t max_iter = 0;
+    bool converged = true;
+    real_t berr_max = 0;
+    for (int64_t j = 0; j < nrhs; ++j) {
+        scalar_t* x = &X[ j*ldx ];
+        for (int64_t iter = 0; ; ++iter) {
+            real_t scale = residual( j, x, &r[0] );
+            real_t rnorm = lapack::lange( lapack::Norm::Inf, n, 1, &r[0], n );
+            real_t berr = (rnorm == 0 ? 0 : rnorm / scale);
+            if (berr <= tol) {
+                max_iter = blas::max( max_iter, iter );
+                berr_max = blas::max( berr_max, berr );
+                break;
+            }
+            if (iter == opts.max_iter || std::isnan( berr )) {
+                converged = false;
+                berr_max = std::isnan( berr ) ? berr : blas::max( berr_max, berr );
+                break;
+            }
+            if (use_gmres) {
+                rinfo->gmres_iter += gmres(
+                    n, kmax, real_t( opts.gmres_tol ), &r[0], &d[0],
+                    op, precond, &V[0], &H[0], &cs[0], &sn[0], &g[0], &h[0] );
+            }
+            else {
+                d = r;
+                precond( &d[0] );
+            }
+            blas::axpy( n, one, &d[0], 1, x, 1 );
+        }
+    }
+    rinfo->converged = converged;
+    rinfo->berr = berr_max;
+    return converged ? max_iter : -31;
+}
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif  // LAPACK_MIXED_REFINE_HH
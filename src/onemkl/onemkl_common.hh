@@ -29,6 +29,15 @@ inline const oneapi::mkl::job job2onemkl( lapack::Job job )
     return oneapi::mkl::job::novec;
 }
 
+// gesvd
+inline const oneapi::mkl::jobsvd job2jobsvd_onemkl( lapack::Job job )
+{
+    if (job == lapack::Job::AllVec) return oneapi::mkl::jobsvd::vectors;
+    if (job == lapack::Job::SomeVec) return oneapi::mkl::jobsvd::somevec;
+    if (job == lapack::Job::OverwriteVec) return oneapi::mkl::jobsvd::vectorsina;
+    return oneapi::mkl::jobsvd::novec;
+}
+
 } // namespace lapack
 
 #endif // LAPACK_ONEMKL_COMMON_H
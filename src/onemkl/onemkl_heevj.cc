@@ -5,67 +5,68 @@
 
 #include "lapack/defines.h"
 
-#if ! (defined(LAPACK_HAVE_ROCBLAS) || defined(LAPACK_HAVE_CUBLAS) || defined(LAPACK_HAVE_SYCL))
-
-#include "lapack/device.hh"
+#if defined(LAPACK_HAVE_SYCL)
 
+#include "onemkl_common.hh"
 
 //==============================================================================
 namespace lapack {
 
 //------------------------------------------------------------------------------
-// Wrapper around workspace query.
-// dA is only for templating scalar_t; it isn't referenced.
+// oneMKL has no Jacobi eigensolver, so this uses heevd.
 template <typename scalar_t>
-void heevd_work_size_bytes(
+void heevj_work_size_bytes(
     lapack::Job jobz, lapack::Uplo uplo,
     int64_t n, scalar_t* dA, int64_t ldda, blas::real_type<scalar_t>* dW,
     size_t* dev_work_size, size_t* host_work_size,
     lapack::Queue& queue )
 {
-    *dev_work_size  = 0;
-    *host_work_size = 0;
+    heevd_work_size_bytes(
+        jobz, uplo, n, dA, ldda, dW, dev_work_size, host_work_size, queue );
 }
 
 //------------------------------------------------------------------------------
-// Wrapper stub.
+// oneMKL has no Jacobi eigensolver, so this uses heevd.
 // This is async. Once finished, the return info is in dev_info on the device.
 template <typename scalar_t>
-void heevd(
+void heevj(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     scalar_t* dA, int64_t ldda, blas::real_type<scalar_t>* dW,
     void*  dev_work, size_t  dev_work_size,
     void* host_work, size_t host_work_size,
     device_info_int* dev_info, lapack::Queue& queue )
 {
-    throw lapack::Error( "device LAPACK not available", __func__ );
+    heevd(
+        jobz, uplo, n, dA, ldda, dW,
+        dev_work, dev_work_size, host_work, host_work_size,
+        dev_info, queue );
 }
 
 //------------------------------------------------------------------------------
 // Explicit instantiations.
 template
-void heevd_work_size_bytes(
+void heevj_work_size_bytes(
     lapack::Job jobz, lapack::Uplo uplo,
     int64_t n, float* dA, int64_t ldda, float* dW,
     size_t* dev_work_size, size_t* host_work_size,
     lapack::Queue& queue );
 
 template
-void heevd_work_size_bytes(
+void heevj_work_size_bytes(
     lapack::Job jobz, lapack::Uplo uplo,
     int64_t n, double* dA, int64_t ldda, double* dW,
     size_t* dev_work_size, size_t* host_work_size,
     lapack::Queue& queue );
 
 template
-void heevd_work_size_bytes(
+void heevj_work_size_bytes(
     lapack::Job jobz, lapack::Uplo uplo,
     int64_t n, std::complex<float>* dA, int64_t ldda, float* dW,
     size_t* dev_work_size, size_t* host_work_size,
     lapack::Queue& queue );
 
 template
-void heevd_work_size_bytes(
+void heevj_work_size_bytes(
     lapack::Job jobz, lapack::Uplo uplo,
     int64_t n, std::complex<double>* dA, int64_t ldda, double* dW,
     size_t* dev_work_size, size_t* host_work_size,
@@ -73,7 +74,7 @@ void heevd_work_size_bytes(
 
 //--------------------
 template
-void heevd(
+void heevj(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     float* dA, int64_t ldda, float* dW,
     void*  dev_work, size_t  dev_work_size,
@@ -81,7 +82,7 @@ void heevd(
     device_info_int* dev_info, lapack::Queue& queue );
 
 template
-void heevd(
+void heevj(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     double* dA, int64_t ldda, double* dW,
     void*  dev_work, size_t  dev_work_size,
@@ -89,7 +90,7 @@ void heevd(
     device_info_int* dev_info, lapack::Queue& queue );
 
 template
-void heevd(
+void heevj(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     std::complex<float>* dA, int64_t ldda, float* dW,
     void*  dev_work, size_t  dev_work_size,
@@ -97,7 +98,7 @@ void heevd(
     device_info_int* dev_info, lapack::Queue& queue );
 
 template
-void heevd(
+void heevj(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     std::complex<double>* dA, int64_t ldda, double* dW,
     void*  dev_work, size_t  dev_work_size,
@@ -106,5 +107,4 @@ void heevd(
 
 } // namespace lapack
 
-#endif // LAPACK_HAVE_CUBLAS
-
+#endif // LAPACK_HAVE_SYCL
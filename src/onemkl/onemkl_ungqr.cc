@@ -0,0 +1,208 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/defines.h"
+
+#if defined(LAPACK_HAVE_SYCL)
+
+#include "onemkl_common.hh"
+
+//==============================================================================
+namespace lapack {
+
+//------------------------------------------------------------------------------
+// Intermediate wrappers around oneMKL to deal with real orgqr vs. complex ungqr.
+int64_t onemkl_ungqr_scratchpad_size(
+    sycl::queue& solver, int64_t m, int64_t n, int64_t k, int64_t ldda,
+    float* dummy )
+{
+    return oneapi::mkl::lapack::orgqr_scratchpad_size<float>(
+        solver, m, n, k, ldda );
+}
+
+//----------
+int64_t onemkl_ungqr_scratchpad_size(
+    sycl::queue& solver, int64_t m, int64_t n, int64_t k, int64_t ldda,
+    double* dummy )
+{
+    return oneapi::mkl::lapack::orgqr_scratchpad_size<double>(
+        solver, m, n, k, ldda );
+}
+
+//----------
+int64_t onemkl_ungqr_scratchpad_size(
+    sycl::queue& solver, int64_t m, int64_t n, int64_t k, int64_t ldda,
+    std::complex<float>* dummy )
+{
+    return oneapi::mkl::lapack::ungqr_scratchpad_size<std::complex<float>>(
+        solver, m, n, k, ldda );
+}
+
+//----------
+int64_t onemkl_ungqr_scratchpad_size(
+    sycl::queue& solver, int64_t m, int64_t n, int64_t k, int64_t ldda,
+    std::complex<double>* dummy )
+{
+    return oneapi::mkl::lapack::ungqr_scratchpad_size<std::complex<double>>(
+        solver, m, n, k, ldda );
+}
+
+//------------------------------------------------------------------------------
+// Intermediate wrappers around oneMKL to deal with real orgqr vs. complex ungqr.
+void onemkl_ungqr(
+    sycl::queue& solver, int64_t m, int64_t n, int64_t k,
+    float* dA, int64_t ldda, float* dtau,
+    float* dev_work, int64_t lwork )
+{
+    oneapi::mkl::lapack::orgqr(
+        solver, m, n, k, dA, ldda, dtau, dev_work, lwork );
+}
+
+//----------
+void onemkl_ungqr(
+    sycl::queue& solver, int64_t m, int64_t n, int64_t k,
+    double* dA, int64_t ldda, double* dtau,
+    double* dev_work, int64_t lwork )
+{
+    oneapi::mkl::lapack::orgqr(
+        solver, m, n, k, dA, ldda, dtau, dev_work, lwork );
+}
+
+//----------
+void onemkl_ungqr(
+    sycl::queue& solver, int64_t m, int64_t n, int64_t k,
+    std::complex<float>* dA, int64_t ldda, std::complex<float>* dtau,
+    std::complex<float>* dev_work, int64_t lwork )
+{
+    oneapi::mkl::lapack::ungqr(
+        solver, m, n, k, dA, ldda, dtau, dev_work, lwork );
+}
+
+//----------
+void onemkl_ungqr(
+    sycl::queue& solver, int64_t m, int64_t n, int64_t k,
+    std::complex<double>* dA, int64_t ldda, std::complex<double>* dtau,
+    std::complex<double>* dev_work, int64_t lwork )
+{
+    oneapi::mkl::lapack::ungqr(
+        solver, m, n, k, dA, ldda, dtau, dev_work, lwork );
+}
+
+//------------------------------------------------------------------------------
+// Wrapper around workspace query.
+// dA, dtau are only for templating scalar_t; they aren't referenced.
+template <typename scalar_t>
+void ungqr_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    scalar_t* dA, int64_t ldda, scalar_t const* dtau,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue )
+{
+    auto solver = queue.stream();
+
+    // for cuda, rocm, call set_device; for oneapi, do nothing.
+    blas::internal_set_device( queue.device() );
+
+    int64_t lwork = 0;
+    blas_dev_call(
+        lwork = onemkl_ungqr_scratchpad_size( solver, m, n, k, ldda, dA ));
+    *dev_work_size = lwork * sizeof(scalar_t);
+    *host_work_size = 0;
+}
+
+//------------------------------------------------------------------------------
+// Wrapper around oneMKL.
+// oneMKL takes tau as non-const, though it isn't modified.
+// This is async. Once finished, the return info is in dev_info on the device.
+template <typename scalar_t>
+void ungqr(
+    int64_t m, int64_t n, int64_t k,
+    scalar_t* dA, int64_t ldda, scalar_t const* dtau,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    auto solver = queue.stream();
+
+    // for cuda, rocm, call set_device; for oneapi, do nothing.
+    blas::internal_set_device( queue.device() );
+
+    // launch kernel
+    int64_t lwork = dev_work_size/sizeof(scalar_t);
+    blas_dev_call(
+        onemkl_ungqr(
+            solver, m, n, k, dA, ldda, (scalar_t*) dtau,
+            (scalar_t*) dev_work, lwork ));
+
+    // todo: default info returned
+    blas::device_memset( dev_info, 0, 1, queue );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void ungqr_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    float* dA, int64_t ldda, float const* dtau,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void ungqr_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    double* dA, int64_t ldda, double const* dtau,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void ungqr_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<float>* dA, int64_t ldda, std::complex<float> const* dtau,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void ungqr_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<double>* dA, int64_t ldda, std::complex<double> const* dtau,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+//--------------------
+template
+void ungqr(
+    int64_t m, int64_t n, int64_t k,
+    float* dA, int64_t ldda, float const* dtau,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void ungqr(
+    int64_t m, int64_t n, int64_t k,
+    double* dA, int64_t ldda, double const* dtau,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void ungqr(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<float>* dA, int64_t ldda, std::complex<float> const* dtau,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void ungqr(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<double>* dA, int64_t ldda, std::complex<double> const* dtau,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+} // namespace lapack
+
+#endif // LAPACK_HAVE_SYCL
@@ -34,6 +34,7 @@ int64_t opmtr(
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldc_ = to_lapack_int( ldc );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "opmtr", float, m, n, 0, 0, info_ );
 
     // from docs
     int64_t lwork = (side == Side::Left ? n : m);
@@ -72,6 +73,7 @@ int64_t opmtr(
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldc_ = to_lapack_int( ldc );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "opmtr", double, m, n, 0, 0, info_ );
 
     // from docs
     int64_t lwork = (side == Side::Left ? n : m);
@@ -28,6 +28,67 @@ int64_t orcsd2by1(
     float* U2, int64_t ldu2,
     float* V1T, int64_t ldv1t )
 {
+    // query for workspace size
+    int64_t lwork, liwork;
+    orcsd2by1_work_size(
+        jobu1, jobu2, jobv1t, m, p, q, X11, ldx11, X21, ldx21, theta, U1, ldu1,
+        U2, ldu2, V1T, ldv1t,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+    lapack::vector< int64_t > iwork( liwork );
+
+    return orcsd2by1(
+        jobu1, jobu2, jobv1t, m, p, q, X11, ldx11, X21, ldx21, theta, U1, ldu1,
+        U2, ldu2, V1T, ldv1t,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t orcsd2by1(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
+    double* X11, int64_t ldx11,
+    double* X21, int64_t ldx21,
+    double* theta,
+    double* U1, int64_t ldu1,
+    double* U2, int64_t ldu2,
+    double* V1T, int64_t ldv1t )
+{
+    // query for workspace size
+    int64_t lwork, liwork;
+    orcsd2by1_work_size(
+        jobu1, jobu2, jobv1t, m, p, q, X11, ldx11, X21, ldx21, theta, U1, ldu1,
+        U2, ldu2, V1T, ldv1t,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+    lapack::vector< int64_t > iwork( liwork );
+
+    return orcsd2by1(
+        jobu1, jobu2, jobv1t, m, p, q, X11, ldx11, X21, ldx21, theta, U1, ldu1,
+        U2, ldu2, V1T, ldv1t,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+void orcsd2by1_work_size(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
+    float* X11, int64_t ldx11,
+    float* X21, int64_t ldx21,
+    float* theta,
+    float* U1, int64_t ldu1,
+    float* U2, int64_t ldu2,
+    float* V1T, int64_t ldv1t,
+    int64_t* lwork, int64_t* liwork )
+{
+    auto key = internal::work_size_key(
+        "sorcsd2by1", jobu1, jobu2, jobv1t, m, p, q, ldx11, ldx21, ldu1, ldu2,
+        ldv1t );
+    if (internal::work_size_cache_find( key, lwork, liwork ))
+        return;
+
     char jobu1_ = to_char_csd( jobu1 );
     char jobu2_ = to_char_csd( jobu2 );
     char jobv1t_ = to_char_csd( jobv1t );
@@ -41,7 +102,6 @@ int64_t orcsd2by1(
     lapack_int ldv1t_ = to_lapack_int( ldv1t );
     lapack_int info_ = 0;
 
-    // query for workspace size
     float qry_work[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
@@ -59,13 +119,45 @@ int64_t orcsd2by1(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    *liwork = m - min( p, min( m-p, min( q, m-q )));
+    internal::work_size_cache_insert( key, *lwork, *liwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (m - min( p, min( m-p, min( q, m-q )))) );
+// -----------------------------------------------------------------------------
+void orcsd2by1_work_size(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
+    double* X11, int64_t ldx11,
+    double* X21, int64_t ldx21,
+    double* theta,
+    double* U1, int64_t ldu1,
+    double* U2, int64_t ldu2,
+    double* V1T, int64_t ldv1t,
+    int64_t* lwork, int64_t* liwork )
+{
+    auto key = internal::work_size_key(
+        "dorcsd2by1", jobu1, jobu2, jobv1t, m, p, q, ldx11, ldx21, ldu1, ldu2,
+        ldv1t );
+    if (internal::work_size_cache_find( key, lwork, liwork ))
+        return;
 
-    LAPACK_sorcsd2by1(
+    char jobu1_ = to_char_csd( jobu1 );
+    char jobu2_ = to_char_csd( jobu2 );
+    char jobv1t_ = to_char_csd( jobv1t );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int q_ = to_lapack_int( q );
+    lapack_int ldx11_ = to_lapack_int( ldx11 );
+    lapack_int ldx21_ = to_lapack_int( ldx21 );
+    lapack_int ldu1_ = to_lapack_int( ldu1 );
+    lapack_int ldu2_ = to_lapack_int( ldu2 );
+    lapack_int ldv1t_ = to_lapack_int( ldv1t );
+    lapack_int info_ = 0;
+
+    double qry_work[1];
+    lapack_int qry_iwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dorcsd2by1(
         &jobu1_, &jobu2_, &jobv1t_, &m_, &p_, &q_,
         X11, &ldx11_,
         X21, &ldx21_,
@@ -73,24 +165,28 @@ int64_t orcsd2by1(
         U1, &ldu1_,
         U2, &ldu2_,
         V1T, &ldv1t_,
-        &work[0], &lwork_,
-        &iwork[0], &info_
+        qry_work, &ineg_one,
+        qry_iwork, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    return info_;
+    *lwork = real(qry_work[0]);
+    *liwork = m - min( p, min( m-p, min( q, m-q )));
+    internal::work_size_cache_insert( key, *lwork, *liwork );
 }
 
 // -----------------------------------------------------------------------------
 int64_t orcsd2by1(
     lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
-    double* X11, int64_t ldx11,
-    double* X21, int64_t ldx21,
-    double* theta,
-    double* U1, int64_t ldu1,
-    double* U2, int64_t ldu2,
-    double* V1T, int64_t ldv1t )
+    float* X11, int64_t ldx11,
+    float* X21, int64_t ldx21,
+    float* theta,
+    float* U1, int64_t ldu1,
+    float* U2, int64_t ldu2,
+    float* V1T, int64_t ldv1t,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
 {
     char jobu1_ = to_char_csd( jobu1 );
     char jobu2_ = to_char_csd( jobu2 );
@@ -104,12 +200,13 @@ int64_t orcsd2by1(
     lapack_int ldu2_ = to_lapack_int( ldu2 );
     lapack_int ldv1t_ = to_lapack_int( ldv1t );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "orcsd2by1", float, m, 0, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( liwork < m - min( p, min( m-p, min( q, m-q ))) );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dorcsd2by1(
+    LAPACK_sorcsd2by1(
         &jobu1_, &jobu2_, &jobv1t_, &m_, &p_, &q_,
         X11, &ldx11_,
         X21, &ldx21_,
@@ -117,17 +214,44 @@ int64_t orcsd2by1(
         U1, &ldu1_,
         U2, &ldu2_,
         V1T, &ldv1t_,
-        qry_work, &ineg_one,
-        qry_iwork, &info_
+        work, &lwork_,
+        iwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (m - min( p, min( m-p, min( q, m-q )))) );
+// -----------------------------------------------------------------------------
+int64_t orcsd2by1(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
+    double* X11, int64_t ldx11,
+    double* X21, int64_t ldx21,
+    double* theta,
+    double* U1, int64_t ldu1,
+    double* U2, int64_t ldu2,
+    double* V1T, int64_t ldv1t,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    char jobu1_ = to_char_csd( jobu1 );
+    char jobu2_ = to_char_csd( jobu2 );
+    char jobv1t_ = to_char_csd( jobv1t );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int q_ = to_lapack_int( q );
+    lapack_int ldx11_ = to_lapack_int( ldx11 );
+    lapack_int ldx21_ = to_lapack_int( ldx21 );
+    lapack_int ldu1_ = to_lapack_int( ldu1 );
+    lapack_int ldu2_ = to_lapack_int( ldu2 );
+    lapack_int ldv1t_ = to_lapack_int( ldv1t );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "orcsd2by1", double, m, 0, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( liwork < m - min( p, min( m-p, min( q, m-q ))) );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
 
     LAPACK_dorcsd2by1(
         &jobu1_, &jobu2_, &jobv1t_, &m_, &p_, &q_,
@@ -137,8 +261,8 @@ int64_t orcsd2by1(
         U1, &ldu1_,
         U2, &ldu2_,
         V1T, &ldv1t_,
-        &work[0], &lwork_,
-        &iwork[0], &info_
+        work, &lwork_,
+        iwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -23,6 +23,55 @@ int64_t orgbr(
     float* A, int64_t lda,
     float const* tau )
 {
+    // query for workspace size
+    int64_t lwork;
+    orgbr_work_size(
+        vect, m, n, k, A, lda, tau,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return orgbr(
+        vect, m, n, k, A, lda, tau,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::ungbr
+/// @ingroup gesvd_computational
+int64_t orgbr(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau )
+{
+    // query for workspace size
+    int64_t lwork;
+    orgbr_work_size(
+        vect, m, n, k, A, lda, tau,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return orgbr(
+        vect, m, n, k, A, lda, tau,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd_computational
+void orgbr_work_size(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "sorgbr", vect, m, n, k, lda );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     char vect_ = to_char( vect );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -30,7 +79,6 @@ int64_t orgbr(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
 
-    // query for workspace size
     float qry_work[1];
     lapack_int ineg_one = -1;
     LAPACK_sorgbr(
@@ -42,30 +90,52 @@ int64_t orgbr(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd_computational
+void orgbr_work_size(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "dorgbr", vect, m, n, k, lda );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
 
-    LAPACK_sorgbr(
+    char vect_ = to_char( vect );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int k_ = to_lapack_int( k );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dorgbr(
         &vect_, &m_, &n_, &k_,
         A, &lda_,
         tau,
-        &work[0], &lwork_, &info_
+        qry_work, &ineg_one, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    return info_;
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
 }
 
 // -----------------------------------------------------------------------------
-/// @see lapack::ungbr
 /// @ingroup gesvd_computational
 int64_t orgbr(
     lapack::Vect vect, int64_t m, int64_t n, int64_t k,
-    double* A, int64_t lda,
-    double const* tau )
+    float* A, int64_t lda,
+    float const* tau,
+    float* work, int64_t lwork )
 {
     char vect_ = to_char( vect );
     lapack_int m_ = to_lapack_int( m );
@@ -73,29 +143,43 @@ int64_t orgbr(
     lapack_int k_ = to_lapack_int( k );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "orgbr", float, m, n, k, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dorgbr(
+    LAPACK_sorgbr(
         &vect_, &m_, &n_, &k_,
         A, &lda_,
         tau,
-        qry_work, &ineg_one, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd_computational
+int64_t orgbr(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau,
+    double* work, int64_t lwork )
+{
+    char vect_ = to_char( vect );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int k_ = to_lapack_int( k );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "orgbr", double, m, n, k, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
     LAPACK_dorgbr(
         &vect_, &m_, &n_, &k_,
         A, &lda_,
         tau,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -22,13 +22,58 @@ int64_t orghr(
     float* A, int64_t lda,
     float const* tau )
 {
+    // query for workspace size
+    int64_t lwork;
+    orghr_work_size(
+        n, ilo, ihi, A, lda, tau,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return orghr(
+        n, ilo, ihi, A, lda, tau,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t orghr(
+    int64_t n, int64_t ilo, int64_t ihi,
+    double* A, int64_t lda,
+    double const* tau )
+{
+    // query for workspace size
+    int64_t lwork;
+    orghr_work_size(
+        n, ilo, ihi, A, lda, tau,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return orghr(
+        n, ilo, ihi, A, lda, tau,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+void orghr_work_size(
+    int64_t n, int64_t ilo, int64_t ihi,
+    float* A, int64_t lda,
+    float const* tau,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "sorghr", n, ilo, ihi, lda );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int ilo_ = to_lapack_int( ilo );
     lapack_int ihi_ = to_lapack_int( ihi );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
 
-    // query for workspace size
     float qry_work[1];
     lapack_int ineg_one = -1;
     LAPACK_sorghr(
@@ -39,55 +84,88 @@ int64_t orghr(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+void orghr_work_size(
+    int64_t n, int64_t ilo, int64_t ihi,
+    double* A, int64_t lda,
+    double const* tau,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "dorghr", n, ilo, ihi, lda );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
 
-    LAPACK_sorghr(
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ilo_ = to_lapack_int( ilo );
+    lapack_int ihi_ = to_lapack_int( ihi );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dorghr(
         &n_, &ilo_, &ihi_,
         A, &lda_,
         tau,
-        &work[0], &lwork_, &info_ );
+        qry_work, &ineg_one, &info_ );
     if (info_ < 0) {
         throw Error();
     }
-    return info_;
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
 }
 
 // -----------------------------------------------------------------------------
 int64_t orghr(
     int64_t n, int64_t ilo, int64_t ihi,
-    double* A, int64_t lda,
-    double const* tau )
+    float* A, int64_t lda,
+    float const* tau,
+    float* work, int64_t lwork )
 {
     lapack_int n_ = to_lapack_int( n );
     lapack_int ilo_ = to_lapack_int( ilo );
     lapack_int ihi_ = to_lapack_int( ihi );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "orghr", float, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dorghr(
+    LAPACK_sorghr(
         &n_, &ilo_, &ihi_,
         A, &lda_,
         tau,
-        qry_work, &ineg_one, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+int64_t orghr(
+    int64_t n, int64_t ilo, int64_t ihi,
+    double* A, int64_t lda,
+    double const* tau,
+    double* work, int64_t lwork )
+{
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ilo_ = to_lapack_int( ilo );
+    lapack_int ihi_ = to_lapack_int( ihi );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "orghr", double, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
     LAPACK_dorghr(
         &n_, &ilo_, &ihi_,
         A, &lda_,
         tau,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
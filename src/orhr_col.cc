@@ -32,6 +32,7 @@ int64_t orhr_col(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldt_ = to_lapack_int( ldt );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "orhr_col", float, m, n, 0, 0, info_ );
 
     // Work around bug in LAPACK <= 3.12. See https://github.com/Reference-LAPACK/lapack/pull/1018
     nb_ = min( nb_, n );
@@ -146,6 +147,7 @@ int64_t orhr_col(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldt_ = to_lapack_int( ldt );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "orhr_col", double, m, n, 0, 0, info_ );
 
     // Work around bug in LAPACK <= 3.12. See https://github.com/Reference-LAPACK/lapack/pull/1018
     nb_ = min( nb_, n );
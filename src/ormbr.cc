@@ -24,6 +24,57 @@ int64_t ormbr(
     float const* tau,
     float* C, int64_t ldc )
 {
+    // query for workspace size
+    int64_t lwork;
+    ormbr_work_size(
+        vect, side, trans, m, n, k, A, lda, tau, C, ldc,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return ormbr(
+        vect, side, trans, m, n, k, A, lda, tau, C, ldc,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::unmbr
+/// @ingroup gesvd_computational
+int64_t ormbr(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc )
+{
+    // query for workspace size
+    int64_t lwork;
+    ormbr_work_size(
+        vect, side, trans, m, n, k, A, lda, tau, C, ldc,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return ormbr(
+        vect, side, trans, m, n, k, A, lda, tau, C, ldc,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd_computational
+void ormbr_work_size(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "sormbr", vect, side, trans, m, n, k, lda, ldc );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
@@ -38,7 +89,6 @@ int64_t ormbr(
     lapack_int ldc_ = to_lapack_int( ldc );
     lapack_int info_ = 0;
 
-    // query for workspace size
     float qry_work[1];
     lapack_int ineg_one = -1;
     LAPACK_sormbr(
@@ -51,32 +101,62 @@ int64_t ormbr(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd_computational
+void ormbr_work_size(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "dormbr", vect, side, trans, m, n, k, lda, ldc );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
 
-    LAPACK_sormbr(
+    // for real, map ConjTrans to Trans
+    if (trans == Op::ConjTrans)
+        trans = Op::Trans;
+
+    char vect_ = to_char( vect );
+    char side_ = to_char( side );
+    char trans_ = to_char( trans );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int k_ = to_lapack_int( k );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldc_ = to_lapack_int( ldc );
+    lapack_int info_ = 0;
+
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dormbr(
         &vect_, &side_, &trans_, &m_, &n_, &k_,
         A, &lda_,
         tau,
         C, &ldc_,
-        &work[0], &lwork_, &info_
+        qry_work, &ineg_one, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    return info_;
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
 }
 
 // -----------------------------------------------------------------------------
-/// @see lapack::unmbr
 /// @ingroup gesvd_computational
 int64_t ormbr(
     lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    double const* A, int64_t lda,
-    double const* tau,
-    double* C, int64_t ldc )
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    float* work, int64_t lwork )
 {
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
@@ -91,31 +171,53 @@ int64_t ormbr(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldc_ = to_lapack_int( ldc );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ormbr", float, m, n, k, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dormbr(
+    LAPACK_sormbr(
         &vect_, &side_, &trans_, &m_, &n_, &k_,
         A, &lda_,
         tau,
         C, &ldc_,
-        qry_work, &ineg_one, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd_computational
+int64_t ormbr(
+    lapack::Vect vect, lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    double* work, int64_t lwork )
+{
+    // for real, map ConjTrans to Trans
+    if (trans == Op::ConjTrans)
+        trans = Op::Trans;
+
+    char vect_ = to_char( vect );
+    char side_ = to_char( side );
+    char trans_ = to_char( trans );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int k_ = to_lapack_int( k );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldc_ = to_lapack_int( ldc );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ormbr", double, m, n, k, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
     LAPACK_dormbr(
         &vect_, &side_, &trans_, &m_, &n_, &k_,
         A, &lda_,
         tau,
         C, &ldc_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -23,6 +23,54 @@ int64_t ormhr(
     float const* tau,
     float* C, int64_t ldc )
 {
+    // query for workspace size
+    int64_t lwork;
+    ormhr_work_size(
+        side, trans, m, n, ilo, ihi, A, lda, tau, C, ldc,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return ormhr(
+        side, trans, m, n, ilo, ihi, A, lda, tau, C, ldc,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ormhr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc )
+{
+    // query for workspace size
+    int64_t lwork;
+    ormhr_work_size(
+        side, trans, m, n, ilo, ihi, A, lda, tau, C, ldc,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return ormhr(
+        side, trans, m, n, ilo, ihi, A, lda, tau, C, ldc,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+void ormhr_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "sormhr", side, trans, m, n, ilo, ihi, lda, ldc );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
@@ -37,7 +85,6 @@ int64_t ormhr(
     lapack_int ldc_ = to_lapack_int( ldc );
     lapack_int info_ = 0;
 
-    // query for workspace size
     float qry_work[1];
     lapack_int ineg_one = -1;
     LAPACK_sormhr(
@@ -50,30 +97,60 @@ int64_t ormhr(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+void ormhr_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "dormhr", side, trans, m, n, ilo, ihi, lda, ldc );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
 
-    LAPACK_sormhr(
+    // for real, map ConjTrans to Trans
+    if (trans == Op::ConjTrans)
+        trans = Op::Trans;
+
+    char side_ = to_char( side );
+    char trans_ = to_char( trans );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ilo_ = to_lapack_int( ilo );
+    lapack_int ihi_ = to_lapack_int( ihi );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldc_ = to_lapack_int( ldc );
+    lapack_int info_ = 0;
+
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dormhr(
         &side_, &trans_, &m_, &n_, &ilo_, &ihi_,
         A, &lda_,
         tau,
         C, &ldc_,
-        &work[0], &lwork_, &info_
+        qry_work, &ineg_one, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    return info_;
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
 }
 
 // -----------------------------------------------------------------------------
 int64_t ormhr(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
-    double const* A, int64_t lda,
-    double const* tau,
-    double* C, int64_t ldc )
+    float const* A, int64_t lda,
+    float const* tau,
+    float* C, int64_t ldc,
+    float* work, int64_t lwork )
 {
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
@@ -88,31 +165,52 @@ int64_t ormhr(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldc_ = to_lapack_int( ldc );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ormhr", float, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dormhr(
+    LAPACK_sormhr(
         &side_, &trans_, &m_, &n_, &ilo_, &ihi_,
         A, &lda_,
         tau,
         C, &ldc_,
-        qry_work, &ineg_one, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+int64_t ormhr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t ilo, int64_t ihi,
+    double const* A, int64_t lda,
+    double const* tau,
+    double* C, int64_t ldc,
+    double* work, int64_t lwork )
+{
+    // for real, map ConjTrans to Trans
+    if (trans == Op::ConjTrans)
+        trans = Op::Trans;
+
+    char side_ = to_char( side );
+    char trans_ = to_char( trans );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ilo_ = to_lapack_int( ilo );
+    lapack_int ihi_ = to_lapack_int( ihi );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldc_ = to_lapack_int( ldc );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ormhr", double, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
     LAPACK_dormhr(
         &side_, &trans_, &m_, &n_, &ilo_, &ihi_,
         A, &lda_,
         tau,
         C, &ldc_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
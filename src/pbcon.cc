@@ -28,6 +28,7 @@ int64_t pbcon(
     lapack_int kd_ = to_lapack_int( kd );
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pbcon", float, 0, n, kd, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (3*n) );
@@ -57,6 +58,7 @@ int64_t pbcon(
     lapack_int kd_ = to_lapack_int( kd );
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pbcon", double, 0, n, kd, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (3*n) );
@@ -86,6 +88,7 @@ int64_t pbcon(
     lapack_int kd_ = to_lapack_int( kd );
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pbcon", std::complex<float>, 0, n, kd, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
@@ -160,6 +163,7 @@ int64_t pbcon(
     lapack_int kd_ = to_lapack_int( kd );
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pbcon", std::complex<double>, 0, n, kd, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
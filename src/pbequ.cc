@@ -29,6 +29,7 @@ int64_t pbequ(
     lapack_int kd_ = to_lapack_int( kd );
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pbequ", float, 0, n, kd, 0, info_ );
 
     LAPACK_spbequ(
         &uplo_, &n_, &kd_,
@@ -55,6 +56,7 @@ int64_t pbequ(
     lapack_int kd_ = to_lapack_int( kd );
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pbequ", double, 0, n, kd, 0, info_ );
 
     LAPACK_dpbequ(
         &uplo_, &n_, &kd_,
@@ -81,6 +83,7 @@ int64_t pbequ(
     lapack_int kd_ = to_lapack_int( kd );
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pbequ", std::complex<float>, 0, n, kd, 0, info_ );
 
     LAPACK_cpbequ(
         &uplo_, &n_, &kd_,
@@ -159,6 +162,7 @@ int64_t pbequ(
     lapack_int kd_ = to_lapack_int( kd );
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pbequ", std::complex<double>, 0, n, kd, 0, info_ );
 
     LAPACK_zpbequ(
         &uplo_, &n_, &kd_,
@@ -26,6 +26,7 @@ int64_t pbstf(
     lapack_int kd_ = to_lapack_int( kd );
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pbstf", float, 0, n, kd, 0, info_ );
 
     LAPACK_spbstf(
         &uplo_, &n_, &kd_,
@@ -48,6 +49,7 @@ int64_t pbstf(
     lapack_int kd_ = to_lapack_int( kd );
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pbstf", double, 0, n, kd, 0, info_ );
 
     LAPACK_dpbstf(
         &uplo_, &n_, &kd_,
@@ -70,6 +72,7 @@ int64_t pbstf(
     lapack_int kd_ = to_lapack_int( kd );
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pbstf", std::complex<float>, 0, n, kd, 0, info_ );
 
     LAPACK_cpbstf(
         &uplo_, &n_, &kd_,
@@ -188,6 +191,7 @@ int64_t pbstf(
     lapack_int kd_ = to_lapack_int( kd );
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pbstf", std::complex<double>, 0, n, kd, 0, info_ );
 
     LAPACK_zpbstf(
         &uplo_, &n_, &kd_,
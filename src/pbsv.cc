@@ -29,6 +29,7 @@ int64_t pbsv(
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pbsv", float, 0, n, kd, nrhs, info_ );
 
     LAPACK_spbsv(
         &uplo_, &n_, &kd_, &nrhs_,
@@ -55,6 +56,7 @@ int64_t pbsv(
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pbsv", double, 0, n, kd, nrhs, info_ );
 
     LAPACK_dpbsv(
         &uplo_, &n_, &kd_, &nrhs_,
@@ -81,6 +83,7 @@ int64_t pbsv(
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pbsv", std::complex<float>, 0, n, kd, nrhs, info_ );
 
     LAPACK_cpbsv(
         &uplo_, &n_, &kd_, &nrhs_,
@@ -195,6 +198,7 @@ int64_t pbsv(
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pbsv", std::complex<double>, 0, n, kd, nrhs, info_ );
 
     LAPACK_zpbsv(
         &uplo_, &n_, &kd_, &nrhs_,
@@ -26,6 +26,7 @@ int64_t pbtrf(
     lapack_int kd_ = to_lapack_int( kd );
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pbtrf", float, 0, n, kd, 0, info_ );
 
     LAPACK_spbtrf(
         &uplo_, &n_, &kd_,
@@ -48,6 +49,7 @@ int64_t pbtrf(
     lapack_int kd_ = to_lapack_int( kd );
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pbtrf", double, 0, n, kd, 0, info_ );
 
     LAPACK_dpbtrf(
         &uplo_, &n_, &kd_,
@@ -70,6 +72,7 @@ int64_t pbtrf(
     lapack_int kd_ = to_lapack_int( kd );
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pbtrf", std::complex<float>, 0, n, kd, 0, info_ );
 
     LAPACK_cpbtrf(
         &uplo_, &n_, &kd_,
@@ -158,6 +161,7 @@ int64_t pbtrf(
     lapack_int kd_ = to_lapack_int( kd );
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pbtrf", std::complex<double>, 0, n, kd, 0, info_ );
 
     LAPACK_zpbtrf(
         &uplo_, &n_, &kd_,
@@ -29,6 +29,7 @@ int64_t pbtrs(
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pbtrs", float, 0, n, kd, nrhs, info_ );
 
     LAPACK_spbtrs(
         &uplo_, &n_, &kd_, &nrhs_,
@@ -55,6 +56,7 @@ int64_t pbtrs(
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pbtrs", double, 0, n, kd, nrhs, info_ );
 
     LAPACK_dpbtrs(
         &uplo_, &n_, &kd_, &nrhs_,
@@ -81,6 +83,7 @@ int64_t pbtrs(
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pbtrs", std::complex<float>, 0, n, kd, nrhs, info_ );
 
     LAPACK_cpbtrs(
         &uplo_, &n_, &kd_, &nrhs_,
@@ -152,6 +155,7 @@ int64_t pbtrs(
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pbtrs", std::complex<double>, 0, n, kd, nrhs, info_ );
 
     LAPACK_zpbtrs(
         &uplo_, &n_, &kd_, &nrhs_,
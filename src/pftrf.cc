@@ -24,6 +24,7 @@ int64_t pftrf(
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pftrf", float, 0, n, 0, 0, info_ );
 
     LAPACK_spftrf(
         &transr_, &uplo_, &n_,
@@ -44,6 +45,7 @@ int64_t pftrf(
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pftrf", double, 0, n, 0, 0, info_ );
 
     LAPACK_dpftrf(
         &transr_, &uplo_, &n_,
@@ -64,6 +66,7 @@ int64_t pftrf(
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pftrf", std::complex<float>, 0, n, 0, 0, info_ );
 
     LAPACK_cpftrf(
         &transr_, &uplo_, &n_,
@@ -84,6 +87,7 @@ int64_t pftrf(
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pftrf", std::complex<double>, 0, n, 0, 0, info_ );
 
     LAPACK_zpftrf(
         &transr_, &uplo_, &n_,
@@ -24,6 +24,7 @@ int64_t pftri(
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pftri", float, 0, n, 0, 0, info_ );
 
     LAPACK_spftri(
         &transr_, &uplo_, &n_,
@@ -44,6 +45,7 @@ int64_t pftri(
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pftri", double, 0, n, 0, 0, info_ );
 
     LAPACK_dpftri(
         &transr_, &uplo_, &n_,
@@ -64,6 +66,7 @@ int64_t pftri(
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pftri", std::complex<float>, 0, n, 0, 0, info_ );
 
     LAPACK_cpftri(
         &transr_, &uplo_, &n_,
@@ -84,6 +87,7 @@ int64_t pftri(
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pftri", std::complex<double>, 0, n, 0, 0, info_ );
 
     LAPACK_zpftri(
         &transr_, &uplo_, &n_,
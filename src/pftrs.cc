@@ -27,6 +27,7 @@ int64_t pftrs(
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pftrs", float, 0, n, 0, nrhs, info_ );
 
     LAPACK_spftrs(
         &transr_, &uplo_, &n_, &nrhs_,
@@ -51,6 +52,7 @@ int64_t pftrs(
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pftrs", double, 0, n, 0, nrhs, info_ );
 
     LAPACK_dpftrs(
         &transr_, &uplo_, &n_, &nrhs_,
@@ -75,6 +77,7 @@ int64_t pftrs(
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pftrs", std::complex<float>, 0, n, 0, nrhs, info_ );
 
     LAPACK_cpftrs(
         &transr_, &uplo_, &n_, &nrhs_,
@@ -99,6 +102,7 @@ int64_t pftrs(
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pftrs", std::complex<double>, 0, n, 0, nrhs, info_ );
 
     LAPACK_zpftrs(
         &transr_, &uplo_, &n_, &nrhs_,
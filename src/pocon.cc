@@ -27,6 +27,7 @@ int64_t pocon(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pocon", float, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (3*n) );
@@ -55,6 +56,7 @@ int64_t pocon(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pocon", double, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (3*n) );
@@ -83,6 +85,7 @@ int64_t pocon(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pocon", std::complex<float>, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
@@ -146,6 +149,7 @@ int64_t pocon(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pocon", std::complex<double>, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
@@ -27,6 +27,7 @@ int64_t poequ(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "poequ", float, 0, n, 0, 0, info_ );
 
     LAPACK_spoequ(
         &n_,
@@ -50,6 +51,7 @@ int64_t poequ(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "poequ", double, 0, n, 0, 0, info_ );
 
     LAPACK_dpoequ(
         &n_,
@@ -73,6 +75,7 @@ int64_t poequ(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "poequ", std::complex<float>, 0, n, 0, 0, info_ );
 
     LAPACK_cpoequ(
         &n_,
@@ -137,6 +140,7 @@ int64_t poequ(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "poequ", std::complex<double>, 0, n, 0, 0, info_ );
 
     LAPACK_zpoequ(
         &n_,
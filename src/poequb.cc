@@ -27,6 +27,7 @@ int64_t poequb(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "poequb", float, 0, n, 0, 0, info_ );
 
     LAPACK_spoequb(
         &n_,
@@ -50,6 +51,7 @@ int64_t poequb(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "poequb", double, 0, n, 0, 0, info_ );
 
     LAPACK_dpoequb(
         &n_,
@@ -73,6 +75,7 @@ int64_t poequb(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "poequb", std::complex<float>, 0, n, 0, 0, info_ );
 
     LAPACK_cpoequb(
         &n_,
@@ -143,6 +146,7 @@ int64_t poequb(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "poequb", std::complex<double>, 0, n, 0, 0, info_ );
 
     LAPACK_zpoequb(
         &n_,
@@ -44,6 +44,7 @@ int64_t porfsx(
     lapack_int n_err_bnds_ = to_lapack_int( n_err_bnds );
     lapack_int nparams_ = to_lapack_int( nparams );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "porfsx", float, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (4*n) );
@@ -95,6 +96,7 @@ int64_t porfsx(
     lapack_int n_err_bnds_ = to_lapack_int( n_err_bnds );
     lapack_int nparams_ = to_lapack_int( nparams );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "porfsx", double, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (4*n) );
@@ -146,6 +148,7 @@ int64_t porfsx(
     lapack_int n_err_bnds_ = to_lapack_int( n_err_bnds );
     lapack_int nparams_ = to_lapack_int( nparams );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "porfsx", std::complex<float>, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
@@ -457,6 +460,7 @@ int64_t porfsx(
     lapack_int n_err_bnds_ = to_lapack_int( n_err_bnds );
     lapack_int nparams_ = to_lapack_int( nparams );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "porfsx", std::complex<double>, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
@@ -29,6 +29,7 @@ int64_t posv(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "posv", float, 0, n, 0, nrhs, info_ );
 
     LAPACK_sposv(
         &uplo_, &n_, &nrhs_,
@@ -54,6 +55,7 @@ int64_t posv(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "posv", double, 0, n, 0, nrhs, info_ );
 
     LAPACK_dposv(
         &uplo_, &n_, &nrhs_,
@@ -79,6 +81,7 @@ int64_t posv(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "posv", std::complex<float>, 0, n, 0, nrhs, info_ );
 
     LAPACK_cposv(
         &uplo_, &n_, &nrhs_,
@@ -163,6 +166,7 @@ int64_t posv(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "posv", std::complex<double>, 0, n, 0, nrhs, info_ );
 
     LAPACK_zposv(
         &uplo_, &n_, &nrhs_,
@@ -191,6 +195,7 @@ int64_t posv(
     lapack_int ldx_ = to_lapack_int( ldx );
     lapack_int iter_ = 0;  // out
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "posv", double, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (n)*(nrhs) );
@@ -227,6 +232,7 @@ int64_t posv(
     lapack_int ldx_ = to_lapack_int( ldx );
     lapack_int iter_ = 0;  // out
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "posv", std::complex<double>, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (n)*(nrhs) );
@@ -249,4 +255,91 @@ int64_t posv(
     return info_;
 }
 
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper for either layout.
+/// @ingroup posv
+///
+template <typename scalar_t>
+int64_t posv(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t* A, int64_t lda,
+    scalar_t* B, int64_t ldb )
+{
+    if (layout == Layout::ColMajor)
+        return lapack::posv( uplo, n, nrhs, A, lda, B, ldb );
+
+    lapack_error_if( layout != Layout::RowMajor );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( ldb < max( 1, nrhs ) );
+
+    int64_t info = lapack::potrf( layout, uplo, n, A, lda );
+    if (info == 0) {
+        lapack::potrs( layout, uplo, n, nrhs, A, lda, B, ldb );
+    }
+    return info;
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// @ingroup posv
+int64_t posv(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb )
+{
+    return impl::posv( layout, uplo, n, nrhs, A, lda, B, ldb );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup posv
+int64_t posv(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb )
+{
+    return impl::posv( layout, uplo, n, nrhs, A, lda, B, ldb );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup posv
+int64_t posv(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb )
+{
+    return impl::posv( layout, uplo, n, nrhs, A, lda, B, ldb );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::posv that takes the matrix layout.
+/// For row-major layout, A, its factor, B, and X are stored row-major.
+/// Calls lapack::potrf and lapack::potrs with the same layout,
+/// so nothing is copied.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// Other arguments are the same as for lapack::posv.
+///
+/// @param[in] layout
+///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B.
+///     If layout = ColMajor, ldb >= max(1,n);
+///     if layout = RowMajor, ldb >= max(1,nrhs).
+///
+/// @ingroup posv
+int64_t posv(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb )
+{
+    return impl::posv( layout, uplo, n, nrhs, A, lda, B, ldb );
+}
+
 }  // namespace lapack
@@ -0,0 +1,330 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/batch.hh"
+#include "lapack_internal.hh"
+#include "lapack/fortran.h"
+#include "potrf_native.hh"
+
+namespace lapack {
+
+using blas::max;
+
+//==============================================================================
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, float version.
+/// @ingroup posv_batch_internal
+inline void posv(
+    char uplo, lapack_int n, lapack_int nrhs,
+    float* A, lapack_int lda,
+    float* B, lapack_int ldb,
+    lapack_int* info )
+{
+    LAPACK_sposv( &uplo, &n, &nrhs, A, &lda, B, &ldb, info );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, double version.
+/// @ingroup posv_batch_internal
+inline void posv(
+    char uplo, lapack_int n, lapack_int nrhs,
+    double* A, lapack_int lda,
+    double* B, lapack_int ldb,
+    lapack_int* info )
+{
+    LAPACK_dposv( &uplo, &n, &nrhs, A, &lda, B, &ldb, info );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, complex<float> version.
+/// @ingroup posv_batch_internal
+inline void posv(
+    char uplo, lapack_int n, lapack_int nrhs,
+    std::complex<float>* A, lapack_int lda,
+    std::complex<float>* B, lapack_int ldb,
+    lapack_int* info )
+{
+    LAPACK_cposv(
+        &uplo, &n, &nrhs,
+        (lapack_complex_float*) A, &lda,
+        (lapack_complex_float*) B, &ldb, info );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, complex<double> version.
+/// @ingroup posv_batch_internal
+inline void posv(
+    char uplo, lapack_int n, lapack_int nrhs,
+    std::complex<double>* A, lapack_int lda,
+    std::complex<double>* B, lapack_int ldb,
+    lapack_int* info )
+{
+    LAPACK_zposv(
+        &uplo, &n, &nrhs,
+        (lapack_complex_double*) A, &lda,
+        (lapack_complex_double*) B, &ldb, info );
+}
+
+}  // namespace internal
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks and converts arguments once,
+/// then factors and solves each system in parallel.
+/// For n <= potrf_native_max, uses native kernels; otherwise,
+/// calls low-level wrapper.
+/// Aarray(i) and Barray(i) return pointers to the i-th matrix and
+/// right-hand sides.
+/// @ingroup posv_batch_internal
+///
+template <typename scalar_t, typename Aarray_t, typename Barray_t>
+void posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    Aarray_t Aarray, int64_t lda,
+    Barray_t Barray, int64_t ldb,
+    int64_t batch_count, int64_t* info )
+{
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( ldb < max( 1, n ) );
+    lapack_error_if( batch_count < 0 );
+
+    if (n <= internal::potrf_native_max) {
+        #pragma omp parallel for schedule( static ) if (batch_count > 1)
+        for (int64_t i = 0; i < batch_count; ++i) {
+            scalar_t* A = Aarray( i );
+            int64_t info_ = internal::potrf_native( uplo, n, A, lda );
+            if (info_ == 0) {
+                internal::potrs_native( uplo, n, nrhs, A, lda,
+                                        Barray( i ), ldb );
+            }
+            info[ i ] = info_;
+        }
+    }
+    else {
+        char uplo_ = to_char( uplo );
+        lapack_int n_ = to_lapack_int( n );
+        lapack_int nrhs_ = to_lapack_int( nrhs );
+        lapack_int lda_ = to_lapack_int( lda );
+        lapack_int ldb_ = to_lapack_int( ldb );
+
+        #pragma omp parallel for schedule( static ) if (batch_count > 1)
+        for (int64_t i = 0; i < batch_count; ++i) {
+            lapack_int info_ = 0;
+            internal::posv(
+                uplo_, n_, nrhs_, Aarray( i ), lda_, Barray( i ), ldb_,
+                &info_ );
+            info[ i ] = info_;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Strided version.
+/// @ingroup posv_batch_internal
+///
+template <typename scalar_t>
+void posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t* A, int64_t lda, int64_t strideA,
+    scalar_t* B, int64_t ldb, int64_t strideB,
+    int64_t batch_count, int64_t* info )
+{
+    if (batch_count > 1) {
+        lapack_error_if( strideA < lda*n );
+        lapack_error_if( strideB < ldb*nrhs );
+    }
+
+    posv_batch< scalar_t >(
+        uplo, n, nrhs,
+        [=]( int64_t i ) { return A + i*strideA; }, lda,
+        [=]( int64_t i ) { return B + i*strideB; }, ldb,
+        batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// Pointer-array version.
+/// @ingroup posv_batch_internal
+///
+template <typename scalar_t>
+void posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t* const* Aarray, int64_t lda,
+    scalar_t* const* Barray, int64_t ldb,
+    int64_t batch_count, int64_t* info )
+{
+    posv_batch< scalar_t >(
+        uplo, n, nrhs,
+        [=]( int64_t i ) { return Aarray[ i ]; }, lda,
+        [=]( int64_t i ) { return Barray[ i ]; }, ldb,
+        batch_count, info );
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// @ingroup posv_batch
+void posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda, int64_t strideA,
+    float* B, int64_t ldb, int64_t strideB,
+    int64_t batch_count, int64_t* info )
+{
+    impl::posv_batch( uplo, n, nrhs, A, lda, strideA,
+                      B, ldb, strideB, batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv_batch
+void posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda, int64_t strideA,
+    double* B, int64_t ldb, int64_t strideB,
+    int64_t batch_count, int64_t* info )
+{
+    impl::posv_batch( uplo, n, nrhs, A, lda, strideA,
+                      B, ldb, strideB, batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv_batch
+void posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_count, int64_t* info )
+{
+    impl::posv_batch( uplo, n, nrhs, A, lda, strideA,
+                      B, ldb, strideB, batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// Computes the solutions to a batch of systems of linear equations
+/// $A_i X_i = B_i$, where each A_i is an n-by-n Hermitian positive
+/// definite matrix, as in lapack::posv. Systems are solved in parallel
+/// using OpenMP. For small n (n <= 32), native unrolled kernels are used
+/// instead of calling LAPACK for each system.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`,
+/// for both strided storage (shown here) and pointer-array storage:
+///
+///     posv_batch( uplo, n, nrhs, Aarray, lda, Barray, ldb,
+///                 batch_count, info )
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangle of each A_i is stored;
+///     - lapack::Uplo::Lower: Lower triangle of each A_i is stored.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., columns of each B_i. nrhs >= 0.
+///
+/// @param[in,out] A
+///     The batch of n-by-n matrices, each stored in an lda-by-n array,
+///     with A_i starting at A + i*strideA.
+///     On successful exit, the factor U_i or L_i from the Cholesky
+///     factorization, as in lapack::potrf_batch.
+///
+/// @param[in] lda
+///     The leading dimension of each A_i. lda >= max(1,n).
+///
+/// @param[in] strideA
+///     Distance between the starts of consecutive matrices.
+///     strideA >= lda*n.
+///
+/// @param[in,out] B
+///     The batch of n-by-nrhs right hand side matrices,
+///     each stored in an ldb-by-nrhs array, with B_i starting at
+///     B + i*strideB. On successful exit, the solution matrices X_i.
+///
+/// @param[in] ldb
+///     The leading dimension of each B_i. ldb >= max(1,n).
+///
+/// @param[in] strideB
+///     Distance between the starts of consecutive right hand sides.
+///     strideB >= ldb*nrhs.
+///
+/// @param[in] batch_count
+///     The number of systems. batch_count >= 0.
+///
+/// @param[out] info
+///     The vector info of length batch_count.
+///     As for the return value of lapack::posv:
+///     - info[ i ] = 0: successful exit.
+///     - info[ i ] = j > 0: the leading minor of order j of A_i is not
+///       positive definite, so the factorization could not be completed,
+///       and the solution X_i has not been computed.
+///
+/// Invalid arguments throw lapack::Error.
+///
+/// @ingroup posv_batch
+void posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_count, int64_t* info )
+{
+    impl::posv_batch( uplo, n, nrhs, A, lda, strideA,
+                      B, ldb, strideB, batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv_batch
+void posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* const* Aarray, int64_t lda,
+    float* const* Barray, int64_t ldb,
+    int64_t batch_count, int64_t* info )
+{
+    impl::posv_batch( uplo, n, nrhs, Aarray, lda, Barray, ldb,
+                      batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv_batch
+void posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* const* Aarray, int64_t lda,
+    double* const* Barray, int64_t ldb,
+    int64_t batch_count, int64_t* info )
+{
+    impl::posv_batch( uplo, n, nrhs, Aarray, lda, Barray, ldb,
+                      batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv_batch
+void posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* const* Aarray, int64_t lda,
+    std::complex<float>* const* Barray, int64_t ldb,
+    int64_t batch_count, int64_t* info )
+{
+    impl::posv_batch( uplo, n, nrhs, Aarray, lda, Barray, ldb,
+                      batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv_batch
+void posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* const* Aarray, int64_t lda,
+    std::complex<double>* const* Barray, int64_t ldb,
+    int64_t batch_count, int64_t* info )
+{
+    impl::posv_batch( uplo, n, nrhs, Aarray, lda, Barray, ldb,
+                      batch_count, info );
+}
+
+}  // namespace lapack
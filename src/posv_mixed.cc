@@ -0,0 +1,242 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "mixed_refine.hh"
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+using blas::real;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks arguments, factors A in the inner
+/// precision, refines each column of X, and falls back to
+/// potrf and potrs in working precision if needed.
+/// @ingroup posv
+///
+template <typename scalar_t>
+int64_t posv_mixed(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t const* A, int64_t lda,
+    scalar_t const* B, int64_t ldb,
+    scalar_t* X, int64_t ldx,
+    RefineOptions const& opts,
+    RefineInfo* rinfo )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using inner_t = internal::inner_t< scalar_t >;
+
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( ldb < max( 1, n ) );
+    lapack_error_if( ldx < max( 1, n ) );
+    lapack_error_if( opts.max_iter < 0 );
+    lapack_error_if( opts.gmres_max_iter < 1 );
+
+    RefineInfo rinfo_local;
+    if (rinfo == nullptr)
+        rinfo = &rinfo_local;
+    *rinfo = RefineInfo();
+
+    if (n == 0 || nrhs == 0) {
+        rinfo->converged = true;
+        return 0;
+    }
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = (opts.tol > 0 ? real_t( opts.tol ) : std::sqrt( real_t( n ) ) * eps);
+    real_t Anorm = lapack::lanhe( Norm::Inf, uplo, n, A, lda );
+
+    // Factor s A = L L^H or U^H U in the inner precision.
+    real_t s = internal::inner_scale( opts.precision,
+                                      lapack::lanhe( Norm::Max, uplo, n, A, lda ) );
+    lapack::vector< inner_t > L( n*n ), w( n );
+    int64_t iter = 0;
+    if (! internal::to_inner( opts.precision, uplo, n, n,
+                              A, lda, s, &L[0], n )) {
+        iter = -2;
+    }
+    else if (lapack::potrf( uplo, n, &L[0], n ) != 0
+             || ! internal::round_inner( opts.precision, uplo,
+                                         n, n, &L[0], n )) {
+        iter = -3;
+    }
+
+    if (iter == 0) {
+        // v = A^{-1} v = s (s A)^{-1} v, normalizing v to avoid overflow.
+        auto precond = [&]( scalar_t* v ) {
+            real_t vmax = lapack::lange( Norm::Max, n, 1, v, n );
+            if (vmax == 0)
+                return;
+            for (int64_t i = 0; i < n; ++i)
+                w[ i ] = inner_t( v[ i ] / vmax );
+            lapack::potrs( uplo, n, 1, &L[0], n, &w[0], n );
+            for (int64_t i = 0; i < n; ++i)
+                v[ i ] = scalar_t( w[ i ] ) * (s * vmax);
+        };
+        auto op = [&]( scalar_t const* v, scalar_t* y ) {
+            blas::hemv( Layout::ColMajor, uplo, n,
+                        1.0, A, lda, v, 1, 0.0, y, 1 );
+        };
+        auto residual = [&]( int64_t j, scalar_t const* x, scalar_t* r ) {
+            std::copy( &B[ j*ldb ], &B[ j*ldb + n ], r );
+            blas::hemv( Layout::ColMajor, uplo, n,
+                        -1.0, A, lda, x, 1, 1.0, r, 1 );
+            return Anorm * lapack::lange( Norm::Max, n, 1, x, n );
+        };
+
+        for (int64_t j = 0; j < nrhs; ++j) {
+            std::copy( &B[ j*ldb ], &B[ j*ldb + n ], &X[ j*ldx ] );
+            precond( &X[ j*ldx ] );
+        }
+        iter = internal::refine_columns( opts, n, nrhs, X, ldx, tol,
+                                         residual, op, precond, rinfo );
+    }
+    rinfo->iter = iter;
+
+    if (iter >= 0 || (iter == -31 && ! opts.fallback))
+        return 0;
+
+    // Fall back to working precision.
+    lapack::vector< scalar_t > A_work( n*n );
+    MatrixType type = (uplo == Uplo::Upper ? MatrixType::Upper : MatrixType::Lower);
+    lapack::lacpy( type, n, n, A, lda, &A_work[0], n );
+    int64_t info = lapack::potrf( uplo, n, &A_work[0], n );
+    if (info == 0) {
+        lapack::lacpy( MatrixType::General, n, nrhs, B, ldb, X, ldx );
+        lapack::potrs( uplo, n, nrhs, &A_work[0], n, X, ldx );
+    }
+    return info;
+}
+
+}  // namespace impl
+
+//==============================================================================
+// -----------------------------------------------------------------------------
+/// @ingroup posv
+int64_t posv_mixed(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    RefineOptions const& opts,
+    RefineInfo* rinfo )
+{
+    return impl::posv_mixed( uplo, n, nrhs, A, lda, B, ldb, X, ldx, opts, rinfo );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup posv
+int64_t posv_mixed(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    RefineOptions const& opts,
+    RefineInfo* rinfo )
+{
+    return impl::posv_mixed( uplo, n, nrhs, A, lda, B, ldb, X, ldx, opts, rinfo );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup posv
+int64_t posv_mixed(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    RefineOptions const& opts,
+    RefineInfo* rinfo )
+{
+    return impl::posv_mixed( uplo, n, nrhs, A, lda, B, ldb, X, ldx, opts, rinfo );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes the solution to a system of linear equations
+/// \[
+///     A X = B,
+/// \]
+/// where A is an n-by-n Hermitian positive definite matrix and X and B
+/// are n-by-nrhs matrices, using a Cholesky factorization in a lower
+/// inner precision with iterative refinement in working precision.
+///
+/// This is the Cholesky analog of lapack::gesv_mixed, and generalizes
+/// the mixed-precision lapack::posv that calls LAPACK dsposv or zcposv.
+/// With opts.method = GMRES, each correction is computed by GMRES
+/// preconditioned by the low-precision Cholesky factor. If A is not
+/// positive definite after rounding to the inner precision, the inner
+/// factorization fails and A is refactored in working precision.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangle of A is stored;
+///     - lapack::Uplo::Lower: Lower triangle of A is stored.
+///
+/// @param[in] n
+///     The number of linear equations, i.e., the order of the
+///     matrix A. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns
+///     of the matrix B. nrhs >= 0.
+///
+/// @param[in] A
+///     The n-by-n Hermitian matrix A, stored in an lda-by-n array.
+///     Only the uplo triangle is referenced. A is not modified.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[in] B
+///     The n-by-nrhs right hand side matrix B, stored in an ldb-by-nrhs array.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= max(1,n).
+///
+/// @param[out] X
+///     The n-by-nrhs matrix X, stored in an ldx-by-nrhs array.
+///     If return value = 0, the n-by-nrhs solution matrix X.
+///
+/// @param[in] ldx
+///     The leading dimension of the array X. ldx >= max(1,n).
+///
+/// @param[in] opts
+///     Inner precision, refinement method, tolerance, and limits;
+///     see lapack::RefineOptions.
+///
+/// @param[out] rinfo
+///     If not null, the number of refinement steps and GMRES iterations,
+///     whether refinement converged, and the final backward error;
+///     see lapack::RefineInfo.
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, the leading minor of order i of A,
+///     in working precision, is not positive definite, so the
+///     factorization could not be completed, and the solution has not
+///     been computed.
+///
+/// @ingroup posv
+int64_t posv_mixed(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    RefineOptions const& opts,
+    RefineInfo* rinfo )
+{
+    return impl::posv_mixed( uplo, n, nrhs, A, lda, B, ldb, X, ldx, opts, rinfo );
+}
+
+}  // namespace lapack
@@ -25,6 +25,7 @@ int64_t potf2(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "potf2", float, 0, n, 0, 0, info_ );
 
     LAPACK_spotf2(
         &uplo_, &n_,
@@ -46,6 +47,7 @@ int64_t potf2(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "potf2", double, 0, n, 0, 0, info_ );
 
     LAPACK_dpotf2(
         &uplo_, &n_,
@@ -67,6 +69,7 @@ int64_t potf2(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "potf2", std::complex<float>, 0, n, 0, 0, info_ );
 
     LAPACK_cpotf2(
         &uplo_, &n_,
@@ -133,6 +136,7 @@ int64_t potf2(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "potf2", std::complex<double>, 0, n, 0, 0, info_ );
 
     LAPACK_zpotf2(
         &uplo_, &n_,
@@ -21,6 +21,11 @@ int64_t potrf(
     lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda )
 {
+    int64_t info = 0;
+    LAPACK_TRACE_BLOCK( "potrf", float, 0, n, 0, 0, info );
+    if (internal::potrf_dispatch( uplo, n, A, lda, &info ))
+        return info;
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -30,10 +35,11 @@ int64_t potrf(
         &uplo_, &n_,
         A, &lda_, &info_
     );
+    info = info_;
     if (info_ < 0) {
         throw Error();
     }
-    return info_;
+    return info;
 }
 
 // -----------------------------------------------------------------------------
@@ -42,6 +48,11 @@ int64_t potrf(
     lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda )
 {
+    int64_t info = 0;
+    LAPACK_TRACE_BLOCK( "potrf", double, 0, n, 0, 0, info );
+    if (internal::potrf_dispatch( uplo, n, A, lda, &info ))
+        return info;
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -51,10 +62,11 @@ int64_t potrf(
         &uplo_, &n_,
         A, &lda_, &info_
     );
+    info = info_;
     if (info_ < 0) {
         throw Error();
     }
-    return info_;
+    return info;
 }
 
 // -----------------------------------------------------------------------------
@@ -63,6 +75,11 @@ int64_t potrf(
     lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda )
 {
+    int64_t info = 0;
+    LAPACK_TRACE_BLOCK( "potrf", std::complex<float>, 0, n, 0, 0, info );
+    if (internal::potrf_dispatch( uplo, n, A, lda, &info ))
+        return info;
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -72,10 +89,11 @@ int64_t potrf(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_, &info_
     );
+    info = info_;
     if (info_ < 0) {
         throw Error();
     }
-    return info_;
+    return info;
 }
 
 // -----------------------------------------------------------------------------
@@ -129,6 +147,11 @@ int64_t potrf(
     lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda )
 {
+    int64_t info = 0;
+    LAPACK_TRACE_BLOCK( "potrf", std::complex<double>, 0, n, 0, 0, info );
+    if (internal::potrf_dispatch( uplo, n, A, lda, &info ))
+        return info;
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -138,10 +161,87 @@ int64_t potrf(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_, &info_
     );
+    info = info_;
     if (info_ < 0) {
         throw Error();
     }
-    return info_;
+    return info;
+}
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper for either layout.
+/// @ingroup posv_computational
+///
+template <typename scalar_t>
+int64_t potrf(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda )
+{
+    if (layout == Layout::ColMajor)
+        return lapack::potrf( uplo, n, A, lda );
+
+    lapack_error_if( layout != Layout::RowMajor );
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+
+    // Row-major uplo triangle of A is the column-major opposite triangle
+    // of A^T = conj( A ). If conj( A ) = L L^H, then A = U^H U with
+    // U = L^T, which is L read row-major; likewise for Upper.
+    return lapack::potrf( internal::flip_uplo( uplo ), n, A, lda );
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// @ingroup posv_computational
+int64_t potrf(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda )
+{
+    return impl::potrf( layout, uplo, n, A, lda );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup posv_computational
+int64_t potrf(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda )
+{
+    return impl::potrf( layout, uplo, n, A, lda );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup posv_computational
+int64_t potrf(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda )
+{
+    return impl::potrf( layout, uplo, n, A, lda );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::potrf that takes the matrix layout.
+/// For row-major layout, A and its factor U or L are stored row-major.
+///
+/// For row-major, this factors the column-major A^T = conj( A ) with the
+/// opposite uplo, which gives the same factor in place, with no copies.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// Other arguments are the same as for lapack::potrf.
+///
+/// @param[in] layout
+///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
+///
+/// @ingroup posv_computational
+int64_t potrf(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda )
+{
+    return impl::potrf( layout, uplo, n, A, lda );
 }
 
 }  // namespace lapack
@@ -27,6 +27,7 @@ int64_t potrf2(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "potrf2", float, 0, n, 0, 0, info_ );
 
     LAPACK_spotrf2(
         &uplo_, &n_,
@@ -48,6 +49,7 @@ int64_t potrf2(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "potrf2", double, 0, n, 0, 0, info_ );
 
     LAPACK_dpotrf2(
         &uplo_, &n_,
@@ -69,6 +71,7 @@ int64_t potrf2(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "potrf2", std::complex<float>, 0, n, 0, 0, info_ );
 
     LAPACK_cpotrf2(
         &uplo_, &n_,
@@ -147,6 +150,7 @@ int64_t potrf2(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "potrf2", std::complex<double>, 0, n, 0, 0, info_ );
 
     LAPACK_zpotrf2(
         &uplo_, &n_,
@@ -0,0 +1,270 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/batch.hh"
+#include "lapack_internal.hh"
+#include "lapack/fortran.h"
+#include "potrf_native.hh"
+
+namespace lapack {
+
+using blas::max;
+
+//==============================================================================
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, float version.
+/// @ingroup posv_batch_internal
+inline void potrf(
+    char uplo, lapack_int n,
+    float* A, lapack_int lda,
+    lapack_int* info )
+{
+    LAPACK_spotrf( &uplo, &n, A, &lda, info );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, double version.
+/// @ingroup posv_batch_internal
+inline void potrf(
+    char uplo, lapack_int n,
+    double* A, lapack_int lda,
+    lapack_int* info )
+{
+    LAPACK_dpotrf( &uplo, &n, A, &lda, info );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, complex<float> version.
+/// @ingroup posv_batch_internal
+inline void potrf(
+    char uplo, lapack_int n,
+    std::complex<float>* A, lapack_int lda,
+    lapack_int* info )
+{
+    LAPACK_cpotrf( &uplo, &n, (lapack_complex_float*) A, &lda, info );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, complex<double> version.
+/// @ingroup posv_batch_internal
+inline void potrf(
+    char uplo, lapack_int n,
+    std::complex<double>* A, lapack_int lda,
+    lapack_int* info )
+{
+    LAPACK_zpotrf( &uplo, &n, (lapack_complex_double*) A, &lda, info );
+}
+
+}  // namespace internal
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks and converts arguments once,
+/// then factors each matrix in parallel. For n <= potrf_native_max,
+/// uses native kernels; otherwise, calls low-level wrapper.
+/// Aarray(i) returns a pointer to the i-th matrix.
+/// @ingroup posv_batch_internal
+///
+template <typename scalar_t, typename Aarray_t>
+void potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    Aarray_t Aarray, int64_t lda,
+    int64_t batch_count, int64_t* info )
+{
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( batch_count < 0 );
+
+    if (n <= internal::potrf_native_max) {
+        #pragma omp parallel for schedule( static ) if (batch_count > 1)
+        for (int64_t i = 0; i < batch_count; ++i) {
+            info[ i ] = internal::potrf_native( uplo, n, Aarray( i ), lda );
+        }
+    }
+    else {
+        char uplo_ = to_char( uplo );
+        lapack_int n_ = to_lapack_int( n );
+        lapack_int lda_ = to_lapack_int( lda );
+
+        #pragma omp parallel for schedule( static ) if (batch_count > 1)
+        for (int64_t i = 0; i < batch_count; ++i) {
+            lapack_int info_ = 0;
+            internal::potrf( uplo_, n_, Aarray( i ), lda_, &info_ );
+            info[ i ] = info_;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Strided version: matrix i is A + i*strideA.
+/// @ingroup posv_batch_internal
+///
+template <typename scalar_t>
+void potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda, int64_t strideA,
+    int64_t batch_count, int64_t* info )
+{
+    if (batch_count > 1) {
+        lapack_error_if( strideA < lda*n );
+    }
+
+    potrf_batch< scalar_t >(
+        uplo, n,
+        [=]( int64_t i ) { return A + i*strideA; }, lda,
+        batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// Pointer-array version: matrix i is Aarray[ i ].
+/// @ingroup posv_batch_internal
+///
+template <typename scalar_t>
+void potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* const* Aarray, int64_t lda,
+    int64_t batch_count, int64_t* info )
+{
+    potrf_batch< scalar_t >(
+        uplo, n,
+        [=]( int64_t i ) { return Aarray[ i ]; }, lda,
+        batch_count, info );
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// @ingroup posv_batch
+void potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, int64_t strideA,
+    int64_t batch_count, int64_t* info )
+{
+    impl::potrf_batch( uplo, n, A, lda, strideA, batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv_batch
+void potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, int64_t strideA,
+    int64_t batch_count, int64_t* info )
+{
+    impl::potrf_batch( uplo, n, A, lda, strideA, batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv_batch
+void potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    int64_t batch_count, int64_t* info )
+{
+    impl::potrf_batch( uplo, n, A, lda, strideA, batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// Computes Cholesky factorizations of a batch of Hermitian
+/// positive definite matrices, as in lapack::potrf:
+///     $A_i = U_i^H U_i,$ if uplo = Upper, or
+///     $A_i = L_i L_i^H,$ if uplo = Lower.
+/// Matrices are factored in parallel using OpenMP.
+/// For small n (n <= 32), native unrolled kernels are used instead of
+/// calling LAPACK for each matrix.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`,
+/// for both strided storage (shown here) and pointer-array storage:
+///
+///     potrf_batch( uplo, n, Aarray, lda, batch_count, info )
+///
+/// where matrix i is Aarray[ i ].
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangle of each A_i is stored;
+///     - lapack::Uplo::Lower: Lower triangle of each A_i is stored.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in,out] A
+///     The batch of n-by-n matrices, each stored in an lda-by-n array,
+///     with A_i starting at A + i*strideA.
+///     On successful exit, the factor U_i or L_i.
+///
+/// @param[in] lda
+///     The leading dimension of each A_i. lda >= max(1,n).
+///
+/// @param[in] strideA
+///     Distance between the starts of consecutive matrices.
+///     strideA >= lda*n.
+///
+/// @param[in] batch_count
+///     The number of matrices. batch_count >= 0.
+///
+/// @param[out] info
+///     The vector info of length batch_count.
+///     As for the return value of lapack::potrf:
+///     - info[ i ] = 0: successful exit.
+///     - info[ i ] = j > 0: the leading minor of order j of A_i is not
+///       positive definite, and the factorization could not be completed.
+///
+/// Invalid arguments throw lapack::Error.
+///
+/// @ingroup posv_batch
+void potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    int64_t batch_count, int64_t* info )
+{
+    impl::potrf_batch( uplo, n, A, lda, strideA, batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv_batch
+void potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    float* const* Aarray, int64_t lda,
+    int64_t batch_count, int64_t* info )
+{
+    impl::potrf_batch( uplo, n, Aarray, lda, batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv_batch
+void potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    double* const* Aarray, int64_t lda,
+    int64_t batch_count, int64_t* info )
+{
+    impl::potrf_batch( uplo, n, Aarray, lda, batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv_batch
+void potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* const* Aarray, int64_t lda,
+    int64_t batch_count, int64_t* info )
+{
+    impl::potrf_batch( uplo, n, Aarray, lda, batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv_batch
+void potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* const* Aarray, int64_t lda,
+    int64_t batch_count, int64_t* info )
+{
+    impl::potrf_batch( uplo, n, Aarray, lda, batch_count, info );
+}
+
+}  // namespace lapack
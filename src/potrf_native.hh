@@ -0,0 +1,224 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_POTRF_NATIVE_HH
+#define LAPACK_POTRF_NATIVE_HH
+
+#include "lapack/util.hh"
+
+#include <cmath>
+
+// Native Cholesky kernels for small matrices, used by the batched routines.
+// For small n, the per-call overhead of Fortran potrf, which goes through
+// ilaenv and recursive potrf2, dominates the O(n^3) work.
+
+namespace lapack {
+namespace internal {
+
+/// Largest n for which batched Cholesky routines use the native kernels
+/// instead of calling LAPACK for each matrix.
+const int64_t potrf_native_max = 32;
+
+//------------------------------------------------------------------------------
+/// Unblocked, left-looking Cholesky factorization, with the same
+/// result and info as LAPACK potrf: if the leading minor of order j is
+/// not positive definite, sets A(j, j) to the failed pivot and returns j.
+/// Loops are arranged so the innermost loop runs down a column.
+///
+template <bool upper, typename scalar_t>
+inline int64_t potrf_unblocked( int64_t n, scalar_t* A, int64_t lda )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    for (int64_t j = 0; j < n; ++j) {
+        scalar_t* Aj = &A[ j*lda ];
+        real_t ajj;
+        if constexpr (upper) {
+            // A(j, j) -= U(0:j-1, j)^H U(0:j-1, j)
+            ajj = std::real( Aj[ j ] );
+            for (int64_t k = 0; k < j; ++k)
+                ajj -= std::real( blas::conj( Aj[ k ] ) * Aj[ k ] );
+        }
+        else {
+            // A(j:n-1, j) -= L(j:n-1, 0:j-1) L(j, 0:j-1)^H
+            for (int64_t k = 0; k < j; ++k) {
+                scalar_t const* Ak = &A[ k*lda ];
+                scalar_t ljk = blas::conj( Ak[ j ] );
+                for (int64_t i = j; i < n; ++i)
+                    Aj[ i ] -= Ak[ i ] * ljk;
+            }
+            ajj = std::real( Aj[ j ] );
+        }
+
+        // not (ajj > 0) also catches NaN
+        if (! (ajj > 0)) {
+            Aj[ j ] = ajj;
+            return j + 1;
+        }
+        ajj = std::sqrt( ajj );
+        Aj[ j ] = ajj;
+        real_t rajj = 1 / ajj;
+
+        if constexpr (upper) {
+            // U(j, i) = (A(j, i) - U(0:j-1, j)^H U(0:j-1, i)) / U(j, j)
+            for (int64_t i = j + 1; i < n; ++i) {
+                scalar_t* Ai = &A[ i*lda ];
+                scalar_t uji = Ai[ j ];
+                for (int64_t k = 0; k < j; ++k)
+                    uji -= blas::conj( Aj[ k ] ) * Ai[ k ];
+                Ai[ j ] = uji * rajj;
+            }
+        }
+        else {
+            for (int64_t i = j + 1; i < n; ++i)
+                Aj[ i ] *= rajj;
+        }
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// Fixed-size Cholesky factorization for n = N. Copies the uplo triangle
+/// to a local N-by-N array, factors it, and copies it back, so the
+/// compiler can fully unroll and keep the matrix in registers.
+/// Used for n <= 6; for larger n, spilling makes it slower than
+/// potrf_unblocked.
+///
+template <int N, bool upper, typename scalar_t>
+inline int64_t potrf_fixed( scalar_t* A, int64_t lda )
+{
+    scalar_t a[ N*N ];
+    for (int j = 0; j < N; ++j)
+        for (int i = (upper ? 0 : j); i < (upper ? j + 1 : N); ++i)
+            a[ i + j*N ] = A[ i + j*lda ];
+
+    int64_t info = potrf_unblocked<upper>( N, a, N );
+
+    for (int j = 0; j < N; ++j)
+        for (int i = (upper ? 0 : j); i < (upper ? j + 1 : N); ++i)
+            A[ i + j*lda ] = a[ i + j*N ];
+    return info;
+}
+
+//------------------------------------------------------------------------------
+template <bool upper, typename scalar_t>
+inline int64_t potrf_native( int64_t n, scalar_t* A, int64_t lda )
+{
+    switch (n) {
+        case 0: return 0;
+        case 1: return potrf_fixed< 1, upper >( A, lda );
+        case 2: return potrf_fixed< 2, upper >( A, lda );
+        case 3: return potrf_fixed< 3, upper >( A, lda );
+        case 4: return potrf_fixed< 4, upper >( A, lda );
+        case 5: return potrf_fixed< 5, upper >( A, lda );
+        case 6: return potrf_fixed< 6, upper >( A, lda );
+        default: return potrf_unblocked< upper >( n, A, lda );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Native Cholesky factorization for n <= potrf_native_max.
+/// Returns info as in LAPACK potrf.
+///
+template <typename scalar_t>
+inline int64_t potrf_native(
+    lapack::Uplo uplo, int64_t n, scalar_t* A, int64_t lda )
+{
+    if (uplo == Uplo::Upper)
+        return potrf_native< true >( n, A, lda );
+    else
+        return potrf_native< false >( n, A, lda );
+}
+
+//------------------------------------------------------------------------------
+/// Solves A X = B using the Cholesky factor from potrf_native:
+/// if upper, solves U^H Y = B, then U X = Y;
+/// otherwise, solves L Y = B, then L^H X = Y.
+/// Loops are arranged so the innermost loop runs down a column of A.
+///
+template <bool upper, typename scalar_t>
+inline void potrs_unblocked(
+    int64_t n, int64_t nrhs,
+    scalar_t const* A, int64_t lda,
+    scalar_t* B, int64_t ldb )
+{
+    for (int64_t c = 0; c < nrhs; ++c) {
+        scalar_t* b = &B[ c*ldb ];
+        if constexpr (upper) {
+            for (int64_t i = 0; i < n; ++i) {
+                scalar_t const* Ai = &A[ i*lda ];
+                scalar_t bi = b[ i ];
+                for (int64_t k = 0; k < i; ++k)
+                    bi -= blas::conj( Ai[ k ] ) * b[ k ];
+                b[ i ] = bi / std::real( Ai[ i ] );
+            }
+            for (int64_t k = n - 1; k >= 0; --k) {
+                scalar_t const* Ak = &A[ k*lda ];
+                b[ k ] /= std::real( Ak[ k ] );
+                scalar_t bk = b[ k ];
+                for (int64_t i = 0; i < k; ++i)
+                    b[ i ] -= Ak[ i ] * bk;
+            }
+        }
+        else {
+            for (int64_t k = 0; k < n; ++k) {
+                scalar_t const* Ak = &A[ k*lda ];
+                b[ k ] /= std::real( Ak[ k ] );
+                scalar_t bk = b[ k ];
+                for (int64_t i = k + 1; i < n; ++i)
+                    b[ i ] -= Ak[ i ] * bk;
+            }
+            for (int64_t i = n - 1; i >= 0; --i) {
+                scalar_t const* Ai = &A[ i*lda ];
+                scalar_t bi = b[ i ];
+                for (int64_t k = i + 1; k < n; ++k)
+                    bi -= blas::conj( Ai[ k ] ) * b[ k ];
+                b[ i ] = bi / std::real( Ai[ i ] );
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+template <bool upper, typename scalar_t>
+inline void potrs_native(
+    int64_t n, int64_t nrhs,
+    scalar_t const* A, int64_t lda,
+    scalar_t* B, int64_t ldb )
+{
+    // Constant n lets the compiler unroll the inner loops.
+    switch (n) {
+        case 0: return;
+        case 1: return potrs_unblocked< upper >( 1, nrhs, A, lda, B, ldb );
+        case 2: return potrs_unblocked< upper >( 2, nrhs, A, lda, B, ldb );
+        case 3: return potrs_unblocked< upper >( 3, nrhs, A, lda, B, ldb );
+        case 4: return potrs_unblocked< upper >( 4, nrhs, A, lda, B, ldb );
+        case 5: return potrs_unblocked< upper >( 5, nrhs, A, lda, B, ldb );
+        case 6: return potrs_unblocked< upper >( 6, nrhs, A, lda, B, ldb );
+        case 7: return potrs_unblocked< upper >( 7, nrhs, A, lda, B, ldb );
+        case 8: return potrs_unblocked< upper >( 8, nrhs, A, lda, B, ldb );
+        default: return potrs_unblocked< upper >( n, nrhs, A, lda, B, ldb );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Native Cholesky solve for n <= potrf_native_max.
+///
+template <typename scalar_t>
+inline void potrs_native(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t const* A, int64_t lda,
+    scalar_t* B, int64_t ldb )
+{
+    if (uplo == Uplo::Upper)
+        potrs_native< true >( n, nrhs, A, lda, B, ldb );
+    else
+        potrs_native< false >( n, nrhs, A, lda, B, ldb );
+}
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_POTRF_NATIVE_HH
@@ -0,0 +1,522 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "lapack/fortran.h"
+#include "NoConstructAllocator.hh"
+
+#include <atomic>
+#include <cstdlib>
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+using blas::real;
+
+//==============================================================================
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Runtime selection for lapack::potrf. Initialized from the environment
+/// variable LAPACKPP_POTRF ("lapack" or "tiled") on first use.
+struct PotrfMethodState
+{
+    PotrfMethodState()
+    {
+        const char* env = std::getenv( "LAPACKPP_POTRF" );
+        if (env != nullptr) {
+            MethodCholesky value = MethodCholesky::Lapack;
+            try {
+                from_string( env, &value );
+            }
+            catch (Error const&) {
+                // Unknown values leave the default LAPACK method.
+            }
+            method.store( value );
+        }
+    }
+
+    std::atomic< MethodCholesky > method { MethodCholesky::Lapack };
+    std::atomic< int64_t > nb { 256 };
+};
+
+//------------------------------------------------------------------------------
+/// @return global potrf method state.
+PotrfMethodState& potrf_method_state()
+{
+    static PotrfMethodState state;
+    return state;
+}
+
+//------------------------------------------------------------------------------
+/// Low-level wrapper factors a diagonal tile, float version.
+/// Calls Fortran directly so it does not dispatch back to potrf_tiled.
+/// @ingroup posv_computational
+inline int64_t potrf_tile(
+    lapack::Uplo uplo, int64_t n, float* A, int64_t lda )
+{
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "potrf_tile", float, 0, n, 0, 0, info_ );
+    LAPACK_spotrf( &uplo_, &n_, A, &lda_, &info_ );
+    return info_;
+}
+
+//------------------------------------------------------------------------------
+/// Low-level wrapper factors a diagonal tile, double version.
+/// @ingroup posv_computational
+inline int64_t potrf_tile(
+    lapack::Uplo uplo, int64_t n, double* A, int64_t lda )
+{
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "potrf_tile", double, 0, n, 0, 0, info_ );
+    LAPACK_dpotrf( &uplo_, &n_, A, &lda_, &info_ );
+    return info_;
+}
+
+//------------------------------------------------------------------------------
+/// Low-level wrapper factors a diagonal tile, complex<float> version.
+/// @ingroup posv_computational
+inline int64_t potrf_tile(
+    lapack::Uplo uplo, int64_t n, std::complex<float>* A, int64_t lda )
+{
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "potrf_tile", std::complex<float>, 0, n, 0, 0, info_ );
+    LAPACK_cpotrf( &uplo_, &n_, (lapack_complex_float*) A, &lda_, &info_ );
+    return info_;
+}
+
+//------------------------------------------------------------------------------
+/// Low-level wrapper factors a diagonal tile, complex<double> version.
+/// @ingroup posv_computational
+inline int64_t potrf_tile(
+    lapack::Uplo uplo, int64_t n, std::complex<double>* A, int64_t lda )
+{
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "potrf_tile", std::complex<double>, 0, n, 0, 0, info_ );
+    LAPACK_zpotrf( &uplo_, &n_, (lapack_complex_double*) A, &lda_, &info_ );
+    return info_;
+}
+
+//------------------------------------------------------------------------------
+/// Lower triangle of an n-by-n matrix stored as nb-by-nb tiles.
+/// Tile (i, j), i >= j, is an mb(i)-by-mb(j) column-major block with
+/// leading dimension mb(i), stored contiguously, by tile columns.
+/// The last row and column of tiles may be smaller.
+///
+template <typename scalar_t>
+class TileLower
+{
+public:
+    TileLower( int64_t n, int64_t nb )
+        : n_( n ),
+          nb_( nb ),
+          nt_( (n + nb - 1) / nb ),
+          offset_( nt_*nt_ )
+    {
+        int64_t size = 0;
+        for (int64_t j = 0; j < nt_; ++j) {
+            for (int64_t i = j; i < nt_; ++i) {
+                offset_[ i + j*nt_ ] = size;
+                size += mb( i ) * mb( j );
+            }
+        }
+        data_.resize( size );
+    }
+
+    /// @return number of tile rows and columns.
+    int64_t nt() const { return nt_; }
+
+    /// @return number of rows in tile row i, which is also its leading
+    /// dimension, and number of columns in tile column i.
+    int64_t mb( int64_t i ) const { return min( nb_, n_ - i*nb_ ); }
+
+    /// @return pointer to tile (i, j), i >= j.
+    scalar_t* operator() ( int64_t i, int64_t j )
+    {
+        return &data_[ offset_[ i + j*nt_ ] ];
+    }
+
+private:
+    int64_t n_, nb_, nt_;
+    std::vector< int64_t > offset_;
+    lapack::vector< scalar_t > data_;
+};
+
+//------------------------------------------------------------------------------
+/// Copies tile (i, j) of the uplo triangle of A into the lower tile T.
+/// For Upper, copies the conjugate transpose of block (j, i), so the
+/// lower tiled factor L is U^H.
+///
+template <typename scalar_t>
+void tile_copy_in(
+    lapack::Uplo uplo, scalar_t const* A, int64_t lda, int64_t nb,
+    int64_t i, int64_t j, int64_t mb, int64_t nb_j, scalar_t* T )
+{
+    if (uplo == Uplo::Lower) {
+        scalar_t const* Aij = &A[ i*nb + j*nb*lda ];
+        for (int64_t c = 0; c < nb_j; ++c)
+            for (int64_t r = 0; r < mb; ++r)
+                T[ r + c*mb ] = Aij[ r + c*lda ];
+    }
+    else {
+        scalar_t const* Aji = &A[ j*nb + i*nb*lda ];
+        for (int64_t c = 0; c < nb_j; ++c)
+            for (int64_t r = 0; r < mb; ++r)
+                T[ r + c*mb ] = blas::conj( Aji[ c + r*lda ] );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Copies the lower tile T back to tile (i, j) of the uplo triangle of A,
+/// the inverse of tile_copy_in. For diagonal tiles, only the uplo triangle
+/// of A is written.
+///
+template <typename scalar_t>
+void tile_copy_out(
+    lapack::Uplo uplo, scalar_t* A, int64_t lda, int64_t nb,
+    int64_t i, int64_t j, int64_t mb, int64_t nb_j, scalar_t const* T )
+{
+    if (uplo == Uplo::Lower) {
+        scalar_t* Aij = &A[ i*nb + j*nb*lda ];
+        for (int64_t c = 0; c < nb_j; ++c)
+            for (int64_t r = (i == j ? c : 0); r < mb; ++r)
+                Aij[ r + c*lda ] = T[ r + c*mb ];
+    }
+    else {
+        scalar_t* Aji = &A[ j*nb + i*nb*lda ];
+        for (int64_t r = 0; r < mb; ++r)
+            for (int64_t c = 0; c < (i == j ? r + 1 : nb_j); ++c)
+                Aji[ c + r*lda ] = blas::conj( T[ r + c*mb ] );
+    }
+}
+
+}  // namespace internal
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated tiled Cholesky factorization.
+/// Copies the uplo triangle of A into a lower tile layout, factors it with
+/// a right-looking tile algorithm, then copies it back.
+/// Each tile operation (potrf, trsm, herk, gemm) is an OpenMP task whose
+/// depend clauses name the tiles it reads and writes, so the runtime
+/// executes the resulting DAG as soon as each tile's inputs are ready.
+/// Without OpenMP, tasks execute in program order.
+/// @ingroup posv_computational
+///
+template <typename scalar_t>
+int64_t potrf_tiled(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda, int64_t nb )
+{
+    using real_t = blas::real_type< scalar_t >;
+    const scalar_t one = 1.0;
+    const real_t r_one = 1.0;
+
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( nb < 1 );
+
+    if (n == 0)
+        return 0;
+
+    if (nb >= n) {
+        // Single tile, factored in place.
+        return internal::potrf_tile( uplo, n, A, lda );
+    }
+
+    internal::TileLower< scalar_t > T( n, nb );
+    int64_t nt = T.nt();
+
+    // One dependency sentinel per tile (i, j), i >= j.
+    std::vector< char > tile_vector( nt*nt );
+    char* tile = tile_vector.data();
+
+    // Once a diagonal tile fails, the remaining tasks skip their work.
+    int64_t info = 0;
+    std::atomic< bool > failed { false };
+
+    #pragma omp parallel shared( info, failed )
+    {
+        #pragma omp for schedule( dynamic, 1 )
+        for (int64_t j = 0; j < nt; ++j) {
+            for (int64_t i = j; i < nt; ++i) {
+                internal::tile_copy_in(
+                    uplo, A, lda, nb, i, j, T.mb( i ), T.mb( j ), T( i, j ) );
+            }
+        }
+        // implicit barrier: all tiles copied in
+
+        #pragma omp master
+        for (int64_t k = 0; k < nt; ++k) {
+            int64_t kb = T.mb( k );
+
+            // Factor diagonal tile, A(k, k) = L(k, k) L(k, k)^H.
+            #pragma omp task depend( inout: tile[ k + k*nt ] ) priority( 1 )
+            {
+                if (! failed.load()) {
+                    int64_t iinfo = internal::potrf_tile(
+                        Uplo::Lower, kb, T( k, k ), kb );
+                    if (iinfo > 0) {
+                        info = iinfo + k*nb;
+                        failed.store( true );
+                    }
+                }
+            }
+
+            // Panel, L(i, k) = A(i, k) L(k, k)^{-H}.
+            for (int64_t i = k + 1; i < nt; ++i) {
+                #pragma omp task depend( in: tile[ k + k*nt ] ) \
+                    depend( inout: tile[ i + k*nt ] ) priority( 1 )
+                {
+                    if (! failed.load()) {
+                        blas::trsm( Layout::ColMajor, Side::Right, Uplo::Lower,
+                                    Op::ConjTrans, Diag::NonUnit,
+                                    T.mb( i ), kb,
+                                    one, T( k, k ), kb,
+                                         T( i, k ), T.mb( i ) );
+                    }
+                }
+            }
+
+            // Trailing update, A(i, j) -= L(i, k) L(j, k)^H.
+            for (int64_t j = k + 1; j < nt; ++j) {
+                int64_t jb = T.mb( j );
+                #pragma omp task depend( in: tile[ j + k*nt ] ) \
+                    depend( inout: tile[ j + j*nt ] )
+                {
+                    if (! failed.load()) {
+                        blas::herk( Layout::ColMajor, Uplo::Lower, Op::NoTrans,
+                                    jb, kb,
+                                    -r_one, T( j, k ), jb,
+                                     r_one, T( j, j ), jb );
+                    }
+                }
+
+                for (int64_t i = j + 1; i < nt; ++i) {
+                    #pragma omp task depend( in: tile[ i + k*nt ] ) \
+                        depend( in: tile[ j + k*nt ] ) \
+                        depend( inout: tile[ i + j*nt ] )
+                    {
+                        if (! failed.load()) {
+                            blas::gemm( Layout::ColMajor,
+                                        Op::NoTrans, Op::ConjTrans,
+                                        T.mb( i ), jb, kb,
+                                        -one, T( i, k ), T.mb( i ),
+                                              T( j, k ), jb,
+                                         one, T( i, j ), T.mb( i ) );
+                        }
+                    }
+                }
+            }
+        }
+        #pragma omp barrier
+        // all tasks complete
+
+        #pragma omp for schedule( dynamic, 1 )
+        for (int64_t j = 0; j < nt; ++j) {
+            for (int64_t i = j; i < nt; ++i) {
+                internal::tile_copy_out(
+                    uplo, A, lda, nb, i, j, T.mb( i ), T.mb( j ), T( i, j ) );
+            }
+        }
+    }
+
+    return info;
+}
+
+}  // namespace impl
+
+//==============================================================================
+// -----------------------------------------------------------------------------
+/// @ingroup posv_computational
+int64_t potrf_tiled(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, int64_t nb )
+{
+    return impl::potrf_tiled( uplo, n, A, lda, nb );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup posv_computational
+int64_t potrf_tiled(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, int64_t nb )
+{
+    return impl::potrf_tiled( uplo, n, A, lda, nb );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup posv_computational
+int64_t potrf_tiled(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t nb )
+{
+    return impl::potrf_tiled( uplo, n, A, lda, nb );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes the Cholesky factorization of a Hermitian
+/// positive definite matrix A, using a task-parallel tile algorithm.
+/// The result is the same factorization as lapack::potrf;
+/// see lapack::potrf for details.
+///
+/// The uplo triangle of A is copied into a workspace of nb-by-nb tiles,
+/// each stored contiguously. The factorization is expressed as
+/// potrf, trsm, herk, and gemm operations on tiles, which run as OpenMP
+/// tasks ordered only by their data dependencies, so independent updates
+/// from different steps overlap. This scales better than fork-join
+/// parallelism inside each BLAS call for large matrices on many cores.
+/// Diagonal tiles are factored by LAPACK potrf; other tile operations
+/// use BLAS++. Call from outside an OpenMP parallel region to use all
+/// threads, and preferably with a single-threaded BLAS.
+///
+/// The workspace holds the lower triangle of A, about n^2/2 elements.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangle of A is stored;
+///     - lapack::Uplo::Lower: Lower triangle of A is stored.
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in,out] A
+///     The n-by-n matrix A, stored in an lda-by-n array.
+///     On entry, the Hermitian matrix A; only the uplo triangle is
+///     referenced.
+///     On successful exit, the factor U or L from the Cholesky
+///     factorization $A = U^H U$ or $A = L L^H.$
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[in] nb
+///     Tile size. nb >= 1.
+///     If nb >= n, A is factored in place by LAPACK potrf.
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, the leading minor of order i is not
+///              positive definite, and the factorization could not be
+///              completed.
+///
+/// @see potrf_set_method to use this in lapack::potrf.
+///
+/// @ingroup posv_computational
+int64_t potrf_tiled(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t nb )
+{
+    return impl::potrf_tiled( uplo, n, A, lda, nb );
+}
+
+//==============================================================================
+// -----------------------------------------------------------------------------
+/// Selects the algorithm used by lapack::potrf for all precisions,
+/// and by routines that call lapack::potrf, such as lapack::posv.
+///
+///     - MethodCholesky::Lapack: call the LAPACK library potrf (default).
+///     - MethodCholesky::Tiled: call lapack::potrf_tiled with the given
+///       tile size.
+///
+/// The initial method can also be set with the environment variable
+/// LAPACKPP_POTRF=lapack or LAPACKPP_POTRF=tiled.
+/// The setting is global and may be changed at any time; calls already
+/// in progress are not affected.
+///
+/// @param[in] method
+///     Cholesky method.
+///
+/// @param[in] nb
+///     Tile size for the tiled method. nb >= 1. Default 256.
+///
+/// @ingroup posv_computational
+void potrf_set_method( MethodCholesky method, int64_t nb )
+{
+    lapack_error_if( nb < 1 );
+
+    auto& state = internal::potrf_method_state();
+    state.nb.store( nb );
+    state.method.store( method );
+}
+
+// -----------------------------------------------------------------------------
+/// @return algorithm currently used by lapack::potrf.
+/// @see potrf_set_method
+/// @ingroup posv_computational
+MethodCholesky potrf_method()
+{
+    return internal::potrf_method_state().method.load();
+}
+
+//==============================================================================
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Called by lapack::potrf. If the tiled method is selected,
+/// factors A with potrf_tiled and sets info.
+/// @return true if A was factored, false to call LAPACK.
+/// @ingroup posv_computational
+///
+template <typename scalar_t>
+bool potrf_dispatch(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda,
+    int64_t* info )
+{
+    auto& state = potrf_method_state();
+    if (state.method.load() != MethodCholesky::Tiled)
+        return false;
+
+    *info = impl::potrf_tiled( uplo, n, A, lda, state.nb.load() );
+    return true;
+}
+
+template
+bool potrf_dispatch(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    int64_t* info );
+
+template
+bool potrf_dispatch(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    int64_t* info );
+
+template
+bool potrf_dispatch(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* info );
+
+template
+bool potrf_dispatch(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* info );
+
+}  // namespace internal
+
+}  // namespace lapack
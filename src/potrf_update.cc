@@ -0,0 +1,251 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "NoConstructAllocator.hh"
+#include "rank_update.hh"
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+using blas::real;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks arguments, then applies the k
+/// rank-1 updates in turn.
+/// @ingroup posv_computational
+///
+template <typename scalar_t>
+int64_t potrf_update(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    scalar_t* A, int64_t lda,
+    scalar_t const* X, int64_t ldx )
+{
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( k < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( ldx < max( 1, n ) );
+
+    if (n == 0)
+        return 0;
+
+    lapack::vector< scalar_t > w( n );
+    for (int64_t j = 0; j < k; ++j) {
+        scalar_t const* Xj = &X[ j*ldx ];
+        for (int64_t i = 0; i < n; ++i)
+            w[ i ] = (uplo == Uplo::Upper ? blas::conj( Xj[ i ] ) : Xj[ i ]);
+        internal::rank1_update( uplo, n, A, lda, &w[0] );
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks arguments, then applies the k
+/// rank-1 downdates in turn, stopping at the first that fails.
+/// @ingroup posv_computational
+///
+template <typename scalar_t>
+int64_t potrf_downdate(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    scalar_t* A, int64_t lda,
+    scalar_t const* X, int64_t ldx )
+{
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( k < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( ldx < max( 1, n ) );
+
+    if (n == 0)
+        return 0;
+
+    lapack::vector< scalar_t > work( 2*n );
+    scalar_t* p = &work[ 0 ];
+    scalar_t* e = &work[ n ];
+    for (int64_t j = 0; j < k; ++j) {
+        std::copy( &X[ j*ldx ], &X[ j*ldx + n ], p );
+        if (internal::rank1_downdate( uplo, n, A, lda, p, e ) != 0)
+            return j + 1;
+    }
+    return 0;
+}
+
+}  // namespace impl
+
+//==============================================================================
+// -----------------------------------------------------------------------------
+/// @ingroup posv_computational
+int64_t potrf_update(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* X, int64_t ldx )
+{
+    return impl::potrf_update( uplo, n, k, A, lda, X, ldx );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup posv_computational
+int64_t potrf_update(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* X, int64_t ldx )
+{
+    return impl::potrf_update( uplo, n, k, A, lda, X, ldx );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup posv_computational
+int64_t potrf_update(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* X, int64_t ldx )
+{
+    return impl::potrf_update( uplo, n, k, A, lda, X, ldx );
+}
+
+// -----------------------------------------------------------------------------
+/// Updates the Cholesky factorization of a Hermitian positive definite
+/// matrix A, as computed by lapack::potrf, to that of the rank-k update
+/// \[
+///     \tilde{A} = A + X X^H,
+/// \]
+/// where X is n-by-k. This takes $O(k n^2)$ operations, compared to
+/// $O(n^3)$ to refactor $\tilde{A}$. Each column of X is eliminated by
+/// n plane rotations, computed by lapack::lartg, as in LINPACK xCHUD.
+/// This is unconditionally stable. To change one row and column of A,
+/// combine an update and a downdate; see lapack::potrf_downdate.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: A = U^H U, with U stored in the upper triangle;
+///     - lapack::Uplo::Lower: A = L L^H, with L stored in the lower triangle.
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in] k
+///     The number of columns of X, i.e., the rank of the update. k >= 0.
+///
+/// @param[in,out] A
+///     The n-by-n matrix A, stored in an lda-by-n array.
+///     On entry, the factor U or L from lapack::potrf.
+///     On exit, the factor of $\tilde{A}$. The diagonal remains real and
+///     positive. The opposite triangle is not referenced.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[in] X
+///     The n-by-k matrix X, stored in an ldx-by-k array.
+///
+/// @param[in] ldx
+///     The leading dimension of the array X. ldx >= max(1,n).
+///
+/// @return = 0: successful exit
+///
+/// @ingroup posv_computational
+int64_t potrf_update(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* X, int64_t ldx )
+{
+    return impl::potrf_update( uplo, n, k, A, lda, X, ldx );
+}
+
+//==============================================================================
+// -----------------------------------------------------------------------------
+/// @ingroup posv_computational
+int64_t potrf_downdate(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* X, int64_t ldx )
+{
+    return impl::potrf_downdate( uplo, n, k, A, lda, X, ldx );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup posv_computational
+int64_t potrf_downdate(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* X, int64_t ldx )
+{
+    return impl::potrf_downdate( uplo, n, k, A, lda, X, ldx );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup posv_computational
+int64_t potrf_downdate(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* X, int64_t ldx )
+{
+    return impl::potrf_downdate( uplo, n, k, A, lda, X, ldx );
+}
+
+// -----------------------------------------------------------------------------
+/// Downdates the Cholesky factorization of a Hermitian positive definite
+/// matrix A, as computed by lapack::potrf, to that of the rank-k downdate
+/// \[
+///     \tilde{A} = A - X X^H,
+/// \]
+/// where X is n-by-k. This takes $O(k n^2)$ operations, compared to
+/// $O(n^3)$ to refactor $\tilde{A}$. For each column x of X, it solves
+/// $U^H p = x$, then applies n plane rotations that reduce
+/// $[ p; \sqrt{1 - \|p\|^2} ]$ to a unit vector, as in LINPACK xCHDD.
+/// The accuracy depends on the condition of $\tilde{A}$.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: A = U^H U, with U stored in the upper triangle;
+///     - lapack::Uplo::Lower: A = L L^H, with L stored in the lower triangle.
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in] k
+///     The number of columns of X, i.e., the rank of the downdate. k >= 0.
+///
+/// @param[in,out] A
+///     The n-by-n matrix A, stored in an lda-by-n array.
+///     On entry, the factor U or L from lapack::potrf.
+///     On exit, if return value = 0, the factor of $\tilde{A}$.
+///     If return value = j > 0, the factor of A downdated by the first
+///     j-1 columns of X.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[in] X
+///     The n-by-k matrix X, stored in an ldx-by-k array.
+///
+/// @param[in] ldx
+///     The leading dimension of the array X. ldx >= max(1,n).
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = j, downdating by column j of X would
+///     make the matrix not positive definite, so that column and later
+///     columns were not applied.
+///
+/// @ingroup posv_computational
+int64_t potrf_downdate(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* X, int64_t ldx )
+{
+    return impl::potrf_downdate( uplo, n, k, A, lda, X, ldx );
+}
+
+}  // namespace lapack
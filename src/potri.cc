@@ -25,6 +25,7 @@ int64_t potri(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "potri", float, 0, n, 0, 0, info_ );
 
     LAPACK_spotri(
         &uplo_, &n_,
@@ -46,6 +47,7 @@ int64_t potri(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "potri", double, 0, n, 0, 0, info_ );
 
     LAPACK_dpotri(
         &uplo_, &n_,
@@ -67,6 +69,7 @@ int64_t potri(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "potri", std::complex<float>, 0, n, 0, 0, info_ );
 
     LAPACK_cpotri(
         &uplo_, &n_,
@@ -117,6 +120,7 @@ int64_t potri(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "potri", std::complex<double>, 0, n, 0, 0, info_ );
 
     LAPACK_zpotri(
         &uplo_, &n_,
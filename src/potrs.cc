@@ -28,6 +28,7 @@ int64_t potrs(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "potrs", float, 0, n, 0, nrhs, info_ );
 
     LAPACK_spotrs(
         &uplo_, &n_, &nrhs_,
@@ -53,6 +54,7 @@ int64_t potrs(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "potrs", double, 0, n, 0, nrhs, info_ );
 
     LAPACK_dpotrs(
         &uplo_, &n_, &nrhs_,
@@ -78,6 +80,7 @@ int64_t potrs(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "potrs", std::complex<float>, 0, n, 0, nrhs, info_ );
 
     LAPACK_cpotrs(
         &uplo_, &n_, &nrhs_,
@@ -139,6 +142,7 @@ int64_t potrs(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "potrs", std::complex<double>, 0, n, 0, nrhs, info_ );
 
     LAPACK_zpotrs(
         &uplo_, &n_, &nrhs_,
@@ -151,4 +155,109 @@ int64_t potrs(
     return info_;
 }
 
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper for either layout.
+/// @ingroup posv_computational
+///
+template <typename scalar_t>
+int64_t potrs(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t const* A, int64_t lda,
+    scalar_t* B, int64_t ldb )
+{
+    if (layout == Layout::ColMajor)
+        return lapack::potrs( uplo, n, nrhs, A, lda, B, ldb );
+
+    lapack_error_if( layout != Layout::RowMajor );
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( ldb < max( 1, nrhs ) );
+
+    if (n == 0 || nrhs == 0)
+        return 0;
+
+    // Triangular solves with row-major BLAS; no copies.
+    const scalar_t one = 1;
+    if (uplo == Uplo::Upper) {
+        // Solve U^H U X = B.
+        blas::trsm( Layout::RowMajor, blas::Side::Left, Uplo::Upper,
+                    Op::ConjTrans, Diag::NonUnit, n, nrhs, one, A, lda, B, ldb );
+        blas::trsm( Layout::RowMajor, blas::Side::Left, Uplo::Upper,
+                    Op::NoTrans, Diag::NonUnit, n, nrhs, one, A, lda, B, ldb );
+    }
+    else {
+        // Solve L L^H X = B.
+        blas::trsm( Layout::RowMajor, blas::Side::Left, Uplo::Lower,
+                    Op::NoTrans, Diag::NonUnit, n, nrhs, one, A, lda, B, ldb );
+        blas::trsm( Layout::RowMajor, blas::Side::Left, Uplo::Lower,
+                    Op::ConjTrans, Diag::NonUnit, n, nrhs, one, A, lda, B, ldb );
+    }
+    return 0;
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// @ingroup posv_computational
+int64_t potrs(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float* B, int64_t ldb )
+{
+    return impl::potrs( layout, uplo, n, nrhs, A, lda, B, ldb );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup posv_computational
+int64_t potrs(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double* B, int64_t ldb )
+{
+    return impl::potrs( layout, uplo, n, nrhs, A, lda, B, ldb );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup posv_computational
+int64_t potrs(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb )
+{
+    return impl::potrs( layout, uplo, n, nrhs, A, lda, B, ldb );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::potrs that takes the matrix layout.
+/// For row-major layout, A holds the factor from lapack::potrf
+/// with the same layout, and B and X are stored row-major.
+/// The triangular solves call row-major BLAS trsm, so nothing is copied.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// Other arguments are the same as for lapack::potrs.
+///
+/// @param[in] layout
+///     Matrix storage, Layout::ColMajor or Layout::RowMajor.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B.
+///     If layout = ColMajor, ldb >= max(1,n);
+///     if layout = RowMajor, ldb >= max(1,nrhs).
+///
+/// @ingroup posv_computational
+int64_t potrs(
+    lapack::Layout layout, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb )
+{
+    return impl::potrs( layout, uplo, n, nrhs, A, lda, B, ldb );
+}
+
 }  // namespace lapack
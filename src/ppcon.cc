@@ -26,6 +26,7 @@ int64_t ppcon(
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ppcon", float, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (3*n) );
@@ -53,6 +54,7 @@ int64_t ppcon(
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ppcon", double, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (3*n) );
@@ -80,6 +82,7 @@ int64_t ppcon(
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ppcon", std::complex<float>, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
@@ -144,6 +147,7 @@ int64_t ppcon(
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ppcon", std::complex<double>, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
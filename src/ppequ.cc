@@ -27,6 +27,7 @@ int64_t ppequ(
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ppequ", float, 0, n, 0, 0, info_ );
 
     LAPACK_sppequ(
         &uplo_, &n_,
@@ -51,6 +52,7 @@ int64_t ppequ(
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ppequ", double, 0, n, 0, 0, info_ );
 
     LAPACK_dppequ(
         &uplo_, &n_,
@@ -75,6 +77,7 @@ int64_t ppequ(
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ppequ", std::complex<float>, 0, n, 0, 0, info_ );
 
     LAPACK_cppequ(
         &uplo_, &n_,
@@ -143,6 +146,7 @@ int64_t ppequ(
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ppequ", std::complex<double>, 0, n, 0, 0, info_ );
 
     LAPACK_zppequ(
         &uplo_, &n_,
@@ -27,6 +27,7 @@ int64_t ppsv(
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ppsv", float, 0, n, 0, nrhs, info_ );
 
     LAPACK_sppsv(
         &uplo_, &n_, &nrhs_,
@@ -51,6 +52,7 @@ int64_t ppsv(
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ppsv", double, 0, n, 0, nrhs, info_ );
 
     LAPACK_dppsv(
         &uplo_, &n_, &nrhs_,
@@ -75,6 +77,7 @@ int64_t ppsv(
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ppsv", std::complex<float>, 0, n, 0, nrhs, info_ );
 
     LAPACK_cppsv(
         &uplo_, &n_, &nrhs_,
@@ -172,6 +175,7 @@ int64_t ppsv(
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ppsv", std::complex<double>, 0, n, 0, nrhs, info_ );
 
     LAPACK_zppsv(
         &uplo_, &n_, &nrhs_,
@@ -24,6 +24,7 @@ int64_t pptrf(
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pptrf", float, 0, n, 0, 0, info_ );
 
     LAPACK_spptrf(
         &uplo_, &n_,
@@ -44,6 +45,7 @@ int64_t pptrf(
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pptrf", double, 0, n, 0, 0, info_ );
 
     LAPACK_dpptrf(
         &uplo_, &n_,
@@ -64,6 +66,7 @@ int64_t pptrf(
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pptrf", std::complex<float>, 0, n, 0, 0, info_ );
 
     LAPACK_cpptrf(
         &uplo_, &n_,
@@ -138,6 +141,7 @@ int64_t pptrf(
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pptrf", std::complex<double>, 0, n, 0, 0, info_ );
 
     LAPACK_zpptrf(
         &uplo_, &n_,
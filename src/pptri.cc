@@ -24,6 +24,7 @@ int64_t pptri(
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pptri", float, 0, n, 0, 0, info_ );
 
     LAPACK_spptri(
         &uplo_, &n_,
@@ -44,6 +45,7 @@ int64_t pptri(
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pptri", double, 0, n, 0, 0, info_ );
 
     LAPACK_dpptri(
         &uplo_, &n_,
@@ -64,6 +66,7 @@ int64_t pptri(
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pptri", std::complex<float>, 0, n, 0, 0, info_ );
 
     LAPACK_cpptri(
         &uplo_, &n_,
@@ -114,6 +117,7 @@ int64_t pptri(
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pptri", std::complex<double>, 0, n, 0, 0, info_ );
 
     LAPACK_zpptri(
         &uplo_, &n_,
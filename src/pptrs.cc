@@ -27,6 +27,7 @@ int64_t pptrs(
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pptrs", float, 0, n, 0, nrhs, info_ );
 
     LAPACK_spptrs(
         &uplo_, &n_, &nrhs_,
@@ -51,6 +52,7 @@ int64_t pptrs(
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pptrs", double, 0, n, 0, nrhs, info_ );
 
     LAPACK_dpptrs(
         &uplo_, &n_, &nrhs_,
@@ -75,6 +77,7 @@ int64_t pptrs(
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pptrs", std::complex<float>, 0, n, 0, nrhs, info_ );
 
     LAPACK_cpptrs(
         &uplo_, &n_, &nrhs_,
@@ -136,6 +139,7 @@ int64_t pptrs(
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pptrs", std::complex<double>, 0, n, 0, nrhs, info_ );
 
     LAPACK_zpptrs(
         &uplo_, &n_, &nrhs_,
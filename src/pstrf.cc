@@ -35,6 +35,7 @@ int64_t pstrf(
     #endif
     lapack_int rank_ = 0;  // out
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pstrf", float, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (2*n) );
@@ -74,6 +75,7 @@ int64_t pstrf(
     #endif
     lapack_int rank_ = 0;  // out
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pstrf", double, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (2*n) );
@@ -113,6 +115,7 @@ int64_t pstrf(
     #endif
     lapack_int rank_ = 0;  // out
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pstrf", std::complex<float>, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (2*n) );
@@ -152,6 +155,7 @@ int64_t pstrf(
     #endif
     lapack_int rank_ = 0;  // out
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pstrf", std::complex<double>, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (2*n) );
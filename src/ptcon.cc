@@ -26,6 +26,7 @@ int64_t ptcon(
 {
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ptcon", float, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (n) );
@@ -51,6 +52,7 @@ int64_t ptcon(
 {
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ptcon", double, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (n) );
@@ -76,6 +78,7 @@ int64_t ptcon(
 {
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ptcon", std::complex<float>, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > rwork( (n) );
@@ -145,6 +148,7 @@ int64_t ptcon(
 {
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ptcon", std::complex<double>, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > rwork( (n) );
@@ -27,6 +27,7 @@ int64_t pteqr(
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pteqr", float, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (4*n) );
@@ -55,6 +56,7 @@ int64_t pteqr(
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pteqr", double, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (4*n) );
@@ -83,6 +85,7 @@ int64_t pteqr(
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pteqr", std::complex<float>, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (4*n) );
@@ -111,6 +114,7 @@ int64_t pteqr(
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pteqr", std::complex<double>, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (4*n) );
@@ -27,6 +27,7 @@ int64_t ptsv(
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ptsv", float, 0, n, 0, nrhs, info_ );
 
     LAPACK_sptsv(
         &n_, &nrhs_,
@@ -51,6 +52,7 @@ int64_t ptsv(
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ptsv", double, 0, n, 0, nrhs, info_ );
 
     LAPACK_dptsv(
         &n_, &nrhs_,
@@ -75,6 +77,7 @@ int64_t ptsv(
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ptsv", std::complex<float>, 0, n, 0, nrhs, info_ );
 
     LAPACK_cptsv(
         &n_, &nrhs_,
@@ -144,6 +147,7 @@ int64_t ptsv(
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "ptsv", std::complex<double>, 0, n, 0, nrhs, info_ );
 
     LAPACK_zptsv(
         &n_, &nrhs_,
@@ -24,6 +24,7 @@ int64_t pttrf(
 {
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pttrf", float, 0, n, 0, 0, info_ );
 
     LAPACK_spttrf(
         &n_,
@@ -44,6 +45,7 @@ int64_t pttrf(
 {
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pttrf", double, 0, n, 0, 0, info_ );
 
     LAPACK_dpttrf(
         &n_,
@@ -64,6 +66,7 @@ int64_t pttrf(
 {
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pttrf", std::complex<float>, 0, n, 0, 0, info_ );
 
     LAPACK_cpttrf(
         &n_,
@@ -114,6 +117,7 @@ int64_t pttrf(
 {
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pttrf", std::complex<double>, 0, n, 0, 0, info_ );
 
     LAPACK_zpttrf(
         &n_,
@@ -27,6 +27,7 @@ int64_t pttrs(
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pttrs", float, 0, n, 0, nrhs, info_ );
 
     LAPACK_spttrs(
         &n_, &nrhs_,
@@ -51,6 +52,7 @@ int64_t pttrs(
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pttrs", double, 0, n, 0, nrhs, info_ );
 
     LAPACK_dpttrs(
         &n_, &nrhs_,
@@ -76,6 +78,7 @@ int64_t pttrs(
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pttrs", std::complex<float>, 0, n, 0, nrhs, info_ );
 
     LAPACK_cpttrs(
         &uplo_, &n_, &nrhs_,
@@ -152,6 +155,7 @@ int64_t pttrs(
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "pttrs", std::complex<double>, 0, n, 0, nrhs, info_ );
 
     LAPACK_zpttrs(
         &uplo_, &n_, &nrhs_,
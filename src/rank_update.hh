@@ -0,0 +1,122 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_RANK_UPDATE_HH
+#define LAPACK_RANK_UPDATE_HH
+
+#include "lapack.hh"
+
+#include <cmath>
+
+// Rank-1 update and downdate of triangular factors by plane rotations,
+// shared by potrf_update, potrf_downdate, geqrf_insert_rows, and
+// geqrf_delete_rows. Each is O(n^2).
+
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Given n-by-n triangular R with A = R^H R (uplo = Upper), or L with
+/// A = L L^H (uplo = Lower), overwrites it with the factor of
+/// A + x x^H. On entry, w = conj( x ) for Upper, or w = x for Lower;
+/// on exit, w is destroyed.
+///
+/// Stacking the row w^T below R, rotations in planes (j, n) for
+/// j = 0, ..., n-1 eliminate w, as in LINPACK xCHUD. For Lower, the
+/// same rotations apply to the columns of [ L, x ].
+/// If R(j, j) is real and positive, it stays so, since lartg returns r
+/// with the phase of f.
+///
+template <typename scalar_t>
+void rank1_update(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda,
+    scalar_t* w )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    int64_t inc = (uplo == lapack::Uplo::Upper ? lda : 1);
+    for (int64_t j = 0; j < n; ++j) {
+        real_t c;
+        scalar_t s, r;
+        lapack::lartg( A[ j + j*lda ], w[ j ], &c, &s, &r );
+        A[ j + j*lda ] = r;
+        w[ j ] = 0;
+        if (j + 1 < n) {
+            scalar_t* Aj = (uplo == lapack::Uplo::Upper
+                            ? &A[ j + (j + 1)*lda ]    // row j of R
+                            : &A[ (j + 1) + j*lda ]);  // col j of L
+            blas::rot( n - j - 1, Aj, inc, &w[ j + 1 ], 1, c, s );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Given n-by-n triangular R with A = R^H R (uplo = Upper), or L with
+/// A = L L^H (uplo = Lower), overwrites it with the factor of
+/// A - x x^H, following LINPACK xCHDD.
+/// On entry, p = x; on exit, p and e, both of length n, are destroyed.
+///
+/// Solves R^H p = x, then if || p ||_2 < 1, rotations in planes (i, n)
+/// for i = n-1, ..., 0 reduce [ p; alpha ] to [ 0; 1 ], where
+/// alpha = sqrt( 1 - || p ||^2 ). Applied to [ R; 0 ], they give the
+/// new R stacked on the row x^H. R is left unchanged on failure.
+///
+/// @return 0 if successful;
+///         1 if R has a zero on its diagonal;
+///         2 if || p ||_2 >= 1, so A - x x^H is not positive definite.
+///
+template <typename scalar_t>
+int64_t rank1_downdate(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda,
+    scalar_t* p, scalar_t* e )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    for (int64_t i = 0; i < n; ++i) {
+        if (A[ i + i*lda ] == scalar_t( 0 ))
+            return 1;
+    }
+
+    // Solve R^H p = x, or L p = x.
+    if (uplo == lapack::Uplo::Upper) {
+        blas::trsv( blas::Layout::ColMajor, uplo, blas::Op::ConjTrans,
+                    blas::Diag::NonUnit, n, A, lda, p, 1 );
+    }
+    else {
+        blas::trsv( blas::Layout::ColMajor, uplo, blas::Op::NoTrans,
+                    blas::Diag::NonUnit, n, A, lda, p, 1 );
+    }
+    real_t pnorm = blas::nrm2( n, p, 1 );
+    if (! (pnorm < 1))
+        return 2;
+    real_t alpha = std::sqrt( (1 - pnorm) * (1 + pnorm) );
+
+    for (int64_t i = 0; i < n; ++i)
+        e[ i ] = 0;
+
+    int64_t inc = (uplo == lapack::Uplo::Upper ? lda : 1);
+    for (int64_t i = n-1; i >= 0; --i) {
+        real_t c;
+        scalar_t s, r;
+        lapack::lartg( scalar_t( alpha ), p[ i ], &c, &s, &r );
+        alpha = std::real( r );
+        // Before this step, e(i) = 0, so R(i, i) is only scaled by c.
+        if (uplo == lapack::Uplo::Upper) {
+            blas::rot( n - i, &e[ i ], 1, &A[ i + i*lda ], inc, c, s );
+        }
+        else {
+            blas::rot( n - i, &e[ i ], 1, &A[ i + i*lda ], inc,
+                       c, blas::conj( s ) );
+        }
+    }
+    return 0;
+}
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif  // LAPACK_RANK_UPDATE_HH
@@ -26,6 +26,13 @@ inline const rocblas_evect  job2eigmode_rocsolver(lapack::Job jobz) {
     return rocblas_evect_none;
 }
 
+inline const rocblas_svect job2svect_rocsolver(lapack::Job job) {
+    if (job == lapack::Job::AllVec) return rocblas_svect_all;
+    if (job == lapack::Job::SomeVec) return rocblas_svect_singular;
+    if (job == lapack::Job::OverwriteVec) return rocblas_svect_overwrite;
+    return rocblas_svect_none;
+}
+
 } // namespace lapack
 
 #endif // LAPACK_ROCM_COMMON_H
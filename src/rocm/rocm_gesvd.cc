@@ -0,0 +1,199 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/defines.h"
+
+#if defined(LAPACK_HAVE_ROCBLAS)
+
+#include "rocm_common.hh"
+
+//==============================================================================
+namespace lapack {
+
+//------------------------------------------------------------------------------
+// Workspace query. The device workspace holds E, the min(m, n) - 1
+// superdiagonal of the unconverged bidiagonal.
+// dA, dS, dU, dVT are only for templating scalar_t; they aren't referenced.
+template <typename scalar_t>
+void gesvd_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    scalar_t* dA, int64_t ldda, blas::real_type<scalar_t>* dS,
+    scalar_t* dU, int64_t lddu,
+    scalar_t* dVT, int64_t lddvt,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue )
+{
+    using real_t = blas::real_type<scalar_t>;
+    *dev_work_size  = blas::max( 1, blas::min( m, n ) ) * sizeof(real_t);
+    *host_work_size = 0;
+}
+
+//------------------------------------------------------------------------------
+// Intermediate wrappers around rocSolver to deal with precisions.
+rocblas_status rocsolver_gesvd(
+    rocblas_handle solver, rocblas_svect jobu, rocblas_svect jobvt,
+    rocblas_int m, rocblas_int n, float* dA, rocblas_int ldda, float* dS,
+    float* dU, rocblas_int lddu, float* dVT, rocblas_int lddvt,
+    float* dE, rocblas_int* info )
+{
+    return rocsolver_sgesvd(
+        solver, jobu, jobvt, m, n, dA, ldda, dS, dU, lddu, dVT, lddvt,
+        dE, rocblas_outofplace, info );
+}
+
+//----------
+rocblas_status rocsolver_gesvd(
+    rocblas_handle solver, rocblas_svect jobu, rocblas_svect jobvt,
+    rocblas_int m, rocblas_int n, double* dA, rocblas_int ldda, double* dS,
+    double* dU, rocblas_int lddu, double* dVT, rocblas_int lddvt,
+    double* dE, rocblas_int* info )
+{
+    return rocsolver_dgesvd(
+        solver, jobu, jobvt, m, n, dA, ldda, dS, dU, lddu, dVT, lddvt,
+        dE, rocblas_outofplace, info );
+}
+
+//----------
+rocblas_status rocsolver_gesvd(
+    rocblas_handle solver, rocblas_svect jobu, rocblas_svect jobvt,
+    rocblas_int m, rocblas_int n,
+    std::complex<float>* dA, rocblas_int ldda, float* dS,
+    std::complex<float>* dU, rocblas_int lddu,
+    std::complex<float>* dVT, rocblas_int lddvt,
+    float* dE, rocblas_int* info )
+{
+    return rocsolver_cgesvd(
+        solver, jobu, jobvt, m, n,
+        (rocblas_float_complex*) dA, ldda, dS,
+        (rocblas_float_complex*) dU, lddu,
+        (rocblas_float_complex*) dVT, lddvt,
+        dE, rocblas_outofplace, info );
+}
+
+//----------
+rocblas_status rocsolver_gesvd(
+    rocblas_handle solver, rocblas_svect jobu, rocblas_svect jobvt,
+    rocblas_int m, rocblas_int n,
+    std::complex<double>* dA, rocblas_int ldda, double* dS,
+    std::complex<double>* dU, rocblas_int lddu,
+    std::complex<double>* dVT, rocblas_int lddvt,
+    double* dE, rocblas_int* info )
+{
+    return rocsolver_zgesvd(
+        solver, jobu, jobvt, m, n,
+        (rocblas_double_complex*) dA, ldda, dS,
+        (rocblas_double_complex*) dU, lddu,
+        (rocblas_double_complex*) dVT, lddvt,
+        dE, rocblas_outofplace, info );
+}
+
+//------------------------------------------------------------------------------
+// Wrapper around rocSolver.
+// This is async. Once finished, the return info is in dev_info on the device.
+template <typename scalar_t>
+void gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    scalar_t* dA, int64_t ldda, blas::real_type<scalar_t>* dS,
+    scalar_t* dU, int64_t lddu,
+    scalar_t* dVT, int64_t lddvt,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    using real_t = blas::real_type<scalar_t>;
+    auto solver = queue.handle();
+
+    // for cuda, rocm, call set_device; for oneapi, do nothing.
+    blas::internal_set_device( queue.device() );
+
+    blas_dev_call(
+        rocsolver_gesvd(
+            solver, job2svect_rocsolver( jobu ), job2svect_rocsolver( jobvt ),
+            m, n, dA, ldda, dS, dU, lddu, dVT, lddvt,
+            (real_t*) dev_work, dev_info ));
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void gesvd_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    float* dA, int64_t ldda, float* dS,
+    float* dU, int64_t lddu,
+    float* dVT, int64_t lddvt,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void gesvd_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    double* dA, int64_t ldda, double* dS,
+    double* dU, int64_t lddu,
+    double* dVT, int64_t lddvt,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void gesvd_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<float>* dA, int64_t ldda, float* dS,
+    std::complex<float>* dU, int64_t lddu,
+    std::complex<float>* dVT, int64_t lddvt,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void gesvd_work_size_bytes(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<double>* dA, int64_t ldda, double* dS,
+    std::complex<double>* dU, int64_t lddu,
+    std::complex<double>* dVT, int64_t lddvt,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+//--------------------
+template
+void gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    float* dA, int64_t ldda, float* dS,
+    float* dU, int64_t lddu,
+    float* dVT, int64_t lddvt,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    double* dA, int64_t ldda, double* dS,
+    double* dU, int64_t lddu,
+    double* dVT, int64_t lddvt,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<float>* dA, int64_t ldda, float* dS,
+    std::complex<float>* dU, int64_t lddu,
+    std::complex<float>* dVT, int64_t lddvt,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<double>* dA, int64_t ldda, double* dS,
+    std::complex<double>* dU, int64_t lddu,
+    std::complex<double>* dVT, int64_t lddvt,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+} // namespace lapack
+
+#endif // LAPACK_HAVE_ROCBLAS
@@ -0,0 +1,189 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/defines.h"
+
+#if defined(LAPACK_HAVE_ROCBLAS)
+
+#include "rocm_common.hh"
+
+//==============================================================================
+// todo: put into BLAS++ header somewhere.
+namespace blas {
+namespace internal {
+
+rocblas_operation op2rocblas(blas::Op op);
+
+} // namespace internal
+} // namespace blas
+
+//==============================================================================
+namespace lapack {
+
+//------------------------------------------------------------------------------
+// Workspace query. rocSolver getrs needs no workspace.
+// dA, dB are only for templating scalar_t; they aren't referenced.
+template <typename scalar_t>
+void getrs_work_size_bytes(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    scalar_t const* dA, int64_t ldda,
+    scalar_t* dB, int64_t lddb,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue )
+{
+    *dev_work_size  = 0;
+    *host_work_size = 0;
+}
+
+//------------------------------------------------------------------------------
+// Intermediate wrappers around rocSolver to deal with precisions.
+// rocSolver takes A as non-const, though it isn't modified.
+rocblas_status rocsolver_getrs(
+    rocblas_handle solver, rocblas_operation trans,
+    rocblas_int n, rocblas_int nrhs,
+    float const* dA, rocblas_int ldda, rocblas_int const* dipiv,
+    float* dB, rocblas_int lddb )
+{
+    return rocsolver_sgetrs(
+        solver, trans, n, nrhs, (float*) dA, ldda, dipiv, dB, lddb );
+}
+
+//----------
+rocblas_status rocsolver_getrs(
+    rocblas_handle solver, rocblas_operation trans,
+    rocblas_int n, rocblas_int nrhs,
+    double const* dA, rocblas_int ldda, rocblas_int const* dipiv,
+    double* dB, rocblas_int lddb )
+{
+    return rocsolver_dgetrs(
+        solver, trans, n, nrhs, (double*) dA, ldda, dipiv, dB, lddb );
+}
+
+//----------
+rocblas_status rocsolver_getrs(
+    rocblas_handle solver, rocblas_operation trans,
+    rocblas_int n, rocblas_int nrhs,
+    std::complex<float> const* dA, rocblas_int ldda, rocblas_int const* dipiv,
+    std::complex<float>* dB, rocblas_int lddb )
+{
+    return rocsolver_cgetrs(
+        solver, trans, n, nrhs,
+        (rocblas_float_complex*) dA, ldda, dipiv,
+        (rocblas_float_complex*) dB, lddb );
+}
+
+//----------
+rocblas_status rocsolver_getrs(
+    rocblas_handle solver, rocblas_operation trans,
+    rocblas_int n, rocblas_int nrhs,
+    std::complex<double> const* dA, rocblas_int ldda, rocblas_int const* dipiv,
+    std::complex<double>* dB, rocblas_int lddb )
+{
+    return rocsolver_zgetrs(
+        solver, trans, n, nrhs,
+        (rocblas_double_complex*) dA, ldda, dipiv,
+        (rocblas_double_complex*) dB, lddb );
+}
+
+//------------------------------------------------------------------------------
+// Wrapper around rocSolver.
+// This is async. rocSolver getrs has no info; dev_info is set to 0.
+template <typename scalar_t>
+void getrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    scalar_t const* dA, int64_t ldda, device_pivot_int const* dipiv,
+    scalar_t* dB, int64_t lddb,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    auto solver = queue.handle();
+    if (! blas::is_complex<scalar_t>::value && trans == Op::ConjTrans)
+        trans = Op::Trans;
+    auto trans_ = blas::internal::op2rocblas( trans );
+
+    // for cuda, rocm, call set_device; for oneapi, do nothing.
+    blas::internal_set_device( queue.device() );
+
+    blas_dev_call(
+        rocsolver_getrs(
+            solver, trans_, n, nrhs, dA, ldda, dipiv, dB, lddb ));
+    blas::device_memset( dev_info, 0, 1, queue );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void getrs_work_size_bytes(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    float const* dA, int64_t ldda,
+    float* dB, int64_t lddb,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void getrs_work_size_bytes(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    double const* dA, int64_t ldda,
+    double* dB, int64_t lddb,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void getrs_work_size_bytes(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<float> const* dA, int64_t ldda,
+    std::complex<float>* dB, int64_t lddb,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void getrs_work_size_bytes(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<double> const* dA, int64_t ldda,
+    std::complex<double>* dB, int64_t lddb,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+//--------------------
+template
+void getrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    float const* dA, int64_t ldda, device_pivot_int const* dev_ipiv,
+    float* dB, int64_t lddb,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void getrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    double const* dA, int64_t ldda, device_pivot_int const* dev_ipiv,
+    double* dB, int64_t lddb,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void getrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<float> const* dA, int64_t ldda, device_pivot_int const* dev_ipiv,
+    std::complex<float>* dB, int64_t lddb,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void getrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<double> const* dA, int64_t ldda, device_pivot_int const* dev_ipiv,
+    std::complex<double>* dB, int64_t lddb,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+} // namespace lapack
+
+#endif // LAPACK_HAVE_ROCBLAS
@@ -0,0 +1,189 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/defines.h"
+
+#if defined(LAPACK_HAVE_ROCBLAS)
+
+#include "rocm_common.hh"
+
+//==============================================================================
+// todo: put into BLAS++ header somewhere.
+namespace blas {
+namespace internal {
+
+rocblas_fill uplo2rocblas(blas::Uplo uplo);
+
+} // namespace internal
+} // namespace blas
+
+//==============================================================================
+namespace lapack {
+
+// Max sweeps, matching the cuSolver default.
+const rocblas_int rocsolver_heevj_max_sweeps = 100;
+
+//------------------------------------------------------------------------------
+// Workspace query. The device workspace holds the residual, a real_t,
+// then the number of sweeps, a rocblas_int.
+// dA, dW are only for templating scalar_t; they aren't referenced.
+template <typename scalar_t>
+void heevj_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo,
+    int64_t n, scalar_t* dA, int64_t ldda, blas::real_type<scalar_t>* dW,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue )
+{
+    *dev_work_size = sizeof(double) + sizeof(rocblas_int);
+    *host_work_size = 0;
+}
+
+//------------------------------------------------------------------------------
+// Intermediate wrappers around rocSolver to deal with precisions.
+// abstol = 0 uses the default tolerance.
+rocblas_status rocsolver_heevj(
+    rocblas_handle solver, const rocblas_evect jobz,
+    const rocblas_fill uplo, rocblas_int n, float* dA,
+    const rocblas_int ldda, float* dW, float* dresidual,
+    rocblas_int* dsweeps, rocblas_int* info )
+{
+    return rocsolver_ssyevj(
+        solver, rocblas_esort_ascending, jobz, uplo, n, dA, ldda,
+        0, dresidual, rocsolver_heevj_max_sweeps, dsweeps, dW, info );
+}
+
+//----------
+rocblas_status rocsolver_heevj(
+    rocblas_handle solver, const rocblas_evect jobz,
+    const rocblas_fill uplo, rocblas_int n, double* dA,
+    const rocblas_int ldda, double* dW, double* dresidual,
+    rocblas_int* dsweeps, rocblas_int* info )
+{
+    return rocsolver_dsyevj(
+        solver, rocblas_esort_ascending, jobz, uplo, n, dA, ldda,
+        0, dresidual, rocsolver_heevj_max_sweeps, dsweeps, dW, info );
+}
+
+//----------
+rocblas_status rocsolver_heevj(
+    rocblas_handle solver, const rocblas_evect jobz,
+    const rocblas_fill uplo, rocblas_int n, std::complex<float>* dA,
+    const rocblas_int ldda, float* dW, float* dresidual,
+    rocblas_int* dsweeps, rocblas_int* info )
+{
+    return rocsolver_cheevj(
+        solver, rocblas_esort_ascending, jobz, uplo, n,
+        (rocblas_float_complex*) dA, ldda,
+        0, dresidual, rocsolver_heevj_max_sweeps, dsweeps, dW, info );
+}
+
+//----------
+rocblas_status rocsolver_heevj(
+    rocblas_handle solver, const rocblas_evect jobz,
+    const rocblas_fill uplo, rocblas_int n, std::complex<double>* dA,
+    const rocblas_int ldda, double* dW, double* dresidual,
+    rocblas_int* dsweeps, rocblas_int* info )
+{
+    return rocsolver_zheevj(
+        solver, rocblas_esort_ascending, jobz, uplo, n,
+        (rocblas_double_complex*) dA, ldda,
+        0, dresidual, rocsolver_heevj_max_sweeps, dsweeps, dW, info );
+}
+
+//------------------------------------------------------------------------------
+// Wrapper around rocSolver.
+// This is async. Once finished, the return info is in dev_info on the device.
+template <typename scalar_t>
+void heevj(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    scalar_t* dA, int64_t ldda, blas::real_type<scalar_t>* dW,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    using real_t = blas::real_type<scalar_t>;
+    auto solver = queue.handle();
+
+    // Split the workspace, as in heevj_work_size_bytes.
+    char* work = (char*) dev_work;
+    real_t* dresidual = (real_t*) work;
+    rocblas_int* dsweeps = (rocblas_int*) (work + sizeof(double));
+
+    // for cuda, rocm, call set_device; for oneapi, do nothing.
+    blas::internal_set_device( queue.device() );
+
+    blas_dev_call(
+        rocsolver_heevj(
+            solver, job2eigmode_rocsolver( jobz ),
+            blas::internal::uplo2rocblas( uplo ), n, dA, ldda, dW,
+            dresidual, dsweeps, dev_info ));
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void heevj_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo,
+    int64_t n, float* dA, int64_t ldda, float* dW,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void heevj_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo,
+    int64_t n, double* dA, int64_t ldda, double* dW,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void heevj_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo,
+    int64_t n, std::complex<float>* dA, int64_t ldda, float* dW,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void heevj_work_size_bytes(
+    lapack::Job jobz, lapack::Uplo uplo,
+    int64_t n, std::complex<double>* dA, int64_t ldda, double* dW,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+//--------------------
+template
+void heevj(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* dA, int64_t ldda, float* dW,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void heevj(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* dA, int64_t ldda, double* dW,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void heevj(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* dA, int64_t ldda, float* dW,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void heevj(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* dA, int64_t ldda, double* dW,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+} // namespace lapack
+
+#endif // LAPACK_HAVE_ROCBLAS
@@ -0,0 +1,184 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/defines.h"
+
+#if defined(LAPACK_HAVE_ROCBLAS)
+
+#include "rocm_common.hh"
+
+//==============================================================================
+// todo: put into BLAS++ header somewhere.
+namespace blas {
+namespace internal {
+
+rocblas_fill uplo2rocblas(blas::Uplo uplo);
+
+} // namespace internal
+} // namespace blas
+
+//==============================================================================
+namespace lapack {
+
+//------------------------------------------------------------------------------
+// Workspace query. rocSolver potrs needs no workspace.
+// dA, dB are only for templating scalar_t; they aren't referenced.
+template <typename scalar_t>
+void potrs_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t const* dA, int64_t ldda,
+    scalar_t* dB, int64_t lddb,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue )
+{
+    *dev_work_size  = 0;
+    *host_work_size = 0;
+}
+
+//------------------------------------------------------------------------------
+// Intermediate wrappers around rocSolver to deal with precisions.
+// rocSolver takes A as non-const, though it isn't modified.
+rocblas_status rocsolver_potrs(
+    rocblas_handle solver, rocblas_fill uplo,
+    rocblas_int n, rocblas_int nrhs,
+    float const* dA, rocblas_int ldda, float* dB, rocblas_int lddb )
+{
+    return rocsolver_spotrs(
+        solver, uplo, n, nrhs, (float*) dA, ldda, dB, lddb );
+}
+
+//----------
+rocblas_status rocsolver_potrs(
+    rocblas_handle solver, rocblas_fill uplo,
+    rocblas_int n, rocblas_int nrhs,
+    double const* dA, rocblas_int ldda, double* dB, rocblas_int lddb )
+{
+    return rocsolver_dpotrs(
+        solver, uplo, n, nrhs, (double*) dA, ldda, dB, lddb );
+}
+
+//----------
+rocblas_status rocsolver_potrs(
+    rocblas_handle solver, rocblas_fill uplo,
+    rocblas_int n, rocblas_int nrhs,
+    std::complex<float> const* dA, rocblas_int ldda,
+    std::complex<float>* dB, rocblas_int lddb )
+{
+    return rocsolver_cpotrs(
+        solver, uplo, n, nrhs,
+        (rocblas_float_complex*) dA, ldda,
+        (rocblas_float_complex*) dB, lddb );
+}
+
+//----------
+rocblas_status rocsolver_potrs(
+    rocblas_handle solver, rocblas_fill uplo,
+    rocblas_int n, rocblas_int nrhs,
+    std::complex<double> const* dA, rocblas_int ldda,
+    std::complex<double>* dB, rocblas_int lddb )
+{
+    return rocsolver_zpotrs(
+        solver, uplo, n, nrhs,
+        (rocblas_double_complex*) dA, ldda,
+        (rocblas_double_complex*) dB, lddb );
+}
+
+//------------------------------------------------------------------------------
+// Wrapper around rocSolver.
+// This is async. rocSolver potrs has no info; dev_info is set to 0.
+template <typename scalar_t>
+void potrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t const* dA, int64_t ldda,
+    scalar_t* dB, int64_t lddb,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    auto solver = queue.handle();
+    auto uplo_ = blas::internal::uplo2rocblas( uplo );
+
+    // for cuda, rocm, call set_device; for oneapi, do nothing.
+    blas::internal_set_device( queue.device() );
+
+    blas_dev_call(
+        rocsolver_potrs( solver, uplo_, n, nrhs, dA, ldda, dB, lddb ));
+    blas::device_memset( dev_info, 0, 1, queue );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void potrs_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* dA, int64_t ldda,
+    float* dB, int64_t lddb,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void potrs_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* dA, int64_t ldda,
+    double* dB, int64_t lddb,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void potrs_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* dA, int64_t ldda,
+    std::complex<float>* dB, int64_t lddb,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void potrs_work_size_bytes(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* dA, int64_t ldda,
+    std::complex<double>* dB, int64_t lddb,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+//--------------------
+template
+void potrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* dA, int64_t ldda,
+    float* dB, int64_t lddb,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void potrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* dA, int64_t ldda,
+    double* dB, int64_t lddb,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void potrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* dA, int64_t ldda,
+    std::complex<float>* dB, int64_t lddb,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void potrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* dA, int64_t ldda,
+    std::complex<double>* dB, int64_t lddb,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+} // namespace lapack
+
+#endif // LAPACK_HAVE_ROCBLAS
@@ -0,0 +1,159 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/defines.h"
+
+#if defined(LAPACK_HAVE_ROCBLAS)
+
+#include "rocm_common.hh"
+
+//==============================================================================
+namespace lapack {
+
+//------------------------------------------------------------------------------
+// Workspace query. rocSolver orgqr, ungqr need no workspace.
+// dA, dtau are only for templating scalar_t; they aren't referenced.
+template <typename scalar_t>
+void ungqr_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    scalar_t* dA, int64_t ldda, scalar_t const* dtau,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue )
+{
+    *dev_work_size  = 0;
+    *host_work_size = 0;
+}
+
+//------------------------------------------------------------------------------
+// Intermediate wrappers around rocSolver to deal with precisions.
+// rocSolver takes tau as non-const, though it isn't modified.
+rocblas_status rocsolver_ungqr(
+    rocblas_handle solver, rocblas_int m, rocblas_int n, rocblas_int k,
+    float* dA, rocblas_int ldda, float const* dtau )
+{
+    return rocsolver_sorgqr(
+        solver, m, n, k, dA, ldda, (float*) dtau );
+}
+
+//----------
+rocblas_status rocsolver_ungqr(
+    rocblas_handle solver, rocblas_int m, rocblas_int n, rocblas_int k,
+    double* dA, rocblas_int ldda, double const* dtau )
+{
+    return rocsolver_dorgqr(
+        solver, m, n, k, dA, ldda, (double*) dtau );
+}
+
+//----------
+rocblas_status rocsolver_ungqr(
+    rocblas_handle solver, rocblas_int m, rocblas_int n, rocblas_int k,
+    std::complex<float>* dA, rocblas_int ldda,
+    std::complex<float> const* dtau )
+{
+    return rocsolver_cungqr(
+        solver, m, n, k,
+        (rocblas_float_complex*) dA, ldda,
+        (rocblas_float_complex*) dtau );
+}
+
+//----------
+rocblas_status rocsolver_ungqr(
+    rocblas_handle solver, rocblas_int m, rocblas_int n, rocblas_int k,
+    std::complex<double>* dA, rocblas_int ldda,
+    std::complex<double> const* dtau )
+{
+    return rocsolver_zungqr(
+        solver, m, n, k,
+        (rocblas_double_complex*) dA, ldda,
+        (rocblas_double_complex*) dtau );
+}
+
+//------------------------------------------------------------------------------
+// Wrapper around rocSolver.
+// This is async. rocSolver ungqr has no info; dev_info is set to 0.
+template <typename scalar_t>
+void ungqr(
+    int64_t m, int64_t n, int64_t k,
+    scalar_t* dA, int64_t ldda, scalar_t const* dtau,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    auto solver = queue.handle();
+
+    // for cuda, rocm, call set_device; for oneapi, do nothing.
+    blas::internal_set_device( queue.device() );
+
+    blas_dev_call(
+        rocsolver_ungqr( solver, m, n, k, dA, ldda, dtau ));
+    blas::device_memset( dev_info, 0, 1, queue );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void ungqr_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    float* dA, int64_t ldda, float const* dtau,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void ungqr_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    double* dA, int64_t ldda, double const* dtau,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void ungqr_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<float>* dA, int64_t ldda, std::complex<float> const* dtau,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void ungqr_work_size_bytes(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<double>* dA, int64_t ldda, std::complex<double> const* dtau,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+//--------------------
+template
+void ungqr(
+    int64_t m, int64_t n, int64_t k,
+    float* dA, int64_t ldda, float const* dtau,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void ungqr(
+    int64_t m, int64_t n, int64_t k,
+    double* dA, int64_t ldda, double const* dtau,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void ungqr(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<float>* dA, int64_t ldda, std::complex<float> const* dtau,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void ungqr(
+    int64_t m, int64_t n, int64_t k,
+    std::complex<double>* dA, int64_t ldda, std::complex<double> const* dtau,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+} // namespace lapack
+
+#endif // LAPACK_HAVE_ROCBLAS
@@ -0,0 +1,197 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/defines.h"
+
+#if defined(LAPACK_HAVE_ROCBLAS)
+
+#include "rocm_common.hh"
+
+//==============================================================================
+// todo: put into BLAS++ header somewhere.
+namespace blas {
+namespace internal {
+
+rocblas_operation op2rocblas(blas::Op op);
+rocblas_side side2rocblas(blas::Side side);
+
+} // namespace internal
+} // namespace blas
+
+//==============================================================================
+namespace lapack {
+
+//------------------------------------------------------------------------------
+// Workspace query. rocSolver ormqr, unmqr need no workspace.
+// dA, dtau, dC are only for templating scalar_t; they aren't referenced.
+template <typename scalar_t>
+void unmqr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    scalar_t const* dA, int64_t ldda, scalar_t const* dtau,
+    scalar_t* dC, int64_t lddc,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue )
+{
+    *dev_work_size  = 0;
+    *host_work_size = 0;
+}
+
+//------------------------------------------------------------------------------
+// Intermediate wrappers around rocSolver to deal with precisions.
+// rocSolver takes A, tau as non-const, though they aren't modified.
+rocblas_status rocsolver_unmqr(
+    rocblas_handle solver, rocblas_side side, rocblas_operation trans,
+    rocblas_int m, rocblas_int n, rocblas_int k,
+    float const* dA, rocblas_int ldda, float const* dtau,
+    float* dC, rocblas_int lddc )
+{
+    return rocsolver_sormqr(
+        solver, side, trans, m, n, k,
+        (float*) dA, ldda, (float*) dtau, dC, lddc );
+}
+
+//----------
+rocblas_status rocsolver_unmqr(
+    rocblas_handle solver, rocblas_side side, rocblas_operation trans,
+    rocblas_int m, rocblas_int n, rocblas_int k,
+    double const* dA, rocblas_int ldda, double const* dtau,
+    double* dC, rocblas_int lddc )
+{
+    return rocsolver_dormqr(
+        solver, side, trans, m, n, k,
+        (double*) dA, ldda, (double*) dtau, dC, lddc );
+}
+
+//----------
+rocblas_status rocsolver_unmqr(
+    rocblas_handle solver, rocblas_side side, rocblas_operation trans,
+    rocblas_int m, rocblas_int n, rocblas_int k,
+    std::complex<float> const* dA, rocblas_int ldda,
+    std::complex<float> const* dtau,
+    std::complex<float>* dC, rocblas_int lddc )
+{
+    return rocsolver_cunmqr(
+        solver, side, trans, m, n, k,
+        (rocblas_float_complex*) dA, ldda,
+        (rocblas_float_complex*) dtau,
+        (rocblas_float_complex*) dC, lddc );
+}
+
+//----------
+rocblas_status rocsolver_unmqr(
+    rocblas_handle solver, rocblas_side side, rocblas_operation trans,
+    rocblas_int m, rocblas_int n, rocblas_int k,
+    std::complex<double> const* dA, rocblas_int ldda,
+    std::complex<double> const* dtau,
+    std::complex<double>* dC, rocblas_int lddc )
+{
+    return rocsolver_zunmqr(
+        solver, side, trans, m, n, k,
+        (rocblas_double_complex*) dA, ldda,
+        (rocblas_double_complex*) dtau,
+        (rocblas_double_complex*) dC, lddc );
+}
+
+//------------------------------------------------------------------------------
+// Wrapper around rocSolver.
+// This is async. rocSolver unmqr has no info; dev_info is set to 0.
+template <typename scalar_t>
+void unmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    scalar_t const* dA, int64_t ldda, scalar_t const* dtau,
+    scalar_t* dC, int64_t lddc,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue )
+{
+    auto solver = queue.handle();
+    if (! blas::is_complex<scalar_t>::value && trans == Op::ConjTrans)
+        trans = Op::Trans;
+    auto side_  = blas::internal::side2rocblas( side );
+    auto trans_ = blas::internal::op2rocblas( trans );
+
+    // for cuda, rocm, call set_device; for oneapi, do nothing.
+    blas::internal_set_device( queue.device() );
+
+    blas_dev_call(
+        rocsolver_unmqr(
+            solver, side_, trans_, m, n, k, dA, ldda, dtau, dC, lddc ));
+    blas::device_memset( dev_info, 0, 1, queue );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+void unmqr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* dA, int64_t ldda, float const* dtau,
+    float* dC, int64_t lddc,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void unmqr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* dA, int64_t ldda, double const* dtau,
+    double* dC, int64_t lddc,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void unmqr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* dA, int64_t ldda, std::complex<float> const* dtau,
+    std::complex<float>* dC, int64_t lddc,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+template
+void unmqr_work_size_bytes(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* dA, int64_t ldda, std::complex<double> const* dtau,
+    std::complex<double>* dC, int64_t lddc,
+    size_t* dev_work_size, size_t* host_work_size,
+    lapack::Queue& queue );
+
+//--------------------
+template
+void unmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* dA, int64_t ldda, float const* dtau,
+    float* dC, int64_t lddc,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void unmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* dA, int64_t ldda, double const* dtau,
+    double* dC, int64_t lddc,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void unmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* dA, int64_t ldda, std::complex<float> const* dtau,
+    std::complex<float>* dC, int64_t lddc,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+template
+void unmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* dA, int64_t ldda, std::complex<double> const* dtau,
+    std::complex<double>* dC, int64_t lddc,
+    void*  dev_work, size_t  dev_work_size,
+    void* host_work, size_t host_work_size,
+    device_info_int* dev_info, lapack::Queue& queue );
+
+} // namespace lapack
+
+#endif // LAPACK_HAVE_ROCBLAS
@@ -30,6 +30,7 @@ int64_t sbev(
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sbev", float, 0, n, kd, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (max( 1, 3*n-2 )) );
@@ -61,6 +62,7 @@ int64_t sbev(
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sbev", double, 0, n, kd, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (max( 1, 3*n-2 )) );
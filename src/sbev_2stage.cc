@@ -25,6 +25,54 @@ int64_t sbev_2stage(
     float* W,
     float* Z, int64_t ldz )
 {
+    // query for workspace size
+    int64_t lwork;
+    sbev_2stage_work_size(
+        jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return sbev_2stage(
+        jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t sbev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz )
+{
+    // query for workspace size
+    int64_t lwork;
+    sbev_2stage_work_size(
+        jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return sbev_2stage(
+        jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+void sbev_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "ssbev_2stage", jobz, uplo, n, kd, ldab, ldz );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -33,7 +81,6 @@ int64_t sbev_2stage(
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
 
-    // query for workspace size
     float qry_work[1];
     lapack_int ineg_one = -1;
     LAPACK_ssbev_2stage(
@@ -46,30 +93,54 @@ int64_t sbev_2stage(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+void sbev_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "dsbev_2stage", jobz, uplo, n, kd, ldab, ldz );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
 
-    LAPACK_ssbev_2stage(
+    char jobz_ = to_char( jobz );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int kd_ = to_lapack_int( kd );
+    lapack_int ldab_ = to_lapack_int( ldab );
+    lapack_int ldz_ = to_lapack_int( ldz );
+    lapack_int info_ = 0;
+
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dsbev_2stage(
         &jobz_, &uplo_, &n_, &kd_,
         AB, &ldab_,
         W,
         Z, &ldz_,
-        &work[0], &lwork_, &info_
+        qry_work, &ineg_one, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    return info_;
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
 }
 
 // -----------------------------------------------------------------------------
 int64_t sbev_2stage(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    double* AB, int64_t ldab,
-    double* W,
-    double* Z, int64_t ldz )
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz,
+    float* work, int64_t lwork )
 {
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
@@ -78,31 +149,46 @@ int64_t sbev_2stage(
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sbev_2stage", float, 0, n, kd, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dsbev_2stage(
+    LAPACK_ssbev_2stage(
         &jobz_, &uplo_, &n_, &kd_,
         AB, &ldab_,
         W,
         Z, &ldz_,
-        qry_work, &ineg_one, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+int64_t sbev_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz,
+    double* work, int64_t lwork )
+{
+    char jobz_ = to_char( jobz );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int kd_ = to_lapack_int( kd );
+    lapack_int ldab_ = to_lapack_int( ldab );
+    lapack_int ldz_ = to_lapack_int( ldz );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sbev_2stage", double, 0, n, kd, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
     LAPACK_dsbev_2stage(
         &jobz_, &uplo_, &n_, &kd_,
         AB, &ldab_,
         W,
         Z, &ldz_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
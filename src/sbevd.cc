@@ -23,6 +23,56 @@ int64_t sbevd(
     float* W,
     float* Z, int64_t ldz )
 {
+    // query for workspace size
+    int64_t lwork, liwork;
+    sbevd_work_size(
+        jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+    lapack::vector< int64_t > iwork( liwork );
+
+    return sbevd(
+        jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t sbevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz )
+{
+    // query for workspace size
+    int64_t lwork, liwork;
+    sbevd_work_size(
+        jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+    lapack::vector< int64_t > iwork( liwork );
+
+    return sbevd(
+        jobz, uplo, n, kd, AB, ldab, W, Z, ldz,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+void sbevd_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* lwork, int64_t* liwork )
+{
+    auto key = internal::work_size_key(
+        "ssbevd", jobz, uplo, n, kd, ldab, ldz );
+    if (internal::work_size_cache_find( key, lwork, liwork ))
+        return;
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -31,7 +81,6 @@ int64_t sbevd(
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
 
-    // query for workspace size
     float qry_work[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
@@ -46,33 +95,59 @@ int64_t sbevd(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    *lwork = real(qry_work[0]);
+    *liwork = real(qry_iwork[0]);
+    internal::work_size_cache_insert( key, *lwork, *liwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+// -----------------------------------------------------------------------------
+void sbevd_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* lwork, int64_t* liwork )
+{
+    auto key = internal::work_size_key(
+        "dsbevd", jobz, uplo, n, kd, ldab, ldz );
+    if (internal::work_size_cache_find( key, lwork, liwork ))
+        return;
 
-    LAPACK_ssbevd(
+    char jobz_ = to_char( jobz );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int kd_ = to_lapack_int( kd );
+    lapack_int ldab_ = to_lapack_int( ldab );
+    lapack_int ldz_ = to_lapack_int( ldz );
+    lapack_int info_ = 0;
+
+    double qry_work[1];
+    lapack_int qry_iwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dsbevd(
         &jobz_, &uplo_, &n_, &kd_,
         AB, &ldab_,
         W,
         Z, &ldz_,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_, &info_
+        qry_work, &ineg_one,
+        qry_iwork, &ineg_one, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    return info_;
+    *lwork = real(qry_work[0]);
+    *liwork = real(qry_iwork[0]);
+    internal::work_size_cache_insert( key, *lwork, *liwork );
 }
 
 // -----------------------------------------------------------------------------
 int64_t sbevd(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
-    double* AB, int64_t ldab,
-    double* W,
-    double* Z, int64_t ldz )
+    float* AB, int64_t ldab,
+    float* W,
+    float* Z, int64_t ldz,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
 {
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
@@ -81,36 +156,55 @@ int64_t sbevd(
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sbevd", float, 0, n, kd, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int liwork_ = to_lapack_int( liwork );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dsbevd(
+    LAPACK_ssbevd(
         &jobz_, &uplo_, &n_, &kd_,
         AB, &ldab_,
         W,
         Z, &ldz_,
-        qry_work, &ineg_one,
-        qry_iwork, &ineg_one, &info_
+        work, &lwork_,
+        iwork_, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+// -----------------------------------------------------------------------------
+int64_t sbevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* W,
+    double* Z, int64_t ldz,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    char jobz_ = to_char( jobz );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int kd_ = to_lapack_int( kd );
+    lapack_int ldab_ = to_lapack_int( ldab );
+    lapack_int ldz_ = to_lapack_int( ldz );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sbevd", double, 0, n, kd, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int liwork_ = to_lapack_int( liwork );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
 
     LAPACK_dsbevd(
         &jobz_, &uplo_, &n_, &kd_,
         AB, &ldab_,
         W,
         Z, &ldz_,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_, &info_
+        work, &lwork_,
+        iwork_, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -45,6 +45,7 @@ int64_t sbevx(
         lapack_int* ifail_ptr = ifail;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sbevx", float, 0, n, kd, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (7*n) );
@@ -101,6 +102,7 @@ int64_t sbevx(
         lapack_int* ifail_ptr = ifail;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sbevx", double, 0, n, kd, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (7*n) );
@@ -28,6 +28,66 @@ int64_t sbevx_2stage(
     float* Z, int64_t ldz,
     int64_t* ifail )
 {
+    // query for workspace size
+    int64_t lwork, liwork;
+    sbevx_2stage_work_size(
+        jobz, range, uplo, n, kd, AB, ldab, Q, ldq, vl, vu, il, iu, abstol,
+        nfound, W, Z, ldz, ifail,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+    lapack::vector< int64_t > iwork( liwork );
+
+    return sbevx_2stage(
+        jobz, range, uplo, n, kd, AB, ldab, Q, ldq, vl, vu, il, iu, abstol,
+        nfound, W, Z, ldz, ifail,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t sbevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail )
+{
+    // query for workspace size
+    int64_t lwork, liwork;
+    sbevx_2stage_work_size(
+        jobz, range, uplo, n, kd, AB, ldab, Q, ldq, vl, vu, il, iu, abstol,
+        nfound, W, Z, ldz, ifail,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+    lapack::vector< int64_t > iwork( liwork );
+
+    return sbevx_2stage(
+        jobz, range, uplo, n, kd, AB, ldab, Q, ldq, vl, vu, il, iu, abstol,
+        nfound, W, Z, ldz, ifail,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+void sbevx_2stage_work_size(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail,
+    int64_t* lwork, int64_t* liwork )
+{
+    auto key = internal::work_size_key(
+        "ssbevx_2stage", jobz, range, uplo, n, kd, ldab, ldq, il, iu, ldz );
+    if (internal::work_size_cache_find( key, lwork, liwork ))
+        return;
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     char uplo_ = to_char( uplo );
@@ -39,16 +99,9 @@ int64_t sbevx_2stage(
     lapack_int iu_ = to_lapack_int( iu );
     lapack_int nfound_ = 0;  // out
     lapack_int ldz_ = to_lapack_int( ldz );
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ifail_( (n) );
-        lapack_int* ifail_ptr = &ifail_[0];
-    #else
-        lapack_int* ifail_ptr = ifail;
-    #endif
+    lapack_int* ifail_ptr = reinterpret_cast< lapack_int* >( ifail );  // not referenced
     lapack_int info_ = 0;
 
-    // query for workspace size
     float qry_work[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
@@ -65,43 +118,73 @@ int64_t sbevx_2stage(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    *liwork = 5*n;
+    internal::work_size_cache_insert( key, *lwork, *liwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (5*n) );
+// -----------------------------------------------------------------------------
+void sbevx_2stage_work_size(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    int64_t* lwork, int64_t* liwork )
+{
+    auto key = internal::work_size_key(
+        "dsbevx_2stage", jobz, range, uplo, n, kd, ldab, ldq, il, iu, ldz );
+    if (internal::work_size_cache_find( key, lwork, liwork ))
+        return;
 
-    LAPACK_ssbevx_2stage(
+    char jobz_ = to_char( jobz );
+    char range_ = to_char( range );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int kd_ = to_lapack_int( kd );
+    lapack_int ldab_ = to_lapack_int( ldab );
+    lapack_int ldq_ = to_lapack_int( ldq );
+    lapack_int il_ = to_lapack_int( il );
+    lapack_int iu_ = to_lapack_int( iu );
+    lapack_int nfound_ = 0;  // out
+    lapack_int ldz_ = to_lapack_int( ldz );
+    lapack_int* ifail_ptr = reinterpret_cast< lapack_int* >( ifail );  // not referenced
+    lapack_int info_ = 0;
+
+    double qry_work[1];
+    lapack_int qry_iwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dsbevx_2stage(
         &jobz_, &range_, &uplo_, &n_, &kd_,
         AB, &ldab_,
         Q, &ldq_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
         W,
         Z, &ldz_,
-        &work[0], &lwork_,
-        &iwork[0],
+        qry_work, &ineg_one,
+        qry_iwork,
         ifail_ptr, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    *nfound = nfound_;
-    #ifndef LAPACK_ILP64
-        if (jobz != Job::NoVec) {
-            std::copy( &ifail_[ 0 ], &ifail_[ nfound_ ], ifail );
-        }
-    #endif
-    return info_;
+    *lwork = real(qry_work[0]);
+    *liwork = 5*n;
+    internal::work_size_cache_insert( key, *lwork, *liwork );
 }
 
 // -----------------------------------------------------------------------------
 int64_t sbevx_2stage(
     lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
-    double* AB, int64_t ldab,
-    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    float* AB, int64_t ldab,
+    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
     int64_t* nfound,
-    double* W,
-    double* Z, int64_t ldz,
-    int64_t* ifail )
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
 {
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
@@ -122,29 +205,70 @@ int64_t sbevx_2stage(
         lapack_int* ifail_ptr = ifail;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sbevx_2stage", float, 0, n, kd, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( liwork < 5*n );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dsbevx_2stage(
+    LAPACK_ssbevx_2stage(
         &jobz_, &range_, &uplo_, &n_, &kd_,
         AB, &ldab_,
         Q, &ldq_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
         W,
         Z, &ldz_,
-        qry_work, &ineg_one,
-        qry_iwork,
+        work, &lwork_,
+        iwork_,
         ifail_ptr, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *nfound = nfound_;
+    #ifndef LAPACK_ILP64
+        if (jobz != Job::NoVec) {
+            std::copy( &ifail_[ 0 ], &ifail_[ nfound_ ], ifail );
+        }
+    #endif
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (5*n) );
+// -----------------------------------------------------------------------------
+int64_t sbevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    char jobz_ = to_char( jobz );
+    char range_ = to_char( range );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int kd_ = to_lapack_int( kd );
+    lapack_int ldab_ = to_lapack_int( ldab );
+    lapack_int ldq_ = to_lapack_int( ldq );
+    lapack_int il_ = to_lapack_int( il );
+    lapack_int iu_ = to_lapack_int( iu );
+    lapack_int nfound_ = 0;  // out
+    lapack_int ldz_ = to_lapack_int( ldz );
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > ifail_( (n) );
+        lapack_int* ifail_ptr = &ifail_[0];
+    #else
+        lapack_int* ifail_ptr = ifail;
+    #endif
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sbevx_2stage", double, 0, n, kd, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( liwork < 5*n );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
 
     LAPACK_dsbevx_2stage(
         &jobz_, &range_, &uplo_, &n_, &kd_,
@@ -152,8 +276,8 @@ int64_t sbevx_2stage(
         Q, &ldq_, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
         W,
         Z, &ldz_,
-        &work[0], &lwork_,
-        &iwork[0],
+        work, &lwork_,
+        iwork_,
         ifail_ptr, &info_
     );
     if (info_ < 0) {
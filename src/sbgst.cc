@@ -32,6 +32,7 @@ int64_t sbgst(
     lapack_int ldbb_ = to_lapack_int( ldbb );
     lapack_int ldx_ = to_lapack_int( ldx );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sbgst", float, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (2*n) );
@@ -65,6 +66,7 @@ int64_t sbgst(
     lapack_int ldbb_ = to_lapack_int( ldbb );
     lapack_int ldx_ = to_lapack_int( ldx );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sbgst", double, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (2*n) );
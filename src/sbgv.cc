@@ -33,6 +33,7 @@ int64_t sbgv(
     lapack_int ldbb_ = to_lapack_int( ldbb );
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sbgv", float, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (3*n) );
@@ -68,6 +69,7 @@ int64_t sbgv(
     lapack_int ldbb_ = to_lapack_int( ldbb );
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sbgv", double, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (3*n) );
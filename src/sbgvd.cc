@@ -24,6 +24,58 @@ int64_t sbgvd(
     float* W,
     float* Z, int64_t ldz )
 {
+    // query for workspace size
+    int64_t lwork, liwork;
+    sbgvd_work_size(
+        jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+    lapack::vector< int64_t > iwork( liwork );
+
+    return sbgvd(
+        jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t sbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    double* AB, int64_t ldab,
+    double* BB, int64_t ldbb,
+    double* W,
+    double* Z, int64_t ldz )
+{
+    // query for workspace size
+    int64_t lwork, liwork;
+    sbgvd_work_size(
+        jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+    lapack::vector< int64_t > iwork( liwork );
+
+    return sbgvd(
+        jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+void sbgvd_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    float* AB, int64_t ldab,
+    float* BB, int64_t ldbb,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* lwork, int64_t* liwork )
+{
+    auto key = internal::work_size_key(
+        "ssbgvd", jobz, uplo, n, ka, kb, ldab, ldbb, ldz );
+    if (internal::work_size_cache_find( key, lwork, liwork ))
+        return;
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -34,7 +86,6 @@ int64_t sbgvd(
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
 
-    // query for workspace size
     float qry_work[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
@@ -51,38 +102,28 @@ int64_t sbgvd(
         throw Error();
     }
     lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    *liwork = real(qry_iwork[0]);
 
     // LAPACK <= 3.6.0 needed 3*n, but query returned 2*n. Be safe.
     lwork_ = max( lwork_, 3*n_ );
-
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
-
-    LAPACK_ssbgvd(
-        &jobz_, &uplo_, &n_, &ka_, &kb_,
-        AB, &ldab_,
-        BB, &ldbb_,
-        W,
-        Z, &ldz_,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    *lwork = lwork_;
+    internal::work_size_cache_insert( key, *lwork, *liwork );
 }
 
 // -----------------------------------------------------------------------------
-int64_t sbgvd(
+void sbgvd_work_size(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
     double* AB, int64_t ldab,
     double* BB, int64_t ldbb,
     double* W,
-    double* Z, int64_t ldz )
+    double* Z, int64_t ldz,
+    int64_t* lwork, int64_t* liwork )
 {
+    auto key = internal::work_size_key(
+        "dsbgvd", jobz, uplo, n, ka, kb, ldab, ldbb, ldz );
+    if (internal::work_size_cache_find( key, lwork, liwork ))
+        return;
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -93,7 +134,6 @@ int64_t sbgvd(
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
 
-    // query for workspace size
     double qry_work[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
@@ -110,14 +150,78 @@ int64_t sbgvd(
         throw Error();
     }
     lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    *liwork = real(qry_iwork[0]);
 
     // LAPACK <= 3.6.0 needed 3*n, but query returned 2*n. Be safe.
     lwork_ = max( lwork_, 3*n_ );
+    *lwork = lwork_;
+    internal::work_size_cache_insert( key, *lwork, *liwork );
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+// -----------------------------------------------------------------------------
+int64_t sbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    float* AB, int64_t ldab,
+    float* BB, int64_t ldbb,
+    float* W,
+    float* Z, int64_t ldz,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    char jobz_ = to_char( jobz );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ka_ = to_lapack_int( ka );
+    lapack_int kb_ = to_lapack_int( kb );
+    lapack_int ldab_ = to_lapack_int( ldab );
+    lapack_int ldbb_ = to_lapack_int( ldbb );
+    lapack_int ldz_ = to_lapack_int( ldz );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sbgvd", float, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int liwork_ = to_lapack_int( liwork );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
+
+    LAPACK_ssbgvd(
+        &jobz_, &uplo_, &n_, &ka_, &kb_,
+        AB, &ldab_,
+        BB, &ldbb_,
+        W,
+        Z, &ldz_,
+        work, &lwork_,
+        iwork_, &liwork_, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t sbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    double* AB, int64_t ldab,
+    double* BB, int64_t ldbb,
+    double* W,
+    double* Z, int64_t ldz,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    char jobz_ = to_char( jobz );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ka_ = to_lapack_int( ka );
+    lapack_int kb_ = to_lapack_int( kb );
+    lapack_int ldab_ = to_lapack_int( ldab );
+    lapack_int ldbb_ = to_lapack_int( ldbb );
+    lapack_int ldz_ = to_lapack_int( ldz );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sbgvd", double, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int liwork_ = to_lapack_int( liwork );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
 
     LAPACK_dsbgvd(
         &jobz_, &uplo_, &n_, &ka_, &kb_,
@@ -125,8 +229,8 @@ int64_t sbgvd(
         BB, &ldbb_,
         W,
         Z, &ldz_,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_, &info_
+        work, &lwork_,
+        iwork_, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -48,6 +48,7 @@ int64_t sbgvx(
         lapack_int* ifail_ptr = ifail;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sbgvx", float, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (7*n) );
@@ -108,6 +109,7 @@ int64_t sbgvx(
         lapack_int* ifail_ptr = ifail;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sbgvx", double, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (7*n) );
@@ -31,6 +31,7 @@ int64_t sbtrd(
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int ldq_ = to_lapack_int( ldq );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sbtrd", float, 0, n, kd, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (n) );
@@ -64,6 +65,7 @@ int64_t sbtrd(
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int ldq_ = to_lapack_int( ldq );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sbtrd", double, 0, n, kd, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (n) );
@@ -33,6 +33,7 @@ int64_t spcon(
         lapack_int const* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "spcon", float, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (2*n) );
@@ -68,6 +69,7 @@ int64_t spcon(
         lapack_int const* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "spcon", double, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (2*n) );
@@ -103,6 +105,7 @@ int64_t spcon(
         lapack_int const* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "spcon", std::complex<float>, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
@@ -136,6 +139,7 @@ int64_t spcon(
         lapack_int const* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "spcon", std::complex<double>, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
@@ -28,6 +28,7 @@ int64_t spev(
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "spev", float, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (3*n) );
@@ -57,6 +58,7 @@ int64_t spev(
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "spev", double, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (3*n) );
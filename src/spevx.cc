@@ -41,6 +41,7 @@ int64_t spevx(
         lapack_int* ifail_ptr = ifail;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "spevx", float, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (8*n) );
@@ -92,6 +93,7 @@ int64_t spevx(
         lapack_int* ifail_ptr = ifail;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "spevx", double, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (8*n) );
@@ -25,6 +25,7 @@ int64_t spgst(
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "spgst", float, 0, n, 0, 0, info_ );
 
     LAPACK_sspgst(
         &itype_, &uplo_, &n_,
@@ -47,6 +48,7 @@ int64_t spgst(
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "spgst", double, 0, n, 0, 0, info_ );
 
     LAPACK_dspgst(
         &itype_, &uplo_, &n_,
@@ -43,6 +43,7 @@ int64_t spgvx(
         lapack_int* ifail_ptr = ifail;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "spgvx", float, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (8*n) );
@@ -97,6 +98,7 @@ int64_t spgvx(
         lapack_int* ifail_ptr = ifail;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "spgvx", double, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (8*n) );
@@ -26,6 +26,7 @@ int64_t sptrd(
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sptrd", float, 0, n, 0, 0, info_ );
 
     LAPACK_ssptrd(
         &uplo_, &n_,
@@ -51,6 +52,7 @@ int64_t sptrd(
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sptrd", double, 0, n, 0, 0, info_ );
 
     LAPACK_dsptrd(
         &uplo_, &n_,
@@ -32,6 +32,7 @@ int64_t sptri(
         lapack_int const* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sptri", float, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (n) );
@@ -64,6 +65,7 @@ int64_t sptri(
         lapack_int const* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sptri", double, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (n) );
@@ -96,6 +98,7 @@ int64_t sptri(
         lapack_int const* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sptri", std::complex<float>, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<float> > work( (n) );
@@ -128,6 +131,7 @@ int64_t sptri(
         lapack_int const* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sptri", std::complex<double>, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (n) );
@@ -35,6 +35,7 @@ int64_t sptrs(
     #endif
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sptrs", float, 0, n, 0, nrhs, info_ );
 
     LAPACK_ssptrs(
         &uplo_, &n_, &nrhs_,
@@ -67,6 +68,7 @@ int64_t sptrs(
     #endif
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sptrs", double, 0, n, 0, nrhs, info_ );
 
     LAPACK_dsptrs(
         &uplo_, &n_, &nrhs_,
@@ -99,6 +101,7 @@ int64_t sptrs(
     #endif
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sptrs", std::complex<float>, 0, n, 0, nrhs, info_ );
 
     LAPACK_csptrs(
         &uplo_, &n_, &nrhs_,
@@ -131,6 +134,7 @@ int64_t sptrs(
     #endif
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sptrs", std::complex<double>, 0, n, 0, nrhs, info_ );
 
     LAPACK_zsptrs(
         &uplo_, &n_, &nrhs_,
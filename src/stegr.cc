@@ -26,6 +26,112 @@ int64_t stegr(
     float* Z, int64_t ldz,
     int64_t* isuppz )
 {
+    // query for workspace size
+    int64_t lwork, liwork;
+    stegr_work_size(
+        jobz, range, n, D, E, vl, vu, il, iu, abstol, nfound, W, Z, ldz, isuppz,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+    lapack::vector< int64_t > iwork( liwork );
+
+    return stegr(
+        jobz, range, n, D, E, vl, vu, il, iu, abstol, nfound, W, Z, ldz, isuppz,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t stegr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz )
+{
+    // query for workspace size
+    int64_t lwork, liwork;
+    stegr_work_size(
+        jobz, range, n, D, E, vl, vu, il, iu, abstol, nfound, W, Z, ldz, isuppz,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+    lapack::vector< int64_t > iwork( liwork );
+
+    return stegr(
+        jobz, range, n, D, E, vl, vu, il, iu, abstol, nfound, W, Z, ldz, isuppz,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t stegr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* isuppz )
+{
+    // query for workspace size
+    int64_t lwork, liwork;
+    stegr_work_size(
+        jobz, range, n, D, E, vl, vu, il, iu, abstol, nfound, W, Z, ldz, isuppz,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+    lapack::vector< int64_t > iwork( liwork );
+
+    return stegr(
+        jobz, range, n, D, E, vl, vu, il, iu, abstol, nfound, W, Z, ldz, isuppz,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t stegr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* isuppz )
+{
+    // query for workspace size
+    int64_t lwork, liwork;
+    stegr_work_size(
+        jobz, range, n, D, E, vl, vu, il, iu, abstol, nfound, W, Z, ldz, isuppz,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+    lapack::vector< int64_t > iwork( liwork );
+
+    return stegr(
+        jobz, range, n, D, E, vl, vu, il, iu, abstol, nfound, W, Z, ldz, isuppz,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+void stegr_work_size(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz,
+    int64_t* lwork, int64_t* liwork )
+{
+    auto key = internal::work_size_key(
+        "sstegr", jobz, range, n, il, iu, ldz );
+    if (internal::work_size_cache_find( key, lwork, liwork ))
+        return;
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     lapack_int n_ = to_lapack_int( n );
@@ -33,16 +139,9 @@ int64_t stegr(
     lapack_int iu_ = to_lapack_int( iu );
     lapack_int nfound_ = 0;  // out
     lapack_int ldz_ = to_lapack_int( ldz );
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > isuppz_( (2*max( 1, n )) );  // was nfound; n >= nfound
-        lapack_int* isuppz_ptr = &isuppz_[0];
-    #else
-        lapack_int* isuppz_ptr = isuppz;
-    #endif
+    lapack_int* isuppz_ptr = reinterpret_cast< lapack_int* >( isuppz );  // not referenced
     lapack_int info_ = 0;
 
-    // query for workspace size
     float qry_work[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
@@ -59,69 +158,140 @@ int64_t stegr(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    *lwork = real(qry_work[0]);
+    *liwork = real(qry_iwork[0]);
+    internal::work_size_cache_insert( key, *lwork, *liwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+// -----------------------------------------------------------------------------
+void stegr_work_size(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz,
+    int64_t* lwork, int64_t* liwork )
+{
+    auto key = internal::work_size_key(
+        "dstegr", jobz, range, n, il, iu, ldz );
+    if (internal::work_size_cache_find( key, lwork, liwork ))
+        return;
 
-    LAPACK_sstegr(
+    char jobz_ = to_char( jobz );
+    char range_ = to_char( range );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int il_ = to_lapack_int( il );
+    lapack_int iu_ = to_lapack_int( iu );
+    lapack_int nfound_ = to_lapack_int( *nfound );
+    lapack_int ldz_ = to_lapack_int( ldz );
+    lapack_int* isuppz_ptr = reinterpret_cast< lapack_int* >( isuppz );  // not referenced
+    lapack_int info_ = 0;
+
+    double qry_work[1];
+    lapack_int qry_iwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dstegr(
         &jobz_, &range_, &n_,
         D,
         E, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
         W,
         Z, &ldz_,
         isuppz_ptr,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_, &info_
+        qry_work, &ineg_one,
+        qry_iwork, &ineg_one, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    *nfound = nfound_;
-    #ifndef LAPACK_ILP64
-        std::copy( &isuppz_[0], &isuppz_[ nfound_ ], isuppz );  // was begin to end
-    #endif
-    return info_;
+    *lwork = real(qry_work[0]);
+    *liwork = real(qry_iwork[0]);
+    internal::work_size_cache_insert( key, *lwork, *liwork );
 }
 
 // -----------------------------------------------------------------------------
-int64_t stegr(
+void stegr_work_size(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* isuppz,
+    int64_t* lwork, int64_t* liwork )
+{
+    auto key = internal::work_size_key(
+        "cstegr", jobz, range, n, il, iu, ldz );
+    if (internal::work_size_cache_find( key, lwork, liwork ))
+        return;
+
+    char jobz_ = to_char( jobz );
+    char range_ = to_char( range );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int il_ = to_lapack_int( il );
+    lapack_int iu_ = to_lapack_int( iu );
+    lapack_int nfound_ = 0;  // out
+    lapack_int ldz_ = to_lapack_int( ldz );
+    lapack_int* isuppz_ptr = reinterpret_cast< lapack_int* >( isuppz );  // not referenced
+    lapack_int info_ = 0;
+
+    float qry_work[1];
+    lapack_int qry_iwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_cstegr(
+        &jobz_, &range_, &n_,
+        D,
+        E, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
+        W,
+        (lapack_complex_float*) Z, &ldz_,
+        isuppz_ptr,
+        qry_work, &ineg_one,
+        qry_iwork, &ineg_one, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    *liwork = real(qry_iwork[0]);
+    internal::work_size_cache_insert( key, *lwork, *liwork );
+}
+
+// -----------------------------------------------------------------------------
+void stegr_work_size(
     lapack::Job jobz, lapack::Range range, int64_t n,
     double* D,
     double* E, double vl, double vu, int64_t il, int64_t iu, double abstol,
     int64_t* nfound,
     double* W,
-    double* Z, int64_t ldz,
-    int64_t* isuppz )
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* isuppz,
+    int64_t* lwork, int64_t* liwork )
 {
+    auto key = internal::work_size_key(
+        "zstegr", jobz, range, n, il, iu, ldz );
+    if (internal::work_size_cache_find( key, lwork, liwork ))
+        return;
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     lapack_int n_ = to_lapack_int( n );
     lapack_int il_ = to_lapack_int( il );
     lapack_int iu_ = to_lapack_int( iu );
-    lapack_int nfound_ = to_lapack_int( *nfound );
+    lapack_int nfound_ = 0;  // out
     lapack_int ldz_ = to_lapack_int( ldz );
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > isuppz_( (2*max( 1, n )) );  // was nfound; n >= nfound
-        lapack_int* isuppz_ptr = &isuppz_[0];
-    #else
-        lapack_int* isuppz_ptr = isuppz;
-    #endif
+    lapack_int* isuppz_ptr = reinterpret_cast< lapack_int* >( isuppz );  // not referenced
     lapack_int info_ = 0;
 
-    // query for workspace size
     double qry_work[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
-    LAPACK_dstegr(
+    LAPACK_zstegr(
         &jobz_, &range_, &n_,
         D,
         E, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
         W,
-        Z, &ldz_,
+        (lapack_complex_double*) Z, &ldz_,
         isuppz_ptr,
         qry_work, &ineg_one,
         qry_iwork, &ineg_one, &info_
@@ -129,22 +299,53 @@ int64_t stegr(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    *lwork = real(qry_work[0]);
+    *liwork = real(qry_iwork[0]);
+    internal::work_size_cache_insert( key, *lwork, *liwork );
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+// -----------------------------------------------------------------------------
+int64_t stegr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* isuppz,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    char jobz_ = to_char( jobz );
+    char range_ = to_char( range );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int il_ = to_lapack_int( il );
+    lapack_int iu_ = to_lapack_int( iu );
+    lapack_int nfound_ = 0;  // out
+    lapack_int ldz_ = to_lapack_int( ldz );
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > isuppz_( (2*max( 1, n )) );  // was nfound; n >= nfound
+        lapack_int* isuppz_ptr = &isuppz_[0];
+    #else
+        lapack_int* isuppz_ptr = isuppz;
+    #endif
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "stegr", float, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int liwork_ = to_lapack_int( liwork );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
 
-    LAPACK_dstegr(
+    LAPACK_sstegr(
         &jobz_, &range_, &n_,
         D,
         E, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
         W,
         Z, &ldz_,
         isuppz_ptr,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_, &info_
+        work, &lwork_,
+        iwork_, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -159,19 +360,21 @@ int64_t stegr(
 // -----------------------------------------------------------------------------
 int64_t stegr(
     lapack::Job jobz, lapack::Range range, int64_t n,
-    float* D,
-    float* E, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu, double abstol,
     int64_t* nfound,
-    float* W,
-    std::complex<float>* Z, int64_t ldz,
-    int64_t* isuppz )
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* isuppz,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
 {
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     lapack_int n_ = to_lapack_int( n );
     lapack_int il_ = to_lapack_int( il );
     lapack_int iu_ = to_lapack_int( iu );
-    lapack_int nfound_ = 0;  // out
+    lapack_int nfound_ = to_lapack_int( *nfound );
     lapack_int ldz_ = to_lapack_int( ldz );
     #ifndef LAPACK_ILP64
         // 32-bit copy
@@ -181,30 +384,64 @@ int64_t stegr(
         lapack_int* isuppz_ptr = isuppz;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "stegr", double, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int liwork_ = to_lapack_int( liwork );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cstegr(
+    LAPACK_dstegr(
         &jobz_, &range_, &n_,
         D,
         E, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
         W,
-        (lapack_complex_float*) Z, &ldz_,
+        Z, &ldz_,
         isuppz_ptr,
-        qry_work, &ineg_one,
-        qry_iwork, &ineg_one, &info_
+        work, &lwork_,
+        iwork_, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    *nfound = nfound_;
+    #ifndef LAPACK_ILP64
+        std::copy( &isuppz_[0], &isuppz_[ nfound_ ], isuppz );  // was begin to end
+    #endif
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+// -----------------------------------------------------------------------------
+int64_t stegr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* isuppz,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    char jobz_ = to_char( jobz );
+    char range_ = to_char( range );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int il_ = to_lapack_int( il );
+    lapack_int iu_ = to_lapack_int( iu );
+    lapack_int nfound_ = 0;  // out
+    lapack_int ldz_ = to_lapack_int( ldz );
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > isuppz_( (2*max( 1, n )) );  // was nfound; n >= nfound
+        lapack_int* isuppz_ptr = &isuppz_[0];
+    #else
+        lapack_int* isuppz_ptr = isuppz;
+    #endif
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "stegr", std::complex<float>, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int liwork_ = to_lapack_int( liwork );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
 
     LAPACK_cstegr(
         &jobz_, &range_, &n_,
@@ -213,8 +450,8 @@ int64_t stegr(
         W,
         (lapack_complex_float*) Z, &ldz_,
         isuppz_ptr,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_, &info_
+        work, &lwork_,
+        iwork_, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -234,7 +471,9 @@ int64_t stegr(
     int64_t* nfound,
     double* W,
     std::complex<double>* Z, int64_t ldz,
-    int64_t* isuppz )
+    int64_t* isuppz,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
 {
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
@@ -251,30 +490,11 @@ int64_t stegr(
         lapack_int* isuppz_ptr = isuppz;
     #endif
     lapack_int info_ = 0;
-
-    // query for workspace size
-    double qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zstegr(
-        &jobz_, &range_, &n_,
-        D,
-        E, &vl, &vu, &il_, &iu_, &abstol, &nfound_,
-        W,
-        (lapack_complex_double*) Z, &ldz_,
-        isuppz_ptr,
-        qry_work, &ineg_one,
-        qry_iwork, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
-
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    LAPACK_TRACE_BLOCK( "stegr", std::complex<double>, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int liwork_ = to_lapack_int( liwork );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
 
     LAPACK_zstegr(
         &jobz_, &range_, &n_,
@@ -283,8 +503,8 @@ int64_t stegr(
         W,
         (lapack_complex_double*) Z, &ldz_,
         isuppz_ptr,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_, &info_
+        work, &lwork_,
+        iwork_, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -52,6 +52,7 @@ int64_t stein(
         lapack_int* ifail_ptr = ifail;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "stein", float, m, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (5*n) );
@@ -113,6 +114,7 @@ int64_t stein(
         lapack_int* ifail_ptr = ifail;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "stein", double, m, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (5*n) );
@@ -174,6 +176,7 @@ int64_t stein(
         lapack_int* ifail_ptr = ifail;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "stein", std::complex<float>, m, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (5*n) );
@@ -235,6 +238,7 @@ int64_t stein(
         lapack_int* ifail_ptr = ifail;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "stein", std::complex<double>, m, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (5*n) );
@@ -27,6 +27,124 @@ int64_t stemr(
     int64_t* isuppz,
     bool* tryrac )
 {
+    // query for workspace size
+    int64_t lwork, liwork;
+    stemr_work_size(
+        jobz, range, n, D, E, vl, vu, il, iu, nfound, W, Z, ldz, nzc, isuppz,
+        tryrac,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+    lapack::vector< int64_t > iwork( liwork );
+
+    return stemr(
+        jobz, range, n, D, E, vl, vu, il, iu, nfound, W, Z, ldz, nzc, isuppz,
+        tryrac,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t stemr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac )
+{
+    // query for workspace size
+    int64_t lwork, liwork;
+    stemr_work_size(
+        jobz, range, n, D, E, vl, vu, il, iu, nfound, W, Z, ldz, nzc, isuppz,
+        tryrac,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+    lapack::vector< int64_t > iwork( liwork );
+
+    return stemr(
+        jobz, range, n, D, E, vl, vu, il, iu, nfound, W, Z, ldz, nzc, isuppz,
+        tryrac,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t stemr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac )
+{
+    // query for workspace size
+    int64_t lwork, liwork;
+    stemr_work_size(
+        jobz, range, n, D, E, vl, vu, il, iu, nfound, W, Z, ldz, nzc, isuppz,
+        tryrac,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+    lapack::vector< int64_t > iwork( liwork );
+
+    return stemr(
+        jobz, range, n, D, E, vl, vu, il, iu, nfound, W, Z, ldz, nzc, isuppz,
+        tryrac,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t stemr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu,
+    int64_t* nfound,
+    double* W,
+    std::complex<double>* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac )
+{
+    // query for workspace size
+    int64_t lwork, liwork;
+    stemr_work_size(
+        jobz, range, n, D, E, vl, vu, il, iu, nfound, W, Z, ldz, nzc, isuppz,
+        tryrac,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+    lapack::vector< int64_t > iwork( liwork );
+
+    return stemr(
+        jobz, range, n, D, E, vl, vu, il, iu, nfound, W, Z, ldz, nzc, isuppz,
+        tryrac,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+void stemr_work_size(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac,
+    int64_t* lwork, int64_t* liwork )
+{
+    auto key = internal::work_size_key(
+        "sstemr", jobz, range, n, il, iu, ldz, nzc );
+    if (internal::work_size_cache_find( key, lwork, liwork ))
+        return;
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     lapack_int n_ = to_lapack_int( n );
@@ -35,17 +153,10 @@ int64_t stemr(
     lapack_int nfound_ = 0;  // out
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int nzc_ = to_lapack_int( nzc );
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > isuppz_( (2*max( 1, n )) );  // was nfound; n >= nfound
-        lapack_int* isuppz_ptr = &isuppz_[0];
-    #else
-        lapack_int* isuppz_ptr = isuppz;
-    #endif
+    lapack_int* isuppz_ptr = reinterpret_cast< lapack_int* >( isuppz );  // not referenced
     lapack_int tryrac_ = to_lapack_int( *tryrac );
     lapack_int info_ = 0;
 
-    // query for workspace size
     float qry_work[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
@@ -62,45 +173,128 @@ int64_t stemr(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    *lwork = real(qry_work[0]);
+    *liwork = real(qry_iwork[0]);
+    internal::work_size_cache_insert( key, *lwork, *liwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+// -----------------------------------------------------------------------------
+void stemr_work_size(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu,
+    int64_t* nfound,
+    double* W,
+    double* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac,
+    int64_t* lwork, int64_t* liwork )
+{
+    auto key = internal::work_size_key(
+        "dstemr", jobz, range, n, il, iu, ldz, nzc );
+    if (internal::work_size_cache_find( key, lwork, liwork ))
+        return;
 
-    LAPACK_sstemr(
+    char jobz_ = to_char( jobz );
+    char range_ = to_char( range );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int il_ = to_lapack_int( il );
+    lapack_int iu_ = to_lapack_int( iu );
+    lapack_int nfound_ = 0;  // out
+    lapack_int ldz_ = to_lapack_int( ldz );
+    lapack_int nzc_ = to_lapack_int( nzc );
+    lapack_int* isuppz_ptr = reinterpret_cast< lapack_int* >( isuppz );  // not referenced
+    lapack_int tryrac_ = to_lapack_int( *tryrac );
+    lapack_int info_ = 0;
+
+    double qry_work[1];
+    lapack_int qry_iwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dstemr(
         &jobz_, &range_, &n_,
         D,
         E, &vl, &vu, &il_, &iu_, &nfound_,
         W,
         Z, &ldz_, &nzc_,
         isuppz_ptr, &tryrac_,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_, &info_
+        qry_work, &ineg_one,
+        qry_iwork, &ineg_one, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    *nfound = nfound_;
-    #ifndef LAPACK_ILP64
-        std::copy( &isuppz_[0], &isuppz_[ nfound_ ], isuppz );
-    #endif
-    *tryrac = tryrac_;
-    return info_;
+    *lwork = real(qry_work[0]);
+    *liwork = real(qry_iwork[0]);
+    internal::work_size_cache_insert( key, *lwork, *liwork );
 }
 
 // -----------------------------------------------------------------------------
-int64_t stemr(
+void stemr_work_size(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac,
+    int64_t* lwork, int64_t* liwork )
+{
+    auto key = internal::work_size_key(
+        "cstemr", jobz, range, n, il, iu, ldz, nzc );
+    if (internal::work_size_cache_find( key, lwork, liwork ))
+        return;
+
+    char jobz_ = to_char( jobz );
+    char range_ = to_char( range );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int il_ = to_lapack_int( il );
+    lapack_int iu_ = to_lapack_int( iu );
+    lapack_int nfound_ = 0;  // out
+    lapack_int ldz_ = to_lapack_int( ldz );
+    lapack_int nzc_ = to_lapack_int( nzc );
+    lapack_int* isuppz_ptr = reinterpret_cast< lapack_int* >( isuppz );  // not referenced
+    lapack_int tryrac_ = to_lapack_int( *tryrac );
+    lapack_int info_ = 0;
+
+    float qry_work[1];
+    lapack_int qry_iwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_cstemr(
+        &jobz_, &range_, &n_,
+        D,
+        E, &vl, &vu, &il_, &iu_, &nfound_,
+        W,
+        (lapack_complex_float*) Z, &ldz_, &nzc_,
+        isuppz_ptr, &tryrac_,
+        qry_work, &ineg_one,
+        qry_iwork, &ineg_one, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    *liwork = real(qry_iwork[0]);
+    internal::work_size_cache_insert( key, *lwork, *liwork );
+}
+
+// -----------------------------------------------------------------------------
+void stemr_work_size(
     lapack::Job jobz, lapack::Range range, int64_t n,
     double* D,
     double* E, double vl, double vu, int64_t il, int64_t iu,
     int64_t* nfound,
     double* W,
-    double* Z, int64_t ldz, int64_t nzc,
+    std::complex<double>* Z, int64_t ldz, int64_t nzc,
     int64_t* isuppz,
-    bool* tryrac )
+    bool* tryrac,
+    int64_t* lwork, int64_t* liwork )
 {
+    auto key = internal::work_size_key(
+        "zstemr", jobz, range, n, il, iu, ldz, nzc );
+    if (internal::work_size_cache_find( key, lwork, liwork ))
+        return;
+
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     lapack_int n_ = to_lapack_int( n );
@@ -109,26 +303,19 @@ int64_t stemr(
     lapack_int nfound_ = 0;  // out
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int nzc_ = to_lapack_int( nzc );
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > isuppz_( (2*max( 1, n )) );  // was nfound; n >= nfound
-        lapack_int* isuppz_ptr = &isuppz_[0];
-    #else
-        lapack_int* isuppz_ptr = isuppz;
-    #endif
+    lapack_int* isuppz_ptr = reinterpret_cast< lapack_int* >( isuppz );  // not referenced
     lapack_int tryrac_ = to_lapack_int( *tryrac );
     lapack_int info_ = 0;
 
-    // query for workspace size
     double qry_work[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
-    LAPACK_dstemr(
+    LAPACK_zstemr(
         &jobz_, &range_, &n_,
         D,
         E, &vl, &vu, &il_, &iu_, &nfound_,
         W,
-        Z, &ldz_, &nzc_,
+        (lapack_complex_double*) Z, &ldz_, &nzc_,
         isuppz_ptr, &tryrac_,
         qry_work, &ineg_one,
         qry_iwork, &ineg_one, &info_
@@ -136,22 +323,56 @@ int64_t stemr(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    *lwork = real(qry_work[0]);
+    *liwork = real(qry_iwork[0]);
+    internal::work_size_cache_insert( key, *lwork, *liwork );
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+// -----------------------------------------------------------------------------
+int64_t stemr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu,
+    int64_t* nfound,
+    float* W,
+    float* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    char jobz_ = to_char( jobz );
+    char range_ = to_char( range );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int il_ = to_lapack_int( il );
+    lapack_int iu_ = to_lapack_int( iu );
+    lapack_int nfound_ = 0;  // out
+    lapack_int ldz_ = to_lapack_int( ldz );
+    lapack_int nzc_ = to_lapack_int( nzc );
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > isuppz_( (2*max( 1, n )) );  // was nfound; n >= nfound
+        lapack_int* isuppz_ptr = &isuppz_[0];
+    #else
+        lapack_int* isuppz_ptr = isuppz;
+    #endif
+    lapack_int tryrac_ = to_lapack_int( *tryrac );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "stemr", float, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int liwork_ = to_lapack_int( liwork );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
 
-    LAPACK_dstemr(
+    LAPACK_sstemr(
         &jobz_, &range_, &n_,
         D,
         E, &vl, &vu, &il_, &iu_, &nfound_,
         W,
         Z, &ldz_, &nzc_,
         isuppz_ptr, &tryrac_,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_, &info_
+        work, &lwork_,
+        iwork_, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -167,13 +388,15 @@ int64_t stemr(
 // -----------------------------------------------------------------------------
 int64_t stemr(
     lapack::Job jobz, lapack::Range range, int64_t n,
-    float* D,
-    float* E, float vl, float vu, int64_t il, int64_t iu,
+    double* D,
+    double* E, double vl, double vu, int64_t il, int64_t iu,
     int64_t* nfound,
-    float* W,
-    std::complex<float>* Z, int64_t ldz, int64_t nzc,
+    double* W,
+    double* Z, int64_t ldz, int64_t nzc,
     int64_t* isuppz,
-    bool* tryrac )
+    bool* tryrac,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
 {
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
@@ -192,30 +415,68 @@ int64_t stemr(
     #endif
     lapack_int tryrac_ = to_lapack_int( *tryrac );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "stemr", double, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int liwork_ = to_lapack_int( liwork );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
 
-    // query for workspace size
-    float qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cstemr(
+    LAPACK_dstemr(
         &jobz_, &range_, &n_,
         D,
         E, &vl, &vu, &il_, &iu_, &nfound_,
         W,
-        (lapack_complex_float*) Z, &ldz_, &nzc_,
+        Z, &ldz_, &nzc_,
         isuppz_ptr, &tryrac_,
-        qry_work, &ineg_one,
-        qry_iwork, &ineg_one, &info_
+        work, &lwork_,
+        iwork_, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    *nfound = nfound_;
+    #ifndef LAPACK_ILP64
+        std::copy( &isuppz_[0], &isuppz_[ nfound_ ], isuppz );
+    #endif
+    *tryrac = tryrac_;
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+// -----------------------------------------------------------------------------
+int64_t stemr(
+    lapack::Job jobz, lapack::Range range, int64_t n,
+    float* D,
+    float* E, float vl, float vu, int64_t il, int64_t iu,
+    int64_t* nfound,
+    float* W,
+    std::complex<float>* Z, int64_t ldz, int64_t nzc,
+    int64_t* isuppz,
+    bool* tryrac,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    char jobz_ = to_char( jobz );
+    char range_ = to_char( range );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int il_ = to_lapack_int( il );
+    lapack_int iu_ = to_lapack_int( iu );
+    lapack_int nfound_ = 0;  // out
+    lapack_int ldz_ = to_lapack_int( ldz );
+    lapack_int nzc_ = to_lapack_int( nzc );
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > isuppz_( (2*max( 1, n )) );  // was nfound; n >= nfound
+        lapack_int* isuppz_ptr = &isuppz_[0];
+    #else
+        lapack_int* isuppz_ptr = isuppz;
+    #endif
+    lapack_int tryrac_ = to_lapack_int( *tryrac );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "stemr", std::complex<float>, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int liwork_ = to_lapack_int( liwork );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
 
     LAPACK_cstemr(
         &jobz_, &range_, &n_,
@@ -224,8 +485,8 @@ int64_t stemr(
         W,
         (lapack_complex_float*) Z, &ldz_, &nzc_,
         isuppz_ptr, &tryrac_,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_, &info_
+        work, &lwork_,
+        iwork_, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -247,7 +508,9 @@ int64_t stemr(
     double* W,
     std::complex<double>* Z, int64_t ldz, int64_t nzc,
     int64_t* isuppz,
-    bool* tryrac )
+    bool* tryrac,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
 {
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
@@ -266,30 +529,11 @@ int64_t stemr(
     #endif
     lapack_int tryrac_ = to_lapack_int( *tryrac );
     lapack_int info_ = 0;
-
-    // query for workspace size
-    double qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zstemr(
-        &jobz_, &range_, &n_,
-        D,
-        E, &vl, &vu, &il_, &iu_, &nfound_,
-        W,
-        (lapack_complex_double*) Z, &ldz_, &nzc_,
-        isuppz_ptr, &tryrac_,
-        qry_work, &ineg_one,
-        qry_iwork, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
-
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    LAPACK_TRACE_BLOCK( "stemr", std::complex<double>, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int liwork_ = to_lapack_int( liwork );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
 
     LAPACK_zstemr(
         &jobz_, &range_, &n_,
@@ -298,8 +542,8 @@ int64_t stemr(
         W,
         (lapack_complex_double*) Z, &ldz_, &nzc_,
         isuppz_ptr, &tryrac_,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_, &info_
+        work, &lwork_,
+        iwork_, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
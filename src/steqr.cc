@@ -27,6 +27,7 @@ int64_t steqr(
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "steqr", float, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (max( 1, 2*n-2 )) );
@@ -55,6 +56,7 @@ int64_t steqr(
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "steqr", double, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (max( 1, 2*n-2 )) );
@@ -83,6 +85,7 @@ int64_t steqr(
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "steqr", std::complex<float>, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (max( 1, 2*n-2 )) );
@@ -111,6 +114,7 @@ int64_t steqr(
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "steqr", std::complex<double>, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (max( 1, 2*n-2 )) );
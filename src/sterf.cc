@@ -23,6 +23,7 @@ int64_t sterf(
 {
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sterf", float, 0, n, 0, 0, info_ );
 
     LAPACK_ssterf(
         &n_,
@@ -42,6 +43,7 @@ int64_t sterf(
 {
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sterf", double, 0, n, 0, 0, info_ );
 
     LAPACK_dsterf(
         &n_,
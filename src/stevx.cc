@@ -41,6 +41,7 @@ int64_t stevx(
         lapack_int* ifail_ptr = ifail;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "stevx", float, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (5*n) );
@@ -93,6 +94,7 @@ int64_t stevx(
         lapack_int* ifail_ptr = ifail;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "stevx", double, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (5*n) );
@@ -27,6 +27,7 @@ int64_t sygst(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sygst", float, 0, n, 0, 0, info_ );
 
     LAPACK_ssygst(
         &itype_, &uplo_, &n_,
@@ -51,6 +52,7 @@ int64_t sygst(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sygst", double, 0, n, 0, 0, info_ );
 
     LAPACK_dsygst(
         &itype_, &uplo_, &n_,
@@ -23,6 +23,54 @@ int64_t sygv(
     float* B, int64_t ldb,
     float* W )
 {
+    // query for workspace size
+    int64_t lwork;
+    sygv_work_size(
+        itype, jobz, uplo, n, A, lda, B, ldb, W,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return sygv(
+        itype, jobz, uplo, n, A, lda, B, ldb, W,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t sygv(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W )
+{
+    // query for workspace size
+    int64_t lwork;
+    sygv_work_size(
+        itype, jobz, uplo, n, A, lda, B, ldb, W,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return sygv(
+        itype, jobz, uplo, n, A, lda, B, ldb, W,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+void sygv_work_size(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "ssygv", itype, jobz, uplo, n, lda, ldb );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int itype_ = to_lapack_int( itype );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
@@ -31,7 +79,6 @@ int64_t sygv(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
 
-    // query for workspace size
     float qry_work[1];
     lapack_int ineg_one = -1;
     LAPACK_ssygv(
@@ -44,30 +91,54 @@ int64_t sygv(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+void sygv_work_size(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "dsygv", itype, jobz, uplo, n, lda, ldb );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
 
-    LAPACK_ssygv(
+    lapack_int itype_ = to_lapack_int( itype );
+    char jobz_ = to_char( jobz );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int info_ = 0;
+
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dsygv(
         &itype_, &jobz_, &uplo_, &n_,
         A, &lda_,
         B, &ldb_,
         W,
-        &work[0], &lwork_, &info_
+        qry_work, &ineg_one, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    return info_;
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
 }
 
 // -----------------------------------------------------------------------------
 int64_t sygv(
     int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda,
-    double* B, int64_t ldb,
-    double* W )
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W,
+    float* work, int64_t lwork )
 {
     lapack_int itype_ = to_lapack_int( itype );
     char jobz_ = to_char( jobz );
@@ -76,31 +147,46 @@ int64_t sygv(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sygv", float, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dsygv(
+    LAPACK_ssygv(
         &itype_, &jobz_, &uplo_, &n_,
         A, &lda_,
         B, &ldb_,
         W,
-        qry_work, &ineg_one, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+int64_t sygv(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W,
+    double* work, int64_t lwork )
+{
+    lapack_int itype_ = to_lapack_int( itype );
+    char jobz_ = to_char( jobz );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sygv", double, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
     LAPACK_dsygv(
         &itype_, &jobz_, &uplo_, &n_,
         A, &lda_,
         B, &ldb_,
         W,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -25,6 +25,54 @@ int64_t sygv_2stage(
     float* B, int64_t ldb,
     float* W )
 {
+    // query for workspace size
+    int64_t lwork;
+    sygv_2stage_work_size(
+        itype, jobz, uplo, n, A, lda, B, ldb, W,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return sygv_2stage(
+        itype, jobz, uplo, n, A, lda, B, ldb, W,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t sygv_2stage(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W )
+{
+    // query for workspace size
+    int64_t lwork;
+    sygv_2stage_work_size(
+        itype, jobz, uplo, n, A, lda, B, ldb, W,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return sygv_2stage(
+        itype, jobz, uplo, n, A, lda, B, ldb, W,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+void sygv_2stage_work_size(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "ssygv_2stage", itype, jobz, uplo, n, lda, ldb );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int itype_ = to_lapack_int( itype );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
@@ -33,7 +81,6 @@ int64_t sygv_2stage(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
 
-    // query for workspace size
     float qry_work[1];
     lapack_int ineg_one = -1;
     LAPACK_ssygv_2stage(
@@ -46,30 +93,54 @@ int64_t sygv_2stage(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+void sygv_2stage_work_size(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "dsygv_2stage", itype, jobz, uplo, n, lda, ldb );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
 
-    LAPACK_ssygv_2stage(
+    lapack_int itype_ = to_lapack_int( itype );
+    char jobz_ = to_char( jobz );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int info_ = 0;
+
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dsygv_2stage(
         &itype_, &jobz_, &uplo_, &n_,
         A, &lda_,
         B, &ldb_,
         W,
-        &work[0], &lwork_, &info_
+        qry_work, &ineg_one, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    return info_;
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
 }
 
 // -----------------------------------------------------------------------------
 int64_t sygv_2stage(
     int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda,
-    double* B, int64_t ldb,
-    double* W )
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* W,
+    float* work, int64_t lwork )
 {
     lapack_int itype_ = to_lapack_int( itype );
     char jobz_ = to_char( jobz );
@@ -78,31 +149,46 @@ int64_t sygv_2stage(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sygv_2stage", float, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dsygv_2stage(
+    LAPACK_ssygv_2stage(
         &itype_, &jobz_, &uplo_, &n_,
         A, &lda_,
         B, &ldb_,
         W,
-        qry_work, &ineg_one, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+int64_t sygv_2stage(
+    int64_t itype, lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* W,
+    double* work, int64_t lwork )
+{
+    lapack_int itype_ = to_lapack_int( itype );
+    char jobz_ = to_char( jobz );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sygv_2stage", double, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
     LAPACK_dsygv_2stage(
         &itype_, &jobz_, &uplo_, &n_,
         A, &lda_,
         B, &ldb_,
         W,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -52,6 +52,7 @@ int64_t syrfsx(
     lapack_int n_err_bnds_ = to_lapack_int( n_err_bnds );
     lapack_int nparams_ = to_lapack_int( nparams );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "syrfsx", float, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (4*n) );
@@ -112,6 +113,7 @@ int64_t syrfsx(
     lapack_int n_err_bnds_ = to_lapack_int( n_err_bnds );
     lapack_int nparams_ = to_lapack_int( nparams );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "syrfsx", double, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (4*n) );
@@ -172,6 +174,7 @@ int64_t syrfsx(
     lapack_int n_err_bnds_ = to_lapack_int( n_err_bnds );
     lapack_int nparams_ = to_lapack_int( nparams );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "syrfsx", std::complex<float>, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
@@ -504,6 +507,7 @@ int64_t syrfsx(
     lapack_int n_err_bnds_ = to_lapack_int( n_err_bnds );
     lapack_int nparams_ = to_lapack_int( nparams );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "syrfsx", std::complex<double>, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
@@ -29,67 +29,21 @@ int64_t sysvx(
     float* ferr,
     float* berr )
 {
-    char fact_ = to_char( fact );
-    char uplo_ = to_char( uplo );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int nrhs_ = to_lapack_int( nrhs );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int ldaf_ = to_lapack_int( ldaf );
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
-        lapack_int* ipiv_ptr = &ipiv_[0];
-    #else
-        lapack_int* ipiv_ptr = ipiv;
-    #endif
-    lapack_int ldb_ = to_lapack_int( ldb );
-    lapack_int ldx_ = to_lapack_int( ldx );
-    lapack_int info_ = 0;
-
     // query for workspace size
-    float qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_ssysvx(
-        &fact_, &uplo_, &n_, &nrhs_,
-        A, &lda_,
-        AF, &ldaf_,
-        ipiv_ptr,
-        B, &ldb_,
-        X, &ldx_, rcond,
-        ferr,
-        berr,
-        qry_work, &ineg_one,
-        qry_iwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork, liwork;
+    sysvx_work_size(
+        fact, uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx, rcond,
+        ferr, berr,
+        &lwork, &liwork );
 
     // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (n) );
+    lapack::vector< float > work( lwork );
+    lapack::vector< int64_t > iwork( liwork );
 
-    LAPACK_ssysvx(
-        &fact_, &uplo_, &n_, &nrhs_,
-        A, &lda_,
-        AF, &ldaf_,
-        ipiv_ptr,
-        B, &ldb_,
-        X, &ldx_, rcond,
-        ferr,
-        berr,
-        &work[0], &lwork_,
-        &iwork[0], &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
-    #endif
-    return info_;
+    return sysvx(
+        fact, uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx, rcond,
+        ferr, berr,
+        &work[0], lwork, &iwork[0], liwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -105,67 +59,21 @@ int64_t sysvx(
     double* ferr,
     double* berr )
 {
-    char fact_ = to_char( fact );
-    char uplo_ = to_char( uplo );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int nrhs_ = to_lapack_int( nrhs );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int ldaf_ = to_lapack_int( ldaf );
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
-        lapack_int* ipiv_ptr = &ipiv_[0];
-    #else
-        lapack_int* ipiv_ptr = ipiv;
-    #endif
-    lapack_int ldb_ = to_lapack_int( ldb );
-    lapack_int ldx_ = to_lapack_int( ldx );
-    lapack_int info_ = 0;
-
     // query for workspace size
-    double qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dsysvx(
-        &fact_, &uplo_, &n_, &nrhs_,
-        A, &lda_,
-        AF, &ldaf_,
-        ipiv_ptr,
-        B, &ldb_,
-        X, &ldx_, rcond,
-        ferr,
-        berr,
-        qry_work, &ineg_one,
-        qry_iwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork, liwork;
+    sysvx_work_size(
+        fact, uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx, rcond,
+        ferr, berr,
+        &lwork, &liwork );
 
     // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (n) );
+    lapack::vector< double > work( lwork );
+    lapack::vector< int64_t > iwork( liwork );
 
-    LAPACK_dsysvx(
-        &fact_, &uplo_, &n_, &nrhs_,
-        A, &lda_,
-        AF, &ldaf_,
-        ipiv_ptr,
-        B, &ldb_,
-        X, &ldx_, rcond,
-        ferr,
-        berr,
-        &work[0], &lwork_,
-        &iwork[0], &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
-    #endif
-    return info_;
+    return sysvx(
+        fact, uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx, rcond,
+        ferr, berr,
+        &work[0], lwork, &iwork[0], liwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -181,67 +89,21 @@ int64_t sysvx(
     float* ferr,
     float* berr )
 {
-    char fact_ = to_char( fact );
-    char uplo_ = to_char( uplo );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int nrhs_ = to_lapack_int( nrhs );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int ldaf_ = to_lapack_int( ldaf );
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
-        lapack_int* ipiv_ptr = &ipiv_[0];
-    #else
-        lapack_int* ipiv_ptr = ipiv;
-    #endif
-    lapack_int ldb_ = to_lapack_int( ldb );
-    lapack_int ldx_ = to_lapack_int( ldx );
-    lapack_int info_ = 0;
-
     // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_csysvx(
-        &fact_, &uplo_, &n_, &nrhs_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) AF, &ldaf_,
-        ipiv_ptr,
-        (lapack_complex_float*) B, &ldb_,
-        (lapack_complex_float*) X, &ldx_, rcond,
-        ferr,
-        berr,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork, lrwork;
+    sysvx_work_size(
+        fact, uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx, rcond,
+        ferr, berr,
+        &lwork, &lrwork );
 
     // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (n) );
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
 
-    LAPACK_csysvx(
-        &fact_, &uplo_, &n_, &nrhs_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) AF, &ldaf_,
-        ipiv_ptr,
-        (lapack_complex_float*) B, &ldb_,
-        (lapack_complex_float*) X, &ldx_, rcond,
-        ferr,
-        berr,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0], &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
-    #endif
-    return info_;
+    return sysvx(
+        fact, uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx, rcond,
+        ferr, berr,
+        &work[0], lwork, &rwork[0], lrwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -392,24 +254,230 @@ int64_t sysvx(
     double* ferr,
     double* berr )
 {
+    // query for workspace size
+    int64_t lwork, lrwork;
+    sysvx_work_size(
+        fact, uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx, rcond,
+        ferr, berr,
+        &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+
+    return sysvx(
+        fact, uplo, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx, rcond,
+        ferr, berr,
+        &work[0], lwork, &rwork[0], lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+void sysvx_work_size(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float* AF, int64_t ldaf,
+    int64_t* ipiv,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr,
+    int64_t* lwork, int64_t* liwork )
+{
+    auto key = internal::work_size_key(
+        "ssysvx", fact, uplo, n, nrhs, lda, ldaf, ldb, ldx );
+    if (internal::work_size_cache_find( key, lwork, liwork ))
+        return;
+
     char fact_ = to_char( fact );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldaf_ = to_lapack_int( ldaf );
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
-        lapack_int* ipiv_ptr = &ipiv_[0];
-    #else
-        lapack_int* ipiv_ptr = ipiv;
-    #endif
+    lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );  // not referenced
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int ldx_ = to_lapack_int( ldx );
+    lapack_int info_ = 0;
+
+    float qry_work[1];
+    lapack_int qry_iwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_ssysvx(
+        &fact_, &uplo_, &n_, &nrhs_,
+        A, &lda_,
+        AF, &ldaf_,
+        ipiv_ptr,
+        B, &ldb_,
+        X, &ldx_, rcond,
+        ferr,
+        berr,
+        qry_work, &ineg_one,
+        qry_iwork, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    *liwork = n;
+    internal::work_size_cache_insert( key, *lwork, *liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+void sysvx_work_size(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double* AF, int64_t ldaf,
+    int64_t* ipiv,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr,
+    int64_t* lwork, int64_t* liwork )
+{
+    auto key = internal::work_size_key(
+        "dsysvx", fact, uplo, n, nrhs, lda, ldaf, ldb, ldx );
+    if (internal::work_size_cache_find( key, lwork, liwork ))
+        return;
+
+    char fact_ = to_char( fact );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldaf_ = to_lapack_int( ldaf );
+    lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );  // not referenced
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int ldx_ = to_lapack_int( ldx );
+    lapack_int info_ = 0;
+
+    double qry_work[1];
+    lapack_int qry_iwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dsysvx(
+        &fact_, &uplo_, &n_, &nrhs_,
+        A, &lda_,
+        AF, &ldaf_,
+        ipiv_ptr,
+        B, &ldb_,
+        X, &ldx_, rcond,
+        ferr,
+        berr,
+        qry_work, &ineg_one,
+        qry_iwork, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    *liwork = n;
+    internal::work_size_cache_insert( key, *lwork, *liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+void sysvx_work_size(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float>* AF, int64_t ldaf,
+    int64_t* ipiv,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr,
+    int64_t* lwork, int64_t* lrwork )
+{
+    auto key = internal::work_size_key(
+        "csysvx", fact, uplo, n, nrhs, lda, ldaf, ldb, ldx );
+    if (internal::work_size_cache_find( key, lwork, lrwork ))
+        return;
+
+    char fact_ = to_char( fact );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldaf_ = to_lapack_int( ldaf );
+    lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );  // not referenced
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int ldx_ = to_lapack_int( ldx );
+    lapack_int info_ = 0;
+
+    std::complex<float> qry_work[1];
+    float qry_rwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_csysvx(
+        &fact_, &uplo_, &n_, &nrhs_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) AF, &ldaf_,
+        ipiv_ptr,
+        (lapack_complex_float*) B, &ldb_,
+        (lapack_complex_float*) X, &ldx_, rcond,
+        ferr,
+        berr,
+        (lapack_complex_float*) qry_work, &ineg_one,
+        qry_rwork, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    *lrwork = n;
+    internal::work_size_cache_insert( key, *lwork, *lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::sysvx with caller-provided workspace.
+/// Returns the array lengths that the workspace overload of `sysvx`
+/// requires, so the workspace can be allocated once, outside a loop.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+/// For real matrices, `lapack::hesvx` is an alias for this.
+/// For complex Hermitian matrices, see `lapack::hesvx`.
+///
+/// Other arguments are the same as for lapack::sysvx.
+/// Arrays are used only to select the precision and are not referenced.
+///
+/// @param[out] lwork
+///     The optimal length of the array work.
+///
+/// @param[out] lrwork
+///     The length of the array rwork, n.
+///
+/// @ingroup sysv
+void sysvx_work_size(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double>* AF, int64_t ldaf,
+    int64_t* ipiv,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr,
+    int64_t* lwork, int64_t* lrwork )
+{
+    auto key = internal::work_size_key(
+        "zsysvx", fact, uplo, n, nrhs, lda, ldaf, ldb, ldx );
+    if (internal::work_size_cache_find( key, lwork, lrwork ))
+        return;
+
+    char fact_ = to_char( fact );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldaf_ = to_lapack_int( ldaf );
+    lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );  // not referenced
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int ldx_ = to_lapack_int( ldx );
     lapack_int info_ = 0;
 
-    // query for workspace size
     std::complex<double> qry_work[1];
     double qry_rwork[1];
     lapack_int ineg_one = -1;
@@ -428,11 +496,241 @@ int64_t sysvx(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    *lrwork = n;
+    internal::work_size_cache_insert( key, *lwork, *lrwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (n) );
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+int64_t sysvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float* AF, int64_t ldaf,
+    int64_t* ipiv,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    char fact_ = to_char( fact );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldaf_ = to_lapack_int( ldaf );
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack_int* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int* ipiv_ptr = ipiv;
+    #endif
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int ldx_ = to_lapack_int( ldx );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sysvx", float, 0, n, 0, nrhs, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( liwork < n );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
+
+    LAPACK_ssysvx(
+        &fact_, &uplo_, &n_, &nrhs_,
+        A, &lda_,
+        AF, &ldaf_,
+        ipiv_ptr,
+        B, &ldb_,
+        X, &ldx_, rcond,
+        ferr,
+        berr,
+        work, &lwork_,
+        iwork_, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    #ifndef LAPACK_ILP64
+        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+    #endif
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+int64_t sysvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double* AF, int64_t ldaf,
+    int64_t* ipiv,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    char fact_ = to_char( fact );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldaf_ = to_lapack_int( ldaf );
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack_int* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int* ipiv_ptr = ipiv;
+    #endif
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int ldx_ = to_lapack_int( ldx );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sysvx", double, 0, n, 0, nrhs, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( liwork < n );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
+
+    LAPACK_dsysvx(
+        &fact_, &uplo_, &n_, &nrhs_,
+        A, &lda_,
+        AF, &ldaf_,
+        ipiv_ptr,
+        B, &ldb_,
+        X, &ldx_, rcond,
+        ferr,
+        berr,
+        work, &lwork_,
+        iwork_, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    #ifndef LAPACK_ILP64
+        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+    #endif
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+int64_t sysvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float>* AF, int64_t ldaf,
+    int64_t* ipiv,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork )
+{
+    char fact_ = to_char( fact );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldaf_ = to_lapack_int( ldaf );
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack_int* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int* ipiv_ptr = ipiv;
+    #endif
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int ldx_ = to_lapack_int( ldx );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sysvx", std::complex<float>, 0, n, 0, nrhs, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( lrwork < n );
+
+    LAPACK_csysvx(
+        &fact_, &uplo_, &n_, &nrhs_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) AF, &ldaf_,
+        ipiv_ptr,
+        (lapack_complex_float*) B, &ldb_,
+        (lapack_complex_float*) X, &ldx_, rcond,
+        ferr,
+        berr,
+        (lapack_complex_float*) work, &lwork_,
+        rwork, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    #ifndef LAPACK_ILP64
+        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+    #endif
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::sysvx that takes caller-provided workspace
+/// instead of querying and allocating it on each call.
+/// Use lapack::sysvx_work_size to get the required lengths.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+/// For real matrices, `lapack::hesvx` is an alias for this.
+/// For complex Hermitian matrices, see `lapack::hesvx`.
+///
+/// Other arguments are the same as for lapack::sysvx.
+///
+/// @param[out] work
+///     The vector work of length lwork. Workspace.
+///
+/// @param[in] lwork
+///     The length of the array work.
+///     Use the value from lapack::sysvx_work_size for best performance.
+///
+/// @param[out] rwork
+///     The vector rwork of length lrwork. Workspace.
+///
+/// @param[in] lrwork
+///     The length of the array rwork, lrwork >= n.
+///
+/// @ingroup sysv
+int64_t sysvx(
+    lapack::Factored fact, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double>* AF, int64_t ldaf,
+    int64_t* ipiv,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork )
+{
+    char fact_ = to_char( fact );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldaf_ = to_lapack_int( ldaf );
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack_int* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int* ipiv_ptr = ipiv;
+    #endif
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int ldx_ = to_lapack_int( ldx );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sysvx", std::complex<double>, 0, n, 0, nrhs, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( lrwork < n );
 
     LAPACK_zsysvx(
         &fact_, &uplo_, &n_, &nrhs_,
@@ -443,8 +741,8 @@ int64_t sysvx(
         (lapack_complex_double*) X, &ldx_, rcond,
         ferr,
         berr,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0], &info_
+        (lapack_complex_double*) work, &lwork_,
+        rwork, &info_
     );
     if (info_ < 0) {
         throw Error();
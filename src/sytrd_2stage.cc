@@ -28,6 +28,61 @@ int64_t sytrd_2stage(
     float* tau,
     float* hous2, int64_t lhous2 )
 {
+    // query for workspace size
+    int64_t lwork;
+    sytrd_2stage_work_size(
+        jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return sytrd_2stage(
+        jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::hetrd_2stage
+/// @ingroup heev_computational
+int64_t sytrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tau,
+    double* hous2, int64_t lhous2 )
+{
+    // query for workspace size
+    int64_t lwork;
+    sytrd_2stage_work_size(
+        jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return sytrd_2stage(
+        jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup heev_computational
+void sytrd_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tau,
+    float* hous2, int64_t lhous2,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "ssytrd_2stage", jobz, uplo, n, lda, lhous2 );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -35,7 +90,6 @@ int64_t sytrd_2stage(
     lapack_int lhous2_ = to_lapack_int( lhous2 );
     lapack_int info_ = 0;
 
-    // query for workspace size
     float qry_work[1];
     lapack_int ineg_one = -1;
     LAPACK_ssytrd_2stage(
@@ -50,36 +104,61 @@ int64_t sytrd_2stage(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup heev_computational
+void sytrd_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tau,
+    double* hous2, int64_t lhous2,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "dsytrd_2stage", jobz, uplo, n, lda, lhous2 );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
 
-    LAPACK_ssytrd_2stage(
+    char jobz_ = to_char( jobz );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int lhous2_ = to_lapack_int( lhous2 );
+    lapack_int info_ = 0;
+
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dsytrd_2stage(
         &jobz_, &uplo_, &n_,
         A, &lda_,
         D,
         E,
         tau,
         hous2, &lhous2_,
-        &work[0], &lwork_, &info_
+        qry_work, &ineg_one, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    return info_;
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
 }
 
 // -----------------------------------------------------------------------------
-/// @see lapack::hetrd_2stage
 /// @ingroup heev_computational
 int64_t sytrd_2stage(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda,
-    double* D,
-    double* E,
-    double* tau,
-    double* hous2, int64_t lhous2 )
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tau,
+    float* hous2, int64_t lhous2,
+    float* work, int64_t lwork )
 {
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
@@ -87,26 +166,43 @@ int64_t sytrd_2stage(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int lhous2_ = to_lapack_int( lhous2 );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sytrd_2stage", float, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dsytrd_2stage(
+    LAPACK_ssytrd_2stage(
         &jobz_, &uplo_, &n_,
         A, &lda_,
         D,
         E,
         tau,
         hous2, &lhous2_,
-        qry_work, &ineg_one, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup heev_computational
+int64_t sytrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tau,
+    double* hous2, int64_t lhous2,
+    double* work, int64_t lwork )
+{
+    char jobz_ = to_char( jobz );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int lhous2_ = to_lapack_int( lhous2 );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sytrd_2stage", double, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
     LAPACK_dsytrd_2stage(
         &jobz_, &uplo_, &n_,
@@ -115,7 +211,7 @@ int64_t sytrd_2stage(
         E,
         tau,
         hous2, &lhous2_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
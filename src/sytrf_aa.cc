@@ -25,19 +25,158 @@ int64_t sytrf_aa(
     float* A, int64_t lda,
     int64_t* ipiv )
 {
+    // query for workspace size
+    int64_t lwork;
+    sytrf_aa_work_size(
+        uplo, n, A, lda, ipiv,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return sytrf_aa(
+        uplo, n, A, lda, ipiv,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv_aa_computational
+int64_t sytrf_aa(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    int64_t* ipiv )
+{
+    // query for workspace size
+    int64_t lwork;
+    sytrf_aa_work_size(
+        uplo, n, A, lda, ipiv,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return sytrf_aa(
+        uplo, n, A, lda, ipiv,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv_aa_computational
+int64_t sytrf_aa(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv )
+{
+    // query for workspace size
+    int64_t lwork;
+    sytrf_aa_work_size(
+        uplo, n, A, lda, ipiv,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+
+    return sytrf_aa(
+        uplo, n, A, lda, ipiv,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes the factorization of a symmetric matrix A
+/// using the Aasen's algorithm. The form of the factorization is
+/// \[
+///     A = U T U^T
+/// \]
+/// or
+/// \[
+///     A = L T L^T
+/// \]
+/// where U (or L) is a product of permutation and unit upper (lower)
+/// triangular matrices, and T is a symmetric tridiagonal matrix.
+///
+/// This is the blocked version of the algorithm, calling Level 3 BLAS.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+/// For real matrices, `lapack::hetrf_aa` is an alias for this.
+/// For complex Hermitian matrices, see `lapack::hetrf_aa`.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangle of A is stored;
+///     - lapack::Uplo::Lower: Lower triangle of A is stored.
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in,out] A
+///     The n-by-n matrix A, stored in an lda-by-n array.
+///     - On entry, the symmetric matrix A. If uplo = Upper, the leading
+///     n-by-n upper triangular part of A contains the upper
+///     triangular part of the matrix A, and the strictly lower
+///     triangular part of A is not referenced. If uplo = Lower, the
+///     leading n-by-n lower triangular part of A contains the lower
+///     triangular part of the matrix A, and the strictly upper
+///     triangular part of A is not referenced.
+///     - On exit, the tridiagonal matrix is stored in the diagonals
+///     and the subdiagonals of A just below (or above) the diagonals,
+///     and L is stored below (or above) the subdiaonals, when uplo
+///     is 'L' (or 'U').
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[out] ipiv
+///     The vector ipiv of length n.
+///     On exit, it contains the details of the interchanges, i.e.,
+///     the row and column k of A were interchanged with the
+///     row and column ipiv(k).
+///
+/// @return = 0: successful exit
+///
+/// @ingroup sysv_aa_computational
+int64_t sytrf_aa(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv )
+{
+    // query for workspace size
+    int64_t lwork;
+    sytrf_aa_work_size(
+        uplo, n, A, lda, ipiv,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+
+    return sytrf_aa(
+        uplo, n, A, lda, ipiv,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv_aa_computational
+void sytrf_aa_work_size(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "ssytrf_aa", uplo, n, lda );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( (n) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+        // 32-bit pivots in first half of ipiv; widened below
+        lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
 
-    // query for workspace size
     float qry_work[1];
     lapack_int ineg_one = -1;
     LAPACK_ssytrf_aa(
@@ -49,73 +188,174 @@ int64_t sytrf_aa(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup sysv_aa_computational
+void sytrf_aa_work_size(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "dsytrf_aa", uplo, n, lda );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
 
-    LAPACK_ssytrf_aa(
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    #ifndef LAPACK_ILP64
+        // 32-bit pivots in first half of ipiv; widened below
+        lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );
+    #else
+        lapack_int* ipiv_ptr = ipiv;
+    #endif
+    lapack_int info_ = 0;
+
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dsytrf_aa(
         &uplo_, &n_,
         A, &lda_,
         ipiv_ptr,
-        &work[0], &lwork_, &info_
+        qry_work, &ineg_one, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv_aa_computational
+void sytrf_aa_work_size(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "csytrf_aa", uplo, n, lda );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        // 32-bit pivots in first half of ipiv; widened below
+        lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );
+    #else
+        lapack_int* ipiv_ptr = ipiv;
     #endif
-    return info_;
+    lapack_int info_ = 0;
+
+    std::complex<float> qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_csytrf_aa(
+        &uplo_, &n_,
+        (lapack_complex_float*) A, &lda_,
+        ipiv_ptr,
+        (lapack_complex_float*) qry_work, &ineg_one, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
 }
 
 // -----------------------------------------------------------------------------
+/// Workspace query for lapack::sytrf_aa with caller-provided workspace.
+/// Returns the array lengths that the workspace overload of `sytrf_aa`
+/// requires, so the workspace can be allocated once, outside a loop.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+/// For real matrices, `lapack::hetrf_aa` is an alias for this.
+/// For complex Hermitian matrices, see `lapack::hetrf_aa`.
+///
+/// Other arguments are the same as for lapack::sytrf_aa.
+/// Arrays are used only to select the precision and are not referenced.
+///
+/// @param[out] lwork
+///     The optimal length of the array work.
+///
 /// @ingroup sysv_aa_computational
-int64_t sytrf_aa(
+void sytrf_aa_work_size(
     lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda,
-    int64_t* ipiv )
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    int64_t* lwork )
 {
+    auto key = internal::work_size_key(
+        "zsytrf_aa", uplo, n, lda );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( (n) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+        // 32-bit pivots in first half of ipiv; widened below
+        lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
+    std::complex<double> qry_work[1];
     lapack_int ineg_one = -1;
-    LAPACK_dsytrf_aa(
+    LAPACK_zsytrf_aa(
         &uplo_, &n_,
-        A, &lda_,
+        (lapack_complex_double*) A, &lda_,
         ipiv_ptr,
-        qry_work, &ineg_one, &info_
+        (lapack_complex_double*) qry_work, &ineg_one, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup sysv_aa_computational
+int64_t sytrf_aa(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    float* work, int64_t lwork )
+{
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    #ifndef LAPACK_ILP64
+        // 32-bit pivots in first half of ipiv; widened below
+        lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );
+    #else
+        lapack_int* ipiv_ptr = ipiv;
+    #endif
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sytrf_aa", float, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
-    LAPACK_dsytrf_aa(
+    LAPACK_ssytrf_aa(
         &uplo_, &n_,
         A, &lda_,
         ipiv_ptr,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        widen_pivots( ipiv, n );
     #endif
     return info_;
 }
@@ -124,151 +364,124 @@ int64_t sytrf_aa(
 /// @ingroup sysv_aa_computational
 int64_t sytrf_aa(
     lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda,
-    int64_t* ipiv )
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double* work, int64_t lwork )
 {
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( (n) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+        // 32-bit pivots in first half of ipiv; widened below
+        lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sytrf_aa", double, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_csytrf_aa(
+    LAPACK_dsytrf_aa(
         &uplo_, &n_,
-        (lapack_complex_float*) A, &lda_,
+        A, &lda_,
         ipiv_ptr,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    #ifndef LAPACK_ILP64
+        widen_pivots( ipiv, n );
+    #endif
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup sysv_aa_computational
+int64_t sytrf_aa(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* work, int64_t lwork )
+{
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    #ifndef LAPACK_ILP64
+        // 32-bit pivots in first half of ipiv; widened below
+        lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );
+    #else
+        lapack_int* ipiv_ptr = ipiv;
+    #endif
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sytrf_aa", std::complex<float>, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
     LAPACK_csytrf_aa(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
         ipiv_ptr,
-        (lapack_complex_float*) &work[0], &lwork_, &info_
+        (lapack_complex_float*) work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        widen_pivots( ipiv, n );
     #endif
     return info_;
 }
 
 // -----------------------------------------------------------------------------
-/// Computes the factorization of a symmetric matrix A
-/// using the Aasen's algorithm. The form of the factorization is
-/// \[
-///     A = U T U^T
-/// \]
-/// or
-/// \[
-///     A = L T L^T
-/// \]
-/// where U (or L) is a product of permutation and unit upper (lower)
-/// triangular matrices, and T is a symmetric tridiagonal matrix.
-///
-/// This is the blocked version of the algorithm, calling Level 3 BLAS.
+/// Variant of lapack::sytrf_aa that takes caller-provided workspace
+/// instead of querying and allocating it on each call.
+/// Use lapack::sytrf_aa_work_size to get the required lengths.
 ///
 /// Overloaded versions are available for
 /// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
 /// For real matrices, `lapack::hetrf_aa` is an alias for this.
 /// For complex Hermitian matrices, see `lapack::hetrf_aa`.
 ///
-/// @param[in] uplo
-///     - lapack::Uplo::Upper: Upper triangle of A is stored;
-///     - lapack::Uplo::Lower: Lower triangle of A is stored.
+/// Other arguments are the same as for lapack::sytrf_aa.
 ///
-/// @param[in] n
-///     The order of the matrix A. n >= 0.
+/// @param[out] work
+///     The vector work of length lwork. Workspace.
 ///
-/// @param[in,out] A
-///     The n-by-n matrix A, stored in an lda-by-n array.
-///     - On entry, the symmetric matrix A. If uplo = Upper, the leading
-///     n-by-n upper triangular part of A contains the upper
-///     triangular part of the matrix A, and the strictly lower
-///     triangular part of A is not referenced. If uplo = Lower, the
-///     leading n-by-n lower triangular part of A contains the lower
-///     triangular part of the matrix A, and the strictly upper
-///     triangular part of A is not referenced.
-///     - On exit, the tridiagonal matrix is stored in the diagonals
-///     and the subdiagonals of A just below (or above) the diagonals,
-///     and L is stored below (or above) the subdiaonals, when uplo
-///     is 'L' (or 'U').
-///
-/// @param[in] lda
-///     The leading dimension of the array A. lda >= max(1,n).
-///
-/// @param[out] ipiv
-///     The vector ipiv of length n.
-///     On exit, it contains the details of the interchanges, i.e.,
-///     the row and column k of A were interchanged with the
-///     row and column ipiv(k).
-///
-/// @return = 0: successful exit
+/// @param[in] lwork
+///     The length of the array work.
+///     Use the value from lapack::sytrf_aa_work_size for best performance.
 ///
 /// @ingroup sysv_aa_computational
 int64_t sytrf_aa(
     lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda,
-    int64_t* ipiv )
+    int64_t* ipiv,
+    std::complex<double>* work, int64_t lwork )
 {
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( (n) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+        // 32-bit pivots in first half of ipiv; widened below
+        lapack_int* ipiv_ptr = reinterpret_cast< lapack_int* >( ipiv );
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
-
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zsytrf_aa(
-        &uplo_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        ipiv_ptr,
-        (lapack_complex_double*) qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+    LAPACK_TRACE_BLOCK( "sytrf_aa", std::complex<double>, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
     LAPACK_zsytrf_aa(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
         ipiv_ptr,
-        (lapack_complex_double*) &work[0], &lwork_, &info_
+        (lapack_complex_double*) work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        widen_pivots( ipiv, n );
     #endif
     return info_;
 }
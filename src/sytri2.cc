@@ -25,19 +25,147 @@ int64_t sytri2(
     float* A, int64_t lda,
     int64_t const* ipiv )
 {
+    // query for workspace size
+    int64_t lwork;
+    sytri2_work_size(
+        uplo, n, A, lda, ipiv,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return sytri2(
+        uplo, n, A, lda, ipiv,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv_computational
+int64_t sytri2(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    int64_t const* ipiv )
+{
+    // query for workspace size
+    int64_t lwork;
+    sytri2_work_size(
+        uplo, n, A, lda, ipiv,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return sytri2(
+        uplo, n, A, lda, ipiv,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t sytri2(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t const* ipiv )
+{
+    // query for workspace size
+    int64_t lwork;
+    sytri2_work_size(
+        uplo, n, A, lda, ipiv,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+
+    return sytri2(
+        uplo, n, A, lda, ipiv,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes the inverse of a symmetric indefinite matrix
+/// A using the factorization $A = U D U^T$ or $A = L D L^T$ computed by
+/// `lapack::sytrf`. `sytri2` sets the leading dimension of the workspace
+/// before calling `sytri2x` that actually computes the inverse.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+/// For real matrices, `lapack::hetri2` is an alias for this.
+/// For complex Hermitian matrices, see `lapack::hetri2`.
+///
+/// @see sytri
+///
+/// @param[in] uplo
+///     Whether the details of the factorization are stored
+///     as an upper or lower triangular matrix.
+///     - lapack::Uplo::Upper: Upper triangular, form is $A = U D U^T;$
+///     - lapack::Uplo::Lower: Lower triangular, form is $A = L D L^T.$
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in,out] A
+///     The n-by-n matrix A, stored in an lda-by-n array.
+///     On entry, the block diagonal matrix D and the multipliers
+///     used to obtain the factor U or L as computed by `lapack::sytrf`.
+///     On successful exit, the (symmetric) inverse of the original
+///     matrix.
+///     - If uplo = Upper, the upper triangular part of the
+///     inverse is formed and the part of A below the diagonal is not
+///     referenced;
+///     - if uplo = Lower the lower triangular part of the
+///     inverse is formed and the part of A above the diagonal is
+///     not referenced.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[in] ipiv
+///     The vector ipiv of length n.
+///     Details of the interchanges and the block structure of D
+///     as determined by `lapack::sytrf`.
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, D(i,i) = 0; the matrix is singular and its
+///     inverse could not be computed.
+///
+/// @ingroup sysv_computational
+int64_t sytri2(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t const* ipiv )
+{
+    // query for workspace size
+    int64_t lwork;
+    sytri2_work_size(
+        uplo, n, A, lda, ipiv,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+
+    return sytri2(
+        uplo, n, A, lda, ipiv,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv_computational
+void sytri2_work_size(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    int64_t const* ipiv,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "ssytri2", uplo, n, lda );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
-        lapack_int const* ipiv_ptr = &ipiv_[0];
-    #else
-        lapack_int const* ipiv_ptr = ipiv;
-    #endif
+    lapack_int const* ipiv_ptr = reinterpret_cast< lapack_int const* >( ipiv );  // not referenced
     lapack_int info_ = 0;
 
-    // query for workspace size
     float qry_work[1];
     lapack_int ineg_one = -1;
     LAPACK_ssytri2(
@@ -49,29 +177,133 @@ int64_t sytri2(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup sysv_computational
+void sytri2_work_size(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    int64_t const* ipiv,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "dsytri2", uplo, n, lda );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
 
-    LAPACK_ssytri2(
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int const* ipiv_ptr = reinterpret_cast< lapack_int const* >( ipiv );  // not referenced
+    lapack_int info_ = 0;
+
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dsytri2(
         &uplo_, &n_,
         A, &lda_,
         ipiv_ptr,
-        &work[0], &lwork_, &info_
+        qry_work, &ineg_one, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    return info_;
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+void sytri2_work_size(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t const* ipiv,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "csytri2", uplo, n, lda );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int const* ipiv_ptr = reinterpret_cast< lapack_int const* >( ipiv );  // not referenced
+    lapack_int info_ = 0;
+
+    std::complex<float> qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_csytri2(
+        &uplo_, &n_,
+        (lapack_complex_float*) A, &lda_,
+        ipiv_ptr,
+        (lapack_complex_float*) qry_work, &ineg_one, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::sytri2 with caller-provided workspace.
+/// Returns the array lengths that the workspace overload of `sytri2`
+/// requires, so the workspace can be allocated once, outside a loop.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+/// For real matrices, `lapack::hetri2` is an alias for this.
+/// For complex Hermitian matrices, see `lapack::hetri2`.
+///
+/// Other arguments are the same as for lapack::sytri2.
+/// Arrays are used only to select the precision and are not referenced.
+///
+/// @param[out] lwork
+///     The optimal length of the array work.
+///
+/// @ingroup sysv_computational
+void sytri2_work_size(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t const* ipiv,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "zsytri2", uplo, n, lda );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int const* ipiv_ptr = reinterpret_cast< lapack_int const* >( ipiv );  // not referenced
+    lapack_int info_ = 0;
+
+    std::complex<double> qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_zsytri2(
+        &uplo_, &n_,
+        (lapack_complex_double*) A, &lda_,
+        ipiv_ptr,
+        (lapack_complex_double*) qry_work, &ineg_one, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
 }
 
 // -----------------------------------------------------------------------------
 /// @ingroup sysv_computational
 int64_t sytri2(
     lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda,
-    int64_t const* ipiv )
+    float* A, int64_t lda,
+    int64_t const* ipiv,
+    float* work, int64_t lwork )
 {
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -84,29 +316,48 @@ int64_t sytri2(
         lapack_int const* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sytri2", float, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dsytri2(
+    LAPACK_ssytri2(
         &uplo_, &n_,
         A, &lda_,
         ipiv_ptr,
-        qry_work, &ineg_one, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup sysv_computational
+int64_t sytri2(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    int64_t const* ipiv,
+    double* work, int64_t lwork )
+{
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack_int const* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int const* ipiv_ptr = ipiv;
+    #endif
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sytri2", double, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
     LAPACK_dsytri2(
         &uplo_, &n_,
         A, &lda_,
         ipiv_ptr,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -118,7 +369,8 @@ int64_t sytri2(
 int64_t sytri2(
     lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda,
-    int64_t const* ipiv )
+    int64_t const* ipiv,
+    std::complex<float>* work, int64_t lwork )
 {
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -131,29 +383,14 @@ int64_t sytri2(
         lapack_int const* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sytri2", std::complex<float>, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
     LAPACK_csytri2(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
         ipiv_ptr,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-
-    LAPACK_csytri2(
-        &uplo_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        ipiv_ptr,
-        (lapack_complex_float*) &work[0], &lwork_, &info_
+        (lapack_complex_float*) work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -162,57 +399,30 @@ int64_t sytri2(
 }
 
 // -----------------------------------------------------------------------------
-/// Computes the inverse of a symmetric indefinite matrix
-/// A using the factorization $A = U D U^T$ or $A = L D L^T$ computed by
-/// `lapack::sytrf`. `sytri2` sets the leading dimension of the workspace
-/// before calling `sytri2x` that actually computes the inverse.
+/// Variant of lapack::sytri2 that takes caller-provided workspace
+/// instead of querying and allocating it on each call.
+/// Use lapack::sytri2_work_size to get the required lengths.
 ///
 /// Overloaded versions are available for
 /// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
 /// For real matrices, `lapack::hetri2` is an alias for this.
 /// For complex Hermitian matrices, see `lapack::hetri2`.
 ///
-/// @see sytri
-///
-/// @param[in] uplo
-///     Whether the details of the factorization are stored
-///     as an upper or lower triangular matrix.
-///     - lapack::Uplo::Upper: Upper triangular, form is $A = U D U^T;$
-///     - lapack::Uplo::Lower: Lower triangular, form is $A = L D L^T.$
-///
-/// @param[in] n
-///     The order of the matrix A. n >= 0.
-///
-/// @param[in,out] A
-///     The n-by-n matrix A, stored in an lda-by-n array.
-///     On entry, the block diagonal matrix D and the multipliers
-///     used to obtain the factor U or L as computed by `lapack::sytrf`.
-///     On successful exit, the (symmetric) inverse of the original
-///     matrix.
-///     - If uplo = Upper, the upper triangular part of the
-///     inverse is formed and the part of A below the diagonal is not
-///     referenced;
-///     - if uplo = Lower the lower triangular part of the
-///     inverse is formed and the part of A above the diagonal is
-///     not referenced.
-///
-/// @param[in] lda
-///     The leading dimension of the array A. lda >= max(1,n).
+/// Other arguments are the same as for lapack::sytri2.
 ///
-/// @param[in] ipiv
-///     The vector ipiv of length n.
-///     Details of the interchanges and the block structure of D
-///     as determined by `lapack::sytrf`.
+/// @param[out] work
+///     The vector work of length lwork. Workspace.
 ///
-/// @return = 0: successful exit
-/// @return > 0: if return value = i, D(i,i) = 0; the matrix is singular and its
-///     inverse could not be computed.
+/// @param[in] lwork
+///     The length of the array work.
+///     Use the value from lapack::sytri2_work_size for best performance.
 ///
 /// @ingroup sysv_computational
 int64_t sytri2(
     lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda,
-    int64_t const* ipiv )
+    int64_t const* ipiv,
+    std::complex<double>* work, int64_t lwork )
 {
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -225,29 +435,14 @@ int64_t sytri2(
         lapack_int const* ipiv_ptr = ipiv;
     #endif
     lapack_int info_ = 0;
-
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zsytri2(
-        &uplo_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        ipiv_ptr,
-        (lapack_complex_double*) qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+    LAPACK_TRACE_BLOCK( "sytri2", std::complex<double>, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
 
     LAPACK_zsytri2(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
         ipiv_ptr,
-        (lapack_complex_double*) &work[0], &lwork_, &info_
+        (lapack_complex_double*) work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
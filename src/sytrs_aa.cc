@@ -40,6 +40,7 @@ int64_t sytrs_aa(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int lwork_ = max( 1, 3*n-2 );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sytrs_aa", float, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (max(1,lwork_)) );
@@ -79,6 +80,7 @@ int64_t sytrs_aa(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int lwork_ = max( 1, 3*n-2 );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sytrs_aa", double, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (max(1,lwork_)) );
@@ -118,6 +120,7 @@ int64_t sytrs_aa(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int lwork_ = max( 1, 3*n-2 );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sytrs_aa", std::complex<float>, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<float> > work( (max(1,lwork_)) );
@@ -200,6 +203,7 @@ int64_t sytrs_aa(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int lwork_ = max( 1, 3*n-2 );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sytrs_aa", std::complex<double>, 0, n, 0, nrhs, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (max(1,lwork_)) );
@@ -40,6 +40,7 @@ int64_t sytrs_rk(
     #endif
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sytrs_rk", float, 0, n, 0, nrhs, info_ );
 
     LAPACK_ssytrs_3(
         &uplo_, &n_, &nrhs_,
@@ -76,6 +77,7 @@ int64_t sytrs_rk(
     #endif
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sytrs_rk", double, 0, n, 0, nrhs, info_ );
 
     LAPACK_dsytrs_3(
         &uplo_, &n_, &nrhs_,
@@ -112,6 +114,7 @@ int64_t sytrs_rk(
     #endif
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sytrs_rk", std::complex<float>, 0, n, 0, nrhs, info_ );
 
     LAPACK_csytrs_3(
         &uplo_, &n_, &nrhs_,
@@ -232,6 +235,7 @@ int64_t sytrs_rk(
     #endif
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sytrs_rk", std::complex<double>, 0, n, 0, nrhs, info_ );
 
     LAPACK_zsytrs_3(
         &uplo_, &n_, &nrhs_,
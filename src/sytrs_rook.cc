@@ -39,6 +39,7 @@ int64_t sytrs_rook(
     #endif
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sytrs_rook", float, 0, n, 0, nrhs, info_ );
 
     LAPACK_ssytrs_rook(
         &uplo_, &n_, &nrhs_,
@@ -73,6 +74,7 @@ int64_t sytrs_rook(
     #endif
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sytrs_rook", double, 0, n, 0, nrhs, info_ );
 
     LAPACK_dsytrs_rook(
         &uplo_, &n_, &nrhs_,
@@ -107,6 +109,7 @@ int64_t sytrs_rook(
     #endif
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sytrs_rook", std::complex<float>, 0, n, 0, nrhs, info_ );
 
     LAPACK_csytrs_rook(
         &uplo_, &n_, &nrhs_,
@@ -143,6 +146,7 @@ int64_t sytrs_rook(
     #endif
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "sytrs_rook", std::complex<double>, 0, n, 0, nrhs, info_ );
 
     LAPACK_zsytrs_rook(
         &uplo_, &n_, &nrhs_,
@@ -29,6 +29,7 @@ int64_t tbcon(
     lapack_int kd_ = to_lapack_int( kd );
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tbcon", float, 0, n, kd, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (3*n) );
@@ -59,6 +60,7 @@ int64_t tbcon(
     lapack_int kd_ = to_lapack_int( kd );
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tbcon", double, 0, n, kd, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (3*n) );
@@ -89,6 +91,7 @@ int64_t tbcon(
     lapack_int kd_ = to_lapack_int( kd );
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tbcon", std::complex<float>, 0, n, kd, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
@@ -119,6 +122,7 @@ int64_t tbcon(
     lapack_int kd_ = to_lapack_int( kd );
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tbcon", std::complex<double>, 0, n, kd, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
@@ -30,6 +30,7 @@ int64_t tbtrs(
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tbtrs", float, 0, n, kd, nrhs, info_ );
 
     LAPACK_stbtrs(
         &uplo_, &trans_, &diag_, &n_, &kd_, &nrhs_,
@@ -57,6 +58,7 @@ int64_t tbtrs(
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tbtrs", double, 0, n, kd, nrhs, info_ );
 
     LAPACK_dtbtrs(
         &uplo_, &trans_, &diag_, &n_, &kd_, &nrhs_,
@@ -84,6 +86,7 @@ int64_t tbtrs(
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tbtrs", std::complex<float>, 0, n, kd, nrhs, info_ );
 
     LAPACK_ctbtrs(
         &uplo_, &trans_, &diag_, &n_, &kd_, &nrhs_,
@@ -111,6 +114,7 @@ int64_t tbtrs(
     lapack_int ldab_ = to_lapack_int( ldab );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tbtrs", std::complex<double>, 0, n, kd, nrhs, info_ );
 
     LAPACK_ztbtrs(
         &uplo_, &trans_, &diag_, &n_, &kd_, &nrhs_,
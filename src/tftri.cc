@@ -25,6 +25,7 @@ int64_t tftri(
     char diag_ = to_char( diag );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tftri", float, 0, n, 0, 0, info_ );
 
     LAPACK_stftri(
         &transr_, &uplo_, &diag_, &n_,
@@ -46,6 +47,7 @@ int64_t tftri(
     char diag_ = to_char( diag );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tftri", double, 0, n, 0, 0, info_ );
 
     LAPACK_dtftri(
         &transr_, &uplo_, &diag_, &n_,
@@ -67,6 +69,7 @@ int64_t tftri(
     char diag_ = to_char( diag );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tftri", std::complex<float>, 0, n, 0, 0, info_ );
 
     LAPACK_ctftri(
         &transr_, &uplo_, &diag_, &n_,
@@ -88,6 +91,7 @@ int64_t tftri(
     char diag_ = to_char( diag );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tftri", std::complex<double>, 0, n, 0, 0, info_ );
 
     LAPACK_ztftri(
         &transr_, &uplo_, &diag_, &n_,
@@ -25,6 +25,7 @@ int64_t tfttp(
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tfttp", float, 0, n, 0, 0, info_ );
 
     LAPACK_stfttp(
         &transr_, &uplo_, &n_,
@@ -47,6 +48,7 @@ int64_t tfttp(
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tfttp", double, 0, n, 0, 0, info_ );
 
     LAPACK_dtfttp(
         &transr_, &uplo_, &n_,
@@ -69,6 +71,7 @@ int64_t tfttp(
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tfttp", std::complex<float>, 0, n, 0, 0, info_ );
 
     LAPACK_ctfttp(
         &transr_, &uplo_, &n_,
@@ -91,6 +94,7 @@ int64_t tfttp(
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tfttp", std::complex<double>, 0, n, 0, 0, info_ );
 
     LAPACK_ztfttp(
         &transr_, &uplo_, &n_,
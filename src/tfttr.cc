@@ -26,6 +26,7 @@ int64_t tfttr(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tfttr", float, 0, n, 0, 0, info_ );
 
     LAPACK_stfttr(
         &transr_, &uplo_, &n_,
@@ -49,6 +50,7 @@ int64_t tfttr(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tfttr", double, 0, n, 0, 0, info_ );
 
     LAPACK_dtfttr(
         &transr_, &uplo_, &n_,
@@ -72,6 +74,7 @@ int64_t tfttr(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tfttr", std::complex<float>, 0, n, 0, 0, info_ );
 
     LAPACK_ctfttr(
         &transr_, &uplo_, &n_,
@@ -95,6 +98,7 @@ int64_t tfttr(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tfttr", std::complex<double>, 0, n, 0, 0, info_ );
 
     LAPACK_ztfttr(
         &transr_, &uplo_, &n_,
@@ -128,6 +128,7 @@ int64_t tgexc(
     lapack_int ifst_ = to_lapack_int( *ifst );  // in,out
     lapack_int ilst_ = to_lapack_int( *ilst );  // in,out
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tgexc", scalar_t, 0, n, 0, 0, info_ );
 
     if constexpr (! is_complex_v<scalar_t>) {
         // Real needs workspace.
@@ -162,6 +162,7 @@ int64_t tgsen(
     lapack_int ldz_ = to_lapack_int( ldz );
     lapack_int nfound_ = 0;  // out
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tgsen", scalar_t, 0, n, 0, 0, info_ );
 
     // For real, create vectors for split-complex representation.
     // For complex, creates as dummy `int` type to be optimized away.
@@ -43,6 +43,7 @@ int64_t tgsja(
     lapack_int ldq_ = to_lapack_int( ldq );
     lapack_int ncycle_ = 0;  // out
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tgsja", float, m, n, k, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (2*n) );
@@ -92,6 +93,7 @@ int64_t tgsja(
     lapack_int ldq_ = to_lapack_int( ldq );
     lapack_int ncycle_ = 0;  // out
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tgsja", double, m, n, k, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (2*n) );
@@ -141,6 +143,7 @@ int64_t tgsja(
     lapack_int ldq_ = to_lapack_int( ldq );
     lapack_int ncycle_ = 0;  // out
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tgsja", std::complex<float>, m, n, k, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
@@ -190,6 +193,7 @@ int64_t tgsja(
     lapack_int ldq_ = to_lapack_int( ldq );
     lapack_int ncycle_ = 0;  // out
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tgsja", std::complex<double>, m, n, k, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
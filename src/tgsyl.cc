@@ -28,6 +28,128 @@ int64_t tgsyl(
     float* dif,
     float* scale )
 {
+    // query for workspace size
+    int64_t lwork, liwork;
+    tgsyl_work_size(
+        trans, ijob, m, n, A, lda, B, ldb, C, ldc, D, ldd, E, lde, F, ldf, dif,
+        scale,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+    lapack::vector< int64_t > iwork( liwork );
+
+    return tgsyl(
+        trans, ijob, m, n, A, lda, B, ldb, C, ldc, D, ldd, E, lde, F, ldf, dif,
+        scale,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t tgsyl(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    double const* B, int64_t ldb,
+    double* C, int64_t ldc,
+    double const* D, int64_t ldd,
+    double const* E, int64_t lde,
+    double* F, int64_t ldf,
+    double* dif,
+    double* scale )
+{
+    // query for workspace size
+    int64_t lwork, liwork;
+    tgsyl_work_size(
+        trans, ijob, m, n, A, lda, B, ldb, C, ldc, D, ldd, E, lde, F, ldf, dif,
+        scale,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+    lapack::vector< int64_t > iwork( liwork );
+
+    return tgsyl(
+        trans, ijob, m, n, A, lda, B, ldb, C, ldc, D, ldd, E, lde, F, ldf, dif,
+        scale,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t tgsyl(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* C, int64_t ldc,
+    std::complex<float> const* D, int64_t ldd,
+    std::complex<float> const* E, int64_t lde,
+    std::complex<float>* F, int64_t ldf,
+    float* dif,
+    float* scale )
+{
+    // query for workspace size
+    int64_t lwork, liwork;
+    tgsyl_work_size(
+        trans, ijob, m, n, A, lda, B, ldb, C, ldc, D, ldd, E, lde, F, ldf, dif,
+        scale,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< int64_t > iwork( liwork );
+
+    return tgsyl(
+        trans, ijob, m, n, A, lda, B, ldb, C, ldc, D, ldd, E, lde, F, ldf, dif,
+        scale,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t tgsyl(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* C, int64_t ldc,
+    std::complex<double> const* D, int64_t ldd,
+    std::complex<double> const* E, int64_t lde,
+    std::complex<double>* F, int64_t ldf,
+    double* dif,
+    double* scale )
+{
+    // query for workspace size
+    int64_t lwork, liwork;
+    tgsyl_work_size(
+        trans, ijob, m, n, A, lda, B, ldb, C, ldc, D, ldd, E, lde, F, ldf, dif,
+        scale,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< int64_t > iwork( liwork );
+
+    return tgsyl(
+        trans, ijob, m, n, A, lda, B, ldb, C, ldc, D, ldd, E, lde, F, ldf, dif,
+        scale,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+void tgsyl_work_size(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    float const* B, int64_t ldb,
+    float* C, int64_t ldc,
+    float const* D, int64_t ldd,
+    float const* E, int64_t lde,
+    float* F, int64_t ldf,
+    float* dif,
+    float* scale,
+    int64_t* lwork, int64_t* liwork )
+{
+    auto key = internal::work_size_key(
+        "stgsyl", trans, ijob, m, n, lda, ldb, ldc, ldd, lde, ldf );
+    if (internal::work_size_cache_find( key, lwork, liwork ))
+        return;
+
     char trans_ = to_char( trans );
     lapack_int ijob_ = to_lapack_int( ijob );
     lapack_int m_ = to_lapack_int( m );
@@ -40,7 +162,6 @@ int64_t tgsyl(
     lapack_int ldf_ = to_lapack_int( ldf );
     lapack_int info_ = 0;
 
-    // query for workspace size
     float qry_work[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
@@ -58,31 +179,13 @@ int64_t tgsyl(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (m+n+6) );
-
-    LAPACK_stgsyl(
-        &trans_, &ijob_, &m_, &n_,
-        A, &lda_,
-        B, &ldb_,
-        C, &ldc_,
-        D, &ldd_,
-        E, &lde_,
-        F, &ldf_, dif, scale,
-        &work[0], &lwork_,
-        &iwork[0], &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    *lwork = real(qry_work[0]);
+    *liwork = m+n+6;
+    internal::work_size_cache_insert( key, *lwork, *liwork );
 }
 
 // -----------------------------------------------------------------------------
-int64_t tgsyl(
+void tgsyl_work_size(
     lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
     double const* A, int64_t lda,
     double const* B, int64_t ldb,
@@ -91,8 +194,14 @@ int64_t tgsyl(
     double const* E, int64_t lde,
     double* F, int64_t ldf,
     double* dif,
-    double* scale )
+    double* scale,
+    int64_t* lwork, int64_t* liwork )
 {
+    auto key = internal::work_size_key(
+        "dtgsyl", trans, ijob, m, n, lda, ldb, ldc, ldd, lde, ldf );
+    if (internal::work_size_cache_find( key, lwork, liwork ))
+        return;
+
     char trans_ = to_char( trans );
     lapack_int ijob_ = to_lapack_int( ijob );
     lapack_int m_ = to_lapack_int( m );
@@ -105,7 +214,6 @@ int64_t tgsyl(
     lapack_int ldf_ = to_lapack_int( ldf );
     lapack_int info_ = 0;
 
-    // query for workspace size
     double qry_work[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
@@ -123,31 +231,13 @@ int64_t tgsyl(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (m+n+6) );
-
-    LAPACK_dtgsyl(
-        &trans_, &ijob_, &m_, &n_,
-        A, &lda_,
-        B, &ldb_,
-        C, &ldc_,
-        D, &ldd_,
-        E, &lde_,
-        F, &ldf_, dif, scale,
-        &work[0], &lwork_,
-        &iwork[0], &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    *lwork = real(qry_work[0]);
+    *liwork = m+n+6;
+    internal::work_size_cache_insert( key, *lwork, *liwork );
 }
 
 // -----------------------------------------------------------------------------
-int64_t tgsyl(
+void tgsyl_work_size(
     lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
     std::complex<float> const* A, int64_t lda,
     std::complex<float> const* B, int64_t ldb,
@@ -156,8 +246,14 @@ int64_t tgsyl(
     std::complex<float> const* E, int64_t lde,
     std::complex<float>* F, int64_t ldf,
     float* dif,
-    float* scale )
+    float* scale,
+    int64_t* lwork, int64_t* liwork )
 {
+    auto key = internal::work_size_key(
+        "ctgsyl", trans, ijob, m, n, lda, ldb, ldc, ldd, lde, ldf );
+    if (internal::work_size_cache_find( key, lwork, liwork ))
+        return;
+
     char trans_ = to_char( trans );
     lapack_int ijob_ = to_lapack_int( ijob );
     lapack_int m_ = to_lapack_int( m );
@@ -170,7 +266,6 @@ int64_t tgsyl(
     lapack_int ldf_ = to_lapack_int( ldf );
     lapack_int info_ = 0;
 
-    // query for workspace size
     std::complex<float> qry_work[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
@@ -188,31 +283,13 @@ int64_t tgsyl(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (m+n+2) );
-
-    LAPACK_ctgsyl(
-        &trans_, &ijob_, &m_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_,
-        (lapack_complex_float*) C, &ldc_,
-        (lapack_complex_float*) D, &ldd_,
-        (lapack_complex_float*) E, &lde_,
-        (lapack_complex_float*) F, &ldf_, dif, scale,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &iwork[0], &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    *lwork = real(qry_work[0]);
+    *liwork = m+n+2;
+    internal::work_size_cache_insert( key, *lwork, *liwork );
 }
 
 // -----------------------------------------------------------------------------
-int64_t tgsyl(
+void tgsyl_work_size(
     lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
     std::complex<double> const* A, int64_t lda,
     std::complex<double> const* B, int64_t ldb,
@@ -221,8 +298,14 @@ int64_t tgsyl(
     std::complex<double> const* E, int64_t lde,
     std::complex<double>* F, int64_t ldf,
     double* dif,
-    double* scale )
+    double* scale,
+    int64_t* lwork, int64_t* liwork )
 {
+    auto key = internal::work_size_key(
+        "ztgsyl", trans, ijob, m, n, lda, ldb, ldc, ldd, lde, ldf );
+    if (internal::work_size_cache_find( key, lwork, liwork ))
+        return;
+
     char trans_ = to_char( trans );
     lapack_int ijob_ = to_lapack_int( ijob );
     lapack_int m_ = to_lapack_int( m );
@@ -235,7 +318,6 @@ int64_t tgsyl(
     lapack_int ldf_ = to_lapack_int( ldf );
     lapack_int info_ = 0;
 
-    // query for workspace size
     std::complex<double> qry_work[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
@@ -253,11 +335,185 @@ int64_t tgsyl(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    *liwork = m+n+2;
+    internal::work_size_cache_insert( key, *lwork, *liwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (m+n+2) );
+// -----------------------------------------------------------------------------
+int64_t tgsyl(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    float const* B, int64_t ldb,
+    float* C, int64_t ldc,
+    float const* D, int64_t ldd,
+    float const* E, int64_t lde,
+    float* F, int64_t ldf,
+    float* dif,
+    float* scale,
+    float* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    char trans_ = to_char( trans );
+    lapack_int ijob_ = to_lapack_int( ijob );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int ldc_ = to_lapack_int( ldc );
+    lapack_int ldd_ = to_lapack_int( ldd );
+    lapack_int lde_ = to_lapack_int( lde );
+    lapack_int ldf_ = to_lapack_int( ldf );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tgsyl", float, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( liwork < m+n+6 );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
+
+    LAPACK_stgsyl(
+        &trans_, &ijob_, &m_, &n_,
+        A, &lda_,
+        B, &ldb_,
+        C, &ldc_,
+        D, &ldd_,
+        E, &lde_,
+        F, &ldf_, dif, scale,
+        work, &lwork_,
+        iwork_, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t tgsyl(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    double const* B, int64_t ldb,
+    double* C, int64_t ldc,
+    double const* D, int64_t ldd,
+    double const* E, int64_t lde,
+    double* F, int64_t ldf,
+    double* dif,
+    double* scale,
+    double* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    char trans_ = to_char( trans );
+    lapack_int ijob_ = to_lapack_int( ijob );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int ldc_ = to_lapack_int( ldc );
+    lapack_int ldd_ = to_lapack_int( ldd );
+    lapack_int lde_ = to_lapack_int( lde );
+    lapack_int ldf_ = to_lapack_int( ldf );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tgsyl", double, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( liwork < m+n+6 );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
+
+    LAPACK_dtgsyl(
+        &trans_, &ijob_, &m_, &n_,
+        A, &lda_,
+        B, &ldb_,
+        C, &ldc_,
+        D, &ldd_,
+        E, &lde_,
+        F, &ldf_, dif, scale,
+        work, &lwork_,
+        iwork_, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t tgsyl(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* C, int64_t ldc,
+    std::complex<float> const* D, int64_t ldd,
+    std::complex<float> const* E, int64_t lde,
+    std::complex<float>* F, int64_t ldf,
+    float* dif,
+    float* scale,
+    std::complex<float>* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    char trans_ = to_char( trans );
+    lapack_int ijob_ = to_lapack_int( ijob );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int ldc_ = to_lapack_int( ldc );
+    lapack_int ldd_ = to_lapack_int( ldd );
+    lapack_int lde_ = to_lapack_int( lde );
+    lapack_int ldf_ = to_lapack_int( ldf );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tgsyl", std::complex<float>, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( liwork < m+n+2 );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
+
+    LAPACK_ctgsyl(
+        &trans_, &ijob_, &m_, &n_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) B, &ldb_,
+        (lapack_complex_float*) C, &ldc_,
+        (lapack_complex_float*) D, &ldd_,
+        (lapack_complex_float*) E, &lde_,
+        (lapack_complex_float*) F, &ldf_, dif, scale,
+        (lapack_complex_float*) work, &lwork_,
+        iwork_, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t tgsyl(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* C, int64_t ldc,
+    std::complex<double> const* D, int64_t ldd,
+    std::complex<double> const* E, int64_t lde,
+    std::complex<double>* F, int64_t ldf,
+    double* dif,
+    double* scale,
+    std::complex<double>* work, int64_t lwork,
+    int64_t* iwork, int64_t liwork )
+{
+    char trans_ = to_char( trans );
+    lapack_int ijob_ = to_lapack_int( ijob );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int ldc_ = to_lapack_int( ldc );
+    lapack_int ldd_ = to_lapack_int( ldd );
+    lapack_int lde_ = to_lapack_int( lde );
+    lapack_int ldf_ = to_lapack_int( ldf );
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tgsyl", std::complex<double>, m, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( liwork < m+n+2 );
+    // 32-bit iwork fits in caller's 64-bit iwork
+    lapack_int* iwork_ = reinterpret_cast< lapack_int* >( iwork );
 
     LAPACK_ztgsyl(
         &trans_, &ijob_, &m_, &n_,
@@ -267,8 +523,8 @@ int64_t tgsyl(
         (lapack_complex_double*) D, &ldd_,
         (lapack_complex_double*) E, &lde_,
         (lapack_complex_double*) F, &ldf_, dif, scale,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &iwork[0], &info_
+        (lapack_complex_double*) work, &lwork_,
+        iwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
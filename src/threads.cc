@@ -0,0 +1,196 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/threads.hh"
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#ifdef _OPENMP
+    #include <omp.h>
+#endif
+
+// Thread control of the vendor library, detected by configure
+// (config/mkl_version.cc, etc.). Prototypes are declared here rather
+// than including vendor headers, which conflict with LAPACK++'s own
+// LAPACK and CBLAS prototypes.
+#if defined( BLAS_HAVE_MKL ) || defined( LAPACK_HAVE_MKL )
+    #define LAPACK_THREADS_MKL
+    extern "C" {
+        int  MKL_Get_Max_Threads();
+        void MKL_Set_Num_Threads( int num_threads );
+        int  MKL_Set_Num_Threads_Local( int num_threads );
+    }
+#elif defined( BLAS_HAVE_OPENBLAS ) || defined( LAPACK_HAVE_OPENBLAS )
+    #define LAPACK_THREADS_OPENBLAS
+    extern "C" {
+        int  openblas_get_num_threads();
+        void openblas_set_num_threads( int num_threads );
+    }
+#elif defined( BLAS_HAVE_BLIS ) || defined( LAPACK_HAVE_BLIS )
+    #define LAPACK_THREADS_BLIS
+    extern "C" {
+        // dim_t is int64_t in the default BLIS configuration.
+        int64_t bli_thread_get_num_threads();
+        void    bli_thread_set_num_threads( int64_t num_threads );
+    }
+#endif
+
+#if defined( LAPACK_THREADS_MKL ) || defined( LAPACK_THREADS_OPENBLAS ) \
+    || defined( LAPACK_THREADS_BLIS )
+    #define LAPACK_THREADS_VENDOR
+#endif
+
+namespace lapack {
+
+namespace {
+
+#ifdef LAPACK_THREADS_VENDOR
+//------------------------------------------------------------------------------
+int vendor_get_num_threads()
+{
+    #if defined( LAPACK_THREADS_MKL )
+        return MKL_Get_Max_Threads();
+    #elif defined( LAPACK_THREADS_OPENBLAS )
+        return openblas_get_num_threads();
+    #else
+        return int( bli_thread_get_num_threads() );
+    #endif
+}
+
+//------------------------------------------------------------------------------
+void vendor_set_num_threads( int num_threads )
+{
+    #if defined( LAPACK_THREADS_MKL )
+        MKL_Set_Num_Threads( num_threads );
+    #elif defined( LAPACK_THREADS_OPENBLAS )
+        openblas_set_num_threads( num_threads );
+    #else
+        bli_thread_set_num_threads( num_threads );
+    #endif
+}
+#endif  // LAPACK_THREADS_VENDOR
+
+//------------------------------------------------------------------------------
+int omp_get_num_threads_()
+{
+    #ifdef _OPENMP
+        return omp_get_max_threads();
+    #else
+        return 1;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+void omp_set_num_threads_( int num_threads )
+{
+    #ifdef _OPENMP
+        omp_set_num_threads( num_threads );
+    #endif
+}
+
+#if defined( LAPACK_THREADS_OPENBLAS ) || defined( LAPACK_THREADS_BLIS )
+// OpenBLAS and BLIS have only a global setting, shared by all scopes.
+// It is the count of the most recently created live scope, so a scope
+// ending on one thread doesn't undo another thread's live scope.
+std::mutex global_mutex;
+std::vector< ThreadScope const* > global_scopes;
+int global_saved = 0;
+#endif
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+const char* thread_library()
+{
+    #if defined( LAPACK_THREADS_MKL )
+        return "MKL";
+    #elif defined( LAPACK_THREADS_OPENBLAS )
+        return "OpenBLAS";
+    #elif defined( LAPACK_THREADS_BLIS )
+        return "BLIS";
+    #elif defined( _OPENMP )
+        return "OpenMP";
+    #else
+        return "none";
+    #endif
+}
+
+//------------------------------------------------------------------------------
+int get_num_threads()
+{
+    #ifdef LAPACK_THREADS_VENDOR
+        return vendor_get_num_threads();
+    #else
+        return omp_get_num_threads_();
+    #endif
+}
+
+//------------------------------------------------------------------------------
+void set_num_threads( int num_threads )
+{
+    lapack_error_if( num_threads < 1 );
+
+    #if defined( LAPACK_THREADS_OPENBLAS ) || defined( LAPACK_THREADS_BLIS )
+        std::lock_guard< std::mutex > lock( global_mutex );
+        // Inside scopes, becomes the count restored by the last scope.
+        if (! global_scopes.empty())
+            global_saved = num_threads;
+    #endif
+    #ifdef LAPACK_THREADS_VENDOR
+        vendor_set_num_threads( num_threads );
+    #endif
+    omp_set_num_threads_( num_threads );
+}
+
+//------------------------------------------------------------------------------
+ThreadScope::ThreadScope( int num_threads )
+    : num_threads_( num_threads )
+{
+    lapack_error_if( num_threads < 1 );
+
+    saved_omp_ = omp_get_num_threads_();
+    omp_set_num_threads_( num_threads );
+
+    #if defined( LAPACK_THREADS_MKL )
+        // Thread-local; returns the previous local setting, 0 if unset.
+        saved_blas_ = MKL_Set_Num_Threads_Local( num_threads );
+    #elif defined( LAPACK_THREADS_OPENBLAS ) || defined( LAPACK_THREADS_BLIS )
+        std::lock_guard< std::mutex > lock( global_mutex );
+        saved_blas_ = vendor_get_num_threads();
+        if (global_scopes.empty())
+            global_saved = saved_blas_;
+        global_scopes.push_back( this );
+        vendor_set_num_threads( num_threads );
+    #else
+        saved_blas_ = 0;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+ThreadScope::~ThreadScope()
+{
+    #if defined( LAPACK_THREADS_MKL )
+        MKL_Set_Num_Threads_Local( saved_blas_ );
+    #elif defined( LAPACK_THREADS_OPENBLAS ) || defined( LAPACK_THREADS_BLIS )
+        std::lock_guard< std::mutex > lock( global_mutex );
+        // Restore the count of the newest remaining scope, which for
+        // nested scopes is the enclosing one, even if scopes on different
+        // threads end out of order. The last scope restores the count
+        // from before any scope.
+        global_scopes.erase( std::find( global_scopes.begin(),
+                                        global_scopes.end(), this ) );
+        vendor_set_num_threads( global_scopes.empty()
+                                ? global_saved
+                                : global_scopes.back()->num_threads_ );
+    #endif
+
+    omp_set_num_threads_( saved_omp_ );
+}
+
+}  // namespace lapack
@@ -34,6 +34,7 @@ int64_t tplqt(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int ldt_ = to_lapack_int( ldt );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tplqt", float, m, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (mb*m) );
@@ -66,6 +67,7 @@ int64_t tplqt(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int ldt_ = to_lapack_int( ldt );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tplqt", double, m, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (mb*m) );
@@ -98,6 +100,7 @@ int64_t tplqt(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int ldt_ = to_lapack_int( ldt );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tplqt", std::complex<float>, m, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<float> > work( (mb*m) );
@@ -226,6 +229,7 @@ int64_t tplqt(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int ldt_ = to_lapack_int( ldt );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tplqt", std::complex<double>, m, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (mb*m) );
@@ -32,6 +32,7 @@ int64_t tplqt2(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int ldt_ = to_lapack_int( ldt );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tplqt2", float, m, n, 0, 0, info_ );
 
     LAPACK_stplqt2(
         &m_, &n_, &l_,
@@ -59,6 +60,7 @@ int64_t tplqt2(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int ldt_ = to_lapack_int( ldt );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tplqt2", double, m, n, 0, 0, info_ );
 
     LAPACK_dtplqt2(
         &m_, &n_, &l_,
@@ -86,6 +88,7 @@ int64_t tplqt2(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int ldt_ = to_lapack_int( ldt );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tplqt2", std::complex<float>, m, n, 0, 0, info_ );
 
     LAPACK_ctplqt2(
         &m_, &n_, &l_,
@@ -202,6 +205,7 @@ int64_t tplqt2(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int ldt_ = to_lapack_int( ldt );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tplqt2", std::complex<double>, m, n, 0, 0, info_ );
 
     LAPACK_ztplqt2(
         &m_, &n_, &l_,
@@ -43,6 +43,7 @@ int64_t tpmlqt(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tpmlqt", float, m, n, k, 0, info_ );
 
     // allocate workspace
     int64_t lwork = (side == Side::Left ? n*mb : m*mb);
@@ -87,6 +88,7 @@ int64_t tpmlqt(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tpmlqt", double, m, n, k, 0, info_ );
 
     // allocate workspace
     int64_t lwork = (side == Side::Left ? n*mb : m*mb);
@@ -127,6 +129,7 @@ int64_t tpmlqt(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tpmlqt", std::complex<float>, m, n, k, 0, info_ );
 
     // allocate workspace
     int64_t lwork = (side == Side::Left ? n*mb : m*mb);
@@ -282,6 +285,7 @@ int64_t tpmlqt(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tpmlqt", std::complex<double>, m, n, k, 0, info_ );
 
     // allocate workspace
     int64_t lwork = (side == Side::Left ? n*mb : m*mb);
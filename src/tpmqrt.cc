@@ -43,6 +43,7 @@ int64_t tpmqrt(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tpmqrt", float, m, n, k, 0, info_ );
 
     // allocate workspace
     int64_t lwork = (side == Side::Left ? n*nb : m*nb);
@@ -87,6 +88,7 @@ int64_t tpmqrt(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tpmqrt", double, m, n, k, 0, info_ );
 
     // allocate workspace
     int64_t lwork = (side == Side::Left ? n*nb : m*nb);
@@ -127,6 +129,7 @@ int64_t tpmqrt(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tpmqrt", std::complex<float>, m, n, k, 0, info_ );
 
     // allocate workspace
     int64_t lwork = (side == Side::Left ? n*nb : m*nb);
@@ -285,6 +288,7 @@ int64_t tpmqrt(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tpmqrt", std::complex<double>, m, n, k, 0, info_ );
 
     // allocate workspace
     int64_t lwork = (side == Side::Left ? n*nb : m*nb);
@@ -34,6 +34,7 @@ int64_t tpqrt(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int ldt_ = to_lapack_int( ldt );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tpqrt", float, m, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (nb*n) );
@@ -66,6 +67,7 @@ int64_t tpqrt(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int ldt_ = to_lapack_int( ldt );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tpqrt", double, m, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (nb*n) );
@@ -98,6 +100,7 @@ int64_t tpqrt(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int ldt_ = to_lapack_int( ldt );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tpqrt", std::complex<float>, m, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<float> > work( (nb*n) );
@@ -130,6 +133,7 @@ int64_t tpqrt(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int ldt_ = to_lapack_int( ldt );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tpqrt", std::complex<double>, m, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (nb*n) );
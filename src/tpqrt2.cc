@@ -32,6 +32,7 @@ int64_t tpqrt2(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int ldt_ = to_lapack_int( ldt );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tpqrt2", float, m, n, 0, 0, info_ );
 
     LAPACK_stpqrt2(
         &m_, &n_, &l_,
@@ -59,6 +60,7 @@ int64_t tpqrt2(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int ldt_ = to_lapack_int( ldt );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tpqrt2", double, m, n, 0, 0, info_ );
 
     LAPACK_dtpqrt2(
         &m_, &n_, &l_,
@@ -86,6 +88,7 @@ int64_t tpqrt2(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int ldt_ = to_lapack_int( ldt );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tpqrt2", std::complex<float>, m, n, 0, 0, info_ );
 
     LAPACK_ctpqrt2(
         &m_, &n_, &l_,
@@ -113,6 +116,7 @@ int64_t tpqrt2(
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int ldt_ = to_lapack_int( ldt );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tpqrt2", std::complex<double>, m, n, 0, 0, info_ );
 
     LAPACK_ztpqrt2(
         &m_, &n_, &l_,
@@ -24,6 +24,7 @@ int64_t tptri(
     char diag_ = to_char( diag );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tptri", float, 0, n, 0, 0, info_ );
 
     LAPACK_stptri(
         &uplo_, &diag_, &n_,
@@ -44,6 +45,7 @@ int64_t tptri(
     char diag_ = to_char( diag );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tptri", double, 0, n, 0, 0, info_ );
 
     LAPACK_dtptri(
         &uplo_, &diag_, &n_,
@@ -64,6 +66,7 @@ int64_t tptri(
     char diag_ = to_char( diag );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tptri", std::complex<float>, 0, n, 0, 0, info_ );
 
     LAPACK_ctptri(
         &uplo_, &diag_, &n_,
@@ -84,6 +87,7 @@ int64_t tptri(
     char diag_ = to_char( diag );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tptri", std::complex<double>, 0, n, 0, 0, info_ );
 
     LAPACK_ztptri(
         &uplo_, &diag_, &n_,
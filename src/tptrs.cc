@@ -28,6 +28,7 @@ int64_t tptrs(
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tptrs", float, 0, n, 0, nrhs, info_ );
 
     LAPACK_stptrs(
         &uplo_, &trans_, &diag_, &n_, &nrhs_,
@@ -53,6 +54,7 @@ int64_t tptrs(
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tptrs", double, 0, n, 0, nrhs, info_ );
 
     LAPACK_dtptrs(
         &uplo_, &trans_, &diag_, &n_, &nrhs_,
@@ -78,6 +80,7 @@ int64_t tptrs(
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tptrs", std::complex<float>, 0, n, 0, nrhs, info_ );
 
     LAPACK_ctptrs(
         &uplo_, &trans_, &diag_, &n_, &nrhs_,
@@ -103,6 +106,7 @@ int64_t tptrs(
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tptrs", std::complex<double>, 0, n, 0, nrhs, info_ );
 
     LAPACK_ztptrs(
         &uplo_, &trans_, &diag_, &n_, &nrhs_,
@@ -25,6 +25,7 @@ int64_t tpttf(
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tpttf", float, 0, n, 0, 0, info_ );
 
     LAPACK_stpttf(
         &transr_, &uplo_, &n_,
@@ -47,6 +48,7 @@ int64_t tpttf(
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tpttf", double, 0, n, 0, 0, info_ );
 
     LAPACK_dtpttf(
         &transr_, &uplo_, &n_,
@@ -69,6 +71,7 @@ int64_t tpttf(
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tpttf", std::complex<float>, 0, n, 0, 0, info_ );
 
     LAPACK_ctpttf(
         &transr_, &uplo_, &n_,
@@ -91,6 +94,7 @@ int64_t tpttf(
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tpttf", std::complex<double>, 0, n, 0, 0, info_ );
 
     LAPACK_ztpttf(
         &transr_, &uplo_, &n_,
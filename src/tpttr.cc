@@ -25,6 +25,7 @@ int64_t tpttr(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tpttr", float, 0, n, 0, 0, info_ );
 
     LAPACK_stpttr(
         &uplo_, &n_,
@@ -47,6 +48,7 @@ int64_t tpttr(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tpttr", double, 0, n, 0, 0, info_ );
 
     LAPACK_dtpttr(
         &uplo_, &n_,
@@ -69,6 +71,7 @@ int64_t tpttr(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tpttr", std::complex<float>, 0, n, 0, 0, info_ );
 
     LAPACK_ctpttr(
         &uplo_, &n_,
@@ -91,6 +94,7 @@ int64_t tpttr(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "tpttr", std::complex<double>, 0, n, 0, 0, info_ );
 
     LAPACK_ztpttr(
         &uplo_, &n_,
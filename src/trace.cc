@@ -0,0 +1,400 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/trace.hh"
+#include "lapack/flops.hh"
+#include "lapack/util.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+
+namespace lapack {
+namespace trace {
+
+namespace {
+
+//------------------------------------------------------------------------------
+// Routines with a flop count in lapack::Gflop. Real orgqr, etc., are
+// listed since the real wrappers are named orgqr; the formulas are the same.
+enum class Flop {
+    unknown,
+    gesv, getrf, getri, getrs, posv, potrf, potri, potrs, pbsv, pbtrf,
+    pbtrs, sysv, sytrf, sytri, sytrs, hesv, hetrf, hetri, hetrs, geqrf,
+    geqrt, geqlf, gerqf, gelqf, ungqr, orgqr, ungql, orgql, ungrq, orgrq,
+    unglq, orglq, gels, trtri, gehrd, hetrd, sytrd, gebrd, lauum,
+};
+
+const struct {
+    const char* routine;
+    Flop id;
+} flop_routines[] = {
+    { "gesv",  Flop::gesv },
+    { "getrf", Flop::getrf },
+    { "getri", Flop::getri },
+    { "getrs", Flop::getrs },
+    { "posv",  Flop::posv },
+    { "potrf", Flop::potrf },
+    { "potri", Flop::potri },
+    { "potrs", Flop::potrs },
+    { "pbsv",  Flop::pbsv },
+    { "pbtrf", Flop::pbtrf },
+    { "pbtrs", Flop::pbtrs },
+    { "sysv",  Flop::sysv },
+    { "sytrf", Flop::sytrf },
+    { "sytri", Flop::sytri },
+    { "sytrs", Flop::sytrs },
+    { "hesv",  Flop::hesv },
+    { "hetrf", Flop::hetrf },
+    { "hetri", Flop::hetri },
+    { "hetrs", Flop::hetrs },
+    { "geqrf", Flop::geqrf },
+    { "geqrt", Flop::geqrt },
+    { "geqlf", Flop::geqlf },
+    { "gerqf", Flop::gerqf },
+    { "gelqf", Flop::gelqf },
+    { "ungqr", Flop::ungqr },
+    { "orgqr", Flop::orgqr },
+    { "ungql", Flop::ungql },
+    { "orgql", Flop::orgql },
+    { "ungrq", Flop::ungrq },
+    { "orgrq", Flop::orgrq },
+    { "unglq", Flop::unglq },
+    { "orglq", Flop::orglq },
+    { "gels",  Flop::gels },
+    { "trtri", Flop::trtri },
+    { "gehrd", Flop::gehrd },
+    { "hetrd", Flop::hetrd },
+    { "sytrd", Flop::sytrd },
+    { "gebrd", Flop::gebrd },
+    { "lauum", Flop::lauum },
+};
+
+//------------------------------------------------------------------------------
+// @return Gflop for event e of routine id; dimensions are as traced,
+// e.g., k holds kd for the band routines.
+template <typename scalar_t>
+double gflop( Flop id, Event const& e )
+{
+    using G = lapack::Gflop< scalar_t >;
+    double m = e.m, n = e.n, k = e.k, nrhs = e.nrhs;
+    switch (id) {
+        case Flop::gesv:   return G::gesv( n, nrhs );
+        case Flop::getrf:  return G::getrf( m, n );
+        case Flop::getri:  return G::getri( n );
+        case Flop::getrs:  return G::getrs( n, nrhs );
+        case Flop::posv:   return G::posv( n, nrhs );
+        case Flop::potrf:  return G::potrf( n );
+        case Flop::potri:  return G::potri( n );
+        case Flop::potrs:  return G::potrs( n, nrhs );
+        case Flop::pbsv:   return G::pbsv( n, nrhs, k );
+        case Flop::pbtrf:  return G::pbtrf( n, k );
+        case Flop::pbtrs:  return G::pbtrs( n, nrhs, k );
+        case Flop::sysv:   return G::sysv( n, nrhs );
+        case Flop::sytrf:  return G::sytrf( n );
+        case Flop::sytri:  return G::sytri( n );
+        case Flop::sytrs:  return G::sytrs( n, nrhs );
+        case Flop::hesv:   return G::hesv( n, nrhs );
+        case Flop::hetrf:  return G::hetrf( n );
+        case Flop::hetri:  return G::hetri( n );
+        case Flop::hetrs:  return G::hetrs( n, nrhs );
+        case Flop::geqrf:  return G::geqrf( m, n );
+        case Flop::geqrt:  return G::geqrt( m, n );
+        case Flop::geqlf:  return G::geqlf( m, n );
+        case Flop::gerqf:  return G::gerqf( m, n );
+        case Flop::gelqf:  return G::gelqf( m, n );
+        case Flop::ungqr:  return G::ungqr( m, n, k );
+        case Flop::orgqr:  return G::orgqr( m, n, k );
+        case Flop::ungql:  return G::ungql( m, n, k );
+        case Flop::orgql:  return G::orgql( m, n, k );
+        case Flop::ungrq:  return G::ungrq( m, n, k );
+        case Flop::orgrq:  return G::orgrq( m, n, k );
+        case Flop::unglq:  return G::unglq( m, n, k );
+        case Flop::orglq:  return G::orglq( m, n, k );
+        case Flop::gels:   return G::gels( m, n, nrhs );
+        case Flop::trtri:  return G::trtri( n );
+        case Flop::gehrd:  return G::gehrd( n );
+        case Flop::hetrd:  return G::hetrd( n );
+        case Flop::sytrd:  return G::sytrd( n );
+        case Flop::gebrd:  return G::gebrd( m, n );
+        case Flop::lauum:  return G::lauum( n );
+        case Flop::unknown: return 0;
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+// Ring buffer of one thread's events. Only the owning thread writes;
+// head counts events ever written, so event i is in slot i % size.
+// Readers copy slots, then re-read head to skip any that were
+// overwritten meanwhile, or are being overwritten by the event in
+// flight, which goes to slot head % slots before head advances. Hence
+// it has one more slot than buffer_size, for the event in flight.
+struct Ring
+{
+    Ring( int64_t size, int thread_ )
+        : events( size + 1 ),
+          thread( thread_ )
+    {}
+
+    std::vector< Event > events;
+    std::atomic< uint64_t > head { 0 };
+    std::atomic< uint64_t > tail { 0 };     ///< events before tail are cleared
+    int thread;
+};
+
+//------------------------------------------------------------------------------
+// Global state. The mutex is taken only when a thread creates its
+// buffer, and when collecting or clearing events; the callback is
+// read and set atomically.
+struct State
+{
+    std::atomic< bool > enabled { true };
+    std::atomic< int64_t > buffer_size { 4096 };
+    std::atomic< bool > has_callback { false };
+
+    std::mutex mutex;
+    std::vector< std::shared_ptr< Ring > > rings;
+    int num_threads = 0;
+    std::shared_ptr< Callback > callback;
+
+    std::chrono::steady_clock::time_point epoch
+        = std::chrono::steady_clock::now();
+};
+
+State& state()
+{
+    static State state_;
+    return state_;
+}
+
+// Initialize the epoch when the library is loaded, not at first event.
+const State& init_state_ = state();
+
+//------------------------------------------------------------------------------
+// @return this thread's ring buffer, creating it on first use or if the
+// buffer size has changed.
+Ring& thread_ring()
+{
+    thread_local std::shared_ptr< Ring > ring;
+    auto& s = state();
+    int64_t size = s.buffer_size.load( std::memory_order_relaxed );
+    if (ring == nullptr || int64_t( ring->events.size() ) != size + 1) {
+        std::lock_guard< std::mutex > lock( s.mutex );
+        int thread = (ring ? ring->thread : s.num_threads++);
+        ring = std::make_shared< Ring >( size, thread );
+        s.rings.push_back( ring );
+    }
+    return *ring;
+}
+
+//------------------------------------------------------------------------------
+// Writes a JSON number using printf format; non-finite values, which
+// JSON lacks, are 0.
+void write_number( std::ostream& os, const char* format, double x )
+{
+    char buf[ 32 ];
+    snprintf( buf, sizeof( buf ), format, std::isfinite( x ) ? x : 0. );
+    os << buf;
+}
+
+} // namespace
+
+//------------------------------------------------------------------------------
+void set_enabled( bool enabled )
+{
+    state().enabled.store( enabled );
+}
+
+//------------------------------------------------------------------------------
+bool enabled()
+{
+    return compiled() && state().enabled.load( std::memory_order_relaxed );
+}
+
+//------------------------------------------------------------------------------
+void set_callback( Callback callback )
+{
+    auto& s = state();
+    std::shared_ptr< Callback > ptr;
+    if (callback)
+        ptr = std::make_shared< Callback >( std::move( callback ) );
+
+    std::atomic_store( &s.callback, ptr );
+    s.has_callback.store( ptr != nullptr );
+}
+
+//------------------------------------------------------------------------------
+void set_buffer_size( int64_t size )
+{
+    lapack_error_if( size < 1 );
+    state().buffer_size.store( size );
+}
+
+//------------------------------------------------------------------------------
+int64_t buffer_size()
+{
+    return state().buffer_size.load();
+}
+
+//------------------------------------------------------------------------------
+std::vector< Event > events()
+{
+    auto& s = state();
+    std::vector< Event > list;
+    std::lock_guard< std::mutex > lock( s.mutex );
+    for (auto& ring : s.rings) {
+        uint64_t slots = ring->events.size();
+        uint64_t head = ring->head.load( std::memory_order_acquire );
+        uint64_t tail = ring->tail.load();
+        uint64_t begin = std::max( tail, head + 1 > slots ? head + 1 - slots : 0 );
+        size_t first = list.size();
+        for (uint64_t i = begin; i < head; ++i)
+            list.push_back( ring->events[ i % slots ] );
+
+        // Skip events the thread overwrote while they were copied,
+        // including event head2 + 1 - slots, whose slot the event in flight
+        // may be writing. The fence pairs with the one in record, so
+        // head2 is current for any slot written after the copy began.
+        std::atomic_thread_fence( std::memory_order_acquire );
+        uint64_t head2 = ring->head.load( std::memory_order_relaxed );
+        uint64_t valid = (head2 + 1 > slots ? head2 + 1 - slots : 0);
+        if (valid > begin) {
+            size_t skip = std::min( valid - begin, head - begin );
+            list.erase( list.begin() + first, list.begin() + first + skip );
+        }
+    }
+    std::stable_sort( list.begin(), list.end(),
+                      []( Event const& a, Event const& b ) {
+                          return a.start < b.start;
+                      } );
+    return list;
+}
+
+//------------------------------------------------------------------------------
+void clear()
+{
+    auto& s = state();
+    std::lock_guard< std::mutex > lock( s.mutex );
+    for (auto& ring : s.rings)
+        ring->tail.store( ring->head.load() );
+
+    // Drop buffers no longer owned by a thread.
+    s.rings.erase(
+        std::remove_if( s.rings.begin(), s.rings.end(),
+                        []( std::shared_ptr< Ring > const& ring ) {
+                            return ring.use_count() == 1;
+                        } ),
+        s.rings.end() );
+}
+
+//------------------------------------------------------------------------------
+void write_chrome_json( std::ostream& os )
+{
+    std::vector< Event > list = events();
+    os << "{\"traceEvents\": [";
+    const char* sep = "\n";
+    for (auto const& e : list) {
+        // Chrome trace times are in microseconds.
+        os << sep
+           << "{\"name\": \"" << e.precision << e.routine << "\""
+           << ", \"cat\": \"lapack\", \"ph\": \"X\", \"pid\": 0"
+           << ", \"tid\": " << e.thread
+           << ", \"ts\": ";
+        write_number( os, "%.3f", e.start * 1e6 );
+        os << ", \"dur\": ";
+        write_number( os, "%.3f", e.time * 1e6 );
+        os << ", \"args\": {"
+           << "\"m\": " << e.m << ", \"n\": " << e.n
+           << ", \"k\": " << e.k << ", \"nrhs\": " << e.nrhs
+           << ", \"info\": " << e.info
+           << ", \"gflop\": ";
+        write_number( os, "%.6g", e.gflop );
+        os << ", \"gflops\": ";
+        write_number( os, "%.6g", e.time > 0 ? e.gflop / e.time : 0 );
+        os << "}}";
+        sep = ",\n";
+    }
+    os << "\n], \"displayTimeUnit\": \"ms\"}\n";
+}
+
+//------------------------------------------------------------------------------
+void write_chrome_json( std::string const& filename )
+{
+    std::ofstream file( filename );
+    lapack_error_if_msg( ! file, "cannot open %s", filename.c_str() );
+    write_chrome_json( file );
+    file.close();
+    lapack_error_if_msg( ! file, "cannot write %s", filename.c_str() );
+}
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// @return flop_id for routine, for use in record; 0 if it has no
+/// flop count. Called once per wrapper, to initialize a static.
+int flop_id( char const* routine )
+{
+    for (auto const& entry : flop_routines) {
+        if (std::strcmp( routine, entry.routine ) == 0)
+            return int( entry.id );
+    }
+    return int( Flop::unknown );
+}
+
+//------------------------------------------------------------------------------
+/// @return seconds since the library was loaded.
+double now()
+{
+    auto elapsed = std::chrono::steady_clock::now() - state().epoch;
+    return std::chrono::duration< double >( elapsed ).count();
+}
+
+//------------------------------------------------------------------------------
+/// Fills in the event's flop count and thread, adds it to this thread's
+/// ring buffer, and calls the callback, if any.
+void record( Event& event, int flop_id ) noexcept
+{
+    try {
+        Flop id = Flop( flop_id );
+        switch (event.precision) {
+            case 's': event.gflop = gflop< float  >( id, event ); break;
+            case 'd': event.gflop = gflop< double >( id, event ); break;
+            case 'c': event.gflop = gflop< std::complex<float>  >( id, event ); break;
+            case 'z': event.gflop = gflop< std::complex<double> >( id, event ); break;
+            default:  event.gflop = 0; break;
+        }
+
+        Ring& ring = thread_ring();
+        event.thread = ring.thread;
+        uint64_t head = ring.head.load( std::memory_order_relaxed );
+        // Orders the previous head store before writing the slot; see events.
+        std::atomic_thread_fence( std::memory_order_release );
+        ring.events[ head % ring.events.size() ] = event;
+        ring.head.store( head + 1, std::memory_order_release );
+
+        auto& s = state();
+        if (s.has_callback.load( std::memory_order_relaxed )) {
+            std::shared_ptr< Callback > callback = std::atomic_load( &s.callback );
+            if (callback)
+                (*callback)( event );
+        }
+    }
+    catch (...) {
+        // Tracing must not change the wrapper's behavior; drop the event.
+    }
+}
+
+} // namespace internal
+
+} // namespace trace
+} // namespace lapack
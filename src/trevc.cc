@@ -40,6 +40,7 @@ int64_t trevc(
     lapack_int mm_ = to_lapack_int( mm );
     lapack_int nfound_ = 0;  // out
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "trevc", float, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (3*n) );
@@ -85,6 +86,7 @@ int64_t trevc(
     lapack_int mm_ = to_lapack_int( mm );
     lapack_int nfound_ = 0;  // out
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "trevc", double, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (3*n) );
@@ -130,6 +132,7 @@ int64_t trevc(
     lapack_int mm_ = to_lapack_int( mm );
     lapack_int nfound_ = 0;  // out
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "trevc", std::complex<float>, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
@@ -297,6 +300,7 @@ int64_t trevc(
     lapack_int mm_ = to_lapack_int( mm );
     lapack_int nfound_ = 0;  // out
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "trevc", std::complex<double>, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
@@ -29,55 +29,18 @@ int64_t trevc3(
     float* VR, int64_t ldvr, int64_t mm,
     int64_t* nfound )
 {
-    char sides_ = to_char( sides );
-    char howmany_ = to_char( howmany );
-
-    // lapack_logical (32 or 64-bit) copy
-    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
-    lapack_logical* select_ptr = &select_[0];
-
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int ldt_ = to_lapack_int( ldt );
-    lapack_int ldvl_ = to_lapack_int( ldvl );
-    lapack_int ldvr_ = to_lapack_int( ldvr );
-    lapack_int mm_ = to_lapack_int( mm );
-    lapack_int nfound_ = 0;  // out
-    lapack_int info_ = 0;
-
     // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_strevc3(
-        &sides_, &howmany_,
-        select_ptr, &n_,
-        T, &ldt_,
-        VL, &ldvl_,
-        VR, &ldvr_, &mm_, &nfound_,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork;
+    trevc3_work_size(
+        sides, howmany, select, n, T, ldt, VL, ldvl, VR, ldvr, mm, nfound,
+        &lwork );
 
     // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    lapack::vector< float > work( lwork );
 
-    LAPACK_strevc3(
-        &sides_, &howmany_,
-        select_ptr, &n_,
-        T, &ldt_,
-        VL, &ldvl_,
-        VR, &ldvr_, &mm_, &nfound_,
-        &work[0], &lwork_, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    // [sd]trevc update select
-    std::copy( select_.begin(), select_.end(), select );
-    *nfound = nfound_;
-    return info_;
+    return trevc3(
+        sides, howmany, select, n, T, ldt, VL, ldvl, VR, ldvr, mm, nfound,
+        &work[0], lwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -90,55 +53,18 @@ int64_t trevc3(
     double* VR, int64_t ldvr, int64_t mm,
     int64_t* nfound )
 {
-    char sides_ = to_char( sides );
-    char howmany_ = to_char( howmany );
-
-    // lapack_logical (32 or 64-bit) copy
-    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
-    lapack_logical* select_ptr = &select_[0];
-
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int ldt_ = to_lapack_int( ldt );
-    lapack_int ldvl_ = to_lapack_int( ldvl );
-    lapack_int ldvr_ = to_lapack_int( ldvr );
-    lapack_int mm_ = to_lapack_int( mm );
-    lapack_int nfound_ = 0;  // out
-    lapack_int info_ = 0;
-
     // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dtrevc3(
-        &sides_, &howmany_,
-        select_ptr, &n_,
-        T, &ldt_,
-        VL, &ldvl_,
-        VR, &ldvr_, &mm_, &nfound_,
-        qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork;
+    trevc3_work_size(
+        sides, howmany, select, n, T, ldt, VL, ldvl, VR, ldvr, mm, nfound,
+        &lwork );
 
     // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    lapack::vector< double > work( lwork );
 
-    LAPACK_dtrevc3(
-        &sides_, &howmany_,
-        select_ptr, &n_,
-        T, &ldt_,
-        VL, &ldvl_,
-        VR, &ldvr_, &mm_, &nfound_,
-        &work[0], &lwork_, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    // [sd]trevc update select
-    std::copy( select_.begin(), select_.end(), select );
-    *nfound = nfound_;
-    return info_;
+    return trevc3(
+        sides, howmany, select, n, T, ldt, VL, ldvl, VR, ldvr, mm, nfound,
+        &work[0], lwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -151,58 +77,19 @@ int64_t trevc3(
     std::complex<float>* VR, int64_t ldvr, int64_t mm,
     int64_t* nfound )
 {
-    char sides_ = to_char( sides );
-    char howmany_ = to_char( howmany );
-
-    // lapack_logical (32 or 64-bit) copy
-    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
-    lapack_logical const* select_ptr = &select_[0];
-
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int ldt_ = to_lapack_int( ldt );
-    lapack_int ldvl_ = to_lapack_int( ldvl );
-    lapack_int ldvr_ = to_lapack_int( ldvr );
-    lapack_int mm_ = to_lapack_int( mm );
-    lapack_int nfound_ = 0;  // out
-    lapack_int info_ = 0;
-
     // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_ctrevc3(
-        &sides_, &howmany_,
-        select_ptr, &n_,
-        (lapack_complex_float*) T, &ldt_,
-        (lapack_complex_float*) VL, &ldvl_,
-        (lapack_complex_float*) VR, &ldvr_, &mm_, &nfound_,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = real(qry_rwork[0]);
+    int64_t lwork, lrwork;
+    trevc3_work_size(
+        sides, howmany, select, n, T, ldt, VL, ldvl, VR, ldvr, mm, nfound,
+        &lwork, &lrwork );
 
     // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( lrwork_ );
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
 
-    LAPACK_ctrevc3(
-        &sides_, &howmany_,
-        select_ptr, &n_,
-        (lapack_complex_float*) T, &ldt_,
-        (lapack_complex_float*) VL, &ldvl_,
-        (lapack_complex_float*) VR, &ldvr_, &mm_, &nfound_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0], &lrwork_, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *nfound = nfound_;
-    return info_;
+    return trevc3(
+        sides, howmany, select, n, T, ldt, VL, ldvl, VR, ldvr, mm, nfound,
+        &work[0], lwork, &rwork[0], lrwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -339,6 +226,198 @@ int64_t trevc3(
     std::complex<double>* VR, int64_t ldvr, int64_t mm,
     int64_t* nfound )
 {
+    // query for workspace size
+    int64_t lwork, lrwork;
+    trevc3_work_size(
+        sides, howmany, select, n, T, ldt, VL, ldvl, VR, ldvr, mm, nfound,
+        &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+
+    return trevc3(
+        sides, howmany, select, n, T, ldt, VL, ldvl, VR, ldvr, mm, nfound,
+        &work[0], lwork, &rwork[0], lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+void trevc3_work_size(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool* select, int64_t n,
+    float const* T, int64_t ldt,
+    float* VL, int64_t ldvl,
+    float* VR, int64_t ldvr, int64_t mm,
+    int64_t* nfound,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "strevc3", sides, howmany, n, ldt, ldvl, ldvr, mm );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    char sides_ = to_char( sides );
+    char howmany_ = to_char( howmany );
+
+    // lapack_logical (32 or 64-bit) copy
+    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
+    lapack_logical* select_ptr = &select_[0];
+
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ldt_ = to_lapack_int( ldt );
+    lapack_int ldvl_ = to_lapack_int( ldvl );
+    lapack_int ldvr_ = to_lapack_int( ldvr );
+    lapack_int mm_ = to_lapack_int( mm );
+    lapack_int nfound_ = 0;  // out
+    lapack_int info_ = 0;
+
+    float qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_strevc3(
+        &sides_, &howmany_,
+        select_ptr, &n_,
+        T, &ldt_,
+        VL, &ldvl_,
+        VR, &ldvr_, &mm_, &nfound_,
+        qry_work, &ineg_one, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+void trevc3_work_size(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool* select, int64_t n,
+    double const* T, int64_t ldt,
+    double* VL, int64_t ldvl,
+    double* VR, int64_t ldvr, int64_t mm,
+    int64_t* nfound,
+    int64_t* lwork )
+{
+    auto key = internal::work_size_key(
+        "dtrevc3", sides, howmany, n, ldt, ldvl, ldvr, mm );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    char sides_ = to_char( sides );
+    char howmany_ = to_char( howmany );
+
+    // lapack_logical (32 or 64-bit) copy
+    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
+    lapack_logical* select_ptr = &select_[0];
+
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ldt_ = to_lapack_int( ldt );
+    lapack_int ldvl_ = to_lapack_int( ldvl );
+    lapack_int ldvr_ = to_lapack_int( ldvr );
+    lapack_int mm_ = to_lapack_int( mm );
+    lapack_int nfound_ = 0;  // out
+    lapack_int info_ = 0;
+
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dtrevc3(
+        &sides_, &howmany_,
+        select_ptr, &n_,
+        T, &ldt_,
+        VL, &ldvl_,
+        VR, &ldvr_, &mm_, &nfound_,
+        qry_work, &ineg_one, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+void trevc3_work_size(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool const* select, int64_t n,
+    std::complex<float>* T, int64_t ldt,
+    std::complex<float>* VL, int64_t ldvl,
+    std::complex<float>* VR, int64_t ldvr, int64_t mm,
+    int64_t* nfound,
+    int64_t* lwork, int64_t* lrwork )
+{
+    auto key = internal::work_size_key(
+        "ctrevc3", sides, howmany, n, ldt, ldvl, ldvr, mm );
+    if (internal::work_size_cache_find( key, lwork, lrwork ))
+        return;
+
+    char sides_ = to_char( sides );
+    char howmany_ = to_char( howmany );
+
+    // lapack_logical (32 or 64-bit) copy
+    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
+    lapack_logical const* select_ptr = &select_[0];
+
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ldt_ = to_lapack_int( ldt );
+    lapack_int ldvl_ = to_lapack_int( ldvl );
+    lapack_int ldvr_ = to_lapack_int( ldvr );
+    lapack_int mm_ = to_lapack_int( mm );
+    lapack_int nfound_ = 0;  // out
+    lapack_int info_ = 0;
+
+    std::complex<float> qry_work[1];
+    float qry_rwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_ctrevc3(
+        &sides_, &howmany_,
+        select_ptr, &n_,
+        (lapack_complex_float*) T, &ldt_,
+        (lapack_complex_float*) VL, &ldvl_,
+        (lapack_complex_float*) VR, &ldvr_, &mm_, &nfound_,
+        (lapack_complex_float*) qry_work, &ineg_one,
+        qry_rwork, &ineg_one, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    *lrwork = real(qry_rwork[0]);
+    internal::work_size_cache_insert( key, *lwork, *lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::trevc3 with caller-provided workspace.
+/// Returns the array lengths that the workspace overload of `trevc3`
+/// requires, so the workspace can be allocated once, outside a loop.
+///
+/// Other arguments are the same as for lapack::trevc3.
+/// Arrays other than select are used only to select the precision
+/// and are not referenced.
+///
+/// @param[out] lwork
+///     The optimal length of the array work.
+///
+/// @param[out] lrwork
+///     The optimal length of the array rwork.
+///
+/// @ingroup geev_computational
+void trevc3_work_size(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool const* select, int64_t n,
+    std::complex<double>* T, int64_t ldt,
+    std::complex<double>* VL, int64_t ldvl,
+    std::complex<double>* VR, int64_t ldvr, int64_t mm,
+    int64_t* nfound,
+    int64_t* lwork, int64_t* lrwork )
+{
+    auto key = internal::work_size_key(
+        "ztrevc3", sides, howmany, n, ldt, ldvl, ldvr, mm );
+    if (internal::work_size_cache_find( key, lwork, lrwork ))
+        return;
+
     char sides_ = to_char( sides );
     char howmany_ = to_char( howmany );
 
@@ -354,7 +433,6 @@ int64_t trevc3(
     lapack_int nfound_ = 0;  // out
     lapack_int info_ = 0;
 
-    // query for workspace size
     std::complex<double> qry_work[1];
     double qry_rwork[1];
     lapack_int ineg_one = -1;
@@ -370,12 +448,196 @@ int64_t trevc3(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = real(qry_rwork[0]);
+    *lwork = real(qry_work[0]);
+    *lrwork = real(qry_rwork[0]);
+    internal::work_size_cache_insert( key, *lwork, *lrwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( lrwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+int64_t trevc3(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool* select, int64_t n,
+    float const* T, int64_t ldt,
+    float* VL, int64_t ldvl,
+    float* VR, int64_t ldvr, int64_t mm,
+    int64_t* nfound,
+    float* work, int64_t lwork )
+{
+    char sides_ = to_char( sides );
+    char howmany_ = to_char( howmany );
+
+    // lapack_logical (32 or 64-bit) copy
+    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
+    lapack_logical* select_ptr = &select_[0];
+
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ldt_ = to_lapack_int( ldt );
+    lapack_int ldvl_ = to_lapack_int( ldvl );
+    lapack_int ldvr_ = to_lapack_int( ldvr );
+    lapack_int mm_ = to_lapack_int( mm );
+    lapack_int nfound_ = 0;  // out
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "trevc3", float, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+
+    LAPACK_strevc3(
+        &sides_, &howmany_,
+        select_ptr, &n_,
+        T, &ldt_,
+        VL, &ldvl_,
+        VR, &ldvr_, &mm_, &nfound_,
+        work, &lwork_, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    // [sd]trevc update select
+    std::copy( select_.begin(), select_.end(), select );
+    *nfound = nfound_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+int64_t trevc3(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool* select, int64_t n,
+    double const* T, int64_t ldt,
+    double* VL, int64_t ldvl,
+    double* VR, int64_t ldvr, int64_t mm,
+    int64_t* nfound,
+    double* work, int64_t lwork )
+{
+    char sides_ = to_char( sides );
+    char howmany_ = to_char( howmany );
+
+    // lapack_logical (32 or 64-bit) copy
+    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
+    lapack_logical* select_ptr = &select_[0];
+
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ldt_ = to_lapack_int( ldt );
+    lapack_int ldvl_ = to_lapack_int( ldvl );
+    lapack_int ldvr_ = to_lapack_int( ldvr );
+    lapack_int mm_ = to_lapack_int( mm );
+    lapack_int nfound_ = 0;  // out
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "trevc3", double, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+
+    LAPACK_dtrevc3(
+        &sides_, &howmany_,
+        select_ptr, &n_,
+        T, &ldt_,
+        VL, &ldvl_,
+        VR, &ldvr_, &mm_, &nfound_,
+        work, &lwork_, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    // [sd]trevc update select
+    std::copy( select_.begin(), select_.end(), select );
+    *nfound = nfound_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+int64_t trevc3(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool const* select, int64_t n,
+    std::complex<float>* T, int64_t ldt,
+    std::complex<float>* VL, int64_t ldvl,
+    std::complex<float>* VR, int64_t ldvr, int64_t mm,
+    int64_t* nfound,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork )
+{
+    char sides_ = to_char( sides );
+    char howmany_ = to_char( howmany );
+
+    // lapack_logical (32 or 64-bit) copy
+    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
+    lapack_logical const* select_ptr = &select_[0];
+
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ldt_ = to_lapack_int( ldt );
+    lapack_int ldvl_ = to_lapack_int( ldvl );
+    lapack_int ldvr_ = to_lapack_int( ldvr );
+    lapack_int mm_ = to_lapack_int( mm );
+    lapack_int nfound_ = 0;  // out
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "trevc3", std::complex<float>, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int lrwork_ = to_lapack_int( lrwork );
+
+    LAPACK_ctrevc3(
+        &sides_, &howmany_,
+        select_ptr, &n_,
+        (lapack_complex_float*) T, &ldt_,
+        (lapack_complex_float*) VL, &ldvl_,
+        (lapack_complex_float*) VR, &ldvr_, &mm_, &nfound_,
+        (lapack_complex_float*) work, &lwork_,
+        rwork, &lrwork_, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *nfound = nfound_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::trevc3 that takes caller-provided workspace
+/// instead of querying and allocating it on each call.
+/// Use lapack::trevc3_work_size to get the required lengths.
+///
+/// Other arguments are the same as for lapack::trevc3.
+///
+/// @param[out] work
+///     The vector work of length lwork. Workspace.
+///
+/// @param[in] lwork
+///     The length of the array work.
+///     Use the value from lapack::trevc3_work_size for best performance.
+///
+/// @param[out] rwork
+///     The vector rwork of length lrwork. Workspace.
+///
+/// @param[in] lrwork
+///     The length of the array rwork.
+///     Use the value from lapack::trevc3_work_size for best performance.
+///
+/// @ingroup geev_computational
+int64_t trevc3(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool const* select, int64_t n,
+    std::complex<double>* T, int64_t ldt,
+    std::complex<double>* VL, int64_t ldvl,
+    std::complex<double>* VR, int64_t ldvr, int64_t mm,
+    int64_t* nfound,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork )
+{
+    char sides_ = to_char( sides );
+    char howmany_ = to_char( howmany );
+
+    // lapack_logical (32 or 64-bit) copy
+    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
+    lapack_logical const* select_ptr = &select_[0];
+
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ldt_ = to_lapack_int( ldt );
+    lapack_int ldvl_ = to_lapack_int( ldvl );
+    lapack_int ldvr_ = to_lapack_int( ldvr );
+    lapack_int mm_ = to_lapack_int( mm );
+    lapack_int nfound_ = 0;  // out
+    lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "trevc3", std::complex<double>, 0, n, 0, 0, info_ );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int lrwork_ = to_lapack_int( lrwork );
 
     LAPACK_ztrevc3(
         &sides_, &howmany_,
@@ -383,8 +645,8 @@ int64_t trevc3(
         (lapack_complex_double*) T, &ldt_,
         (lapack_complex_double*) VL, &ldvl_,
         (lapack_complex_double*) VR, &ldvr_, &mm_, &nfound_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0], &lrwork_, &info_
+        (lapack_complex_double*) work, &lwork_,
+        rwork, &lrwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
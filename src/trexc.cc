@@ -31,6 +31,7 @@ int64_t trexc(
     lapack_int ifst_ = to_lapack_int( *ifst );  // in,out
     lapack_int ilst_ = to_lapack_int( *ilst );  // in,out
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "trexc", float, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< float > work( (n) );
@@ -64,6 +65,7 @@ int64_t trexc(
     lapack_int ifst_ = to_lapack_int( *ifst );  // in,out
     lapack_int ilst_ = to_lapack_int( *ilst );  // in,out
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "trexc", double, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< double > work( (n) );
@@ -96,6 +98,7 @@ int64_t trexc(
     lapack_int ifst_ = to_lapack_int( ifst );
     lapack_int ilst_ = to_lapack_int( ilst );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "trexc", std::complex<float>, 0, n, 0, 0, info_ );
 
     LAPACK_ctrexc(
         &compq_, &n_,
@@ -122,6 +125,7 @@ int64_t trexc(
     lapack_int ifst_ = to_lapack_int( ifst );
     lapack_int ilst_ = to_lapack_int( ilst );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "trexc", std::complex<double>, 0, n, 0, 0, info_ );
 
     LAPACK_ztrexc(
         &compq_, &n_,
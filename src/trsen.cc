@@ -39,6 +39,7 @@ int64_t trsen(
     lapack_int ldq_ = to_lapack_int( ldq );
     lapack_int nfound_ = 0;  // out
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "trsen", std::complex<float>, 0, n, 0, 0, info_ );
 
     // split-complex representation
     lapack::vector< float > WR( max( 1, n ) );
@@ -114,6 +115,7 @@ int64_t trsen(
     lapack_int ldq_ = to_lapack_int( ldq );
     lapack_int nfound_ = 0;  // out
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "trsen", std::complex<double>, 0, n, 0, 0, info_ );
 
     // split-complex representation
     lapack::vector< double > WR( max( 1, n ) );
@@ -189,6 +191,7 @@ int64_t trsen(
     lapack_int ldq_ = to_lapack_int( ldq );
     lapack_int nfound_ = 0;  // out
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "trsen", std::complex<float>, 0, n, 0, 0, info_ );
 
     // query for workspace size
     std::complex<float> qry_work[1];
@@ -247,6 +250,7 @@ int64_t trsen(
     lapack_int ldq_ = to_lapack_int( ldq );
     lapack_int nfound_ = 0;  // out
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "trsen", std::complex<double>, 0, n, 0, 0, info_ );
 
     // query for workspace size
     std::complex<double> qry_work[1];
@@ -25,6 +25,7 @@ int64_t trtri(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "trtri", float, 0, n, 0, 0, info_ );
 
     LAPACK_strtri(
         &uplo_, &diag_, &n_,
@@ -46,6 +47,7 @@ int64_t trtri(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "trtri", double, 0, n, 0, 0, info_ );
 
     LAPACK_dtrtri(
         &uplo_, &diag_, &n_,
@@ -67,6 +69,7 @@ int64_t trtri(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "trtri", std::complex<float>, 0, n, 0, 0, info_ );
 
     LAPACK_ctrtri(
         &uplo_, &diag_, &n_,
@@ -88,6 +91,7 @@ int64_t trtri(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "trtri", std::complex<double>, 0, n, 0, 0, info_ );
 
     LAPACK_ztrtri(
         &uplo_, &diag_, &n_,
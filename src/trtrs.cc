@@ -29,6 +29,7 @@ int64_t trtrs(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "trtrs", float, 0, n, 0, nrhs, info_ );
 
     LAPACK_strtrs(
         &uplo_, &trans_, &diag_, &n_, &nrhs_,
@@ -55,6 +56,7 @@ int64_t trtrs(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "trtrs", double, 0, n, 0, nrhs, info_ );
 
     LAPACK_dtrtrs(
         &uplo_, &trans_, &diag_, &n_, &nrhs_,
@@ -81,6 +83,7 @@ int64_t trtrs(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "trtrs", std::complex<float>, 0, n, 0, nrhs, info_ );
 
     LAPACK_ctrtrs(
         &uplo_, &trans_, &diag_, &n_, &nrhs_,
@@ -107,6 +110,7 @@ int64_t trtrs(
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "trtrs", std::complex<double>, 0, n, 0, nrhs, info_ );
 
     LAPACK_ztrtrs(
         &uplo_, &trans_, &diag_, &n_, &nrhs_,
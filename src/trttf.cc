@@ -26,6 +26,7 @@ int64_t trttf(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "trttf", float, 0, n, 0, 0, info_ );
 
     LAPACK_strttf(
         &transr_, &uplo_, &n_,
@@ -49,6 +50,7 @@ int64_t trttf(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "trttf", double, 0, n, 0, 0, info_ );
 
     LAPACK_dtrttf(
         &transr_, &uplo_, &n_,
@@ -72,6 +74,7 @@ int64_t trttf(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "trttf", std::complex<float>, 0, n, 0, 0, info_ );
 
     LAPACK_ctrttf(
         &transr_, &uplo_, &n_,
@@ -95,6 +98,7 @@ int64_t trttf(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "trttf", std::complex<double>, 0, n, 0, 0, info_ );
 
     LAPACK_ztrttf(
         &transr_, &uplo_, &n_,
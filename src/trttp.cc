@@ -25,6 +25,7 @@ int64_t trttp(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "trttp", float, 0, n, 0, 0, info_ );
 
     LAPACK_strttp(
         &uplo_, &n_,
@@ -47,6 +48,7 @@ int64_t trttp(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "trttp", double, 0, n, 0, 0, info_ );
 
     LAPACK_dtrttp(
         &uplo_, &n_,
@@ -69,6 +71,7 @@ int64_t trttp(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "trttp", std::complex<float>, 0, n, 0, 0, info_ );
 
     LAPACK_ctrttp(
         &uplo_, &n_,
@@ -91,6 +94,7 @@ int64_t trttp(
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "trttp", std::complex<double>, 0, n, 0, 0, info_ );
 
     LAPACK_ztrttp(
         &uplo_, &n_,
@@ -0,0 +1,273 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "tsqr.hh"
+
+#if LAPACK_VERSION >= 30400  // >= 3.4
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+using blas::real;
+
+//==============================================================================
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Applies the geqrt reflectors of every row block of the TSQR Q,
+/// in parallel over blocks.
+/// @ingroup geqrf
+///
+template <typename scalar_t>
+void tsmqr_leaves(
+    TsqrLayout const& layout,
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    scalar_t const* A, int64_t lda,
+    scalar_t const* T,
+    scalar_t* C, int64_t ldc )
+{
+    int64_t p  = layout.p();
+    int64_t ib = layout.ib();
+
+    #pragma omp parallel for schedule( static ) if (p > 1)
+    for (int64_t i = 0; i < p; ++i) {
+        int64_t r0 = layout.row( i );
+        if (side == Side::Left) {
+            lapack::gemqrt( side, trans, layout.rows( i ), n, k, ib,
+                            &A[ r0 ], lda, &T[ layout.leaf_T( i ) ], ib,
+                            &C[ r0 ], ldc );
+        }
+        else {
+            lapack::gemqrt( side, trans, m, layout.rows( i ), k, ib,
+                            &A[ r0 ], lda, &T[ layout.leaf_T( i ) ], ib,
+                            &C[ r0*ldc ], ldc );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Applies the tpqrt reflectors of level s of the TSQR tree, which
+/// couple the k rows (Left) or columns (Right) of C at the top of block i
+/// with those at the top of block i + s, in parallel over pairs.
+/// @ingroup geqrf
+///
+template <typename scalar_t>
+void tsmqr_level(
+    TsqrLayout const& layout, int64_t s,
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    scalar_t const* A, int64_t lda,
+    scalar_t const* T,
+    scalar_t* C, int64_t ldc )
+{
+    int64_t p  = layout.p();
+    int64_t ib = layout.ib();
+
+    #pragma omp parallel for schedule( static ) if (p > 2*s)
+    for (int64_t i = 0; i < p - s; i += 2*s) {
+        int64_t r0 = layout.row( i );
+        int64_t r1 = layout.row( i + s );
+        scalar_t const* V  = &A[ r1 ];
+        scalar_t const* Ts = &T[ layout.tree_T( i + s ) ];
+        if (side == Side::Left) {
+            lapack::tpmqrt( side, trans, k, n, k, k, ib, V, lda, Ts, ib,
+                            &C[ r0 ], ldc, &C[ r1 ], ldc );
+        }
+        else {
+            lapack::tpmqrt( side, trans, m, k, k, k, ib, V, lda, Ts, ib,
+                            &C[ r0*ldc ], ldc, &C[ r1*ldc ], ldc );
+        }
+    }
+}
+
+}  // namespace internal
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks arguments, then applies the leaf
+/// and tree reflectors of Q in the order required by side and trans.
+/// Q = Q_leaf Q_1 Q_2 ... Q_L, where Q_leaf is block diagonal with the
+/// geqrt factors of each block and Q_s are the tree levels.
+/// @ingroup geqrf
+///
+template <typename scalar_t>
+int64_t tsmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    int64_t mb,
+    scalar_t const* A, int64_t lda,
+    scalar_t const* T, int64_t tsize,
+    scalar_t* C, int64_t ldc )
+{
+    bool left = (side == Side::Left);
+    int64_t mq = left ? m : n;  // order of Q
+
+    lapack_error_if( side != Side::Left && side != Side::Right );
+    lapack_error_if( trans != Op::NoTrans
+                     && trans != Op::ConjTrans
+                     && ! (trans == Op::Trans
+                           && ! blas::is_complex< scalar_t >::value) );
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( k < 0 || k > mq );
+    lapack_error_if( mb < max( 1, k ) );
+    lapack_error_if( lda < max( 1, mq ) );
+
+    internal::TsqrLayout layout( mq, k, mb );
+    lapack_error_if( tsize < layout.tsize() );
+    lapack_error_if( ldc < max( 1, m ) );
+
+    if (m == 0 || n == 0 || k == 0)
+        return 0;
+
+    int64_t p = layout.p();
+
+    // Q^H C and C Q apply the leaves first, then the tree bottom-up;
+    // Q C and C Q^H apply the tree top-down, then the leaves.
+    bool notrans = (trans == Op::NoTrans);
+    if (left != notrans) {
+        internal::tsmqr_leaves( layout, side, trans, m, n, k,
+                                A, lda, T, C, ldc );
+        for (int64_t s = 1; s < p; s *= 2) {
+            internal::tsmqr_level( layout, s, side, trans, m, n, k,
+                                   A, lda, T, C, ldc );
+        }
+    }
+    else {
+        int64_t s_top = 1;
+        while (2*s_top < p)
+            s_top *= 2;
+        for (int64_t s = s_top; s >= 1; s /= 2) {
+            internal::tsmqr_level( layout, s, side, trans, m, n, k,
+                                   A, lda, T, C, ldc );
+        }
+        internal::tsmqr_leaves( layout, side, trans, m, n, k,
+                                A, lda, T, C, ldc );
+    }
+    return 0;
+}
+
+}  // namespace impl
+
+//==============================================================================
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t tsmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    int64_t mb,
+    float const* A, int64_t lda,
+    float const* T, int64_t tsize,
+    float* C, int64_t ldc )
+{
+    return impl::tsmqr( side, trans, m, n, k, mb, A, lda, T, tsize, C, ldc );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t tsmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    int64_t mb,
+    double const* A, int64_t lda,
+    double const* T, int64_t tsize,
+    double* C, int64_t ldc )
+{
+    return impl::tsmqr( side, trans, m, n, k, mb, A, lda, T, tsize, C, ldc );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t tsmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    int64_t mb,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* T, int64_t tsize,
+    std::complex<float>* C, int64_t ldc )
+{
+    return impl::tsmqr( side, trans, m, n, k, mb, A, lda, T, tsize, C, ldc );
+}
+
+// -----------------------------------------------------------------------------
+/// Multiplies the general m-by-n matrix C by Q from lapack::tsqr:
+/// - side = Left,  trans = NoTrans:   $Q C$
+/// - side = Right, trans = NoTrans:   $C Q$
+/// - side = Left,  trans = ConjTrans: $Q^H C$
+/// - side = Right, trans = ConjTrans: $C Q^H$
+///
+/// where Q is the unitary matrix defined as the product of the geqrt
+/// block reflectors of each row block and the tpqrt block reflectors
+/// of the reduction tree, as returned by lapack::tsqr.
+/// Like tsqr, work is parallel over row blocks using OpenMP.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] side
+///     - lapack::Side::Left:  apply $Q$ or $Q^H$ from the Left;
+///     - lapack::Side::Right: apply $Q$ or $Q^H$ from the Right.
+///
+/// @param[in] trans
+///     - lapack::Op::NoTrans:   No transpose, apply $Q$;
+///     - lapack::Op::ConjTrans: Conjugate transpose, apply $Q^H$;
+///     - lapack::Op::Trans:     Transpose, apply $Q^T$ (real only).
+///
+/// @param[in] m
+///     The number of rows of the matrix C. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix C. n >= 0.
+///
+/// @param[in] k
+///     The number of columns of the matrix A factored by tsqr.
+///     - If side = Left,  m >= k >= 0;
+///     - if side = Right, n >= k >= 0.
+///
+/// @param[in] mb
+///     The row block size, as passed to lapack::tsqr. mb >= max(1,k).
+///
+/// @param[in] A
+///     - If side = Left,  the m-by-k matrix A, stored in an lda-by-k array;
+///     - if side = Right, the n-by-k matrix A, stored in an lda-by-k array.
+///     \n
+///     Part of the data structure to represent Q as returned by tsqr.
+///
+/// @param[in] lda
+///     The leading dimension of the array A.
+///     - If side = Left,  lda >= max(1,m);
+///     - if side = Right, lda >= max(1,n).
+///
+/// @param[in] T
+///     The vector T of length max(1,tsize).
+///     Part of the data structure to represent Q as returned by tsqr.
+///
+/// @param[in] tsize
+///     The dimension of the array T, as passed to lapack::tsqr.
+///
+/// @param[in,out] C
+///     The m-by-n matrix C, stored in an ldc-by-n array.
+///     On entry, the m-by-n matrix C.
+///     On exit, C is overwritten by $Q C$, $Q^H C$, $C Q^H$, or $C Q$.
+///
+/// @param[in] ldc
+///     The leading dimension of the array C. ldc >= max(1,m).
+///
+/// @return = 0: successful exit
+///
+/// @ingroup geqrf
+int64_t tsmqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    int64_t mb,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* T, int64_t tsize,
+    std::complex<double>* C, int64_t ldc )
+{
+    return impl::tsmqr( side, trans, m, n, k, mb, A, lda, T, tsize, C, ldc );
+}
+
+}  // namespace lapack
+
+#endif  // LAPACK >= 3.4
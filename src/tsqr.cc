@@ -0,0 +1,182 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "tsqr.hh"
+
+#if LAPACK_VERSION >= 30400  // >= 3.4
+
+#include <cmath>
+#include <limits>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+using blas::real;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks arguments, factors the row blocks
+/// in parallel, then reduces their R factors in a binary tree.
+/// Steps in each level of the tree are independent and run in parallel.
+/// @ingroup geqrf
+///
+template <typename scalar_t>
+int64_t tsqr(
+    int64_t m, int64_t n, int64_t mb,
+    scalar_t* A, int64_t lda,
+    scalar_t* T, int64_t tsize )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 || n > m );
+    lapack_error_if( mb < max( 1, n ) );
+    lapack_error_if( lda < max( 1, m ) );
+    lapack_error_if( tsize < 1 && tsize != -1 );
+
+    internal::TsqrLayout layout( m, n, mb );
+    if (tsize == -1) {
+        // Round up so the size is not truncated in single precision.
+        real_t size = real_t( layout.tsize() );
+        if (int64_t( size ) < layout.tsize())
+            size = std::nextafter( size, std::numeric_limits< real_t >::max() );
+        T[ 0 ] = size;
+        return 0;
+    }
+    lapack_error_if( tsize < layout.tsize() );
+
+    if (n == 0)
+        return 0;
+
+    int64_t p  = layout.p();
+    int64_t ib = layout.ib();
+
+    // Factor each row block, A_i = Q_i R_i.
+    #pragma omp parallel for schedule( static ) if (p > 1)
+    for (int64_t i = 0; i < p; ++i) {
+        lapack::geqrt( layout.rows( i ), n, ib,
+                       &A[ layout.row( i ) ], lda,
+                       &T[ layout.leaf_T( i ) ], ib );
+    }
+
+    // Reduce pairs [ R_i; R_{i+s} ] = Q [ R_i; 0 ] in a binary tree.
+    for (int64_t s = 1; s < p; s *= 2) {
+        #pragma omp parallel for schedule( static ) if (p > 2*s)
+        for (int64_t i = 0; i < p - s; i += 2*s) {
+            lapack::tpqrt( n, n, n, ib,
+                           &A[ layout.row( i     ) ], lda,
+                           &A[ layout.row( i + s ) ], lda,
+                           &T[ layout.tree_T( i + s ) ], ib );
+        }
+    }
+    return 0;
+}
+
+}  // namespace impl
+
+//==============================================================================
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t tsqr(
+    int64_t m, int64_t n, int64_t mb,
+    float* A, int64_t lda,
+    float* T, int64_t tsize )
+{
+    return impl::tsqr( m, n, mb, A, lda, T, tsize );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t tsqr(
+    int64_t m, int64_t n, int64_t mb,
+    double* A, int64_t lda,
+    double* T, int64_t tsize )
+{
+    return impl::tsqr( m, n, mb, A, lda, T, tsize );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t tsqr(
+    int64_t m, int64_t n, int64_t mb,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* T, int64_t tsize )
+{
+    return impl::tsqr( m, n, mb, A, lda, T, tsize );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes a QR factorization of a tall-skinny m-by-n matrix A, m >= n:
+/// \[
+///     A = Q \begin{bmatrix} R
+///           \\              0
+///           \end{bmatrix},
+/// \]
+/// using the communication-avoiding TSQR algorithm.
+/// Q is a m-by-m unitary matrix;
+/// R is an upper-triangular n-by-n matrix;
+/// 0 is a (m - n)-by-n zero matrix.
+///
+/// The rows of A are split into blocks of mb rows, which are factored
+/// in parallel by geqrt. Their R factors are then reduced pairwise in a
+/// binary tree by tpqrt, with the steps in each level of the tree in
+/// parallel. Parallelism is over row blocks using OpenMP, so this is
+/// suited to m >> n, where LAPACK geqrf parallelizes poorly.
+/// The Q factor is represented implicitly in A and T; apply it with
+/// lapack::tsmqr, using the same mb.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     The number of rows of the matrix A. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. m >= n >= 0.
+///
+/// @param[in] mb
+///     The row block size. mb >= max(1,n). The last block also holds
+///     the remaining rows, m mod mb. A few thousand rows per block
+///     balances the geqrt work against the number of blocks.
+///
+/// @param[in,out] A
+///     The m-by-n matrix A, stored in an lda-by-n array.
+///     On entry, the m-by-n matrix A.
+///     On exit, the elements on and above the diagonal of the array
+///     contain the n-by-n upper triangular matrix R;
+///     the remaining elements, along with T, represent Q.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,m).
+///
+/// @param[out] T
+///     The vector T of length max(1,tsize).
+///     On exit, part of the data structure used to represent Q.
+///     To apply Q, keep T (in addition to A) and pass it to lapack::tsmqr.
+///
+/// @param[in] tsize
+///     The dimension of the array T.
+///     If tsize = -1, then a workspace query is assumed; the routine
+///     only calculates the required size of T and returns it in T[0].
+///
+/// @return = 0: successful exit
+///
+/// @ingroup geqrf
+int64_t tsqr(
+    int64_t m, int64_t n, int64_t mb,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* T, int64_t tsize )
+{
+    return impl::tsqr( m, n, mb, A, lda, T, tsize );
+}
+
+}  // namespace lapack
+
+#endif  // LAPACK >= 3.4
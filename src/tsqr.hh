@@ -0,0 +1,77 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_TSQR_HH
+#define LAPACK_TSQR_HH
+
+#include "lapack/util.hh"
+
+#include <algorithm>
+
+// Row-block layout shared by tsqr and tsmqr.
+
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Row blocks and T storage of a tall-skinny QR factorization of an
+/// m-by-n matrix, m >= n, with row blocks of mb >= n rows.
+///
+/// There are p = max( 1, floor( m/mb ) ) row blocks; block i starts at
+/// row i*mb and has mb rows, except the last block also gets the
+/// remaining m - p*mb rows, so every block has at least n rows.
+///
+/// Each block is factored by geqrt, with an ib-by-n triangular factor
+/// stored at leaf_T( i ). Then the n-by-n R factors at the top of each
+/// block are reduced pairwise in a binary tree by tpqrt: at level s,
+/// block i eliminates block i + 2^s, for i a multiple of 2^(s+1).
+/// The Householder vectors of that step overwrite the upper triangle of
+/// the top n-by-n of block i + 2^s, and its ib-by-n triangular factor is
+/// stored at tree_T( i + 2^s ). Each block except block 0 is eliminated
+/// exactly once.
+///
+struct TsqrLayout
+{
+    TsqrLayout( int64_t m, int64_t n, int64_t mb )
+        : m_( m ),
+          n_( n ),
+          mb_( mb ),
+          p_( std::max( int64_t( 1 ), m / mb ) ),
+          ib_( std::max( int64_t( 1 ), std::min( n, int64_t( 32 ) ) ) )
+    {}
+
+    /// @return number of row blocks.
+    int64_t p() const { return p_; }
+
+    /// @return inner block size for geqrt and tpqrt, and rows of each T.
+    int64_t ib() const { return ib_; }
+
+    /// @return first row of block i.
+    int64_t row( int64_t i ) const { return i*mb_; }
+
+    /// @return number of rows in block i.
+    int64_t rows( int64_t i ) const
+    {
+        return i == p_ - 1 ? m_ - i*mb_ : mb_;
+    }
+
+    /// @return size of T array needed, in elements.
+    int64_t tsize() const { return std::max( int64_t( 1 ), 2*p_*ib_*n_ ); }
+
+    /// @return offset in T of the geqrt factor of block i; ldt = ib.
+    int64_t leaf_T( int64_t i ) const { return i*ib_*n_; }
+
+    /// @return offset in T of the tpqrt factor that eliminated block i;
+    /// ldt = ib.
+    int64_t tree_T( int64_t i ) const { return (p_ + i)*ib_*n_; }
+
+private:
+    int64_t m_, n_, mb_, p_, ib_;
+};
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_TSQR_HH
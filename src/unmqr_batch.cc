@@ -0,0 +1,393 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "lapack/fortran.h"
+#include "NoConstructAllocator.hh"
+
+namespace lapack {
+
+using blas::max;
+using blas::is_complex_v;
+
+//==============================================================================
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, float version.
+/// @ingroup geqrf_batch_internal
+inline void unmqr(
+    char side, char trans, lapack_int m, lapack_int n, lapack_int k,
+    float const* A, lapack_int lda,
+    float const* tau,
+    float* C, lapack_int ldc,
+    float* work, lapack_int lwork,
+    lapack_int* info )
+{
+    LAPACK_sormqr(
+        &side, &trans, &m, &n, &k, A, &lda, tau, C, &ldc,
+        work, &lwork, info );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, double version.
+/// @ingroup geqrf_batch_internal
+inline void unmqr(
+    char side, char trans, lapack_int m, lapack_int n, lapack_int k,
+    double const* A, lapack_int lda,
+    double const* tau,
+    double* C, lapack_int ldc,
+    double* work, lapack_int lwork,
+    lapack_int* info )
+{
+    LAPACK_dormqr(
+        &side, &trans, &m, &n, &k, A, &lda, tau, C, &ldc,
+        work, &lwork, info );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, complex<float> version.
+/// @ingroup geqrf_batch_internal
+inline void unmqr(
+    char side, char trans, lapack_int m, lapack_int n, lapack_int k,
+    std::complex<float> const* A, lapack_int lda,
+    std::complex<float> const* tau,
+    std::complex<float>* C, lapack_int ldc,
+    std::complex<float>* work, lapack_int lwork,
+    lapack_int* info )
+{
+    LAPACK_cunmqr(
+        &side, &trans, &m, &n, &k,
+        (lapack_complex_float*) A, &lda,
+        (lapack_complex_float*) tau,
+        (lapack_complex_float*) C, &ldc,
+        (lapack_complex_float*) work, &lwork, info );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, complex<double> version.
+/// @ingroup geqrf_batch_internal
+inline void unmqr(
+    char side, char trans, lapack_int m, lapack_int n, lapack_int k,
+    std::complex<double> const* A, lapack_int lda,
+    std::complex<double> const* tau,
+    std::complex<double>* C, lapack_int ldc,
+    std::complex<double>* work, lapack_int lwork,
+    lapack_int* info )
+{
+    LAPACK_zunmqr(
+        &side, &trans, &m, &n, &k,
+        (lapack_complex_double*) A, &lda,
+        (lapack_complex_double*) tau,
+        (lapack_complex_double*) C, &ldc,
+        (lapack_complex_double*) work, &lwork, info );
+}
+
+}  // namespace internal
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks and converts arguments once,
+/// queries workspace once, then multiplies each matrix in parallel,
+/// with one workspace per thread.
+/// Aarray(i), tau_array(i), Carray(i) return pointers to the i-th
+/// reflectors, tau, and matrix C.
+/// @ingroup geqrf_batch_internal
+///
+template <typename scalar_t,
+          typename Aarray_t, typename tau_array_t, typename Carray_t>
+void unmqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    Aarray_t Aarray, int64_t lda,
+    tau_array_t tau_array,
+    Carray_t Carray, int64_t ldc,
+    int64_t batch_count, int64_t* info )
+{
+    // for real, map ConjTrans to Trans
+    if constexpr (! is_complex_v< scalar_t >) {
+        if (trans == Op::ConjTrans)
+            trans = Op::Trans;
+    }
+    else {
+        lapack_error_if( trans == Op::Trans );
+    }
+    int64_t q = (side == Side::Left ? m : n);
+    lapack_error_if( side != Side::Left && side != Side::Right );
+    lapack_error_if( trans != Op::NoTrans && trans != Op::Trans
+                     && trans != Op::ConjTrans );
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( k < 0 || k > q );
+    lapack_error_if( lda < max( 1, q ) );
+    lapack_error_if( ldc < max( 1, m ) );
+    lapack_error_if( batch_count < 0 );
+
+    char side_ = to_char( side );
+    char trans_ = to_char( trans );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int k_ = to_lapack_int( k );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldc_ = to_lapack_int( ldc );
+
+    int64_t lwork;
+    unmqr_work_size( side, trans, m, n, k,
+                     (scalar_t const*) nullptr, lda, (scalar_t const*) nullptr,
+                     (scalar_t*) nullptr, ldc, &lwork );
+    lapack_int lwork_ = to_lapack_int( lwork );
+
+    #pragma omp parallel if (batch_count > 1)
+    {
+        lapack::vector< scalar_t > work( max( 1, lwork ) );
+
+        #pragma omp for schedule( static )
+        for (int64_t i = 0; i < batch_count; ++i) {
+            lapack_int info_ = 0;
+            internal::unmqr(
+                side_, trans_, m_, n_, k_,
+                Aarray( i ), lda_, tau_array( i ), Carray( i ), ldc_,
+                &work[0], lwork_, &info_ );
+            info[ i ] = info_;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Strided version.
+/// @ingroup geqrf_batch_internal
+///
+template <typename scalar_t>
+void unmqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    scalar_t const* A, int64_t lda, int64_t strideA,
+    scalar_t const* tau, int64_t stride_tau,
+    scalar_t* C, int64_t ldc, int64_t strideC,
+    int64_t batch_count, int64_t* info )
+{
+    if (batch_count > 1) {
+        lapack_error_if( strideA < lda*k );
+        lapack_error_if( stride_tau < k );
+        lapack_error_if( strideC < ldc*n );
+    }
+
+    unmqr_batch< scalar_t >(
+        side, trans, m, n, k,
+        [=]( int64_t i ) { return A + i*strideA; }, lda,
+        [=]( int64_t i ) { return tau + i*stride_tau; },
+        [=]( int64_t i ) { return C + i*strideC; }, ldc,
+        batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// Pointer-array version.
+/// @ingroup geqrf_batch_internal
+///
+template <typename scalar_t>
+void unmqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    scalar_t const* const* Aarray, int64_t lda,
+    scalar_t const* const* tau_array,
+    scalar_t* const* Carray, int64_t ldc,
+    int64_t batch_count, int64_t* info )
+{
+    unmqr_batch< scalar_t >(
+        side, trans, m, n, k,
+        [=]( int64_t i ) { return Aarray[ i ]; }, lda,
+        [=]( int64_t i ) { return tau_array[ i ]; },
+        [=]( int64_t i ) { return Carray[ i ]; }, ldc,
+        batch_count, info );
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// @ingroup geqrf_batch
+void unmqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda, int64_t strideA,
+    float const* tau, int64_t stride_tau,
+    float* C, int64_t ldc, int64_t strideC,
+    int64_t batch_count, int64_t* info )
+{
+    impl::unmqr_batch( side, trans, m, n, k, A, lda, strideA,
+                       tau, stride_tau, C, ldc, strideC, batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup geqrf_batch
+void unmqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda, int64_t strideA,
+    double const* tau, int64_t stride_tau,
+    double* C, int64_t ldc, int64_t strideC,
+    int64_t batch_count, int64_t* info )
+{
+    impl::unmqr_batch( side, trans, m, n, k, A, lda, strideA,
+                       tau, stride_tau, C, ldc, strideC, batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup geqrf_batch
+void unmqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda, int64_t strideA,
+    std::complex<float> const* tau, int64_t stride_tau,
+    std::complex<float>* C, int64_t ldc, int64_t strideC,
+    int64_t batch_count, int64_t* info )
+{
+    impl::unmqr_batch( side, trans, m, n, k, A, lda, strideA,
+                       tau, stride_tau, C, ldc, strideC, batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// Multiplies a batch of general m-by-n matrices C_i by Q_i from
+/// lapack::geqrf_batch, as in lapack::unmqr:
+///
+/// - side = Left,  trans = NoTrans:   $Q_i C_i$
+/// - side = Right, trans = NoTrans:   $C_i Q_i$
+/// - side = Left,  trans = ConjTrans: $Q_i^H C_i$
+/// - side = Right, trans = ConjTrans: $C_i Q_i^H$
+///
+/// Matrices are processed in parallel using OpenMP. The workspace size
+/// is queried once for the batch, and each thread allocates one
+/// workspace that it reuses for all its matrices.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`,
+/// for both strided storage (shown here) and pointer-array storage:
+///
+///     unmqr_batch( side, trans, m, n, k, Aarray, lda, tau_array,
+///                  Carray, ldc, batch_count, info )
+///
+/// For real matrices, this is an alias for `lapack::ormqr_batch`.
+///
+/// @param[in] side
+///     - lapack::Side::Left:  apply $Q_i$ or $Q_i^H$ from the Left;
+///     - lapack::Side::Right: apply $Q_i$ or $Q_i^H$ from the Right.
+///
+/// @param[in] trans
+///     - lapack::Op::NoTrans:   No transpose, apply $Q_i$;
+///     - lapack::Op::ConjTrans: Conjugate transpose, apply $Q_i^H$.
+///
+/// @param[in] m
+///     The number of rows of each matrix C_i. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of each matrix C_i. n >= 0.
+///
+/// @param[in] k
+///     The number of elementary reflectors whose product defines
+///     each matrix Q_i.
+///     - If side = Left,  m >= k >= 0;
+///     - if side = Right, n >= k >= 0.
+///
+/// @param[in] A
+///     The batch of reflectors from lapack::geqrf_batch, each stored in
+///     an lda-by-k array, with A_i starting at A + i*strideA.
+///
+/// @param[in] lda
+///     The leading dimension of each A_i.
+///     - If side = Left,  lda >= max(1,m);
+///     - if side = Right, lda >= max(1,n).
+///
+/// @param[in] strideA
+///     Distance between the starts of consecutive A_i. strideA >= lda*k.
+///
+/// @param[in] tau
+///     The batch of vectors tau_i from lapack::geqrf_batch, each of
+///     length k, with tau_i starting at tau + i*stride_tau.
+///
+/// @param[in] stride_tau
+///     Distance between the starts of consecutive tau_i. stride_tau >= k.
+///
+/// @param[in,out] C
+///     The batch of m-by-n matrices, each stored in an ldc-by-n array,
+///     with C_i starting at C + i*strideC.
+///     On exit, C_i is overwritten by
+///     $Q_i C_i$ or $Q_i^H C_i$ or $C_i Q_i^H$ or $C_i Q_i$.
+///
+/// @param[in] ldc
+///     The leading dimension of each C_i. ldc >= max(1,m).
+///
+/// @param[in] strideC
+///     Distance between the starts of consecutive C_i. strideC >= ldc*n.
+///
+/// @param[in] batch_count
+///     The number of matrices. batch_count >= 0.
+///
+/// @param[out] info
+///     The vector info of length batch_count.
+///     info[ i ] = 0: successful exit.
+///
+/// Invalid arguments throw lapack::Error.
+///
+/// @ingroup geqrf_batch
+void unmqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda, int64_t strideA,
+    std::complex<double> const* tau, int64_t stride_tau,
+    std::complex<double>* C, int64_t ldc, int64_t strideC,
+    int64_t batch_count, int64_t* info )
+{
+    impl::unmqr_batch( side, trans, m, n, k, A, lda, strideA,
+                       tau, stride_tau, C, ldc, strideC, batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup geqrf_batch
+void unmqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* const* Aarray, int64_t lda,
+    float const* const* tau_array,
+    float* const* Carray, int64_t ldc,
+    int64_t batch_count, int64_t* info )
+{
+    impl::unmqr_batch( side, trans, m, n, k, Aarray, lda, tau_array,
+                       Carray, ldc, batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup geqrf_batch
+void unmqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* const* Aarray, int64_t lda,
+    double const* const* tau_array,
+    double* const* Carray, int64_t ldc,
+    int64_t batch_count, int64_t* info )
+{
+    impl::unmqr_batch( side, trans, m, n, k, Aarray, lda, tau_array,
+                       Carray, ldc, batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup geqrf_batch
+void unmqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* const* Aarray, int64_t lda,
+    std::complex<float> const* const* tau_array,
+    std::complex<float>* const* Carray, int64_t ldc,
+    int64_t batch_count, int64_t* info )
+{
+    impl::unmqr_batch( side, trans, m, n, k, Aarray, lda, tau_array,
+                       Carray, ldc, batch_count, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup geqrf_batch
+void unmqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* const* Aarray, int64_t lda,
+    std::complex<double> const* const* tau_array,
+    std::complex<double>* const* Carray, int64_t ldc,
+    int64_t batch_count, int64_t* info )
+{
+    impl::unmqr_batch( side, trans, m, n, k, Aarray, lda, tau_array,
+                       Carray, ldc, batch_count, info );
+}
+
+}  // namespace lapack
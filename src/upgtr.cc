@@ -27,6 +27,7 @@ int64_t upgtr(
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldq_ = to_lapack_int( ldq );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "upgtr", std::complex<float>, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<float> > work( (n-1) );
@@ -55,6 +56,7 @@ int64_t upgtr(
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldq_ = to_lapack_int( ldq );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "upgtr", std::complex<double>, 0, n, 0, 0, info_ );
 
     // allocate workspace
     lapack::vector< std::complex<double> > work( (n-1) );
@@ -31,6 +31,7 @@ int64_t upmtr(
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldc_ = to_lapack_int( ldc );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "upmtr", std::complex<float>, m, n, 0, 0, info_ );
 
     // from docs
     int64_t lwork = (side == Side::Left ? n : m);
@@ -129,6 +130,7 @@ int64_t upmtr(
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldc_ = to_lapack_int( ldc );
     lapack_int info_ = 0;
+    LAPACK_TRACE_BLOCK( "upmtr", std::complex<double>, m, n, 0, 0, info_ );
 
     // from docs
     int64_t lwork = (side == Side::Left ? n : m);
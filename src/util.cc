@@ -71,4 +71,12 @@ const char* Order_help          = "order eigvals within: "
 
 const char* RowCol_help         = "check orthogonality of: R=Row, C=Col";
 
+const char* MethodLU_help       = "LU factorization: L=Lapack, N=Native";
+
+const char* MethodCholesky_help = "Cholesky factorization: L=Lapack, T=Tiled";
+
+const char* InnerPrecision_help = "inner precision: S=Single, B=Bfloat16, H=Half";
+
+const char* MethodRefine_help   = "iterative refinement: C=Classical, G=GMRES";
+
 }  // namespace lapack
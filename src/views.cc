@@ -0,0 +1,834 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/views.hh"
+#include "lapack_internal.hh"
+#include "NoConstructAllocator.hh"
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+using blas::real;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Pointer and leading dimension of a matrix as passed to LAPACK.
+template <typename scalar_t>
+struct Operand
+{
+    scalar_t* data;
+    int64_t ld;
+};
+
+//------------------------------------------------------------------------------
+/// @return true if A can be passed in the given layout without copying.
+template <typename scalar_t>
+bool fits( MatrixView< scalar_t > const& A, Layout layout )
+{
+    return layout == Layout::ColMajor ? A.is_col_major() : A.is_row_major();
+}
+
+//------------------------------------------------------------------------------
+/// @return layout of A if it has one, else layout of B if it has one,
+/// else ColMajor. Column-major is preferred when a view fits both.
+template <typename scalar_t>
+Layout pick_layout(
+    MatrixView< scalar_t > const& A,
+    MatrixView< scalar_t > const& B )
+{
+    if (A.is_col_major())
+        return Layout::ColMajor;
+    if (A.is_row_major() || (B.is_row_major() && ! B.is_col_major()))
+        return Layout::RowMajor;
+    return Layout::ColMajor;
+}
+
+//------------------------------------------------------------------------------
+/// @return number of workspace elements to repack A into layout,
+/// or 0 if A fits layout or isn't referenced.
+template <typename scalar_t>
+int64_t repack_size(
+    MatrixView< scalar_t > const& A, Layout layout, bool referenced=true )
+{
+    return (referenced && ! fits( A, layout )) ? A.m() * A.n() : 0;
+}
+
+//------------------------------------------------------------------------------
+/// @return A as an operand in layout. If A doesn't fit layout, copies A
+/// into work, which is advanced past the copy. If A isn't referenced,
+/// returns its data with ld = 1.
+template <typename scalar_t>
+Operand< scalar_t > repack_in(
+    MatrixView< scalar_t > const& A, Layout layout, scalar_t*& work,
+    bool referenced=true )
+{
+    if (! referenced)
+        return { A.data(), 1 };
+    if (layout == Layout::ColMajor && A.is_col_major())
+        return { A.data(), A.col_major_ld() };
+    if (layout == Layout::RowMajor && A.is_row_major())
+        return { A.data(), A.row_major_ld() };
+
+    int64_t m = A.m();
+    int64_t n = A.n();
+    Operand< scalar_t > op;
+    op.data = work;
+    work += m*n;
+    if (layout == Layout::ColMajor) {
+        op.ld = max( 1, m );
+        for (int64_t j = 0; j < n; ++j)
+            for (int64_t i = 0; i < m; ++i)
+                op.data[ i + j*op.ld ] = A( i, j );
+    }
+    else {
+        op.ld = max( 1, n );
+        for (int64_t i = 0; i < m; ++i)
+            for (int64_t j = 0; j < n; ++j)
+                op.data[ j + i*op.ld ] = A( i, j );
+    }
+    return op;
+}
+
+//------------------------------------------------------------------------------
+/// If A was repacked by repack_in into op, copies op back to A.
+template <typename scalar_t>
+void repack_out(
+    Operand< scalar_t > const& op, MatrixView< scalar_t > const& A,
+    Layout layout, bool referenced=true )
+{
+    if (! referenced || op.data == A.data())
+        return;
+
+    int64_t m = A.m();
+    int64_t n = A.n();
+    if (layout == Layout::ColMajor) {
+        for (int64_t j = 0; j < n; ++j)
+            for (int64_t i = 0; i < m; ++i)
+                A( i, j ) = op.data[ i + j*op.ld ];
+    }
+    else {
+        for (int64_t i = 0; i < m; ++i)
+            for (int64_t j = 0; j < n; ++j)
+                A( i, j ) = op.data[ j + i*op.ld ];
+    }
+}
+
+}  // namespace internal
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks views, repacks views that don't fit
+/// the chosen layout, and calls the pointer-based routine.
+/// @ingroup views
+///
+template <typename scalar_t>
+int64_t gels(
+    lapack::Op trans,
+    MatrixView< scalar_t > A,
+    MatrixView< scalar_t > B )
+{
+    int64_t m = A.m();
+    int64_t n = A.n();
+    int64_t nrhs = B.n();
+    lapack_error_if( B.m() != max( m, n ) );
+
+    // Row-major real A is column-major A^T: solve with trans flipped.
+    const Layout col = Layout::ColMajor;
+    bool flip = ! blas::is_complex_v< scalar_t >
+                && ! A.is_col_major() && A.is_row_major();
+
+    lapack::vector< scalar_t > work(
+        (flip ? 0 : internal::repack_size( A, col ))
+        + internal::repack_size( B, col ) );
+    scalar_t* w = work.data();
+
+    internal::Operand< scalar_t > A_;
+    if (flip)
+        A_ = { A.data(), A.row_major_ld() };
+    else
+        A_ = internal::repack_in( A, col, w );
+    auto B_ = internal::repack_in( B, col, w );
+
+    int64_t info;
+    if (flip) {
+        Op trans_ = (trans == Op::NoTrans ? Op::Trans : Op::NoTrans);
+        info = lapack::gels( trans_, n, m, nrhs, A_.data, A_.ld, B_.data, B_.ld );
+    }
+    else {
+        info = lapack::gels( trans, m, n, nrhs, A_.data, A_.ld, B_.data, B_.ld );
+        internal::repack_out( A_, A, col );
+    }
+    internal::repack_out( B_, B, col );
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks views, repacks views that don't fit
+/// the chosen layout, and calls the pointer-based routine.
+/// @ingroup views
+///
+template <typename scalar_t>
+int64_t gesv(
+    MatrixView< scalar_t > A,
+    int64_t* ipiv,
+    MatrixView< scalar_t > B )
+{
+    int64_t n = A.n();
+    int64_t nrhs = B.n();
+    lapack_error_if( A.m() != n );
+    lapack_error_if( B.m() != n );
+
+    Layout layout = internal::pick_layout( A, B );
+    lapack::vector< scalar_t > work(
+        internal::repack_size( A, layout )
+        + internal::repack_size( B, layout ) );
+    scalar_t* w = work.data();
+    auto A_ = internal::repack_in( A, layout, w );
+    auto B_ = internal::repack_in( B, layout, w );
+
+    int64_t info = lapack::gesv(
+        layout, n, nrhs, A_.data, A_.ld, ipiv, B_.data, B_.ld );
+
+    internal::repack_out( A_, A, layout );
+    internal::repack_out( B_, B, layout );
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks views, repacks views that don't fit
+/// the chosen layout, and calls the pointer-based routine.
+/// @ingroup views
+///
+template <typename scalar_t>
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt,
+    MatrixView< scalar_t > A,
+    blas::real_type< scalar_t >* S,
+    MatrixView< scalar_t > U,
+    MatrixView< scalar_t > VT )
+{
+    int64_t m = A.m();
+    int64_t n = A.n();
+    int64_t minmn = min( m, n );
+    bool wantu  = (jobu  == Job::AllVec || jobu  == Job::SomeVec);
+    bool wantvt = (jobvt == Job::AllVec || jobvt == Job::SomeVec);
+    if (wantu) {
+        lapack_error_if( U.m() != m );
+        lapack_error_if( U.n() != (jobu == Job::AllVec ? m : minmn) );
+    }
+    if (wantvt) {
+        lapack_error_if( VT.m() != (jobvt == Job::AllVec ? n : minmn) );
+        lapack_error_if( VT.n() != n );
+    }
+
+    Layout layout = internal::pick_layout( A, wantu ? U : VT );
+    lapack::vector< scalar_t > work(
+        internal::repack_size( A, layout )
+        + internal::repack_size( U, layout, wantu )
+        + internal::repack_size( VT, layout, wantvt ) );
+    scalar_t* w = work.data();
+    auto A_  = internal::repack_in( A, layout, w );
+    auto U_  = internal::repack_in( U, layout, w, wantu );
+    auto VT_ = internal::repack_in( VT, layout, w, wantvt );
+
+    int64_t info = lapack::gesvd(
+        layout, jobu, jobvt, m, n, A_.data, A_.ld, S,
+        U_.data, U_.ld, VT_.data, VT_.ld );
+
+    internal::repack_out( A_, A, layout );
+    internal::repack_out( U_, U, layout, wantu );
+    internal::repack_out( VT_, VT, layout, wantvt );
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks views, repacks views that don't fit
+/// the chosen layout, and calls the pointer-based routine.
+/// @ingroup views
+///
+template <typename scalar_t>
+int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo,
+    MatrixView< scalar_t > A,
+    blas::real_type< scalar_t >* W )
+{
+    int64_t n = A.n();
+    lapack_error_if( A.m() != n );
+
+    if (! A.is_col_major() && A.is_row_major()) {
+        // Row-major A is column-major A^T = conj( A ), with the opposite
+        // triangle and the same eigenvalues. Its eigenvectors conj( Z )
+        // are transposed and conjugated in place to row-major Z.
+        int64_t lda = A.row_major_ld();
+        int64_t info = lapack::heevd(
+            jobz, internal::flip_uplo( uplo ), n, A.data(), lda, W );
+        if (jobz == Job::Vec) {
+            internal::transpose_in_place( n, A.data(), lda );
+            if constexpr (blas::is_complex_v< scalar_t >) {
+                for (int64_t j = 0; j < n; ++j)
+                    for (int64_t i = 0; i < n; ++i)
+                        A( i, j ) = blas::conj( A( i, j ) );
+            }
+        }
+        return info;
+    }
+
+    const Layout col = Layout::ColMajor;
+    lapack::vector< scalar_t > work( internal::repack_size( A, col ) );
+    scalar_t* w = work.data();
+    auto A_ = internal::repack_in( A, col, w );
+
+    int64_t info = lapack::heevd( jobz, uplo, n, A_.data, A_.ld, W );
+
+    internal::repack_out( A_, A, col );
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks views, repacks views that don't fit
+/// the chosen layout, and calls the pointer-based routine.
+/// @ingroup views
+///
+template <typename scalar_t>
+int64_t pbsv(
+    BandView< scalar_t > AB,
+    MatrixView< scalar_t > B )
+{
+    int64_t n = AB.n();
+    int64_t nrhs = B.n();
+    lapack_error_if( AB.m() != n );
+    lapack_error_if( AB.kl() != 0 && AB.ku() != 0 );
+    lapack_error_if( B.m() != n );
+
+    Uplo uplo = (AB.kl() == 0 ? Uplo::Upper : Uplo::Lower);
+    int64_t kd = max( AB.kl(), AB.ku() );
+
+    const Layout col = Layout::ColMajor;
+    lapack::vector< scalar_t > work( internal::repack_size( B, col ) );
+    scalar_t* w = work.data();
+    auto B_ = internal::repack_in( B, col, w );
+
+    int64_t info = lapack::pbsv(
+        uplo, n, kd, nrhs, AB.data(), AB.ld(), B_.data, B_.ld );
+
+    internal::repack_out( B_, B, col );
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks views, repacks views that don't fit
+/// the chosen layout, and calls the pointer-based routine.
+/// @ingroup views
+///
+template <typename scalar_t>
+int64_t posv(
+    lapack::Uplo uplo,
+    MatrixView< scalar_t > A,
+    MatrixView< scalar_t > B )
+{
+    int64_t n = A.n();
+    int64_t nrhs = B.n();
+    lapack_error_if( A.m() != n );
+    lapack_error_if( B.m() != n );
+
+    Layout layout = internal::pick_layout( A, B );
+    lapack::vector< scalar_t > work(
+        internal::repack_size( A, layout )
+        + internal::repack_size( B, layout ) );
+    scalar_t* w = work.data();
+    auto A_ = internal::repack_in( A, layout, w );
+    auto B_ = internal::repack_in( B, layout, w );
+
+    int64_t info = lapack::posv(
+        layout, uplo, n, nrhs, A_.data, A_.ld, B_.data, B_.ld );
+
+    internal::repack_out( A_, A, layout );
+    internal::repack_out( B_, B, layout );
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks views, repacks views that don't fit
+/// the chosen layout, and calls the pointer-based routine.
+/// @ingroup views
+///
+template <typename scalar_t>
+int64_t ppsv(
+    PackedView< scalar_t > AP,
+    MatrixView< scalar_t > B )
+{
+    int64_t n = AP.n();
+    int64_t nrhs = B.n();
+    lapack_error_if( B.m() != n );
+
+    const Layout col = Layout::ColMajor;
+    lapack::vector< scalar_t > work( internal::repack_size( B, col ) );
+    scalar_t* w = work.data();
+    auto B_ = internal::repack_in( B, col, w );
+
+    int64_t info = lapack::ppsv(
+        AP.uplo(), n, nrhs, AP.data(), B_.data, B_.ld );
+
+    internal::repack_out( B_, B, col );
+    return info;
+}
+
+}  // namespace impl
+
+//==============================================================================
+/// @ingroup views
+int64_t gels(
+    lapack::Op trans,
+    MatrixView< float > A,
+    MatrixView< float > B )
+{
+    return impl::gels( trans, A, B );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup views
+int64_t gels(
+    lapack::Op trans,
+    MatrixView< double > A,
+    MatrixView< double > B )
+{
+    return impl::gels( trans, A, B );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup views
+int64_t gels(
+    lapack::Op trans,
+    MatrixView< std::complex<float> > A,
+    MatrixView< std::complex<float> > B )
+{
+    return impl::gels( trans, A, B );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::gels that takes matrix views.
+/// B is max( m, n )-by-nrhs, where A is m-by-n.
+///
+/// A column-major A is used in place. For real types, a row-major A is
+/// used in place as the column-major A^T, with trans flipped. Otherwise,
+/// A is repacked into a column-major workspace and copied back on exit.
+/// B is used in place if column-major, else repacked.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] trans
+///     Whether the system involves A or A^H; see lapack::gels.
+///
+/// @param[in,out] A
+///     The m-by-n matrix A. On exit, overwritten by its QR or LQ
+///     factorization, or by that of A^T if A is row-major and real.
+///
+/// @param[in,out] B
+///     The max( m, n )-by-nrhs matrix B. On exit, the solution;
+///     see lapack::gels.
+///
+/// @return = 0: successful exit.
+/// @return > 0: if return value = i, the i-th diagonal element of the
+///     triangular factor of A is zero, so A does not have full rank.
+///
+/// @ingroup views
+int64_t gels(
+    lapack::Op trans,
+    MatrixView< std::complex<double> > A,
+    MatrixView< std::complex<double> > B )
+{
+    return impl::gels( trans, A, B );
+}
+
+//==============================================================================
+/// @ingroup views
+int64_t gesv(
+    MatrixView< float > A,
+    int64_t* ipiv,
+    MatrixView< float > B )
+{
+    return impl::gesv( A, ipiv, B );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup views
+int64_t gesv(
+    MatrixView< double > A,
+    int64_t* ipiv,
+    MatrixView< double > B )
+{
+    return impl::gesv( A, ipiv, B );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup views
+int64_t gesv(
+    MatrixView< std::complex<float> > A,
+    int64_t* ipiv,
+    MatrixView< std::complex<float> > B )
+{
+    return impl::gesv( A, ipiv, B );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::gesv that takes matrix views.
+///
+/// The layout is A's layout if A is column-major or row-major, else B's;
+/// see lapack::gesv( Layout, ... ). Views that don't fit that layout are
+/// repacked into one workspace and copied back on exit.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in,out] A
+///     The n-by-n matrix A. On exit, the factors L and U from A = P L U,
+///     stored in A's layout.
+///
+/// @param[out] ipiv
+///     The vector ipiv of length n. The pivot indices that define P.
+///
+/// @param[in,out] B
+///     The n-by-nrhs matrix B. On successful exit, the solution X.
+///
+/// @return = 0: successful exit.
+/// @return > 0: if return value = i, U(i,i) is exactly zero, so the
+///     solution could not be computed.
+///
+/// @ingroup views
+int64_t gesv(
+    MatrixView< std::complex<double> > A,
+    int64_t* ipiv,
+    MatrixView< std::complex<double> > B )
+{
+    return impl::gesv( A, ipiv, B );
+}
+
+//==============================================================================
+/// @ingroup views
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt,
+    MatrixView< float > A,
+    float* S,
+    MatrixView< float > U,
+    MatrixView< float > VT )
+{
+    return impl::gesvd( jobu, jobvt, A, S, U, VT );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup views
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt,
+    MatrixView< double > A,
+    double* S,
+    MatrixView< double > U,
+    MatrixView< double > VT )
+{
+    return impl::gesvd( jobu, jobvt, A, S, U, VT );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup views
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt,
+    MatrixView< std::complex<float> > A,
+    float* S,
+    MatrixView< std::complex<float> > U,
+    MatrixView< std::complex<float> > VT )
+{
+    return impl::gesvd( jobu, jobvt, A, S, U, VT );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::gesvd that takes matrix views.
+///
+/// The layout is A's layout if A is column-major or row-major, else that
+/// of U (or VT); see lapack::gesvd( Layout, ... ). Views that don't fit
+/// that layout are repacked into one workspace and copied back on exit.
+/// U and VT are not referenced unless computed, so they may be empty views.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] jobu
+///     Whether to compute U; see lapack::gesvd.
+///
+/// @param[in] jobvt
+///     Whether to compute VT; see lapack::gesvd.
+///
+/// @param[in,out] A
+///     The m-by-n matrix A. On exit, destroyed, or overwritten by U or VT
+///     if jobu or jobvt is OverwriteVec.
+///
+/// @param[out] S
+///     The vector S of length min(m,n). The singular values of A,
+///     sorted so that S(i) >= S(i+1).
+///
+/// @param[out] U
+///     If jobu = AllVec, the m-by-m matrix U;
+///     if jobu = SomeVec, the m-by-min(m,n) matrix U.
+///
+/// @param[out] VT
+///     If jobvt = AllVec, the n-by-n matrix V^H;
+///     if jobvt = SomeVec, the min(m,n)-by-n matrix V^H.
+///
+/// @return = 0: successful exit.
+/// @return > 0: if bdsqr did not converge; see lapack::gesvd.
+///
+/// @ingroup views
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt,
+    MatrixView< std::complex<double> > A,
+    double* S,
+    MatrixView< std::complex<double> > U,
+    MatrixView< std::complex<double> > VT )
+{
+    return impl::gesvd( jobu, jobvt, A, S, U, VT );
+}
+
+//==============================================================================
+/// @ingroup views
+int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo,
+    MatrixView< float > A,
+    float* W )
+{
+    return impl::heevd( jobz, uplo, A, W );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup views
+int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo,
+    MatrixView< double > A,
+    double* W )
+{
+    return impl::heevd( jobz, uplo, A, W );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup views
+int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo,
+    MatrixView< std::complex<float> > A,
+    float* W )
+{
+    return impl::heevd( jobz, uplo, A, W );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::heevd that takes a matrix view.
+///
+/// A column-major A is used in place. A row-major A is used in place as
+/// the column-major A^T = conj( A ), with the opposite triangle; its
+/// eigenvectors are then transposed and conjugated in place. Otherwise,
+/// A is repacked into a column-major workspace and copied back on exit.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] jobz
+///     Whether to compute eigenvectors; see lapack::heevd.
+///
+/// @param[in] uplo
+///     Whether the upper or lower triangle of A is stored.
+///
+/// @param[in,out] A
+///     The n-by-n Hermitian matrix A. On exit, if jobz = Vec, the
+///     orthonormal eigenvectors of A, in A's layout; else destroyed.
+///
+/// @param[out] W
+///     The vector W of length n. The eigenvalues in ascending order.
+///
+/// @return = 0: successful exit.
+/// @return > 0: the algorithm failed to converge; see lapack::heevd.
+///
+/// @ingroup views
+int64_t heevd(
+    lapack::Job jobz, lapack::Uplo uplo,
+    MatrixView< std::complex<double> > A,
+    double* W )
+{
+    return impl::heevd( jobz, uplo, A, W );
+}
+
+//==============================================================================
+/// @ingroup views
+int64_t pbsv(
+    BandView< float > AB,
+    MatrixView< float > B )
+{
+    return impl::pbsv( AB, B );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup views
+int64_t pbsv(
+    BandView< double > AB,
+    MatrixView< double > B )
+{
+    return impl::pbsv( AB, B );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup views
+int64_t pbsv(
+    BandView< std::complex<float> > AB,
+    MatrixView< std::complex<float> > B )
+{
+    return impl::pbsv( AB, B );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::pbsv that takes views.
+/// The band view stores the upper triangle if AB.kl() = 0,
+/// else the lower triangle, with AB.ku() = 0; kd is the other bandwidth.
+/// AB is always used in place; B is repacked if not column-major.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in,out] AB
+///     The n-by-n Hermitian positive definite band matrix A. On
+///     successful exit, its Cholesky factor, as in lapack::pbsv.
+///
+/// @param[in,out] B
+///     The n-by-nrhs matrix B. On successful exit, the solution X.
+///
+/// @return = 0: successful exit.
+/// @return > 0: if return value = i, the leading minor of order i of A
+///     is not positive definite.
+///
+/// @ingroup views
+int64_t pbsv(
+    BandView< std::complex<double> > AB,
+    MatrixView< std::complex<double> > B )
+{
+    return impl::pbsv( AB, B );
+}
+
+//==============================================================================
+/// @ingroup views
+int64_t posv(
+    lapack::Uplo uplo,
+    MatrixView< float > A,
+    MatrixView< float > B )
+{
+    return impl::posv( uplo, A, B );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup views
+int64_t posv(
+    lapack::Uplo uplo,
+    MatrixView< double > A,
+    MatrixView< double > B )
+{
+    return impl::posv( uplo, A, B );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup views
+int64_t posv(
+    lapack::Uplo uplo,
+    MatrixView< std::complex<float> > A,
+    MatrixView< std::complex<float> > B )
+{
+    return impl::posv( uplo, A, B );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::posv that takes matrix views.
+///
+/// The layout is A's layout if A is column-major or row-major, else B's;
+/// see lapack::posv( Layout, ... ). Views that don't fit that layout are
+/// repacked into one workspace and copied back on exit.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     Whether the upper or lower triangle of A is stored.
+///
+/// @param[in,out] A
+///     The n-by-n Hermitian positive definite matrix A. On successful
+///     exit, its Cholesky factor, in the uplo triangle.
+///
+/// @param[in,out] B
+///     The n-by-nrhs matrix B. On successful exit, the solution X.
+///
+/// @return = 0: successful exit.
+/// @return > 0: if return value = i, the leading minor of order i of A
+///     is not positive definite.
+///
+/// @ingroup views
+int64_t posv(
+    lapack::Uplo uplo,
+    MatrixView< std::complex<double> > A,
+    MatrixView< std::complex<double> > B )
+{
+    return impl::posv( uplo, A, B );
+}
+
+//==============================================================================
+/// @ingroup views
+int64_t ppsv(
+    PackedView< float > AP,
+    MatrixView< float > B )
+{
+    return impl::ppsv( AP, B );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup views
+int64_t ppsv(
+    PackedView< double > AP,
+    MatrixView< double > B )
+{
+    return impl::ppsv( AP, B );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup views
+int64_t ppsv(
+    PackedView< std::complex<float> > AP,
+    MatrixView< std::complex<float> > B )
+{
+    return impl::ppsv( AP, B );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::ppsv that takes views.
+/// AP is always used in place; B is repacked if not column-major.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in,out] AP
+///     The n-by-n Hermitian positive definite matrix A, packed. On
+///     successful exit, its Cholesky factor, packed.
+///
+/// @param[in,out] B
+///     The n-by-nrhs matrix B. On successful exit, the solution X.
+///
+/// @return = 0: successful exit.
+/// @return > 0: if return value = i, the leading minor of order i of A
+///     is not positive definite.
+///
+/// @ingroup views
+int64_t ppsv(
+    PackedView< std::complex<double> > AP,
+    MatrixView< std::complex<double> > B )
+{
+    return impl::ppsv( AP, B );
+}
+
+}  // namespace lapack
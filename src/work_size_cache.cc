@@ -0,0 +1,165 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/workspace.hh"
+#include "lapack_internal.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+namespace lapack {
+
+namespace {
+
+//------------------------------------------------------------------------------
+struct KeyHash
+{
+    std::size_t operator () ( internal::WorkSizeKey const* key ) const
+    {
+        // FNV-1a over routine name and arguments.
+        std::size_t h = 14695981039346656037ull;
+        for (char const* c = key->routine; *c != '\0'; ++c)
+            h = (h ^ std::size_t( *c )) * 1099511628211ull;
+        for (int i = 0; i < key->nargs; ++i)
+            h = (h ^ std::size_t( key->args[ i ] )) * 1099511628211ull;
+        return h;
+    }
+};
+
+//------------------------------------------------------------------------------
+struct KeyEqual
+{
+    bool operator () ( internal::WorkSizeKey const* a,
+                       internal::WorkSizeKey const* b ) const
+    {
+        return a->nargs == b->nargs
+            && std::strcmp( a->routine, b->routine ) == 0
+            && std::equal( a->args, a->args + a->nargs, b->args );
+    }
+};
+
+//------------------------------------------------------------------------------
+struct Entry
+{
+    internal::WorkSizeKey key;
+    int64_t sizes[ 3 ];
+};
+
+//------------------------------------------------------------------------------
+// LRU cache: list is ordered from most to least recently used;
+// map points from key (stored in the list entry) to list entry.
+struct Cache
+{
+    std::mutex mutex;
+    std::atomic< int64_t > capacity{ 0 };
+    int64_t hits   = 0;
+    int64_t misses = 0;
+    std::list< Entry > lru;
+    std::unordered_map< internal::WorkSizeKey const*,
+                        std::list< Entry >::iterator,
+                        KeyHash, KeyEqual > map;
+};
+
+Cache& cache()
+{
+    static Cache cache_;
+    return cache_;
+}
+
+}  // namespace
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+bool work_size_cache_find(
+    WorkSizeKey const& key,
+    int64_t* size1, int64_t* size2, int64_t* size3 )
+{
+    Cache& c = cache();
+    if (c.capacity.load( std::memory_order_relaxed ) == 0)
+        return false;
+
+    std::lock_guard< std::mutex > lock( c.mutex );
+    auto iter = c.map.find( &key );
+    if (iter == c.map.end()) {
+        ++c.misses;
+        return false;
+    }
+    ++c.hits;
+    c.lru.splice( c.lru.begin(), c.lru, iter->second );
+    int64_t const* sizes = iter->second->sizes;
+    *size1 = sizes[ 0 ];
+    if (size2)
+        *size2 = sizes[ 1 ];
+    if (size3)
+        *size3 = sizes[ 2 ];
+    return true;
+}
+
+//------------------------------------------------------------------------------
+void work_size_cache_insert(
+    WorkSizeKey const& key,
+    int64_t size1, int64_t size2, int64_t size3 )
+{
+    Cache& c = cache();
+    if (c.capacity.load( std::memory_order_relaxed ) == 0)
+        return;
+
+    std::lock_guard< std::mutex > lock( c.mutex );
+    auto iter = c.map.find( &key );
+    if (iter != c.map.end()) {
+        // Another thread inserted it after our miss.
+        c.lru.splice( c.lru.begin(), c.lru, iter->second );
+        return;
+    }
+    while (int64_t( c.lru.size() ) >= c.capacity && ! c.lru.empty()) {
+        c.map.erase( &c.lru.back().key );
+        c.lru.pop_back();
+    }
+    c.lru.push_front( Entry{ key, { size1, size2, size3 } } );
+    c.map.emplace( &c.lru.front().key, c.lru.begin() );
+}
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+void work_size_cache_set_capacity( int64_t capacity )
+{
+    lapack_error_if( capacity < 0 );
+
+    Cache& c = cache();
+    std::lock_guard< std::mutex > lock( c.mutex );
+    c.capacity.store( capacity, std::memory_order_relaxed );
+    while (int64_t( c.lru.size() ) > capacity) {
+        c.map.erase( &c.lru.back().key );
+        c.lru.pop_back();
+    }
+}
+
+//------------------------------------------------------------------------------
+WorkSizeCacheStats work_size_cache_stats()
+{
+    Cache& c = cache();
+    std::lock_guard< std::mutex > lock( c.mutex );
+    return WorkSizeCacheStats{ c.hits, c.misses, int64_t( c.lru.size() ),
+                               c.capacity.load( std::memory_order_relaxed ) };
+}
+
+//------------------------------------------------------------------------------
+void work_size_cache_clear()
+{
+    Cache& c = cache();
+    std::lock_guard< std::mutex > lock( c.mutex );
+    c.map.clear();
+    c.lru.clear();
+    c.hits   = 0;
+    c.misses = 0;
+}
+
+}  // namespace lapack
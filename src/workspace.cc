@@ -0,0 +1,279 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/workspace.hh"
+#include "NoConstructAllocator.hh"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace lapack {
+
+namespace {
+
+// Alignment of arena chunks and of each allocation within a chunk;
+// same as NoConstructAllocator.
+const std::size_t align = 64;
+
+// Smallest chunk the arena allocates, in bytes.
+const std::size_t min_chunk = std::size_t( 64 ) << 10;
+
+//------------------------------------------------------------------------------
+// Rounds bytes up to a positive multiple of align, so every allocation
+// has a distinct address inside its chunk.
+inline std::size_t round_up( std::size_t bytes )
+{
+    return (std::max( bytes, std::size_t( 1 ) ) + align - 1) / align * align;
+}
+
+//------------------------------------------------------------------------------
+// Allocates aligned memory; returns nullptr on failure.
+void* aligned_alloc_( std::size_t bytes )
+{
+    void* ptr = nullptr;
+    #if defined( _WIN32 ) || defined( _WIN64 )
+        ptr = _aligned_malloc( bytes, align );
+    #else
+        if (posix_memalign( &ptr, align, bytes ) != 0)
+            ptr = nullptr;
+    #endif
+    return ptr;
+}
+
+//------------------------------------------------------------------------------
+void aligned_free_( void* ptr )
+{
+    #if defined( _WIN32 ) || defined( _WIN64 )
+        _aligned_free( ptr );
+    #else
+        free( ptr );
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// Thread-local bump-pointer arena. Memory is allocated from the top of
+// the last chunk and popped when freed in reverse order. When all
+// allocations are freed, the arena resets and coalesces its chunks,
+// so the next round of allocations fits in one chunk.
+struct Arena
+{
+    struct Chunk {
+        char* data;
+        std::size_t size;
+    };
+
+    int depth = 0;              // number of nested WorkspaceScope
+    std::size_t max_bytes = 0;  // cap on capacity
+    std::size_t capacity = 0;   // sum of chunk sizes
+    std::size_t offset = 0;     // top of last chunk
+    int64_t live = 0;           // number of outstanding allocations
+    std::vector< Chunk > chunks;
+
+    ~Arena()
+    {
+        release();
+    }
+
+    //----------------------------------------
+    void* allocate( std::size_t bytes )
+    {
+        bytes = round_up( bytes );
+        if (! chunks.empty() && bytes <= chunks.back().size - offset) {
+            void* ptr = chunks.back().data + offset;
+            offset += bytes;
+            ++live;
+            return ptr;
+        }
+
+        // Need a new chunk; grow geometrically, but stay within max_bytes.
+        if (bytes > max_bytes - std::min( capacity, max_bytes ))
+            return nullptr;
+        std::size_t size = std::max( bytes, std::max( capacity, min_chunk ) );
+        size = std::min( size, max_bytes - capacity );
+        char* data = static_cast<char*>( aligned_alloc_( size ) );
+        if (data == nullptr)
+            return nullptr;
+        chunks.push_back( Chunk{ data, size } );
+        capacity += size;
+        offset = bytes;
+        ++live;
+        return data;
+    }
+
+    //----------------------------------------
+    // Returns true if ptr was allocated from the arena.
+    bool deallocate( void* ptr, std::size_t bytes )
+    {
+        char* p = static_cast<char*>( ptr );
+        auto iter = std::find_if(
+            chunks.rbegin(), chunks.rend(),
+            [p]( Chunk const& c ) { return c.data <= p && p < c.data + c.size; } );
+        if (iter == chunks.rend())
+            return false;
+
+        bytes = round_up( bytes );
+        if (iter == chunks.rbegin() && p + bytes == iter->data + offset)
+            offset -= bytes;
+
+        --live;
+        if (live == 0) {
+            offset = 0;
+            if (depth == 0) {
+                release();
+            }
+            else if (chunks.size() > 1) {
+                // Replace chunks with one chunk of the same total size.
+                std::size_t total = capacity;
+                release();
+                char* data = static_cast<char*>( aligned_alloc_( total ) );
+                if (data != nullptr) {
+                    chunks.push_back( Chunk{ data, total } );
+                    capacity = total;
+                }
+            }
+        }
+        return true;
+    }
+
+    //----------------------------------------
+    void release()
+    {
+        for (auto& c : chunks)
+            aligned_free_( c.data );
+        chunks.clear();
+        capacity = 0;
+        offset = 0;
+    }
+};
+
+thread_local Arena arena;
+
+// Innermost WorkspaceLend on this thread, or nullptr.
+thread_local internal::WorkspaceLend* lend = nullptr;
+
+}  // namespace
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Returns memory from this thread's workspace arena, or nullptr if no
+// WorkspaceScope is active or the arena is full. Called by
+// NoConstructAllocator.
+void* workspace_allocate( std::size_t bytes )
+{
+    if (lend != nullptr) {
+        void* ptr = lend->allocate( bytes );
+        if (ptr != nullptr)
+            return ptr;
+    }
+    if (arena.depth == 0)
+        return nullptr;
+    return arena.allocate( bytes );
+}
+
+//------------------------------------------------------------------------------
+// Returns true if ptr came from this thread's workspace arena, which
+// takes it back; otherwise false, and the caller frees it.
+bool workspace_deallocate( void* ptr, std::size_t bytes )
+{
+    if (lend != nullptr && lend->deallocate( ptr, bytes ))
+        return true;
+    if (arena.chunks.empty())
+        return false;
+    return arena.deallocate( ptr, bytes );
+}
+
+//------------------------------------------------------------------------------
+WorkspaceLend::WorkspaceLend( void* data, std::size_t bytes )
+    : demand_( 0 ),
+      peak_( 0 ),
+      live_( 0 ),
+      prev_( lend )
+{
+    // Align the start; the end need not be aligned.
+    std::uintptr_t addr = reinterpret_cast< std::uintptr_t >( data );
+    std::uintptr_t aligned = (addr + align - 1) / align * align;
+    begin_ = static_cast< char* >( data ) + (aligned - addr);
+    end_ = static_cast< char* >( data ) + bytes;
+    if (data == nullptr || begin_ > end_)
+        begin_ = end_ = static_cast< char* >( data );
+    top_ = begin_;
+    lend = this;
+}
+
+//------------------------------------------------------------------------------
+WorkspaceLend::~WorkspaceLend()
+{
+    lend = prev_;
+}
+
+//------------------------------------------------------------------------------
+// Returns memory from the lent buffer, or nullptr if it does not fit.
+// Either way, the request counts toward peak().
+void* WorkspaceLend::allocate( std::size_t bytes )
+{
+    bytes = round_up( bytes );
+    demand_ += bytes;
+    peak_ = std::max( peak_, demand_ );
+    if (bytes > std::size_t( end_ - top_ ))
+        return nullptr;
+    void* ptr = top_;
+    top_ += bytes;
+    ++live_;
+    return ptr;
+}
+
+//------------------------------------------------------------------------------
+// Returns true if ptr came from the lent buffer. Memory is reclaimed
+// when freed in reverse order, or when all of it is freed. Only those
+// blocks reduce the demand; requests that did not fit stay counted,
+// so peak() may overestimate, but never underestimates.
+bool WorkspaceLend::deallocate( void* ptr, std::size_t bytes )
+{
+    char* p = static_cast< char* >( ptr );
+    if (p < begin_ || p >= end_)
+        return false;
+
+    bytes = round_up( bytes );
+    demand_ -= std::min( demand_, bytes );
+    if (p + bytes == top_)
+        top_ = p;
+    --live_;
+    if (live_ == 0)
+        top_ = begin_;
+    return true;
+}
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+WorkspaceScope::WorkspaceScope( std::size_t max_bytes )
+{
+    if (arena.depth == 0)
+        arena.max_bytes = max_bytes;
+    ++arena.depth;
+}
+
+//------------------------------------------------------------------------------
+WorkspaceScope::~WorkspaceScope()
+{
+    --arena.depth;
+    if (arena.depth == 0 && arena.live == 0)
+        arena.release();
+}
+
+//------------------------------------------------------------------------------
+std::size_t WorkspaceScope::capacity() const
+{
+    return arena.capacity;
+}
+
+//------------------------------------------------------------------------------
+std::size_t WorkspaceScope::max_bytes() const
+{
+    return arena.max_bytes;
+}
+
+}  // namespace lapack
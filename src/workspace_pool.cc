@@ -0,0 +1,90 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/device.hh"
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+namespace lapack {
+
+namespace {
+
+// Allocations are rounded up to a multiple of this, so small
+// variations in requested size reuse the buffer.
+const size_t granularity = 256;
+
+} // namespace
+
+//------------------------------------------------------------------------------
+WorkspacePool::WorkspacePool( alloc_func alloc, release_func release )
+    : alloc_( std::move( alloc ) ),
+      release_( std::move( release ) )
+{
+    lapack_error_if( ! alloc_ );
+    lapack_error_if( ! release_ );
+}
+
+//------------------------------------------------------------------------------
+WorkspacePool::~WorkspacePool()
+{
+    trim();
+}
+
+//------------------------------------------------------------------------------
+/// @return buffer of at least bytes. If the current buffer is smaller,
+/// releases it and allocates a larger one. For bytes = 0, returns the
+/// current buffer, which may be nullptr.
+void* WorkspacePool::get( size_t bytes )
+{
+    high_water_ = std::max( high_water_, bytes );
+    if (bytes > size_) {
+        trim();
+        size_t size = (bytes + granularity - 1) / granularity * granularity;
+        ptr_ = alloc_( size );
+        if (ptr_ == nullptr)
+            throw std::bad_alloc();
+        size_ = size;
+        ++num_allocs_;
+    }
+    return ptr_;
+}
+
+//------------------------------------------------------------------------------
+/// Releases the buffer. The high-water mark is kept.
+void WorkspacePool::trim()
+{
+    if (ptr_ != nullptr) {
+        void* ptr = ptr_;
+        ptr_  = nullptr;
+        size_ = 0;
+        release_( ptr );
+    }
+}
+
+//------------------------------------------------------------------------------
+// Device workspace is from lapack::device_malloc, which is host memory
+// for the host backend. Host workspace is from malloc.
+void* Queue::workspace_alloc( size_t bytes, bool device )
+{
+    if (device)
+        return lapack::device_malloc< char >( bytes, *this );
+    else
+        return std::malloc( bytes );
+}
+
+//------------------------------------------------------------------------------
+// Waits for routines that may still use the workspace, then frees it.
+void Queue::workspace_release( void* ptr, bool device )
+{
+    sync();
+    if (device)
+        lapack::device_free( ptr, *this );
+    else
+        std::free( ptr );
+}
+
+} // namespace lapack
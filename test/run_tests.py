@@ -138,6 +138,8 @@ group_opt.add_argument( '--vu',     action='store', help='default=%(default)s',
 group_opt.add_argument( '--il',     action='store', help='default=%(default)s', default='10' )
 group_opt.add_argument( '--iu',     action='store', help='default=%(default)s', default='-1,100' )
 group_opt.add_argument( '--nb',     action='store', help='default=%(default)s', default='64' )
+group_opt.add_argument( '--lookahead', action='store', help='default=%(default)s', default='0,1,2' )
+group_opt.add_argument( '--batch',  action='store', help='default=%(default)s', default='100' )
 group_opt.add_argument( '--matrixtype', action='store', help='default=%(default)s', default='g,l,u' )
 
 parser.add_argument( 'tests', nargs=argparse.REMAINDER )
@@ -310,6 +312,8 @@ sense  = ' --sense '  + opts.sense  if (opts.sense)  else ''
 vect   = ' --vect '   + opts.vect   if (opts.vect)   else ''
 l      = ' --l '      + opts.l      if (opts.l)      else ''
 nb     = ' --nb '     + opts.nb     if (opts.nb)     else ''
+lookahead = ' --lookahead ' + opts.lookahead if (opts.lookahead) else ''
+batch  = ' --batch '  + opts.batch  if (opts.batch)  else ''
 ka     = ' --ka '     + opts.ka     if (opts.ka)     else ''
 kb     = ' --kb '     + opts.kb     if (opts.kb)     else ''
 kd     = ' --kd '     + opts.kd     if (opts.kd)     else ''
@@ -353,21 +357,26 @@ cmds = []
 # LU
 if (opts.lu and opts.host):
     cmds += [
-    [ 'gesv',  gen + dtype + align + n ],
+    [ 'gesv',  gen + dtype + align + n + layout ],
     # todo: equed
     [ 'gesvx', gen + dtype + align + n + factored + trans ],
     [ 'getrf', gen + dtype + align + mn ],
+    [ 'getrf', gen + dtype + align + mn + ' --method native' + nb + lookahead ],
     [ 'getrs', gen + dtype + align + n + trans ],
     [ 'getri', gen + dtype + align + n ],
     [ 'gecon', gen + dtype + align + n ],
     [ 'gerfs', gen + dtype + align + n + trans ],
     [ 'geequ', gen + dtype + align + n ],
+    [ 'gesv_batch',  gen + dtype + align + n + batch ],
+    [ 'gesv_mixed',  gen + dtype + align + n + ' --inner s,b,h --refine c,g' ],
+    [ 'getrf_batch', gen + dtype + align + n + trans + batch ],
     ]
 
 if (opts.lu and opts.device):
     # GPU
     cmds += [
     [ 'dev-getrf', gen + dtype + align + n ],
+    [ 'dev-getrs', gen + dtype + align + n + trans ],
     ]
 
 # General Banded
@@ -394,13 +403,18 @@ if (opts.gt and opts.host):
 # Cholesky
 if (opts.chol and opts.host):
     cmds += [
-    [ 'posv',  gen + dtype + align + n + uplo ],
+    [ 'posv',  gen + dtype + align + n + uplo + layout ],
     [ 'potrf', gen + dtype + align + n + uplo ],
+    [ 'potrf', gen + dtype + align + n + uplo + ' --method-chol tiled' + nb ],
     [ 'potrs', gen + dtype + align + n + uplo ],
     [ 'potri', gen + dtype + align + n + uplo ],
     [ 'pocon', gen + dtype + align + n + uplo ],
     [ 'porfs', gen + dtype + align + n + uplo ],
     [ 'poequ', gen + dtype + align + n ],  # only diagonal elements (no uplo)
+    [ 'posv_batch',  gen + dtype + align + n + uplo + batch ],
+    [ 'posv_mixed',  gen + dtype + align + n + uplo + ' --inner s,b,h --refine c,g' ],
+    [ 'potrf_batch', gen + dtype + align + n + uplo + batch ],
+    [ 'potrf_update', gen + dtype + align + n + uplo + ' --nrhs 1,5' ],
 
     # Packed
     [ 'ppsv',  gen + dtype + align + n + uplo ],
@@ -431,6 +445,8 @@ if (opts.chol and opts.device):
     # GPU
     cmds += [
     [ 'dev-potrf', gen + dtype + align + n + uplo ],
+    [ 'dev-potrs', gen + dtype + align + n + uplo ],
+    [ 'dev-potri', gen + dtype + align + n + uplo ],
     ]
 
 # symmetric indefinite, Bunch-Kaufman
@@ -505,11 +521,14 @@ if (opts.hesv and opts.host):
 if (opts.least_squares and opts.host):
     cmds += [
     [ 'gels',   gen + dtype + align + mn + trans_nc ],
+    [ 'gels_stream', gen + dtype + align + tall + nb ],
+    [ 'gels_mixed',  gen + dtype + align + tall + ' --inner s,b,h --refine c,g' ],
     [ 'gelsy',  gen + dtype + align + mn ],
     # todo: gelsd is failing
     #[ 'gelsd',  gen + dtype + align + mn ],
     [ 'gelss',  gen + dtype + align + mn ],
     [ 'getsls', gen + dtype + align + mn + trans_nc ],
+    [ 'gels_batch', gen + dtype + align + mn + trans_nc + batch ],
 
     # Generalized
     [ 'gglse', gen + dtype + align + mnk ],
@@ -521,7 +540,10 @@ if (opts.least_squares and opts.host):
 if (opts.qr and opts.host):
     cmds += [
     [ 'geqr',  gen + dtype + align + n + wide + tall ],
-    [ 'geqrf', gen + dtype + align + n + wide + tall ],
+    [ 'geqrf', gen + dtype + align + n + wide + tall + layout ],
+    [ 'geqrf_batch', gen + dtype + align + n + wide + tall + batch ],
+    [ 'geqrf_update', gen + dtype + align + n + tall + ' --nrhs 1,5' ],
+    [ 'tsqr',  gen + dtype + align + tall + ' --nb 50,500' ],  # nb >= n
     # todo: ggqrf is failing
     #[ 'ggqrf', gen + dtype + align + mnk ],
     [ 'ungqr', gen + dtype + align + mn ],  # m >= n
@@ -546,6 +568,9 @@ if (opts.qr and opts.device):
     # GPU
     cmds += [
     [ 'dev-geqrf', gen + dtype + align + n + wide + tall ],
+    [ 'dev-ungqr', gen + dtype + align + mn ],  # m >= n
+    [ 'dev-unmqr', gen + dtype_real    + align + mnk + side + trans    ],  # real does trans = N, T, C
+    [ 'dev-unmqr', gen + dtype_complex + align + mnk + side + trans_nc ],  # complex does trans = N, C, not T
     ]
 
 # LQ
@@ -592,6 +617,7 @@ if (opts.syev and opts.host):
     [ 'heevx', gen + dtype + align + n + jobz + uplo + vl + vu ],
     [ 'heevx', gen + dtype + align + n + jobz + uplo + il + iu ],
     [ 'heevd', gen + dtype + align + n + jobz + uplo ],
+    [ 'heevd_batch', gen + dtype + align + n + jobz + uplo + batch ],
     [ 'heevr', gen + dtype + align + n + jobz + uplo + vl + vu ],
     [ 'heevr', gen + dtype + align + n + jobz + uplo + il + iu ],
     [ 'hetrd', gen + dtype + align + n + uplo ],
@@ -629,6 +655,7 @@ if (opts.syev and opts.device):
     # GPU
     cmds += [
     [ 'dev-heevd', gen + dtype + align + n + jobz + uplo ],
+    [ 'dev-heevj', gen + dtype + align + n + jobz + uplo ],
     ]
 
 # generalized symmetric eigenvalues
@@ -681,9 +708,12 @@ if (opts.svd and opts.host):
     # todo: MKL seems to have a bug with jobu=o,s and jobvt=o,s,a
     # for tall matrices, e.g., dim=100x50. Skip failing combinations for now.
     #[ 'gesvd',         gen + dtype + align + mn + jobu + jobvt ],
-    [ 'gesvd',         gen + dtype + align + mn + " --jobu n,a" + jobvt ],
-    [ 'gesvd',         gen + dtype + align + mn + " --jobu o,s --jobvt n" ],
+    [ 'gesvd',         gen + dtype + align + mn + " --jobu n,a" + jobvt + layout ],
+    [ 'gesvd',         gen + dtype + align + mn + " --jobu o,s --jobvt n" + layout ],
     [ 'gesdd',         gen + dtype + align + mn + jobu ],
+    [ 'gesvd_batch',   gen + dtype + align + mn + " --jobu n,a" + jobvt + batch ],
+    [ 'gesvd_batch',   gen + dtype + align + mn + " --jobu o,s --jobvt n" + batch ],
+    [ 'gesdd_batch',   gen + dtype + align + mn + jobu + batch ],
     # todo: gesvdx is failing
     #[ 'gesvdx',        gen + dtype + align + mn + jobz + jobvr + vl + vu ],
     #[ 'gesvdx',        gen + dtype + align + mn + jobz + jobvr + il + iu ],
@@ -694,6 +724,13 @@ if (opts.svd and opts.host):
     #[ 'gesvj',         gen + dtype + align + mn + joba + jobu + jobv ],
     ]
 
+if (opts.svd and opts.device):
+    # GPU
+    cmds += [
+    [ 'dev-gesvd', gen + dtype + align + mn + " --jobu n,a" + jobvt ],
+    [ 'dev-gesvd', gen + dtype + align + mn + " --jobu o,s --jobvt n" ],
+    ]
+
 # auxilary
 if (opts.aux and opts.host):
     cmds += [
@@ -701,6 +738,33 @@ if (opts.aux and opts.host):
     [ 'laed4', gen + dtype_real + n ],
     [ 'laset', gen + dtype + align + mn + mtype ],
     [ 'laswp', gen + dtype + align + mn ],
+
+    # lapack::fixed< N > kernels, for n <= 16
+    [ 'fixed', gen + dtype + align + (dim or ' --dim 1:16:1') + trans + uplo + diag + batch ],
+
+    # drivers taking lapack::MatrixView, BandView, PackedView
+    [ 'views', gen + dtype + align + mn + trans + uplo + kd ],
+
+    # factorization objects lapack::LU, Cholesky, LDLT, QR
+    [ 'factor', gen + dtype + align + mn + trans + uplo ],
+
+    # thread control lapack::set_num_threads, ThreadScope
+    [ 'threads', gen + dtype + align + n ],
+
+    # asynchronous lapack::HostStream
+    [ 'host_stream', gen + dtype + align + n + uplo + batch ],
+
+    # workspace size cache lapack::work_size_cache_set_capacity, stats
+    [ 'work_size_cache', dtype + mn ],
+
+    # workspace arena lapack::WorkspaceScope
+    [ 'workspace', gen + dtype + align + n ],
+
+    # lapack::Queue workspace pool
+    [ 'workspace_pool', gen + dtype + align + n ],
+
+    # wrapper call tracing lapack::trace
+    [ 'trace', gen + dtype + align + n + uplo ],
     ]
 
 # auxilary - householder
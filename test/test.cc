@@ -41,6 +41,10 @@ using lapack::Pivot,      lapack::Pivot_help;
 using lapack::Direction,  lapack::Direction_help;
 using lapack::StoreV,     lapack::StoreV_help;
 using lapack::Equed,      lapack::Equed_help;
+using lapack::MethodLU,   lapack::MethodLU_help;
+using lapack::MethodCholesky, lapack::MethodCholesky_help;
+using lapack::InnerPrecision, lapack::InnerPrecision_help;
+using lapack::MethodRefine, lapack::MethodRefine_help;
 
 const ParamType PT_Value = ParamType::Value;
 const ParamType PT_List  = ParamType::List;
@@ -136,6 +140,11 @@ std::vector< testsweeper::routines_t > routines = {
     { "gbequ",              test_gbequ,     Section::gesv },
     { "",                   nullptr,        Section::newline },
 
+    { "gesv_batch",         test_gesv_batch,  Section::gesv },
+    { "gesv_mixed",         test_gesv_mixed,  Section::gesv },
+    { "getrf_batch",        test_getrf_batch, Section::gesv },
+    { "",                   nullptr,          Section::newline },
+
     // -----
     // Cholesky
     { "posv",               test_posv,      Section::posv },
@@ -177,6 +186,12 @@ std::vector< testsweeper::routines_t > routines = {
     { "pbequ",              test_pbequ,     Section::posv },
     { "",                   nullptr,        Section::newline },
 
+    { "posv_batch",         test_posv_batch,  Section::posv },
+    { "posv_mixed",         test_posv_mixed,  Section::posv },
+    { "potrf_batch",        test_potrf_batch, Section::posv },
+    { "potrf_update",       test_potrf_update, Section::posv },
+    { "",                   nullptr,          Section::newline },
+
     // -----
     // symmetric indefinite
     { "sysv",               test_sysv,      Section::sysv }, // tested via LAPACKE
@@ -255,12 +270,17 @@ std::vector< testsweeper::routines_t > routines = {
     // -----
     // least squares
     { "gels",               test_gels,      Section::gels }, // tested via LAPACKE using gcc/MKL
+    { "gels_stream",        test_gels_stream, Section::gels }, // tested numerically
+    { "gels_mixed",         test_gels_mixed,  Section::gels },
     { "gelsy",              test_gelsy,     Section::gels }, // tested via LAPACKE using gcc/MKL TODO jpvt[i]=i rcond=0
     { "gelsd",              test_gelsd,     Section::gels }, // TODO: Segfaults for some Z sizes. src/gelsd.cc:275 lrwork_ too small?
     { "gelss",              test_gelss,     Section::gels }, // tested via LAPACKE using gcc/MKL TODO rcond=n
     { "getsls",             test_getsls,    Section::gels }, // tested via LAPACKE using gcc/MKL
     { "",                   nullptr,        Section::newline },
 
+    { "gels_batch",         test_gels_batch, Section::gels },
+    { "",                   nullptr,         Section::newline },
+
     { "gglse",              test_gglse,     Section::gels }, // tested via LAPACKE using gcc/MKL
     { "ggglm",              test_ggglm,     Section::gels }, // tested via LAPACKE using gcc/MKL
     { "",                   nullptr,        Section::newline },
@@ -273,8 +293,13 @@ std::vector< testsweeper::routines_t > routines = {
     { "geqlf",              test_geqlf,     Section::qr }, // tested numerically
     { "gerqf",              test_gerqf,     Section::qr }, // tested numerically; R, Q are full sizeof(A), could be smaller
     { "gemqrt",             test_gemqrt,    Section::qr }, // tested via LAPACKE
+    { "tsqr",               test_tsqr,      Section::qr }, // tested numerically
     { "",                   nullptr,        Section::newline },
 
+    { "geqrf_batch",        test_geqrf_batch, Section::qr },
+    { "geqrf_update",       test_geqrf_update, Section::qr },
+    { "",                   nullptr,          Section::newline },
+
     { "ggqrf",              test_ggqrf,     Section::qr }, // tested via LAPACKE using gcc/MKL, TODO for now use p=param.k
     //{ "gglqf",              test_gglqf,     Section::qr }, // TODO No automagic generation.  No src
     { "",                   nullptr,        Section::qr }, // space for gglqf
@@ -328,6 +353,7 @@ std::vector< testsweeper::routines_t > routines = {
     { "",                   nullptr,        Section::newline },
 
     { "heevd",              test_heevd,     Section::heev }, // backward error check
+    { "heevd_batch",        test_heevd_batch, Section::heev },
     { "hpevd",              test_hpevd,     Section::heev }, // tested via LAPACKE using gcc/MKL
     { "hbevd",              test_hbevd,     Section::heev }, // tested via LAPACKE using gcc/MKL
     { "",                   nullptr,        Section::newline },
@@ -406,10 +432,12 @@ std::vector< testsweeper::routines_t > routines = {
     // -----
     // driver: singular value decomposition
     { "gesvd",              test_gesvd,         Section::svd },
+    { "gesvd_batch",        test_gesvd_batch,   Section::svd },
     //{ "gesvd_2stage",       test_gesvd_2stage,  Section::svd }, // TODO No src
     { "",                   nullptr,            Section::newline },
 
     { "gesdd",              test_gesdd,         Section::svd },
+    { "gesdd_batch",        test_gesdd_batch,   Section::svd },
     //{ "gesdd_2stage",       test_gesdd_2stage,  Section::svd }, // TODO No src
     { "",                   nullptr,            Section::newline },
 
@@ -429,6 +457,17 @@ std::vector< testsweeper::routines_t > routines = {
     { "laswp",              test_laswp,     Section::aux },
     { "",                   nullptr,        Section::newline },
 
+    { "fixed",              test_fixed,     Section::aux },  // lapack::fixed< N >
+    { "views",              test_views,     Section::aux },  // lapack::MatrixView, etc.
+    { "factor",             test_factor,    Section::aux },  // lapack::LU, Cholesky, LDLT, QR
+    { "threads",            test_threads,   Section::aux },  // lapack::ThreadScope
+    { "host_stream",        test_host_stream, Section::aux },  // lapack::HostStream
+    { "work_size_cache",    test_work_size_cache, Section::aux },  // lapack::work_size_cache_*
+    { "workspace",          test_workspace, Section::aux },  // lapack::WorkspaceScope
+    { "workspace_pool",     test_workspace_pool, Section::aux },  // lapack::Queue workspace
+    { "trace",              test_trace,     Section::aux },  // lapack::trace
+    { "",                   nullptr,        Section::newline },
+
     // auxiliary: Householder
     { "larfg",              test_larfg,     Section::aux_householder },
     { "larfgp",             test_larfgp,    Section::aux_householder },
@@ -484,6 +523,13 @@ std::vector< testsweeper::routines_t > routines = {
     { "dev-getrf",          test_getrf_device,  Section::gpu },
     { "dev-geqrf",          test_geqrf_device,  Section::gpu },
     { "dev-heevd",          test_heevd_device,  Section::gpu },
+    { "dev-getrs",          test_getrs_device,  Section::gpu },
+    { "dev-potrs",          test_potrs_device,  Section::gpu },
+    { "dev-potri",          test_potri_device,  Section::gpu },
+    { "dev-unmqr",          test_unmqr_device,  Section::gpu },
+    { "dev-ungqr",          test_ungqr_device,  Section::gpu },
+    { "dev-gesvd",          test_gesvd_device,  Section::gpu },
+    { "dev-heevj",          test_heevj_device,  Section::gpu },
     { "",                   nullptr,            Section::newline },
 };
 
@@ -536,6 +582,10 @@ Params::Params():
     direction ( "direction",  8, PT_List, Direction::Forward, Direction_help ),
     storev    ( "storev",     7, PT_List, StoreV::Columnwise, StoreV_help ),
     equed     ( "equed",      5, PT_List, Equed::Both, Equed_help ),
+    method_lu ( "method",     6, PT_List, MethodLU::Lapack, MethodLU_help ),
+    method_chol( "method-chol", 11, PT_List, MethodCholesky::Lapack, MethodCholesky_help ),
+    inner     ( "inner",      8, PT_List, InnerPrecision::Single, InnerPrecision_help ),
+    refine    ( "refine",     9, PT_List, MethodRefine::GMRES, MethodRefine_help ),
 
     //----- routine parameters, numeric
     //          name,         w, p, type,    default,  min,  max, help
@@ -549,6 +599,8 @@ Params::Params():
     ku        ( "ku",         6,    PT_List,      10,    0,  1e6, "upper bandwidth" ),
     nrhs      ( "nrhs",       6,    PT_List,      10,    0, 1e10, "number of right hand sides" ),
     nb        ( "nb",         4,    PT_List,     384,    0,  1e6, "block size" ),
+    lookahead ( "lookahead",  9,    PT_List,       1,    0,  100, "lookahead depth, for native getrf" ),
+    batch     ( "batch",      5,    PT_List,     100,    0,  1e6, "batch count, for batched routines" ),
 
     vl        ( "vl",         6, 3, PT_List,    -inf, -inf,  inf, "lower bound of eigen/singular values to find" ),
     vu        ( "vu",         6, 3, PT_List,     inf, -inf,  inf, "upper bound of eigen/singular values to find" ),
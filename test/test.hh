@@ -83,6 +83,10 @@ public:
     testsweeper::ParamEnum< lapack::Direction >     direction;  // larfb
     testsweeper::ParamEnum< lapack::StoreV >        storev;     // larfb
     testsweeper::ParamEnum< lapack::Equed >         equed;      // gesvx
+    testsweeper::ParamEnum< lapack::MethodLU >      method_lu;  // getrf
+    testsweeper::ParamEnum< lapack::MethodCholesky > method_chol; // potrf
+    testsweeper::ParamEnum< lapack::InnerPrecision > inner;     // gesv_mixed
+    testsweeper::ParamEnum< lapack::MethodRefine >  refine;     // gesv_mixed
 
     //----- routine parameters, numeric
     testsweeper::ParamInt3    dim;  // m, n, k
@@ -95,6 +99,8 @@ public:
     testsweeper::ParamInt     ku;
     testsweeper::ParamInt     nrhs;
     testsweeper::ParamInt     nb;
+    testsweeper::ParamInt     lookahead;
+    testsweeper::ParamInt     batch;
     testsweeper::ParamDouble  vl;
     testsweeper::ParamDouble  vu;
     testsweeper::ParamInt     il;
@@ -181,6 +187,9 @@ void test_getrs ( Params& params, bool run );
 void test_gecon ( Params& params, bool run );
 void test_gerfs ( Params& params, bool run );
 void test_geequ ( Params& params, bool run );
+void test_gesv_batch  ( Params& params, bool run );
+void test_gesv_mixed  ( Params& params, bool run );
+void test_getrf_batch ( Params& params, bool run );
 
 // LU, band
 void test_gbsv  ( Params& params, bool run );
@@ -204,11 +213,15 @@ void test_gtequ ( Params& params, bool run );
 void test_posv  ( Params& params, bool run );
 void test_posvx ( Params& params, bool run );
 void test_potrf ( Params& params, bool run );
+void test_potrf_update ( Params& params, bool run );
 void test_potri ( Params& params, bool run );
 void test_potrs ( Params& params, bool run );
 void test_pocon ( Params& params, bool run );
 void test_porfs ( Params& params, bool run );
 void test_poequ ( Params& params, bool run );
+void test_posv_batch  ( Params& params, bool run );
+void test_posv_mixed  ( Params& params, bool run );
+void test_potrf_batch ( Params& params, bool run );
 
 // Cholesky, packed
 void test_ppsv  ( Params& params, bool run );
@@ -296,16 +309,22 @@ void test_gelsy ( Params& params, bool run );
 void test_gelsd ( Params& params, bool run );
 void test_gelss ( Params& params, bool run );
 void test_getsls( Params& params, bool run );
+void test_gels_batch  ( Params& params, bool run );
+void test_gels_stream ( Params& params, bool run );
+void test_gels_mixed  ( Params& params, bool run );
 void test_gglse ( Params& params, bool run );
 void test_ggglm ( Params& params, bool run );
 
 // QR, LQ, QL, RQ
 void test_geqr  ( Params& params, bool run );
 void test_geqrf ( Params& params, bool run );
+void test_geqrf_batch ( Params& params, bool run );
+void test_geqrf_update ( Params& params, bool run );
 void test_gelqf ( Params& params, bool run );
 void test_geqlf ( Params& params, bool run );
 void test_gerqf ( Params& params, bool run );
 void test_gemqrt( Params& params, bool run );
+void test_tsqr  ( Params& params, bool run );
 
 void test_ggqrf ( Params& params, bool run );
 void test_gglqf ( Params& params, bool run );
@@ -341,6 +360,7 @@ void test_tprfb ( Params& params, bool run );
 void test_heev  ( Params& params, bool run );
 void test_heevx ( Params& params, bool run );
 void test_heevd ( Params& params, bool run );
+void test_heevd_batch ( Params& params, bool run );
 void test_heevr ( Params& params, bool run );
 void test_hetrd ( Params& params, bool run );
 void test_lae2  ( Params& params, bool run );
@@ -409,6 +429,8 @@ void test_ggesx ( Params& params, bool run );
 // SVD
 void test_gesvd ( Params& params, bool run );
 void test_gesdd ( Params& params, bool run );
+void test_gesvd_batch ( Params& params, bool run );
+void test_gesdd_batch ( Params& params, bool run );
 void test_gesvdx( Params& params, bool run );
 void test_gesvd_2stage ( Params& params, bool run );
 void test_gesdd_2stage ( Params& params, bool run );
@@ -421,6 +443,15 @@ void test_lacpy ( Params& params, bool run );
 void test_laed4 ( Params& params, bool run );
 void test_laset ( Params& params, bool run );
 void test_laswp ( Params& params, bool run );
+void test_fixed ( Params& params, bool run );
+void test_views ( Params& params, bool run );
+void test_factor( Params& params, bool run );
+void test_threads( Params& params, bool run );
+void test_host_stream( Params& params, bool run );
+void test_work_size_cache( Params& params, bool run );
+void test_workspace( Params& params, bool run );
+void test_workspace_pool( Params& params, bool run );
+void test_trace( Params& params, bool run );
 
 // auxiliary - Householder
 void test_larfg ( Params& params, bool run );
@@ -469,5 +500,12 @@ void test_potrf_device ( Params& params, bool run );
 void test_getrf_device ( Params& params, bool run );
 void test_geqrf_device ( Params& params, bool run );
 void test_heevd_device ( Params& params, bool run );
+void test_getrs_device ( Params& params, bool run );
+void test_potrs_device ( Params& params, bool run );
+void test_potri_device ( Params& params, bool run );
+void test_unmqr_device ( Params& params, bool run );
+void test_ungqr_device ( Params& params, bool run );
+void test_gesvd_device ( Params& params, bool run );
+void test_heevj_device ( Params& params, bool run );
 
 #endif  //  #ifndef TEST_HH
@@ -0,0 +1,316 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/factor.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "check_gels.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Returns backward error || B - op(A) X ||_1 / (n ||A||_1 ||X||_1)
+// of the n-by-n system, or the Hermitian system if uplo is General.
+template< typename scalar_t >
+blas::real_type< scalar_t > solve_error(
+    lapack::Op trans, lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t const* A, int64_t lda,
+    scalar_t const* X, int64_t ldx,
+    scalar_t const* B, int64_t ldb )
+{
+    using real_t = blas::real_type< scalar_t >;
+    const scalar_t one = 1.0;
+
+    std::vector< scalar_t > R( B, B + ldb * nrhs );
+    real_t Anorm;
+    if (uplo == lapack::Uplo::General) {
+        blas::gemm( blas::Layout::ColMajor, trans, lapack::Op::NoTrans,
+                    n, nrhs, n, -one, A, lda, X, ldx, one, &R[0], ldb );
+        Anorm = lapack::lange( lapack::Norm::One, n, n, A, lda );
+    }
+    else {
+        blas::hemm( blas::Layout::ColMajor, blas::Side::Left, uplo,
+                    n, nrhs, -one, A, lda, X, ldx, one, &R[0], ldb );
+        Anorm = lapack::lanhe( lapack::Norm::One, uplo, n, A, lda );
+    }
+    real_t Rnorm = lapack::lange( lapack::Norm::One, n, nrhs, &R[0], ldb );
+    real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, X, ldx );
+    if (n == 0 || nrhs == 0 || Xnorm == 0)
+        return 0;
+    return Rnorm / (n * Anorm * Xnorm);
+}
+
+// -----------------------------------------------------------------------------
+// Returns || I - Ainv A ||_1 / (n ||A||_1 ||Ainv||_1) for n-by-n A.
+template< typename scalar_t >
+blas::real_type< scalar_t > inverse_error(
+    int64_t n,
+    scalar_t const* A, int64_t lda,
+    scalar_t const* Ainv, int64_t ldainv )
+{
+    using real_t = blas::real_type< scalar_t >;
+    const scalar_t one = 1.0;
+
+    int64_t ldr = blas::max( 1, n );
+    std::vector< scalar_t > R( ldr * n );
+    lapack::laset( lapack::MatrixType::General, n, n, 0.0, 1.0, &R[0], ldr );
+    blas::gemm( blas::Layout::ColMajor, lapack::Op::NoTrans, lapack::Op::NoTrans,
+                n, n, n, -one, Ainv, ldainv, A, lda, one, &R[0], ldr );
+    real_t Rnorm = lapack::lange( lapack::Norm::One, n, n, &R[0], ldr );
+    real_t Anorm = lapack::lange( lapack::Norm::One, n, n, A, lda );
+    real_t Inorm = lapack::lange( lapack::Norm::One, n, n, Ainv, ldainv );
+    if (n == 0)
+        return 0;
+    return Rnorm / (n * Anorm * Inorm);
+}
+
+// -----------------------------------------------------------------------------
+// Tests factorization objects LU, Cholesky, LDLT, and QR.
+// error is the max backward error of solve() and refine() and the
+// residual of inverse(); error2 is the max relative difference of rcond()
+// from the computational routines applied to a separate factorization.
+// Also checks that solves after the first do not grow the object's
+// workspace, i.e., do not allocate.
+template< typename scalar_t >
+void test_factor_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using lapack::Uplo;
+    using lapack::Op;
+
+    // Constants
+    const real_t eps = std::numeric_limits< real_t >::epsilon();
+
+    // get & mark input values
+    lapack::Op trans = params.trans();
+    lapack::Uplo uplo = params.uplo();
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    real_t tol = params.tol() * eps;
+    params.matrix.mark();
+
+    // mark non-standard output values
+    params.error2();
+    params.msg();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    // General n-by-n A; Hermitian H; positive definite P = H + n I;
+    // m-by-n G for QR, with m >= n.
+    m = blas::max( m, n );
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    int64_t ldg = roundup( blas::max( 1, m ), align );
+    int64_t ldb = roundup( blas::max( 1, m ), align );
+    std::vector< scalar_t > A( lda * n ), H( lda * n ), P( lda * n );
+    std::vector< scalar_t > G( ldg * n );
+    std::vector< scalar_t > B( ldb * nrhs ), X( ldb * nrhs );
+    std::vector< scalar_t > Ainv( lda * n ), F( lda * n );
+    std::vector< real_t > ferr( nrhs ), berr( nrhs );
+    std::vector< int64_t > ipiv( n );
+
+    lapack::generate_matrix( params.matrix, n, n, &A[0], lda );
+    lapack::generate_matrix( params.matrix, m, n, &G[0], ldg );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B.size(), &B[0] );
+    lapack::larnv( idist, iseed, H.size(), &H[0] );
+    for (int64_t j = 0; j < n; ++j) {
+        H[ j + j*lda ] = std::real( H[ j + j*lda ] );
+        for (int64_t i = j + 1; i < n; ++i)
+            H[ j + i*lda ] = blas::conj( H[ i + j*lda ] );
+    }
+    P = H;
+    for (int64_t j = 0; j < n; ++j)
+        P[ j + j*lda ] += real_t( n );
+
+    if (verbose >= 2) {
+        printf( "A = " ); print_matrix( n, n, &A[0], lda );
+        printf( "H = " ); print_matrix( n, n, &H[0], lda );
+        printf( "G = " ); print_matrix( m, n, &G[0], ldg );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::LU< scalar_t >( -1, &A[0], lda ), lapack::Error );
+        assert_throw( lapack::LU< scalar_t >( n+1, &A[0], n ), lapack::Error );
+        assert_throw( lapack::Cholesky< scalar_t >( Uplo::General, n, &P[0], lda ), lapack::Error );
+        assert_throw( lapack::LDLT< scalar_t >( uplo, -1, &H[0], lda ), lapack::Error );
+        assert_throw( lapack::QR< scalar_t >( n, n+1, &G[0], ldg ), lapack::Error );
+        lapack::LU< scalar_t > lu( n, &A[0], lda );
+        assert_throw( lu.solve( -1, &X[0], ldb ), lapack::Error );
+        assert_throw( lu.rcond( lapack::Norm::Max ), lapack::Error );
+    }
+
+    real_t error = 0, error2 = 0;
+    double time = 0;
+
+    // Repeats obj's solve, counting in grew if its workspace grows.
+    int64_t grew = 0;
+    auto resolve = [&]( auto const& obj, auto&& solve ) {
+        std::size_t bytes = obj.workspace_bytes();
+        for (int i = 0; i < 3; ++i) {
+            X = B;
+            solve();
+        }
+        if (obj.workspace_bytes() != bytes)
+            ++grew;
+    };
+
+    //----- LU
+    {
+        double t = testsweeper::get_wtime();
+        lapack::LU< scalar_t > lu0( n, &A[0], lda );
+        lapack::LU< scalar_t > lu = std::move( lu0 );
+        X = B;
+        int64_t info = lu.solve( nrhs, &X[0], ldb, trans );
+        time += testsweeper::get_wtime() - t;
+        if (info != 0)
+            fprintf( stderr, "LU::solve returned error %lld\n", llong( info ) );
+        error = blas::max( error, solve_error( trans, Uplo::General, n, nrhs,
+                                               &A[0], lda, &X[0], ldb, &B[0], ldb ) );
+        resolve( lu, [&]() { lu.solve( nrhs, &X[0], ldb, trans ); } );
+
+        lu.refine( nrhs, &B[0], ldb, &X[0], ldb, &ferr[0], &berr[0], trans );
+        error = blas::max( error, solve_error( trans, Uplo::General, n, nrhs,
+                                               &A[0], lda, &X[0], ldb, &B[0], ldb ) );
+
+        lu.inverse( &Ainv[0], lda );
+        error = blas::max( error, inverse_error( n, &A[0], lda, &Ainv[0], lda ) );
+
+        F = A;
+        lapack::getrf( n, n, &F[0], lda, &ipiv[0] );
+        for (auto norm : { lapack::Norm::One, lapack::Norm::Inf }) {
+            real_t rcond_ref;
+            lapack::gecon( norm, n, &F[0], lda, lu.anorm( norm ), &rcond_ref );
+            real_t rcond = lu.rcond( norm );
+            if (rcond_ref > 0)
+                error2 = blas::max( error2, std::abs( rcond - rcond_ref ) / rcond_ref );
+        }
+    }
+
+    //----- Cholesky
+    {
+        double t = testsweeper::get_wtime();
+        lapack::Cholesky< scalar_t > chol( uplo, n, &P[0], lda );
+        X = B;
+        int64_t info = chol.solve( nrhs, &X[0], ldb );
+        time += testsweeper::get_wtime() - t;
+        if (info != 0)
+            fprintf( stderr, "Cholesky::solve returned error %lld\n", llong( info ) );
+        error = blas::max( error, solve_error( Op::NoTrans, uplo, n, nrhs,
+                                               &P[0], lda, &X[0], ldb, &B[0], ldb ) );
+        resolve( chol, [&]() { chol.solve( nrhs, &X[0], ldb ); } );
+
+        chol.refine( nrhs, &B[0], ldb, &X[0], ldb, &ferr[0], &berr[0] );
+        error = blas::max( error, solve_error( Op::NoTrans, uplo, n, nrhs,
+                                               &P[0], lda, &X[0], ldb, &B[0], ldb ) );
+
+        chol.inverse( &Ainv[0], lda );
+        error = blas::max( error, inverse_error( n, &P[0], lda, &Ainv[0], lda ) );
+
+        F = P;
+        lapack::potrf( uplo, n, &F[0], lda );
+        real_t rcond_ref;
+        lapack::pocon( uplo, n, &F[0], lda, chol.anorm(), &rcond_ref );
+        real_t rcond = chol.rcond();
+        if (rcond_ref > 0)
+            error2 = blas::max( error2, std::abs( rcond - rcond_ref ) / rcond_ref );
+    }
+
+    //----- LDLT
+    {
+        double t = testsweeper::get_wtime();
+        lapack::LDLT< scalar_t > ldlt( uplo, n, &H[0], lda );
+        X = B;
+        int64_t info = ldlt.solve( nrhs, &X[0], ldb );
+        time += testsweeper::get_wtime() - t;
+        if (info != 0)
+            fprintf( stderr, "LDLT::solve returned error %lld\n", llong( info ) );
+        error = blas::max( error, solve_error( Op::NoTrans, uplo, n, nrhs,
+                                               &H[0], lda, &X[0], ldb, &B[0], ldb ) );
+        resolve( ldlt, [&]() { ldlt.solve( nrhs, &X[0], ldb ); } );
+
+        ldlt.refine( nrhs, &B[0], ldb, &X[0], ldb, &ferr[0], &berr[0] );
+        error = blas::max( error, solve_error( Op::NoTrans, uplo, n, nrhs,
+                                               &H[0], lda, &X[0], ldb, &B[0], ldb ) );
+
+        ldlt.inverse( &Ainv[0], lda );
+        error = blas::max( error, inverse_error( n, &H[0], lda, &Ainv[0], lda ) );
+
+        F = H;
+        lapack::hetrf( uplo, n, &F[0], lda, &ipiv[0] );
+        real_t rcond_ref;
+        lapack::hecon( uplo, n, &F[0], lda, &ipiv[0], ldlt.anorm(), &rcond_ref );
+        real_t rcond = ldlt.rcond();
+        if (rcond_ref > 0)
+            error2 = blas::max( error2, std::abs( rcond - rcond_ref ) / rcond_ref );
+    }
+
+    //----- QR: least squares, m-by-n
+    {
+        double t = testsweeper::get_wtime();
+        lapack::QR< scalar_t > qr( m, n, &G[0], ldg );
+        X = B;
+        int64_t info = qr.solve( nrhs, &X[0], ldb );
+        time += testsweeper::get_wtime() - t;
+        if (info != 0)
+            fprintf( stderr, "QR::solve returned error %lld\n", llong( info ) );
+
+        real_t result[ 2 ];
+        check_gels( false, Op::NoTrans, m, n, nrhs,
+                    &G[0], ldg, &X[0], ldb, &B[0], ldb, result );
+        error = blas::max( error, result[ 0 ] );
+        resolve( qr, [&]() { qr.solve( nrhs, &X[0], ldb ); } );
+
+        qr.refine( nrhs, &B[0], ldb, &X[0], ldb );
+        check_gels( false, Op::NoTrans, m, n, nrhs,
+                    &G[0], ldg, &X[0], ldb, &B[0], ldb, result );
+        error = blas::max( error, result[ 0 ] );
+
+        lapack::QR< scalar_t > qr_sq( n, n, &A[0], lda );
+        qr_sq.inverse( &Ainv[0], lda );
+        error = blas::max( error, inverse_error( n, &A[0], lda, &Ainv[0], lda ) );
+    }
+
+    params.time() = time;
+    params.error() = error;
+    params.error2() = error2;
+    params.okay() = (error < tol) && (error2 < tol) && (grew == 0);
+    if (grew != 0)
+        params.msg() = "workspace grew in " + std::to_string( grew ) + " solves";
+}
+
+// -----------------------------------------------------------------------------
+void test_factor( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_factor_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_factor_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_factor_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_factor_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
@@ -0,0 +1,267 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/fixed.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+
+#include <vector>
+
+// Largest n tested; fixed< N > is instantiated for N = 1, ..., fixed_max.
+const int64_t fixed_max = 16;
+
+// -----------------------------------------------------------------------------
+// Tests the fixed-size kernels in lapack::fixed< N > against the regular
+// wrappers (lapack::getrf, etc.) on the same batch of matrices.
+// Factors should agree to rounding error, and pivots and info exactly.
+template< typename scalar_t, int64_t N >
+void test_fixed_work( Params& params )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using fixed = lapack::fixed< N >;
+    using lapack::Uplo;
+
+    // Constants
+    const scalar_t one = 1.0;
+    const real_t   eps = std::numeric_limits< real_t >::epsilon();
+
+    // get input values
+    lapack::Op trans = params.trans();
+    lapack::Uplo uplo = params.uplo();
+    lapack::Diag diag = params.diag();
+    int64_t n = N;
+    int64_t nrhs = params.nrhs();
+    int64_t batch = params.batch();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    real_t tol = params.tol() * eps;
+
+    // ---------- setup
+    int64_t lda = roundup( n, align );
+    int64_t ldb = roundup( n, align );
+    int64_t strideA = lda * n;
+    int64_t strideB = ldb * nrhs;
+    size_t size_A = (size_t) strideA * batch;
+    size_t size_B = (size_t) strideB * batch;
+    size_t size_n = (size_t) n * batch;
+
+    // LU and QR use the general matrix A; Cholesky and trtri use S,
+    // made Hermitian positive definite by diagonal dominance.
+    std::vector< scalar_t > A( size_A );
+    std::vector< scalar_t > S( size_A );
+    std::vector< scalar_t > B( size_B );
+    for (int64_t i = 0; i < batch; ++i) {
+        lapack::generate_matrix( params.matrix, n, n, &A[ i*strideA ], lda );
+    }
+    S = A;
+    for (int64_t i = 0; i < batch; ++i) {
+        for (int64_t j = 0; j < n; ++j) {
+            scalar_t& sjj = S[ j + j*lda + i*strideA ];
+            sjj = std::real( sjj ) + 2*n;
+        }
+    }
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B.size(), &B[0] );
+
+    std::vector< scalar_t > LU_tst = A, LU_ref = A;
+    std::vector< scalar_t > QR_tst = A, QR_ref = A;
+    std::vector< scalar_t > L_tst = S, L_ref = S;
+    std::vector< scalar_t > X_tst = B, X_ref = B;
+    std::vector< scalar_t > Y_tst = B, Y_ref = B;
+    std::vector< scalar_t > tau_tst( size_n ), tau_ref( size_n );
+    std::vector< int64_t > ipiv_tst( size_n ), ipiv_ref( size_n );
+    std::vector< int64_t > info_tst( 3*batch ), info_ref( 3*batch );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, lda=%5lld, batch=%5lld\n"
+                "B n=%5lld, nrhs=%5lld, ldb=%5lld\n",
+                llong( n ), llong( lda ), llong( batch ),
+                llong( n ), llong( nrhs ), llong( ldb ) );
+    }
+    if (verbose >= 2) {
+        printf( "A0 = " ); print_matrix( n, n, &A[0], lda );
+        printf( "B0 = " ); print_matrix( n, nrhs, &B[0], ldb );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( fixed::getrf( &LU_tst[0], n-1, &ipiv_tst[0] ), lapack::Error );
+        assert_throw( fixed::getrs( lapack::Op(0), nrhs, &LU_tst[0], lda, &ipiv_tst[0], &X_tst[0], ldb ), lapack::Error );
+        assert_throw( fixed::getrs( trans,           -1, &LU_tst[0], lda, &ipiv_tst[0], &X_tst[0], ldb ), lapack::Error );
+        assert_throw( fixed::getrs( trans,         nrhs, &LU_tst[0], n-1, &ipiv_tst[0], &X_tst[0], ldb ), lapack::Error );
+        assert_throw( fixed::getrs( trans,         nrhs, &LU_tst[0], lda, &ipiv_tst[0], &X_tst[0], n-1 ), lapack::Error );
+        assert_throw( fixed::potrf( Uplo(0), &L_tst[0], lda ), lapack::Error );
+        assert_throw( fixed::potrf( uplo,    &L_tst[0], n-1 ), lapack::Error );
+        assert_throw( fixed::potrs( Uplo(0), nrhs, &L_tst[0], lda, &Y_tst[0], ldb ), lapack::Error );
+        assert_throw( fixed::potrs( uplo,      -1, &L_tst[0], lda, &Y_tst[0], ldb ), lapack::Error );
+        assert_throw( fixed::potrs( uplo,    nrhs, &L_tst[0], n-1, &Y_tst[0], ldb ), lapack::Error );
+        assert_throw( fixed::potrs( uplo,    nrhs, &L_tst[0], lda, &Y_tst[0], n-1 ), lapack::Error );
+        assert_throw( fixed::trtri( Uplo(0), diag, &L_tst[0], lda ), lapack::Error );
+        assert_throw( fixed::trtri( uplo, lapack::Diag(0), &L_tst[0], lda ), lapack::Error );
+        assert_throw( fixed::trtri( uplo,    diag, &L_tst[0], n-1 ), lapack::Error );
+        assert_throw( fixed::geqrf( &QR_tst[0], n-1, &tau_tst[0] ), lapack::Error );
+    }
+
+    // ---------- run test
+    // Factor, solve, then invert the Cholesky factor in place.
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    for (int64_t i = 0; i < batch; ++i) {
+        scalar_t* LUi = &LU_tst[ i*strideA ];
+        scalar_t* Li  = &L_tst[ i*strideA ];
+        int64_t* ipivi = &ipiv_tst[ i*n ];
+        info_tst[ 3*i ] = fixed::getrf( LUi, lda, ipivi );
+        fixed::getrs( trans, nrhs, LUi, lda, ipivi, &X_tst[ i*strideB ], ldb );
+        info_tst[ 3*i + 1 ] = fixed::potrf( uplo, Li, lda );
+        fixed::potrs( uplo, nrhs, Li, lda, &Y_tst[ i*strideB ], ldb );
+        info_tst[ 3*i + 2 ] = fixed::trtri( uplo, diag, Li, lda );
+        fixed::geqrf( &QR_tst[ i*strideA ], lda, &tau_tst[ i*n ] );
+    }
+    time = testsweeper::get_wtime() - time;
+    params.time() = time;
+
+    // ---------- run reference
+    testsweeper::flush_cache( params.cache() );
+    time = testsweeper::get_wtime();
+    for (int64_t i = 0; i < batch; ++i) {
+        scalar_t* LUi = &LU_ref[ i*strideA ];
+        scalar_t* Li  = &L_ref[ i*strideA ];
+        int64_t* ipivi = &ipiv_ref[ i*n ];
+        info_ref[ 3*i ] = lapack::getrf( n, n, LUi, lda, ipivi );
+        lapack::getrs( trans, n, nrhs, LUi, lda, ipivi, &X_ref[ i*strideB ], ldb );
+        info_ref[ 3*i + 1 ] = lapack::potrf( uplo, n, Li, lda );
+        lapack::potrs( uplo, n, nrhs, Li, lda, &Y_ref[ i*strideB ], ldb );
+        info_ref[ 3*i + 2 ] = lapack::trtri( uplo, diag, n, Li, lda );
+        lapack::geqrf( n, n, &QR_ref[ i*strideA ], lda, &tau_ref[ i*n ] );
+    }
+    time = testsweeper::get_wtime() - time;
+    params.ref_time() = time;
+
+    if (verbose >= 2) {
+        printf( "LU0 = " ); print_matrix( n, n, &LU_tst[0], lda );
+        printf( "X0 = " );  print_matrix( n, nrhs, &X_tst[0], ldb );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error compared to wrappers
+        // Factors and inverse, relative to the wrappers' results.
+        real_t error = 0;
+        error = blas::max( error, rel_error( LU_tst, LU_ref ) );
+        error = blas::max( error, rel_error( L_tst, L_ref ) );
+        error = blas::max( error, rel_error( QR_tst, QR_ref ) );
+        error = blas::max( error, rel_error( tau_tst, tau_ref ) );
+
+        // Solves, max over batch of relative backwards error
+        //     ||b - op(A) x|| / (n * ||A|| * ||x||),
+        // since the difference from the wrappers' solutions depends on
+        // the condition of A.
+        real_t error2 = 0;
+        for (int64_t i = 0; i < batch; ++i) {
+            scalar_t* Ai = &A[ i*strideA ];
+            scalar_t* Si = &S[ i*strideA ];
+            scalar_t* Xi = &X_tst[ i*strideB ];
+            scalar_t* Yi = &Y_tst[ i*strideB ];
+            std::vector< scalar_t > R( &B[ i*strideB ], &B[ (i + 1)*strideB ] );
+            std::vector< scalar_t > Q = R;
+            blas::gemm( blas::Layout::ColMajor, trans, blas::Op::NoTrans,
+                        n, nrhs, n,
+                        -one, Ai, lda,
+                              Xi, ldb,
+                        one,  &R[0], ldb );
+            blas::hemm( blas::Layout::ColMajor, blas::Side::Left, uplo,
+                        n, nrhs,
+                        -one, Si, lda,
+                              Yi, ldb,
+                        one,  &Q[0], ldb );
+
+            real_t Anorm = lapack::lange( lapack::Norm::One, n, n, Ai, lda );
+            real_t Snorm = lapack::lanhe( lapack::Norm::One, uplo, n, Si, lda );
+            real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, Xi, ldb );
+            real_t Ynorm = lapack::lange( lapack::Norm::One, n, nrhs, Yi, ldb );
+            real_t error_x = lapack::lange( lapack::Norm::One, n, nrhs, &R[0], ldb )
+                           / (n * Anorm * Xnorm);
+            real_t error_y = lapack::lange( lapack::Norm::One, n, nrhs, &Q[0], ldb )
+                           / (n * Snorm * Ynorm);
+            error2 = blas::max( error2, error_x, error_y );
+        }
+
+        bool same = (ipiv_tst == ipiv_ref && info_tst == info_ref);
+
+        params.error()  = error;
+        params.error2() = error2;
+        params.okay() = (error < tol && error2 < tol && same);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Calls test_fixed_work< scalar_t, N > with N = n, for n <= fixed_max.
+template< typename scalar_t, int64_t N = 1 >
+void test_fixed_dispatch( Params& params, int64_t n )
+{
+    if (n == N)
+        test_fixed_work< scalar_t, N >( params );
+    else if constexpr (N < fixed_max)
+        test_fixed_dispatch< scalar_t, N + 1 >( params, n );
+}
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_fixed_work( Params& params, bool run )
+{
+    // get & mark input values
+    params.trans();
+    params.uplo();
+    params.diag();
+    int64_t n = params.dim.n();
+    params.nrhs();
+    params.batch();
+    params.align();
+    params.matrix.mark();
+
+    // mark non-standard output values
+    params.ref_time();
+    params.error2();
+    params.error2.name( "solve error" );
+    params.msg();
+
+    if (! run)
+        return;
+
+    if (n < 1 || n > fixed_max) {
+        params.msg() = "skipping: requires 1 <= n <= 16";
+        return;
+    }
+    test_fixed_dispatch< scalar_t >( params, n );
+}
+
+// -----------------------------------------------------------------------------
+void test_fixed( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_fixed_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_fixed_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_fixed_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_fixed_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
@@ -0,0 +1,190 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "lapacke_wrappers.hh"
+#include "check_gels.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_gels_batch_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // Constants
+    const real_t eps = std::numeric_limits< real_t >::epsilon();
+
+    // get & mark input values
+    lapack::Op trans = params.trans();
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t batch = params.batch();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    real_t tol = params.tol() * eps;
+    params.matrix.mark();
+
+    // mark non-standard output values
+    params.ref_time();
+    params.error2();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    int64_t ldb = roundup( blas::max( 1, m, n ), align );
+    int64_t strideA = lda * n;
+    int64_t strideB = ldb * nrhs;
+    size_t size_A = (size_t) strideA * batch;
+    size_t size_B = (size_t) strideB * batch;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< scalar_t > B_tst( size_B );
+    std::vector< scalar_t > B_ref( size_B );
+    std::vector< int64_t > info_tst( batch );
+
+    for (int64_t i = 0; i < batch; ++i) {
+        lapack::generate_matrix( params.matrix, m, n, &A_tst[ i*strideA ], lda );
+    }
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B_tst.size(), &B_tst[0] );
+    A_ref = A_tst;
+    B_ref = B_tst;
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A m=%5lld, n=%5lld, lda=%5lld, batch=%5lld\n"
+                "B nrhs=%5lld, ldb=%5lld\n",
+                llong( m ), llong( n ), llong( lda ), llong( batch ),
+                llong( nrhs ), llong( ldb ) );
+    }
+    if (verbose >= 2) {
+        printf( "A0 = " ); print_matrix( m, n, &A_tst[0], lda );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::gels_batch( lapack::Op(0), m, n, nrhs, &A_tst[0], lda, strideA, &B_tst[0], ldb, strideB, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::gels_batch( trans, -1,  n, nrhs, &A_tst[0], lda, strideA, &B_tst[0], ldb, strideB, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::gels_batch( trans,  m, -1, nrhs, &A_tst[0], lda, strideA, &B_tst[0], ldb, strideB, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::gels_batch( trans,  m,  n,   -1, &A_tst[0], lda, strideA, &B_tst[0], ldb, strideB, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::gels_batch( trans,  m,  n, nrhs, &A_tst[0], m-1, strideA, &B_tst[0], ldb, strideB, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::gels_batch( trans,  m,  n, nrhs, &A_tst[0], lda, strideA, &B_tst[0], blas::max( m, n )-1, strideB, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::gels_batch( trans,  m,  n, nrhs, &A_tst[0], lda, strideA, &B_tst[0], ldb, strideB,    -1, &info_tst[0] ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    lapack::gels_batch( trans, m, n, nrhs, &A_tst[0], lda, strideA,
+                        &B_tst[0], ldb, strideB, batch, &info_tst[0] );
+    time = testsweeper::get_wtime() - time;
+    for (int64_t i = 0; i < batch; ++i) {
+        if (info_tst[ i ] != 0) {
+            fprintf( stderr, "lapack::gels_batch returned error %lld in matrix %lld\n",
+                     llong( info_tst[ i ] ), llong( i ) );
+        }
+    }
+
+    params.time() = time;
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Max over batch of the check_gels errors.
+        real_t error[2] = { 0, 0 };
+        for (int64_t i = 0; i < batch; ++i) {
+            real_t error_i[2];
+            check_gels( false, trans, m, n, nrhs,
+                        &A_ref[ i*strideA ], lda, // original A
+                        &B_tst[ i*strideB ], ldb, // X
+                        &B_ref[ i*strideB ], ldb, // original B
+                        error_i );
+            error[0] = blas::max( error[0], error_i[0] );
+            error[1] = blas::max( error[1], error_i[1] );
+        }
+
+        // Pointer-array and variable-size versions should give the
+        // same results as strided.
+        std::vector< scalar_t > A2 = A_ref, A3 = A_ref;
+        std::vector< scalar_t > B2 = B_ref, B3 = B_ref;
+        std::vector< int64_t > info2( batch ), info3( batch );
+        std::vector< scalar_t* > Aarray( batch ), Barray( batch );
+        std::vector< scalar_t* > Aarray3( batch ), Barray3( batch );
+        std::vector< int64_t > m_array( batch, m ), n_array( batch, n );
+        std::vector< int64_t > nrhs_array( batch, nrhs );
+        std::vector< int64_t > lda_array( batch, lda ), ldb_array( batch, ldb );
+        for (int64_t i = 0; i < batch; ++i) {
+            Aarray[ i ]  = &A2[ i*strideA ];
+            Barray[ i ]  = &B2[ i*strideB ];
+            Aarray3[ i ] = &A3[ i*strideA ];
+            Barray3[ i ] = &B3[ i*strideB ];
+        }
+        lapack::gels_batch( trans, m, n, nrhs, &Aarray[0], lda,
+                            &Barray[0], ldb, batch, &info2[0] );
+        lapack::gels_vbatch( trans, &m_array[0], &n_array[0], &nrhs_array[0],
+                             &Aarray3[0], &lda_array[0],
+                             &Barray3[0], &ldb_array[0], batch, &info3[0] );
+        bool same = (B2 == B_tst && info2 == info_tst
+                     && B3 == B_tst && info3 == info_tst);
+
+        params.error()  = error[0];
+        params.error2() = error[1];
+        params.okay() = (error[0] < tol) && (error[1] < tol) && same;
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t i = 0; i < batch; ++i) {
+            int64_t info_ref = LAPACKE_gels(
+                to_char( trans ), m, n, nrhs, &A_ref[ i*strideA ], lda,
+                &B_ref[ i*strideB ], ldb );
+            if (info_ref != 0) {
+                fprintf( stderr, "LAPACKE_gels returned error %lld in matrix %lld\n",
+                         llong( info_ref ), llong( i ) );
+            }
+        }
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_gels_batch( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_gels_batch_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_gels_batch_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_gels_batch_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_gels_batch_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
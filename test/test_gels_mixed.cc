@@ -0,0 +1,171 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "lapacke_wrappers.hh"
+#include "check_gels.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Tests gels_mixed. error and error2 are from check_gels; iters is
+// RefineInfo::iter, negative on fallback.
+template< typename scalar_t >
+void test_gels_mixed_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    lapack::RefineOptions opts;
+    opts.precision = params.inner();
+    opts.method = params.refine();
+
+    // mark non-standard output values
+    params.ref_time();
+    params.error2();
+    params.iters();
+    params.msg();
+
+    if (! run)
+        return;
+
+    if (m < n) {
+        params.msg() = "skipping: requires m >= n";
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    int64_t ldb = roundup( blas::max( 1, m ), align );
+    int64_t ldx = roundup( blas::max( 1, n ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_B = (size_t) ldb * nrhs;
+    size_t size_X = (size_t) ldx * nrhs;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< scalar_t > B_tst( size_B );
+    std::vector< scalar_t > B_ref( size_B );
+    std::vector< scalar_t > X_tst( size_X );
+
+    lapack::generate_matrix( params.matrix, m, n, &A_tst[0], lda );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B_tst.size(), &B_tst[0] );
+    A_ref = A_tst;
+    B_ref = B_tst;
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A m=%5lld, n=%5lld, lda=%5lld\n"
+                "B m=%5lld, nrhs=%5lld, ldb=%5lld\n",
+                llong( m ), llong( n ), llong( lda ),
+                llong( m ), llong( nrhs ), llong( ldb ) );
+    }
+    if (verbose >= 2) {
+        printf( "A = " ); print_matrix( m, n, &A_tst[0], lda );
+        printf( "B = " ); print_matrix( m, nrhs, &B_tst[0], ldb );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        lapack::RefineOptions bad_opts;
+        bad_opts.gmres_max_iter = 0;
+        assert_throw( lapack::gels_mixed( -1,  n, nrhs, &A_tst[0], lda, &B_tst[0], ldb, &X_tst[0], ldx ), lapack::Error );
+        assert_throw( lapack::gels_mixed(  m, -1, nrhs, &A_tst[0], lda, &B_tst[0], ldb, &X_tst[0], ldx ), lapack::Error );
+        assert_throw( lapack::gels_mixed(  m, m+1, nrhs, &A_tst[0], lda, &B_tst[0], ldb, &X_tst[0], ldx ), lapack::Error );
+        assert_throw( lapack::gels_mixed(  m,  n,   -1, &A_tst[0], lda, &B_tst[0], ldb, &X_tst[0], ldx ), lapack::Error );
+        assert_throw( lapack::gels_mixed(  m,  n, nrhs, &A_tst[0], m-1, &B_tst[0], ldb, &X_tst[0], ldx ), lapack::Error );
+        assert_throw( lapack::gels_mixed(  m,  n, nrhs, &A_tst[0], lda, &B_tst[0], m-1, &X_tst[0], ldx ), lapack::Error );
+        assert_throw( lapack::gels_mixed(  m,  n, nrhs, &A_tst[0], lda, &B_tst[0], ldb, &X_tst[0], n-1 ), lapack::Error );
+        assert_throw( lapack::gels_mixed(  m,  n, nrhs, &A_tst[0], lda, &B_tst[0], ldb, &X_tst[0], ldx, bad_opts ), lapack::Error );
+    }
+
+    // ---------- run test
+    lapack::RefineInfo rinfo;
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    int64_t info_tst = lapack::gels_mixed( m, n, nrhs, &A_tst[0], lda, &B_tst[0], ldb,
+                                           &X_tst[0], ldx, opts, &rinfo );
+    time = testsweeper::get_wtime() - time;
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::gels_mixed returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+    params.iters() = rinfo.iter;
+    if (opts.method == lapack::MethodRefine::GMRES)
+        params.msg() = "gmres iters " + std::to_string( rinfo.gmres_iter );
+
+    if (verbose >= 2) {
+        printf( "X = " ); print_matrix( n, nrhs, &X_tst[0], ldx );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        real_t error[2];
+        check_gels( false, lapack::Op::NoTrans, m, n, nrhs,
+                    &A_ref[0], lda, // original A
+                    &X_tst[0], ldx, // X
+                    &B_ref[0], ldb, // original B
+                    error );
+        params.error()  = error[0];
+        params.error2() = error[1];
+        params.okay() = (error[0] < tol) && (error[1] < tol) && (info_tst == 0);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference, in working precision
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = LAPACKE_gels( 'n', m, n, nrhs, &A_ref[0], lda, &B_ref[0], ldb );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "LAPACKE_gels returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_gels_mixed( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_gels_mixed_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_gels_mixed_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_gels_mixed_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_gels_mixed_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
@@ -0,0 +1,242 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "lapacke_wrappers.hh"
+#include "check_gels.hh"
+
+#include <cstdio>
+#include <vector>
+
+#if ! defined( _WIN32 )
+    #include <unistd.h>
+#endif
+
+#if LAPACK_VERSION >= 30400  // >= 3.4.0
+
+// -----------------------------------------------------------------------------
+// Writes m-by-n matrix A to a new temporary file; returns its path.
+template< typename scalar_t >
+std::string write_temp_matrix(
+    int64_t m, int64_t n, scalar_t const* A, int64_t lda )
+{
+    char path[] = "/tmp/lapackpp_gels_stream_XXXXXX";
+    int fd = mkstemp( path );
+    if (fd < 0)
+        throw std::runtime_error( "cannot create temporary file" );
+    for (int64_t j = 0; j < n; ++j) {
+        size_t bytes = m * sizeof( scalar_t );
+        if (write( fd, &A[ j*lda ], bytes ) != ssize_t( bytes )) {
+            close( fd );
+            unlink( path );
+            throw std::runtime_error( "cannot write temporary file" );
+        }
+    }
+    close( fd );
+    return path;
+}
+
+// -----------------------------------------------------------------------------
+// Tests GelsStream, pushing rows in uneven blocks, and gels_stream reading
+// A and B from memory-mapped files.
+template< typename scalar_t >
+void test_gels_stream_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t mb = params.nb();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.error2();
+    params.error3();
+    params.error4();
+    params.msg();
+
+    if (! run)
+        return;
+
+    if (m < n) {
+        params.msg() = "skipping: requires m >= n";
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    int64_t ldb = roundup( blas::max( 1, m ), align );
+    int64_t ldx = roundup( blas::max( 1, n ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_B = (size_t) ldb * nrhs;
+    size_t size_X = (size_t) ldx * nrhs;
+
+    std::vector< scalar_t > A( size_A );
+    std::vector< scalar_t > B( size_B );
+    std::vector< scalar_t > X_tst( size_X );
+    std::vector< scalar_t > X_map( size_X );
+    std::vector< real_t > rnorm( nrhs );
+
+    lapack::generate_matrix( params.matrix, m, n, &A[0], lda );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B.size(), &B[0] );
+
+    if (verbose >= 2) {
+        printf( "A = " ); print_matrix( m, n, &A[0], lda );
+        printf( "B = " ); print_matrix( m, nrhs, &B[0], ldb );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::GelsStream< scalar_t >( -1, nrhs, mb ), lapack::Error );
+        assert_throw( lapack::GelsStream< scalar_t >(  n,   -1, mb ), lapack::Error );
+        assert_throw( lapack::GelsStream< scalar_t >(  n, nrhs,  0 ), lapack::Error );
+        lapack::GelsStream< scalar_t > ls( n, nrhs, mb );
+        assert_throw( ls.push( -1, &A[0], lda, &B[0], ldb ), lapack::Error );
+        assert_throw( ls.push(  m, &A[0], m-1, &B[0], ldb ), lapack::Error );
+        assert_throw( ls.push(  m, &A[0], lda, &B[0], m-1 ), lapack::Error );
+        assert_throw( ls.solve( &X_tst[0], n-1 ), lapack::Error );
+    }
+
+    // ---------- run test
+    // Push blocks of 3/2 mb + 1 rows, so some are split and some are not.
+    int64_t push_rows = 3*mb/2 + 1;
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    lapack::GelsStream< scalar_t > ls( n, nrhs, mb );
+    for (int64_t i = 0; i < m; i += push_rows) {
+        int64_t mi = blas::min( push_rows, m - i );
+        ls.push( mi, &A[ i ], lda, &B[ i ], ldb );
+    }
+    int64_t info_tst = ls.solve( &X_tst[0], ldx );
+    time = testsweeper::get_wtime() - time;
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::GelsStream::solve returned error %lld\n",
+                 llong( info_tst ) );
+    }
+    ls.residual_norms( &rnorm[0] );
+
+    params.time() = time;
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        real_t error[2];
+        check_gels( false, lapack::Op::NoTrans, m, n, nrhs,
+                    &A[0], lda,     // original A
+                    &X_tst[0], ldx, // X
+                    &B[0], ldb,     // original B
+                    error );
+
+        // Compare residual norms with || B - A X ||.
+        std::vector< scalar_t > R = B;
+        blas::gemm( blas::Layout::ColMajor, blas::Op::NoTrans, blas::Op::NoTrans,
+                    m, nrhs, n, -1.0, &A[0], lda, &X_tst[0], ldx, 1.0, &R[0], ldb );
+        real_t error3 = 0;
+        for (int64_t j = 0; j < nrhs; ++j) {
+            real_t r = blas::nrm2( m, &R[ j*ldb ], 1 );
+            real_t b = blas::nrm2( m, &B[ j*ldb ], 1 );
+            if (b > 0)
+                error3 = blas::max( error3, std::abs( rnorm[ j ] - r ) / b );
+        }
+
+        // Solve again, reading A and B from memory-mapped files.
+        real_t error4 = 0;
+        #if ! defined( _WIN32 )
+            std::string path_A = write_temp_matrix( m, n, &A[0], lda );
+            std::string path_B = write_temp_matrix( m, nrhs, &B[0], ldb );
+            {
+                lapack::MappedMatrix< scalar_t > A_map( path_A, m, n );
+                lapack::MappedMatrix< scalar_t > B_map( path_B, m, nrhs );
+                int64_t info_map = lapack::gels_stream( A_map, B_map,
+                                                        &X_map[0], ldx, mb );
+                if (info_map != 0) {
+                    fprintf( stderr, "lapack::gels_stream returned error %lld\n",
+                             llong( info_map ) );
+                }
+            }
+            unlink( path_A.c_str() );
+            unlink( path_B.c_str() );
+
+            real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs,
+                                          &X_tst[0], ldx );
+            blas::axpy( size_X, -1.0, &X_tst[0], 1, &X_map[0], 1 );
+            if (Xnorm > 0)
+                error4 = lapack::lange( lapack::Norm::One, n, nrhs,
+                                        &X_map[0], ldx ) / Xnorm;
+        #endif
+
+        params.error()  = error[0];
+        params.error2() = error[1];
+        params.error3() = error3;
+        params.error4() = error4;
+        params.okay() = (error[0] < tol) && (error[1] < tol)
+                        && (error3 < tol) && (error4 < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        std::vector< scalar_t > A_ref = A;
+        std::vector< scalar_t > B_ref = B;
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = LAPACKE_gels( 'n', m, n, nrhs, &A_ref[0], lda, &B_ref[0], ldb );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "LAPACKE_gels returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_gels_stream( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_gels_stream_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_gels_stream_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_gels_stream_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_gels_stream_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
+
+#else
+
+// -----------------------------------------------------------------------------
+void test_gels_stream( Params& params, bool run )
+{
+    fprintf( stderr, "gels_stream requires LAPACK >= 3.4.0\n\n" );
+    exit(0);
+}
+
+#endif  // LAPACK >= 3.4.0
@@ -19,6 +19,7 @@ void test_geqrf_work( Params& params, bool run )
     using real_t = blas::real_type< scalar_t >;
 
     // get & mark input values
+    blas::Layout layout = params.layout();
     int64_t m = params.dim.m();
     int64_t n = params.dim.n();
     int64_t align = params.align();
@@ -37,8 +38,11 @@ void test_geqrf_work( Params& params, bool run )
         return;
 
     // ---------- setup
-    int64_t lda = roundup( blas::max( 1, m ), align );
-    size_t size_A = (size_t)( lda * n );
+    // For row-major, A is stored as the n-by-m column-major A^T.
+    int64_t Am = (layout == blas::Layout::ColMajor ? m : n);
+    int64_t An = (layout == blas::Layout::ColMajor ? n : m);
+    int64_t lda = roundup( blas::max( 1, Am ), align );
+    size_t size_A = (size_t)( lda * An );
     size_t size_tau = (size_t)( blas::min( m, n ) );
     int64_t minmn = blas::min( m, n );
 
@@ -47,13 +51,13 @@ void test_geqrf_work( Params& params, bool run )
     std::vector< scalar_t > tau_tst( size_tau );
     std::vector< scalar_t > tau_ref( size_tau );
 
-    lapack::generate_matrix( params.matrix, m, n, &A_tst[0], lda );
+    lapack::generate_matrix( params.matrix, Am, An, &A_tst[0], lda );
     A_ref = A_tst;
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
     double time = testsweeper::get_wtime();
-    int64_t info_tst = lapack::geqrf( m, n, &A_tst[0], lda, &tau_tst[0] );
+    int64_t info_tst = lapack::geqrf( layout, m, n, &A_tst[0], lda, &tau_tst[0] );
     time = testsweeper::get_wtime() - time;
     if (info_tst != 0) {
         fprintf( stderr, "lapack::geqrf returned error %lld\n", llong( info_tst ) );
@@ -65,6 +69,21 @@ void test_geqrf_work( Params& params, bool run )
 
     if (params.check() == 'y') {
         // ---------- check error
+        if (layout == blas::Layout::RowMajor) {
+            // Transpose A and its factors back to column-major.
+            int64_t ldat = roundup( blas::max( 1, m ), align );
+            std::vector< scalar_t > At_tst( ldat * n ), At_ref( ldat * n );
+            for (int64_t j = 0; j < n; ++j) {
+                for (int64_t i = 0; i < m; ++i) {
+                    At_tst[ i + j*ldat ] = A_tst[ j + i*lda ];
+                    At_ref[ i + j*ldat ] = A_ref[ j + i*lda ];
+                }
+            }
+            A_tst.swap( At_tst );
+            A_ref.swap( At_ref );
+            lda = ldat;
+        }
+
         // comparing to ref. solution doesn't work
         // Following lapack/TESTING/LIN/zqrt01.f but using smaller Q and R
         int64_t ldq = m;
@@ -113,7 +132,8 @@ void test_geqrf_work( Params& params, bool run )
         params.okay() = (error1 < tol) && (error2 < tol);
     }
 
-    if (params.ref() == 'y') {
+    // The LAPACKE reference is column-major only.
+    if (params.ref() == 'y' && layout == blas::Layout::ColMajor) {
         // ---------- run reference
         testsweeper::flush_cache( params.cache() );
         time = testsweeper::get_wtime();
@@ -0,0 +1,218 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "lapacke_wrappers.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Tests geqrf_batch, then unmqr_batch to check the factorization.
+template< typename scalar_t >
+void test_geqrf_batch_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // Constants
+    const real_t eps = std::numeric_limits< real_t >::epsilon();
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t batch = params.batch();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    real_t tol = params.tol() * eps;
+    params.matrix.mark();
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t minmn = blas::min( m, n );
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    int64_t strideA = lda * n;
+    int64_t stride_tau = minmn;
+    size_t size_A = (size_t) strideA * batch;
+    size_t size_tau = (size_t) stride_tau * batch;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< scalar_t > tau_tst( size_tau );
+    std::vector< scalar_t > tau_ref( size_tau );
+    std::vector< int64_t > info_tst( batch );
+
+    for (int64_t i = 0; i < batch; ++i) {
+        lapack::generate_matrix( params.matrix, m, n, &A_tst[ i*strideA ], lda );
+    }
+    A_ref = A_tst;
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A m=%5lld, n=%5lld, lda=%5lld, batch=%5lld\n",
+                llong( m ), llong( n ), llong( lda ), llong( batch ) );
+    }
+    if (verbose >= 2) {
+        printf( "A0 = " ); print_matrix( m, n, &A_tst[0], lda );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::geqrf_batch( -1,  n, &A_tst[0], lda, strideA, &tau_tst[0], stride_tau, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::geqrf_batch(  m, -1, &A_tst[0], lda, strideA, &tau_tst[0], stride_tau, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::geqrf_batch(  m,  n, &A_tst[0], m-1, strideA, &tau_tst[0], stride_tau, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::geqrf_batch(  m,  n, &A_tst[0], lda, strideA, &tau_tst[0], stride_tau,    -1, &info_tst[0] ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    lapack::geqrf_batch( m, n, &A_tst[0], lda, strideA,
+                         &tau_tst[0], stride_tau, batch, &info_tst[0] );
+    time = testsweeper::get_wtime() - time;
+    for (int64_t i = 0; i < batch; ++i) {
+        if (info_tst[ i ] != 0) {
+            fprintf( stderr, "lapack::geqrf_batch returned error %lld in matrix %lld\n",
+                     llong( info_tst[ i ] ), llong( i ) );
+        }
+    }
+
+    params.time() = time;
+    double gflop = batch * lapack::Gflop< scalar_t >::geqrf( m, n );
+    params.gflops() = gflop / time;
+
+    if (verbose >= 2) {
+        printf( "A0_factor = " ); print_matrix( m, n, &A_tst[0], lda );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Apply Q_i^H to A_i, then take max over batch of
+        // || Q^H A - R ||_1 / (n ||A||_1).
+        std::vector< scalar_t > C = A_ref;
+        std::vector< int64_t > info_mqr( batch );
+        lapack::unmqr_batch( lapack::Side::Left, lapack::Op::ConjTrans,
+                             m, n, minmn, &A_tst[0], lda, strideA,
+                             &tau_tst[0], stride_tau,
+                             &C[0], lda, strideA, batch, &info_mqr[0] );
+
+        real_t error = 0;
+        for (int64_t i = 0; i < batch; ++i) {
+            scalar_t* Ai = &A_ref[ i*strideA ];
+            scalar_t* Ri = &A_tst[ i*strideA ];
+            scalar_t* Ci = &C[ i*strideA ];
+            // C_i -= R_i, where R_i is the upper triangle of the factor.
+            for (int64_t j = 0; j < n; ++j) {
+                for (int64_t k = 0; k <= j && k < m; ++k)
+                    Ci[ k + j*lda ] -= Ri[ k + j*lda ];
+            }
+            real_t error_i = lapack::lange( lapack::Norm::One, m, n, Ci, lda );
+            real_t Anorm = lapack::lange( lapack::Norm::One, m, n, Ai, lda );
+            if (Anorm > 0)
+                error_i /= (n * Anorm);
+            error = blas::max( error, error_i );
+        }
+
+        // Pointer-array and variable-size versions should give the
+        // same results as strided.
+        std::vector< scalar_t > A2 = A_ref;
+        std::vector< scalar_t > A3 = A_ref;
+        std::vector< scalar_t > tau2( size_tau ), tau3( size_tau );
+        std::vector< int64_t > info2( batch ), info3( batch );
+        std::vector< scalar_t* > Aarray( batch ), tau_array( batch );
+        std::vector< scalar_t* > Aarray3( batch ), tau_array3( batch );
+        std::vector< int64_t > m_array( batch, m ), n_array( batch, n );
+        std::vector< int64_t > lda_array( batch, lda );
+        for (int64_t i = 0; i < batch; ++i) {
+            Aarray[ i ]     = &A2[ i*strideA ];
+            tau_array[ i ]  = &tau2[ i*stride_tau ];
+            Aarray3[ i ]    = &A3[ i*strideA ];
+            tau_array3[ i ] = &tau3[ i*stride_tau ];
+        }
+        lapack::geqrf_batch( m, n, &Aarray[0], lda, &tau_array[0],
+                             batch, &info2[0] );
+        lapack::geqrf_vbatch( &m_array[0], &n_array[0], &Aarray3[0],
+                              &lda_array[0], &tau_array3[0],
+                              batch, &info3[0] );
+        bool same = (A2 == A_tst && tau2 == tau_tst && info2 == info_tst
+                     && A3 == A_tst && tau3 == tau_tst && info3 == info_tst);
+
+        // Pointer-array unmqr_batch.
+        std::vector< scalar_t > C2 = A_ref;
+        std::vector< scalar_t const* > Aarray_const( Aarray.begin(), Aarray.end() );
+        std::vector< scalar_t const* > tau_array_const( tau_array.begin(), tau_array.end() );
+        std::vector< scalar_t* > Carray( batch );
+        for (int64_t i = 0; i < batch; ++i) {
+            Carray[ i ] = &C2[ i*strideA ];
+        }
+        lapack::unmqr_batch( lapack::Side::Left, lapack::Op::ConjTrans,
+                             m, n, minmn, &Aarray_const[0], lda,
+                             &tau_array_const[0], &Carray[0], lda,
+                             batch, &info2[0] );
+        for (int64_t i = 0; i < batch; ++i) {
+            for (int64_t j = 0; j < n; ++j) {
+                for (int64_t k = 0; k <= j && k < m; ++k)
+                    C2[ i*strideA + k + j*lda ] -= A_tst[ i*strideA + k + j*lda ];
+            }
+        }
+        same = same && (C2 == C && info2 == info_mqr);
+
+        params.error() = error;
+        params.okay() = (error < tol && same);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t i = 0; i < batch; ++i) {
+            int64_t info_ref = LAPACKE_geqrf(
+                m, n, &A_ref[ i*strideA ], lda, &tau_ref[ i*stride_tau ] );
+            if (info_ref != 0) {
+                fprintf( stderr, "LAPACKE_geqrf returned error %lld in matrix %lld\n",
+                         llong( info_ref ), llong( i ) );
+            }
+        }
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_geqrf_batch( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_geqrf_batch_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_geqrf_batch_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_geqrf_batch_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_geqrf_batch_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
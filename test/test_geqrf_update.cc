@@ -0,0 +1,197 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "lapacke_wrappers.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Returns || A^H A - R^H R ||_1 / (m || A^H A ||_1), for m-by-n A and
+// R in the upper triangle of the n-by-n leading block of R_array.
+// R may differ from geqrf of A by the phases of its rows,
+// so it is compared via the Gram matrix.
+template< typename scalar_t >
+blas::real_type< scalar_t > gram_error(
+    int64_t m, int64_t n,
+    scalar_t const* A, int64_t lda,
+    scalar_t const* R_array, int64_t ldr )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    int64_t ldg = blas::max( 1, n );
+    std::vector< scalar_t > G( ldg * n );
+    std::vector< scalar_t > R( ldg * n );
+    lapack::laset( lapack::MatrixType::Lower, n, n, 0.0, 0.0, &R[0], ldg );
+    lapack::lacpy( lapack::MatrixType::Upper, n, n, R_array, ldr, &R[0], ldg );
+
+    blas::herk( blas::Layout::ColMajor, lapack::Uplo::Upper,
+                blas::Op::ConjTrans, n, m, 1.0, A, lda, 0.0, &G[0], ldg );
+    real_t Gnorm = lapack::lanhe( lapack::Norm::One, lapack::Uplo::Upper,
+                                  n, &G[0], ldg );
+    blas::herk( blas::Layout::ColMajor, lapack::Uplo::Upper,
+                blas::Op::ConjTrans, n, n, -1.0, &R[0], ldg, 1.0, &G[0], ldg );
+    real_t error = lapack::lanhe( lapack::Norm::One, lapack::Uplo::Upper,
+                                  n, &G[0], ldg );
+    if (Gnorm != 0)
+        error /= (blas::max( 1, m ) * Gnorm);
+    return error;
+}
+
+// -----------------------------------------------------------------------------
+// Tests geqrf_insert_rows and geqrf_delete_rows, with k = nrhs rows.
+// error is R of the first m rows, with the next k rows inserted,
+// compared with the full (m + k)-by-n matrix;
+// error2 is R after deleting those k rows, compared with the first m rows.
+template< typename scalar_t >
+void test_geqrf_update_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t k = params.nrhs();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.error2();
+    params.msg();
+
+    if (! run)
+        return;
+
+    if (m < n) {
+        params.msg() = "skipping: requires m >= n";
+        return;
+    }
+
+    // ---------- setup
+    // A is (m + k)-by-n; the last k rows are W.
+    int64_t mk = m + k;
+    int64_t lda = roundup( blas::max( 1, mk ), align );
+    int64_t ldw = roundup( blas::max( 1, k ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_W = (size_t) ldw * n;
+
+    std::vector< scalar_t > A( size_A );
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< scalar_t > W( size_W );
+    std::vector< scalar_t > tau( n );
+
+    lapack::generate_matrix( params.matrix, mk, n, &A[0], lda );
+    lapack::lacpy( lapack::MatrixType::General, k, n, &A[ m ], lda, &W[0], ldw );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A m=%5lld, n=%5lld, lda=%5lld\n"
+                "W k=%5lld, n=%5lld, ldw=%5lld\n",
+                llong( m ), llong( n ), llong( lda ),
+                llong( k ), llong( n ), llong( ldw ) );
+    }
+    if (verbose >= 2) {
+        printf( "A = " ); print_matrix( mk, n, &A[0], lda );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::geqrf_insert_rows( -1,  k, &A_tst[0], lda, &W[0], ldw ), lapack::Error );
+        assert_throw( lapack::geqrf_insert_rows(  n, -1, &A_tst[0], lda, &W[0], ldw ), lapack::Error );
+        assert_throw( lapack::geqrf_insert_rows(  n,  k, &A_tst[0], n-1, &W[0], ldw ), lapack::Error );
+        assert_throw( lapack::geqrf_insert_rows(  n,  k, &A_tst[0], lda, &W[0], k-1 ), lapack::Error );
+
+        assert_throw( lapack::geqrf_delete_rows( -1,  k, &A_tst[0], lda, &W[0], ldw ), lapack::Error );
+        assert_throw( lapack::geqrf_delete_rows(  n, -1, &A_tst[0], lda, &W[0], ldw ), lapack::Error );
+        assert_throw( lapack::geqrf_delete_rows(  n,  k, &A_tst[0], n-1, &W[0], ldw ), lapack::Error );
+        assert_throw( lapack::geqrf_delete_rows(  n,  k, &A_tst[0], lda, &W[0], k-1 ), lapack::Error );
+    }
+
+    // Factor the first m rows.
+    A_tst = A;
+    lapack::geqrf( m, n, &A_tst[0], lda, &tau[0] );
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    int64_t info_tst = lapack::geqrf_insert_rows( n, k, &A_tst[0], lda, &W[0], ldw );
+    time = testsweeper::get_wtime() - time;
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::geqrf_insert_rows returned error %lld\n",
+                 llong( info_tst ) );
+    }
+
+    params.time() = time;
+
+    if (verbose >= 2) {
+        printf( "R_insert = " ); print_matrix( n, n, &A_tst[0], lda );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        real_t error = gram_error( mk, n, &A[0], lda, &A_tst[0], lda );
+
+        info_tst = lapack::geqrf_delete_rows( n, k, &A_tst[0], lda, &W[0], ldw );
+        if (info_tst != 0) {
+            fprintf( stderr, "lapack::geqrf_delete_rows returned error %lld\n",
+                     llong( info_tst ) );
+        }
+        real_t error2 = gram_error( m, n, &A[0], lda, &A_tst[0], lda );
+
+        params.error() = error;
+        params.error2() = error2;
+        params.okay() = (error < tol) && (error2 < tol) && (info_tst == 0);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference, refactoring from scratch
+        A_ref = A;
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = LAPACKE_geqrf( mk, n, &A_ref[0], lda, &tau[0] );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "LAPACKE_geqrf returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_geqrf_update( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_geqrf_update_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_geqrf_update_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_geqrf_update_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_geqrf_update_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
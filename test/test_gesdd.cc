@@ -13,6 +13,52 @@
 
 #include <vector>
 
+// -----------------------------------------------------------------------------
+// Calls the gesdd overload with caller-provided workspace, of the lengths
+// from gesdd_work_size. If i_short > 0, the i_short-th workspace array
+// (work, iwork) is passed with length 0, to check that it is rejected.
+template< typename real_t >
+int64_t gesdd_workspace(
+    lapack::Job jobz, int64_t m, int64_t n,
+    real_t* A, int64_t lda,
+    real_t* S,
+    real_t* U, int64_t ldu,
+    real_t* VT, int64_t ldvt,
+    int i_short )
+{
+    int64_t lwork, liwork;
+    lapack::gesdd_work_size( jobz, m, n, A, lda, S, U, ldu, VT, ldvt,
+                             &lwork, &liwork );
+    std::vector< real_t > work( blas::max( 1, lwork ) );
+    std::vector< int64_t > iwork( blas::max( 1, liwork ) );
+    return lapack::gesdd( jobz, m, n, A, lda, S, U, ldu, VT, ldvt,
+                          &work[0],  (i_short == 1 ? 0 : lwork),
+                          &iwork[0], (i_short == 2 ? 0 : liwork) );
+}
+
+// -----------------------------------------------------------------------------
+// Complex version; workspace arrays are (work, rwork, iwork).
+template< typename real_t >
+int64_t gesdd_workspace(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex< real_t >* A, int64_t lda,
+    real_t* S,
+    std::complex< real_t >* U, int64_t ldu,
+    std::complex< real_t >* VT, int64_t ldvt,
+    int i_short )
+{
+    int64_t lwork, lrwork, liwork;
+    lapack::gesdd_work_size( jobz, m, n, A, lda, S, U, ldu, VT, ldvt,
+                             &lwork, &lrwork, &liwork );
+    std::vector< std::complex< real_t > > work( blas::max( 1, lwork ) );
+    std::vector< real_t > rwork( blas::max( 1, lrwork ) );
+    std::vector< int64_t > iwork( blas::max( 1, liwork ) );
+    return lapack::gesdd( jobz, m, n, A, lda, S, U, ldu, VT, ldvt,
+                          &work[0],  (i_short == 1 ? 0 : lwork),
+                          &rwork[0], (i_short == 2 ? 0 : lrwork),
+                          &iwork[0], (i_short == 3 ? 0 : liwork) );
+}
+
 // -----------------------------------------------------------------------------
 template< typename scalar_t >
 void test_gesdd_work( Params& params, bool run )
@@ -24,6 +70,7 @@ void test_gesdd_work( Params& params, bool run )
     int64_t m = params.dim.m();
     int64_t n = params.dim.n();
     int64_t align = params.align();
+    int64_t verbose = params.verbose();
     params.matrix.mark();
 
     real_t eps = std::numeric_limits< real_t >::epsilon();
@@ -37,6 +84,7 @@ void test_gesdd_work( Params& params, bool run )
     params.ortho_V();
     params.error2();
     params.error2.name( "Sigma" );
+    params.msg();
 
     if (! run)
         return;
@@ -63,6 +111,13 @@ void test_gesdd_work( Params& params, bool run )
     lapack::generate_matrix( params.matrix, m, n, &A_tst[0], lda );
     A_ref = A_tst;
 
+    // test error exits
+    if (params.error_exit() == 'y') {
+        // LAPACK checks lwork; it calls xerbla before lapack::Error.
+        std::vector< scalar_t > A_ws = A_ref;
+        assert_throw( gesdd_workspace( jobu, m, n, &A_ws[0], lda, &S_tst[0], &U_tst[0], ldu, &VT_tst[0], ldvt, 1 ), lapack::Error );
+    }
+
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
     double time = testsweeper::get_wtime();
@@ -76,6 +131,42 @@ void test_gesdd_work( Params& params, bool run )
     //double gflop = lapack::Gflop< scalar_t >::gesdd( jobu, m, n );
     //params.gflops() = gflop / time;
 
+    // ---------- check caller-provided workspace overload
+    // It gives the same singular values as the allocating gesdd,
+    // and rejects each workspace array that is too short
+    // (except lwork, checked by LAPACK, above in error exits).
+    int64_t ws_errors = 0;
+    {
+        std::vector< scalar_t > A_ws = A_ref;
+        std::vector< real_t > S_ws( size_S );
+        std::vector< scalar_t > U_ws( size_U );
+        std::vector< scalar_t > VT_ws( size_VT );
+        int64_t info_ws = gesdd_workspace(
+            jobu, m, n, &A_ws[0], lda, &S_ws[0], &U_ws[0], ldu, &VT_ws[0], ldvt, 0 );
+        if (info_ws != info_tst || rel_error( S_ws, S_tst ) >= tol)
+            ++ws_errors;
+
+        int num_arrays = blas::is_complex< scalar_t >::value ? 3 : 2;
+        for (int i_short = 2; i_short <= num_arrays; ++i_short) {
+            // iwork has length 8*min(m,n), which can be 0
+            bool expect = (i_short < num_arrays || blas::min( m, n ) > 0);
+            bool threw = false;
+            A_ws = A_ref;
+            try {
+                gesdd_workspace(
+                    jobu, m, n, &A_ws[0], lda, &S_ws[0], &U_ws[0], ldu, &VT_ws[0], ldvt,
+                    i_short );
+            }
+            catch (lapack::Error&) {
+                threw = true;
+            }
+            if (threw != expect)
+                ++ws_errors;
+        }
+        if (ws_errors > 0)
+            params.msg() = "workspace errors " + std::to_string( ws_errors );
+    }
+
     // ---------- check numerical error
     // errors[0] = || A - U diag(S) VT || / (||A|| max(m,n)),
     //                                    if jobu  != NoVec
@@ -133,7 +224,8 @@ void test_gesdd_work( Params& params, bool run )
         (jobu == lapack::Job::NoVec || errors[0] < tol) &&
         (jobu == lapack::Job::NoVec || errors[1] < tol) &&
         (jobu == lapack::Job::NoVec || errors[2] < tol) &&
-        errors[3] < tol);
+        errors[3] < tol &&
+        ws_errors == 0);
 }
 
 // -----------------------------------------------------------------------------
@@ -0,0 +1,252 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "lapacke_wrappers.hh"
+#include "check_svd.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_gesdd_batch_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using lapack::Job;
+
+    // get & mark input values
+    lapack::Job jobz = params.jobu();
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t batch = params.batch();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ortho_U();
+    params.ortho_V();
+    params.error2();
+    params.error2.name( "Sigma" );
+
+    if (! run)
+        return;
+
+    // U and VT as in gesvd; for OverwriteVec, one of them is in A.
+    lapack::Job jobu = jobz;
+    lapack::Job jobvt = jobz;
+    if (jobz == Job::OverwriteVec) {
+        if (m >= n)
+            jobvt = Job::AllVec;
+        else
+            jobu = Job::AllVec;
+    }
+
+    // ---------- setup
+    int64_t minmn = blas::min( m, n );
+    int64_t u_ncol = (jobu == Job::AllVec ? m : minmn);
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    int64_t ldu = roundup( blas::max( 1, m ), align );
+    int64_t v_nrow = (jobvt == Job::AllVec ? n : minmn);
+    int64_t ldvt = roundup( blas::max( 1, v_nrow ), align );
+    int64_t strideA = lda * n;
+    int64_t strideS = minmn;
+    int64_t strideU = ldu * u_ncol;
+    int64_t strideVT = ldvt * n;
+    size_t size_A = (size_t) strideA * batch;
+    size_t size_S = (size_t) strideS * batch;
+    size_t size_U = (size_t) strideU * batch;
+    size_t size_VT = (size_t) strideVT * batch;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< real_t > Sigma_tst( size_S );
+    std::vector< real_t > Sigma_ref( size_S );
+    std::vector< scalar_t > U_tst( size_U );
+    std::vector< scalar_t > U_ref( size_U );
+    std::vector< scalar_t > VT_tst( size_VT );
+    std::vector< scalar_t > VT_ref( size_VT );
+    std::vector< int64_t > info_tst( batch );
+
+    for (int64_t i = 0; i < batch; ++i) {
+        lapack::generate_matrix( params.matrix, m, n, &A_tst[ i*strideA ], lda );
+    }
+    A_ref = A_tst;
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A m=%5lld, n=%5lld, lda=%5lld, batch=%5lld\n",
+                llong( m ), llong( n ), llong( lda ), llong( batch ) );
+    }
+    if (verbose >= 2) {
+        printf( "A0 = " ); print_matrix( m, n, &A_tst[0], lda );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::gesdd_batch( Job(0),  m,  n, &A_tst[0], lda, strideA, &Sigma_tst[0], strideS, &U_tst[0], ldu, strideU, &VT_tst[0], ldvt, strideVT, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::gesdd_batch( jobz, -1,  n, &A_tst[0], lda, strideA, &Sigma_tst[0], strideS, &U_tst[0], ldu, strideU, &VT_tst[0], ldvt, strideVT, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::gesdd_batch( jobz,  m, -1, &A_tst[0], lda, strideA, &Sigma_tst[0], strideS, &U_tst[0], ldu, strideU, &VT_tst[0], ldvt, strideVT, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::gesdd_batch( jobz,  m,  n, &A_tst[0], m-1, strideA, &Sigma_tst[0], strideS, &U_tst[0], ldu, strideU, &VT_tst[0], ldvt, strideVT, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::gesdd_batch( jobz,  m,  n, &A_tst[0], lda, strideA, &Sigma_tst[0], strideS, &U_tst[0], ldu, strideU, &VT_tst[0], ldvt, strideVT,    -1, &info_tst[0] ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    lapack::gesdd_batch( jobz, m, n,
+                         &A_tst[0], lda, strideA,
+                         &Sigma_tst[0], strideS,
+                         &U_tst[0], ldu, strideU,
+                         &VT_tst[0], ldvt, strideVT,
+                         batch, &info_tst[0] );
+    time = testsweeper::get_wtime() - time;
+    for (int64_t i = 0; i < batch; ++i) {
+        if (info_tst[ i ] != 0) {
+            fprintf( stderr, "lapack::gesdd_batch returned error %lld in matrix %lld\n",
+                     llong( info_tst[ i ] ), llong( i ) );
+        }
+    }
+
+    params.time() = time;
+
+    if (verbose >= 2) {
+        printf( "Sigma0 = " ); print_vector( minmn, &Sigma_tst[0], 1 );
+    }
+
+    // ---------- check numerical error
+    // Max over batch of the check_svd results:
+    // result[ 0 ] = || A - U Sigma VT || / (||A|| max( m, n )),
+    //                                      if jobu  != NoVec and jobvt != NoVec.
+    // result[ 1 ] = || I - U^H U || / m,   if jobu  != NoVec.
+    // result[ 2 ] = || I - VT VT^H || / n, if jobvt != NoVec.
+    // result[ 3 ] = 0 if Sigma has non-negative values in non-increasing order,
+    //                 else >= 1.
+    real_t result[ 4 ] = { 0, 0, 0, 0 };
+    bool same = true;
+    if (params.check() == 'y') {
+        for (int64_t i = 0; i < batch; ++i) {
+            // U2 or VT2 points to A if overwriting
+            scalar_t* U2    = &U_tst[ i*strideU ];
+            int64_t   ldu2  = ldu;
+            scalar_t* VT2   = &VT_tst[ i*strideVT ];
+            int64_t   ldvt2 = ldvt;
+            if (jobu == Job::OverwriteVec) {
+                U2   = &A_tst[ i*strideA ];
+                ldu2 = lda;
+            }
+            else if (jobvt == Job::OverwriteVec) {
+                VT2   = &A_tst[ i*strideA ];
+                ldvt2 = lda;
+            }
+            real_t result_i[ 4 ] = { (real_t) testsweeper::no_data_flag,
+                                     (real_t) testsweeper::no_data_flag,
+                                     (real_t) testsweeper::no_data_flag,
+                                     (real_t) testsweeper::no_data_flag };
+            check_svd( jobu, jobvt, m, n, &A_ref[ i*strideA ], lda,
+                       &Sigma_tst[ i*strideS ], U2, ldu2, VT2, ldvt2,
+                       result_i );
+            for (int k = 0; k < 4; ++k)
+                result[ k ] = blas::max( result[ k ], result_i[ k ] );
+        }
+        if (jobu == Job::NoVec || jobvt == Job::NoVec)
+            result[ 0 ] = (real_t) testsweeper::no_data_flag;
+        if (jobu == Job::NoVec)
+            result[ 1 ] = (real_t) testsweeper::no_data_flag;
+        if (jobvt == Job::NoVec)
+            result[ 2 ] = (real_t) testsweeper::no_data_flag;
+
+        // Pointer-array version should give the same results as strided.
+        std::vector< scalar_t > A2 = A_ref;
+        std::vector< real_t > Sigma2( size_S );
+        std::vector< scalar_t > U2( size_U ), VT2( size_VT );
+        std::vector< int64_t > info2( batch );
+        std::vector< scalar_t* > Aarray( batch ), Uarray( batch ), VTarray( batch );
+        std::vector< real_t* > Sarray( batch );
+        for (int64_t i = 0; i < batch; ++i) {
+            Aarray[ i ]  = &A2[ i*strideA ];
+            Sarray[ i ]  = &Sigma2[ i*strideS ];
+            Uarray[ i ]  = &U2[ i*strideU ];
+            VTarray[ i ] = &VT2[ i*strideVT ];
+        }
+        lapack::gesdd_batch( jobz, m, n, &Aarray[0], lda, &Sarray[0],
+                             &Uarray[0], ldu, &VTarray[0], ldvt,
+                             batch, &info2[0] );
+        same = (Sigma2 == Sigma_tst && info2 == info_tst
+                && A2 == A_tst && U2 == U_tst && VT2 == VT_tst);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_err = 0;
+        for (int64_t i = 0; i < batch; ++i) {
+            int64_t info_ref = LAPACKE_gesdd(
+                to_char( jobz ), m, n,
+                &A_ref[ i*strideA ], lda,
+                &Sigma_ref[ i*strideS ],
+                &U_ref[ i*strideU ], ldu,
+                &VT_ref[ i*strideVT ], ldvt );
+            if (info_ref != 0) {
+                fprintf( stderr, "LAPACKE_gesdd returned error %lld in matrix %lld\n",
+                         llong( info_ref ), llong( i ) );
+            }
+            if (info_tst[ i ] != info_ref)
+                info_err = 1;
+        }
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+
+        // ---------- check error compared to reference
+        result[ 0 ] += info_err;
+        result[ 3 ] += rel_error( Sigma_tst, Sigma_ref );
+    }
+    params.error()   = result[ 0 ];
+    params.ortho_U() = result[ 1 ];
+    params.ortho_V() = result[ 2 ];
+    params.error2()  = result[ 3 ];
+    params.okay() = (
+        (jobu == Job::NoVec || jobvt == Job::NoVec || result[ 0 ] < tol)
+        && (jobu  == Job::NoVec || result[ 1 ] < tol)
+        && (jobvt == Job::NoVec || result[ 2 ] < tol)
+        && result[ 3 ] < tol
+        && same);
+}
+
+// -----------------------------------------------------------------------------
+void test_gesdd_batch( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_gesdd_batch_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_gesdd_batch_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_gesdd_batch_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_gesdd_batch_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
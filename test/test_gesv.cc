@@ -23,6 +23,7 @@ void test_gesv_work( Params& params, bool run )
     const real_t   eps = std::numeric_limits< real_t >::epsilon();
 
     // get & mark input values
+    blas::Layout layout = params.layout();
     int64_t n = params.dim.n();
     int64_t nrhs = params.nrhs();
     int64_t align = params.align();
@@ -39,11 +40,14 @@ void test_gesv_work( Params& params, bool run )
         return;
 
     // ---------- setup
+    // For row-major, B is stored as the nrhs-by-n column-major B^T.
+    int64_t Bm = (layout == blas::Layout::ColMajor ? n : nrhs);
+    int64_t Bn = (layout == blas::Layout::ColMajor ? nrhs : n);
     int64_t lda = roundup( blas::max( 1, n ), align );
-    int64_t ldb = roundup( blas::max( 1, n ), align );
+    int64_t ldb = roundup( blas::max( 1, Bm ), align );
     size_t size_A = (size_t) lda * n;
     size_t size_ipiv = (size_t) (n);
-    size_t size_B = (size_t) ldb * nrhs;
+    size_t size_B = (size_t) ldb * Bn;
 
     std::vector< scalar_t > A_tst( size_A );
     std::vector< scalar_t > A_ref( size_A );
@@ -70,7 +74,7 @@ void test_gesv_work( Params& params, bool run )
         printf( "A = " );
         print_matrix( n, n, &A_tst[0], lda );
         printf( "B = " );
-        print_matrix( n, nrhs, &B_tst[0], ldb );
+        print_matrix( Bm, Bn, &B_tst[0], ldb );
     }
 
     // test error exits
@@ -79,12 +83,14 @@ void test_gesv_work( Params& params, bool run )
         assert_throw( lapack::gesv(  n,   -1, &A_tst[0], lda, &ipiv_tst[0], &B_tst[0], ldb ), lapack::Error );
         assert_throw( lapack::gesv(  n, nrhs, &A_tst[0], n-1, &ipiv_tst[0], &B_tst[0], ldb ), lapack::Error );
         assert_throw( lapack::gesv(  n, nrhs, &A_tst[0], lda, &ipiv_tst[0], &B_tst[0], n-1 ), lapack::Error );
+        assert_throw( lapack::gesv( blas::Layout(0), n, nrhs, &A_tst[0], lda, &ipiv_tst[0], &B_tst[0], ldb ), lapack::Error );
+        assert_throw( lapack::gesv( layout, n, nrhs, &A_tst[0], lda, &ipiv_tst[0], &B_tst[0], Bm-1 ), lapack::Error );
     }
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
     double time = testsweeper::get_wtime();
-    int64_t info_tst = lapack::gesv( n, nrhs, &A_tst[0], lda, &ipiv_tst[0],
+    int64_t info_tst = lapack::gesv( layout, n, nrhs, &A_tst[0], lda, &ipiv_tst[0],
                                      &B_tst[0], ldb );
     time = testsweeper::get_wtime() - time;
     if (info_tst != 0) {
@@ -99,31 +105,35 @@ void test_gesv_work( Params& params, bool run )
         printf( "A_factor = " );
         print_matrix( n, n, &A_tst[0], lda );
         printf( "X = " );
-        print_matrix( n, nrhs, &B_tst[0], ldb );
+        print_matrix( Bm, Bn, &B_tst[0], ldb );
     }
 
     if (params.check() == 'y') {
         // ---------- check error
         // Relative backwards error = ||b - Ax|| / (n * ||A|| * ||x||).
-        blas::gemm( blas::Layout::ColMajor, blas::Op::NoTrans, blas::Op::NoTrans,
+        blas::gemm( layout, blas::Op::NoTrans, blas::Op::NoTrans,
                     n, nrhs, n,
                     -one, &A_ref[0], lda,
                           &B_tst[0], ldb,
                     one,  &B_ref[0], ldb );
         if (verbose >= 2) {
             printf( "R = " );
-            print_matrix( n, nrhs, &B_ref[0], ldb );
+            print_matrix( Bm, Bn, &B_ref[0], ldb );
         }
 
-        real_t error = lapack::lange( lapack::Norm::One, n, nrhs, &B_ref[0], ldb );
-        real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, &B_tst[0], ldb );
-        real_t Anorm = lapack::lange( lapack::Norm::One, n, n,    &A_ref[0], lda );
+        // The one norm of a row-major matrix is the inf norm of its storage.
+        lapack::Norm norm = (layout == blas::Layout::ColMajor
+                             ? lapack::Norm::One : lapack::Norm::Inf);
+        real_t error = lapack::lange( norm, Bm, Bn, &B_ref[0], ldb );
+        real_t Xnorm = lapack::lange( norm, Bm, Bn, &B_tst[0], ldb );
+        real_t Anorm = lapack::lange( norm, n,  n,  &A_ref[0], lda );
         error /= (n * Anorm * Xnorm);
         params.error() = error;
         params.okay() = (error < tol);
     }
 
-    if (params.ref() == 'y') {
+    // The LAPACKE reference is column-major only.
+    if (params.ref() == 'y' && layout == blas::Layout::ColMajor) {
         // ---------- run reference
         // Reset B in case check cleared it.
         int64_t iseed2[4] = { 0, 1, 2, 3 };
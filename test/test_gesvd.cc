@@ -21,6 +21,7 @@ void test_gesvd_work( Params& params, bool run )
     using lapack::Job;
 
     // get & mark input values
+    blas::Layout layout = params.layout();
     lapack::Job jobu = params.jobu();
     lapack::Job jobvt = params.jobvt();
     int64_t m = params.dim.m();
@@ -53,15 +54,21 @@ void test_gesvd_work( Params& params, bool run )
     }
 
     // ---------- setup
+    // For row-major, each matrix is stored as its column-major transpose:
+    // A as n-by-m, U as u_ncol-by-m, VT as n-by-v_nrow.
+    bool col = (layout == blas::Layout::ColMajor);
     int64_t u_ncol = (jobu == Job::AllVec ? m : blas::min( m, n ));
-    int64_t lda = roundup( blas::max( 1, m ), align );
-    int64_t ldu = roundup( m, align );
     int64_t v_nrow = (jobvt == Job::AllVec ? n : blas::min( m, n ));
-    int64_t ldvt = roundup( v_nrow, align );
-    size_t size_A = (size_t) lda * n;
+    int64_t Am  = (col ? m : n),      An  = (col ? n : m);
+    int64_t Um  = (col ? m : u_ncol), Un  = (col ? u_ncol : m);
+    int64_t VTm = (col ? v_nrow : n), VTn = (col ? n : v_nrow);
+    int64_t lda = roundup( blas::max( 1, Am ), align );
+    int64_t ldu = roundup( blas::max( 1, Um ), align );
+    int64_t ldvt = roundup( blas::max( 1, VTm ), align );
+    size_t size_A = (size_t) lda * An;
     size_t size_S = (size_t) (blas::min(m,n));
-    size_t size_U = (size_t) ldu * u_ncol;
-    size_t size_VT = (size_t) ldvt * n;
+    size_t size_U = (size_t) ldu * Un;
+    size_t size_VT = (size_t) ldvt * VTn;
 
     std::vector< scalar_t > A_tst( size_A );
     std::vector< scalar_t > A_ref( size_A );
@@ -72,11 +79,11 @@ void test_gesvd_work( Params& params, bool run )
     std::vector< scalar_t > VT_tst( size_VT );
     std::vector< scalar_t > VT_ref( size_VT );
 
-    lapack::generate_matrix( params.matrix, m, n, &A_tst[0], lda );
+    lapack::generate_matrix( params.matrix, Am, An, &A_tst[0], lda );
     A_ref = A_tst;
 
     if (verbose >= 2) {
-        printf( "A = " ); print_matrix( m, n, &A_tst[0], lda );
+        printf( "A = " ); print_matrix( Am, An, &A_tst[0], lda );
     }
 
 
@@ -84,7 +91,7 @@ void test_gesvd_work( Params& params, bool run )
     testsweeper::flush_cache( params.cache() );
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::gesvd(
-        jobu, jobvt, m, n,
+        layout, jobu, jobvt, m, n,
         &A_tst[0], lda,
         &Sigma_tst[0],
         &U_tst[0], ldu,
@@ -95,9 +102,9 @@ void test_gesvd_work( Params& params, bool run )
     }
 
     if (verbose >= 2) {
-        printf( "A_out = " ); print_matrix( m, n, &A_tst[0], lda );
-        printf( "U = "     ); print_matrix( m, u_ncol, &U_tst[0], ldu );
-        printf( "VT = "    ); print_matrix( v_nrow, n, &VT_tst[0], ldvt );
+        printf( "A_out = " ); print_matrix( Am, An, &A_tst[0], lda );
+        printf( "U = "     ); print_matrix( Um, Un, &U_tst[0], ldu );
+        printf( "VT = "    ); print_matrix( VTm, VTn, &VT_tst[0], ldvt );
         printf( "Sigma = " ); print_vector( n, &Sigma_tst[0], 1 );
     }
 
@@ -130,16 +137,25 @@ void test_gesvd_work( Params& params, bool run )
             VT2   = &A_tst[0];
             ldvt2 = lda;
         }
-        check_svd( jobu, jobvt, m, n, &A_ref[0], lda,
-                   &Sigma_tst[0], U2, ldu2, VT2, ldvt2, result );
+        if (col) {
+            check_svd( jobu, jobvt, m, n, &A_ref[0], lda,
+                       &Sigma_tst[0], U2, ldu2, VT2, ldvt2, result );
+        }
+        else {
+            // Stored A^T = VT^T Sigma U^T, so check it with U and VT swapped.
+            check_svd( jobvt, jobu, n, m, &A_ref[0], lda,
+                       &Sigma_tst[0], VT2, ldvt2, U2, ldu2, result );
+            std::swap( result[ 1 ], result[ 2 ] );
+        }
 
         if (verbose >= 2) {
-            printf( "U2 = "  ); print_matrix( m, u_ncol, U2, ldu2 );
-            printf( "VT2 = " ); print_matrix( v_nrow, n, VT2, ldvt2 );
+            printf( "U2 = "  ); print_matrix( Um, Un, U2, ldu2 );
+            printf( "VT2 = " ); print_matrix( VTm, VTn, VT2, ldvt2 );
         }
     }
 
-    if (params.ref() == 'y') {
+    // The LAPACKE reference is column-major only.
+    if (params.ref() == 'y' && col) {
         // ---------- run reference
         testsweeper::flush_cache( params.cache() );
         time = testsweeper::get_wtime();
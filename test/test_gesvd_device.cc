@@ -0,0 +1,246 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/device.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "check_svd.hh"
+#include "lapacke_wrappers.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_gesvd_device_work( Params& params, bool run )
+{
+    using lapack::device_info_int;
+    using real_t = blas::real_type< scalar_t >;
+    using lapack::Job;
+
+    // get & mark input values
+    lapack::Job jobu = params.jobu();
+    lapack::Job jobvt = params.jobvt();
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t device = params.device();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ortho_U();
+    params.ortho_V();
+    params.error2();
+    params.error2.name( "Sigma" );
+    params.msg();
+
+    if (! run)
+        return;
+
+    // The host backend runs without GPU devices.
+    #if ! defined( LAPACK_HAVE_HOST_QUEUE )
+        if (blas::get_device_count() == 0) {
+            params.msg() = "skipping: no GPU devices or no GPU support";
+            return;
+        }
+    #endif
+
+    // skip invalid options
+    if (jobu  == Job::OverwriteVec && jobvt == Job::OverwriteVec) {
+        params.msg() = "skipping: jobu and jobvt cannot both be overwrite.";
+        return;
+    }
+    #if defined( LAPACK_HAVE_CUBLAS )
+        if (m < n) {
+            params.msg() = "skipping: cuSolver requires m >= n";
+            return;
+        }
+    #endif
+
+    // ---------- setup
+    int64_t u_ncol = (jobu == Job::AllVec ? m : blas::min( m, n ));
+    int64_t v_nrow = (jobvt == Job::AllVec ? n : blas::min( m, n ));
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    int64_t ldu = roundup( blas::max( 1, m ), align );
+    int64_t ldvt = roundup( blas::max( 1, v_nrow ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_S = (size_t) (blas::min( m, n ));
+    size_t size_U = (size_t) ldu * u_ncol;
+    size_t size_VT = (size_t) ldvt * n;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< real_t > Sigma_tst( size_S );
+    std::vector< real_t > Sigma_ref( size_S );
+    std::vector< scalar_t > U_tst( size_U );
+    std::vector< scalar_t > U_ref( size_U );
+    std::vector< scalar_t > VT_tst( size_VT );
+    std::vector< scalar_t > VT_ref( size_VT );
+
+    lapack::generate_matrix( params.matrix, m, n, &A_tst[0], lda );
+    A_ref = A_tst;
+
+    // Allocate and copy to GPU.
+    lapack::Queue queue( device );
+    scalar_t*        dA     = lapack::device_malloc< scalar_t >( size_A, queue );
+    real_t*          dS     = lapack::device_malloc< real_t >( size_S, queue );
+    scalar_t*        dU     = lapack::device_malloc< scalar_t >( size_U, queue );
+    scalar_t*        dVT    = lapack::device_malloc< scalar_t >( size_VT, queue );
+    device_info_int* d_info = lapack::device_malloc< device_info_int >( 1, queue );
+    lapack::device_copy_matrix( m, n, A_tst.data(), lda, dA, lda, queue );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A m=%5lld, n=%5lld, lda=%5lld\n",
+                llong( m ), llong( n ), llong( lda ) );
+    }
+    if (verbose >= 2) {
+        printf( "A = " ); print_matrix( m, n, &A_tst[0], lda );
+    }
+
+    // Allocate workspace
+    size_t d_size, h_size;
+    lapack::gesvd_work_size_bytes( jobu, jobvt, m, n, dA, lda, dS,
+                                   dU, ldu, dVT, ldvt,
+                                   &d_size, &h_size, queue );
+    char* d_work = lapack::device_malloc< char >( d_size, queue );
+    std::vector<char> h_work_vector( h_size );
+    char* h_work = h_work_vector.data();
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    queue.sync();
+    double time = testsweeper::get_wtime();
+
+    lapack::gesvd( jobu, jobvt, m, n, dA, lda, dS, dU, ldu, dVT, ldvt,
+                   d_work, d_size, h_work, h_size, d_info, queue );
+
+    queue.sync();
+    time = testsweeper::get_wtime() - time;
+
+    params.time() = time;
+
+    // Copy result back to CPU.
+    device_info_int info_tst;
+    lapack::device_copy_matrix( m, n, dA, lda, A_tst.data(), lda, queue );
+    lapack::device_copy_vector( size_S, dS, 1, Sigma_tst.data(), 1, queue );
+    if (jobu == Job::AllVec || jobu == Job::SomeVec)
+        lapack::device_copy_matrix( m, u_ncol, dU, ldu, U_tst.data(), ldu, queue );
+    if (jobvt == Job::AllVec || jobvt == Job::SomeVec)
+        lapack::device_copy_matrix( v_nrow, n, dVT, ldvt, VT_tst.data(), ldvt, queue );
+    lapack::device_memcpy( &info_tst, d_info, 1, queue );
+    queue.sync();
+
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::gesvd returned error %lld\n", llong( info_tst ) );
+    }
+
+    // Cleanup GPU memory.
+    lapack::device_free( dA, queue );
+    lapack::device_free( dS, queue );
+    lapack::device_free( dU, queue );
+    lapack::device_free( dVT, queue );
+    lapack::device_free( d_info, queue );
+    lapack::device_free( d_work, queue );
+
+    if (verbose >= 2) {
+        printf( "Sigma = " ); print_vector( size_S, &Sigma_tst[0], 1 );
+    }
+
+    // ---------- check numerical error
+    // result[ 0 ] = || A - U Sigma VT || / (||A|| max( m, n )),
+    //                                      if jobu  != NoVec and jobvt != NoVec.
+    // result[ 1 ] = || I - U^H U || / m,   if jobu  != NoVec.
+    // result[ 2 ] = || I - VT VT^H || / n, if jobvt != NoVec.
+    // result[ 3 ] = 0 if Sigma has non-negative values in non-increasing order,
+    //                 else >= 1.
+    real_t result[ 4 ] = { (real_t) testsweeper::no_data_flag,
+                           (real_t) testsweeper::no_data_flag,
+                           (real_t) testsweeper::no_data_flag,
+                           (real_t) testsweeper::no_data_flag };
+    if (params.check() == 'y') {
+        // U2 or VT2 points to A if overwriting
+        scalar_t* U2    = &U_tst[0];
+        int64_t   ldu2  = ldu;
+        scalar_t* VT2   = &VT_tst[0];
+        int64_t   ldvt2 = ldvt;
+        if (jobu == Job::OverwriteVec) {
+            U2   = &A_tst[0];
+            ldu2 = lda;
+        }
+        else if (jobvt == Job::OverwriteVec) {
+            VT2   = &A_tst[0];
+            ldvt2 = lda;
+        }
+        check_svd( jobu, jobvt, m, n, &A_ref[0], lda,
+                   &Sigma_tst[0], U2, ldu2, VT2, ldvt2, result );
+    }
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = LAPACKE_gesvd(
+            to_char( jobu ), to_char( jobvt ), m, n,
+            &A_ref[0], lda,
+            &Sigma_ref[0],
+            &U_ref[0], ldu,
+            &VT_ref[0], ldvt );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "LAPACKE_gesvd returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+
+        // ---------- check error compared to reference
+        if (info_tst != info_ref) {
+            result[ 0 ] = 1;
+        }
+        result[ 3 ] += rel_error( Sigma_tst, Sigma_ref );
+    }
+    params.error()   = result[ 0 ];
+    params.ortho_U() = result[ 1 ];
+    params.ortho_V() = result[ 2 ];
+    params.error2()  = result[ 3 ];
+    params.okay() = (
+        (jobu == Job::NoVec || jobvt == Job::NoVec || result[ 0 ] < tol)
+        && (jobu  == Job::NoVec || result[ 1 ] < tol)
+        && (jobvt == Job::NoVec || result[ 2 ] < tol)
+        && result[ 3 ] < tol);
+}
+
+// -----------------------------------------------------------------------------
+void test_gesvd_device( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_gesvd_device_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_gesvd_device_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_gesvd_device_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_gesvd_device_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
@@ -21,9 +21,14 @@ void test_getrf_work( Params& params, bool run )
     // get & mark input values
     int64_t m = params.dim.m();
     int64_t n = params.dim.n();
+    lapack::MethodLU method = params.method_lu();
     int64_t align = params.align();
     int64_t verbose = params.verbose();
     params.matrix.mark();
+    if (method == lapack::MethodLU::Native) {
+        params.nb();
+        params.lookahead();
+    }
 
     real_t eps = std::numeric_limits< real_t >::epsilon();
     real_t tol = params.tol() * eps;
@@ -63,13 +68,24 @@ void test_getrf_work( Params& params, bool run )
         assert_throw( lapack::getrf( -1,  n, &A_tst[0], lda, &ipiv_tst[0] ), lapack::Error );
         assert_throw( lapack::getrf(  m, -1, &A_tst[0], lda, &ipiv_tst[0] ), lapack::Error );
         assert_throw( lapack::getrf(  m,  n, &A_tst[0], m-1, &ipiv_tst[0] ), lapack::Error );
+
+        assert_throw( lapack::getrf_native( -1,  n, &A_tst[0], lda, &ipiv_tst[0] ), lapack::Error );
+        assert_throw( lapack::getrf_native(  m, -1, &A_tst[0], lda, &ipiv_tst[0] ), lapack::Error );
+        assert_throw( lapack::getrf_native(  m,  n, &A_tst[0], m-1, &ipiv_tst[0] ), lapack::Error );
+        assert_throw( lapack::getrf_native(  m,  n, &A_tst[0], lda, &ipiv_tst[0],  0 ), lapack::Error );
+        assert_throw( lapack::getrf_native(  m,  n, &A_tst[0], lda, &ipiv_tst[0], 32, -1 ), lapack::Error );
     }
 
     // ---------- run test
+    // Select method via getrf_set_method, so dispatch in getrf is tested.
+    if (method == lapack::MethodLU::Native) {
+        lapack::getrf_set_method( method, params.nb(), params.lookahead() );
+    }
     testsweeper::flush_cache( params.cache() );
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::getrf( m, n, &A_tst[0], lda, &ipiv_tst[0] );
     time = testsweeper::get_wtime() - time;
+    lapack::getrf_set_method( lapack::MethodLU::Lapack );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::getrf returned error %lld\n", llong( info_tst ) );
     }
@@ -13,6 +13,47 @@
 
 #include <vector>
 
+// -----------------------------------------------------------------------------
+// Calls the heevd overload with caller-provided workspace, of the lengths
+// from heevd_work_size. If i_short > 0, the i_short-th workspace array
+// (work, iwork) is passed with length 0, to check that it is rejected.
+template< typename real_t >
+int64_t heevd_workspace(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    real_t* A, int64_t lda,
+    real_t* W,
+    int i_short )
+{
+    int64_t lwork, liwork;
+    lapack::heevd_work_size( jobz, uplo, n, A, lda, W, &lwork, &liwork );
+    std::vector< real_t > work( blas::max( 1, lwork ) );
+    std::vector< int64_t > iwork( blas::max( 1, liwork ) );
+    return lapack::heevd( jobz, uplo, n, A, lda, W,
+                          &work[0],  (i_short == 1 ? 0 : lwork),
+                          &iwork[0], (i_short == 2 ? 0 : liwork) );
+}
+
+// -----------------------------------------------------------------------------
+// Complex version; workspace arrays are (work, rwork, iwork).
+template< typename real_t >
+int64_t heevd_workspace(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex< real_t >* A, int64_t lda,
+    real_t* W,
+    int i_short )
+{
+    int64_t lwork, lrwork, liwork;
+    lapack::heevd_work_size( jobz, uplo, n, A, lda, W,
+                             &lwork, &lrwork, &liwork );
+    std::vector< std::complex< real_t > > work( blas::max( 1, lwork ) );
+    std::vector< real_t > rwork( blas::max( 1, lrwork ) );
+    std::vector< int64_t > iwork( blas::max( 1, liwork ) );
+    return lapack::heevd( jobz, uplo, n, A, lda, W,
+                          &work[0],  (i_short == 1 ? 0 : lwork),
+                          &rwork[0], (i_short == 2 ? 0 : lrwork),
+                          &iwork[0], (i_short == 3 ? 0 : liwork) );
+}
+
 // -----------------------------------------------------------------------------
 template< typename scalar_t >
 void test_heevd_work( Params& params, bool run )
@@ -39,6 +80,7 @@ void test_heevd_work( Params& params, bool run )
     params.ortho();
     params.error2();
     params.error2.name( "Lambda" );
+    params.msg();
 
     if (! run)
         return;
@@ -84,6 +126,36 @@ void test_heevd_work( Params& params, bool run )
         printf( "Lambda = " ); print_vector( n, &Lambda_tst[0], 1 );
     }
 
+    // ---------- check caller-provided workspace overload
+    // It gives the same eigenvalues as the allocating heevd,
+    // and rejects each workspace array that is too short.
+    int64_t ws_errors = 0;
+    {
+        std::vector< scalar_t > Z_ws = A;
+        std::vector< real_t > Lambda_ws( n );
+        int64_t info_ws = heevd_workspace(
+            jobz, uplo, n, &Z_ws[0], lda, &Lambda_ws[0], 0 );
+        if (info_ws != info_tst || rel_error( Lambda_ws, Lambda_tst ) >= tol)
+            ++ws_errors;
+
+        int num_arrays = blas::is_complex< scalar_t >::value ? 3 : 2;
+        for (int i_short = 1; i_short <= num_arrays; ++i_short) {
+            bool threw = false;
+            Z_ws = A;
+            try {
+                heevd_workspace(
+                    jobz, uplo, n, &Z_ws[0], lda, &Lambda_ws[0], i_short );
+            }
+            catch (lapack::Error&) {
+                threw = true;
+            }
+            if (! threw)
+                ++ws_errors;
+        }
+        if (ws_errors > 0)
+            params.msg() = "workspace errors " + std::to_string( ws_errors );
+    }
+
     if (params.check() == 'y') {
         // ---------- check numerical error
         // result[ 0 ] = || A - Z Lambda Z^H || / (n ||A||), if jobz != NoVec.
@@ -103,6 +175,8 @@ void test_heevd_work( Params& params, bool run )
                        && (jobz == Job::NoVec || result[ 1 ] < tol)
                        && result[ 2 ] < tol;
     }
+    if (ws_errors > 0)
+        params.okay() = false;
 
     if (params.ref() == 'y' || params.check() == 'y') {
         // ---------- run reference
@@ -0,0 +1,201 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "check_heev.hh"
+#include "lapacke_wrappers.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_heevd_batch_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using lapack::Job;
+
+    // Constants
+    const real_t eps = std::numeric_limits< real_t >::epsilon();
+
+    // get & mark input values
+    lapack::Job jobz = params.jobz();
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t batch = params.batch();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    real_t tol = params.tol() * eps;
+    params.matrix.mark();
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ortho();
+    params.error2();
+    params.error2.name( "Lambda" );
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    int64_t ldz = lda;  // vectors overwrite matrix A
+    int64_t strideA = lda * n;
+    int64_t strideW = n;
+    size_t size_A = (size_t) strideA * batch;
+    size_t size_W = (size_t) strideW * batch;
+
+    std::vector< scalar_t > A( size_A );
+    std::vector< scalar_t > Z( size_A );  // eigenvectors
+    std::vector< real_t > Lambda_tst( size_W );
+    std::vector< real_t > Lambda_ref( size_W );
+    std::vector< int64_t > info_tst( batch );
+
+    for (int64_t i = 0; i < batch; ++i) {
+        lapack::generate_matrix( params.matrix, n, n, &A[ i*strideA ], lda );
+    }
+    Z = A;
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, lda=%5lld, batch=%5lld\n",
+                llong( n ), llong( lda ), llong( batch ) );
+    }
+    if (verbose >= 2) {
+        printf( "A0 = " ); print_matrix( n, n, &A[0], lda );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::heevd_batch( Job(0), uplo,  n, &Z[0], lda, strideA, &Lambda_tst[0], strideW, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::heevd_batch( jobz, lapack::Uplo(0),  n, &Z[0], lda, strideA, &Lambda_tst[0], strideW, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::heevd_batch( jobz, uplo, -1, &Z[0], lda, strideA, &Lambda_tst[0], strideW, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::heevd_batch( jobz, uplo,  n, &Z[0], n-1, strideA, &Lambda_tst[0], strideW, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::heevd_batch( jobz, uplo,  n, &Z[0], lda, strideA, &Lambda_tst[0], strideW,    -1, &info_tst[0] ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    lapack::heevd_batch( jobz, uplo, n, &Z[0], lda, strideA,
+                         &Lambda_tst[0], strideW, batch, &info_tst[0] );
+    time = testsweeper::get_wtime() - time;
+    for (int64_t i = 0; i < batch; ++i) {
+        if (info_tst[ i ] != 0) {
+            fprintf( stderr, "lapack::heevd_batch returned error %lld in matrix %lld\n",
+                     llong( info_tst[ i ] ), llong( i ) );
+        }
+    }
+
+    params.time() = time;
+
+    if (verbose >= 2) {
+        printf( "Z0 = " ); print_matrix( n, n, &Z[0], ldz );
+        printf( "Lambda0 = " ); print_vector( n, &Lambda_tst[0], 1 );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check numerical error
+        // Max over batch of the check_heev results:
+        // result[ 0 ] = || A - Z Lambda Z^H || / (n ||A||), if jobz != NoVec.
+        // result[ 1 ] = || I - Z^H Z || / n, if jobz != NoVec.
+        // result[ 2 ] = 0 if Lambda is in non-decreasing order, else > 0.
+        real_t result[ 3 ] = { 0, 0, 0 };
+        for (int64_t i = 0; i < batch; ++i) {
+            real_t result_i[ 3 ] = { (real_t) testsweeper::no_data_flag,
+                                     (real_t) testsweeper::no_data_flag,
+                                     (real_t) testsweeper::no_data_flag };
+            check_heev( jobz, uplo, n, &A[ i*strideA ], lda,
+                        n, &Lambda_tst[ i*strideW ], &Z[ i*strideA ], ldz,
+                        result_i );
+            for (int k = 0; k < 3; ++k)
+                result[ k ] = blas::max( result[ k ], result_i[ k ] );
+        }
+        if (jobz == Job::NoVec) {
+            result[ 0 ] = result[ 1 ] = (real_t) testsweeper::no_data_flag;
+        }
+
+        // Pointer-array version should give the same results as strided.
+        std::vector< scalar_t > Z2 = A;
+        std::vector< real_t > Lambda2( size_W );
+        std::vector< int64_t > info2( batch );
+        std::vector< scalar_t* > Zarray( batch );
+        std::vector< real_t* > Lambda_array( batch );
+        for (int64_t i = 0; i < batch; ++i) {
+            Zarray[ i ]       = &Z2[ i*strideA ];
+            Lambda_array[ i ] = &Lambda2[ i*strideW ];
+        }
+        lapack::heevd_batch( jobz, uplo, n, &Zarray[0], lda,
+                             &Lambda_array[0], batch, &info2[0] );
+        bool same = (Lambda2 == Lambda_tst && info2 == info_tst
+                     && (jobz == Job::NoVec || Z2 == Z));
+
+        params.error()  = result[ 0 ];
+        params.ortho()  = result[ 1 ];
+        params.error2() = result[ 2 ];
+        params.okay()   = (jobz == Job::NoVec || result[ 0 ] < tol)
+                       && (jobz == Job::NoVec || result[ 1 ] < tol)
+                       && result[ 2 ] < tol
+                       && same;
+    }
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_err = 0;
+        for (int64_t i = 0; i < batch; ++i) {
+            int64_t info_ref = LAPACKE_heevd(
+                to_char( jobz ), to_char( uplo ), n,
+                &A[ i*strideA ], lda, &Lambda_ref[ i*strideW ] );
+            if (info_ref != 0) {
+                fprintf( stderr, "LAPACKE_heevd returned error %lld in matrix %lld\n",
+                         llong( info_ref ), llong( i ) );
+            }
+            if (info_tst[ i ] != info_ref)
+                info_err = 1;
+        }
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+
+        // ---------- check error compared to reference
+        // Small n uses different algorithms than heevd, so eigenvalues
+        // agree to O( eps ), but not bitwise.
+        real_t error = info_err;
+        error += rel_error( Lambda_tst, Lambda_ref );
+        params.error2() = error;
+        params.okay() = params.okay() && (error < tol);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_heevd_batch( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_heevd_batch_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_heevd_batch_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_heevd_batch_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_heevd_batch_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
@@ -0,0 +1,200 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+
+#include <atomic>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Tests HostStream: factors batch matrices with potrf, round-robin over
+// several streams on the default pool, and compares with potrf called
+// synchronously; error is the relative difference. error2 counts
+// ordering violations: tasks that ran out of order on a stream, or
+// before an event they waited on, using a pool with one worker.
+// ref_time is for the synchronous potrf calls.
+template< typename scalar_t >
+void test_host_stream_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t batch = params.batch();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+    params.error2();
+    params.msg();
+
+    if (! run) {
+        params.matrix.kind.set_default( "rand_dominant" );
+        return;
+    }
+
+    // ---------- setup
+    const int64_t nstreams = 4;
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    size_t size_A = (size_t) lda * n;
+
+    std::vector< scalar_t > A_tst( size_A * batch );
+    std::vector< scalar_t > A_ref( size_A * batch );
+    std::vector< scalar_t > A_orig( size_A * batch );
+
+    for (int64_t i = 0; i < batch; ++i) {
+        lapack::generate_matrix( params.matrix, n, n, &A_tst[ i*size_A ], lda );
+    }
+    A_orig = A_tst;
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, lda=%5lld, batch=%5lld, streams=%5lld\n",
+                llong( n ), llong( lda ), llong( batch ), llong( nstreams ) );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::HostPool( 0 ), lapack::Error );
+        assert_throw( lapack::HostPool( 1, 0 ), lapack::Error );
+
+        // Invalid arguments are reported through the future.
+        lapack::HostStream stream;
+        auto info = lapack::potrf( uplo, -1, &A_tst[0], lda, stream );
+        assert_throw( info.get(), lapack::Error );
+    }
+
+    // ---------- run test
+    std::vector< std::future< int64_t > > info_tst( batch );
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    {
+        std::vector< lapack::HostStream > streams( nstreams );
+        for (int64_t i = 0; i < batch; ++i) {
+            info_tst[ i ] = lapack::potrf( uplo, n, &A_tst[ i*size_A ], lda,
+                                           streams[ i % nstreams ] );
+        }
+        for (auto& stream : streams)
+            stream.sync();
+    }
+    time = testsweeper::get_wtime() - time;
+
+    int64_t failed = 0;
+    for (int64_t i = 0; i < batch; ++i) {
+        int64_t info = info_tst[ i ].get();
+        if (info != 0) {
+            ++failed;
+            fprintf( stderr, "lapack::potrf on stream returned error %lld "
+                     "for matrix %lld\n", llong( info ), llong( i ) );
+        }
+    }
+
+    double gflop = batch * lapack::Gflop< scalar_t >::potrf( n );
+    params.time()   = time;
+    params.gflops() = gflop / time;
+    params.msg() = std::to_string( lapack::HostPool::default_pool().num_workers() )
+                 + " workers";
+
+    // ---------- ordering within a stream and across an event
+    int64_t violations = 0;
+    {
+        // One worker, so a stream waiting on an event must not block it.
+        lapack::HostPool pool( 1 );
+        lapack::HostStream s1( pool ), s2( pool );
+        std::atomic< int > step( 0 );
+        std::vector< std::future< bool > > in_order;
+
+        // s2 waits for an event recorded on s1 after its tasks.
+        in_order.push_back( s1.enqueue( [&step]() { return step++ == 0; } ) );
+        in_order.push_back( s1.enqueue( [&step]() { return step++ == 1; } ) );
+        lapack::HostEvent event = s1.record();
+        s2.wait( event );
+        in_order.push_back( s2.enqueue( [&step]() { return step++ == 2; } ) );
+        in_order.push_back( s2.enqueue( [&step]() { return step++ == 3; } ) );
+
+        // Waiting on a completed event must not stall the stream.
+        s2.sync();
+        s1.wait( event );
+        s1.wait( lapack::HostEvent() );
+        in_order.push_back( s1.enqueue( [&step]() { return step++ == 4; } ) );
+        s1.sync();
+
+        for (auto& okay : in_order) {
+            if (! okay.get())
+                ++violations;
+        }
+        if (! event.query())
+            ++violations;
+    }
+    params.error2() = violations;
+    params.okay() = (violations == 0) && (failed == 0);
+
+    if (params.check() == 'y') {
+        // ---------- check error compared to synchronous potrf
+        A_ref = A_orig;
+        for (int64_t i = 0; i < batch; ++i) {
+            int64_t info_ref = lapack::potrf( uplo, n, &A_ref[ i*size_A ], lda );
+            if (info_ref != 0) {
+                fprintf( stderr, "lapack::potrf returned error %lld\n",
+                         llong( info_ref ) );
+            }
+        }
+        real_t error = rel_error( A_tst, A_ref );
+        params.error() = error;
+        params.okay() = params.okay() && (error < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference, synchronously
+        A_ref = A_orig;
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t i = 0; i < batch; ++i) {
+            lapack::potrf( uplo, n, &A_ref[ i*size_A ], lda );
+        }
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time()   = time;
+        params.ref_gflops() = gflop / time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_host_stream( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_host_stream_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_host_stream_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_host_stream_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_host_stream_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
@@ -19,6 +19,7 @@ void test_posv_work( Params& params, bool run )
     using real_t = blas::real_type< scalar_t >;
 
     // get & mark input values
+    blas::Layout layout = params.layout();
     lapack::Uplo uplo = params.uplo();
     int64_t n = params.dim.n();
     int64_t nrhs = params.nrhs();
@@ -39,10 +40,13 @@ void test_posv_work( Params& params, bool run )
     }
 
     // ---------- setup
+    // For row-major, B is stored as the nrhs-by-n column-major B^T.
+    int64_t Bm = (layout == blas::Layout::ColMajor ? n : nrhs);
+    int64_t Bn = (layout == blas::Layout::ColMajor ? nrhs : n);
     int64_t lda = roundup( blas::max( 1, n ), align );
-    int64_t ldb = roundup( blas::max( 1, n ), align );
+    int64_t ldb = roundup( blas::max( 1, Bm ), align );
     size_t size_A = (size_t) lda * n;
-    size_t size_B = (size_t) ldb * nrhs;
+    size_t size_B = (size_t) ldb * Bn;
 
     std::vector< scalar_t > A_tst( size_A );
     std::vector< scalar_t > A_ref( size_A );
@@ -65,7 +69,7 @@ void test_posv_work( Params& params, bool run )
     }
     if (verbose >= 2) {
         printf( "A = " ); print_matrix( n, n, &A_tst[0], lda );
-        printf( "B = " ); print_matrix( n, nrhs, &B_tst[0], ldb );
+        printf( "B = " ); print_matrix( Bm, Bn, &B_tst[0], ldb );
     }
 
     // test error exits
@@ -76,13 +80,15 @@ void test_posv_work( Params& params, bool run )
         assert_throw( lapack::posv( uplo,     n,   -1, &A_tst[0], lda, &B_tst[0], ldb ), lapack::Error );
         assert_throw( lapack::posv( uplo,     n, nrhs, &A_tst[0], n-1, &B_tst[0], ldb ), lapack::Error );
         assert_throw( lapack::posv( uplo,     n, nrhs, &A_tst[0], lda, &B_tst[0], n-1 ), lapack::Error );
+        assert_throw( lapack::posv( blas::Layout(0), uplo, n, nrhs, &A_tst[0], lda, &B_tst[0], ldb ), lapack::Error );
+        assert_throw( lapack::posv( layout, uplo, n, nrhs, &A_tst[0], lda, &B_tst[0], Bm-1 ), lapack::Error );
     }
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::posv(
-        uplo, n, nrhs, &A_tst[0], lda, &B_tst[0], ldb );
+        layout, uplo, n, nrhs, &A_tst[0], lda, &B_tst[0], ldb );
     time = testsweeper::get_wtime() - time;
     if (info_tst != 0) {
         fprintf( stderr, "lapack::posv returned error %lld\n", llong( info_tst ) );
@@ -94,30 +100,40 @@ void test_posv_work( Params& params, bool run )
 
     if (verbose >= 2) {
         printf( "A_factor = " ); print_matrix( n, n, &A_tst[0], lda );
-        printf( "X = " ); print_matrix( n, nrhs, &B_tst[0], ldb );
+        printf( "X = " ); print_matrix( Bm, Bn, &B_tst[0], ldb );
     }
 
     if (params.check() == 'y') {
         // ---------- check error
         // Relative backwards error = ||b - Ax|| / (n * ||A|| * ||x||).
-        blas::hemm( blas::Layout::ColMajor, blas::Side::Left, uplo,
+        blas::hemm( layout, blas::Side::Left, uplo,
                     n, nrhs,
                     -1.0, &A_ref[0], lda,
                           &B_tst[0], ldb,
                      1.0, &B_ref[0], ldb );
         if (verbose >= 2) {
-            printf( "R = " ); print_matrix( n, nrhs, &B_ref[0], ldb );
+            printf( "R = " ); print_matrix( Bm, Bn, &B_ref[0], ldb );
         }
 
-        real_t error = lapack::lange( lapack::Norm::One, n, nrhs, &B_ref[0], ldb );
-        real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, &B_tst[0], ldb );
-        real_t Anorm = lapack::lanhe( lapack::Norm::One, uplo, n, &A_ref[0], lda );
+        // The one norm of a row-major matrix is the inf norm of its storage,
+        // and a row-major triangle is the opposite column-major triangle.
+        lapack::Norm norm = lapack::Norm::One;
+        lapack::Uplo uplo_A = uplo;
+        if (layout == blas::Layout::RowMajor) {
+            norm = lapack::Norm::Inf;
+            uplo_A = (uplo == lapack::Uplo::Upper ? lapack::Uplo::Lower
+                                                  : lapack::Uplo::Upper);
+        }
+        real_t error = lapack::lange( norm, Bm, Bn, &B_ref[0], ldb );
+        real_t Xnorm = lapack::lange( norm, Bm, Bn, &B_tst[0], ldb );
+        real_t Anorm = lapack::lanhe( norm, uplo_A, n, &A_ref[0], lda );
         error /= (n * Anorm * Xnorm);
         params.error() = error;
         params.okay() = (error < tol);
     }
 
-    if (params.ref() == 'y') {
+    // The LAPACKE reference is column-major only.
+    if (params.ref() == 'y' && layout == blas::Layout::ColMajor) {
         // ---------- run reference
         testsweeper::flush_cache( params.cache() );
         time = testsweeper::get_wtime();
@@ -0,0 +1,204 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "lapacke_wrappers.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_posv_batch_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // Constants
+    const scalar_t one = 1.0;
+    const real_t   eps = std::numeric_limits< real_t >::epsilon();
+
+    // get & mark input values
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t batch = params.batch();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    real_t tol = params.tol() * eps;
+    params.matrix.mark();
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    int64_t ldb = roundup( blas::max( 1, n ), align );
+    int64_t strideA = lda * n;
+    int64_t strideB = ldb * nrhs;
+    size_t size_A = (size_t) strideA * batch;
+    size_t size_B = (size_t) strideB * batch;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< scalar_t > B_tst( size_B );
+    std::vector< scalar_t > B_ref( size_B );
+    std::vector< int64_t > info_tst( batch );
+
+    for (int64_t i = 0; i < batch; ++i) {
+        lapack::generate_matrix( params.matrix, n, n, &A_tst[ i*strideA ], lda );
+    }
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B_tst.size(), &B_tst[0] );
+    A_ref = A_tst;
+    B_ref = B_tst;
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, lda=%5lld, batch=%5lld\n"
+                "B n=%5lld, nrhs=%5lld, ldb=%5lld\n",
+                llong( n ), llong( lda ), llong( batch ),
+                llong( n ), llong( nrhs ), llong( ldb ) );
+    }
+    if (verbose >= 2) {
+        printf( "A0 = " );
+        print_matrix( n, n, &A_tst[0], lda );
+        printf( "B0 = " );
+        print_matrix( n, nrhs, &B_tst[0], ldb );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        using lapack::Uplo;
+        assert_throw( lapack::posv_batch( Uplo(0),  n, nrhs, &A_tst[0], lda, strideA, &B_tst[0], ldb, strideB, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::posv_batch( uplo,    -1, nrhs, &A_tst[0], lda, strideA, &B_tst[0], ldb, strideB, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::posv_batch( uplo,     n,   -1, &A_tst[0], lda, strideA, &B_tst[0], ldb, strideB, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::posv_batch( uplo,     n, nrhs, &A_tst[0], n-1, strideA, &B_tst[0], ldb, strideB, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::posv_batch( uplo,     n, nrhs, &A_tst[0], lda, strideA, &B_tst[0], n-1, strideB, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::posv_batch( uplo,     n, nrhs, &A_tst[0], lda, strideA, &B_tst[0], ldb, strideB,    -1, &info_tst[0] ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    lapack::posv_batch( uplo, n, nrhs, &A_tst[0], lda, strideA,
+                        &B_tst[0], ldb, strideB, batch, &info_tst[0] );
+    time = testsweeper::get_wtime() - time;
+    for (int64_t i = 0; i < batch; ++i) {
+        if (info_tst[ i ] != 0) {
+            fprintf( stderr, "lapack::posv_batch returned error %lld in matrix %lld\n",
+                     llong( info_tst[ i ] ), llong( i ) );
+        }
+    }
+
+    params.time() = time;
+    double gflop = batch * lapack::Gflop< scalar_t >::posv( n, nrhs );
+    params.gflops() = gflop / time;
+
+    if (verbose >= 2) {
+        printf( "A0_factor = " );
+        print_matrix( n, n, &A_tst[0], lda );
+        printf( "X0 = " );
+        print_matrix( n, nrhs, &B_tst[0], ldb );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Max over batch of relative backwards error
+        //     ||b - Ax|| / (n * ||A|| * ||x||).
+        real_t error = 0;
+        for (int64_t i = 0; i < batch; ++i) {
+            scalar_t* Ai = &A_ref[ i*strideA ];
+            scalar_t* Bi = &B_ref[ i*strideB ];
+            scalar_t* Xi = &B_tst[ i*strideB ];
+            blas::hemm( blas::Layout::ColMajor, blas::Side::Left, uplo,
+                        n, nrhs,
+                        -one, Ai, lda,
+                              Xi, ldb,
+                        one,  Bi, ldb );
+
+            real_t error_i = lapack::lange( lapack::Norm::One, n, nrhs, Bi, ldb );
+            real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, Xi, ldb );
+            real_t Anorm = lapack::lanhe( lapack::Norm::One, uplo, n, Ai, lda );
+            error_i /= (n * Anorm * Xnorm);
+            error = blas::max( error, error_i );
+        }
+
+        // Pointer-array version should give the same results as strided.
+        std::vector< scalar_t > A2 = A_ref;
+        std::vector< scalar_t > B2( B_ref.size() );
+        std::vector< int64_t > info2( batch );
+        std::vector< scalar_t* > Aarray( batch ), Barray( batch );
+        for (int64_t i = 0; i < batch; ++i) {
+            Aarray[ i ] = &A2[ i*strideA ];
+            Barray[ i ] = &B2[ i*strideB ];
+        }
+        int64_t iseed2[4] = { 0, 1, 2, 3 };
+        lapack::larnv( idist, iseed2, B2.size(), &B2[0] );
+        lapack::posv_batch( uplo, n, nrhs, &Aarray[0], lda,
+                            &Barray[0], ldb, batch, &info2[0] );
+        bool same = (B2 == B_tst && info2 == info_tst);
+
+        params.error() = error;
+        params.okay() = (error < tol && same);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        // Reset B in case check cleared it.
+        int64_t iseed2[4] = { 0, 1, 2, 3 };
+        lapack::larnv( idist, iseed2, B_ref.size(), &B_ref[0] );
+
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t i = 0; i < batch; ++i) {
+            int64_t info_ref = LAPACKE_posv(
+                to_char( uplo ), n, nrhs, &A_ref[ i*strideA ], lda,
+                &B_ref[ i*strideB ], ldb );
+            if (info_ref != 0) {
+                fprintf( stderr, "LAPACKE_posv returned error %lld in matrix %lld\n",
+                         llong( info_ref ), llong( i ) );
+            }
+        }
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_posv_batch( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_posv_batch_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_posv_batch_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_posv_batch_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_posv_batch_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
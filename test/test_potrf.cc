@@ -21,9 +21,12 @@ void test_potrf_work( Params& params, bool run )
     // get & mark input values
     lapack::Uplo uplo = params.uplo();
     int64_t n = params.dim.n();
+    lapack::MethodCholesky method = params.method_chol();
     int64_t align = params.align();
     int64_t verbose = params.verbose();
     params.matrix.mark();
+    if (method == lapack::MethodCholesky::Tiled)
+        params.nb();
 
     real_t eps = std::numeric_limits< real_t >::epsilon();
     real_t tol = params.tol() * eps;
@@ -63,13 +66,29 @@ void test_potrf_work( Params& params, bool run )
         assert_throw( lapack::potrf( Uplo(0),  n, &A_tst[0], lda ), lapack::Error );
         assert_throw( lapack::potrf( uplo,    -1, &A_tst[0], lda ), lapack::Error );
         assert_throw( lapack::potrf( uplo,     n, &A_tst[0], n-1 ), lapack::Error );
+
+        assert_throw( lapack::potrf_tiled( Uplo(0),  n, &A_tst[0], lda ), lapack::Error );
+        assert_throw( lapack::potrf_tiled( uplo,    -1, &A_tst[0], lda ), lapack::Error );
+        assert_throw( lapack::potrf_tiled( uplo,     n, &A_tst[0], n-1 ), lapack::Error );
+        assert_throw( lapack::potrf_tiled( uplo,     n, &A_tst[0], lda, 0 ), lapack::Error );
     }
 
     // ---------- run test
+    // Select method via potrf_set_method, so dispatch in potrf is tested.
+    // With --ref y, ref_time is the LAPACK library potrf, for comparison.
+    // Restore the caller's method only if it was changed here.
+    lapack::MethodCholesky save_method = lapack::potrf_method();
+    bool set_method = (method == lapack::MethodCholesky::Tiled);
+    if (set_method) {
+        lapack::potrf_set_method( method, params.nb() );
+    }
     testsweeper::flush_cache( params.cache() );
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::potrf( uplo, n, &A_tst[0], lda );
     time = testsweeper::get_wtime() - time;
+    if (set_method) {
+        lapack::potrf_set_method( save_method );
+    }
     if (info_tst != 0) {
         fprintf( stderr, "lapack::potrf returned error %lld\n", llong( info_tst ) );
     }
@@ -0,0 +1,189 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "lapacke_wrappers.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Returns || L - L_ref ||_1 / || L_ref ||_1 over the uplo triangle.
+template< typename scalar_t >
+blas::real_type< scalar_t > factor_error(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t const* L, scalar_t const* L_ref, int64_t lda )
+{
+    std::vector< scalar_t > D( L, L + lda * n );
+    blas::axpy( D.size(), -1.0, L_ref, 1, &D[0], 1 );
+    auto Dnorm = lapack::lantr( lapack::Norm::One, uplo, lapack::Diag::NonUnit,
+                                n, n, &D[0], lda );
+    auto Lnorm = lapack::lantr( lapack::Norm::One, uplo, lapack::Diag::NonUnit,
+                                n, n, L_ref, lda );
+    return (Lnorm == 0 ? Dnorm : Dnorm / Lnorm);
+}
+
+// -----------------------------------------------------------------------------
+// Tests potrf_update and potrf_downdate, with rank k = nrhs.
+// error is the update compared with potrf( A + X X^H );
+// error2 is the downdate of that compared with potrf( A ).
+template< typename scalar_t >
+void test_potrf_update_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t k = params.nrhs();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.error2();
+
+    if (! run) {
+        params.matrix.kind.set_default( "rand_dominant" );
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    int64_t ldx = roundup( blas::max( 1, n ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_X = (size_t) ldx * k;
+
+    std::vector< scalar_t > A( size_A );
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< scalar_t > X( size_X );
+
+    lapack::generate_matrix( params.matrix, n, n, &A[0], lda );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, X.size(), &X[0] );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, lda=%5lld\n"
+                "X n=%5lld, k=%5lld, ldx=%5lld\n",
+                llong( n ), llong( lda ),
+                llong( n ), llong( k ), llong( ldx ) );
+    }
+    if (verbose >= 2) {
+        printf( "A = " ); print_matrix( n, n, &A[0], lda );
+        printf( "X = " ); print_matrix( n, k, &X[0], ldx );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        using lapack::Uplo;
+        assert_throw( lapack::potrf_update( Uplo(0),  n,  k, &A_tst[0], lda, &X[0], ldx ), lapack::Error );
+        assert_throw( lapack::potrf_update( uplo,    -1,  k, &A_tst[0], lda, &X[0], ldx ), lapack::Error );
+        assert_throw( lapack::potrf_update( uplo,     n, -1, &A_tst[0], lda, &X[0], ldx ), lapack::Error );
+        assert_throw( lapack::potrf_update( uplo,     n,  k, &A_tst[0], n-1, &X[0], ldx ), lapack::Error );
+        assert_throw( lapack::potrf_update( uplo,     n,  k, &A_tst[0], lda, &X[0], n-1 ), lapack::Error );
+
+        assert_throw( lapack::potrf_downdate( Uplo(0),  n,  k, &A_tst[0], lda, &X[0], ldx ), lapack::Error );
+        assert_throw( lapack::potrf_downdate( uplo,    -1,  k, &A_tst[0], lda, &X[0], ldx ), lapack::Error );
+        assert_throw( lapack::potrf_downdate( uplo,     n, -1, &A_tst[0], lda, &X[0], ldx ), lapack::Error );
+        assert_throw( lapack::potrf_downdate( uplo,     n,  k, &A_tst[0], n-1, &X[0], ldx ), lapack::Error );
+        assert_throw( lapack::potrf_downdate( uplo,     n,  k, &A_tst[0], lda, &X[0], n-1 ), lapack::Error );
+    }
+
+    A_tst = A;
+    int64_t info = lapack::potrf( uplo, n, &A_tst[0], lda );
+    if (info != 0) {
+        fprintf( stderr, "lapack::potrf returned error %lld\n", llong( info ) );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    int64_t info_tst = lapack::potrf_update( uplo, n, k, &A_tst[0], lda, &X[0], ldx );
+    time = testsweeper::get_wtime() - time;
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::potrf_update returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+
+    if (verbose >= 2) {
+        printf( "A_update = " ); print_matrix( n, n, &A_tst[0], lda );
+    }
+
+    // A_ref = A + X X^H, in the uplo triangle.
+    A_ref = A;
+    blas::herk( blas::Layout::ColMajor, uplo, blas::Op::NoTrans, n, k,
+                1.0, &X[0], ldx, 1.0, &A_ref[0], lda );
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // ---------- run reference, refactoring from scratch
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = LAPACKE_potrf( to_char( uplo ), n, &A_ref[0], lda );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "LAPACKE_potrf returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // The update keeps a real, positive diagonal, so it should
+        // match potrf of the updated matrix.
+        real_t error = factor_error( uplo, n, &A_tst[0], &A_ref[0], lda );
+
+        // Downdating the updated factor should recover potrf( A ).
+        info_tst = lapack::potrf_downdate( uplo, n, k, &A_tst[0], lda, &X[0], ldx );
+        if (info_tst != 0) {
+            fprintf( stderr, "lapack::potrf_downdate returned error %lld\n",
+                     llong( info_tst ) );
+        }
+        A_ref = A;
+        lapack::potrf( uplo, n, &A_ref[0], lda );
+        real_t error2 = factor_error( uplo, n, &A_tst[0], &A_ref[0], lda );
+
+        params.error() = error;
+        params.error2() = error2;
+        params.okay() = (error < tol) && (error2 < tol) && (info_tst == 0);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_potrf_update( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_potrf_update_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_potrf_update_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_potrf_update_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_potrf_update_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
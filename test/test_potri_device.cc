@@ -0,0 +1,215 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/device.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "lapacke_wrappers.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_potri_device_work( Params& params, bool run )
+{
+    using blas::conj;
+    using lapack::device_info_int;
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t device = params.device();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+
+    if (! run) {
+        params.matrix.kind.set_default( "rand_dominant" );
+        return;
+    }
+
+    // The host backend runs without GPU devices.
+    #if ! defined( LAPACK_HAVE_HOST_QUEUE )
+        if (blas::get_device_count() == 0) {
+            params.msg() = "skipping: no GPU devices or no GPU support";
+            return;
+        }
+    #endif
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    size_t size_A = (size_t) lda * n;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+
+    lapack::generate_matrix( params.matrix, n, n, &A_tst[0], lda );
+    A_ref = A_tst;
+
+    // Allocate and copy to GPU.
+    lapack::Queue queue( device );
+    scalar_t*        dA     = lapack::device_malloc< scalar_t >( size_A, queue );
+    device_info_int* d_info = lapack::device_malloc< device_info_int >( 1, queue );
+    lapack::device_copy_matrix( n, n, A_tst.data(), lda, dA, lda, queue );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, lda=%5lld\n",
+                llong( n ), llong( lda ) );
+    }
+    if (verbose >= 2) {
+        printf( "A = " ); print_matrix( n, n, &A_tst[0], lda );
+    }
+
+    // Allocate workspace
+    size_t d_size, h_size;
+    lapack::potri_work_size_bytes( uplo, n, dA, lda, &d_size, &h_size, queue );
+    char* d_work = lapack::device_malloc< char >( d_size, queue );
+    std::vector<char> h_work_vector( h_size );
+    char* h_work = h_work_vector.data();
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::potri( lapack::Uplo(0), n, dA, lda, d_work, d_size, h_work, h_size, d_info, queue ), lapack::Error );
+        assert_throw( lapack::potri( uplo, -1, dA, lda, d_work, d_size, h_work, h_size, d_info, queue ), lapack::Error );
+        assert_throw( lapack::potri( uplo,  n, dA, n-1, d_work, d_size, h_work, h_size, d_info, queue ), lapack::Error );
+    }
+
+    // Factor on the same queue; it isn't timed.
+    device_info_int info_trf;
+    lapack::potrf( uplo, n, dA, lda, d_info, queue );
+    lapack::device_memcpy( &info_trf, d_info, 1, queue );
+    queue.sync();
+    if (info_trf != 0) {
+        fprintf( stderr, "lapack::potrf returned error %lld\n", llong( info_trf ) );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    queue.sync();
+    double time = testsweeper::get_wtime();
+
+    lapack::potri( uplo, n, dA, lda,
+                   d_work, d_size, h_work, h_size, d_info, queue );
+
+    queue.sync();
+    time = testsweeper::get_wtime() - time;
+
+    params.time() = time;
+    double gflop = lapack::Gflop< scalar_t >::potri( n );
+    params.gflops() = gflop / time;
+
+    // Copy result back to CPU.
+    device_info_int info_tst;
+    lapack::device_copy_matrix( n, n, dA, lda, A_tst.data(), lda, queue );
+    lapack::device_memcpy( &info_tst, d_info, 1, queue );
+    queue.sync();
+
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::potri returned error %lld\n", llong( info_tst ) );
+    }
+
+    // Cleanup GPU memory.
+    lapack::device_free( dA, queue );
+    lapack::device_free( d_info, queue );
+    lapack::device_free( d_work, queue );
+
+    if (verbose >= 2) {
+        printf( "Ainv = " ); print_matrix( n, n, &A_tst[0], lda );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // symmetrize A^{-1}, in order to use hemm
+        if (uplo == blas::Uplo::Lower) {
+            for (int64_t j = 0; j < n; ++j)
+                for (int64_t i = 0; i < j; ++i)
+                    A_tst[ i + j*lda ] = conj( A_tst[ j + i*lda ] );
+        }
+        else {
+            for (int64_t j = 0; j < n; ++j)
+                for (int64_t i = 0; i < j; ++i)
+                    A_tst[ j + i*lda ] = conj( A_tst[ i + j*lda ] );
+        }
+
+        // R = I - A A^{-1}, A is Hermitian, A^{-1} is treated as general
+        std::vector< scalar_t > R( size_A );
+        lapack::laset( lapack::MatrixType::General, n, n, 0.0, 1.0, &R[0], lda );
+        blas::hemm( blas::Layout::ColMajor, blas::Side::Left, uplo, n, n,
+                    -1.0, &A_ref[0], lda,
+                          &A_tst[0], lda,
+                     1.0, &R[0], lda );
+        if (verbose >= 2) {
+            printf( "R = " ); print_matrix( n, n, &R[0], lda );
+        }
+
+        // error = ||I - A A^{-1}|| / (n ||A|| ||A^{-1}||)
+        real_t Rnorm     = lapack::lange( lapack::Norm::Fro, n, n, &R[0], lda );
+        real_t Anorm     = lapack::lanhe( lapack::Norm::Fro, uplo, n, &A_ref[0], lda );
+        real_t Ainv_norm = lapack::lanhe( lapack::Norm::Fro, uplo, n, &A_tst[0], lda );
+        real_t error = 0;
+        if (n > 0)
+            error = Rnorm / (n * Anorm * Ainv_norm);
+        params.error() = error;
+        params.okay() = (error < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        int64_t info_ref = LAPACKE_potrf( to_char( uplo ), n, &A_ref[0], lda );
+        if (info_ref != 0) {
+            fprintf( stderr, "LAPACKE_potrf returned error %lld\n", llong( info_ref ) );
+        }
+
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        info_ref = LAPACKE_potri( to_char( uplo ), n, &A_ref[0], lda );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "LAPACKE_potri returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_potri_device( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_potri_device_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_potri_device_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_potri_device_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_potri_device_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
@@ -0,0 +1,238 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#ifdef _OPENMP
+    #include <omp.h>
+#endif
+
+// -----------------------------------------------------------------------------
+// Tests set_num_threads and ThreadScope. error counts thread counts that
+// differ from those expected: inside nested scopes, after they are
+// destroyed, inside a scope after an overlapping scope on another thread
+// ends, and inside and after scopes created concurrently by OpenMP
+// threads, each of which solves its own n-by-n system with gesv.
+// error2 is the max backward error of those solves.
+template< typename scalar_t >
+void test_threads_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // Constants
+    const scalar_t one = 1.0;
+    const real_t   eps = std::numeric_limits< real_t >::epsilon();
+
+    // get & mark input values
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    real_t tol = params.tol() * eps;
+    params.matrix.mark();
+
+    // mark non-standard output values
+    params.error2();
+    params.msg();
+
+    if (! run)
+        return;
+
+    // With no thread control, the count is always 1.
+    bool none = std::string( lapack::thread_library() ) == "none";
+    auto expect = [none]( int num_threads ) {
+        return none ? 1 : num_threads;
+    };
+
+    int64_t mismatches = 0;
+    auto check = [&]( int num_threads, char const* where ) {
+        int actual = lapack::get_num_threads();
+        if (actual != expect( num_threads )) {
+            ++mismatches;
+            if (verbose >= 1) {
+                printf( "%s: get_num_threads %d, expected %d\n",
+                        where, actual, expect( num_threads ) );
+            }
+        }
+    };
+
+    int num_threads = lapack::get_num_threads();
+    params.msg() = std::string( lapack::thread_library() )
+                 + " threads " + std::to_string( num_threads );
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::set_num_threads( 0 ), lapack::Error );
+        assert_throw( lapack::ThreadScope( 0 ), lapack::Error );
+    }
+
+    // ---------- nested scopes and set_num_threads
+    {
+        lapack::ThreadScope scope;
+        check( 1, "scope" );
+        {
+            lapack::ThreadScope scope2( 2 );
+            check( 2, "nested scope" );
+        }
+        check( 1, "after nested scope" );
+    }
+    check( num_threads, "after scope" );
+
+    lapack::set_num_threads( num_threads + 1 );
+    check( num_threads + 1, "set_num_threads" );
+    lapack::set_num_threads( num_threads );
+    check( num_threads, "set_num_threads restore" );
+
+    // ---------- overlapping scopes on two threads, ending out of order:
+    // after scope 1 ends, scope 2 must keep its count.
+    {
+        int k = num_threads + 1;
+        std::atomic< int > step( 0 );
+        auto wait_for = [&step]( int s ) {
+            while (step < s)
+                std::this_thread::yield();
+        };
+        int inside2 = 0;
+        std::thread t1( [&]() {
+            lapack::ThreadScope scope( k );
+            step = 1;
+            wait_for( 2 );
+        } );
+        std::thread t2( [&]() {
+            wait_for( 1 );
+            lapack::ThreadScope scope( k );
+            step = 2;
+            t1.join();
+            inside2 = lapack::get_num_threads();
+        } );
+        t2.join();
+        if (inside2 != expect( k )) {
+            ++mismatches;
+            if (verbose >= 1)
+                printf( "overlapping scope: get_num_threads %d, expected %d\n",
+                        inside2, expect( k ) );
+        }
+    }
+    check( num_threads, "after overlapping scopes" );
+
+    // ---------- concurrent scopes, each solving its own system
+    int nsystems = 1;
+    #ifdef _OPENMP
+        nsystems = omp_get_max_threads();
+    #endif
+
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    int64_t ldb = roundup( blas::max( 1, n ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_B = (size_t) ldb * nrhs;
+
+    std::vector< scalar_t > A_tst( size_A * nsystems );
+    std::vector< scalar_t > A_ref( size_A * nsystems );
+    std::vector< scalar_t > B_tst( size_B * nsystems );
+    std::vector< scalar_t > B_ref( size_B * nsystems );
+    std::vector< int64_t > ipiv( n * nsystems );
+    std::vector< int64_t > info( nsystems );
+
+    for (int i = 0; i < nsystems; ++i) {
+        lapack::generate_matrix( params.matrix, n, n, &A_tst[ i*size_A ], lda );
+    }
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B_tst.size(), &B_tst[0] );
+    A_ref = A_tst;
+    B_ref = B_tst;
+
+    std::vector< int > inside( nsystems, 0 );
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    #pragma omp parallel for schedule( static, 1 ) num_threads( nsystems )
+    for (int i = 0; i < nsystems; ++i) {
+        lapack::ThreadScope scope;
+        inside[ i ] = lapack::get_num_threads();
+        info[ i ] = lapack::gesv( n, nrhs, &A_tst[ i*size_A ], lda,
+                                  &ipiv[ i*n ], &B_tst[ i*size_B ], ldb );
+    }
+    time = testsweeper::get_wtime() - time;
+    params.time() = time;
+
+    for (int i = 0; i < nsystems; ++i) {
+        if (inside[ i ] != 1) {
+            ++mismatches;
+            if (verbose >= 1)
+                printf( "concurrent scope %d: get_num_threads %d, expected 1\n",
+                        i, inside[ i ] );
+        }
+        if (info[ i ] != 0) {
+            fprintf( stderr, "lapack::gesv returned error %lld\n",
+                     llong( info[ i ] ) );
+        }
+    }
+    check( num_threads, "after concurrent scopes" );
+
+    if (verbose >= 1) {
+        printf( "\n%s, %d threads, %d systems\n",
+                lapack::thread_library(), num_threads, nsystems );
+    }
+
+    params.error() = mismatches;
+    params.okay() = (mismatches == 0);
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Relative backwards error = ||b - Ax|| / (n * ||A|| * ||x||).
+        real_t error2 = 0;
+        for (int i = 0; i < nsystems; ++i) {
+            scalar_t* A = &A_ref[ i*size_A ];
+            scalar_t* X = &B_tst[ i*size_B ];
+            scalar_t* R = &B_ref[ i*size_B ];
+            blas::gemm( blas::Layout::ColMajor, blas::Op::NoTrans, blas::Op::NoTrans,
+                        n, nrhs, n,
+                        -one, A, lda,
+                              X, ldb,
+                        one,  R, ldb );
+            real_t error = lapack::lange( lapack::Norm::One, n, nrhs, R, ldb );
+            real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, X, ldb );
+            real_t Anorm = lapack::lange( lapack::Norm::One, n, n, A, lda );
+            if (error != 0)
+                error /= (n * Anorm * Xnorm);
+            error2 = blas::max( error2, error );
+        }
+        params.error2() = error2;
+        params.okay() = params.okay() && (error2 < tol);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_threads( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_threads_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_threads_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_threads_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_threads_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
@@ -0,0 +1,250 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+
+#include <atomic>
+#include <cstring>
+#include <set>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Tests lapack::trace: factors A with potrf and getrf, and checks their
+// events: routine, precision, dimensions, info, flop count, thread, and
+// that the callback saw them. Also checks disabling, ring buffer
+// overwrite, events from several threads, collecting events while a
+// thread records them, and the Chrome JSON output.
+// error2 counts violations. time is with tracing; ref_time is the same
+// calls with tracing disabled.
+template< typename scalar_t >
+void test_trace_work( Params& params, bool run )
+{
+    namespace trace = lapack::trace;
+
+    // get & mark input values
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    // mark non-standard output values
+    params.ref_time();
+    params.error2();
+    params.msg();
+
+    if (! run) {
+        params.matrix.kind.set_default( "rand_dominant" );
+        return;
+    }
+
+    if (! trace::compiled()) {
+        params.error2() = trace::enabled() || ! trace::events().empty();
+        params.okay() = (params.error2() == 0);
+        params.msg() = "skipping: LAPACK++ compiled without LAPACK_TRACE";
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    size_t size_A = (size_t) lda * n;
+
+    std::vector< scalar_t > A_orig( size_A );
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< int64_t > ipiv( n );
+    lapack::generate_matrix( params.matrix, n, n, &A_orig[0], lda );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, lda=%5lld\n",
+                llong( n ), llong( lda ) );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( trace::set_buffer_size( 0 ), lapack::Error );
+    }
+
+    char precision = trace::precision< scalar_t >();
+    int64_t violations = 0;
+    std::atomic< int64_t > num_callbacks( 0 );
+    trace::set_enabled( true );
+    trace::set_callback( [&num_callbacks]( trace::Event const& ) {
+        ++num_callbacks;
+    } );
+    trace::clear();
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    A_tst = A_orig;
+    int64_t info_potrf = lapack::potrf( uplo, n, &A_tst[0], lda );
+    A_tst = A_orig;
+    int64_t info_getrf = lapack::getrf( n, n, &A_tst[0], lda, &ipiv[0] );
+    time = testsweeper::get_wtime() - time;
+    params.time() = time;
+
+    trace::set_callback( nullptr );
+    std::vector< trace::Event > events = trace::events();
+    if (verbose >= 2) {
+        for (auto const& e : events) {
+            printf( "%c%-8s m %5lld, n %5lld, k %5lld, nrhs %5lld, info %lld, "
+                    "time %.2e, gflop %.2e, thread %d\n",
+                    e.precision, e.routine, llong( e.m ), llong( e.n ),
+                    llong( e.k ), llong( e.nrhs ), llong( e.info ),
+                    e.time, e.gflop, e.thread );
+        }
+    }
+
+    // Expect exactly the potrf and getrf events, in order.
+    if (events.size() != 2 || num_callbacks != 2) {
+        ++violations;
+    }
+    else {
+        auto const& e0 = events[ 0 ];
+        auto const& e1 = events[ 1 ];
+        if (strcmp( e0.routine, "potrf" ) != 0 || e0.precision != precision
+            || e0.n != n || e0.info != info_potrf || e0.time < 0
+            || e0.gflop != lapack::Gflop< scalar_t >::potrf( n ))
+            ++violations;
+        if (strcmp( e1.routine, "getrf" ) != 0 || e1.precision != precision
+            || e1.m != n || e1.n != n || e1.info != info_getrf
+            || e1.start < e0.start
+            || e1.gflop != lapack::Gflop< scalar_t >::getrf( n, n ))
+            ++violations;
+    }
+
+    // Disabled, nothing is recorded.
+    trace::set_enabled( false );
+    A_tst = A_orig;
+    lapack::potrf( uplo, n, &A_tst[0], lda );
+    trace::set_enabled( true );
+    if (trace::events().size() != events.size())
+        ++violations;
+
+    // Chrome trace JSON names events with the precision.
+    std::ostringstream json;
+    trace::write_chrome_json( json );
+    std::string name = std::string( "\"name\": \"" ) + precision + "potrf\"";
+    if (json.str().compare( 0, 15, "{\"traceEvents\":" ) != 0
+        || json.str().find( name ) == std::string::npos)
+        ++violations;
+
+    // A small ring buffer keeps only the latest events.
+    int64_t save_size = trace::buffer_size();
+    trace::set_buffer_size( 3 );
+    trace::clear();
+    for (int i = 0; i < 5; ++i) {
+        A_tst = A_orig;
+        lapack::potrf( uplo, n, &A_tst[0], lda );
+    }
+    if (trace::events().size() != 3)
+        ++violations;
+    trace::set_buffer_size( save_size );
+
+    // Each thread records to its own buffer.
+    trace::clear();
+    {
+        std::vector< scalar_t > A1 = A_orig, A2 = A_orig;
+        std::thread t1( [&]() { lapack::potrf( uplo, n, &A1[0], lda ); } );
+        std::thread t2( [&]() { lapack::potrf( uplo, n, &A2[0], lda ); } );
+        t1.join();
+        t2.join();
+    }
+    events = trace::events();
+    std::set< int > threads;
+    for (auto const& e : events)
+        threads.insert( e.thread );
+    if (events.size() != 2 || threads.size() != 2)
+        ++violations;
+
+    // Collecting while another thread overwrites a small ring buffer
+    // must not return partly written events. Each getrf has m == n,
+    // and gflop consistent with them.
+    {
+        int64_t idist = 1;
+        int64_t iseed[4] = { 0, 1, 2, 3 };
+        std::vector< scalar_t > A0( 16*16 );
+        lapack::larnv( idist, iseed, A0.size(), &A0[0] );
+
+        trace::set_buffer_size( 4 );
+        trace::clear();
+        std::atomic< bool > done( false );
+        std::thread writer( [&]() {
+            std::vector< scalar_t > A1( 16*16 );
+            std::vector< int64_t > ipiv1( 16 );
+            for (int i = 0; i < 2000; ++i) {
+                int64_t ni = 1 + i % 16;
+                A1 = A0;
+                lapack::getrf( ni, ni, &A1[0], ni, &ipiv1[0] );
+            }
+            done = true;
+        } );
+        int64_t torn = 0;
+        while (! done) {
+            for (auto const& e : trace::events()) {
+                if (e.routine == nullptr || strcmp( e.routine, "getrf" ) != 0
+                    || e.m != e.n || e.m < 1 || e.m > 16
+                    || e.gflop != lapack::Gflop< scalar_t >::getrf( e.m, e.n ))
+                    ++torn;
+            }
+        }
+        writer.join();
+        if (torn != 0 || trace::events().size() != 4)
+            ++violations;
+    }
+    trace::set_buffer_size( save_size );
+    trace::clear();
+
+    params.error2() = violations;
+    params.okay() = (violations == 0);
+
+    if (params.ref() == 'y') {
+        // ---------- run reference, without tracing
+        trace::set_enabled( false );
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        A_tst = A_orig;
+        lapack::potrf( uplo, n, &A_tst[0], lda );
+        A_tst = A_orig;
+        lapack::getrf( n, n, &A_tst[0], lda, &ipiv[0] );
+        time = testsweeper::get_wtime() - time;
+        trace::set_enabled( true );
+
+        params.ref_time() = time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_trace( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_trace_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_trace_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_trace_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_trace_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
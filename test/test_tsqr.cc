@@ -0,0 +1,230 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "lapacke_wrappers.hh"
+
+#include <vector>
+
+#if LAPACK_VERSION >= 30400  // >= 3.4.0
+
+// -----------------------------------------------------------------------------
+// Tests tsqr, and tsmqr to generate Q and apply Q^H and Q from the right.
+template< typename scalar_t >
+void test_tsqr_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using lapack::Side, lapack::Op;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t mb = params.nb();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+    params.ortho();
+    params.error2();
+    params.error3();
+    params.msg();
+
+    if (! run)
+        return;
+
+    // skip invalid sizes
+    if (m < n || mb < blas::max( 1, n )) {
+        params.msg() = "skipping: requires m >= n and nb >= max( 1, n )";
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    size_t size_A = (size_t) lda * n;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< scalar_t > tau_ref( n );
+
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, A_tst.size(), &A_tst[0] );
+    A_ref = A_tst;
+
+    // query for T size
+    scalar_t qry_T;
+    int64_t info_tst = lapack::tsqr( m, n, mb, &A_tst[0], lda, &qry_T, -1 );
+    int64_t tsize = std::real( qry_T );
+    std::vector< scalar_t > T_tst( tsize );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A m=%5lld, n=%5lld, lda=%5lld, mb=%5lld, tsize=%5lld\n",
+                llong( m ), llong( n ), llong( lda ), llong( mb ), llong( tsize ) );
+    }
+    if (verbose >= 2) {
+        printf( "A = " ); print_matrix( m, n, &A_tst[0], lda );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::tsqr( -1,  n, mb, &A_tst[0], lda, &T_tst[0], tsize ), lapack::Error );
+        assert_throw( lapack::tsqr(  m, m+1, mb, &A_tst[0], lda, &T_tst[0], tsize ), lapack::Error );
+        assert_throw( lapack::tsqr(  m,  n,  0, &A_tst[0], lda, &T_tst[0], tsize ), lapack::Error );
+        assert_throw( lapack::tsqr(  m,  n, mb, &A_tst[0], m-1, &T_tst[0], tsize ), lapack::Error );
+        assert_throw( lapack::tsqr(  m,  n, mb, &A_tst[0], lda, &T_tst[0], 0 ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    info_tst = lapack::tsqr( m, n, mb, &A_tst[0], lda, &T_tst[0], tsize );
+    time = testsweeper::get_wtime() - time;
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::tsqr returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+    double gflop = lapack::Gflop< scalar_t >::geqrf( m, n );
+    params.gflops() = gflop / time;
+
+    if (verbose >= 2) {
+        printf( "A_factor = " ); print_matrix( m, n, &A_tst[0], lda );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Following lapack/TESTING/LIN/zqrt01.f but using smaller Q and R
+        int64_t ldq = lda;
+        std::vector< scalar_t > Q( ldq * n );  // m-by-n
+        int64_t ldr = blas::max( 1, n );
+        std::vector< scalar_t > R( ldr * n );  // n-by-n
+
+        // Generate first n columns of Q = Q [ I; 0 ]
+        lapack::laset( lapack::MatrixType::General, m, n, 0.0, 1.0, &Q[0], ldq );
+        lapack::tsmqr( Side::Left, Op::NoTrans, m, n, n, mb,
+                       &A_tst[0], lda, &T_tst[0], tsize, &Q[0], ldq );
+
+        // Copy R
+        lapack::laset( lapack::MatrixType::Lower, n, n, 0.0, 0.0, &R[0], ldr );
+        lapack::lacpy( lapack::MatrixType::Upper, n, n, &A_tst[0], lda, &R[0], ldr );
+
+        // Compute R - Q^H A
+        std::vector< scalar_t > R2 = R;
+        blas::gemm( blas::Layout::ColMajor,
+                    Op::ConjTrans, Op::NoTrans, n, n, m,
+                    -1.0, &Q[0], ldq, &A_ref[0], lda, 1.0, &R2[0], ldr );
+
+        // Compute norm( R - Q^H A ) / ( n * norm(A) * EPS )
+        real_t Anorm = lapack::lange( lapack::Norm::One, m, n, &A_ref[0], lda );
+        real_t resid1 = lapack::lange( lapack::Norm::One, n, n, &R2[0], ldr );
+        real_t error1 = 0;
+        if (Anorm > 0)
+            error1 = resid1 / ( n * Anorm );
+
+        // Compute I - Q^H Q
+        lapack::laset( lapack::MatrixType::Upper, n, n, 0.0, 1.0, &R2[0], ldr );
+        blas::herk( blas::Layout::ColMajor, blas::Uplo::Upper, Op::ConjTrans,
+                    n, m, -1.0, &Q[0], ldq, 1.0, &R2[0], ldr );
+
+        // Compute norm( I - Q^H Q ) / ( n * EPS )
+        real_t resid2 = lapack::lanhe( lapack::Norm::One, lapack::Uplo::Upper, n, &R2[0], ldr );
+        real_t ortho = resid2 / n;
+
+        // Apply Q^H from the left: Q^H A = [ R; 0 ].
+        std::vector< scalar_t > C = A_ref;
+        lapack::tsmqr( Side::Left, Op::ConjTrans, m, n, n, mb,
+                       &A_tst[0], lda, &T_tst[0], tsize, &C[0], lda );
+        for (int64_t j = 0; j < n; ++j)
+            for (int64_t i = 0; i <= j; ++i)
+                C[ i + j*lda ] -= R[ i + j*ldr ];
+        real_t error2 = 0;
+        if (Anorm > 0)
+            error2 = lapack::lange( lapack::Norm::One, m, n, &C[0], lda ) / ( n * Anorm );
+
+        // Apply Q from the right: A^H Q = [ R^H, 0 ].
+        int64_t ldd = roundup( blas::max( 1, n ), align );
+        std::vector< scalar_t > D( ldd * m );
+        for (int64_t j = 0; j < n; ++j)
+            for (int64_t i = 0; i < m; ++i)
+                D[ j + i*ldd ] = blas::conj( A_ref[ i + j*lda ] );
+        lapack::tsmqr( Side::Right, Op::NoTrans, n, m, n, mb,
+                       &A_tst[0], lda, &T_tst[0], tsize, &D[0], ldd );
+        for (int64_t j = 0; j < n; ++j)
+            for (int64_t i = 0; i <= j; ++i)
+                D[ j + i*ldd ] -= blas::conj( R[ i + j*ldr ] );
+        real_t error3 = 0;
+        if (Anorm > 0)
+            error3 = lapack::lange( lapack::Norm::Inf, n, m, &D[0], ldd ) / ( n * Anorm );
+
+        params.error() = error1;
+        params.ortho() = ortho;
+        params.error2() = error2;
+        params.error3() = error3;
+        params.okay() = (error1 < tol) && (ortho < tol)
+                        && (error2 < tol) && (error3 < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference, LAPACK geqrf
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = LAPACKE_geqrf( m, n, &A_ref[0], lda, &tau_ref[0] );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "LAPACKE_geqrf returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_tsqr( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_tsqr_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_tsqr_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_tsqr_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_tsqr_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
+
+#else
+
+// -----------------------------------------------------------------------------
+void test_tsqr( Params& params, bool run )
+{
+    fprintf( stderr, "tsqr requires LAPACK >= 3.4.0\n\n" );
+    exit(0);
+}
+
+#endif  // LAPACK >= 3.4.0
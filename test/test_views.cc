@@ -0,0 +1,372 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/views.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "check_gels.hh"
+#include "check_heev.hh"
+#include "check_svd.hh"
+
+#include <vector>
+
+// Storage tested for each view: column-major and row-major are passed
+// to LAPACK in place; strided, with row stride 2, fits neither and is
+// repacked.
+enum class Storage { ColMajor, RowMajor, Strided };
+
+// -----------------------------------------------------------------------------
+// Allocates data for an m-by-n matrix in the given storage,
+// and returns a view of it.
+template< typename scalar_t >
+lapack::MatrixView< scalar_t > make_view(
+    Storage storage, int64_t m, int64_t n, int64_t align,
+    std::vector< scalar_t >& data )
+{
+    using View = lapack::MatrixView< scalar_t >;
+    int64_t ld;
+    switch (storage) {
+        case Storage::ColMajor:
+            ld = roundup( blas::max( 1, m ), align );
+            data.resize( ld * n );
+            return View::col_major( data.data(), m, n, ld );
+
+        case Storage::RowMajor:
+            ld = roundup( blas::max( 1, n ), align );
+            data.resize( ld * m );
+            return View::row_major( data.data(), m, n, ld );
+
+        default:
+            ld = roundup( 2*blas::max( 1, m ), align );
+            data.resize( ld * n );
+            return View( data.data(), m, n, 2, ld );
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Copies column-major A to view V.
+template< typename scalar_t >
+void copy_to_view(
+    scalar_t const* A, int64_t lda, lapack::MatrixView< scalar_t > V )
+{
+    for (int64_t j = 0; j < V.n(); ++j)
+        for (int64_t i = 0; i < V.m(); ++i)
+            V( i, j ) = A[ i + j*lda ];
+}
+
+// Copies view V to column-major A.
+template< typename scalar_t >
+void copy_from_view(
+    lapack::MatrixView< scalar_t > V, scalar_t* A, int64_t lda )
+{
+    for (int64_t j = 0; j < V.n(); ++j)
+        for (int64_t i = 0; i < V.m(); ++i)
+            A[ i + j*lda ] = V( i, j );
+}
+
+// -----------------------------------------------------------------------------
+// Tests drivers taking views (gesv, posv, gels, heevd, gesvd, pbsv, ppsv)
+// with column-major, row-major, and strided views. Each result is copied
+// back to column-major and checked as in the tester for the
+// pointer-based routine; error is the max over all drivers and storages.
+template< typename scalar_t >
+void test_views_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using lapack::Job;
+    using lapack::Uplo;
+    using lapack::Op;
+    using View = lapack::MatrixView< scalar_t >;
+
+    // Constants
+    const scalar_t one = 1.0;
+    const real_t   eps = std::numeric_limits< real_t >::epsilon();
+
+    // get & mark input values
+    lapack::Op trans = params.trans();
+    lapack::Uplo uplo = params.uplo();
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t kd = params.kd();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    real_t tol = params.tol() * eps;
+    params.matrix.mark();
+
+    // mark non-standard output values
+    params.msg();
+
+    if (! run)
+        return;
+
+    if (blas::is_complex_v< scalar_t > && trans == Op::Trans) {
+        params.msg() = "skipping: complex gels needs trans = n or c";
+        return;
+    }
+
+    // ---------- setup
+    // General m-by-n matrix A, and its n-by-n square part for gesv.
+    // Hermitian positive definite band H, with bandwidth kd, by diagonal
+    // dominance; off-diagonal entries have |h| < sqrt( 2 ).
+    kd = blas::min( kd, blas::max( n - 1, 0 ) );
+    int64_t minmn = blas::min( m, n );
+    int64_t maxmn = blas::max( m, n );
+    int64_t lda = roundup( blas::max( 1, maxmn ), align );
+    int64_t ldb = roundup( blas::max( 1, maxmn ), align );
+    int64_t ldh = roundup( blas::max( 1, n ), align );
+    std::vector< scalar_t > A( lda * maxmn );
+    std::vector< scalar_t > B( ldb * nrhs );
+    std::vector< scalar_t > H( ldh * n );
+    lapack::generate_matrix( params.matrix, maxmn, maxmn, &A[0], lda );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B.size(), &B[0] );
+    lapack::larnv( idist, iseed, H.size(), &H[0] );
+    for (int64_t j = 0; j < n; ++j) {
+        H[ j + j*ldh ] = std::real( H[ j + j*ldh ] ) + 3*kd + 1;
+        for (int64_t i = j + 1; i < n; ++i) {
+            if (i - j > kd)
+                H[ i + j*ldh ] = 0;
+            H[ j + i*ldh ] = blas::conj( H[ i + j*ldh ] );
+        }
+    }
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A m=%5lld, n=%5lld, lda=%5lld, nrhs=%5lld, kd=%5lld\n",
+                llong( m ), llong( n ), llong( lda ),
+                llong( nrhs ), llong( kd ) );
+    }
+    if (verbose >= 2) {
+        printf( "A = " ); print_matrix( m, n, &A[0], lda );
+        printf( "H = " ); print_matrix( n, n, &H[0], ldh );
+    }
+
+    // Band and packed storage of H.
+    int64_t ldab = kd + 1;
+    std::vector< scalar_t > AB_ref( ldab * n ), AP_ref( n*(n + 1)/2 );
+    lapack::MatrixView< scalar_t > Hv = View::col_major( &H[0], n, n, ldh );
+    lapack::BandView< scalar_t > AB_view(
+        &AB_ref[0], n, n, (uplo == Uplo::Lower ? kd : 0),
+        (uplo == Uplo::Upper ? kd : 0), ldab );
+    lapack::PackedView< scalar_t > AP_view( &AP_ref[0], n, uplo );
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = blas::max( 0, j - kd ); i <= j; ++i) {
+            if (uplo == Uplo::Upper)
+                AB_view( i, j ) = Hv( i, j );
+            else
+                AB_view( j, i ) = Hv( j, i );
+        }
+        for (int64_t i = 0; i < n; ++i) {
+            if (uplo == Uplo::Upper ? i <= j : i >= j)
+                AP_view( i, j ) = Hv( i, j );
+        }
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        std::vector< scalar_t > D( 4 );
+        std::vector< int64_t > ipiv( 2 );
+        assert_throw( View( &D[0], -1, 1, 1, 1 ), lapack::Error );
+        assert_throw( View( &D[0], 1, 1, 0, 1 ), lapack::Error );
+        assert_throw( View::col_major( &D[0], 2, 2, 1 ), lapack::Error );
+        assert_throw( View::row_major( &D[0], 2, 2, 1 ), lapack::Error );
+        assert_throw( lapack::gesv( View::col_major( &D[0], 2, 1, 2 ), &ipiv[0],
+                                    View::col_major( &D[0], 2, 1, 2 ) ), lapack::Error );
+        assert_throw( lapack::posv( uplo, View::col_major( &D[0], 2, 2, 2 ),
+                                    View::col_major( &D[0], 1, 1, 1 ) ), lapack::Error );
+        assert_throw( lapack::BandView< scalar_t >( &D[0], 2, 2, 1, 1, 2 ), lapack::Error );
+    }
+
+    std::vector< Storage > storages = {
+        Storage::ColMajor, Storage::RowMajor, Storage::Strided };
+    real_t error = 0;
+    double time = 0;
+    for (Storage storage : storages) {
+        std::vector< scalar_t > Av_data, Bv_data, Uv_data, VTv_data;
+        int64_t info = 0;
+
+        //----- gesv: backward error ||B - A X|| / (n ||A|| ||X||).
+        {
+            std::vector< int64_t > ipiv( n );
+            View Av = make_view( storage, n, n, align, Av_data );
+            View Bv = make_view( storage, n, nrhs, align, Bv_data );
+            copy_to_view( &A[0], lda, Av );
+            copy_to_view( &B[0], ldb, Bv );
+
+            double t = testsweeper::get_wtime();
+            info = lapack::gesv( Av, &ipiv[0], Bv );
+            time += testsweeper::get_wtime() - t;
+            if (info != 0) {
+                fprintf( stderr, "lapack::gesv( views ) returned error %lld\n",
+                         llong( info ) );
+            }
+
+            std::vector< scalar_t > X( ldb * nrhs ), R = B;
+            copy_from_view( Bv, &X[0], ldb );
+            blas::gemm( blas::Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                        n, nrhs, n,
+                        -one, &A[0], lda, &X[0], ldb,
+                         one, &R[0], ldb );
+            real_t Rnorm = lapack::lange( lapack::Norm::One, n, nrhs, &R[0], ldb );
+            real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, &X[0], ldb );
+            real_t Anorm = lapack::lange( lapack::Norm::One, n, n, &A[0], lda );
+            if (n > 0 && nrhs > 0)
+                error = blas::max( error, Rnorm / (n * Anorm * Xnorm) );
+        }
+
+        //----- posv, pbsv, ppsv: backward error ||B - H X|| / (n ||H|| ||X||).
+        for (int driver = 0; driver < 3; ++driver) {
+            View Hv2 = make_view( storage, n, n, align, Av_data );
+            View Bv = make_view( storage, n, nrhs, align, Bv_data );
+            copy_to_view( &H[0], ldh, Hv2 );
+            copy_to_view( &B[0], ldb, Bv );
+            std::vector< scalar_t > AB = AB_ref, AP = AP_ref;
+
+            double t = testsweeper::get_wtime();
+            if (driver == 0) {
+                info = lapack::posv( uplo, Hv2, Bv );
+            }
+            else if (driver == 1) {
+                info = lapack::pbsv(
+                    lapack::BandView< scalar_t >(
+                        &AB[0], n, n, AB_view.kl(), AB_view.ku(), ldab ),
+                    Bv );
+            }
+            else {
+                info = lapack::ppsv(
+                    lapack::PackedView< scalar_t >( &AP[0], n, uplo ), Bv );
+            }
+            time += testsweeper::get_wtime() - t;
+            if (info != 0) {
+                fprintf( stderr, "lapack::%s( views ) returned error %lld\n",
+                         (driver == 0 ? "posv" : driver == 1 ? "pbsv" : "ppsv"),
+                         llong( info ) );
+            }
+
+            std::vector< scalar_t > X( ldb * nrhs ), R = B;
+            copy_from_view( Bv, &X[0], ldb );
+            blas::hemm( blas::Layout::ColMajor, blas::Side::Left, uplo,
+                        n, nrhs,
+                        -one, &H[0], ldh, &X[0], ldb,
+                         one, &R[0], ldb );
+            real_t Rnorm = lapack::lange( lapack::Norm::One, n, nrhs, &R[0], ldb );
+            real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, &X[0], ldb );
+            real_t Hnorm = lapack::lanhe( lapack::Norm::One, uplo, n, &H[0], ldh );
+            if (n > 0 && nrhs > 0)
+                error = blas::max( error, Rnorm / (n * Hnorm * Xnorm) );
+        }
+
+        //----- gels: least squares checks as in test_gels.
+        {
+            int64_t opAm = (trans == Op::NoTrans ? m : n);
+            int64_t opAn = (trans == Op::NoTrans ? n : m);
+            View Av = make_view( storage, m, n, align, Av_data );
+            View Bv = make_view( storage, maxmn, nrhs, align, Bv_data );
+            copy_to_view( &A[0], lda, Av );
+            copy_to_view( &B[0], ldb, Bv );
+
+            double t = testsweeper::get_wtime();
+            info = lapack::gels( trans, Av, Bv );
+            time += testsweeper::get_wtime() - t;
+            if (info != 0) {
+                fprintf( stderr, "lapack::gels( views ) returned error %lld\n",
+                         llong( info ) );
+            }
+
+            std::vector< scalar_t > X( ldb * nrhs );
+            copy_from_view( Bv, &X[0], ldb );
+            real_t result[ 2 ];
+            check_gels( opAm <= opAn, trans, m, n, nrhs,
+                        &A[0], lda, &X[0], ldb, &B[0], ldb, result );
+            error = blas::max( error, blas::max( result[ 0 ], result[ 1 ] ) );
+        }
+
+        //----- heevd: checks as in test_heevd.
+        {
+            std::vector< real_t > Lambda( n );
+            View Zv = make_view( storage, n, n, align, Av_data );
+            copy_to_view( &H[0], ldh, Zv );
+
+            double t = testsweeper::get_wtime();
+            info = lapack::heevd( Job::Vec, uplo, Zv, &Lambda[0] );
+            time += testsweeper::get_wtime() - t;
+            if (info != 0) {
+                fprintf( stderr, "lapack::heevd( views ) returned error %lld\n",
+                         llong( info ) );
+            }
+
+            std::vector< scalar_t > Z( ldh * n );
+            copy_from_view( Zv, &Z[0], ldh );
+            real_t result[ 3 ];
+            check_heev( Job::Vec, uplo, n, &H[0], ldh,
+                        n, &Lambda[0], &Z[0], ldh, result );
+            for (int k = 0; k < 3; ++k)
+                error = blas::max( error, result[ k ] );
+        }
+
+        //----- gesvd: checks as in test_gesvd.
+        {
+            std::vector< real_t > Sigma( minmn );
+            View Av = make_view( storage, m, n, align, Av_data );
+            View Uv = make_view( storage, m, minmn, align, Uv_data );
+            View VTv = make_view( storage, minmn, n, align, VTv_data );
+            copy_to_view( &A[0], lda, Av );
+
+            double t = testsweeper::get_wtime();
+            info = lapack::gesvd( Job::SomeVec, Job::SomeVec, Av, &Sigma[0],
+                                  Uv, VTv );
+            time += testsweeper::get_wtime() - t;
+            if (info != 0) {
+                fprintf( stderr, "lapack::gesvd( views ) returned error %lld\n",
+                         llong( info ) );
+            }
+
+            int64_t ldu = roundup( blas::max( 1, m ), align );
+            int64_t ldvt = roundup( blas::max( 1, minmn ), align );
+            std::vector< scalar_t > U( ldu * minmn ), VT( ldvt * n );
+            copy_from_view( Uv, &U[0], ldu );
+            copy_from_view( VTv, &VT[0], ldvt );
+            real_t result[ 4 ];
+            check_svd( Job::SomeVec, Job::SomeVec, m, n, &A[0], lda,
+                       &Sigma[0], &U[0], ldu, &VT[0], ldvt, result );
+            for (int k = 0; k < 4; ++k)
+                error = blas::max( error, result[ k ] );
+        }
+    }
+
+    params.time() = time;
+    params.error() = error;
+    params.okay() = (error < tol);
+}
+
+// -----------------------------------------------------------------------------
+void test_views( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_views_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_views_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_views_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_views_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
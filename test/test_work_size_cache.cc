@@ -0,0 +1,187 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Queries gesvd workspace for an m-by-n matrix, without vectors.
+// @return lwork.
+template< typename real_t >
+int64_t gesvd_lwork(
+    int64_t m, int64_t n,
+    real_t* A, int64_t lda,
+    real_t* S )
+{
+    int64_t lwork;
+    lapack::gesvd_work_size( lapack::Job::NoVec, lapack::Job::NoVec, m, n,
+                             A, lda, S, nullptr, 1, nullptr, 1, &lwork );
+    return lwork;
+}
+
+// -----------------------------------------------------------------------------
+// Complex version; also queries lrwork, which isn't returned.
+template< typename real_t >
+int64_t gesvd_lwork(
+    int64_t m, int64_t n,
+    std::complex< real_t >* A, int64_t lda,
+    real_t* S )
+{
+    int64_t lwork, lrwork;
+    lapack::gesvd_work_size( lapack::Job::NoVec, lapack::Job::NoVec, m, n,
+                             A, lda, S, nullptr, 1, nullptr, 1,
+                             &lwork, &lrwork );
+    return lwork;
+}
+
+// -----------------------------------------------------------------------------
+// Tests work_size_cache_set_capacity and work_size_cache_stats via
+// gesvd_work_size, for shapes m-by-n, (m+1)-by-n, and (m+2)-by-n.
+// error counts hits, misses, sizes, and lwork values that differ from
+// those expected: a repeated shape hits and skips the query, a new
+// shape misses, the least recently used shape is evicted at capacity,
+// and capacity 0 disables and clears the cache.
+// time is the cached queries; ref_time is the same queries uncached.
+template< typename scalar_t >
+void test_work_size_cache_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using lapack::WorkSizeCacheStats;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t verbose = params.verbose();
+
+    // mark non-standard output values
+    params.ref_time();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lda = blas::max( 1, m + 2 );
+    std::vector< scalar_t > A( lda * blas::max( 1, n ) );
+    std::vector< real_t > S( blas::max( 1, blas::min( m + 2, n ) ) );
+
+    int64_t violations = 0;
+    auto check = [&]( WorkSizeCacheStats const& expect, char const* what ) {
+        WorkSizeCacheStats stats = lapack::work_size_cache_stats();
+        if (stats.hits != expect.hits || stats.misses != expect.misses
+            || stats.size != expect.size || stats.capacity != expect.capacity) {
+            ++violations;
+            if (verbose >= 1) {
+                printf( "%s: hits %lld, misses %lld, size %lld, capacity %lld; "
+                        "expected %lld, %lld, %lld, %lld\n", what,
+                        llong( stats.hits ), llong( stats.misses ),
+                        llong( stats.size ), llong( stats.capacity ),
+                        llong( expect.hits ), llong( expect.misses ),
+                        llong( expect.size ), llong( expect.capacity ) );
+            }
+        }
+    };
+    auto check_lwork = [&]( int64_t lwork, int64_t expect ) {
+        if (lwork != expect)
+            ++violations;
+    };
+
+    int64_t save_capacity = lapack::work_size_cache_stats().capacity;
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::work_size_cache_set_capacity( -1 ), lapack::Error );
+    }
+
+    // ---------- uncached sizes
+    lapack::work_size_cache_set_capacity( 0 );
+    lapack::work_size_cache_clear();
+    int64_t lwork0 = gesvd_lwork( m,     n, &A[0], lda, &S[0] );
+    int64_t lwork1 = gesvd_lwork( m + 1, n, &A[0], lda, &S[0] );
+    int64_t lwork2 = gesvd_lwork( m + 2, n, &A[0], lda, &S[0] );
+    check( { 0, 0, 0, 0 }, "disabled" );
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+
+    lapack::work_size_cache_set_capacity( 2 );
+
+    // First query of a shape misses; repeating it hits, skipping the query.
+    check_lwork( gesvd_lwork( m, n, &A[0], lda, &S[0] ), lwork0 );
+    check( { 0, 1, 1, 2 }, "first query" );
+    check_lwork( gesvd_lwork( m, n, &A[0], lda, &S[0] ), lwork0 );
+    check( { 1, 1, 1, 2 }, "repeated query" );
+
+    // A new shape misses.
+    check_lwork( gesvd_lwork( m + 1, n, &A[0], lda, &S[0] ), lwork1 );
+    check( { 1, 2, 2, 2 }, "new shape" );
+
+    // At capacity, a third shape evicts the least recently used, m-by-n.
+    check_lwork( gesvd_lwork( m + 2, n, &A[0], lda, &S[0] ), lwork2 );
+    check( { 1, 3, 2, 2 }, "evict" );
+    check_lwork( gesvd_lwork( m + 1, n, &A[0], lda, &S[0] ), lwork1 );
+    check( { 2, 3, 2, 2 }, "kept after evict" );
+    check_lwork( gesvd_lwork( m, n, &A[0], lda, &S[0] ), lwork0 );
+    check( { 2, 4, 2, 2 }, "evicted" );
+
+    time = testsweeper::get_wtime() - time;
+    params.time() = time;
+
+    // Capacity 0 clears the cache and stops counting.
+    lapack::work_size_cache_set_capacity( 0 );
+    check( { 2, 4, 0, 0 }, "set capacity 0" );
+    check_lwork( gesvd_lwork( m, n, &A[0], lda, &S[0] ), lwork0 );
+    check( { 2, 4, 0, 0 }, "query with capacity 0" );
+
+    lapack::work_size_cache_clear();
+    lapack::work_size_cache_set_capacity( save_capacity );
+
+    params.error() = violations;
+    params.okay() = (violations == 0);
+
+    if (params.ref() == 'y') {
+        // ---------- run reference, uncached
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        gesvd_lwork( m,     n, &A[0], lda, &S[0] );
+        gesvd_lwork( m,     n, &A[0], lda, &S[0] );
+        gesvd_lwork( m + 1, n, &A[0], lda, &S[0] );
+        gesvd_lwork( m + 2, n, &A[0], lda, &S[0] );
+        gesvd_lwork( m + 1, n, &A[0], lda, &S[0] );
+        gesvd_lwork( m,     n, &A[0], lda, &S[0] );
+        time = testsweeper::get_wtime() - time;
+        params.ref_time() = time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_work_size_cache( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_work_size_cache_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_work_size_cache_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_work_size_cache_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_work_size_cache_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
@@ -0,0 +1,213 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Checks the WorkspaceScope arena through its capacity, using lange with
+// the infinity norm, which allocates exactly m reals of workspace.
+// Chunks are at least 64 KiB and requests are rounded to 64 bytes.
+// @return number of violations.
+template< typename scalar_t >
+int64_t check_workspace_scope( int64_t verbose )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    const real_t eps = std::numeric_limits< real_t >::epsilon();
+    const size_t KiB = 1024;
+    const size_t min_chunk = 64*KiB;
+
+    // Rows of an m-by-1 matrix that make lange allocate bytes of workspace.
+    auto rows = []( size_t bytes ) {
+        return int64_t( bytes / sizeof( real_t ) );
+    };
+
+    int64_t max_m = rows( 192*KiB );
+    std::vector< scalar_t > A( max_m );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, A.size(), &A[0] );
+
+    // Infinity norm of the first m rows, which is their max abs value;
+    // the arena mustn't change it.
+    int64_t violations = 0;
+    auto norm = [&]( int64_t m ) {
+        real_t result = lapack::lange( lapack::Norm::Inf, m, 1, &A[0], m );
+        real_t expect = 0;
+        for (int64_t i = 0; i < m; ++i)
+            expect = blas::max( expect, std::abs( A[ i ] ) );
+        if (std::abs( result - expect ) > 4 * eps * expect)
+            ++violations;
+    };
+
+    auto check = [&]( bool okay, char const* what ) {
+        if (! okay) {
+            ++violations;
+            if (verbose >= 1)
+                printf( "WorkspaceScope: %s failed\n", what );
+        }
+    };
+
+    // ---------- arena reuse
+    {
+        lapack::WorkspaceScope scope;
+        check( scope.capacity() == 0, "empty arena" );
+        check( scope.max_bytes() == lapack::WorkspaceScope::default_max_bytes,
+               "default max_bytes" );
+
+        norm( 100 );
+        size_t capacity = scope.capacity();
+        check( capacity == min_chunk, "first chunk" );
+
+        // Same and smaller sizes reuse the chunk.
+        norm( 100 );
+        norm( 10 );
+        norm( rows( min_chunk ) );
+        check( scope.capacity() == capacity, "reuse" );
+    }
+
+    // ---------- release at the end of the outermost scope
+    {
+        lapack::WorkspaceScope scope;
+        check( scope.capacity() == 0, "release" );
+    }
+
+    // ---------- max_bytes cap: larger requests fall back to the heap
+    {
+        lapack::WorkspaceScope scope( min_chunk );
+        check( scope.max_bytes() == min_chunk, "max_bytes" );
+
+        norm( rows( 128*KiB ) );
+        check( scope.capacity() == 0, "heap fallback" );
+
+        norm( 100 );
+        check( scope.capacity() == min_chunk, "chunk within max_bytes" );
+
+        norm( rows( 128*KiB ) );
+        check( scope.capacity() == min_chunk, "heap fallback when full" );
+    }
+
+    // ---------- nested scopes share the outermost arena
+    {
+        lapack::WorkspaceScope outer;
+        norm( 100 );
+        {
+            // Inner max_bytes is ignored.
+            lapack::WorkspaceScope inner( 1 );
+            check( inner.max_bytes() == outer.max_bytes(), "nested max_bytes" );
+            check( inner.capacity() == min_chunk, "nested capacity" );
+
+            norm( 100 );
+            check( inner.capacity() == min_chunk, "nested reuse" );
+        }
+        // Inner scope doesn't release the arena.
+        check( outer.capacity() == min_chunk, "nested release" );
+    }
+
+    // ---------- chunks coalesce when no allocations are live
+    {
+        lapack::WorkspaceScope scope;
+        norm( 100 );                // 64 KiB chunk
+        norm( rows( 128*KiB ) );    // doesn't fit; adds a 128 KiB chunk
+        size_t capacity = scope.capacity();
+        check( capacity == 192*KiB, "second chunk" );
+
+        // Fits only in one 192 KiB chunk, after coalescing.
+        norm( rows( 192*KiB ) );
+        check( scope.capacity() == capacity, "coalesce" );
+    }
+
+    return violations;
+}
+
+// -----------------------------------------------------------------------------
+// Tests lapack::WorkspaceScope. error counts arena capacities that differ
+// from those expected; see check_workspace_scope. time is repeated geqrf
+// calls inside a scope; ref_time is the same calls using the heap.
+template< typename scalar_t >
+void test_workspace_work( Params& params, bool run )
+{
+    // get & mark input values
+    int64_t n = params.dim.n();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    // mark non-standard output values
+    params.ref_time();
+
+    if (! run)
+        return;
+
+    int64_t violations = check_workspace_scope< scalar_t >( verbose );
+    params.error() = violations;
+    params.okay() = (violations == 0);
+
+    // ---------- setup
+    int64_t repeat = 10;
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    size_t size_A = (size_t) lda * n;
+
+    std::vector< scalar_t > A_orig( size_A );
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > tau( n );
+    lapack::generate_matrix( params.matrix, n, n, &A_orig[0], lda );
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    {
+        lapack::WorkspaceScope scope;
+        for (int64_t i = 0; i < repeat; ++i) {
+            A_tst = A_orig;
+            lapack::geqrf( n, n, &A_tst[0], lda, &tau[0] );
+        }
+    }
+    time = testsweeper::get_wtime() - time;
+    params.time() = time;
+
+    if (params.ref() == 'y') {
+        // ---------- run reference, without arena
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t i = 0; i < repeat; ++i) {
+            A_tst = A_orig;
+            lapack::geqrf( n, n, &A_tst[0], lda, &tau[0] );
+        }
+        time = testsweeper::get_wtime() - time;
+        params.ref_time() = time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_workspace( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_workspace_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_workspace_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_workspace_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_workspace_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
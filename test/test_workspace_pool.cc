@@ -0,0 +1,306 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/device.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Checks WorkspacePool growth, reuse, high-water mark, and trim, using
+// host memory with counting alloc and release functions.
+// @return number of violations.
+int64_t check_workspace_pool()
+{
+    int64_t violations = 0;
+    int64_t allocs = 0, releases = 0;
+    {
+        lapack::WorkspacePool pool(
+            [&allocs]( size_t bytes ) {
+                ++allocs;
+                return std::malloc( bytes );
+            },
+            [&releases]( void* ptr ) {
+                ++releases;
+                std::free( ptr );
+            } );
+
+        // Empty pool doesn't allocate for 0 bytes.
+        if (pool.get( 0 ) != nullptr || allocs != 0)
+            ++violations;
+
+        // Grows, rounded up; smaller requests reuse the buffer.
+        void* ptr = pool.get( 100 );
+        if (ptr == nullptr || allocs != 1 || pool.size() < 100)
+            ++violations;
+        if (pool.get( 50 ) != ptr || pool.get( pool.size() ) != ptr
+            || allocs != 1)
+            ++violations;
+
+        // Growing releases the old buffer.
+        pool.get( 10000 );
+        if (allocs != 2 || releases != 1 || pool.size() < 10000)
+            ++violations;
+        if (pool.high_water() != 10000 || pool.num_allocs() != 2)
+            ++violations;
+
+        // trim releases the buffer, but keeps the high-water mark.
+        pool.trim();
+        if (releases != 2 || pool.size() != 0 || pool.high_water() != 10000)
+            ++violations;
+        pool.trim();
+        if (releases != 2)
+            ++violations;
+
+        // Grows again after trim; destructor releases it.
+        pool.get( 10 );
+        if (allocs != 3 || pool.high_water() != 10000)
+            ++violations;
+    }
+    if (releases != 3)
+        ++violations;
+    return violations;
+}
+
+// -----------------------------------------------------------------------------
+// Tests the workspace pool owned by lapack::Queue: factors A with
+// getrf and solves with getrs, then factors a copy with geqrf, all via
+// the overloads that take workspace from the queue. error is the
+// backward error of the solve. error2 counts violations of the pool's
+// bookkeeping, both for a host-memory WorkspacePool and the queue's pools.
+// ref_time is for the same routines with caller-allocated workspace.
+template< typename scalar_t >
+void test_workspace_pool_work( Params& params, bool run )
+{
+    using lapack::device_info_int;
+    using lapack::device_pivot_int;
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t n = params.dim.n();
+    int64_t device = params.device();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.gflops();
+    params.error2();
+    params.msg();
+
+    if (! run)
+        return;
+
+    // The pool itself is tested with host memory.
+    int64_t violations = check_workspace_pool();
+    params.error2() = violations;
+    params.okay() = (violations == 0);
+
+    // The host backend runs without GPU devices.
+    #if ! defined( LAPACK_HAVE_HOST_QUEUE )
+        if (blas::get_device_count() == 0) {
+            params.msg() = "skipping: no GPU devices or no GPU support";
+            return;
+        }
+    #endif
+
+    // ---------- setup
+    int64_t nrhs = 1;
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    int64_t ldb = lda;
+    size_t size_A = (size_t) lda * n;
+    size_t size_B = (size_t) ldb * nrhs;
+
+    std::vector< scalar_t > A( size_A );
+    std::vector< scalar_t > B_tst( size_B );
+    std::vector< scalar_t > B_ref( size_B );
+
+    lapack::generate_matrix( params.matrix, n, n, &A[0], lda );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B_tst.size(), &B_tst[0] );
+    B_ref = B_tst;
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, lda=%5lld\n",
+                llong( n ), llong( lda ) );
+    }
+
+    lapack::Queue queue( device );
+    scalar_t*         dLU   = lapack::device_malloc< scalar_t >( size_A, queue );
+    scalar_t*         dQR   = lapack::device_malloc< scalar_t >( size_A, queue );
+    scalar_t*         dB    = lapack::device_malloc< scalar_t >( size_B, queue );
+    scalar_t*         dtau  = lapack::device_malloc< scalar_t >( n, queue );
+    device_pivot_int* dipiv = lapack::device_malloc< device_pivot_int >( n, queue );
+    device_info_int*  dinfo = lapack::device_malloc< device_info_int >( 3, queue );
+
+    // Expected high-water mark is the largest workspace query.
+    size_t d_getrf, h_getrf, d_getrs, h_getrs, d_geqrf, h_geqrf;
+    lapack::getrf_work_size_bytes( n, n, dLU, lda, &d_getrf, &h_getrf, queue );
+    lapack::getrs_work_size_bytes( lapack::Op::NoTrans, n, nrhs, dLU, lda,
+                                   dB, ldb, &d_getrs, &h_getrs, queue );
+    lapack::geqrf_work_size_bytes( n, n, dQR, lda, &d_geqrf, &h_geqrf, queue );
+    size_t d_max = std::max( { d_getrf, d_getrs, d_geqrf } );
+    size_t h_max = std::max( { h_getrf, h_getrs, h_geqrf } );
+
+    // test error exits, on a separate queue so its pool is unaffected
+    if (params.error_exit() == 'y') {
+        lapack::Queue queue2( device );
+        assert_throw( lapack::WorkspacePool( nullptr, []( void* ) {} ),
+                      lapack::Error );
+        assert_throw( lapack::getrf( -1,  n, dLU, lda, dipiv, dinfo, queue2 ), lapack::Error );
+        assert_throw( lapack::getrf(  n, -1, dLU, lda, dipiv, dinfo, queue2 ), lapack::Error );
+        assert_throw( lapack::getrf(  n,  n, dLU, n-1, dipiv, dinfo, queue2 ), lapack::Error );
+    }
+
+    // ---------- run test
+    lapack::device_copy_matrix( n, n, A.data(), lda, dLU, lda, queue );
+    lapack::device_copy_matrix( n, n, A.data(), lda, dQR, lda, queue );
+    lapack::device_copy_matrix( n, nrhs, B_tst.data(), ldb, dB, ldb, queue );
+    testsweeper::flush_cache( params.cache() );
+    queue.sync();
+    double time = testsweeper::get_wtime();
+
+    lapack::getrf( n, n, dLU, lda, dipiv, &dinfo[0], queue );
+    lapack::getrs( lapack::Op::NoTrans, n, nrhs, dLU, lda, dipiv,
+                   dB, ldb, &dinfo[1], queue );
+    lapack::geqrf( n, n, dQR, lda, dtau, &dinfo[2], queue );
+
+    queue.sync();
+    time = testsweeper::get_wtime() - time;
+
+    double gflop = lapack::Gflop< scalar_t >::getrf( n, n )
+                 + lapack::Gflop< scalar_t >::getrs( n, nrhs )
+                 + lapack::Gflop< scalar_t >::geqrf( n, n );
+    params.time()   = time;
+    params.gflops() = gflop / time;
+
+    // Check the queue's pools.
+    if (queue.dev_workspace_high_water()  != d_max
+        || queue.host_workspace_high_water() != h_max
+        || queue.dev_workspace_size()  < d_max
+        || queue.host_workspace_size() < h_max)
+        ++violations;
+    queue.trim();
+    if (queue.dev_workspace_size() != 0
+        || queue.host_workspace_size() != 0
+        || queue.dev_workspace_high_water() != d_max)
+        ++violations;
+    params.error2() = violations;
+    params.okay() = (violations == 0);
+    params.msg() = std::to_string( d_max ) + " + "
+                 + std::to_string( h_max ) + " bytes";
+
+    device_info_int info_tst[ 3 ];
+    lapack::device_copy_matrix( n, nrhs, dB, ldb, B_tst.data(), ldb, queue );
+    lapack::device_memcpy( info_tst, dinfo, 3, queue );
+    queue.sync();
+    for (int i = 0; i < 3; ++i) {
+        if (info_tst[ i ] != 0) {
+            fprintf( stderr, "lapack routine %d returned error %lld\n",
+                     i, llong( info_tst[ i ] ) );
+        }
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Relative backwards error = ||b - Ax|| / (n * ||A|| * ||x||).
+        blas::gemm( blas::Layout::ColMajor, blas::Op::NoTrans, blas::Op::NoTrans,
+                    n, nrhs, n,
+                    -1.0, &A[0], lda,
+                          &B_tst[0], ldb,
+                     1.0, &B_ref[0], ldb );
+        if (verbose >= 2) {
+            printf( "R = " ); print_matrix( n, nrhs, &B_ref[0], ldb );
+        }
+
+        real_t error = lapack::lange( lapack::Norm::One, n, nrhs, &B_ref[0], ldb );
+        real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, &B_tst[0], ldb );
+        real_t Anorm = lapack::lange( lapack::Norm::One, n, n,    &A[0], lda );
+        if (n > 0)
+            error /= (n * Anorm * Xnorm);
+        params.error() = error;
+        params.okay() = params.okay() && (error < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference, with workspace allocated per call
+        lapack::device_copy_matrix( n, n, A.data(), lda, dLU, lda, queue );
+        lapack::device_copy_matrix( n, n, A.data(), lda, dQR, lda, queue );
+        lapack::device_copy_matrix( n, nrhs, B_ref.data(), ldb, dB, ldb, queue );
+        testsweeper::flush_cache( params.cache() );
+        queue.sync();
+        time = testsweeper::get_wtime();
+
+        char* d_work = lapack::device_malloc< char >( d_getrf, queue );
+        std::vector< char > h_work( h_getrf );
+        lapack::getrf( n, n, dLU, lda, dipiv, d_work, d_getrf,
+                       h_work.data(), h_getrf, &dinfo[0], queue );
+        lapack::device_free( d_work, queue );
+
+        d_work = lapack::device_malloc< char >( d_getrs, queue );
+        h_work.resize( h_getrs );
+        lapack::getrs( lapack::Op::NoTrans, n, nrhs, dLU, lda, dipiv,
+                       dB, ldb, d_work, d_getrs,
+                       h_work.data(), h_getrs, &dinfo[1], queue );
+        lapack::device_free( d_work, queue );
+
+        d_work = lapack::device_malloc< char >( d_geqrf, queue );
+        h_work.resize( h_geqrf );
+        lapack::geqrf( n, n, dQR, lda, dtau, d_work, d_geqrf,
+                       h_work.data(), h_geqrf, &dinfo[2], queue );
+        lapack::device_free( d_work, queue );
+
+        queue.sync();
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+    }
+
+    // Cleanup GPU memory.
+    lapack::device_free( dLU,   queue );
+    lapack::device_free( dQR,   queue );
+    lapack::device_free( dB,    queue );
+    lapack::device_free( dtau,  queue );
+    lapack::device_free( dipiv, queue );
+    lapack::device_free( dinfo, queue );
+}
+
+// -----------------------------------------------------------------------------
+void test_workspace_pool( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_workspace_pool_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_workspace_pool_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_workspace_pool_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_workspace_pool_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
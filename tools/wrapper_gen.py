@@ -1202,7 +1202,10 @@ def parse_docs( func, txt, variables, indent=0 ):
 
 # ------------------------------------------------------------------------------
 # returns C++ docs for given function
-def generate_docs( func ):
+def generate_docs( func, variant='default' ):
+    if (variant != 'default'):
+        return generate_workspace_docs( func, variant )
+
     variables = []
     for arg in func.args:
         if (arg.name_orig != arg.name):
@@ -1328,8 +1331,57 @@ def generate_docs( func ):
 # end
 
 # ------------------------------------------------------------------------------
-# returns LAPACK++ wrapper for given function
-def generate_wrapper( func, header=False ):
+# returns short docs for foo_work_size and foo with caller-provided workspace,
+# referring to docs of foo for other arguments.
+def generate_workspace_docs( func, variant ):
+    works = [ arg.name for arg in func.args if (arg.is_work and arg.is_array) ]
+    if (variant == 'work_size'):
+        txt = ('/// Workspace query for lapack::' + func.name + ' with caller-provided workspace.\n'
+            +  '/// Returns the array lengths that the workspace overload of `' + func.name + '`\n'
+            +  '/// requires, so the workspace can be allocated once, outside a loop.\n')
+    else:
+        txt = ('/// Variant of lapack::' + func.name + ' that takes caller-provided workspace\n'
+            +  '/// instead of querying and allocating it on each call.\n'
+            +  '/// Use lapack::' + func.name + '_work_size to get the required lengths.\n')
+    txt += ('///\n'
+        +   '/// Overloaded versions are available for\n'
+        +   '/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.\n'
+        +   '///\n'
+        +   '/// Other arguments are the same as for lapack::' + func.name + '.\n')
+    if (variant == 'work_size'):
+        txt += '/// Arrays are used only to select the precision and are not referenced.\n'
+    txt += '///\n'
+    for name in works:
+        if (variant == 'work_size'):
+            txt += ('/// @param[out] l' + name + '\n'
+                +   '///     The optimal length of the array ' + name + '.\n'
+                +   '///\n')
+        else:
+            txt += ('/// @param[out] ' + name + '\n'
+                +   '///     The vector ' + name + ' of length l' + name + '. Workspace.\n'
+                +   '///\n'
+                +   '/// @param[in] l' + name + '\n'
+                +   '///     The length of the array ' + name + '.\n'
+                +   '///     Use the value from lapack::' + func.name + '_work_size.\n'
+                +   '///\n')
+    # end
+    txt += '/// @ingroup ' + func.group + '\n'
+    return txt
+# end
+
+# ------------------------------------------------------------------------------
+# returns type of a workspace array in the API: lapack_int => int64_t.
+def api_dtype( dtype ):
+    return 'int64_t' if (dtype == 'lapack_int') else dtype
+# end
+
+# ------------------------------------------------------------------------------
+# returns LAPACK++ wrapper for given function.
+# For routines with a workspace query, variant selects which function:
+#   'default'    allocates workspace and calls the 'workspace' variant;
+#   'work_size'  is the foo_work_size query for workspace lengths;
+#   'workspace'  takes caller-provided work, rwork, iwork, etc. arrays.
+def generate_wrapper( func, header=False, variant='default' ):
     # --------------------
     # build list of arguments for prototype, query, and call
     local_vars = ''
@@ -1343,6 +1395,7 @@ def generate_wrapper( func, header=False ):
     call_args  = []
     alias_args = []
     use_query  = False
+    works      = []  # (dtype, name, length) of work arrays
     i = 0
     for arg in func.args:
         # arg.name  is base name, like "m" or "A"
@@ -1406,8 +1459,10 @@ def generate_wrapper( func, header=False ):
                 alloc_work += tab + 'lapack::vector< ' + arg.dtype + ' > ' + arg.lname
                 if (arg.use_query):
                     alloc_work += '( ' + func.args[i+1].lname + ' );\n'
+                    works.append( (arg.dtype, arg.name, None) )
                 else:
                     alloc_work += '( ' + arg.dim.lower() + ' );\n'
+                    works.append( (arg.dtype, arg.name, arg.dim.lower()) )
 
                 ##alloc_work += (tab + arg.dtype + '* ' + arg.name + '_'
                 ##           +   ' = new ' + arg.dtype + '[ l' + arg.name + ' ];\n')
@@ -1496,9 +1551,70 @@ def generate_wrapper( func, header=False ):
                    +  alloc_work)
     # end
 
+    #--------------------
+    # variants with caller-provided workspace
+    if (use_query and variant == 'work_size'):
+        # return lengths instead of allocating and calling
+        func.retval = 'void'
+        proto_args.append( '\n    ' + ', '.join( 'int64_t* l' + name
+                                                 for (dtype, name, dim) in works ) )
+        query = re.sub( r'\n' + tab + '// query for workspace size\n', r'\n', query )
+        for (dtype, name, dim) in works:
+            if (dim is None):
+                query = query.replace( tab + 'lapack_int l' + name + '_ =',
+                                       tab + '*l' + name + ' =' )
+            else:
+                query += tab + '*l' + name + ' = ' + dim + ';\n'
+        # end
+        alloc_work  = ''
+        call        = ''
+        info_throw  = ''
+        cleanup     = ''
+        info_return = ''
+    elif (use_query and variant == 'workspace'):
+        # integer workspace is int64_t in the API, like other integer arrays
+        proto_args.append( '\n    ' + ',\n    '.join( api_dtype( dtype ) + '* ' + name + ', int64_t l' + name
+                                                    for (dtype, name, dim) in works ) )
+        query = ''
+        for (dtype, name, dim) in works:
+            if (dim is None):
+                local_vars += tab + 'lapack_int l' + name + '_ = to_lapack_int( l' + name + ' );\n'
+            else:
+                local_vars += tab + 'lapack_error_if( l' + name + ' < ' + dim + ' );\n'
+            if (dtype == 'lapack_int'):
+                local_vars += (tab + '// 32-bit ' + name + ' fits in caller\'s 64-bit ' + name + '\n'
+                           +   tab + 'lapack_int* ' + name + '_ = reinterpret_cast< lapack_int* >( ' + name + ' );\n')
+                call_args = [ a.replace( '&' + name + '[0]', name + '_' ) for a in call_args ]
+            else:
+                call_args = [ a.replace( '&' + name + '[0]', name ) for a in call_args ]
+        # end
+        alloc_work = ''
+    elif (use_query):
+        # default allocates workspace, then calls workspace variant
+        names = [ re.sub( r'^.*[ *]', '', a.strip() ) for a in proto_args ]
+        lnames = [ 'l' + name for (dtype, name, dim) in works ]
+        local_vars = ''
+        query = (tab + '// query for workspace size\n'
+              +  tab + 'int64_t ' + ', '.join( lnames ) + ';\n'
+              +  tab + func.name + '_work_size(\n'
+              +  tab*2 + ', '.join( names ) + ',\n'
+              +  tab*2 + ', '.join( '&' + l for l in lnames ) + ' );\n')
+        alloc_work = ('\n' + tab + '// allocate workspace\n'
+                   +  ''.join( tab + 'lapack::vector< ' + api_dtype( dtype ) + ' > ' + name + '( l' + name + ' );\n'
+                               for (dtype, name, dim) in works ))
+    # end
+
     #--------------------
     # function call
-    if (func.is_func):
+    if (use_query and variant == 'default'):
+        call = ('\n' + tab + 'return ' + func.name + '(\n'
+             + tab*2 + ', '.join( names ) + ',\n'
+             + tab*2 + ', '.join( '&' + name + '[0], l' + name
+                                  for (dtype, name, dim) in works ) + ' );\n')
+        info_throw  = ''
+        cleanup     = ''
+        info_return = ''
+    elif (func.is_func):
         call = ('\n' + tab + 'return LAPACK_' + func.xname + '(\n'
              + tab*2 + ', '.join( call_args ) + '\n'
              + tab + ');\n')
@@ -1510,8 +1626,18 @@ def generate_wrapper( func, header=False ):
              + tab + ');\n')
 
     #--------------------
+    fname  = func.name
+    suffix = ''
+    if (use_query and variant == 'work_size'):
+        call   = ''
+        suffix = '_work_size'
+        fname += suffix
+    if (use_query and variant != 'default'):
+        alias_args += [ re.sub( r'^.*[ *]', '', a.strip() )
+                        for a in ', '.join( proto_args[ -1: ] ).split( ',' ) ]
+
     if (header):
-        txt = (func.retval + ' ' + func.name + '(\n'
+        txt = (func.retval + ' ' + fname + '(\n'
             +  tab + ', '.join( proto_args )
             +  ' );\n\n')
         # aliases for real routines (hesv => sysv, etc.)
@@ -1519,15 +1645,16 @@ def generate_wrapper( func, header=False ):
         if (s):
             alias = alias_map[ s.group(1) ] + s.group(2)
             # todo: he
-            txt += ('// ' + alias + ' alias to ' + func.name + '\n'
-                +   'inline ' + func.retval + ' ' + alias + '(\n'
+            txt += ('// ' + alias + suffix + ' alias to ' + fname + '\n'
+                +   'inline ' + func.retval + ' ' + alias + suffix + '(\n'
                 +   tab + ', '.join( proto_args ) + ' )\n'
                 +   '{\n'
-                +   tab + 'return ' + func.name + '( ' + ', '.join( alias_args ) + ' );\n'
+                +   tab + ('' if func.retval == 'void' else 'return ')
+                +   fname + '( ' + ', '.join( alias_args ) + ' );\n'
                 +   '}\n\n')
         # end
     else:
-        txt = (func.retval + ' ' + func.name + '(\n'
+        txt = (func.retval + ' ' + fname + '(\n'
             +  tab + ', '.join( proto_args )
             +  ' )\n{\n'
             +  local_vars
@@ -1925,6 +2052,32 @@ def process_routine( arg ):
             print( txt, file=wrapper, end='' )
     # end
 
+    # routines with workspace query also get foo_work_size and
+    # variants with caller-provided workspace
+    use_query = any( a.use_query for a in funcs[0].args )
+    if (use_query):
+        for variant in ('work_size', 'workspace'):
+            i = 0
+            for func in funcs:
+                i += 1
+                last = (i == len(funcs))
+                if (args.header):
+                    txt = generate_wrapper( func, header=True, variant=variant )
+                    print( txt, file=header, end='' )
+                if (args.wrapper):
+                    txt = '// ' + '-'*77 + '\n'
+                    print( txt, file=wrapper, end='' )
+                    if (last):
+                        txt = generate_docs( func, variant=variant )
+                        print( txt, file=wrapper, end='' )
+                    else:
+                        print( '/// @ingroup ' + func.group + '\n', file=wrapper, end='' )
+                    txt = generate_wrapper( func, variant=variant )
+                    print( txt, file=wrapper, end='' )
+            # end
+        # end
+    # end
+
     # tester needs to see all related functions
     if (args.tester):
         txt = generate_tester( funcs )